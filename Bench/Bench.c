@@ -0,0 +1,437 @@
+#include "OrionPublicPacketShim.h"
+#include "GeolocateTelemetry.h"
+#include "earthposition.h"
+#include "quaternion.h"
+#include "KlvEncoder.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+// Name of the build target, which gets passed in by the makefile
+#ifndef BENCH_TARGET
+#define BENCH_TARGET "unknown"
+#endif
+
+// Default minimum time for each timed run in seconds, and the number of runs the best one is picked from
+#define BENCH_MIN_TIME 0.2
+#define BENCH_RUNS     5
+
+// Size of the packet stream for the parser benchmarks, which must be a power of two
+#define STREAM_SIZE 65536
+
+// Number of inputs that the geodesy and DCM benchmarks cycle through, which must be a power of two
+#define NUM_POINTS 1024
+
+//! A single benchmark
+typedef struct
+{
+    //! Name that shows up in the results
+    const char *pName;
+
+    //! Sets up inputs once before timing, may be NULL
+    void (*pSetup)(void);
+
+    //! Runs the operation being measured Count times
+    void (*pRun)(UInt32 Count);
+
+    //! Bytes processed by each operation, or 0 if a byte rate doesn't make sense
+    UInt32 Bytes;
+
+} Benchmark_t;
+
+// A few helper functions, etc.
+static double GetTimeSec(void);
+static double TimeBenchmark(const Benchmark_t *pBench, double MinTime, UInt32 *pCount);
+static BOOL IsSelected(const char *pName, int argc, char **argv);
+
+// Setup and run functions for each benchmark
+static void SetupStream(void);
+static void RunParseByte(UInt32 Count);
+static BOOL CountPacket(const TrilliumPkt_t *pPkt, void *pUser);
+static void RunParseBuffer(UInt32 Count);
+static void RunMakePacket(UInt32 Count);
+static void SetupPoints(void);
+static void RunEcefToLla(UInt32 Count);
+static void RunLlaToEcef(UInt32 Count);
+static void RunQuaternionToDcm(UInt32 Count);
+static void SetupGeolocate(void);
+static void RunConvertGeolocate(UInt32 Count);
+static void RunTerrainIntersection(UInt32 Count);
+static void SetupKlv(void);
+static void RunKlvParse(UInt32 Count);
+
+// Synthetic terrain that the intersection benchmark runs against
+static float GetHillsHAE(double Lat, double Lon);
+
+// Inputs shared by the benchmarks
+static UInt8 Stream[STREAM_SIZE];
+static double PointsLLA[NUM_POINTS][NLLA], PointsECEF[NUM_POINTS][NECEF];
+static float Quats[NUM_POINTS][NQUATERNION];
+static GeolocateTelemetryCore_t Core;
+static GeolocateTelemetry_t Geo;
+static UInt8 KlvSet[KLV_ENCODER_MAX_SET];
+static UInt32 KlvSize;
+
+// Results go here so the compiler can't throw the work away
+static volatile double Sink;
+
+// Every benchmark, in the order they get run
+static Benchmark_t Benchmarks[] = {
+    { "trillium_parse_byte",         SetupStream,    RunParseByte,           1 },
+    { "trillium_parse_buffer",       SetupStream,    RunParseBuffer,         STREAM_SIZE },
+    { "trillium_make_packet",        NULL,           RunMakePacket,          64 + ORION_PKT_OVERHEAD },
+    { "ecef_to_lla",                 SetupPoints,    RunEcefToLla,           0 },
+    { "lla_to_ecef",                 SetupPoints,    RunLlaToEcef,           0 },
+    { "quaternion_to_dcm",           SetupPoints,    RunQuaternionToDcm,     0 },
+    { "convert_geolocate_telemetry", SetupGeolocate, RunConvertGeolocate,    0 },
+    { "terrain_intersection",        SetupGeolocate, RunTerrainIntersection, 0 },
+    { "klv_parse",                   SetupKlv,       RunKlvParse,            0 },
+};
+
+int main(int argc, char **argv)
+{
+    double MinTime = BENCH_MIN_TIME;
+    int i, Start = 1;
+
+    // An optional -t argument sets the minimum run time, and any names after it pick which benchmarks run
+    if ((argc >= 3) && (strcmp(argv[1], "-t") == 0))
+    {
+        MinTime = atof(argv[2]);
+        Start = 3;
+    }
+
+    if (MinTime <= 0)
+    {
+        printf("USAGE: %s [-t seconds] [benchmark ...]\n", argv[0]);
+        return 1;
+    }
+
+    // The KLV set size is only known once it's been encoded
+    SetupKlv();
+    Benchmarks[sizeof(Benchmarks) / sizeof(Benchmarks[0]) - 1].Bytes = KlvSize;
+
+    // Print a CSV header, then one line per benchmark
+    printf("target,benchmark,iterations,ns_per_op,bytes_per_s\n");
+
+    for (i = 0; i < (int)(sizeof(Benchmarks) / sizeof(Benchmarks[0])); i++)
+    {
+        const Benchmark_t *pBench = &Benchmarks[i];
+        UInt32 Count;
+        double Time;
+
+        if (!IsSelected(pBench->pName, argc - Start, &argv[Start]))
+            continue;
+
+        // Set up the inputs and time the benchmark
+        if (pBench->pSetup != NULL)
+            pBench->pSetup();
+
+        Time = TimeBenchmark(pBench, MinTime, &Count);
+
+        // Leave the byte rate empty for benchmarks that don't process a byte stream
+        printf("%s,%s,%u,%.3f,", BENCH_TARGET, pBench->pName, Count, Time * 1e9 / Count);
+
+        if (pBench->Bytes > 0)
+            printf("%.0f\n", (double)pBench->Bytes * Count / Time);
+        else
+            printf("\n");
+
+        fflush(stdout);
+    }
+
+    return 0;
+
+}// main
+
+static double GetTimeSec(void)
+{
+    struct timespec Now;
+
+    // Use the monotonic clock so the wall clock can't skew the results
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return Now.tv_sec + Now.tv_nsec * 1e-9;
+
+}// GetTimeSec
+
+// Returns the best time of BENCH_RUNS runs of a benchmark, each of which takes at least MinTime seconds
+static double TimeBenchmark(const Benchmark_t *pBench, double MinTime, UInt32 *pCount)
+{
+    double Start, Time = 0, Best = 0;
+    UInt32 Count = 1;
+    int i;
+
+    // Keep doubling the count until a run takes a tenth of the minimum time, to size the real runs
+    while ((Time < MinTime / 10) && (Count < 0x40000000))
+    {
+        Count *= 2;
+        Start = GetTimeSec();
+        pBench->pRun(Count);
+        Time = GetTimeSec() - Start;
+    }
+
+    // Now scale the count up so each run takes about the minimum time
+    if (Time > 0)
+        Count = (UInt32)MIN(Count * (MinTime / Time), 4e9);
+
+    // Take the best run, since anything slower than that is other stuff getting in the way
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        Start = GetTimeSec();
+        pBench->pRun(Count);
+        Time = GetTimeSec() - Start;
+
+        if ((i == 0) || (Time < Best))
+            Best = Time;
+    }
+
+    *pCount = Count;
+    return Best;
+
+}// TimeBenchmark
+
+// With no names given every benchmark runs, otherwise only the ones that are named
+static BOOL IsSelected(const char *pName, int argc, char **argv)
+{
+    int i;
+
+    if (argc <= 0)
+        return TRUE;
+
+    for (i = 0; i < argc; i++)
+    {
+        if (strcmp(pName, argv[i]) == 0)
+            return TRUE;
+    }
+
+    return FALSE;
+
+}// IsSelected
+
+static void SetupStream(void)
+{
+    OrionPkt_t Pkt;
+    UInt32 Size = 0, i;
+    int Length = 0;
+
+    // Fill the stream with packets of every length, leaving what's left at the end as junk
+    while (Size + ORION_PKT_MAX_SIZE + ORION_PKT_OVERHEAD <= STREAM_SIZE)
+    {
+        for (i = 0; i < (UInt32)Length; i++)
+            Pkt.Data[i] = (UInt8)(Size + i);
+
+        MakeOrionPacket(&Pkt, (UInt8)Length, Length);
+        memcpy(&Stream[Size], &Pkt, Length + ORION_PKT_OVERHEAD);
+        Size += Length + ORION_PKT_OVERHEAD;
+        Length = (Length + 17) % (ORION_PKT_MAX_SIZE + 1);
+    }
+
+    while (Size < STREAM_SIZE)
+        Stream[Size++] = 0x55;
+
+}// SetupStream
+
+static void RunParseByte(UInt32 Count)
+{
+    static OrionPkt_t Pkt;
+    UInt32 i, Found = 0;
+
+    // One operation is one byte, going around the stream as many times as it takes
+    for (i = 0; i < Count; i++)
+        Found += LookForOrionPacketInByte(&Pkt, Stream[i & (STREAM_SIZE - 1)]);
+
+    Sink = Found;
+
+}// RunParseByte
+
+static BOOL CountPacket(const TrilliumPkt_t *pPkt, void *pUser)
+{
+    // Just count the packet and keep going
+    (*(UInt32 *)pUser)++;
+    return TRUE;
+
+}// CountPacket
+
+static void RunParseBuffer(UInt32 Count)
+{
+    static OrionPkt_t Pkt;
+    UInt32 i, Found = 0;
+
+    // One operation is the whole stream
+    for (i = 0; i < Count; i++)
+        LookForOrionPacketsInBuffer(&Pkt, Stream, STREAM_SIZE, CountPacket, &Found);
+
+    Sink = Found;
+
+}// RunParseBuffer
+
+static void RunMakePacket(UInt32 Count)
+{
+    static OrionPkt_t Pkt;
+    UInt32 i;
+
+    // Checksum a 64 byte payload over and over, changing one byte so nothing gets hoisted out
+    for (i = 0; i < Count; i++)
+    {
+        Pkt.Data[0] = (UInt8)i;
+        MakeOrionPacket(&Pkt, 0x40, 64);
+    }
+
+    Sink = Pkt.Data[64];
+
+}// RunMakePacket
+
+static void SetupPoints(void)
+{
+    int i;
+
+    // Spread the points over the whole globe and a range of altitudes, with attitudes to match
+    for (i = 0; i < NUM_POINTS; i++)
+    {
+        PointsLLA[i][LAT] = asin(2.0 * ((i * 0.618034) - floor(i * 0.618034)) - 1.0);
+        PointsLLA[i][LON] = (2.0 * ((i * 0.414214) - floor(i * 0.414214)) - 1.0) * PId;
+        PointsLLA[i][ALT] = (i % 64) * 150.0 - 400.0;
+        llaToECEF(PointsLLA[i], PointsECEF[i]);
+
+        setQuaternionBasedOnEuler(Quats[i], (float)PointsLLA[i][LON], (float)PointsLLA[i][LAT] / 2, (float)(i % 7) / 10);
+    }
+
+}// SetupPoints
+
+static void RunEcefToLla(UInt32 Count)
+{
+    double LLA[NLLA], Sum = 0;
+    UInt32 i;
+
+    for (i = 0; i < Count; i++)
+    {
+        ecefToLLA(PointsECEF[i & (NUM_POINTS - 1)], LLA);
+        Sum += LLA[ALT];
+    }
+
+    Sink = Sum;
+
+}// RunEcefToLla
+
+static void RunLlaToEcef(UInt32 Count)
+{
+    double ECEF[NECEF], Sum = 0;
+    UInt32 i;
+
+    for (i = 0; i < Count; i++)
+    {
+        llaToECEF(PointsLLA[i & (NUM_POINTS - 1)], ECEF);
+        Sum += ECEF[0];
+    }
+
+    Sink = Sum;
+
+}// RunLlaToEcef
+
+static void RunQuaternionToDcm(UInt32 Count)
+{
+    stackAllocateMatrixf(Dcm, 3, 3);
+    double Sum = 0;
+    UInt32 i;
+
+    for (i = 0; i < Count; i++)
+    {
+        quaternionToDCM(Quats[i & (NUM_POINTS - 1)], &Dcm);
+        Sum += Dcm.data[0];
+    }
+
+    Sink = Sum;
+
+}// RunQuaternionToDcm
+
+static void SetupGeolocate(void)
+{
+    // A gimbal 1500 m above the ellipsoid, heading northeast and looking 30 degrees down, with a date and time in 2024
+    memset(&Core, 0, sizeof(Core));
+    Core.systemTime = 1000000;
+    Core.gpsWeek = 2300;
+    Core.gpsITOW = 123456789;
+    Core.leapSeconds = 18;
+    Core.geoidUndulation = -32.0;
+    Core.posLat = deg2rad(37.4);
+    Core.posLon = deg2rad(-122.1);
+    Core.posAlt = 1500.0;
+    Core.velNED[0] = 20.0f;
+    Core.velNED[1] = 15.0f;
+    setQuaternionBasedOnEuler(Core.gimbalQuat, deg2radf(45.0f), deg2radf(2.0f), deg2radf(-1.0f));
+    memcpy(Core.insQuat, Core.gimbalQuat, sizeof(Core.insQuat));
+    Core.pan = deg2radf(10.0f);
+    Core.tilt = deg2radf(-30.0f);
+    Core.hfov = deg2radf(20.0f);
+    Core.vfov = deg2radf(11.25f);
+    Core.pixelWidth = 1920;
+    Core.pixelHeight = 1080;
+    Core.cameraIndex = -1;
+
+    ConvertGeolocateTelemetryCore(&Core, &Geo);
+
+}// SetupGeolocate
+
+static void RunConvertGeolocate(UInt32 Count)
+{
+    UInt32 i;
+
+    // Move the gimbal a little each time so the conversion can't be skipped
+    for (i = 0; i < Count; i++)
+    {
+        Core.systemTime = i;
+        Core.gpsITOW = 123456789 + (i & 1023) * 20;
+        ConvertGeolocateTelemetryCore(&Core, &Geo);
+    }
+
+    Sink = Geo.posECEF[0];
+
+}// RunConvertGeolocate
+
+static float GetHillsHAE(double Lat, double Lon)
+{
+    // Rolling hills a few kilometers across and 300 m from peak to trough
+    return (float)(150.0 + 150.0 * sin(Lat * 2000.0) * cos(Lon * 1500.0));
+
+}// GetHillsHAE
+
+static void RunTerrainIntersection(UInt32 Count)
+{
+    double LLA[NLLA], Range = 0, Sum = 0;
+    UInt32 i;
+
+    for (i = 0; i < Count; i++)
+    {
+        if (getTerrainIntersection(&Geo, GetHillsHAE, LLA, &Range))
+            Sum += Range;
+    }
+
+    Sink = Sum;
+
+}// RunTerrainIntersection
+
+static void SetupKlv(void)
+{
+    KlvEncoder_t Encoder;
+
+    // Encode a full local set from the same telemetry the geolocate benchmarks use
+    SetupGeolocate();
+    KlvEncoderInit(&Encoder, 0, 0);
+    KlvSize = KlvEncodeTelemetry(&Encoder, &Geo, NULL, KlvSet, sizeof(KlvSet));
+
+}// SetupKlv
+
+static void RunKlvParse(UInt32 Count)
+{
+    UInt32 i;
+    int Result;
+
+    // Parse the set and pull a value out of it, like a video player would for every frame
+    for (i = 0; i < Count; i++)
+        KlvNewData(KlvSet, KlvSize);
+
+    Sink = KlvGetValueDouble(KLV_UAS_SENSOR_LAT, &Result);
+
+}// RunKlvParse
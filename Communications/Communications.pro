@@ -15,8 +15,16 @@ SOURCES += \
     fieldencode.c \
     floatspecial.c \
     OrionComm.c \
+    OrionCommCapture.c \
+    OrionCommClock.c \
+    OrionCommMulticast.c \
+    OrionCommShared.c \
+    OrionCommExecutor.c \
+    OrionCommReliable.c \
+    OrionCommStats.c \
     OrionCommLinux.c \
     OrionCommWindows.c \
+    OrionPublicDispatch.c \
     OrionPublicPacket.c \
     scaleddecode.c \
     scaledencode.c
@@ -26,6 +34,13 @@ HEADERS += \
     fieldencode.h \
     floatspecial.h \
     OrionComm.h \
+    OrionCommCapture.h \
+    OrionCommReliable.h \
+    OrionCommMulticast.h \
+    OrionCommShared.h \
+    OrionCommExecutor.h \
+    OrionComm.hpp \
+    OrionPublicDispatch.h \
     OrionPublicPacket.h \
     scaleddecode.h \
     scaledencode.h
@@ -49,7 +64,7 @@ unix {
 win32 {
     Public.commands = GenerateOrionPublicPacketWin.bat
 } else {
-    Public.commands = ../Protogen/Protogen.sh $$Public.depends .
+    Public.commands = ../Protogen/Protogen.sh $$Public.depends . && ../GenerateOrionDispatch.sh .
 }
 
 PRE_TARGETDEPS += $$Public.target
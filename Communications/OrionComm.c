@@ -1,7 +1,23 @@
 #include "OrionComm.h"
+#include "OrionCommCapture.h"
+#include "OrionCommMulticast.h"
+#include "OrionCommShared.h"
+#include "Atomics.h"
 
+#include <string.h>
+#include <stdlib.h>
 
-BOOL OrionCommOpen(int *pArgc, char ***pArgv)
+
+// Connection used by all of the non-Ex functions
+static OrionCommContext_t DefaultContext = ORION_COMM_CONTEXT_INIT;
+
+// Link statistics have one writer each but can be read from any thread, so counters only ever get stored whole
+#define StatsAdd(pCounter, Value) atomicStoreRelaxed32((pCounter), *(pCounter) + (Value))
+
+static BOOL OpenSerialArg(OrionCommContext_t *pContext, const char *pArg);
+static void UpdateRxStats(OrionCommContext_t *pContext, UInt32 Head, OrionPkt_t *pPkts, OrionPktView_t *pViews, int Count);
+
+BOOL OrionCommOpenEx(OrionCommContext_t *pContext, int *pArgc, char ***pArgv)
 {
     // If there are at least two arguments, and the first looks like a serial port or IP
     if (*pArgc >= 2)
@@ -13,8 +29,8 @@ BOOL OrionCommOpen(int *pArgc, char ***pArgv)
             (*pArgc)--;
             (*pArgv) = &(*pArgv)[1];
 
-            // Try opening the specified serial port
-            return OrionCommOpenSerial((*pArgv)[0]);
+            // Try opening the specified serial port, at the baud rate after it if there is one
+            return OpenSerialArg(pContext, (*pArgv)[0]);
         }
         // IP address...?
         else if (OrionCommIpStringValid((*pArgv)[1]))
@@ -24,11 +40,715 @@ BOOL OrionCommOpen(int *pArgc, char ***pArgv)
             (*pArgv) = &(*pArgv)[1];
 
             // Try connecting to a gimbal at this IP
-            return OrionCommOpenNetworkIp((*pArgv)[0]);
+            return OrionCommOpenNetworkIpEx(pContext, (*pArgv)[0]);
         }
     }
 
     // If we haven't connected any other way, try using network broadcast
-    return OrionCommOpenNetwork();
+    return OrionCommOpenNetworkEx(pContext);
+
+}// OrionCommOpenEx
+
+BOOL OrionCommOpenSerialEx(OrionCommContext_t *pContext, const char *pPath)
+{
+    return OrionCommOpenSerialBaudEx(pContext, pPath, ORION_COMM_SERIAL_BAUD);
+
+}// OrionCommOpenSerialEx
+
+BOOL OrionCommSendEx(OrionCommContext_t *pContext, const OrionPkt_t *pPkt)
+{
+    // Log the packet if this connection is being recorded
+    if (pContext->pCapture != NULL)
+        OrionCommCaptureWrite(pContext->pCapture, ORION_COMM_CAPTURE_TX, pContext->CaptureLink, pPkt, OrionCommCaptureTime());
+
+    // Count the packet on its way out
+    StatsAdd(&pContext->Stats.PacketsTx, 1);
+    StatsAdd(&pContext->Stats.BytesTx, pPkt->Length + ORION_PKT_OVERHEAD);
+
+    // Write any queued packets and then this one, including header data, in a single call
+    return OrionCommTxWrite(pContext, pPkt);
+
+}// OrionCommSendEx
+
+BOOL OrionCommFlushEx(OrionCommContext_t *pContext)
+{
+    // Push out everything in the send queue, returning TRUE if it's now empty
+    return OrionCommTxWrite(pContext, NULL) && (pContext->Tx.Size == 0);
+
+}// OrionCommFlushEx
+
+BOOL OrionCommReceiveEx(OrionCommContext_t *pContext, OrionPkt_t *pPkt)
+{
+    // Just grab a single packet out of the batch receive path
+    return OrionCommReceiveBatchEx(pContext, pPkt, 1) == 1;
+
+}// OrionCommReceiveEx
+
+int OrionCommReceiveBatchEx(OrionCommContext_t *pContext, OrionPkt_t *pPkts, int Max)
+{
+    // Note where the ring's write index was to count the bytes read in by this call
+    UInt32 Head = pContext->Rx.Head;
+
+    // Start with any packets left over in the ring from the last call
+    int i, Count = OrionCommRxParse(&pContext->Rx, pPkts, Max);
+
+    // Now keep draining the port or socket until it runs dry or the caller's array fills up
+    while ((Count < Max) && (OrionCommRxFill(pContext) > 0))
+        Count += OrionCommRxParse(&pContext->Rx, &pPkts[Count], Max - Count);
+
+    // Log everything we got if this connection is being recorded, with one timestamp per batch
+    if ((pContext->pCapture != NULL) && (Count > 0))
+    {
+        UInt64 Time = OrionCommCaptureTime();
+
+        for (i = 0; i < Count; i++)
+            OrionCommCaptureWrite(pContext->pCapture, ORION_COMM_CAPTURE_RX, pContext->CaptureLink, &pPkts[i], Time);
+    }
+
+    // Pass everything we got on to the multicast group if this connection is being relayed, in as few sends as possible
+    if ((pContext->pRelay != NULL) && (Count > 0))
+    {
+        for (i = 0; i < Count; i++)
+            OrionCommPublish(pContext->pRelay, &pPkts[i]);
+
+        OrionCommPublisherFlush(pContext->pRelay);
+    }
+
+    // Count everything that came in
+    UpdateRxStats(pContext, Head, pPkts, NULL, Count);
+
+    // Keep the latest of each packet in shared memory if this connection feeds a store
+    if (pContext->pShared != NULL)
+    {
+        for (i = 0; i < Count; i++)
+            OrionCommSharedWrite(pContext->pShared, &pPkts[i], pPkts[i].Info.Time);
+    }
+
+    // Tell the caller how many packets we got
+    return Count;
+
+}// OrionCommReceiveBatchEx
+
+int OrionCommReceiveViewsEx(OrionCommContext_t *pContext, OrionPktView_t *pViews, int Max)
+{
+    UInt32 Head = pContext->Rx.Head;
+    int i, Count;
+
+    // Views from the last call are no longer valid, so their bytes can be reused
+    OrionCommRxRelease(&pContext->Rx);
+
+    // Start with any packets left over in the ring from the last call
+    Count = OrionCommRxParseViews(&pContext->Rx, pViews, Max);
+
+    // Keep draining the port or socket into the space the views aren't using
+    while ((Count < Max) && (pContext->Rx.NumSpill < ORION_COMM_RX_SPILL_COUNT) && (OrionCommRxFill(pContext) > 0))
+        Count += OrionCommRxParseViews(&pContext->Rx, &pViews[Count], Max - Count);
+
+    // Log everything we got if this connection is being recorded, with one timestamp per batch
+    if ((pContext->pCapture != NULL) && (Count > 0))
+    {
+        UInt64 Time = OrionCommCaptureTime();
+
+        for (i = 0; i < Count; i++)
+            OrionCommCaptureWrite(pContext->pCapture, ORION_COMM_CAPTURE_RX, pContext->CaptureLink, pViews[i].pPkt, Time);
+    }
+
+    // Pass everything we got on to the multicast group if this connection is being relayed, in as few sends as possible
+    if ((pContext->pRelay != NULL) && (Count > 0))
+    {
+        for (i = 0; i < Count; i++)
+            OrionCommPublish(pContext->pRelay, pViews[i].pPkt);
+
+        OrionCommPublisherFlush(pContext->pRelay);
+    }
+
+    // Count everything that came in
+    UpdateRxStats(pContext, Head, NULL, pViews, Count);
+
+    // Keep the latest of each packet in shared memory if this connection feeds a store
+    if (pContext->pShared != NULL)
+    {
+        for (i = 0; i < Count; i++)
+            OrionCommSharedWrite(pContext->pShared, pViews[i].pPkt, pViews[i].Time);
+    }
+
+    // Tell the caller how many packets we got
+    return Count;
+
+}// OrionCommReceiveViewsEx
+
+void OrionCommRecordEx(OrionCommContext_t *pContext, OrionCommCaptureWriter_t *pWriter, UInt8 Link)
+{
+    // Everything sent and received from here on gets logged to this capture, or nowhere if it's NULL
+    pContext->pCapture = pWriter;
+    pContext->CaptureLink = Link;
+
+}// OrionCommRecordEx
+
+void OrionCommRelayEx(OrionCommContext_t *pContext, OrionCommPublisher_t *pPublisher)
+{
+    // Everything received from here on gets published as well, or nowhere if it's NULL
+    pContext->pRelay = pPublisher;
+
+}// OrionCommRelayEx
+
+void OrionCommShareEx(OrionCommContext_t *pContext, OrionCommShared_t *pShared)
+{
+    // Everything received from here on gets written to the store as well, or nowhere if it's NULL
+    pContext->pShared = pShared;
+
+}// OrionCommShareEx
+
+BOOL OrionCommQueueEx(OrionCommContext_t *pContext, const OrionPkt_t *pPkt)
+{
+    UInt32 Size = pPkt->Length + ORION_PKT_OVERHEAD;
+
+    // If the packet won't fit behind what's already queued, try pushing the queue out first
+    if (pContext->Tx.Size + Size > ORION_COMM_TX_BUFFER_SIZE)
+        OrionCommFlushEx(pContext);
+
+    // Tack the packet onto the end of the queue, if there's room for it now, and count it as dropped if not
+    if (!OrionCommTxAppend(&pContext->Tx, (const UInt8 *)pPkt, Size))
+    {
+        StatsAdd(&pContext->Stats.TxDropped, 1);
+        return FALSE;
+    }
+
+    // Log and count the packet once it's queued, since that's when the caller handed it over for good
+    if (pContext->pCapture != NULL)
+        OrionCommCaptureWrite(pContext->pCapture, ORION_COMM_CAPTURE_TX, pContext->CaptureLink, pPkt, OrionCommCaptureTime());
+
+    StatsAdd(&pContext->Stats.PacketsTx, 1);
+    StatsAdd(&pContext->Stats.BytesTx, Size);
+
+    return TRUE;
+
+}// OrionCommQueueEx
+
+// Opens a serial port given on the command line as its path, or as its path and baud rate, e.g. /dev/ttyUSB0:921600
+static BOOL OpenSerialArg(OrionCommContext_t *pContext, const char *pArg)
+{
+    const char *pColon = strrchr(pArg, ':');
+    unsigned long Baud = 0;
+    char Path[256];
+    char *pEnd = NULL;
+
+    // Anything after the last colon has to be a number for it to be a baud rate
+    if (pColon != NULL)
+        Baud = strtoul(pColon + 1, &pEnd, 10);
+
+    // Otherwise the whole thing is the path
+    if ((Baud == 0) || (*pEnd != '\0') || (pColon - pArg >= (int)sizeof(Path)))
+        return OrionCommOpenSerialEx(pContext, pArg);
+
+    // Split the path off from the baud rate and open it
+    memcpy(Path, pArg, pColon - pArg);
+    Path[pColon - pArg] = '\0';
+    return OrionCommOpenSerialBaudEx(pContext, Path, (UInt32)Baud);
+
+}// OpenSerialArg
+
+// Folds the bytes and packets from one receive call into a connection's link statistics
+static void UpdateRxStats(OrionCommContext_t *pContext, UInt32 Head, OrionPkt_t *pPkts, OrionPktView_t *pViews, int Count)
+{
+    OrionCommStats_t *pStats = &pContext->Stats;
+    OrionCommRxBuffer_t *pRx = &pContext->Rx;
+    OrionPktInfo_t *pInfo = &pRx->Pkt.Info;
+    UInt32 Gap = 0, Bytes = 0;
+    SInt32 Delta, Resync;
+    UInt64 Now = 0;
+    int i;
+
+    // Bytes read in are however far the write index moved, and the parser counts bad checksums for us
+    StatsAdd(&pStats->BytesRx, pRx->Head - Head);
+    StatsAdd(&pStats->ChecksumErrors, pInfo->Errors);
+    pInfo->Errors = 0;
+
+    // Every packet in a batch gets the same arrival time, so only the first one has a gap before it
+    if (Count > 0)
+    {
+        Now = OrionCommStatsTime();
+        Gap = (pStats->LastRxTime != 0) ? (UInt32)MIN(Now - pStats->LastRxTime, 0xFFFFFFFFu) : 0;
+        atomicStoreRelaxed64(&pStats->LastRxTime, Now);
+
+        OrionCommHistogramAdd(&pStats->InterArrival, Gap, 1);
+        OrionCommHistogramAdd(&pStats->InterArrival, 0, Count - 1);
+    }
+
+    for (i = 0; i < Count; i++)
+    {
+        const OrionPkt_t *pPkt;
+
+        // Stamp the packet with its arrival time, which for a view can't go in the packet it points to
+        if (pPkts != NULL)
+        {
+            pPkt = &pPkts[i];
+            pPkts[i].Info.Time = Now;
+        }
+        else
+        {
+            pPkt = pViews[i].pPkt;
+            pViews[i].Time = Now;
+        }
+
+        // Smooth the change between successive gaps with a gain of 1/16, the same as RTP
+        Delta = (SInt32)(Gap - pStats->LastGap);
+        Delta = (Delta < 0) ? -Delta : Delta;
+        atomicStoreRelaxed32(&pStats->Jitter, pStats->Jitter + (Delta - (SInt32)pStats->Jitter) / 16);
+        atomicStoreRelaxed32(&pStats->LastGap, Gap);
+        Gap = 0;
+
+        // Count the packet and its bytes
+        StatsAdd(&pStats->PacketsPerId[pPkt->ID], 1);
+        Bytes += pPkt->Length + ORION_PKT_OVERHEAD;
+
+        // Telemetry packets carry the gimbal's clock, so they feed the clock offset estimate
+        OrionCommClockAddPacket(&pContext->Clock, pPkt, Now);
+    }
+
+    StatsAdd(&pStats->PacketsRx, (UInt32)MAX(Count, 0));
+    StatsAdd(&pStats->PacketBytesRx, Bytes);
+
+    // Bytes that went in but didn't come out in a packet, less anything still waiting in the ring or the parser.
+    //   This is worked out here rather than by whoever reads the stats, since only this thread can see the ring.
+    Resync = (SInt32)(pStats->BytesRx - pStats->PacketBytesRx - (pRx->Head - pRx->Tail) - pInfo->State);
+    atomicStoreRelaxed32(&pStats->ResyncBytes, (UInt32)MAX(Resync, 0));
+
+}// UpdateRxStats
+
+void OrionCommInitEx(OrionCommContext_t *pContext)
+{
+    // Everything starts at zero apart from the handles, which start out closed
+    memset(pContext, 0, sizeof(OrionCommContext_t));
+#ifdef _WIN32
+    pContext->SerialHandle = INVALID_HANDLE_VALUE;
+    pContext->TcpSocket = INVALID_SOCKET;
+#else
+    pContext->Handle = -1;
+#endif // _WIN32
+
+}// OrionCommInitEx
+
+OrionCommContext_t *OrionCommGetDefaultContext(void)
+{
+    // Hand out the context behind the non-Ex functions, e.g. for mixing both APIs
+    return &DefaultContext;
+
+}// OrionCommGetDefaultContext
+
+void OrionCommGetStats(OrionCommStats_t *pStats)
+{
+    OrionCommGetStatsEx(&DefaultContext, pStats);
+
+}// OrionCommGetStats
+
+BOOL OrionCommOpen(int *pArgc, char ***pArgv)
+{
+    return OrionCommOpenEx(&DefaultContext, pArgc, pArgv);
 
 }// OrionCommOpen
+
+BOOL OrionCommOpenSerial(const char *pPath)
+{
+    return OrionCommOpenSerialEx(&DefaultContext, pPath);
+
+}// OrionCommOpenSerial
+
+BOOL OrionCommOpenSerialBaud(const char *pPath, UInt32 Baud)
+{
+    return OrionCommOpenSerialBaudEx(&DefaultContext, pPath, Baud);
+
+}// OrionCommOpenSerialBaud
+
+BOOL OrionCommOpenNetworkIp(const char *pAddress)
+{
+    return OrionCommOpenNetworkIpEx(&DefaultContext, pAddress);
+
+}// OrionCommOpenNetworkIp
+
+void OrionCommClose(void)
+{
+    OrionCommCloseEx(&DefaultContext);
+
+}// OrionCommClose
+
+BOOL OrionCommSend(const OrionPkt_t *pPkt)
+{
+    return OrionCommSendEx(&DefaultContext, pPkt);
+
+}// OrionCommSend
+
+BOOL OrionCommQueue(const OrionPkt_t *pPkt)
+{
+    return OrionCommQueueEx(&DefaultContext, pPkt);
+
+}// OrionCommQueue
+
+BOOL OrionCommFlush(void)
+{
+    return OrionCommFlushEx(&DefaultContext);
+
+}// OrionCommFlush
+
+BOOL OrionCommSetNoDelay(BOOL NoDelay)
+{
+    return OrionCommSetNoDelayEx(&DefaultContext, NoDelay);
+
+}// OrionCommSetNoDelay
+
+BOOL OrionCommReceive(OrionPkt_t *pPkt)
+{
+    return OrionCommReceiveEx(&DefaultContext, pPkt);
+
+}// OrionCommReceive
+
+int OrionCommReceiveBatch(OrionPkt_t *pPkts, int Max)
+{
+    return OrionCommReceiveBatchEx(&DefaultContext, pPkts, Max);
+
+}// OrionCommReceiveBatch
+
+BOOL OrionCommIsOpen(void)
+{
+    return OrionCommIsOpenEx(&DefaultContext);
+
+}// OrionCommIsOpen
+
+void OrionCommRecord(OrionCommCaptureWriter_t *pWriter, UInt8 Link)
+{
+    OrionCommRecordEx(&DefaultContext, pWriter, Link);
+
+}// OrionCommRecord
+
+void OrionCommRelay(OrionCommPublisher_t *pPublisher)
+{
+    OrionCommRelayEx(&DefaultContext, pPublisher);
+
+}// OrionCommRelay
+
+void OrionCommShare(OrionCommShared_t *pShared)
+{
+    OrionCommShareEx(&DefaultContext, pShared);
+
+}// OrionCommShare
+
+// Tracks the output array for the receive ring's packet handler
+typedef struct
+{
+    OrionCommRxBuffer_t *pRx;
+    OrionPkt_t *pPkts;
+    OrionPktView_t *pViews;
+    int Count;
+    int Max;
+} RxParseState_t;
+
+static BOOL RxParseHandler(const TrilliumPkt_t *pPkt, void *pUser)
+{
+    RxParseState_t *pState = (RxParseState_t *)pUser;
+    OrionCommRxBuffer_t *pRx = pState->pRx;
+
+    // If the caller wants copies, copy just the header, payload and checksum out of the ring
+    if (pState->pPkts != NULL)
+        memcpy(&pState->pPkts[pState->Count++], pPkt, pPkt->Length + ORION_PKT_OVERHEAD);
+    else
+    {
+        // Split packets get assembled in pRx->Pkt, which the parser reuses, so set them aside
+        if (pPkt == &pRx->Pkt)
+        {
+            memcpy(&pRx->Spill[pRx->NumSpill], pPkt, pPkt->Length + ORION_PKT_OVERHEAD);
+            pPkt = &pRx->Spill[pRx->NumSpill++];
+        }
+
+        // Otherwise the view can point straight into the ring
+        makeOrionPktView(&pState->pViews[pState->Count++], pPkt);
+
+        // Another split packet would have nowhere to go, so stop once the spill slots are used up
+        if (pRx->NumSpill >= ORION_COMM_RX_SPILL_COUNT)
+            return FALSE;
+    }
+
+    // Keep going as long as there's room for more packets
+    return pState->Count < pState->Max;
+
+}// RxParseHandler
+
+void OrionCommRxReset(OrionCommRxBuffer_t *pRx)
+{
+    // Empty the ring and throw away any partial packet
+    pRx->Head = pRx->Tail = pRx->Hold = 0;
+    pRx->NumSpill = 0;
+    memset(&pRx->Pkt.Info, 0, sizeof(pRx->Pkt.Info));
+
+}// OrionCommRxReset
+
+int OrionCommRxGetFree(OrionCommRxBuffer_t *pRx, UInt8 *pData[2], UInt32 Size[2])
+{
+    UInt32 Free = ORION_COMM_RX_BUFFER_SIZE - (pRx->Head - pRx->Hold);
+    UInt32 Start = pRx->Head & (ORION_COMM_RX_BUFFER_SIZE - 1);
+
+    // If the ring is full, there's nowhere to put new data
+    if (Free == 0)
+        return 0;
+
+    // The first free region runs from the write index up to the end of the ring (or the held data)
+    pData[0] = &pRx->Data[Start];
+    Size[0] = MIN(Free, ORION_COMM_RX_BUFFER_SIZE - Start);
+
+    // The second region, if any, wraps around to the start of the ring
+    pData[1] = pRx->Data;
+    Size[1] = Free - Size[0];
+
+    // Tell the caller how many regions there are
+    return (Size[1] > 0) ? 2 : 1;
+
+}// OrionCommRxGetFree
+
+void OrionCommRxCommit(OrionCommRxBuffer_t *pRx, UInt32 Bytes)
+{
+    // Bump the write index by however many bytes were read into the free regions
+    pRx->Head += Bytes;
+
+}// OrionCommRxCommit
+
+BOOL OrionCommTxAppend(OrionCommTxBuffer_t *pTx, const UInt8 *pData, UInt32 Size)
+{
+    // If this won't fit, leave the queue alone
+    if (pTx->Size + Size > ORION_COMM_TX_BUFFER_SIZE)
+        return FALSE;
+
+    // Otherwise copy it in after everything else
+    memcpy(&pTx->Data[pTx->Size], pData, Size);
+    pTx->Size += Size;
+    return TRUE;
+
+}// OrionCommTxAppend
+
+BOOL OrionCommTxWritten(OrionCommTxBuffer_t *pTx, const OrionPkt_t *pPkt, UInt32 Bytes)
+{
+    UInt32 Queued = pTx->Size;
+
+    // If some of the queue didn't make it out, slide the rest down to the front
+    if (Bytes < Queued)
+    {
+        memmove(pTx->Data, &pTx->Data[Bytes], Queued - Bytes);
+        pTx->Size = Queued - Bytes;
+        Bytes = 0;
+    }
+    // Otherwise the queue is empty, and whatever's left over came from the packet
+    else
+    {
+        pTx->Size = 0;
+        Bytes -= Queued;
+    }
+
+    // Queue up whatever's left of the packet so it goes out in order on the next flush
+    if (pPkt != NULL)
+    {
+        UInt32 Size = pPkt->Length + ORION_PKT_OVERHEAD;
+
+        if (Bytes < Size)
+            return OrionCommTxAppend(pTx, (const UInt8 *)pPkt + Bytes, Size - Bytes);
+    }
+
+    // Everything got written or queued
+    return TRUE;
+
+}// OrionCommTxWritten
+
+void OrionCommRxRelease(OrionCommRxBuffer_t *pRx)
+{
+    // Any views handed out so far are done with, so their bytes can be overwritten
+    pRx->Hold = pRx->Tail;
+    pRx->NumSpill = 0;
+
+}// OrionCommRxRelease
+
+// Runs the bulk parser over everything in the ring until it's empty or the handler says stop
+static void RxParseRing(OrionCommRxBuffer_t *pRx, RxParseState_t *pState)
+{
+    // As long as there's data in the ring and room for more packets
+    while ((pRx->Tail != pRx->Head) && (pState->Count < pState->Max))
+    {
+        UInt32 Start = pRx->Tail & (ORION_COMM_RX_BUFFER_SIZE - 1);
+        UInt32 Size = MIN(pRx->Head - pRx->Tail, ORION_COMM_RX_BUFFER_SIZE - Start);
+        UInt32 Used;
+
+        // Parse the contiguous chunk up to the write index or the end of the ring
+        Used = LookForOrionPacketsInBuffer(&pRx->Pkt, &pRx->Data[Start], Size, RxParseHandler, pState);
+        pRx->Tail += Used;
+
+        // If the parser stopped early, the output array is full
+        if (Used < Size)
+            break;
+    }
+
+}// RxParseRing
+
+int OrionCommRxParse(OrionCommRxBuffer_t *pRx, OrionPkt_t *pPkts, int Max)
+{
+    RxParseState_t State = { pRx, pPkts, NULL, 0, Max };
+
+    // Pull packets out of the ring, then let go of the bytes since everything was copied out
+    RxParseRing(pRx, &State);
+    OrionCommRxRelease(pRx);
+
+    // Return the number of packets we found
+    return State.Count;
+
+}// OrionCommRxParse
+
+int OrionCommRxParseViews(OrionCommRxBuffer_t *pRx, OrionPktView_t *pViews, int Max)
+{
+    RxParseState_t State = { pRx, NULL, pViews, 0, Max };
+
+    // If the spill slots are all taken, a split packet would have nowhere to go
+    if (pRx->NumSpill < ORION_COMM_RX_SPILL_COUNT)
+        RxParseRing(pRx, &State);
+
+    // Return the number of packets we found - the ring holds on to their bytes until released
+    return State.Count;
+
+}// OrionCommRxParseViews
+
+// Number of packets to pull off a connection per receive call when dispatching, and the most packets
+//   one connection gets dispatched per pass, so a busy link can't starve the rest of the loop
+#define LOOP_BATCH_SIZE 8
+#define LOOP_MAX_DISPATCH 64
+
+// Returns the index of a connection in an event loop, or -1 if the loop isn't watching it
+static int LoopFind(const OrionCommLoop_t *pLoop, const OrionCommContext_t *pContext)
+{
+    int i;
+
+    // Just a linear search, since loops never have that many connections
+    for (i = 0; i < pLoop->NumContexts; i++)
+    {
+        if (pLoop->pContexts[i] == pContext)
+            return i;
+    }
+
+    // Not found
+    return -1;
+
+}// LoopFind
+
+BOOL OrionCommLoopAdd(OrionCommLoop_t *pLoop, OrionCommContext_t *pContext)
+{
+    // Make sure there's room for this connection and that it isn't already in the loop
+    if ((pLoop->NumContexts >= ORION_COMM_LOOP_MAX_CONTEXTS) || (LoopFind(pLoop, pContext) >= 0))
+        return FALSE;
+
+    // Only open connections can be waited on, and the platform code has to accept it
+    if (!OrionCommIsOpenEx(pContext) || !OrionCommLoopWatch(pLoop, pContext))
+        return FALSE;
+
+    // Add this connection to the end of the list
+    pLoop->Ready[pLoop->NumContexts] = FALSE;
+    pLoop->pContexts[pLoop->NumContexts++] = pContext;
+    return TRUE;
+
+}// OrionCommLoopAdd
+
+BOOL OrionCommLoopRemove(OrionCommLoop_t *pLoop, OrionCommContext_t *pContext)
+{
+    int Index = LoopFind(pLoop, pContext);
+
+    // If this loop isn't watching the connection, there's nothing to do
+    if (Index < 0)
+        return FALSE;
+
+    // Stop waiting on the connection, then fill its slot with the last entry in the list
+    OrionCommLoopUnwatch(pLoop, pContext);
+    pLoop->pContexts[Index] = pLoop->pContexts[--pLoop->NumContexts];
+    pLoop->Ready[Index] = pLoop->Ready[pLoop->NumContexts];
+    return TRUE;
+
+}// OrionCommLoopRemove
+
+void OrionCommLoopSetHandler(OrionCommLoop_t *pLoop, UInt8 ID, OrionCommHandler_t pHandler, void *pUser)
+{
+    // Store the callback and its user data in the ID lookup tables
+    pLoop->pHandlers[ID] = pHandler;
+    pLoop->pUsers[ID] = pUser;
+
+}// OrionCommLoopSetHandler
+
+void OrionCommLoopSetDefaultHandler(OrionCommLoop_t *pLoop, OrionCommHandler_t pHandler, void *pUser)
+{
+    // This one gets called for any packet ID that doesn't have its own handler
+    pLoop->pDefaultHandler = pHandler;
+    pLoop->pDefaultUser = pUser;
+
+}// OrionCommLoopSetDefaultHandler
+
+void OrionCommLoopDeliver(OrionCommLoop_t *pLoop, OrionCommContext_t *pContext, const OrionPkt_t *pPkt)
+{
+    // Look up the callback for this ID, falling back to the default callback
+    if (pLoop->pHandlers[pPkt->ID] != NULL)
+        pLoop->pHandlers[pPkt->ID](pContext, pPkt, pLoop->pUsers[pPkt->ID]);
+    else if (pLoop->pDefaultHandler != NULL)
+        pLoop->pDefaultHandler(pContext, pPkt, pLoop->pDefaultUser);
+
+}// OrionCommLoopDeliver
+
+int OrionCommLoopDispatch(OrionCommLoop_t *pLoop, OrionCommContext_t *pContext)
+{
+    OrionPktView_t Views[LOOP_BATCH_SIZE];
+    int i, Index, Count, Total = 0;
+
+    // A handler may have removed this connection since the wait returned, so make sure it's still here
+    if ((Index = LoopFind(pLoop, pContext)) < 0)
+        return 0;
+
+    // This is the connection's turn, whether it came from the kernel or from running out last time
+    pLoop->Ready[Index] = FALSE;
+
+    do
+    {
+        // Grab the next batch of packets from this connection, left in place in the receive ring
+        Count = OrionCommReceiveViewsEx(pContext, Views, MIN(LOOP_BATCH_SIZE, LOOP_MAX_DISPATCH - Total));
+
+        // Hand each one to the callback for its ID, or to the default callback
+        for (i = 0; i < Count; i++)
+        {
+            OrionCommLoopDeliver(pLoop, pContext, Views[i].pPkt);
+
+            // The handler may have closed the connection or taken it out of the loop, in which case
+            //   the rest of the batch isn't ours to deliver any more
+            if ((LoopFind(pLoop, pContext) < 0) || !OrionCommIsOpenEx(pContext))
+                return Total + i + 1;
+        }
+
+        Total += Count;
+
+    // Keep going until the connection runs dry or uses up its turn
+    } while ((Count > 0) && (Total < LOOP_MAX_DISPATCH));
+
+    // If it used up its turn, there may well be more waiting that the kernel already told us about
+    if ((Total >= LOOP_MAX_DISPATCH) && ((Index = LoopFind(pLoop, pContext)) >= 0))
+        pLoop->Ready[Index] = TRUE;
+
+    // Tell the caller how many packets got dispatched
+    return Total;
+
+}// OrionCommLoopDispatch
+
+int OrionCommLoopDispatchReady(OrionCommLoop_t *pLoop)
+{
+    OrionCommContext_t *pReady[ORION_COMM_LOOP_MAX_CONTEXTS];
+    int i, Count = 0, Total = 0;
+
+    // Take a list first, since handlers can add and remove connections, which moves them around
+    for (i = 0; i < pLoop->NumContexts; i++)
+    {
+        if (pLoop->Ready[i])
+            pReady[Count++] = pLoop->pContexts[i];
+    }
+
+    // Give each one another turn, and if it still isn't done it'll be marked ready again
+    for (i = 0; i < Count; i++)
+        Total += OrionCommLoopDispatch(pLoop, pReady[i]);
+
+    return Total;
+
+}// OrionCommLoopDispatchReady
@@ -3,6 +3,7 @@
 
 #ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
+#include <winsock2.h>
 #include <windows.h>
 #define usleep(x) Sleep(x/1000)
 #else
@@ -15,23 +16,352 @@
 #define UDP_IN_PORT         8746
 #define TCP_PORT            8747
 
+// Size of the receive ring buffer in bytes - this must be a power of two
+#define ORION_COMM_RX_BUFFER_SIZE   4096
+
+// Number of packets split across reads that a single view receive call can hand out
+#define ORION_COMM_RX_SPILL_COUNT   4
+
+//! Receive ring buffer that gets filled by bulk reads and parsed in place
+typedef struct
+{
+    //! Raw bytes from the serial port or socket
+    UInt8 Data[ORION_COMM_RX_BUFFER_SIZE];
+
+    //! Free-running write and read indices
+    UInt32 Head;
+    UInt32 Tail;
+
+    //! Read index of the oldest byte that packet views may still point to
+    UInt32 Hold;
+
+    //! Holds packets that are split across reads or the end of the ring
+    OrionPkt_t Pkt;
+
+    //! Completed split packets that packet views point to, since Pkt gets reused
+    OrionPkt_t Spill[ORION_COMM_RX_SPILL_COUNT];
+    int NumSpill;
+
+} OrionCommRxBuffer_t;
+
+// Size of the send queue in bytes
+#define ORION_COMM_TX_BUFFER_SIZE   2048
+
+//! Send queue that packets are stacked up in until they're flushed with a single write
+typedef struct
+{
+    //! Queued packet bytes, oldest first
+    UInt8 Data[ORION_COMM_TX_BUFFER_SIZE];
+
+    //! Number of queued bytes
+    UInt32 Size;
+
+} OrionCommTxBuffer_t;
+
+// Number of buckets in a link statistics histogram
+#define ORION_COMM_HISTOGRAM_SIZE   32
+
+//! Histogram with power of two buckets: bucket 0 counts zeros, and bucket n counts values from 2^(n-1) to 2^n - 1,
+//! except for the last bucket, which also counts everything bigger
+typedef struct
+{
+    UInt32 Count[ORION_COMM_HISTOGRAM_SIZE];
+
+} OrionCommHistogram_t;
+
+//! Link statistics for a connection, which can be compared against the gimbal's own NetworkDiagnostics and
+//! OrionPerformance packets. All counters wrap around, so take differences between snapshots.
+typedef struct
+{
+    //! Bytes read from and written to the link
+    UInt32 BytesRx;
+    UInt32 BytesTx;
+
+    //! Valid packets received and packets sent, and the bytes in the valid packets that were received
+    UInt32 PacketsRx;
+    UInt32 PacketsTx;
+    UInt32 PacketBytesRx;
+
+    //! Packets that were never sent because the send queue had no room for them
+    UInt32 TxDropped;
+
+    //! Valid packets received with each ID
+    UInt32 PacketsPerId[256];
+
+    //! Packets that had a good header but a bad checksum
+    UInt32 ChecksumErrors;
+
+    //! Bytes that were thrown away while looking for a packet, less any still waiting to be parsed
+    UInt32 ResyncBytes;
+
+    //! Microseconds between received packets, and the smoothed variation between successive gaps (RFC 3550)
+    OrionCommHistogram_t InterArrival;
+    UInt32 Jitter;
+
+    //! Microseconds from sending a packet to getting its response, for transfers that report them
+    OrionCommHistogram_t Latency;
+
+    //! Time of the last received packet in microseconds, and the gap before it
+    UInt64 LastRxTime;
+    UInt32 LastGap;
+
+} OrionCommStats_t;
+
+// Number of gimbal clock windows the clock offset estimator keeps the fastest sample of, and the length of each
+#define ORION_COMM_CLOCK_WINDOWS    16
+#define ORION_COMM_CLOCK_WINDOW_MS  2000
+
+//! Estimate of the offset and drift between the host's monotonic clock and the gimbal's systemTime clock, made
+//! from the host receive time and gimbal systemTime of every GeolocateTelemetryCore packet. Each received packet
+//! gives an offset that is the true offset plus however long the packet took to arrive, so the estimator takes
+//! the fastest packet in each window of gimbal time and fits a line through them. The constant part of the link
+//! delay can't be told apart from the offset without a round trip, so converted times are as if packets took
+//! the fastest path the estimator has seen, and delays are measured relative to that.
+typedef struct
+{
+    //! Gimbal time in microseconds and host minus gimbal time offset of the fastest sample in each window
+    SInt64 WindowTime[ORION_COMM_CLOCK_WINDOWS];
+    SInt64 WindowOffset[ORION_COMM_CLOCK_WINDOWS];
+
+    //! Index of the window being filled, the number of windows with a sample, and the current window's end time
+    int Window;
+    int NumWindows;
+    SInt64 WindowEnd;
+
+    //! Last gimbal systemTime, and the same time in microseconds unwrapped to 64 bits
+    UInt32 LastSystemTime;
+    SInt64 GimbalTime;
+
+    //! Host minus gimbal time at gimbal time RefTime, and the host clock's drift in microseconds per microsecond
+    SInt64 RefTime;
+    double Offset;
+    double Drift;
+
+    //! GPS time minus gimbal time in microseconds, from the last packet with a GPS fix
+    SInt64 GpsOffset;
+    BOOL GpsValid;
+
+    //! How much longer than the fastest path each packet took to arrive, in microseconds
+    OrionCommHistogram_t Delay;
+    UInt32 LastDelay;
+
+    //! Number of samples that went into the estimate
+    UInt32 Samples;
+
+} OrionCommClock_t;
+
+//! State for a single connection to a gimbal
+typedef struct
+{
+#ifdef _WIN32
+    //! Serial port and TCP socket handles, only one of which will be valid
+    HANDLE SerialHandle;
+    SOCKET TcpSocket;
+#else
+    //! Serial port or TCP socket file descriptor
+    int Handle;
+#endif // _WIN32
+
+    //! IPv4 address of the gimbal in host byte order, or zero for serial connections
+    UInt32 Address;
+
+    //! Receive buffer and packet parser state
+    OrionCommRxBuffer_t Rx;
+
+    //! Packets waiting to be sent
+    OrionCommTxBuffer_t Tx;
+
+    //! Capture file that sent and received packets get recorded to, or NULL
+    struct OrionCommCaptureWriter *pCapture;
+    UInt8 CaptureLink;
+
+    //! Multicast publisher that received packets get relayed to, or NULL
+    struct OrionCommPublisher *pRelay;
+
+    //! Shared memory store that received packets get written to, or NULL
+    struct OrionCommShared *pShared;
+
+    //! Link statistics, which only the thread using the connection should write to
+    OrionCommStats_t Stats;
+
+    //! Host and gimbal clock offset estimate, fed from the same receive path
+    OrionCommClock_t Clock;
+
+#ifdef _WIN32
+    //! Zero-byte read request, or serial port receive event wait, used to wake an event loop when data arrives
+    OVERLAPPED RxOverlapped;
+    DWORD CommEvent;
+    BOOL RxPending;
+
+    //! Event that serial reads and writes wait on, since the port is opened for overlapped I/O
+    HANDLE SerialEvent;
+#endif // _WIN32
+
+} OrionCommContext_t;
+
+// Static initializer for a closed connection context in C, which only names the handles so that
+//   everything else starts at zero without leaving fields out. C++ has no designated initializers
+//   before C++20, so it uses OrionCommInitEx() instead.
+#ifndef __cplusplus
+#ifdef _WIN32
+#define ORION_COMM_CONTEXT_INIT { .SerialHandle = INVALID_HANDLE_VALUE, .TcpSocket = INVALID_SOCKET }
+#else
+#define ORION_COMM_CONTEXT_INIT { .Handle = -1 }
+#endif // _WIN32
+#endif // __cplusplus
+
+// Baud rate that serial ports are opened at unless the caller asks for something else
+#define ORION_COMM_SERIAL_BAUD 115200
+
+// Maximum number of connections that a single event loop can watch
+#define ORION_COMM_LOOP_MAX_CONTEXTS 64
+
+// How often discovery re-sends its broadcast ping while waiting for replies, in milliseconds
+#define ORION_COMM_DISCOVER_PING_MS 250
+
+//! A gimbal that answered a network discovery broadcast
+typedef struct
+{
+    UInt32 Address;              //!< IPv4 address in host byte order
+    OrionCrownVersion_t Version; //!< Crown board version from the discovery reply
+    BOOL VersionValid;           //!< TRUE if the reply decoded as a crown version packet
+} OrionCommGimbal_t;
+
+//! Callback for packets dispatched by an event loop. The packet points into the connection's
+//! receive buffer, so only its header and payload are valid, and only until the callback returns. The
+//! host time it was received at is in pContext->Stats.LastRxTime
+typedef void (*OrionCommHandler_t)(OrionCommContext_t *pContext, const OrionPkt_t *pPkt, void *pUser);
+
+//! Event loop that waits on many connections and dispatches their packets by ID
+typedef struct
+{
+    //! Callbacks and user pointers indexed by packet ID
+    OrionCommHandler_t pHandlers[256];
+    void *pUsers[256];
+
+    //! Catch-all callback for packet IDs with no handler of their own
+    OrionCommHandler_t pDefaultHandler;
+    void *pDefaultUser;
+
+    //! Connections being watched by this loop
+    OrionCommContext_t *pContexts[ORION_COMM_LOOP_MAX_CONTEXTS];
+    int NumContexts;
+
+    //! Set for each connection that used up its turn with packets still waiting, so the next pass gets
+    //!   back to it without waiting on the kernel, which may have nothing new to say about it
+    BOOL Ready[ORION_COMM_LOOP_MAX_CONTEXTS];
+
+#ifdef _WIN32
+    //! I/O completion port that socket reads and serial port receive events get queued up on
+    HANDLE Port;
+#else
+    //! epoll (Linux) or kqueue (macOS) descriptor
+    int Poll;
+#endif // _WIN32
+
+} OrionCommLoop_t;
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
-// Macro to maintain backwards compatibility
+// Macros to maintain backwards compatibility
 #define OrionCommOpenNetwork(void) OrionCommOpenNetworkIp("255.255.255.255")
+#define OrionCommOpenNetworkEx(pContext) OrionCommOpenNetworkIpEx(pContext, "255.255.255.255")
 
+// These functions all operate on a single default connection
 BOOL OrionCommOpen(int *pArgc, char ***pArgv);
 BOOL OrionCommOpenSerial(const char *pPath);
+BOOL OrionCommOpenSerialBaud(const char *pPath, UInt32 Baud);
 BOOL OrionCommOpenNetworkIp(const char *pAddress);
 BOOL OrionCommIpStringValid(const char *pAddress);
 BOOL OrionCommSerialPathValid(const char *pPath);
 void OrionCommClose(void);
 BOOL OrionCommSend(const OrionPkt_t *pPkt);
+BOOL OrionCommQueue(const OrionPkt_t *pPkt);
+BOOL OrionCommFlush(void);
+BOOL OrionCommSetNoDelay(BOOL NoDelay);
 BOOL OrionCommReceive(OrionPkt_t *pPkt);
+int OrionCommReceiveBatch(OrionPkt_t *pPkts, int Max);
 BOOL OrionCommIsOpen(void);
+void OrionCommRecord(struct OrionCommCaptureWriter *pWriter, UInt8 Link);
+void OrionCommRelay(struct OrionCommPublisher *pPublisher);
+void OrionCommShare(struct OrionCommShared *pShared);
+OrionCommContext_t *OrionCommGetDefaultContext(void);
+void OrionCommGetStats(OrionCommStats_t *pStats);
+
+// Connection functions for talking to more than one gimbal. A context has to start out closed, from
+//   ORION_COMM_CONTEXT_INIT or OrionCommInitEx(), since opening or connecting it closes whatever it
+//   already has open first.
+void OrionCommInitEx(OrionCommContext_t *pContext);
+BOOL OrionCommOpenEx(OrionCommContext_t *pContext, int *pArgc, char ***pArgv);
+BOOL OrionCommOpenSerialEx(OrionCommContext_t *pContext, const char *pPath);
+BOOL OrionCommOpenSerialBaudEx(OrionCommContext_t *pContext, const char *pPath, UInt32 Baud);
+BOOL OrionCommOpenNetworkIpEx(OrionCommContext_t *pContext, const char *pAddress);
+void OrionCommCloseEx(OrionCommContext_t *pContext);
+BOOL OrionCommSendEx(OrionCommContext_t *pContext, const OrionPkt_t *pPkt);
+BOOL OrionCommQueueEx(OrionCommContext_t *pContext, const OrionPkt_t *pPkt);
+BOOL OrionCommFlushEx(OrionCommContext_t *pContext);
+BOOL OrionCommSetNoDelayEx(OrionCommContext_t *pContext, BOOL NoDelay);
+BOOL OrionCommReceiveEx(OrionCommContext_t *pContext, OrionPkt_t *pPkt);
+int OrionCommReceiveBatchEx(OrionCommContext_t *pContext, OrionPkt_t *pPkts, int Max);
+int OrionCommReceiveViewsEx(OrionCommContext_t *pContext, OrionPktView_t *pViews, int Max);
+BOOL OrionCommIsOpenEx(const OrionCommContext_t *pContext);
+void OrionCommRecordEx(OrionCommContext_t *pContext, struct OrionCommCaptureWriter *pWriter, UInt8 Link);
+void OrionCommRelayEx(OrionCommContext_t *pContext, struct OrionCommPublisher *pPublisher);
+void OrionCommShareEx(OrionCommContext_t *pContext, struct OrionCommShared *pShared);
+void OrionCommGetStatsEx(const OrionCommContext_t *pContext, OrionCommStats_t *pStats);
+
+// Link statistics helpers, for code that measures its own latencies or reads the histograms
+UInt64 OrionCommStatsTime(void);
+void OrionCommStatsLatency(OrionCommStats_t *pStats, UInt32 Microseconds);
+void OrionCommHistogramAdd(OrionCommHistogram_t *pHistogram, UInt32 Value, UInt32 Count);
+UInt32 OrionCommHistogramPercentile(const OrionCommHistogram_t *pHistogram, float Fraction);
+
+// Host and gimbal clock relationship
+void OrionCommClockReset(OrionCommClock_t *pClock);
+BOOL OrionCommClockAddSample(OrionCommClock_t *pClock, UInt32 SystemTime, UInt64 HostTime);
+BOOL OrionCommClockAddPacket(OrionCommClock_t *pClock, const OrionPkt_t *pPkt, UInt64 HostTime);
+BOOL OrionCommClockValid(const OrionCommClock_t *pClock);
+UInt64 OrionCommClockGimbalToHost(const OrionCommClock_t *pClock, UInt32 SystemTime);
+UInt32 OrionCommClockHostToGimbal(const OrionCommClock_t *pClock, UInt64 HostTime);
+BOOL OrionCommClockGimbalToGps(const OrionCommClock_t *pClock, UInt32 SystemTime, UInt64 *pGpsTime);
+BOOL OrionCommClockHostToGps(const OrionCommClock_t *pClock, UInt64 HostTime, UInt64 *pGpsTime);
+
+// Network discovery: find every gimbal that answers within Timeout ms, then connect to all of them at once
+int OrionCommDiscover(const char *pAddress, int Timeout, OrionCommGimbal_t *pGimbals, int Max);
+int OrionCommConnectAll(OrionCommContext_t *pContexts, const OrionCommGimbal_t *pGimbals, int Count, int Timeout);
+
+// Event loop functions for serving many connections from one thread
+BOOL OrionCommLoopInit(OrionCommLoop_t *pLoop);
+void OrionCommLoopFree(OrionCommLoop_t *pLoop);
+BOOL OrionCommLoopAdd(OrionCommLoop_t *pLoop, OrionCommContext_t *pContext);
+BOOL OrionCommLoopRemove(OrionCommLoop_t *pLoop, OrionCommContext_t *pContext);
+void OrionCommLoopSetHandler(OrionCommLoop_t *pLoop, UInt8 ID, OrionCommHandler_t pHandler, void *pUser);
+void OrionCommLoopSetDefaultHandler(OrionCommLoop_t *pLoop, OrionCommHandler_t pHandler, void *pUser);
+int OrionCommLoopRun(OrionCommLoop_t *pLoop, int Timeout);
+void OrionCommLoopDeliver(OrionCommLoop_t *pLoop, OrionCommContext_t *pContext, const OrionPkt_t *pPkt);
+
+// Receive ring buffer helpers, shared by the platform-specific comm code
+void OrionCommRxReset(OrionCommRxBuffer_t *pRx);
+int OrionCommRxGetFree(OrionCommRxBuffer_t *pRx, UInt8 *pData[2], UInt32 Size[2]);
+void OrionCommRxCommit(OrionCommRxBuffer_t *pRx, UInt32 Bytes);
+int OrionCommRxParse(OrionCommRxBuffer_t *pRx, OrionPkt_t *pPkts, int Max);
+int OrionCommRxParseViews(OrionCommRxBuffer_t *pRx, OrionPktView_t *pViews, int Max);
+void OrionCommRxRelease(OrionCommRxBuffer_t *pRx);
+int OrionCommRxFill(OrionCommContext_t *pContext);
+
+// Send queue helpers, shared by the platform-specific comm code
+BOOL OrionCommTxAppend(OrionCommTxBuffer_t *pTx, const UInt8 *pData, UInt32 Size);
+BOOL OrionCommTxWritten(OrionCommTxBuffer_t *pTx, const OrionPkt_t *pPkt, UInt32 Bytes);
+BOOL OrionCommTxWrite(OrionCommContext_t *pContext, const OrionPkt_t *pPkt);
+
+// Event loop helpers, shared by the platform-specific comm code
+BOOL OrionCommLoopWatch(OrionCommLoop_t *pLoop, OrionCommContext_t *pContext);
+void OrionCommLoopUnwatch(OrionCommLoop_t *pLoop, OrionCommContext_t *pContext);
+int OrionCommLoopDispatch(OrionCommLoop_t *pLoop, OrionCommContext_t *pContext);
+int OrionCommLoopDispatchReady(OrionCommLoop_t *pLoop);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,289 @@
+#ifndef ORIONCOMM_HPP
+#define ORIONCOMM_HPP
+
+#include "OrionComm.h"
+#include "OrionPublicTraits.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+// Header-only C++17 layer over OrionComm. Encoding and decoding are templated on the packet structure,
+//   using the traits that GenerateOrionCpp.sh writes into OrionPublicTraits.hpp from the protocol, so a
+//   packet's ID and length limits are compile time constants and the generated codec for each structure
+//   is called directly, without the function pointers that OrionPublicDispatch and
+//   OrionCommSharedDecode() need. Connections own their context and close it when they go out of scope,
+//   and can be moved but not copied, e.g.:
+//
+//     orion::Connection Gimbal = orion::Connection::open(argc, argv);
+//
+//     for (const orion::PacketView &View : Gimbal.receive())
+//     {
+//         if (auto Geo = orion::decode<GeolocateTelemetryCore_t>(View))
+//             printf("%f\n", Geo->posLat);
+//     }
+
+// std::span is C++20, so C++17 builds get a minimal stand in with the same interface
+#if defined(_MSVC_LANG) && (_MSVC_LANG > __cplusplus)
+#define ORION_CPP_VERSION _MSVC_LANG
+#else
+#define ORION_CPP_VERSION __cplusplus
+#endif
+
+#if (ORION_CPP_VERSION >= 202002L) && __has_include(<span>)
+#include <span>
+#endif
+
+// Number of packets one call to Connection::receive() can return
+#ifndef ORION_CPP_RECEIVE_MAX
+#define ORION_CPP_RECEIVE_MAX 64
+#endif
+
+namespace orion
+{
+
+typedef OrionPkt_t Packet;
+typedef OrionPktView_t PacketView;
+
+#ifdef __cpp_lib_span
+template <typename T> using Span = std::span<T>;
+#else
+//! Non-owning view of a contiguous array, the subset of std::span that this API needs
+template <typename T> class Span
+{
+public:
+    constexpr Span() noexcept : pData(nullptr), Count(0) {}
+    constexpr Span(T *pFirst, std::size_t Size) noexcept : pData(pFirst), Count(Size) {}
+    template <std::size_t N> constexpr Span(T (&Array)[N]) noexcept : pData(Array), Count(N) {}
+
+    constexpr T *data() const noexcept { return pData; }
+    constexpr std::size_t size() const noexcept { return Count; }
+    constexpr bool empty() const noexcept { return Count == 0; }
+    constexpr T *begin() const noexcept { return pData; }
+    constexpr T *end() const noexcept { return pData + Count; }
+    constexpr T &operator[](std::size_t Index) const noexcept { return pData[Index]; }
+    constexpr Span first(std::size_t Size) const noexcept { return Span(pData, Size); }
+    constexpr Span subspan(std::size_t Offset) const noexcept { return Span(pData + Offset, Count - Offset); }
+
+private:
+    T *pData;
+    std::size_t Count;
+};
+#endif // __cpp_lib_span
+
+//! True for structures that have an entry in OrionPublicTraits.hpp
+template <typename T, typename = void> struct IsPacket : std::false_type {};
+template <typename T> struct IsPacket<T, std::void_t<decltype(PacketTraits<T>::ID)>> : std::true_type {};
+template <typename T> inline constexpr bool IsPacketV = IsPacket<T>::value;
+
+namespace detail
+{
+    // Header and payload of whatever kind of packet we've been given
+    inline const Packet *get(const Packet &Pkt) noexcept { return &Pkt; }
+    inline const Packet *get(const PacketView &View) noexcept { return View.pPkt; }
+
+    // Compile time constants on one side, so this is a couple of compares rather than a call
+    template <typename T, typename P> constexpr bool accepts(const P &Pkt) noexcept
+    {
+        typedef PacketTraits<T> Traits;
+        return (Pkt.ID == Traits::ID) && (Pkt.Length >= Traits::MinLength) && (Pkt.Length <= Traits::MaxLength);
+    }
+
+}// namespace detail
+
+//! Decode a packet or packet view into a structure, returning false if it's the wrong ID or length
+template <typename T, typename P> bool decode(const P &Pkt, T &User)
+{
+    static_assert(IsPacketV<T>, "decode() needs a packet structure from OrionPublicPacket.h");
+
+    // Reject anything we can without touching the payload, then call the generated decoder for this structure
+    return detail::accepts<T>(Pkt) && PacketTraits<T>::decode(detail::get(Pkt), &User);
+
+}// decode
+
+//! Decode a packet or packet view into a new structure, which is empty if it's the wrong ID or length
+template <typename T, typename P> std::optional<T> decode(const P &Pkt)
+{
+    T User{};
+
+    if (decode(Pkt, User))
+        return User;
+    else
+        return std::nullopt;
+
+}// decode
+
+//! Encode a structure into an existing packet
+template <typename T> void encode(Packet &Pkt, const T &User)
+{
+    static_assert(IsPacketV<T>, "encode() needs a packet structure from OrionPublicPacket.h");
+    static_assert(PacketTraits<T>::CanEncode, "this packet structure doesn't have an encoder");
+
+    // Straight to the generated encoder for this structure
+    if constexpr (PacketTraits<T>::CanEncode)
+        PacketTraits<T>::encode(&Pkt, &User);
+
+}// encode
+
+//! Encode a structure into a new packet
+template <typename T> Packet encode(const T &User)
+{
+    Packet Pkt;
+
+    encode(Pkt, User);
+    return Pkt;
+
+}// encode
+
+namespace detail
+{
+    // One step of visit(), which returns true if the packet had this structure's ID, whether or not it decoded
+    template <typename T, typename P, typename F> bool visitOne(const P &Pkt, F &Func, bool &Decoded)
+    {
+        if (Pkt.ID != PacketTraits<T>::ID)
+            return false;
+
+        T User{};
+
+        if ((Decoded = decode(Pkt, User)) == true)
+            Func(static_cast<const T &>(User));
+
+        return true;
+
+    }// visitOne
+
+}// namespace detail
+
+//! Decode a packet as whichever of the listed structures has its ID and pass it to Func, which has to
+//!   accept all of them (e.g. a generic lambda or an overload set). Returns true if Func got called.
+template <typename... Ts, typename P, typename F> bool visit(const P &Pkt, F &&Func)
+{
+    bool Decoded = false;
+
+    // The IDs are constants, so this unrolls into a chain of compares that stops at the first match
+    (void)(detail::visitOne<Ts>(Pkt, Func, Decoded) || ...);
+    return Decoded;
+
+}// visit
+
+//! A connection to one gimbal, which owns its context and closes it when destroyed
+class Connection
+{
+public:
+    Connection() = default;
+    ~Connection() { close(); }
+
+    // Connections can be moved around, but there's only ever one owner of the socket or port
+    Connection(const Connection &) = delete;
+    Connection &operator=(const Connection &) = delete;
+    Connection(Connection &&Other) noexcept = default;
+    Connection &operator=(Connection &&Other) noexcept
+    {
+        if (this != &Other)
+        {
+            close();
+            pState = std::move(Other.pState);
+        }
+
+        return *this;
+    }
+
+    //! Open a serial port, check isOpen() to see if it worked
+    static Connection openSerial(const char *pPath)
+    {
+        Connection Conn(true);
+
+        OrionCommOpenSerialEx(&Conn.pState->Context, pPath);
+        return Conn;
+    }
+
+    //! Connect to a gimbal over the network, with NULL to find one with a broadcast
+    static Connection openNetwork(const char *pAddress = nullptr)
+    {
+        Connection Conn(true);
+
+        OrionCommOpenNetworkIpEx(&Conn.pState->Context, pAddress);
+        return Conn;
+    }
+
+    //! Open whatever the command line asks for, in the same way as OrionCommOpen()
+    static Connection open(int &Argc, char **&Argv)
+    {
+        Connection Conn(true);
+
+        OrionCommOpenEx(&Conn.pState->Context, &Argc, &Argv);
+        return Conn;
+    }
+
+    bool isOpen() const { return pState && OrionCommIsOpenEx(&pState->Context); }
+    explicit operator bool() const { return isOpen(); }
+
+    //! Close the connection, which can't be reopened
+    void close()
+    {
+        if (pState)
+            OrionCommCloseEx(&pState->Context);
+    }
+
+    //! Send a packet now, or queue it up to go out with the next flush()
+    bool send(const Packet &Pkt) { return isOpen() && OrionCommSendEx(&pState->Context, &Pkt); }
+    bool queue(const Packet &Pkt) { return isOpen() && OrionCommQueueEx(&pState->Context, &Pkt); }
+    bool flush() { return isOpen() && OrionCommFlushEx(&pState->Context); }
+
+    //! Encode a structure and send or queue it
+    template <typename T> bool send(const T &User) { return send(encode(User)); }
+    template <typename T> bool queue(const T &User) { return queue(encode(User)); }
+
+    //! Turn off coalescing of small writes on network connections
+    bool setNoDelay(bool NoDelay) { return isOpen() && OrionCommSetNoDelayEx(&pState->Context, NoDelay ? TRUE : FALSE); }
+
+    //! Receive every packet that's waiting, without copying them. The views point into the receive buffer
+    //!   and are only valid until the next call to receive().
+    Span<const PacketView> receive()
+    {
+        int Count = isOpen() ? OrionCommReceiveViewsEx(&pState->Context, pState->Views, ORION_CPP_RECEIVE_MAX) : 0;
+
+        return Span<const PacketView>(pState ? pState->Views : nullptr, (Count > 0) ? (std::size_t)Count : 0);
+    }
+
+    //! Receive one packet into a buffer of our own
+    bool receive(Packet &Pkt) { return isOpen() && OrionCommReceiveEx(&pState->Context, &Pkt); }
+
+    //! Link statistics and clock estimate for this connection
+    OrionCommStats_t stats() const
+    {
+        OrionCommStats_t Stats{};
+
+        if (pState)
+            OrionCommGetStatsEx(&pState->Context, &Stats);
+
+        return Stats;
+    }
+
+    const OrionCommClock_t *clock() const { return pState ? &pState->Context.Clock : nullptr; }
+
+    //! The underlying context, for the C API (event loops, recording, relaying, etc.). It stays at the
+    //!   same address when the connection is moved.
+    OrionCommContext_t *context() { return pState ? &pState->Context : nullptr; }
+    const OrionCommContext_t *context() const { return pState ? &pState->Context : nullptr; }
+
+private:
+    // Everything lives on the heap, so moving a connection is just moving a pointer
+    struct State
+    {
+        State() { OrionCommInitEx(&Context); }
+
+        OrionCommContext_t Context;
+        PacketView Views[ORION_CPP_RECEIVE_MAX];
+    };
+
+    explicit Connection(bool) : pState(new State) {}
+
+    std::unique_ptr<State> pState;
+};
+
+} // namespace orion
+
+#endif // ORIONCOMM_HPP
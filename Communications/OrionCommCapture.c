@@ -0,0 +1,551 @@
+#include "OrionCommCapture.h"
+#include "fieldencode.h"
+#include "fielddecode.h"
+#include "Atomics.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#endif // _WIN32
+
+static BOOL WriteIndex(OrionCommCaptureWriter_t *pWriter, UInt64 Time);
+static BOOL IsIndexRecord(const OrionCommCaptureReader_t *pReader, UInt64 Offset);
+static UInt64 GetIndexField(const OrionCommCaptureReader_t *pReader, UInt64 Offset, int Field);
+static void BuildIndex(OrionCommCaptureReader_t *pReader);
+static BOOL ReadReceived(OrionCommCaptureReader_t *pReader, OrionCommCaptureRecord_t *pRecord);
+static void StampReplayed(OrionCommContext_t *pContext, const OrionCommCaptureRecord_t *pRecord);
+static void SleepUs(UInt64 Us);
+
+// Capture files start with these four bytes
+static const UInt8 Magic[4] = { 'O', 'C', 'A', 'P' };
+
+UInt64 OrionCommCaptureTime(void)
+{
+#ifdef _WIN32
+    FILETIME FileTime;
+    UInt64 Time;
+
+    // File times count 100 ns ticks since 1601, so scale and shift them to the Unix epoch
+    GetSystemTimeAsFileTime(&FileTime);
+    Time = ((UInt64)FileTime.dwHighDateTime << 32) | FileTime.dwLowDateTime;
+    return Time / 10 - 11644473600000000ULL;
+#else
+    struct timeval Now;
+
+    // Microsecond resolution is plenty for packets that take at least that long to arrive
+    gettimeofday(&Now, NULL);
+    return (UInt64)Now.tv_sec * 1000000 + Now.tv_usec;
+#endif // _WIN32
+
+}// OrionCommCaptureTime
+
+BOOL OrionCommCaptureCreate(OrionCommCaptureWriter_t *pWriter, const char *pPath, UInt16 Interval)
+{
+    UInt8 Header[ORION_COMM_CAPTURE_HEADER_SIZE];
+    UInt64 Time = OrionCommCaptureTime();
+    int Index = 0;
+
+    // Start off with an empty capture
+    memset(pWriter, 0, sizeof(*pWriter));
+    pWriter->Interval = (Interval > 0) ? Interval : ORION_COMM_CAPTURE_INTERVAL;
+
+    // Records are small, so give the file a big buffer to keep the number of writes down
+    if ((pWriter->pFile = fopen(pPath, "wb")) == NULL)
+        return FALSE;
+
+    setvbuf(pWriter->pFile, NULL, _IOFBF, 65536);
+
+    // Build and write the file header
+    memcpy(Header, Magic, sizeof(Magic));
+    Index += sizeof(Magic);
+    uint16ToLeBytes(ORION_COMM_CAPTURE_VERSION, Header, &Index);
+    uint16ToLeBytes(pWriter->Interval, Header, &Index);
+    uint64ToLeBytes(Time, Header, &Index);
+
+    if (fwrite(Header, 1, Index, pWriter->pFile) != (size_t)Index)
+    {
+        OrionCommCaptureFinish(pWriter);
+        return FALSE;
+    }
+
+    // The first index record anchors the time of everything that follows
+    pWriter->Offset = Index;
+    return WriteIndex(pWriter, Time);
+
+}// OrionCommCaptureCreate
+
+BOOL OrionCommCaptureWrite(OrionCommCaptureWriter_t *pWriter, UInt8 Type, UInt8 Link, const OrionPkt_t *pPkt, UInt64 Time)
+{
+    UInt8 Header[ORION_COMM_CAPTURE_RECORD_SIZE];
+    UInt32 Size = pPkt->Length + ORION_PKT_OVERHEAD;
+    int Index = 0;
+
+    // Nowhere to write to
+    if (pWriter->pFile == NULL)
+        return FALSE;
+
+    // Time deltas are unsigned, so don't let the clock run backwards
+    if (Time < pWriter->Time)
+        Time = pWriter->Time;
+
+    // Drop in an index record if one is due, or if the time delta won't fit in the record header
+    if ((pWriter->SinceIndex >= pWriter->Interval) || (Time - pWriter->Time > 0xFFFFFFFFULL))
+    {
+        if (!WriteIndex(pWriter, Time))
+            return FALSE;
+    }
+
+    // Build the record header
+    Header[Index++] = Type;
+    Header[Index++] = Link;
+    uint16ToLeBytes((UInt16)Size, Header, &Index);
+    uint32ToLeBytes((UInt32)(Time - pWriter->Time), Header, &Index);
+
+    // Then write it out along with the raw frame
+    if ((fwrite(Header, 1, Index, pWriter->pFile) != (size_t)Index) || (fwrite(pPkt, 1, Size, pWriter->pFile) != Size))
+        return FALSE;
+
+    // Keep track of where we are
+    pWriter->Offset += Index + Size;
+    pWriter->Time = Time;
+    pWriter->Count++;
+    pWriter->SinceIndex++;
+    return TRUE;
+
+}// OrionCommCaptureWrite
+
+void OrionCommCaptureFinish(OrionCommCaptureWriter_t *pWriter)
+{
+    if (pWriter->pFile != NULL)
+    {
+        // Finish off with an index record so readers can find the index chain from the end of the file
+        WriteIndex(pWriter, pWriter->Time);
+        fclose(pWriter->pFile);
+    }
+
+    pWriter->pFile = NULL;
+
+}// OrionCommCaptureFinish
+
+BOOL OrionCommCaptureOpen(OrionCommCaptureReader_t *pReader, const char *pPath)
+{
+    int Index = sizeof(Magic);
+#ifdef _WIN32
+    LARGE_INTEGER Size;
+#else
+    struct stat Stat;
+    int Handle;
+#endif // _WIN32
+
+    // Start off with nothing mapped
+    memset(pReader, 0, sizeof(*pReader));
+
+#ifdef _WIN32
+    // Open the file and map the whole thing read-only
+    pReader->File = CreateFileA(pPath, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    pReader->Mapping = NULL;
+
+    if ((pReader->File == INVALID_HANDLE_VALUE) || !GetFileSizeEx(pReader->File, &Size) || (Size.QuadPart < ORION_COMM_CAPTURE_HEADER_SIZE))
+    {
+        OrionCommCaptureClose(pReader);
+        return FALSE;
+    }
+
+    pReader->Size = (UInt64)Size.QuadPart;
+    pReader->Mapping = CreateFileMappingA(pReader->File, NULL, PAGE_READONLY, 0, 0, NULL);
+
+    if (pReader->Mapping != NULL)
+        pReader->pData = (const UInt8 *)MapViewOfFile(pReader->Mapping, FILE_MAP_READ, 0, 0, 0);
+#else
+    // Open the file and map the whole thing read-only
+    if ((Handle = open(pPath, O_RDONLY)) < 0)
+        return FALSE;
+
+    if ((fstat(Handle, &Stat) == 0) && (Stat.st_size >= ORION_COMM_CAPTURE_HEADER_SIZE))
+    {
+        void *pData = mmap(NULL, (size_t)Stat.st_size, PROT_READ, MAP_SHARED, Handle, 0);
+
+        // Replay walks the file front to back, so let the kernel read ahead
+        if (pData != MAP_FAILED)
+        {
+            madvise(pData, (size_t)Stat.st_size, MADV_SEQUENTIAL);
+            pReader->pData = (const UInt8 *)pData;
+            pReader->Size = (UInt64)Stat.st_size;
+        }
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    close(Handle);
+#endif // _WIN32
+
+    // Make sure this is a capture file we know how to read
+    if ((pReader->pData == NULL) || (memcmp(pReader->pData, Magic, sizeof(Magic)) != 0) ||
+        (uint16FromLeBytes(pReader->pData, &Index) != ORION_COMM_CAPTURE_VERSION))
+    {
+        OrionCommCaptureClose(pReader);
+        return FALSE;
+    }
+
+    // Skip the interval and pick up the start time, then find all the index records
+    Index += 2;
+    pReader->Time = uint64FromLeBytes(pReader->pData, &Index);
+    pReader->Offset = ORION_COMM_CAPTURE_HEADER_SIZE;
+    BuildIndex(pReader);
+    return TRUE;
+
+}// OrionCommCaptureOpen
+
+BOOL OrionCommCaptureRead(OrionCommCaptureReader_t *pReader, OrionCommCaptureRecord_t *pRecord)
+{
+    // As long as there's at least a record header left
+    while (pReader->Offset + ORION_COMM_CAPTURE_RECORD_SIZE <= pReader->Size)
+    {
+        const UInt8 *pData = &pReader->pData[pReader->Offset];
+        UInt32 Size, Delta;
+        int Index = 2;
+
+        // Pull apart the record header
+        Size = uint16FromLeBytes(pData, &Index);
+        Delta = uint32FromLeBytes(pData, &Index);
+
+        // A record that runs off the end means the capture was cut short, e.g. by a crash
+        if (pReader->Offset + ORION_COMM_CAPTURE_RECORD_SIZE + Size > pReader->Size)
+            break;
+
+        // Move past this record
+        pReader->Offset += ORION_COMM_CAPTURE_RECORD_SIZE + Size;
+
+        // Index records carry the absolute time for everything after them
+        if (pData[0] == ORION_COMM_CAPTURE_INDEX)
+        {
+            if (Size >= ORION_COMM_CAPTURE_INDEX_SIZE)
+                pReader->Time = uint64FromLeBytes(pData, &Index);
+
+            continue;
+        }
+
+        // Everything else is timed relative to the record before it
+        pReader->Time += Delta;
+
+        // Hand back packet records whose length matches the frame inside, and skip anything else
+        if (((pData[0] == ORION_COMM_CAPTURE_RX) || (pData[0] == ORION_COMM_CAPTURE_TX)) &&
+            (Size >= ORION_PKT_OVERHEAD) && (Size == (UInt32)pData[Index + 3] + ORION_PKT_OVERHEAD))
+        {
+            pRecord->Time = pReader->Time;
+            pRecord->Type = pData[0];
+            pRecord->Link = pData[1];
+            pRecord->pPkt = (const OrionPkt_t *)&pData[Index];
+            return TRUE;
+        }
+    }
+
+    // End of the capture
+    return FALSE;
+
+}// OrionCommCaptureRead
+
+BOOL OrionCommCaptureSeek(OrionCommCaptureReader_t *pReader, UInt64 Time)
+{
+    OrionCommCaptureRecord_t Record;
+    int Low = 0, High = pReader->NumIndex - 1;
+
+    // Find the last index record at or before the requested time
+    while (Low < High)
+    {
+        int Mid = (Low + High + 1) / 2;
+
+        if (GetIndexField(pReader, pReader->pIndex[Mid], 0) <= Time)
+            Low = Mid;
+        else
+            High = Mid - 1;
+    }
+
+    // Start reading from there, or from the top if there's no index at all
+    pReader->Offset = (pReader->NumIndex > 0) ? pReader->pIndex[Low] : ORION_COMM_CAPTURE_HEADER_SIZE;
+
+    // Then step forward through at most one index interval's worth of packets
+    for (;;)
+    {
+        UInt64 Offset = pReader->Offset, Previous = pReader->Time;
+
+        // Ran off the end of the capture
+        if (!OrionCommCaptureRead(pReader, &Record))
+            return FALSE;
+
+        // Back up so this packet is the next one read
+        if (Record.Time >= Time)
+        {
+            pReader->Offset = Offset;
+            pReader->Time = Previous;
+            return TRUE;
+        }
+    }
+
+}// OrionCommCaptureSeek
+
+void OrionCommCaptureClose(OrionCommCaptureReader_t *pReader)
+{
+#ifdef _WIN32
+    // Unmap the view and close both handles
+    if (pReader->pData != NULL)
+        UnmapViewOfFile(pReader->pData);
+
+    if (pReader->Mapping != NULL)
+        CloseHandle(pReader->Mapping);
+
+    if (pReader->File != INVALID_HANDLE_VALUE)
+        CloseHandle(pReader->File);
+
+    pReader->Mapping = NULL;
+    pReader->File = INVALID_HANDLE_VALUE;
+#else
+    // Unmap the file
+    if (pReader->pData != NULL)
+        munmap((void *)pReader->pData, (size_t)pReader->Size);
+#endif // _WIN32
+
+    // Then free the index and forget everything
+    free(pReader->pIndex);
+    pReader->pIndex = NULL;
+    pReader->NumIndex = 0;
+    pReader->pData = NULL;
+    pReader->Size = 0;
+
+}// OrionCommCaptureClose
+
+UInt64 OrionCommReplay(OrionCommLoop_t *pLoop, OrionCommCaptureReader_t *pReaders, OrionCommContext_t *pContexts, int Count, double Speed)
+{
+    OrionCommCaptureRecord_t Next[ORION_COMM_LOOP_MAX_CONTEXTS];
+    BOOL Valid[ORION_COMM_LOOP_MAX_CONTEXTS];
+    OrionCommContext_t Closed = ORION_COMM_CONTEXT_INIT, *pContext;
+    UInt64 First = 0, Start = 0, Total = 0;
+    int i;
+
+    // Same limit as an event loop
+    if (Count > ORION_COMM_LOOP_MAX_CONTEXTS)
+        Count = ORION_COMM_LOOP_MAX_CONTEXTS;
+
+    // Line up the first received packet from each capture
+    for (i = 0; i < Count; i++)
+        Valid[i] = ReadReceived(&pReaders[i], &Next[i]);
+
+    for (;;)
+    {
+        int Pick = -1;
+
+        // Merge the captures by always playing whichever packet is oldest
+        for (i = 0; i < Count; i++)
+        {
+            if (Valid[i] && ((Pick < 0) || (Next[i].Time < Next[Pick].Time)))
+                Pick = i;
+        }
+
+        // Every capture has run dry
+        if (Pick < 0)
+            break;
+
+        // When pacing, hold each packet until its place on the capture's timeline, scaled by Speed
+        if (Speed > 0)
+        {
+            UInt64 Now = OrionCommCaptureTime();
+
+            if (Total == 0)
+            {
+                First = Next[Pick].Time;
+                Start = Now;
+            }
+            else
+            {
+                UInt64 Due = Start + (UInt64)((double)(Next[Pick].Time - First) / Speed);
+
+                if (Due > Now)
+                    SleepUs(Due - Now);
+            }
+        }
+
+        // Same handlers that live packets go through, with the context for this capture's link. Without
+        //   one, handlers get a closed context, so anything they send in reply just fails quietly.
+        pContext = (pContexts != NULL) ? &pContexts[Pick] : &Closed;
+        StampReplayed(pContext, &Next[Pick]);
+        OrionCommLoopDeliver(pLoop, pContext, Next[Pick].pPkt);
+        Total++;
+
+        // Then line up the next one from the same capture
+        Valid[Pick] = ReadReceived(&pReaders[Pick], &Next[Pick]);
+    }
+
+    // Tell the caller how many packets got played
+    return Total;
+
+}// OrionCommReplay
+
+// Counts a replayed packet as received on a context, at the time it was captured, the same way a live one would be
+static void StampReplayed(OrionCommContext_t *pContext, const OrionCommCaptureRecord_t *pRecord)
+{
+    OrionCommStats_t *pStats = &pContext->Stats;
+    UInt32 Bytes = pRecord->pPkt->Length + ORION_PKT_OVERHEAD;
+
+    // Handlers and anything they hand off read the arrival time from here
+    atomicStoreRelaxed64(&pStats->LastRxTime, pRecord->Time);
+
+    atomicStoreRelaxed32(&pStats->BytesRx, pStats->BytesRx + Bytes);
+    atomicStoreRelaxed32(&pStats->PacketBytesRx, pStats->PacketBytesRx + Bytes);
+    atomicStoreRelaxed32(&pStats->PacketsRx, pStats->PacketsRx + 1);
+    atomicStoreRelaxed32(&pStats->PacketsPerId[pRecord->pPkt->ID], pStats->PacketsPerId[pRecord->pPkt->ID] + 1);
+
+}// StampReplayed
+
+// Writes an index record that pins down the absolute time and links back to the last index record
+static BOOL WriteIndex(OrionCommCaptureWriter_t *pWriter, UInt64 Time)
+{
+    UInt8 Record[ORION_COMM_CAPTURE_RECORD_SIZE + ORION_COMM_CAPTURE_INDEX_SIZE];
+    int Index = 0;
+
+    // Record header, which never has a time delta since the payload carries the absolute time
+    Record[Index++] = ORION_COMM_CAPTURE_INDEX;
+    Record[Index++] = 0;
+    uint16ToLeBytes(ORION_COMM_CAPTURE_INDEX_SIZE, Record, &Index);
+    uint32ToLeBytes(0, Record, &Index);
+
+    // Absolute time, number of packets so far and where the last index record is
+    uint64ToLeBytes(Time, Record, &Index);
+    uint64ToLeBytes(pWriter->Count, Record, &Index);
+    uint64ToLeBytes(pWriter->LastIndex, Record, &Index);
+
+    if (fwrite(Record, 1, Index, pWriter->pFile) != (size_t)Index)
+        return FALSE;
+
+    // This is now the latest index record, and the time base for the next packet
+    pWriter->LastIndex = pWriter->Offset;
+    pWriter->Offset += Index;
+    pWriter->Time = Time;
+    pWriter->SinceIndex = 0;
+    return TRUE;
+
+}// WriteIndex
+
+// Returns TRUE if there's a complete index record at a given offset
+static BOOL IsIndexRecord(const OrionCommCaptureReader_t *pReader, UInt64 Offset)
+{
+    int Index = 2;
+
+    // Make sure it's in the file, then check the type and size
+    return (Offset >= ORION_COMM_CAPTURE_HEADER_SIZE) &&
+           (Offset + ORION_COMM_CAPTURE_RECORD_SIZE + ORION_COMM_CAPTURE_INDEX_SIZE <= pReader->Size) &&
+           (pReader->pData[Offset] == ORION_COMM_CAPTURE_INDEX) &&
+           (uint16FromLeBytes(&pReader->pData[Offset], &Index) == ORION_COMM_CAPTURE_INDEX_SIZE);
+
+}// IsIndexRecord
+
+// Pulls the time (0), packet count (1) or previous offset (2) out of an index record
+static UInt64 GetIndexField(const OrionCommCaptureReader_t *pReader, UInt64 Offset, int Field)
+{
+    int Index = ORION_COMM_CAPTURE_RECORD_SIZE + Field * 8;
+
+    return uint64FromLeBytes(&pReader->pData[Offset], &Index);
+
+}// GetIndexField
+
+// Fills in the list of index record offsets, from the chain at the end of the file if it's there
+static void BuildIndex(OrionCommCaptureReader_t *pReader)
+{
+    UInt64 Last, Offset;
+    int i, Count = 0, Max = 0;
+
+    // Only bother looking for the closing index record if there's room for one
+    if (pReader->Size >= ORION_COMM_CAPTURE_HEADER_SIZE + ORION_COMM_CAPTURE_RECORD_SIZE + ORION_COMM_CAPTURE_INDEX_SIZE)
+    {
+        Offset = Last = pReader->Size - ORION_COMM_CAPTURE_RECORD_SIZE - ORION_COMM_CAPTURE_INDEX_SIZE;
+
+        // Walk the chain backwards from there, which has to end at the first index record after the header
+        while (IsIndexRecord(pReader, Offset))
+        {
+            UInt64 Previous = GetIndexField(pReader, Offset, 2);
+
+            Count++;
+
+            if ((Offset == ORION_COMM_CAPTURE_HEADER_SIZE) || (Previous >= Offset))
+                break;
+
+            Offset = Previous;
+        }
+
+        // If the chain made it all the way back, fill in the list in the same order
+        if ((Count > 0) && (Offset == ORION_COMM_CAPTURE_HEADER_SIZE))
+        {
+            if ((pReader->pIndex = (UInt64 *)malloc(Count * sizeof(UInt64))) == NULL)
+                return;
+
+            for (i = Count - 1, Offset = Last; i >= 0; i--)
+            {
+                pReader->pIndex[i] = Offset;
+                Offset = GetIndexField(pReader, Offset, 2);
+            }
+
+            pReader->NumIndex = Count;
+            return;
+        }
+    }
+
+    // Otherwise the capture wasn't closed cleanly, so hop through the record headers looking for index records
+    Offset = ORION_COMM_CAPTURE_HEADER_SIZE;
+    while (Offset + ORION_COMM_CAPTURE_RECORD_SIZE <= pReader->Size)
+    {
+        int Index = 2;
+        UInt32 Size = uint16FromLeBytes(&pReader->pData[Offset], &Index);
+
+        if (IsIndexRecord(pReader, Offset))
+        {
+            // Grow the list as needed
+            if (pReader->NumIndex >= Max)
+            {
+                UInt64 *pIndex = (UInt64 *)realloc(pReader->pIndex, (Max = Max ? Max * 2 : 64) * sizeof(UInt64));
+
+                if (pIndex == NULL)
+                    return;
+
+                pReader->pIndex = pIndex;
+            }
+
+            pReader->pIndex[pReader->NumIndex++] = Offset;
+        }
+
+        Offset += ORION_COMM_CAPTURE_RECORD_SIZE + Size;
+    }
+
+}// BuildIndex
+
+// Reads the next received packet from a capture, skipping the ones that were sent
+static BOOL ReadReceived(OrionCommCaptureReader_t *pReader, OrionCommCaptureRecord_t *pRecord)
+{
+    while (OrionCommCaptureRead(pReader, pRecord))
+    {
+        if (pRecord->Type == ORION_COMM_CAPTURE_RX)
+            return TRUE;
+    }
+
+    return FALSE;
+
+}// ReadReceived
+
+// Sleeps for a number of microseconds
+static void SleepUs(UInt64 Us)
+{
+#ifdef _WIN32
+    Sleep((DWORD)(Us / 1000));
+#else
+    struct timespec Time = { (time_t)(Us / 1000000), (long)(Us % 1000000) * 1000 };
+
+    nanosleep(&Time, NULL);
+#endif // _WIN32
+
+}// SleepUs
@@ -0,0 +1,129 @@
+#ifndef ORIONCOMMCAPTURE_H
+#define ORIONCOMMCAPTURE_H
+
+#include "OrionComm.h"
+
+#include <stdio.h>
+
+// A capture file is a 16 byte header followed by records, each of which is an 8 byte record header
+//   and a payload. All multi-byte fields are little endian.
+//
+//   File header:   "OCAP", UInt16 Version, UInt16 IndexInterval, UInt64 StartTime
+//   Record header: UInt8 Type, UInt8 Link, UInt16 Size, UInt32 microseconds since the previous record
+//   Packet record: the raw Trillium frame, sync bytes through checksum
+//   Index record:  UInt64 absolute time, UInt64 packets so far, UInt64 offset of the previous index record
+//
+// Index records are written right after the header, after every IndexInterval packets, whenever the
+//   time since the last record won't fit in 32 bits, and when the capture is closed. The one at the
+//   end of the file lets readers walk the index chain backwards instead of scanning the whole file.
+
+// Capture format version written to the file header
+#define ORION_COMM_CAPTURE_VERSION  1
+
+// Default number of packets between index records
+#define ORION_COMM_CAPTURE_INTERVAL 1024
+
+// Capture record types
+#define ORION_COMM_CAPTURE_RX       1
+#define ORION_COMM_CAPTURE_TX       2
+#define ORION_COMM_CAPTURE_INDEX    3
+
+// Sizes of the file header, record header and index record payload in bytes
+#define ORION_COMM_CAPTURE_HEADER_SIZE  16
+#define ORION_COMM_CAPTURE_RECORD_SIZE  8
+#define ORION_COMM_CAPTURE_INDEX_SIZE   24
+
+//! Append-only capture file that packets get recorded into
+typedef struct OrionCommCaptureWriter
+{
+    //! Output file
+    FILE *pFile;
+
+    //! Number of packets between index records
+    UInt16 Interval;
+
+    //! Packets written since the last index record
+    UInt16 SinceIndex;
+
+    //! Total number of packets written
+    UInt64 Count;
+
+    //! Time of the last record, in microseconds since the Unix epoch
+    UInt64 Time;
+
+    //! Current file offset, and the offset of the last index record
+    UInt64 Offset;
+    UInt64 LastIndex;
+
+} OrionCommCaptureWriter_t;
+
+//! A capture file mapped into memory for reading
+typedef struct
+{
+    //! Mapped file contents
+    const UInt8 *pData;
+    UInt64 Size;
+
+    //! Offset of the next record to read, and the time of the record before it
+    UInt64 Offset;
+    UInt64 Time;
+
+    //! Offsets of every index record in the file, oldest first
+    UInt64 *pIndex;
+    int NumIndex;
+
+#ifdef _WIN32
+    //! File and mapping handles, needed to unmap the file
+    HANDLE File;
+    HANDLE Mapping;
+#endif // _WIN32
+
+} OrionCommCaptureReader_t;
+
+//! A packet read back out of a capture file
+typedef struct
+{
+    //! Time the packet was recorded, in microseconds since the Unix epoch
+    UInt64 Time;
+
+    //! ORION_COMM_CAPTURE_RX or ORION_COMM_CAPTURE_TX
+    UInt8 Type;
+
+    //! Link number that the packet was recorded with
+    UInt8 Link;
+
+    //! The packet itself, which points into the mapped file. Only its header and payload are valid.
+    const OrionPkt_t *pPkt;
+
+} OrionCommCaptureRecord_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Wall clock time in microseconds since the Unix epoch, used to timestamp records
+UInt64 OrionCommCaptureTime(void);
+
+// Writing captures
+BOOL OrionCommCaptureCreate(OrionCommCaptureWriter_t *pWriter, const char *pPath, UInt16 Interval);
+BOOL OrionCommCaptureWrite(OrionCommCaptureWriter_t *pWriter, UInt8 Type, UInt8 Link, const OrionPkt_t *pPkt, UInt64 Time);
+void OrionCommCaptureFinish(OrionCommCaptureWriter_t *pWriter);
+
+// Reading captures
+BOOL OrionCommCaptureOpen(OrionCommCaptureReader_t *pReader, const char *pPath);
+BOOL OrionCommCaptureRead(OrionCommCaptureReader_t *pReader, OrionCommCaptureRecord_t *pRecord);
+BOOL OrionCommCaptureSeek(OrionCommCaptureReader_t *pReader, UInt64 Time);
+void OrionCommCaptureClose(OrionCommCaptureReader_t *pReader);
+
+// Plays received packets from one or more captures through an event loop's handlers. Handlers get
+//   pContexts[i] for capture i, or if pContexts is NULL, a closed context that every send fails on.
+//   Either way each packet is counted in the context's receive statistics first, with LastRxTime set
+//   to the time it was captured, which is on the capture's clock of microseconds since the Unix epoch.
+UInt64 OrionCommReplay(OrionCommLoop_t *pLoop, OrionCommCaptureReader_t *pReaders, OrionCommContext_t *pContexts, int Count, double Speed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ORIONCOMMCAPTURE_H
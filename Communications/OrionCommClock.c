@@ -0,0 +1,207 @@
+#include "OrionComm.h"
+#include "fielddecode.h"
+
+#include <string.h>
+
+// Largest drift the estimate accepts between the two clocks, which is far beyond any real crystal
+#define MAX_DRIFT 0.001
+
+// Number of windows it takes before the drift is worth estimating
+#define MIN_DRIFT_WINDOWS 3
+
+static SInt64 UnwrapSystemTime(const OrionCommClock_t *pClock, UInt32 SystemTime);
+static SInt64 HostToGimbalTime(const OrionCommClock_t *pClock, UInt64 HostTime);
+static void FitWindows(OrionCommClock_t *pClock);
+
+void OrionCommClockReset(OrionCommClock_t *pClock)
+{
+    // A zeroed estimator is one that's never seen a sample
+    memset(pClock, 0, sizeof(*pClock));
+
+}// OrionCommClockReset
+
+BOOL OrionCommClockAddSample(OrionCommClock_t *pClock, UInt32 SystemTime, UInt64 HostTime)
+{
+    SInt64 Gimbal, Offset, Predicted;
+
+    if (pClock->Samples != 0)
+    {
+        // Treat the difference from the last sample as signed so the 32-bit millisecond clock can wrap
+        SInt32 Step = (SInt32)(SystemTime - pClock->LastSystemTime);
+
+        // A big step back means the gimbal rebooted, and a small one is a sample that got overtaken
+        if (Step < -ORION_COMM_CLOCK_WINDOW_MS)
+            OrionCommClockReset(pClock);
+        else if (Step < 0)
+            return FALSE;
+    }
+
+    // Unwrap the gimbal's time, and work out the offset this packet gives including its delay
+    Gimbal = (pClock->Samples != 0) ? UnwrapSystemTime(pClock, SystemTime) : (SInt64)SystemTime * 1000;
+    Offset = (SInt64)HostTime - Gimbal;
+
+    pClock->LastSystemTime = SystemTime;
+    pClock->GimbalTime = Gimbal;
+
+    // Start a new window if there aren't any yet or this sample is past the end of the current one
+    if ((pClock->Samples == 0) || (Gimbal >= pClock->WindowEnd))
+    {
+        if (pClock->Samples != 0)
+            pClock->Window = (pClock->Window + 1) % ORION_COMM_CLOCK_WINDOWS;
+
+        pClock->NumWindows = MIN(pClock->NumWindows + 1, ORION_COMM_CLOCK_WINDOWS);
+        pClock->WindowEnd = Gimbal + ORION_COMM_CLOCK_WINDOW_MS * 1000;
+        pClock->WindowTime[pClock->Window] = Gimbal;
+        pClock->WindowOffset[pClock->Window] = Offset;
+    }
+    // Otherwise only keep this sample if it's the fastest one in the window so far
+    else if (Offset < pClock->WindowOffset[pClock->Window])
+    {
+        pClock->WindowTime[pClock->Window] = Gimbal;
+        pClock->WindowOffset[pClock->Window] = Offset;
+    }
+
+    // Refit the line through the fastest samples
+    pClock->Samples++;
+    FitWindows(pClock);
+
+    // Anything above the line is time the packet spent getting here on top of the fastest path
+    Predicted = (SInt64)(pClock->Offset + pClock->Drift * (double)(Gimbal - pClock->RefTime));
+    pClock->LastDelay = (UInt32)MIN(MAX(Offset - Predicted, 0), 0xFFFFFFFF);
+    OrionCommHistogramAdd(&pClock->Delay, pClock->LastDelay, 1);
+
+    return TRUE;
+
+}// OrionCommClockAddSample
+
+BOOL OrionCommClockAddPacket(OrionCommClock_t *pClock, const OrionPkt_t *pPkt, UInt64 HostTime)
+{
+    UInt32 SystemTime, Itow;
+    UInt16 Week;
+    int Index = 0;
+
+    // Only telemetry packets carry the gimbal's clock, and the times are at the front of the payload
+    if ((pPkt->ID != getGeolocateTelemetryCorePacketID()) || (pPkt->Length < getGeolocateTelemetryCoreMinDataLength()))
+        return FALSE;
+
+    SystemTime = uint32FromBeBytes(pPkt->Data, &Index);
+    Itow = uint32FromBeBytes(pPkt->Data, &Index);
+    Week = uint16FromBeBytes(pPkt->Data, &Index);
+
+    // Add the sample, or give up if it's older than the last one
+    if (!OrionCommClockAddSample(pClock, SystemTime, HostTime))
+        return FALSE;
+
+    // A zero week means there's no GPS fix yet, otherwise note how far GPS time is from gimbal time
+    if (Week != 0)
+    {
+        pClock->GpsOffset = ((SInt64)Week * 604800000 + Itow) * 1000 - pClock->GimbalTime;
+        pClock->GpsValid = TRUE;
+    }
+
+    return TRUE;
+
+}// OrionCommClockAddPacket
+
+BOOL OrionCommClockValid(const OrionCommClock_t *pClock)
+{
+    // The estimate is only worth using once it's seen at least one whole window
+    return pClock->NumWindows >= 2;
+
+}// OrionCommClockValid
+
+UInt64 OrionCommClockGimbalToHost(const OrionCommClock_t *pClock, UInt32 SystemTime)
+{
+    SInt64 Gimbal = UnwrapSystemTime(pClock, SystemTime);
+
+    // Apply the offset, corrected for drift since the reference time
+    return (UInt64)(Gimbal + (SInt64)(pClock->Offset + pClock->Drift * (double)(Gimbal - pClock->RefTime)));
+
+}// OrionCommClockGimbalToHost
+
+UInt32 OrionCommClockHostToGimbal(const OrionCommClock_t *pClock, UInt64 HostTime)
+{
+    // Back to milliseconds, letting the result wrap the same way the gimbal's clock does
+    return (UInt32)(HostToGimbalTime(pClock, HostTime) / 1000);
+
+}// OrionCommClockHostToGimbal
+
+BOOL OrionCommClockGimbalToGps(const OrionCommClock_t *pClock, UInt32 SystemTime, UInt64 *pGpsTime)
+{
+    // Can't do anything without a GPS fix
+    if (!pClock->GpsValid)
+        return FALSE;
+
+    // GPS time in microseconds since Jan 6 1980
+    *pGpsTime = (UInt64)(UnwrapSystemTime(pClock, SystemTime) + pClock->GpsOffset);
+    return TRUE;
+
+}// OrionCommClockGimbalToGps
+
+BOOL OrionCommClockHostToGps(const OrionCommClock_t *pClock, UInt64 HostTime, UInt64 *pGpsTime)
+{
+    // Same as above, but going through gimbal time at full resolution
+    if (!pClock->GpsValid)
+        return FALSE;
+
+    *pGpsTime = (UInt64)(HostToGimbalTime(pClock, HostTime) + pClock->GpsOffset);
+    return TRUE;
+
+}// OrionCommClockHostToGps
+
+// Gimbal time in microseconds for a systemTime near the last one the estimator saw
+static SInt64 UnwrapSystemTime(const OrionCommClock_t *pClock, UInt32 SystemTime)
+{
+    return pClock->GimbalTime + (SInt64)(SInt32)(SystemTime - pClock->LastSystemTime) * 1000;
+
+}// UnwrapSystemTime
+
+// Gimbal time in microseconds for a host time, by inverting host = gimbal + offset + drift * (gimbal - reference)
+static SInt64 HostToGimbalTime(const OrionCommClock_t *pClock, UInt64 HostTime)
+{
+    double Since = (double)((SInt64)HostTime - pClock->RefTime) - pClock->Offset;
+
+    return pClock->RefTime + (SInt64)(Since / (1.0 + pClock->Drift));
+
+}// HostToGimbalTime
+
+// Fit a line to the fastest sample of each window, then lower it so that none of them are below it
+static void FitWindows(OrionCommClock_t *pClock)
+{
+    double Sx = 0, Sy = 0, Sxx = 0, Sxy = 0, X, Y, Slope = 0, Intercept, Lowest = 0;
+    SInt64 RefTime = pClock->WindowTime[pClock->Window], RefOffset = pClock->WindowOffset[pClock->Window];
+    int i, N = pClock->NumWindows;
+
+    // Sums relative to the newest window keep the doubles well away from their precision limits
+    for (i = 0; i < N; i++)
+    {
+        X = (double)(pClock->WindowTime[i] - RefTime);
+        Y = (double)(pClock->WindowOffset[i] - RefOffset);
+        Sx += X;
+        Sy += Y;
+        Sxx += X * X;
+        Sxy += X * Y;
+    }
+
+    // Least squares slope, once there are enough windows for it to mean something
+    if ((N >= MIN_DRIFT_WINDOWS) && (N * Sxx - Sx * Sx > 0))
+    {
+        Slope = (N * Sxy - Sx * Sy) / (N * Sxx - Sx * Sx);
+        Slope = MIN(MAX(Slope, -MAX_DRIFT), MAX_DRIFT);
+    }
+
+    Intercept = (Sy - Slope * Sx) / N;
+
+    // Every sample's offset includes some delay, so the line has to sit on or under all of them
+    for (i = 0; i < N; i++)
+    {
+        X = (double)(pClock->WindowTime[i] - RefTime);
+        Y = (double)(pClock->WindowOffset[i] - RefOffset);
+        Lowest = MIN(Lowest, Y - (Intercept + Slope * X));
+    }
+
+    pClock->RefTime = RefTime;
+    pClock->Offset = (double)RefOffset + Intercept + Lowest;
+    pClock->Drift = Slope;
+
+}// FitWindows
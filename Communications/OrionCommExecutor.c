@@ -0,0 +1,566 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // For pthread_setaffinity_np()
+#endif
+
+#include "OrionCommExecutor.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <sched.h>
+#include <unistd.h>
+#endif // _WIN32
+
+// Locks, sleeping and waking, and atomic counters, which are all full barriers unless they say otherwise
+#ifdef _WIN32
+#define Lock(p)             EnterCriticalSection(p)
+#define Unlock(p)           LeaveCriticalSection(p)
+#define WaitForWake(pWake, pLock) SleepConditionVariableCS(pWake, pLock, INFINITE)
+#define Signal(pWake)       WakeConditionVariable(pWake)
+#define AtomicAdd(p, v)     ((UInt32)InterlockedExchangeAdd((volatile LONG *)(p), (LONG)(v)))
+#define AtomicOr(p, v)      ((UInt32)InterlockedOr((volatile LONG *)(p), (LONG)(v)))
+#define AtomicAnd(p, v)     ((UInt32)InterlockedAnd((volatile LONG *)(p), (LONG)(v)))
+#define AtomicLoad(p)       ((UInt32)InterlockedCompareExchange((volatile LONG *)(p), 0, 0))
+#define LoadRelaxed(p)      (*(const volatile UInt32 *)(p))
+#define StoreRelaxed(p, v)  (*(volatile UInt32 *)(p) = (v))
+#define Fence()             MemoryBarrier()
+static __declspec(thread) OrionCommWorker_t *pCurrentWorker;
+#else
+#define Lock(p)             pthread_mutex_lock(p)
+#define Unlock(p)           pthread_mutex_unlock(p)
+#define WaitForWake(pWake, pLock) pthread_cond_wait(pWake, pLock)
+#define Signal(pWake)       pthread_cond_signal(pWake)
+#define AtomicAdd(p, v)     __atomic_fetch_add(p, v, __ATOMIC_SEQ_CST)
+#define AtomicOr(p, v)      __atomic_fetch_or(p, v, __ATOMIC_SEQ_CST)
+#define AtomicAnd(p, v)     __atomic_fetch_and(p, v, __ATOMIC_SEQ_CST)
+#define AtomicLoad(p)       __atomic_load_n(p, __ATOMIC_SEQ_CST)
+#define LoadRelaxed(p)      __atomic_load_n(p, __ATOMIC_RELAXED)
+#define StoreRelaxed(p, v)  __atomic_store_n(p, v, __ATOMIC_RELAXED)
+#define Fence()             __atomic_thread_fence(__ATOMIC_SEQ_CST)
+static __thread OrionCommWorker_t *pCurrentWorker;
+#endif // _WIN32
+
+// Mask for turning free-running queue indices into ring indices
+#define QUEUE_MASK (ORION_COMM_EXECUTOR_QUEUE_SIZE - 1)
+
+static int GetNumProcessors(void);
+static BOOL StartWorker(OrionCommWorker_t *pWorker, BOOL PinThread);
+static void RunWorker(OrionCommWorker_t *pWorker);
+static OrionCommTask_t *TakeTask(OrionCommWorker_t *pWorker, BOOL *pStolen);
+static void WakeWorker(OrionCommWorker_t *pWorker);
+static int FindHome(OrionCommExecutor_t *pExecutor, OrionCommContext_t *pContext);
+
+BOOL OrionCommExecutorInit(OrionCommExecutor_t *pExecutor, int NumWorkers, BOOL PinThreads)
+{
+    int i;
+
+    // Start with a clean slate, and one worker per processor unless the caller knows better
+    memset(pExecutor, 0, sizeof(*pExecutor));
+
+    if (NumWorkers <= 0)
+        NumWorkers = GetNumProcessors();
+
+    if (NumWorkers > ORION_COMM_EXECUTOR_MAX_WORKERS)
+        NumWorkers = ORION_COMM_EXECUTOR_MAX_WORKERS;
+
+    // All the tasks come out of one block, so nothing gets allocated while running
+    pExecutor->pPool = (OrionCommTask_t *)calloc(ORION_COMM_EXECUTOR_TASKS, sizeof(OrionCommTask_t));
+
+    if (pExecutor->pPool == NULL)
+        return FALSE;
+
+    for (i = 0; i < ORION_COMM_EXECUTOR_TASKS; i++)
+    {
+        pExecutor->pPool[i].pNext = pExecutor->pFree;
+        pExecutor->pFree = &pExecutor->pPool[i];
+    }
+
+#ifdef _WIN32
+    InitializeCriticalSection(&pExecutor->Lock);
+#else
+    pthread_mutex_init(&pExecutor->Lock, NULL);
+#endif // _WIN32
+
+    // Set up every worker's queues before any of them starts looking at the others
+    for (i = 0; i < NumWorkers; i++)
+    {
+        OrionCommWorker_t *pWorker = &pExecutor->Workers[i];
+
+        pWorker->pExecutor = pExecutor;
+        pWorker->Index = i;
+
+#ifdef _WIN32
+        InitializeCriticalSection(&pWorker->Lock);
+        InitializeConditionVariable(&pWorker->Wake);
+#else
+        pthread_mutex_init(&pWorker->Lock, NULL);
+        pthread_cond_init(&pWorker->Wake, NULL);
+#endif // _WIN32
+    }
+
+    // The workers steal from each other from the moment they start, so they all need to be counted first
+    pExecutor->NumWorkers = NumWorkers;
+
+    // Then start up the threads, and give up on the whole thing if any of them won't start
+    for (i = 0; i < NumWorkers; i++)
+    {
+        if (!StartWorker(&pExecutor->Workers[i], PinThreads))
+        {
+            OrionCommExecutorFree(pExecutor);
+            return FALSE;
+        }
+
+        pExecutor->Workers[i].Started = TRUE;
+    }
+
+    return TRUE;
+
+}// OrionCommExecutorInit
+
+void OrionCommExecutorFree(OrionCommExecutor_t *pExecutor)
+{
+    int i;
+
+    // Let everything that's already been submitted finish before telling the workers to quit
+    OrionCommExecutorWait(pExecutor);
+    StoreRelaxed((UInt32 *)&pExecutor->Stop, TRUE);
+
+    for (i = 0; i < pExecutor->NumWorkers; i++)
+        WakeWorker(&pExecutor->Workers[i]);
+
+    // Wait for each thread to exit, then tear down what it used
+    for (i = 0; i < pExecutor->NumWorkers; i++)
+    {
+        OrionCommWorker_t *pWorker = &pExecutor->Workers[i];
+
+#ifdef _WIN32
+        if (pWorker->Started)
+        {
+            WaitForSingleObject(pWorker->Thread, INFINITE);
+            CloseHandle(pWorker->Thread);
+        }
+
+        DeleteCriticalSection(&pWorker->Lock);
+#else
+        if (pWorker->Started)
+            pthread_join(pWorker->Thread, NULL);
+
+        pthread_mutex_destroy(&pWorker->Lock);
+        pthread_cond_destroy(&pWorker->Wake);
+#endif // _WIN32
+    }
+
+    if (pExecutor->pPool != NULL)
+    {
+#ifdef _WIN32
+        DeleteCriticalSection(&pExecutor->Lock);
+#else
+        pthread_mutex_destroy(&pExecutor->Lock);
+#endif // _WIN32
+        free(pExecutor->pPool);
+    }
+
+    // Leave the executor looking like it was never started
+    memset(pExecutor, 0, sizeof(*pExecutor));
+
+}// OrionCommExecutorFree
+
+BOOL OrionCommExecutorSubmit(OrionCommExecutor_t *pExecutor, OrionCommHandler_t pFunc, OrionCommContext_t *pContext,
+                             const OrionPkt_t *pPkt, void *pUser, int Priority, BOOL Affine)
+{
+    OrionCommWorker_t *pWorker;
+    OrionCommTaskQueue_t *pQueue;
+    OrionCommTask_t *pTask;
+    UInt32 Idle;
+    int Home = -1;
+
+    // Anything that isn't high priority is normal
+    if (Priority != ORION_COMM_PRIORITY_HIGH)
+        Priority = ORION_COMM_PRIORITY_NORMAL;
+
+    // Affine tasks need a connection to be affine to
+    Affine = Affine && (pContext != NULL);
+
+    // Grab a free task, and look up the connection's home worker while we hold the lock anyway
+    Lock(&pExecutor->Lock);
+
+    pTask = pExecutor->pFree;
+
+    if (pTask != NULL)
+        pExecutor->pFree = pTask->pNext;
+
+    if ((pTask != NULL) && (pContext != NULL))
+        Home = FindHome(pExecutor, pContext);
+
+    Unlock(&pExecutor->Lock);
+
+    // No room for another task means the workers are falling behind, so this one gets dropped
+    if (pTask == NULL)
+    {
+        AtomicAdd(&pExecutor->Dropped, 1);
+        return FALSE;
+    }
+
+    pTask->pFunc = pFunc;
+    pTask->pContext = pContext;
+    pTask->pUser = pUser;
+    pTask->HasPkt = (pPkt != NULL);
+
+    // Copy the packet out of the receive buffer, along with the time it arrived at, since the connection moves on
+    if (pPkt != NULL)
+    {
+        memcpy(&pTask->Pkt, pPkt, pPkt->Length + ORION_PKT_OVERHEAD);
+        pTask->Pkt.Info.Time = (pContext != NULL) ? pContext->Stats.LastRxTime : 0;
+    }
+
+    // Affine tasks go to their home worker's own queue, and others to the deque of the worker that's submitting
+    //   them, if it's one of ours, or else to the home worker, or any worker at all for tasks with no connection
+    if (Affine)
+        pWorker = &pExecutor->Workers[Home];
+    else if ((pCurrentWorker != NULL) && (pCurrentWorker->pExecutor == pExecutor))
+        pWorker = pCurrentWorker;
+    else if (Home >= 0)
+        pWorker = &pExecutor->Workers[Home];
+    else
+        pWorker = &pExecutor->Workers[AtomicAdd(&pExecutor->Submitted, 0) % pExecutor->NumWorkers];
+
+    pQueue = Affine ? &pWorker->Pinned[Priority] : &pWorker->Shared[Priority];
+
+    // Count the task before a worker can possibly finish it, so that waiting never sees more done than submitted
+    AtomicAdd(&pExecutor->Submitted, 1);
+
+    Lock(&pWorker->Lock);
+
+    if (pQueue->Tail - pQueue->Head < ORION_COMM_EXECUTOR_QUEUE_SIZE)
+    {
+        pQueue->pTasks[pQueue->Tail & QUEUE_MASK] = pTask;
+        StoreRelaxed(&pQueue->Tail, pQueue->Tail + 1);
+        pWorker->Wakeups++;
+        Signal(&pWorker->Wake);
+    }
+    else
+        pQueue = NULL;
+
+    Unlock(&pWorker->Lock);
+
+    // If that worker's queue was full, put the task back and give up on it
+    if (pQueue == NULL)
+    {
+        Lock(&pExecutor->Lock);
+        pTask->pNext = pExecutor->pFree;
+        pExecutor->pFree = pTask;
+        Unlock(&pExecutor->Lock);
+
+        AtomicAdd(&pExecutor->Submitted, (UInt32)-1);
+        AtomicAdd(&pExecutor->Dropped, 1);
+        return FALSE;
+    }
+
+    // Anyone can run a shared task, so wake an idle worker to come and steal it. Idle workers set their bit
+    //   before they look through the queues one last time, so either they see this task or we see their bit
+    if (!Affine)
+    {
+        Fence();
+        Idle = AtomicLoad(&pExecutor->Idle) & ~(1UL << pWorker->Index);
+
+        if (Idle != 0)
+        {
+            int i = 0;
+
+            while ((Idle & (1UL << i)) == 0)
+                i++;
+
+            WakeWorker(&pExecutor->Workers[i]);
+        }
+    }
+
+    return TRUE;
+
+}// OrionCommExecutorSubmit
+
+void OrionCommExecutorHandler(OrionCommContext_t *pContext, const OrionPkt_t *pPkt, void *pUser)
+{
+    const OrionCommJob_t *pJob = (const OrionCommJob_t *)pUser;
+
+    // Hand the packet over to the executor, which copies it out of the receive buffer
+    OrionCommExecutorSubmit(pJob->pExecutor, pJob->pFunc, pContext, pPkt, pJob->pUser, pJob->Priority, pJob->Affine);
+
+}// OrionCommExecutorHandler
+
+void OrionCommExecutorWait(OrionCommExecutor_t *pExecutor)
+{
+    OrionCommExecutorStats_t Stats;
+
+    // Nothing to wait for if the executor never got going
+    if (pExecutor->NumWorkers == 0)
+        return;
+
+    // Poll the counters, since this is only for shutting down and tests rather than anything time critical
+    OrionCommExecutorGetStats(pExecutor, &Stats);
+
+    while (Stats.Completed != Stats.Submitted)
+    {
+        usleep(1000);
+        OrionCommExecutorGetStats(pExecutor, &Stats);
+    }
+
+}// OrionCommExecutorWait
+
+void OrionCommExecutorGetStats(const OrionCommExecutor_t *pExecutor, OrionCommExecutorStats_t *pStats)
+{
+    int i;
+
+    // Each worker keeps its own counts, so add them all up
+    memset(pStats, 0, sizeof(*pStats));
+
+    for (i = 0; i < pExecutor->NumWorkers; i++)
+    {
+        pStats->Completed += AtomicLoad((UInt32 *)&pExecutor->Workers[i].Completed);
+        pStats->Stolen += AtomicLoad((UInt32 *)&pExecutor->Workers[i].Stolen);
+    }
+
+    pStats->Submitted = AtomicLoad((UInt32 *)&pExecutor->Submitted);
+    pStats->Dropped = AtomicLoad((UInt32 *)&pExecutor->Dropped);
+
+}// OrionCommExecutorGetStats
+
+int OrionCommExecutorHome(OrionCommExecutor_t *pExecutor, OrionCommContext_t *pContext)
+{
+    int Home;
+
+    // Same lookup that submitting a task does
+    Lock(&pExecutor->Lock);
+    Home = FindHome(pExecutor, pContext);
+    Unlock(&pExecutor->Lock);
+
+    return Home;
+
+}// OrionCommExecutorHome
+
+// Returns the worker that a connection's tasks go to, giving it one if it's new. The executor must be locked.
+static int FindHome(OrionCommExecutor_t *pExecutor, OrionCommContext_t *pContext)
+{
+    int i;
+
+    // Connections get homes in the order they first show up, so they spread evenly over the workers
+    for (i = 0; i < pExecutor->NumHomes; i++)
+    {
+        if (pExecutor->pHomes[i] == pContext)
+            return i % pExecutor->NumWorkers;
+    }
+
+    if (pExecutor->NumHomes < ORION_COMM_LOOP_MAX_CONTEXTS)
+    {
+        pExecutor->pHomes[pExecutor->NumHomes] = pContext;
+        return pExecutor->NumHomes++ % pExecutor->NumWorkers;
+    }
+
+    // Once the table is full, fall back on the context's address, which still always gives the same answer
+    return (int)(((size_t)pContext / sizeof(OrionCommContext_t)) % pExecutor->NumWorkers);
+
+}// FindHome
+
+// Returns the number of processors the threads can be spread over
+static int GetNumProcessors(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO Info;
+
+    GetSystemInfo(&Info);
+    return (int)Info.dwNumberOfProcessors;
+#else
+    long Count = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return (Count > 0) ? (int)Count : 1;
+#endif // _WIN32
+
+}// GetNumProcessors
+
+#ifdef _WIN32
+static DWORD WINAPI WorkerThread(LPVOID pArg)
+{
+    RunWorker((OrionCommWorker_t *)pArg);
+    return 0;
+}
+#else
+static void *WorkerThread(void *pArg)
+{
+    RunWorker((OrionCommWorker_t *)pArg);
+    return NULL;
+}
+#endif // _WIN32
+
+// Starts a worker's thread, and pins it to a processor of its own if asked to
+static BOOL StartWorker(OrionCommWorker_t *pWorker, BOOL PinThread)
+{
+    int Processor = pWorker->Index % GetNumProcessors();
+
+#ifdef _WIN32
+    pWorker->Thread = CreateThread(NULL, 0, WorkerThread, pWorker, 0, NULL);
+
+    if (pWorker->Thread == NULL)
+        return FALSE;
+
+    if (PinThread && (Processor < (int)(sizeof(DWORD_PTR) * 8)))
+        SetThreadAffinityMask(pWorker->Thread, (DWORD_PTR)1 << Processor);
+#else
+    if (pthread_create(&pWorker->Thread, NULL, WorkerThread, pWorker) != 0)
+        return FALSE;
+
+#ifdef __linux__
+    if (PinThread)
+    {
+        cpu_set_t Set;
+
+        CPU_ZERO(&Set);
+        CPU_SET(Processor, &Set);
+        pthread_setaffinity_np(pWorker->Thread, sizeof(Set), &Set);
+    }
+#else
+    // macOS has no way to pin a thread, only hints that the scheduler is free to ignore
+    (void)Processor;
+    (void)PinThread;
+#endif // __linux__
+#endif // _WIN32
+
+    return TRUE;
+
+}// StartWorker
+
+// Runs tasks until the executor is freed, sleeping whenever there's nothing to run
+static void RunWorker(OrionCommWorker_t *pWorker)
+{
+    OrionCommExecutor_t *pExecutor = pWorker->pExecutor;
+    UInt32 Bit = 1UL << pWorker->Index;
+
+    pCurrentWorker = pWorker;
+
+    for (;;)
+    {
+        BOOL Stolen = FALSE;
+        OrionCommTask_t *pTask = TakeTask(pWorker, &Stolen);
+
+        if (pTask == NULL)
+        {
+            // Say we're idle before looking one last time, so that a submitter either sees our bit or we see its task
+            AtomicOr(&pExecutor->Idle, Bit);
+            pTask = TakeTask(pWorker, &Stolen);
+
+            if (pTask == NULL)
+            {
+                // Sleep until someone hands us a task or says one is up for grabs, unless it's time to go
+                Lock(&pWorker->Lock);
+
+                while ((pWorker->Wakeups == 0) && !LoadRelaxed((UInt32 *)&pExecutor->Stop))
+                    WaitForWake(&pWorker->Wake, &pWorker->Lock);
+
+                pWorker->Wakeups = 0;
+                Unlock(&pWorker->Lock);
+            }
+
+            AtomicAnd(&pExecutor->Idle, ~Bit);
+
+            if (pTask == NULL)
+            {
+                // The executor only stops once every task has been run, so there's nothing left to look for
+                if (LoadRelaxed((UInt32 *)&pExecutor->Stop))
+                    break;
+
+                continue;
+            }
+        }
+
+        // Run the task, with its own copy of the packet if it has one
+        pTask->pFunc(pTask->pContext, pTask->HasPkt ? &pTask->Pkt : NULL, pTask->pUser);
+
+        // Give the task back before counting it, so that waiting for everything to finish means it's free again
+        Lock(&pExecutor->Lock);
+        pTask->pNext = pExecutor->pFree;
+        pExecutor->pFree = pTask;
+        Unlock(&pExecutor->Lock);
+
+        if (Stolen)
+            AtomicAdd(&pWorker->Stolen, 1);
+
+        AtomicAdd(&pWorker->Completed, 1);
+    }
+
+    pCurrentWorker = NULL;
+
+}// RunWorker
+
+// Returns the most urgent task this worker can run, or NULL if there isn't one anywhere
+static OrionCommTask_t *TakeTask(OrionCommWorker_t *pWorker, BOOL *pStolen)
+{
+    OrionCommExecutor_t *pExecutor = pWorker->pExecutor;
+    OrionCommTask_t *pTask = NULL;
+    int Priority, i;
+
+    for (Priority = 0; Priority < ORION_COMM_PRIORITIES; Priority++)
+    {
+        OrionCommTaskQueue_t *pPinned = &pWorker->Pinned[Priority];
+        OrionCommTaskQueue_t *pShared = &pWorker->Shared[Priority];
+
+        // Our own queues first, oldest task first, peeking at the indices so that empty queues don't cost a lock
+        if ((LoadRelaxed(&pPinned->Tail) != pPinned->Head) || (LoadRelaxed(&pShared->Tail) != LoadRelaxed(&pShared->Head)))
+        {
+            Lock(&pWorker->Lock);
+
+            if (pPinned->Tail != pPinned->Head)
+            {
+                pTask = pPinned->pTasks[pPinned->Head & QUEUE_MASK];
+                StoreRelaxed(&pPinned->Head, pPinned->Head + 1);
+            }
+            else if (pShared->Tail != pShared->Head)
+            {
+                pTask = pShared->pTasks[pShared->Head & QUEUE_MASK];
+                StoreRelaxed(&pShared->Head, pShared->Head + 1);
+            }
+
+            Unlock(&pWorker->Lock);
+
+            if (pTask != NULL)
+                return pTask;
+        }
+
+        // Then steal the newest task of this priority from everyone else's deques, starting with our neighbor
+        for (i = 1; i < pExecutor->NumWorkers; i++)
+        {
+            OrionCommWorker_t *pVictim = &pExecutor->Workers[(pWorker->Index + i) % pExecutor->NumWorkers];
+            OrionCommTaskQueue_t *pQueue = &pVictim->Shared[Priority];
+
+            if (LoadRelaxed(&pQueue->Tail) == LoadRelaxed(&pQueue->Head))
+                continue;
+
+            Lock(&pVictim->Lock);
+
+            if (pQueue->Tail != pQueue->Head)
+            {
+                StoreRelaxed(&pQueue->Tail, pQueue->Tail - 1);
+                pTask = pQueue->pTasks[pQueue->Tail & QUEUE_MASK];
+            }
+
+            Unlock(&pVictim->Lock);
+
+            if (pTask != NULL)
+            {
+                *pStolen = TRUE;
+                return pTask;
+            }
+        }
+    }
+
+    return NULL;
+
+}// TakeTask
+
+// Wakes a worker that may be asleep
+static void WakeWorker(OrionCommWorker_t *pWorker)
+{
+    Lock(&pWorker->Lock);
+    pWorker->Wakeups++;
+    Signal(&pWorker->Wake);
+    Unlock(&pWorker->Lock);
+
+}// WakeWorker
@@ -0,0 +1,194 @@
+#ifndef ORIONCOMMEXECUTOR_H
+#define ORIONCOMMEXECUTOR_H
+
+#include "OrionComm.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif // _WIN32
+
+// Work-stealing task executor for the processing that follows each received packet, e.g. converting
+//   telemetry, intersecting terrain or encoding KLV, so that a slow job for one gimbal doesn't hold up the
+//   receive thread or any other gimbal.
+//
+// Each worker thread has a deque of tasks that any idle worker may steal from, and a queue of tasks that
+//   only it may run. A task submitted as affine goes to the second kind of queue on its connection's home
+//   worker, so all of a gimbal's affine tasks run one at a time and in the order they were submitted. Other
+//   tasks go to the deque of the submitting worker, or the connection's home worker when submitted from
+//   outside the executor, and the owner runs them oldest first while thieves take the newest.
+//
+// Every queue comes in two priorities. Workers run everything of high priority they can find, in their own
+//   queues or by stealing, before they start on anything of normal priority, so commands and acks jump
+//   ahead of bulk processing. A task that has already started is never interrupted.
+//
+// Tasks have the same signature as event loop handlers, so a handler can be moved onto the executor by
+//   handing OrionCommExecutorHandler() to the loop along with an OrionCommJob_t that names the real handler.
+//   The packet gets copied out of the receive buffer into the task, and is valid until the task returns.
+
+// Most worker threads in one executor
+#define ORION_COMM_EXECUTOR_MAX_WORKERS 32
+
+// Most tasks that can be waiting or running at once in one executor
+#define ORION_COMM_EXECUTOR_TASKS       1024
+
+// Most tasks in each queue of each worker - this must be a power of two
+#define ORION_COMM_EXECUTOR_QUEUE_SIZE  256
+
+// Task priorities, highest first
+#define ORION_COMM_PRIORITY_HIGH        0
+#define ORION_COMM_PRIORITY_NORMAL      1
+#define ORION_COMM_PRIORITIES           2
+
+//! A piece of work waiting to be run
+typedef struct OrionCommTask
+{
+    //! Function to run and its arguments
+    OrionCommHandler_t pFunc;
+    OrionCommContext_t *pContext;
+    void *pUser;
+
+    //! Copy of the packet the task is for, and whether there is one
+    OrionPkt_t Pkt;
+    BOOL HasPkt;
+
+    //! Next task on the free list
+    struct OrionCommTask *pNext;
+
+} OrionCommTask_t;
+
+//! Ring of tasks that is added to at the tail and taken from at either end
+typedef struct
+{
+    OrionCommTask_t *pTasks[ORION_COMM_EXECUTOR_QUEUE_SIZE];
+
+    //! Free-running indices of the oldest task and one past the newest
+    UInt32 Head;
+    UInt32 Tail;
+
+} OrionCommTaskQueue_t;
+
+//! One worker thread and its queues
+typedef struct
+{
+    //! Executor this worker belongs to, and its index there
+    struct OrionCommExecutor *pExecutor;
+    int Index;
+
+    //! Tasks that only this worker runs, and tasks that other workers can steal, at each priority
+    OrionCommTaskQueue_t Pinned[ORION_COMM_PRIORITIES];
+    OrionCommTaskQueue_t Shared[ORION_COMM_PRIORITIES];
+
+    //! Number of times the worker has been woken since it last looked
+    UInt32 Wakeups;
+
+    //! Tasks this worker has run, and how many of those it stole from other workers
+    UInt32 Completed;
+    UInt32 Stolen;
+
+#ifdef _WIN32
+    CRITICAL_SECTION Lock;
+    CONDITION_VARIABLE Wake;
+    HANDLE Thread;
+#else
+    pthread_mutex_t Lock;
+    pthread_cond_t Wake;
+    pthread_t Thread;
+#endif // _WIN32
+
+    //! TRUE once the thread is running
+    BOOL Started;
+
+    //! Pads each worker out so that workers don't share cache lines
+    UInt8 Reserved[64];
+
+} OrionCommWorker_t;
+
+//! Counters for an executor, all of which wrap around
+typedef struct
+{
+    //! Tasks handed to the executor, tasks it ran, and tasks it turned away for lack of room
+    UInt32 Submitted;
+    UInt32 Completed;
+    UInt32 Dropped;
+
+    //! Tasks that were run by a worker other than the one they were queued on
+    UInt32 Stolen;
+
+} OrionCommExecutorStats_t;
+
+//! Pool of worker threads with work-stealing task queues
+typedef struct OrionCommExecutor
+{
+    //! Worker threads, each with its own queues
+    OrionCommWorker_t Workers[ORION_COMM_EXECUTOR_MAX_WORKERS];
+    int NumWorkers;
+
+    //! Storage for every task, and the ones that aren't in use
+    OrionCommTask_t *pPool;
+    OrionCommTask_t *pFree;
+
+    //! Connections that have been given a home worker, which is the index into this table modulo NumWorkers
+    OrionCommContext_t *pHomes[ORION_COMM_LOOP_MAX_CONTEXTS];
+    int NumHomes;
+
+    //! One bit for each worker that is looking for work or asleep
+    UInt32 Idle;
+
+    //! Tasks submitted and dropped, written with atomic adds since any thread can submit
+    UInt32 Submitted;
+    UInt32 Dropped;
+
+    //! TRUE once the workers have been told to finish up
+    BOOL Stop;
+
+#ifdef _WIN32
+    //! Guards the free list and the home table
+    CRITICAL_SECTION Lock;
+#else
+    pthread_mutex_t Lock;
+#endif // _WIN32
+
+} OrionCommExecutor_t;
+
+//! A packet handler to run on an executor, for passing to an event loop along with OrionCommExecutorHandler()
+typedef struct
+{
+    //! Executor to run the handler on
+    OrionCommExecutor_t *pExecutor;
+
+    //! Handler that does the work and its user data
+    OrionCommHandler_t pFunc;
+    void *pUser;
+
+    //! ORION_COMM_PRIORITY_HIGH or ORION_COMM_PRIORITY_NORMAL
+    int Priority;
+
+    //! TRUE to run every packet on its connection's home worker, in the order the packets arrived
+    BOOL Affine;
+
+} OrionCommJob_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Starting and stopping, with zero workers for one per processor
+BOOL OrionCommExecutorInit(OrionCommExecutor_t *pExecutor, int NumWorkers, BOOL PinThreads);
+void OrionCommExecutorFree(OrionCommExecutor_t *pExecutor);
+
+// Handing over work, from any thread including the executor's own tasks
+BOOL OrionCommExecutorSubmit(OrionCommExecutor_t *pExecutor, OrionCommHandler_t pFunc, OrionCommContext_t *pContext,
+                             const OrionPkt_t *pPkt, void *pUser, int Priority, BOOL Affine);
+void OrionCommExecutorHandler(OrionCommContext_t *pContext, const OrionPkt_t *pPkt, void *pUser);
+
+// Waiting for everything submitted so far to finish, and reading the counters
+void OrionCommExecutorWait(OrionCommExecutor_t *pExecutor);
+void OrionCommExecutorGetStats(const OrionCommExecutor_t *pExecutor, OrionCommExecutorStats_t *pStats);
+int OrionCommExecutorHome(OrionCommExecutor_t *pExecutor, OrionCommContext_t *pContext);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ORIONCOMMEXECUTOR_H
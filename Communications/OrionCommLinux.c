@@ -5,22 +5,55 @@
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <sys/fcntl.h>
+#include <sys/uio.h>
+#include <sys/select.h>
+#include <poll.h>
+#include <time.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <termios.h>
 #include <errno.h>
 #include <unistd.h>
 #include <signal.h>
 #include <arpa/inet.h>
 
-static struct sockaddr *GetSockAddr(uint32_t Address, unsigned short port);
+#ifdef __APPLE__
+#include <sys/event.h>
+#include <sys/ioctl.h>
+#include <IOKit/serial/ioss.h>
+#else
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <linux/serial.h>
+#endif // __APPLE__
 
-static int Handle = -1;
+static struct sockaddr *GetSockAddr(struct sockaddr_in *pSockAddr, uint32_t Address, unsigned short Port);
+static long long GetTimeMs(void);
+static BOOL ApplySerialAttributes(int Handle, struct termios *pPort, UInt32 Baud);
 
-BOOL OrionCommOpenSerial(const char *pPath)
+// Number of readiness events to pull out of the kernel per wait
+#define LOOP_MAX_EVENTS 16
+
+BOOL OrionCommOpenSerialBaudEx(OrionCommContext_t *pContext, const char *pPath, UInt32 Baud)
 {
+    int Handle;
+
+    // Close whatever this context already has open, so opening it again doesn't leak it
+    OrionCommCloseEx(pContext);
+
+    // Start off with empty buffers, no capture, relay or store, a fresh clock estimate, no statistics and no IP address
+    OrionCommRxReset(&pContext->Rx);
+    pContext->Tx.Size = 0;
+    pContext->pCapture = NULL;
+    pContext->pRelay = NULL;
+    pContext->pShared = NULL;
+    OrionCommClockReset(&pContext->Clock);
+    memset(&pContext->Stats, 0, sizeof(pContext->Stats));
+    pContext->Address = 0;
+
     // Open a file descriptor for the serial port
     Handle = open(pPath, O_RDWR | O_NOCTTY | O_NDELAY);
 
@@ -42,10 +75,15 @@ BOOL OrionCommOpenSerial(const char *pPath)
             memset(&Port, 0, sizeof(Port));
 
             // Now set up all the other miscellaneous flags appropriately
-            Port.c_cflag = B115200 | CS8 | CLOCAL | CREAD;
+            Port.c_cflag = CS8 | CLOCAL | CREAD;
+
+            // Reads never wait for bytes or time out in the driver - the descriptor is non-blocking and
+            //   the event loop wakes up as soon as anything arrives, so every read takes whatever's there
+            Port.c_cc[VMIN] = 0;
+            Port.c_cc[VTIME] = 0;
 
-            // Try passing the new attributes to the port
-            if (tcsetattr(Handle, TCSANOW, &Port) != 0)
+            // Try passing the new attributes and baud rate to the port
+            if (!ApplySerialAttributes(Handle, &Port, Baud))
             {
                 // If it didn't work, close and invalidate the port
                 close(Handle);
@@ -56,14 +94,15 @@ BOOL OrionCommOpenSerial(const char *pPath)
 
     // Tell the user if this failed or, if not, which COM port they're trying to use
     if (Handle == -1)
-        printf("Failed to open %s\n", pPath);
+        printf("Failed to open %s at %u baud\n", pPath, Baud);
     else
-        printf("Looking for gimbal on %s...\n", pPath);
+        printf("Looking for gimbal on %s at %u baud...\n", pPath, Baud);
 
-    // Return the file descriptor
+    // Hang onto the file descriptor and tell the caller whether it's valid
+    pContext->Handle = Handle;
     return Handle != -1;
 
-}// OrionCommOpenSerial
+}// OrionCommOpenSerialBaudEx
 
 BOOL OrionCommIpStringValid(const char *pAddress)
 {
@@ -81,172 +120,554 @@ BOOL OrionCommSerialPathValid(const char *pPath)
 
 }//  OrionCommSerialPathValid
 
-BOOL OrionCommOpenNetworkIp(const char *pAddress)
+BOOL OrionCommOpenNetworkIpEx(OrionCommContext_t *pContext, const char *pAddress)
 {
-    // Open a new UDP socket for auto-discovery
-    int UdpHandle = socket(AF_INET, SOCK_DGRAM, 0);
-    uint32_t BroadcastAddr = INADDR_BROADCAST;
+    OrionCommGimbal_t Gimbal;
     char IpString[INET_ADDRSTRLEN];
+    UInt32 Address;
 
-    // Try converting the address to a uint32_t
-    if (OrionCommIpStringValid(pAddress) == TRUE)
-    {
-        // Convert the IPaddress string to a 32-bit IPv4 address value
-        inet_pton(AF_INET, pAddress, &BroadcastAddr);
+    // Start off with no connection, closing whatever this context already has open
+    OrionCommCloseEx(pContext);
+    pContext->Address = 0;
 
-        // Now print out the broadcast address we're pinging
-        printf("Looking for gimbal on %s...\n", inet_ntop(AF_INET, &BroadcastAddr, IpString, INET_ADDRSTRLEN));
+    // Make sure the address is a valid IPv4 string before we go any further
+    if (OrionCommIpStringValid(pAddress) == FALSE)
+        return FALSE;
 
-        // Roll the bytes for our GetSockAddr function
-        BroadcastAddr = ntohl(BroadcastAddr);
+    // Now print out the broadcast address we're pinging
+    printf("Looking for gimbal on %s...\n", pAddress);
+
+    // Take the first gimbal that answers within the same 2 s window the old polling loop gave up after
+    if ((OrionCommDiscover(pAddress, 2000, &Gimbal, 1) == 1) && (OrionCommConnectAll(pContext, &Gimbal, 1, 2000) == 1))
+    {
+        // Convert the IP address to network byte order
+        Address = htonl(pContext->Address);
+
+        // Now print out the IP address that we connected to
+        printf("Connected to %s\n", inet_ntop(AF_INET, &Address, IpString, INET_ADDRSTRLEN));
     }
     else
     {
-        // Close the discovery handle and return a failure
-        close(UdpHandle);
-        return FALSE;
+        // Let the user know we failed to connect
+        printf("Failed to connect to %s\n", pAddress);
     }
 
-    // If the socket looks good
-    if (UdpHandle >= 0)
-    {
-        BOOL Broadcast = TRUE;
-        int WaitCount = 0;
-        char Buffer[64];
-        OrionPkt_t Pkt;
+    // Return a possibly valid handle to this socket
+    return pContext->Handle != -1;
+
+}// OrionCommOpenNetworkIpEx
+
+int OrionCommDiscover(const char *pAddress, int Timeout, OrionCommGimbal_t *pGimbals, int Max)
+{
+    uint32_t BroadcastAddr = INADDR_BROADCAST;
+    struct sockaddr_in SockAddr;
+    BOOL Broadcast = TRUE;
+    long long Start;
+    int UdpHandle, Elapsed, NextPing = 0, Count = 0;
+    OrionPkt_t Pkt;
 
-        // Bind to the proper port to get responses from the gimbal
-        bind(UdpHandle, GetSockAddr(INADDR_ANY, UDP_IN_PORT), sizeof(struct sockaddr_in));
+    // Make sure the address is a valid IPv4 string and there's somewhere to put the answers
+    if ((OrionCommIpStringValid(pAddress) == FALSE) || (Max <= 0))
+        return 0;
 
-        // Make this socket non blocking
-        fcntl(UdpHandle, F_SETFL, O_NONBLOCK);
+    // Convert the IP address string to a 32-bit IPv4 address value, then roll the bytes for GetSockAddr
+    inet_pton(AF_INET, pAddress, &BroadcastAddr);
+    BroadcastAddr = ntohl(BroadcastAddr);
 
-        // Allow the socket to send packets to the broadcast address
-        setsockopt(UdpHandle, SOL_SOCKET, SO_BROADCAST, (char *)&Broadcast, sizeof(BOOL));
+    // Open a new UDP socket for auto-discovery
+    if ((UdpHandle = socket(AF_INET, SOCK_DGRAM, 0)) < 0)
+        return 0;
 
-        // Build a version request packet (note that it doesn't matter what you send...)
-        MakeOrionPacket(&Pkt, ORION_PKT_CROWN_VERSION, 0);
+    // Bind to the proper port to get responses from the gimbal
+    bind(UdpHandle, GetSockAddr(&SockAddr, INADDR_ANY, UDP_IN_PORT), sizeof(struct sockaddr_in));
 
-        // Wait for up to 20 iterations
-        while (WaitCount++ < 20)
-        {
-            socklen_t Size = sizeof(struct sockaddr_in);
+    // Make this socket non blocking
+    fcntl(UdpHandle, F_SETFL, O_NONBLOCK);
 
-            // Send a version request packet
-            sendto(UdpHandle, (char *)&Pkt, Pkt.Length + ORION_PKT_OVERHEAD, 0, GetSockAddr(BroadcastAddr, UDP_OUT_PORT), sizeof(struct sockaddr_in));
+    // Allow the socket to send packets to the broadcast address
+    setsockopt(UdpHandle, SOL_SOCKET, SO_BROADCAST, (char *)&Broadcast, sizeof(BOOL));
 
-            // If we get data back forom the gimbal
-            if (recvfrom(UdpHandle, Buffer, 64, 0, GetSockAddr(INADDR_ANY, UDP_IN_PORT), &Size) > 0)
-            {
-                // Pull the gimbal's IP address from the datagram header
-                UInt32 Address = ntohl(((struct sockaddr_in *)GetSockAddr(0, 0))->sin_addr.s_addr);
+    // Build a version request packet (note that it doesn't matter what you send...)
+    MakeOrionPacket(&Pkt, ORION_PKT_CROWN_VERSION, 0);
 
-                // Open a file descriptor for the TCP comm socket
-                Handle = socket(AF_INET, SOCK_STREAM, 0);
+    // Run until the deadline, or until we've got as many gimbals as the caller has room for
+    Start = GetTimeMs();
+    while ((Count < Max) && ((Elapsed = (int)(GetTimeMs() - Start)) < Timeout))
+    {
+        struct timeval Wait;
+        fd_set Set;
+        int Next;
 
-                // Bind to the right incoming port
-                bind(Handle, GetSockAddr(INADDR_ANY, TCP_PORT), sizeof(struct sockaddr_in));
+        // Ping the network, and again every so often in case a datagram got dropped along the way
+        if (Elapsed >= NextPing)
+        {
+            sendto(UdpHandle, (char *)&Pkt, Pkt.Length + ORION_PKT_OVERHEAD, 0, GetSockAddr(&SockAddr, BroadcastAddr, UDP_OUT_PORT), sizeof(struct sockaddr_in));
+            NextPing = Elapsed + ORION_COMM_DISCOVER_PING_MS;
+        }
 
-                // Connect to the gimbal's server socket (note this is a blocking call)
-                connect(Handle, GetSockAddr(Address, TCP_PORT), sizeof(struct sockaddr_in));
+        // Sleep until a reply shows up, it's time to ping again or we run out of time
+        Next = (NextPing < Timeout) ? NextPing : Timeout;
+        Wait.tv_sec = (Next - Elapsed) / 1000;
+        Wait.tv_usec = ((Next - Elapsed) % 1000) * 1000;
+        FD_ZERO(&Set);
+        FD_SET(UdpHandle, &Set);
 
-                // Now make the socket non-blocking for future reads/writes
-                fcntl(Handle, F_SETFL, O_NONBLOCK);
+        // Nothing yet, go back around and check the clock
+        if (select(UdpHandle + 1, &Set, NULL, NULL, &Wait) <= 0)
+            continue;
 
-                // Convert the IP address to network byte order
-                Address = htonl(Address);
+        // Drain every reply that's waiting on the socket
+        while (Count < Max)
+        {
+            socklen_t Size = sizeof(struct sockaddr_in);
+            OrionPkt_t Reply;
+            int Bytes, i;
 
-                // Now print out the IP address that we connected to and break out of the loop
-                printf("Connected to %s\n", inet_ntop(AF_INET, &Address, IpString, INET_ADDRSTRLEN));
+            // Stop once the socket runs dry
+            if ((Bytes = (int)recvfrom(UdpHandle, (char *)&Reply, sizeof(Reply), 0, (struct sockaddr *)&SockAddr, &Size)) <= 0)
                 break;
+
+            // Pull the gimbal's IP address from the datagram header and skip gimbals we've already heard from
+            pGimbals[Count].Address = ntohl(SockAddr.sin_addr.s_addr);
+            for (i = 0; (i < Count) && (pGimbals[i].Address != pGimbals[Count].Address); i++);
+
+            // New gimbal: the reply should be a crown version packet, but hold onto the address even if it isn't
+            if (i == Count)
+            {
+                memset(&pGimbals[Count].Version, 0, sizeof(OrionCrownVersion_t));
+                pGimbals[Count].VersionValid = (Bytes >= ORION_PKT_OVERHEAD) && (Bytes >= Reply.Length + ORION_PKT_OVERHEAD) &&
+                                               decodeOrionCrownVersionPacketStructure(&Reply, &pGimbals[Count].Version);
+                Count++;
             }
+        }
+    }
+
+    // Close the UDP handle down now that we're done with it
+    close(UdpHandle);
 
-            // Sleep for 1/10th of a second
-            usleep(100000);
+    // Tell the caller how many gimbals answered
+    return Count;
+
+}// OrionCommDiscover
+
+int OrionCommConnectAll(OrionCommContext_t *pContexts, const OrionCommGimbal_t *pGimbals, int Count, int Timeout)
+{
+    struct pollfd Fds[ORION_COMM_LOOP_MAX_CONTEXTS];
+    BOOL Result[ORION_COMM_LOOP_MAX_CONTEXTS];
+    struct sockaddr_in SockAddr;
+    long long Start;
+    int i, Elapsed, Pending = 0, Connected = 0;
+
+    // We only poll a fixed number of sockets at once
+    if (Count > ORION_COMM_LOOP_MAX_CONTEXTS)
+        Count = ORION_COMM_LOOP_MAX_CONTEXTS;
+
+    // Kick off every connection before waiting on any of them
+    for (i = 0; i < Count; i++)
+    {
+        OrionCommContext_t *pContext = &pContexts[i];
+        int Reuse = 1;
+
+        // Start off from a closed context: no connection, empty buffers, no capture, relay or store and a fresh
+        //   clock estimate, closing whatever it already had open first so it doesn't leak
+        OrionCommCloseEx(pContext);
+        memset(pContext, 0, sizeof(OrionCommContext_t));
+        pContext->Handle = -1;
+        pContext->Address = pGimbals[i].Address;
+        OrionCommRxReset(&pContext->Rx);
+        OrionCommClockReset(&pContext->Clock);
+        Fds[i].fd = -1;
+        Fds[i].events = POLLOUT;
+        Fds[i].revents = 0;
+        Result[i] = FALSE;
+
+        // Open a file descriptor for the TCP comm socket
+        if ((pContext->Handle = socket(AF_INET, SOCK_STREAM, 0)) < 0)
+        {
+            pContext->Handle = -1;
+            continue;
         }
 
-        // If we timed out waiting for a response, let the user know
-        if (WaitCount >= 20)
+        // Bind to the right incoming port, sharing it between sockets - if that fails we just get an ephemeral port
+        setsockopt(pContext->Handle, SOL_SOCKET, SO_REUSEADDR, (char *)&Reuse, sizeof(Reuse));
+        bind(pContext->Handle, GetSockAddr(&SockAddr, INADDR_ANY, TCP_PORT), sizeof(struct sockaddr_in));
+
+        // Make the socket non-blocking before connecting, so the connect doesn't hold everyone else up
+        fcntl(pContext->Handle, F_SETFL, O_NONBLOCK);
+
+        // Connect to the gimbal's server socket, which will almost always finish later
+        if (connect(pContext->Handle, GetSockAddr(&SockAddr, pContext->Address, TCP_PORT), sizeof(struct sockaddr_in)) == 0)
+            Result[i] = TRUE;
+        else if (errno == EINPROGRESS)
+            Fds[i].fd = pContext->Handle, Pending++;
+    }
+
+    // Wait for the handshakes to finish, all in parallel
+    Start = GetTimeMs();
+    while ((Pending > 0) && ((Elapsed = (int)(GetTimeMs() - Start)) < Timeout))
+    {
+        // Sleep until something connects or fails
+        if (poll(Fds, Count, Timeout - Elapsed) <= 0)
+            continue;
+
+        // Settle each socket that's done right away, since poll() clears revents for sockets it no longer watches
+        for (i = 0; i < Count; i++)
         {
-            // Broadcast address byte roll, part one million
-            BroadcastAddr = htonl(BroadcastAddr);
+            if ((Fds[i].fd >= 0) && Fds[i].revents)
+            {
+                int Error = -1;
+                socklen_t Size = sizeof(Error);
 
-            // Let the user know we failed to connect
-            printf("Failed to connect to %s\n", inet_ntop(AF_INET, &BroadcastAddr, IpString, INET_ADDRSTRLEN));
+                Result[i] = (getsockopt(Fds[i].fd, SOL_SOCKET, SO_ERROR, &Error, &Size) == 0) && (Error == 0);
+                Fds[i].fd = -1;
+                Pending--;
+            }
         }
+    }
+
+    // Now sort out which connections made it
+    for (i = 0; i < Count; i++)
+    {
+        OrionCommContext_t *pContext = &pContexts[i];
 
-        // Close the UDP handle down now that we're done with it
-        close(UdpHandle);
+        // Never got started, still pending at the deadline, or the handshake failed
+        if (!Result[i])
+        {
+            OrionCommCloseEx(pContext);
+            continue;
+        }
+
+        // Batching is up to OrionCommQueue, so don't let Nagle hold up small sends by default
+        OrionCommSetNoDelayEx(pContext, TRUE);
+        Connected++;
     }
 
-    // Return a possibly valid handle to this socket
-    return Handle != -1;
+    // Tell the caller how many connections are up
+    return Connected;
 
-}// OrionCommOpenNetworkIp
+}// OrionCommConnectAll
 
-void OrionCommClose(void)
+void OrionCommCloseEx(OrionCommContext_t *pContext)
 {
     // Easy enough, just close the file descriptor and invalidate it
-    close(Handle);
-    Handle = -1;
+    if (pContext->Handle >= 0)
+        close(pContext->Handle);
+
+    pContext->Handle = -1;
+
+}// OrionCommCloseEx
+
+BOOL OrionCommSetNoDelayEx(OrionCommContext_t *pContext, BOOL NoDelay)
+{
+    int Flag = NoDelay ? 1 : 0;
+
+    // Serial ports don't have a Nagle algorithm to turn off
+    if (pContext->Address == 0)
+        return TRUE;
+
+    // Otherwise enable or disable TCP_NODELAY on the socket
+    return setsockopt(pContext->Handle, IPPROTO_TCP, TCP_NODELAY, &Flag, sizeof(Flag)) == 0;
+
+}// OrionCommSetNoDelayEx
+
+BOOL OrionCommIsOpenEx(const OrionCommContext_t *pContext)
+{
+    // Return TRUE if the file descriptor is valid
+    return (pContext->Handle >= 0);
+
+}// OrionCommIsOpenEx
+
+BOOL OrionCommLoopInit(OrionCommLoop_t *pLoop)
+{
+    // Start off with no handlers and no connections
+    memset(pLoop, 0, sizeof(*pLoop));
+
+    // Create the kernel event queue that we'll wait on
+#ifdef __APPLE__
+    pLoop->Poll = kqueue();
+#else
+    pLoop->Poll = epoll_create1(0);
+#endif // __APPLE__
+
+    // Return TRUE if we got a valid descriptor
+    return pLoop->Poll >= 0;
 
-}// OrionCommClose
+}// OrionCommLoopInit
 
-BOOL OrionCommSend(const OrionPkt_t *pPkt)
+void OrionCommLoopFree(OrionCommLoop_t *pLoop)
 {
-    // Write the packet, including header data, to the file descriptor
-    return write(Handle, (char *)pPkt, pPkt->Length + ORION_PKT_OVERHEAD) > 0;
+    // Closing the event queue drops all of its registrations, but leaves the connections open
+    if (pLoop->Poll >= 0)
+        close(pLoop->Poll);
 
-}// OrionCommSend
+    pLoop->Poll = -1;
+    pLoop->NumContexts = 0;
 
-BOOL OrionCommReceive(OrionPkt_t *pPkt)
+}// OrionCommLoopFree
+
+BOOL OrionCommLoopWatch(OrionCommLoop_t *pLoop, OrionCommContext_t *pContext)
 {
-    static OrionPkt_t Pkt = { 0 };
-    UInt8 Buffer;
+#ifdef __APPLE__
+    struct kevent Event;
+
+    // Ask for a read event on this descriptor, tagged with the connection pointer
+    EV_SET(&Event, pContext->Handle, EVFILT_READ, EV_ADD, 0, 0, pContext);
+    return kevent(pLoop->Poll, &Event, 1, NULL, 0, NULL) == 0;
+#else
+    struct epoll_event Event;
 
-    // As long as we keep getting bytes, keep reading them in one by one
-    while (read(Handle, (char *)&Buffer, 1) == 1)
+    // Ask for input and hangup events on this descriptor, tagged with the connection pointer
+    memset(&Event, 0, sizeof(Event));
+    Event.events = EPOLLIN | EPOLLRDHUP;
+    Event.data.ptr = pContext;
+    return epoll_ctl(pLoop->Poll, EPOLL_CTL_ADD, pContext->Handle, &Event) == 0;
+#endif // __APPLE__
+
+}// OrionCommLoopWatch
+
+void OrionCommLoopUnwatch(OrionCommLoop_t *pLoop, OrionCommContext_t *pContext)
+{
+    // The descriptor may already be closed, in which case the kernel dropped it for us
+    if (pContext->Handle >= 0)
     {
-        // If this byte is the end of a valid packet
-        if (LookForOrionPacketInByte(&Pkt, Buffer))
-        {
-            // Copy the packet into the passed-in location and return a success
-            *pPkt = Pkt;
-            return TRUE;
-        }
+#ifdef __APPLE__
+        struct kevent Event;
+
+        EV_SET(&Event, pContext->Handle, EVFILT_READ, EV_DELETE, 0, 0, NULL);
+        kevent(pLoop->Poll, &Event, 1, NULL, 0, NULL);
+#else
+        epoll_ctl(pLoop->Poll, EPOLL_CTL_DEL, pContext->Handle, NULL);
+#endif // __APPLE__
+    }
+
+}// OrionCommLoopUnwatch
+
+int OrionCommLoopRun(OrionCommLoop_t *pLoop, int Timeout)
+{
+    int i, Count, Total;
+
+#ifdef __APPLE__
+    struct kevent Events[LOOP_MAX_EVENTS];
+    struct timespec Time;
+
+    // Finish off anything that ran out of turns last time, and if there was any, don't wait for more
+    if ((Total = OrionCommLoopDispatchReady(pLoop)) > 0)
+        Timeout = 0;
+
+    Time.tv_sec = Timeout / 1000;
+    Time.tv_nsec = (Timeout % 1000) * 1000000;
+
+    // Wait for up to Timeout milliseconds (or forever, if negative) for data on any connection
+    Count = kevent(pLoop->Poll, NULL, 0, Events, LOOP_MAX_EVENTS, (Timeout < 0) ? NULL : &Time);
+#else
+    struct epoll_event Events[LOOP_MAX_EVENTS];
+
+    // Finish off anything that ran out of turns last time, and if there was any, don't wait for more
+    if ((Total = OrionCommLoopDispatchReady(pLoop)) > 0)
+        Timeout = 0;
+
+    // Wait for up to Timeout milliseconds (or forever, if negative) for data on any connection
+    Count = epoll_wait(pLoop->Poll, Events, LOOP_MAX_EVENTS, Timeout);
+#endif // __APPLE__
+
+    // A signal interrupting the wait isn't an error, it just means nothing more got dispatched
+    if (Count < 0)
+        return (errno == EINTR) ? Total : -1;
+
+    // For each connection that has something to say
+    for (i = 0; i < Count; i++)
+    {
+#ifdef __APPLE__
+        OrionCommContext_t *pContext = (OrionCommContext_t *)Events[i].udata;
+        BOOL Hangup = (Events[i].flags & (EV_EOF | EV_ERROR)) != 0;
+#else
+        OrionCommContext_t *pContext = (OrionCommContext_t *)Events[i].data.ptr;
+        BOOL Hangup = (Events[i].events & (EPOLLRDHUP | EPOLLHUP | EPOLLERR)) != 0;
+#endif // __APPLE__
+
+        // Pull up to a turn's worth of packets off the connection and hand them out to the callbacks
+        Total += OrionCommLoopDispatch(pLoop, pContext);
+
+        // If the other end went away, drop the connection so we don't keep waking up for it
+        if (Hangup && OrionCommLoopRemove(pLoop, pContext))
+            OrionCommCloseEx(pContext);
     }
 
-    // Nope, no packets yet
-    return FALSE;
+    // Tell the caller how many packets got dispatched
+    return Total;
 
-}// OrionCommReceive
+}// OrionCommLoopRun
 
-BOOL OrionCommIsOpen(void)
+// Writes the send queue plus an optional packet with a single writev() call, queueing up anything
+//   that doesn't make it out. Returns FALSE on a write error or if the leftovers won't fit.
+BOOL OrionCommTxWrite(OrionCommContext_t *pContext, const OrionPkt_t *pPkt)
 {
-    // Return TRUE if the file descriptor is valid
-    return (Handle >= 0);
+    struct iovec Vec[2];
+    ssize_t Bytes;
+    int Count = 0;
 
-}// OrionCommIsOpen
+    // Queued data goes out first to keep everything in order
+    if (pContext->Tx.Size > 0)
+    {
+        Vec[Count].iov_base = pContext->Tx.Data;
+        Vec[Count++].iov_len = pContext->Tx.Size;
+    }
+
+    // Followed by the new packet, straight out of the caller's buffer
+    if (pPkt != NULL)
+    {
+        Vec[Count].iov_base = (void *)pPkt;
+        Vec[Count++].iov_len = pPkt->Length + ORION_PKT_OVERHEAD;
+    }
+
+    // If there's nothing to do, we're done
+    if (Count == 0)
+        return TRUE;
+
+    // A full socket buffer isn't an error, the data just waits in the queue until the next flush
+    if ((Bytes = writev(pContext->Handle, Vec, Count)) < 0)
+    {
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+            return FALSE;
+
+        Bytes = 0;
+    }
 
-// Quickly and easily constructs a sockaddr pointer for a bunch of different functions.
-//   Call this function with Address == Port == 0 to access the pointer, or pass in
-//   actual values to construct a new sockaddr.
-static struct sockaddr *GetSockAddr(uint32_t Address, unsigned short Port)
+    // Drop whatever got written and hang onto the rest
+    return OrionCommTxWritten(&pContext->Tx, pPkt, (UInt32)Bytes);
+
+}// OrionCommTxWrite
+
+// Reads as much data as will fit into a context's receive ring buffer with a single readv() call
+int OrionCommRxFill(OrionCommContext_t *pContext)
 {
-    static struct sockaddr_in SockAddr;
+    struct iovec Vec[2];
+    UInt8 *pData[2];
+    UInt32 Size[2];
+    ssize_t Bytes;
+    int i, Count;
+
+    // Get the free regions on either side of the ring's wrap point
+    Count = OrionCommRxGetFree(&pContext->Rx, pData, Size);
 
-    // If address and port are both zero, don't modify the structure
-    if (Address || Port)
+    // Point an I/O vector at each free region
+    for (i = 0; i < Count; i++)
     {
-        // Otherwise, populate it with the requested IP address and port
-        memset(&SockAddr, 0, sizeof(SockAddr));
-        SockAddr.sin_family = AF_INET;
-        SockAddr.sin_addr.s_addr = htonl(Address);
-        SockAddr.sin_port = htons(Port);
+        Vec[i].iov_base = pData[i];
+        Vec[i].iov_len = Size[i];
     }
 
+    // Read whatever's available - the handle is non-blocking, so this returns immediately
+    if ((Count == 0) || ((Bytes = readv(pContext->Handle, Vec, Count)) <= 0))
+        return 0;
+
+    // Move the ring's write index up past the new data
+    OrionCommRxCommit(&pContext->Rx, (UInt32)Bytes);
+    return (int)Bytes;
+
+}// OrionCommRxFill
+
+// Quickly and easily fills in a caller-supplied sockaddr for a bunch of different functions,
+//   returning it as a generic sockaddr pointer.
+static struct sockaddr *GetSockAddr(struct sockaddr_in *pSockAddr, uint32_t Address, unsigned short Port)
+{
+    // Populate the structure with the requested IP address and port
+    memset(pSockAddr, 0, sizeof(*pSockAddr));
+    pSockAddr->sin_family = AF_INET;
+    pSockAddr->sin_addr.s_addr = htonl(Address);
+    pSockAddr->sin_port = htons(Port);
+
     // Return a casted pointer to the sockaddr_in structure
-    return (struct sockaddr *)&SockAddr;
+    return (struct sockaddr *)pSockAddr;
 
 }// GetSockAddr
+
+static long long GetTimeMs(void)
+{
+    struct timespec Now;
+
+    // Monotonic time, so discovery and connect deadlines don't care if the wall clock jumps
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return (long long)Now.tv_sec * 1000 + Now.tv_nsec / 1000000;
+
+}// GetTimeMs
+
+// Passes a serial port its new attributes at the requested baud rate, and turns on the driver's low
+//   latency mode where there is one. Returns FALSE if the port can't run at this rate.
+static BOOL ApplySerialAttributes(int Handle, struct termios *pPort, UInt32 Baud)
+{
+#ifdef __APPLE__
+    speed_t Speed = (speed_t)Baud;
+
+    // BSD speeds are just the baud rate, so the standard ones go straight through termios
+    cfsetispeed(pPort, Speed);
+    cfsetospeed(pPort, Speed);
+
+    if (tcsetattr(Handle, TCSANOW, pPort) == 0)
+        return TRUE;
+
+    // Anything else has to be set through IOSSIOSPEED once the rest of the attributes are in place
+    cfsetispeed(pPort, B9600);
+    cfsetospeed(pPort, B9600);
+    return (tcsetattr(Handle, TCSANOW, pPort) == 0) && (ioctl(Handle, IOSSIOSPEED, &Speed) == 0);
+#else
+    static const struct { UInt32 Baud; speed_t Speed; } Speeds[] =
+    {
+        { 9600, B9600 }, { 19200, B19200 }, { 38400, B38400 }, { 57600, B57600 }, { 115200, B115200 },
+        { 230400, B230400 }, { 460800, B460800 }, { 500000, B500000 }, { 576000, B576000 },
+        { 921600, B921600 }, { 1000000, B1000000 }, { 1152000, B1152000 }, { 1500000, B1500000 },
+        { 2000000, B2000000 }, { 2500000, B2500000 }, { 3000000, B3000000 }, { 3500000, B3500000 },
+        { 4000000, B4000000 },
+    };
+    struct serial_struct Serial;
+    speed_t Speed = B38400;
+    BOOL HaveSerial;
+    int i;
+
+    // Not every driver has these settings (USB CDC-ACM adapters don't, for one)
+    HaveSerial = ioctl(Handle, TIOCGSERIAL, &Serial) == 0;
+
+    if (HaveSerial)
+    {
+        // Low latency mode hands received bytes up as soon as they arrive, instead of on the next tick
+        Serial.flags = (Serial.flags & ~ASYNC_SPD_MASK) | ASYNC_LOW_LATENCY;
+        Serial.custom_divisor = 0;
+    }
+
+    // Look for a standard speed first
+    for (i = 0; i < (int)(sizeof(Speeds) / sizeof(Speeds[0])); i++)
+    {
+        if (Speeds[i].Baud == Baud)
+            break;
+    }
+
+    if (i < (int)(sizeof(Speeds) / sizeof(Speeds[0])))
+    {
+        Speed = Speeds[i].Speed;
+
+        // Low latency is a nice to have, so it doesn't matter if the driver won't take it
+        if (HaveSerial)
+            ioctl(Handle, TIOCSSERIAL, &Serial);
+    }
+    else
+    {
+        // Anything else needs a divisor of the UART's base clock, which then stands in for 38400 baud
+        if (!HaveSerial || (Serial.baud_base <= 0) || (Baud == 0))
+            return FALSE;
+
+        Serial.flags |= ASYNC_SPD_CUST;
+        Serial.custom_divisor = MAX(1, (int)((Serial.baud_base + Baud / 2) / Baud));
+
+        if (ioctl(Handle, TIOCSSERIAL, &Serial) != 0)
+            return FALSE;
+    }
+
+    cfsetispeed(pPort, Speed);
+    cfsetospeed(pPort, Speed);
+    return tcsetattr(Handle, TCSANOW, pPort) == 0;
+#endif // __APPLE__
+
+}// ApplySerialAttributes
+
 #endif // __linux__
@@ -0,0 +1,453 @@
+// sendmmsg() and recvmmsg() are GNU extensions
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif // _GNU_SOURCE
+
+#include "OrionCommMulticast.h"
+#include "OrionCommCapture.h"
+
+#include <string.h>
+
+#ifdef _WIN32
+#include <ws2tcpip.h>
+#define CloseSocket(s) closesocket(s)
+#else
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <sys/uio.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define INVALID_SOCKET -1
+#define CloseSocket(s) close(s)
+#endif // _WIN32
+
+// Receive buffer to ask the kernel for, so bursts don't get dropped while the subscriber is busy
+#define SUBSCRIBER_RX_BUFFER (256 * 1024)
+
+static BOOL ParseAddress(const char *pString, UInt32 Default, UInt32 *pAddress);
+static void SetNonBlocking(OrionCommSubscriber_t *pSub, OrionCommPublisher_t *pPub);
+static BOOL StartDatagram(OrionCommSubscriber_t *pSub);
+static BOOL ReceiveDatagrams(OrionCommSubscriber_t *pSub, int Timeout);
+
+BOOL OrionCommPublisherOpen(OrionCommPublisher_t *pPub, const char *pGroup, UInt16 Port, const char *pInterface, int Ttl)
+{
+    struct in_addr Interface;
+    UInt32 Address;
+    int Loop = 1;
+    UInt64 Now = OrionCommCaptureTime();
+#ifdef _WIN32
+    WSADATA WsaData;
+#endif // _WIN32
+
+    // Start off with nothing queued and the numbering at zero, in a session that's named after the
+    //   wall clock time so it won't match the one before it if this publisher is restarted
+    memset(pPub, 0, sizeof(*pPub));
+    pPub->Socket = INVALID_SOCKET;
+    pPub->Port = (Port != 0) ? Port : ORION_COMM_MULTICAST_PORT;
+    pPub->Session = (UInt32)(Now ^ (Now >> 32));
+
+    // Work out where to send to and which interface to send from, with NULL meaning the defaults
+    if (!ParseAddress(pGroup, ntohl(inet_addr(ORION_COMM_MULTICAST_GROUP)), &pPub->Group) || !ParseAddress(pInterface, INADDR_ANY, &Address))
+        return FALSE;
+
+    // Open a UDP socket
+#ifdef _WIN32
+    WSAStartup(MAKEWORD(2, 0), &WsaData);
+#endif // _WIN32
+    if ((pPub->Socket = socket(AF_INET, SOCK_DGRAM, 0)) == INVALID_SOCKET)
+        return FALSE;
+
+    // Set how many routers the datagrams can cross, and loop them back so subscribers on this machine get them too
+    setsockopt(pPub->Socket, IPPROTO_IP, IP_MULTICAST_TTL, (char *)&Ttl, sizeof(Ttl));
+    setsockopt(pPub->Socket, IPPROTO_IP, IP_MULTICAST_LOOP, (char *)&Loop, sizeof(Loop));
+
+    // Send from a specific interface if asked to, since ground stations often have more than one
+    if (Address != INADDR_ANY)
+    {
+        Interface.s_addr = htonl(Address);
+        setsockopt(pPub->Socket, IPPROTO_IP, IP_MULTICAST_IF, (char *)&Interface, sizeof(Interface));
+    }
+
+    // Never hold up the connection being relayed
+    SetNonBlocking(NULL, pPub);
+    return TRUE;
+
+}// OrionCommPublisherOpen
+
+void OrionCommPublisherClose(OrionCommPublisher_t *pPub)
+{
+    // Send anything that's still queued, then close the socket
+    if (pPub->Socket != INVALID_SOCKET)
+    {
+        OrionCommPublisherFlush(pPub);
+        CloseSocket(pPub->Socket);
+        pPub->Socket = INVALID_SOCKET;
+    }
+
+}// OrionCommPublisherClose
+
+BOOL OrionCommPublish(OrionCommPublisher_t *pPub, const OrionPkt_t *pPkt)
+{
+    OrionCommDatagrams_t *pOut = &pPub->Out;
+    UInt32 Size = pPkt->Length + ORION_PKT_OVERHEAD;
+    int Last = pOut->Count - 1;
+    UInt8 *pData;
+
+    // Nowhere to send it
+    if (pPub->Socket == INVALID_SOCKET)
+        return FALSE;
+
+    // Start a new datagram if there isn't one yet or this frame won't fit in the last one
+    if ((Last < 0) || (pOut->Size[Last] + Size > ORION_COMM_MULTICAST_DATAGRAM) || (pOut->Data[Last][3] == 0xFF))
+    {
+        // Send the whole batch first if it's full
+        if (pOut->Count == ORION_COMM_MULTICAST_BATCH)
+            OrionCommPublisherFlush(pPub);
+
+        // Fill in the header, starting with no frames
+        Last = pOut->Count++;
+        pData = pOut->Data[Last];
+        pData[0] = ORION_COMM_MULTICAST_MAGIC0;
+        pData[1] = ORION_COMM_MULTICAST_MAGIC1;
+        pData[2] = ORION_COMM_MULTICAST_VERSION;
+        pData[3] = 0;
+        pData[4] = (UInt8)(pPub->Sequence >> 24);
+        pData[5] = (UInt8)(pPub->Sequence >> 16);
+        pData[6] = (UInt8)(pPub->Sequence >> 8);
+        pData[7] = (UInt8)(pPub->Sequence);
+        pData[8] = (UInt8)(pPub->Session >> 24);
+        pData[9] = (UInt8)(pPub->Session >> 16);
+        pData[10] = (UInt8)(pPub->Session >> 8);
+        pData[11] = (UInt8)(pPub->Session);
+        pOut->Size[Last] = ORION_COMM_MULTICAST_HEADER;
+    }
+
+    // Tack the frame on the end and give it the next number
+    memcpy(&pOut->Data[Last][pOut->Size[Last]], pPkt, Size);
+    pOut->Size[Last] += Size;
+    pOut->Data[Last][3]++;
+    pPub->Sequence++;
+    return TRUE;
+
+}// OrionCommPublish
+
+BOOL OrionCommPublisherFlush(OrionCommPublisher_t *pPub)
+{
+    OrionCommDatagrams_t *pOut = &pPub->Out;
+    struct sockaddr_in Addr;
+    int i, Sent = 0;
+
+    // Nothing to do
+    if (pOut->Count == 0)
+        return TRUE;
+
+    memset(&Addr, 0, sizeof(Addr));
+    Addr.sin_family = AF_INET;
+    Addr.sin_addr.s_addr = htonl(pPub->Group);
+    Addr.sin_port = htons(pPub->Port);
+
+#ifdef __linux__
+    {
+        struct mmsghdr Msgs[ORION_COMM_MULTICAST_BATCH];
+        struct iovec Iov[ORION_COMM_MULTICAST_BATCH];
+        int Count;
+
+        // Describe every datagram so the whole batch goes out in one call
+        memset(Msgs, 0, sizeof(Msgs));
+        for (i = 0; i < pOut->Count; i++)
+        {
+            Iov[i].iov_base = pOut->Data[i];
+            Iov[i].iov_len = pOut->Size[i];
+            Msgs[i].msg_hdr.msg_name = &Addr;
+            Msgs[i].msg_hdr.msg_namelen = sizeof(Addr);
+            Msgs[i].msg_hdr.msg_iov = &Iov[i];
+            Msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        // The kernel can stop part way through, so keep going until it takes nothing
+        while ((Sent < pOut->Count) && ((Count = sendmmsg(pPub->Socket, &Msgs[Sent], pOut->Count - Sent, 0)) > 0))
+            Sent += Count;
+    }
+#else
+    // No batched send here, so it's one call per datagram
+    while ((Sent < pOut->Count) && (sendto(pPub->Socket, (const char *)pOut->Data[Sent], pOut->Size[Sent], 0, (struct sockaddr *)&Addr, sizeof(Addr)) > 0))
+        Sent++;
+#endif // __linux__
+
+    // Count what made it out, and drop what didn't since it would only be stale by the time it got there
+    for (i = 0; i < Sent; i++)
+        pPub->FramesSent += pOut->Data[i][3];
+
+    pPub->DatagramsSent += Sent;
+    pPub->SendErrors += pOut->Count - Sent;
+    i = pOut->Count;
+    pOut->Count = 0;
+
+    // Tell the caller whether everything got sent
+    return Sent == i;
+
+}// OrionCommPublisherFlush
+
+BOOL OrionCommSubscriberOpen(OrionCommSubscriber_t *pSub, const char *pGroup, UInt16 Port, const char *pInterface)
+{
+    struct sockaddr_in Addr;
+    struct ip_mreq Request;
+    UInt32 Group, Address;
+    int Reuse = 1, Buffer = SUBSCRIBER_RX_BUFFER;
+#ifdef _WIN32
+    WSADATA WsaData;
+#endif // _WIN32
+
+    // Start off with nothing received
+    memset(pSub, 0, sizeof(*pSub));
+    pSub->Socket = INVALID_SOCKET;
+
+    // Work out which group to join and on which interface, with NULL meaning the defaults
+    if (!ParseAddress(pGroup, ntohl(inet_addr(ORION_COMM_MULTICAST_GROUP)), &Group) || !ParseAddress(pInterface, INADDR_ANY, &Address))
+        return FALSE;
+
+    // Open a UDP socket
+#ifdef _WIN32
+    WSAStartup(MAKEWORD(2, 0), &WsaData);
+#endif // _WIN32
+    if ((pSub->Socket = socket(AF_INET, SOCK_DGRAM, 0)) == INVALID_SOCKET)
+        return FALSE;
+
+    // Let every consumer on this machine bind the same port
+    setsockopt(pSub->Socket, SOL_SOCKET, SO_REUSEADDR, (char *)&Reuse, sizeof(Reuse));
+#ifdef __APPLE__
+    setsockopt(pSub->Socket, SOL_SOCKET, SO_REUSEPORT, (char *)&Reuse, sizeof(Reuse));
+#endif // __APPLE__
+
+    // Give the kernel room to hold on to bursts
+    setsockopt(pSub->Socket, SOL_SOCKET, SO_RCVBUF, (char *)&Buffer, sizeof(Buffer));
+
+    // Bind to the group's port
+    memset(&Addr, 0, sizeof(Addr));
+    Addr.sin_family = AF_INET;
+    Addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    Addr.sin_port = htons((Port != 0) ? Port : ORION_COMM_MULTICAST_PORT);
+
+    // Then join the group
+    Request.imr_multiaddr.s_addr = htonl(Group);
+    Request.imr_interface.s_addr = htonl(Address);
+
+    if ((bind(pSub->Socket, (struct sockaddr *)&Addr, sizeof(Addr)) != 0) ||
+        (setsockopt(pSub->Socket, IPPROTO_IP, IP_ADD_MEMBERSHIP, (char *)&Request, sizeof(Request)) != 0))
+    {
+        OrionCommSubscriberClose(pSub);
+        return FALSE;
+    }
+
+    // Waiting is done with select() so the socket itself never blocks
+    SetNonBlocking(pSub, NULL);
+    return TRUE;
+
+}// OrionCommSubscriberOpen
+
+void OrionCommSubscriberClose(OrionCommSubscriber_t *pSub)
+{
+    // Closing the socket leaves the group too
+    if (pSub->Socket != INVALID_SOCKET)
+    {
+        CloseSocket(pSub->Socket);
+        pSub->Socket = INVALID_SOCKET;
+    }
+
+}// OrionCommSubscriberClose
+
+int OrionCommSubscriberReceive(OrionCommSubscriber_t *pSub, OrionPkt_t *pPkts, int Max, int Timeout)
+{
+    int Count = 0;
+
+    while (Count < Max)
+    {
+        const UInt8 *pData;
+        UInt32 Size;
+
+        // Once every datagram in the batch has been read, get another batch, only waiting if we've got nothing yet
+        if ((pSub->Datagram >= pSub->In.Count) && !ReceiveDatagrams(pSub, (Count == 0) ? Timeout : 0))
+            break;
+
+        // Check the header of a datagram before reading anything out of it
+        if ((pSub->Offset == 0) && !StartDatagram(pSub))
+        {
+            pSub->Datagram++;
+            continue;
+        }
+
+        pData = &pSub->In.Data[pSub->Datagram][pSub->Offset];
+        Size = pSub->In.Size[pSub->Datagram] - pSub->Offset;
+
+        // Frames were checked before they were published, so just make sure the next one is all there
+        if ((Size >= ORION_PKT_OVERHEAD) && (pData[0] == (ORION_SYNC >> 8)) && (pData[1] == (ORION_SYNC & 0xFF)) &&
+            ((UInt32)pData[3] + ORION_PKT_OVERHEAD <= Size))
+        {
+            memcpy(&pPkts[Count], pData, pData[3] + ORION_PKT_OVERHEAD);
+            pPkts[Count].Info.Time = pSub->Time;
+            pSub->Offset += pData[3] + ORION_PKT_OVERHEAD;
+            pSub->FramesReceived++;
+            Count++;
+        }
+        else
+        {
+            // Anything left over that isn't a frame means the datagram wasn't one of ours after all
+            if (Size > 0)
+                pSub->Invalid++;
+
+            // Move on to the next datagram
+            pSub->Datagram++;
+            pSub->Offset = 0;
+        }
+    }
+
+    // Tell the caller how many packets we got
+    return Count;
+
+}// OrionCommSubscriberReceive
+
+// Convert a dotted IPv4 address to host byte order, with NULL or an empty string meaning the default
+static BOOL ParseAddress(const char *pString, UInt32 Default, UInt32 *pAddress)
+{
+    if ((pString == NULL) || (pString[0] == 0))
+        *pAddress = Default;
+    else if (OrionCommIpStringValid(pString))
+        *pAddress = ntohl(inet_addr(pString));
+    else
+        return FALSE;
+
+    return TRUE;
+
+}// ParseAddress
+
+// Make a subscriber's or publisher's socket non-blocking
+static void SetNonBlocking(OrionCommSubscriber_t *pSub, OrionCommPublisher_t *pPub)
+{
+#ifdef _WIN32
+    u_long Arg = 1;
+
+    ioctlsocket((pSub != NULL) ? pSub->Socket : pPub->Socket, FIONBIO, &Arg);
+#else
+    fcntl((pSub != NULL) ? pSub->Socket : pPub->Socket, F_SETFL, O_NONBLOCK);
+#endif // _WIN32
+
+}// SetNonBlocking
+
+// Check the header of the datagram being read and keep track of the numbering, returns FALSE to skip it
+static BOOL StartDatagram(OrionCommSubscriber_t *pSub)
+{
+    const UInt8 *pData = pSub->In.Data[pSub->Datagram];
+    UInt32 Sequence, Session;
+    SInt32 Gap;
+
+    // Make sure this is one of ours
+    if ((pSub->In.Size[pSub->Datagram] < ORION_COMM_MULTICAST_HEADER) || (pData[0] != ORION_COMM_MULTICAST_MAGIC0) ||
+        (pData[1] != ORION_COMM_MULTICAST_MAGIC1) || (pData[2] != ORION_COMM_MULTICAST_VERSION))
+    {
+        pSub->Invalid++;
+        return FALSE;
+    }
+
+    Sequence = ((UInt32)pData[4] << 24) | ((UInt32)pData[5] << 16) | ((UInt32)pData[6] << 8) | pData[7];
+    Session = ((UInt32)pData[8] << 24) | ((UInt32)pData[9] << 16) | ((UInt32)pData[10] << 8) | pData[11];
+
+    // The first datagram sets the numbering, and so does the first one from a new session, however
+    //   close its numbering is to the old one's
+    if (!pSub->Started || (Session != pSub->Session))
+    {
+        if (pSub->Started)
+            pSub->Restarts++;
+
+        pSub->Expected = Sequence;
+        pSub->Session = Session;
+        pSub->Started = TRUE;
+    }
+
+    // Anything ahead of where we expected means frames went missing in between
+    Gap = (SInt32)(Sequence - pSub->Expected);
+
+    // A long way back means the publisher started over, and a little way back is a late or repeated datagram
+    if (Gap < -ORION_COMM_MULTICAST_RESTART)
+    {
+        pSub->Restarts++;
+        Gap = 0;
+    }
+    else if (Gap < 0)
+    {
+        pSub->Late++;
+        return FALSE;
+    }
+
+    pSub->FramesLost += Gap;
+    pSub->Expected = Sequence + pData[3];
+    pSub->Offset = ORION_COMM_MULTICAST_HEADER;
+    return TRUE;
+
+}// StartDatagram
+
+// Read a batch of datagrams after waiting up to Timeout milliseconds (or forever, if negative), returns FALSE if none came
+static BOOL ReceiveDatagrams(OrionCommSubscriber_t *pSub, int Timeout)
+{
+    OrionCommDatagrams_t *pIn = &pSub->In;
+
+    // Everything in the last batch has been read
+    pIn->Count = 0;
+    pSub->Datagram = 0;
+    pSub->Offset = 0;
+
+    if (pSub->Socket == INVALID_SOCKET)
+        return FALSE;
+
+    // Wait for something to show up if the caller is willing to
+    if (Timeout != 0)
+    {
+        struct timeval Wait = { Timeout / 1000, (Timeout % 1000) * 1000 };
+        fd_set Set;
+
+        FD_ZERO(&Set);
+        FD_SET(pSub->Socket, &Set);
+
+        if (select((int)pSub->Socket + 1, &Set, NULL, NULL, (Timeout < 0) ? NULL : &Wait) <= 0)
+            return FALSE;
+    }
+
+#ifdef __linux__
+    {
+        struct mmsghdr Msgs[ORION_COMM_MULTICAST_BATCH];
+        struct iovec Iov[ORION_COMM_MULTICAST_BATCH];
+        int i;
+
+        // Point every message at its own slot and pull as many as are waiting in one call
+        memset(Msgs, 0, sizeof(Msgs));
+        for (i = 0; i < ORION_COMM_MULTICAST_BATCH; i++)
+        {
+            Iov[i].iov_base = pIn->Data[i];
+            Iov[i].iov_len = ORION_COMM_MULTICAST_DATAGRAM;
+            Msgs[i].msg_hdr.msg_iov = &Iov[i];
+            Msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        if ((pIn->Count = recvmmsg(pSub->Socket, Msgs, ORION_COMM_MULTICAST_BATCH, MSG_DONTWAIT, NULL)) < 0)
+            pIn->Count = 0;
+
+        for (i = 0; i < pIn->Count; i++)
+            pIn->Size[i] = Msgs[i].msg_len;
+    }
+#else
+    {
+        int Bytes;
+
+        // No batched receive here, so drain the socket one datagram at a time
+        while ((pIn->Count < ORION_COMM_MULTICAST_BATCH) &&
+               ((Bytes = recv(pSub->Socket, (char *)pIn->Data[pIn->Count], ORION_COMM_MULTICAST_DATAGRAM, 0)) > 0))
+            pIn->Size[pIn->Count++] = (UInt32)Bytes;
+    }
+#endif // __linux__
+
+    // Every datagram in the batch gets the same arrival time, just like packets off a connection
+    pSub->Time = OrionCommStatsTime();
+    return pIn->Count > 0;
+
+}// ReceiveDatagrams
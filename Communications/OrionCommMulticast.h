@@ -0,0 +1,129 @@
+#ifndef ORIONCOMMMULTICAST_H
+#define ORIONCOMMMULTICAST_H
+
+#include "OrionComm.h"
+
+// Fan-out of the packets from one gimbal connection to any number of consumers over UDP multicast. One
+//   process holds the connection to the gimbal and relays every packet it receives through a publisher,
+//   which packs the Trillium frames into numbered datagrams and sends them to a multicast group. Consumers
+//   such as map displays, recorders and trackers each open a subscriber on the group and get the frames
+//   back ready to decode, with gaps in the numbering counted as lost frames. The gimbal link carries the
+//   same traffic no matter how many consumers there are.
+//
+// Each datagram starts with a 12 byte header: the magic bytes 'O' 'M', a version byte, the number of frames
+//   in the datagram, the big-endian sequence number of its first frame, and the big-endian session ID of
+//   the publisher. Every frame gets the next sequence number, so a consumer can tell exactly how many it
+//   missed. The session ID changes every time a publisher opens, so a consumer can tell a publisher that
+//   started its numbering over from a datagram that arrived late. Complete frames follow the header.
+
+// Default multicast group and port, the group being in the organization-local scope
+#define ORION_COMM_MULTICAST_GROUP      "239.255.87.49"
+#define ORION_COMM_MULTICAST_PORT       8749
+
+// Largest datagram, which keeps them from being fragmented on Ethernet, and the size of the header on each
+#define ORION_COMM_MULTICAST_DATAGRAM   1400
+#define ORION_COMM_MULTICAST_HEADER     12
+
+// Number of datagrams sent or received with a single system call
+#define ORION_COMM_MULTICAST_BATCH      16
+
+// Magic bytes and format version at the start of every datagram
+#define ORION_COMM_MULTICAST_MAGIC0     'O'
+#define ORION_COMM_MULTICAST_MAGIC1     'M'
+#define ORION_COMM_MULTICAST_VERSION    2
+
+// How far back a sequence number can be before it's taken to mean the publisher restarted, even if it
+//   kept its session ID
+#define ORION_COMM_MULTICAST_RESTART    1024
+
+//! Batch of datagrams on their way into or out of a socket
+typedef struct
+{
+    UInt8 Data[ORION_COMM_MULTICAST_BATCH][ORION_COMM_MULTICAST_DATAGRAM];
+    UInt32 Size[ORION_COMM_MULTICAST_BATCH];
+    int Count;
+
+} OrionCommDatagrams_t;
+
+//! Sends packets to a multicast group
+typedef struct OrionCommPublisher
+{
+#ifdef _WIN32
+    SOCKET Socket;
+#else
+    int Socket;
+#endif // _WIN32
+
+    //! Multicast group address in host byte order, and the port to send to
+    UInt32 Group;
+    UInt16 Port;
+
+    //! Datagrams waiting to be sent, the last of which may still have room for more frames
+    OrionCommDatagrams_t Out;
+
+    //! Sequence number for the next frame, and the session ID picked when the publisher opened
+    UInt32 Sequence;
+    UInt32 Session;
+
+    //! Frames and datagrams sent, and datagrams that the socket wouldn't take
+    UInt32 FramesSent;
+    UInt32 DatagramsSent;
+    UInt32 SendErrors;
+
+} OrionCommPublisher_t;
+
+//! Receives packets from a multicast group
+typedef struct
+{
+#ifdef _WIN32
+    SOCKET Socket;
+#else
+    int Socket;
+#endif // _WIN32
+
+    //! Last batch of datagrams received, the one being read, and where the next frame in it is
+    OrionCommDatagrams_t In;
+    int Datagram;
+    UInt32 Offset;
+
+    //! Host time in microseconds that the last batch arrived
+    UInt64 Time;
+
+    //! Sequence number the next datagram should start with and the publisher's session ID, which are
+    //!   only valid once one has arrived
+    UInt32 Expected;
+    UInt32 Session;
+    BOOL Started;
+
+    //! Frames received and known to be lost, datagrams that arrived late or twice, and datagrams that weren't ours
+    UInt32 FramesReceived;
+    UInt32 FramesLost;
+    UInt32 Late;
+    UInt32 Invalid;
+
+    //! Number of times the publisher's numbering started over, or a new publisher took over the group
+    UInt32 Restarts;
+
+} OrionCommSubscriber_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Publishing, e.g. by handing the publisher to OrionCommRelayEx() to send everything a connection receives
+BOOL OrionCommPublisherOpen(OrionCommPublisher_t *pPub, const char *pGroup, UInt16 Port, const char *pInterface, int Ttl);
+void OrionCommPublisherClose(OrionCommPublisher_t *pPub);
+BOOL OrionCommPublish(OrionCommPublisher_t *pPub, const OrionPkt_t *pPkt);
+BOOL OrionCommPublisherFlush(OrionCommPublisher_t *pPub);
+
+// Subscribing
+BOOL OrionCommSubscriberOpen(OrionCommSubscriber_t *pSub, const char *pGroup, UInt16 Port, const char *pInterface);
+void OrionCommSubscriberClose(OrionCommSubscriber_t *pSub);
+int OrionCommSubscriberReceive(OrionCommSubscriber_t *pSub, OrionPkt_t *pPkts, int Max, int Timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ORIONCOMMMULTICAST_H
@@ -0,0 +1,344 @@
+#include "OrionCommReliable.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <time.h>
+#endif // _WIN32
+
+static int KeyBytes(const OrionCommReliable_t *pXfer, const OrionPkt_t *pPkt);
+static UInt32 HashKey(const OrionPkt_t *pPkt, int Bytes);
+static int FindInFlight(const OrionCommReliable_t *pXfer, const OrionPkt_t *pPkt, UInt32 Key);
+static void Launch(OrionCommReliable_t *pXfer, int Index, UInt32 Now);
+static void Retire(OrionCommReliable_t *pXfer, int Slot, UInt8 State);
+static void UpdateTimeout(OrionCommReliable_t *pXfer, UInt32 Sample);
+
+UInt32 OrionCommReliableTime(void)
+{
+#ifdef _WIN32
+    // Wraps every 49 days, which is fine since only differences get used
+    return (UInt32)GetTickCount();
+#else
+    struct timespec Now;
+
+    // Use the monotonic clock so round trip times don't jump around with the wall clock
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return (UInt32)(Now.tv_sec * 1000 + Now.tv_nsec / 1000000);
+#endif // _WIN32
+
+}// OrionCommReliableTime
+
+void OrionCommReliableInit(OrionCommReliable_t *pXfer, int Window, int MaxRetries)
+{
+    int i;
+
+    // Start off with an empty transfer
+    memset(pXfer, 0, sizeof(*pXfer));
+
+    // Zero or negative settings get the defaults, and the window can't outgrow the in-flight list
+    pXfer->Window = (Window > 0) ? MIN(Window, ORION_COMM_RELIABLE_MAX_WINDOW) : ORION_COMM_RELIABLE_WINDOW;
+    pXfer->MaxRetries = (MaxRetries > 0) ? MaxRetries : ORION_COMM_RELIABLE_RETRIES;
+    pXfer->KeyBytes = ORION_COMM_RELIABLE_KEY_BYTES;
+    pXfer->LastID = ORION_PKT_PRIVATE_20;
+    pXfer->Timeout = ORION_COMM_RELIABLE_TIMEOUT;
+
+    // Every hash bucket starts out empty
+    for (i = 0; i < ORION_COMM_RELIABLE_HASH_SIZE; i++)
+        pXfer->Buckets[i] = -1;
+
+}// OrionCommReliableInit
+
+BOOL OrionCommReliableAdd(OrionCommReliable_t *pXfer, const OrionPkt_t *pPkt)
+{
+    OrionCommReliablePkt_t *pNode;
+
+    // Double the packet array whenever it fills up
+    if (pXfer->NumPkts == pXfer->MaxPkts)
+    {
+        int Max = (pXfer->MaxPkts > 0) ? pXfer->MaxPkts * 2 : 64;
+        OrionCommReliablePkt_t *pPkts = (OrionCommReliablePkt_t *)realloc(pXfer->pPkts, Max * sizeof(OrionCommReliablePkt_t));
+
+        if (pPkts == NULL)
+            return FALSE;
+
+        pXfer->pPkts = pPkts;
+        pXfer->MaxPkts = Max;
+    }
+
+    // Copy the packet into a new pending node at the end of the list
+    pNode = &pXfer->pPkts[pXfer->NumPkts++];
+    memset(pNode, 0, sizeof(*pNode));
+    pNode->Pkt = *pPkt;
+    pNode->State = ORION_COMM_RELIABLE_PENDING;
+    pNode->NextHash = -1;
+
+    // Keep count of the packets that have to wait for everything else
+    if (pPkt->ID == pXfer->LastID)
+        pXfer->NumLast++;
+
+    return TRUE;
+
+}// OrionCommReliableAdd
+
+void OrionCommReliableFree(OrionCommReliable_t *pXfer)
+{
+    // Free the packet array and leave an empty transfer behind
+    free(pXfer->pPkts);
+    OrionCommReliableInit(pXfer, pXfer->Window, pXfer->MaxRetries);
+
+}// OrionCommReliableFree
+
+int OrionCommReliableSend(OrionCommReliable_t *pXfer, OrionCommContext_t *pContext, UInt32 Now)
+{
+    int i, Count = 0;
+
+    // Go through the packets in flight, walking backwards since retiring one moves the last one into its slot
+    for (i = pXfer->NumInFlight - 1; i >= 0; i--)
+    {
+        OrionCommReliablePkt_t *pNode = &pXfer->pPkts[pXfer->InFlight[i]];
+
+        // Nothing to do for packets that still have time left
+        if ((SInt32)(Now - pNode->SendTime) < (SInt32)pNode->Timeout)
+            continue;
+
+        // Give up on packets that have been sent as many times as they're allowed
+        if (pNode->Sends >= pXfer->MaxRetries)
+            Retire(pXfer, i, ORION_COMM_RELIABLE_FAILED);
+        else
+        {
+            // Otherwise send it again, backing off its timeout in case the link is just slow
+            OrionCommQueueEx(pContext, &pNode->Pkt);
+            pNode->SendTime = Now;
+            pNode->Timeout = MIN(pNode->Timeout * 2, ORION_COMM_RELIABLE_MAX_TIMEOUT);
+            pNode->Sends++;
+            pXfer->Resent++;
+            Count++;
+        }
+    }
+
+    // Skip over the packets at the front that have already gone out
+    while ((pXfer->First < pXfer->NumPkts) && (pXfer->pPkts[pXfer->First].State != ORION_COMM_RELIABLE_PENDING))
+        pXfer->First++;
+
+    // Now fill up the window with packets that haven't been sent yet, in order
+    for (i = pXfer->First; (i < pXfer->NumPkts) && (pXfer->NumInFlight < pXfer->Window); i++)
+    {
+        OrionCommReliablePkt_t *pNode = &pXfer->pPkts[i];
+
+        if (pNode->State != ORION_COMM_RELIABLE_PENDING)
+            continue;
+
+        // Packets with the last ID go out one at a time, and only once every other packet is finished
+        if (pNode->Pkt.ID == pXfer->LastID)
+        {
+            if ((pXfer->NumInFlight > 0) || (pXfer->NumDone + pXfer->NumFailed + pXfer->NumLast < pXfer->NumPkts))
+                continue;
+        }
+        // Hold back packets that look just like one in flight, since there'd be no telling their responses apart
+        else
+        {
+            pNode->Key = HashKey(&pNode->Pkt, KeyBytes(pXfer, &pNode->Pkt));
+
+            if (FindInFlight(pXfer, &pNode->Pkt, pNode->Key) >= 0)
+                continue;
+        }
+
+        // Send it off
+        OrionCommQueueEx(pContext, &pNode->Pkt);
+        Launch(pXfer, i, Now);
+        Count++;
+    }
+
+    // Push everything out in as few writes as possible
+    if (Count > 0)
+        OrionCommFlushEx(pContext);
+
+    // Tell the caller how many packets went out
+    return Count;
+
+}// OrionCommReliableSend
+
+BOOL OrionCommReliableAck(OrionCommReliable_t *pXfer, const OrionPkt_t *pPkt, UInt32 Now)
+{
+    int i, Index = FindInFlight(pXfer, pPkt, HashKey(pPkt, KeyBytes(pXfer, pPkt)));
+    OrionCommReliablePkt_t *pNode;
+
+    // This isn't a response to anything we're waiting on
+    if (Index < 0)
+        return FALSE;
+
+    pNode = &pXfer->pPkts[Index];
+
+    // Only packets that were sent once give a round trip time, since a re-sent one could be answering any of its sends
+    if (pNode->Sends == 1)
+    {
+        UpdateTimeout(pXfer, Now - pNode->SendTime);
+        OrionCommStatsLatency(pXfer->pStats, (Now - pNode->SendTime) * 1000);
+    }
+
+    // Find its slot in the in-flight list and retire it
+    for (i = 0; i < pXfer->NumInFlight; i++)
+    {
+        if (pXfer->InFlight[i] == Index)
+        {
+            Retire(pXfer, i, ORION_COMM_RELIABLE_DONE);
+            break;
+        }
+    }
+
+    return TRUE;
+
+}// OrionCommReliableAck
+
+int OrionCommReliableWait(const OrionCommReliable_t *pXfer, UInt32 Now)
+{
+    int i, Wait = -1;
+
+    // If nothing is in flight, either we're done or the next send has work to do right away
+    if (pXfer->NumInFlight == 0)
+        return 0;
+
+    // Otherwise wait for the first packet to time out
+    for (i = 0; i < pXfer->NumInFlight; i++)
+    {
+        const OrionCommReliablePkt_t *pNode = &pXfer->pPkts[pXfer->InFlight[i]];
+        int Left = (int)pNode->Timeout - (SInt32)(Now - pNode->SendTime);
+
+        if ((Wait < 0) || (Left < Wait))
+            Wait = MAX(Left, 0);
+    }
+
+    return Wait;
+
+}// OrionCommReliableWait
+
+BOOL OrionCommReliableDone(const OrionCommReliable_t *pXfer)
+{
+    // Every packet has either been acknowledged or given up on
+    return pXfer->NumDone + pXfer->NumFailed == pXfer->NumPkts;
+
+}// OrionCommReliableDone
+
+// Number of payload bytes that have to match between a packet and its response
+static int KeyBytes(const OrionCommReliable_t *pXfer, const OrionPkt_t *pPkt)
+{
+    return MAX(MIN(pXfer->KeyBytes, pPkt->Length), 0);
+
+}// KeyBytes
+
+// FNV-1a hash of the packet ID and the first few payload bytes
+static UInt32 HashKey(const OrionPkt_t *pPkt, int Bytes)
+{
+    UInt32 Hash = (2166136261u ^ pPkt->ID) * 16777619u;
+    int i;
+
+    for (i = 0; i < Bytes; i++)
+        Hash = (Hash ^ pPkt->Data[i]) * 16777619u;
+
+    return Hash;
+
+}// HashKey
+
+// Returns the index of the in-flight packet that pPkt would be a response to, or -1
+static int FindInFlight(const OrionCommReliable_t *pXfer, const OrionPkt_t *pPkt, UInt32 Key)
+{
+    int Index = pXfer->Buckets[Key & (ORION_COMM_RELIABLE_HASH_SIZE - 1)];
+    int Bytes = KeyBytes(pXfer, pPkt);
+
+    // Walk the bucket, checking the packets themselves in case different keys hash to the same thing
+    while (Index >= 0)
+    {
+        const OrionCommReliablePkt_t *pNode = &pXfer->pPkts[Index];
+
+        if ((pNode->Key == Key) && (pNode->Pkt.ID == pPkt->ID) && (KeyBytes(pXfer, &pNode->Pkt) == Bytes) &&
+            (memcmp(pNode->Pkt.Data, pPkt->Data, Bytes) == 0))
+            return Index;
+
+        Index = pNode->NextHash;
+    }
+
+    // If we make it here, pPkt [most likely] isn't a response to one of our packets
+    return -1;
+
+}// FindInFlight
+
+// Marks a packet as in flight after it's been sent for the first time
+static void Launch(OrionCommReliable_t *pXfer, int Index, UInt32 Now)
+{
+    OrionCommReliablePkt_t *pNode = &pXfer->pPkts[Index];
+    int Bucket;
+
+    // Last packets skip the duplicate check, so they won't have their key yet
+    pNode->Key = HashKey(&pNode->Pkt, KeyBytes(pXfer, &pNode->Pkt));
+    Bucket = pNode->Key & (ORION_COMM_RELIABLE_HASH_SIZE - 1);
+
+    // Start its clock at the current retransmit timeout
+    pNode->SendTime = Now;
+    pNode->Timeout = pXfer->Timeout;
+    pNode->Sends = 1;
+    pNode->State = ORION_COMM_RELIABLE_IN_FLIGHT;
+
+    // Add it to the in-flight list and the front of its hash bucket
+    pXfer->InFlight[pXfer->NumInFlight++] = Index;
+    pNode->NextHash = pXfer->Buckets[Bucket];
+    pXfer->Buckets[Bucket] = Index;
+
+    if (pNode->Pkt.ID == pXfer->LastID)
+        pXfer->NumLast--;
+
+    pXfer->Sent++;
+
+}// Launch
+
+// Takes the packet in an in-flight slot out of flight, marking it done or failed
+static void Retire(OrionCommReliable_t *pXfer, int Slot, UInt8 State)
+{
+    int Index = pXfer->InFlight[Slot];
+    OrionCommReliablePkt_t *pNode = &pXfer->pPkts[Index];
+    int *pLink = &pXfer->Buckets[pNode->Key & (ORION_COMM_RELIABLE_HASH_SIZE - 1)];
+
+    // Unlink it from its hash bucket
+    while (*pLink != Index)
+        pLink = &pXfer->pPkts[*pLink].NextHash;
+
+    *pLink = pNode->NextHash;
+    pNode->NextHash = -1;
+
+    // Fill its in-flight slot with the last one
+    pXfer->InFlight[Slot] = pXfer->InFlight[--pXfer->NumInFlight];
+
+    // Update its state and the totals
+    pNode->State = State;
+
+    if (State == ORION_COMM_RELIABLE_DONE)
+        pXfer->NumDone++;
+    else
+        pXfer->NumFailed++;
+
+}// Retire
+
+// Folds a round trip time measurement into the retransmit timeout, the same way TCP does (RFC 6298)
+static void UpdateTimeout(OrionCommReliable_t *pXfer, UInt32 Sample)
+{
+    float Timeout, Error;
+
+    // The first measurement sets the smoothed round trip time outright
+    if (pXfer->RoundTrip == 0)
+    {
+        pXfer->RoundTrip = (float)MAX(Sample, 1);
+        pXfer->Deviation = pXfer->RoundTrip / 2.0f;
+    }
+    // Later ones are averaged in, with the deviation updated first since it uses the old average
+    else
+    {
+        Error = pXfer->RoundTrip - (float)Sample;
+        pXfer->Deviation = 0.75f * pXfer->Deviation + 0.25f * ((Error < 0) ? -Error : Error);
+        pXfer->RoundTrip = 0.875f * pXfer->RoundTrip + 0.125f * (float)Sample;
+    }
+
+    // Leave room for four deviations on top of the average, within sensible bounds
+    Timeout = pXfer->RoundTrip + 4.0f * pXfer->Deviation;
+    pXfer->Timeout = (UInt32)MAX(MIN(Timeout, ORION_COMM_RELIABLE_MAX_TIMEOUT), ORION_COMM_RELIABLE_MIN_TIMEOUT);
+
+}// UpdateTimeout
@@ -0,0 +1,129 @@
+#ifndef ORIONCOMMRELIABLE_H
+#define ORIONCOMMRELIABLE_H
+
+#include "OrionComm.h"
+
+// Reliable transfer of a list of packets that the gimbal acknowledges by echoing them back, e.g. the
+//   contents of a configuration file. Up to Window packets are in flight at once, and each response
+//   is matched to the packet it acknowledges through a hash of its ID and first KeyBytes payload bytes.
+//   Unacknowledged packets are sent again after a timeout that follows the measured round trip time,
+//   and are given up on after MaxRetries sends. Packets with the ID in LastID (ORION_PKT_PRIVATE_20
+//   by default) are held back until everything else has been acknowledged or has failed.
+//
+// The transfer doesn't own the connection or read from it. Call OrionCommReliableSend() to send and
+//   re-send packets, hand every received packet to OrionCommReliableAck(), and wait for at most
+//   OrionCommReliableWait() milliseconds in between, e.g. with OrionCommLoopRun().
+
+// Default and largest number of packets in flight at once
+#define ORION_COMM_RELIABLE_WINDOW      8
+#define ORION_COMM_RELIABLE_MAX_WINDOW  64
+
+// Default number of times a packet is sent before it's given up on
+#define ORION_COMM_RELIABLE_RETRIES     5
+
+// Default number of payload bytes, after the packet ID, that a response has to match
+#define ORION_COMM_RELIABLE_KEY_BYTES   1
+
+// Retransmit timeout before there are any round trip measurements, and the bounds it's kept within, in ms
+#define ORION_COMM_RELIABLE_TIMEOUT     500
+#define ORION_COMM_RELIABLE_MIN_TIMEOUT 20
+#define ORION_COMM_RELIABLE_MAX_TIMEOUT 4000
+
+// Number of hash buckets for matching responses, which must be a power of two
+#define ORION_COMM_RELIABLE_HASH_SIZE   128
+
+// Packet states
+#define ORION_COMM_RELIABLE_PENDING     0
+#define ORION_COMM_RELIABLE_IN_FLIGHT   1
+#define ORION_COMM_RELIABLE_DONE        2
+#define ORION_COMM_RELIABLE_FAILED      3
+
+//! One packet being transferred
+typedef struct
+{
+    //! The packet itself
+    OrionPkt_t Pkt;
+
+    //! Hash of the packet ID and key bytes
+    UInt32 Key;
+
+    //! Time the packet was last sent and how long to wait for a response to it, in ms
+    UInt32 SendTime;
+    UInt32 Timeout;
+
+    //! Number of times the packet has been sent
+    UInt8 Sends;
+
+    //! ORION_COMM_RELIABLE_PENDING, _IN_FLIGHT, _DONE or _FAILED
+    UInt8 State;
+
+    //! Next in-flight packet in the same hash bucket, or -1
+    int NextHash;
+
+} OrionCommReliablePkt_t;
+
+//! A transfer of a list of packets
+typedef struct
+{
+    //! Packets in the order they were added
+    OrionCommReliablePkt_t *pPkts;
+    int NumPkts;
+    int MaxPkts;
+
+    //! Settings, which can be changed at any time after OrionCommReliableInit()
+    int Window;
+    int MaxRetries;
+    int KeyBytes;
+    UInt8 LastID;
+
+    //! Indices of the packets in flight, and the first in-flight packet in each hash bucket
+    int InFlight[ORION_COMM_RELIABLE_MAX_WINDOW];
+    int NumInFlight;
+    int Buckets[ORION_COMM_RELIABLE_HASH_SIZE];
+
+    //! Index of the first packet that hasn't been sent yet, and the number of held back LastID packets
+    int First;
+    int NumLast;
+
+    //! Number of packets that have been acknowledged and that have failed
+    int NumDone;
+    int NumFailed;
+
+    //! Smoothed round trip time and its mean deviation, and the current retransmit timeout, in ms
+    float RoundTrip;
+    float Deviation;
+    UInt32 Timeout;
+
+    //! Total packets sent, and how many of those were re-sends
+    UInt32 Sent;
+    UInt32 Resent;
+
+    //! Link statistics to record round trip times in, e.g. the connection's, or NULL
+    OrionCommStats_t *pStats;
+
+} OrionCommReliable_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Monotonic millisecond clock that transfer times are measured with
+UInt32 OrionCommReliableTime(void);
+
+// Setting up and tearing down transfers
+void OrionCommReliableInit(OrionCommReliable_t *pXfer, int Window, int MaxRetries);
+BOOL OrionCommReliableAdd(OrionCommReliable_t *pXfer, const OrionPkt_t *pPkt);
+void OrionCommReliableFree(OrionCommReliable_t *pXfer);
+
+// Running transfers
+int OrionCommReliableSend(OrionCommReliable_t *pXfer, OrionCommContext_t *pContext, UInt32 Now);
+BOOL OrionCommReliableAck(OrionCommReliable_t *pXfer, const OrionPkt_t *pPkt, UInt32 Now);
+int OrionCommReliableWait(const OrionCommReliable_t *pXfer, UInt32 Now);
+BOOL OrionCommReliableDone(const OrionCommReliable_t *pXfer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ORIONCOMMRELIABLE_H
@@ -0,0 +1,277 @@
+#include "OrionCommShared.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif // _WIN32
+
+// Slots are spaced a whole number of cache lines apart, so writing one never disturbs readers of another
+#define SLOT_STRIDE ((sizeof(OrionCommSharedSlot_t) + 63) & ~63)
+
+// One slot per packet ID
+#define NUM_SLOTS 256
+
+// Memory ordering for the sequence numbers: loads that nothing after them can move ahead of, stores that
+//   nothing before them can move past, and fences for the slot contents in between
+#ifdef _MSC_VER
+static __inline UInt32 LoadAcquire(const volatile UInt32 *p) { UInt32 v = *p; MemoryBarrier(); return v; }
+static __inline void StoreRelease(volatile UInt32 *p, UInt32 v) { MemoryBarrier(); *p = v; }
+#define LoadRelaxed(p)      (*(const volatile UInt32 *)(p))
+#define StoreRelaxed(p, v)  (*(volatile UInt32 *)(p) = (v))
+#define FenceAcquire()      MemoryBarrier()
+#define FenceRelease()      MemoryBarrier()
+#else
+#define LoadAcquire(p)      __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define LoadRelaxed(p)      __atomic_load_n(p, __ATOMIC_RELAXED)
+#define StoreRelease(p, v)  __atomic_store_n(p, v, __ATOMIC_RELEASE)
+#define StoreRelaxed(p, v)  __atomic_store_n(p, v, __ATOMIC_RELAXED)
+#define FenceAcquire()      __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define FenceRelease()      __atomic_thread_fence(__ATOMIC_RELEASE)
+#endif // _MSC_VER
+
+static BOOL MapSegment(OrionCommShared_t *pShared, const char *pName, BOOL Writer);
+static OrionCommSharedSlot_t *GetSlot(const OrionCommShared_t *pShared, UInt8 ID);
+
+BOOL OrionCommSharedCreate(OrionCommShared_t *pShared, const char *pName)
+{
+    OrionCommSharedHeader_t *pHeader;
+    int i;
+
+    // Create the segment, or attach to the one a previous writer left behind
+    if (!MapSegment(pShared, pName, TRUE))
+        return FALSE;
+
+    pHeader = pShared->pHeader;
+
+    // A segment with the same layout keeps its contents, so readers still see the last values while we start up
+    if ((pHeader->Magic == ORION_COMM_SHARED_MAGIC) && (pHeader->Layout == ORION_COMM_SHARED_LAYOUT) &&
+        (pHeader->SlotSize == SLOT_STRIDE) && (pHeader->NumSlots == NUM_SLOTS))
+    {
+        // If the last writer died part way through a slot, close that slot off
+        for (i = 0; i < NUM_SLOTS; i++)
+        {
+            OrionCommSharedSlot_t *pSlot = GetSlot(pShared, (UInt8)i);
+
+            if (pSlot->Sequence & 1)
+                StoreRelease(&pSlot->Sequence, pSlot->Sequence + 1);
+        }
+    }
+    else
+    {
+        // Otherwise start from scratch, filling in the header before the magic number says it's ready
+        memset(pShared->pSlots, 0, NUM_SLOTS * SLOT_STRIDE);
+        pHeader->Layout = ORION_COMM_SHARED_LAYOUT;
+        pHeader->SlotSize = SLOT_STRIDE;
+        pHeader->NumSlots = NUM_SLOTS;
+        pHeader->Generation = 0;
+        StoreRelease(&pHeader->Magic, ORION_COMM_SHARED_MAGIC);
+    }
+
+    // Note which protocol we speak and that there's a new writer
+    strncpy(pHeader->Protocol, getOrionPublicVersion(), sizeof(pHeader->Protocol) - 1);
+    StoreRelease(&pHeader->Generation, pHeader->Generation + 1);
+    return TRUE;
+
+}// OrionCommSharedCreate
+
+BOOL OrionCommSharedOpen(OrionCommShared_t *pShared, const char *pName)
+{
+    const OrionCommSharedHeader_t *pHeader;
+    UInt32 Magic;
+
+    // Map the segment read-only
+    if (!MapSegment(pShared, pName, FALSE))
+        return FALSE;
+
+    pHeader = pShared->pHeader;
+    Magic = LoadAcquire(&pHeader->Magic);
+
+    // Make sure it's a store we understand, that all of its slots fit and that they're big enough for ours
+    if ((Magic != ORION_COMM_SHARED_MAGIC) || (pHeader->Layout != ORION_COMM_SHARED_LAYOUT) || (pHeader->NumSlots < NUM_SLOTS) ||
+        (pHeader->SlotSize < sizeof(OrionCommSharedSlot_t)) || (sizeof(*pHeader) + (UInt64)pHeader->NumSlots * pHeader->SlotSize > pShared->Size))
+    {
+        OrionCommSharedClose(pShared);
+        return FALSE;
+    }
+
+    // Slots are found with the writer's spacing, not ours
+    pShared->SlotSize = pHeader->SlotSize;
+    return TRUE;
+
+}// OrionCommSharedOpen
+
+void OrionCommSharedClose(OrionCommShared_t *pShared)
+{
+    // Nothing to do if it was never opened
+    if (pShared->pHeader == NULL)
+        return;
+
+    // Unmap the segment, which stays around with its last values for whoever opens it next
+#ifdef _WIN32
+    UnmapViewOfFile(pShared->pHeader);
+    CloseHandle(pShared->Mapping);
+#else
+    munmap(pShared->pHeader, pShared->Size);
+#endif // _WIN32
+
+    pShared->pHeader = NULL;
+    pShared->pSlots = NULL;
+
+}// OrionCommSharedClose
+
+void OrionCommSharedWrite(OrionCommShared_t *pShared, const OrionPkt_t *pPkt, UInt64 Time)
+{
+    OrionCommSharedSlot_t *pSlot;
+    UInt32 Sequence;
+
+    // Only the writer can write
+    if (!pShared->Writer)
+        return;
+
+    pSlot = GetSlot(pShared, pPkt->ID);
+    Sequence = pSlot->Sequence;
+
+    // Mark the slot as changing before touching its contents
+    StoreRelaxed(&pSlot->Sequence, Sequence + 1);
+    FenceRelease();
+
+    // Copy the packet in
+    pSlot->Time = Time;
+    memcpy(pSlot->Frame, pPkt, pPkt->Length + ORION_PKT_OVERHEAD);
+
+    // Then mark it as settled again, after the contents
+    StoreRelease(&pSlot->Sequence, Sequence + 2);
+
+}// OrionCommSharedWrite
+
+UInt32 OrionCommSharedSequence(const OrionCommShared_t *pShared, UInt8 ID)
+{
+    // Changes every time the slot is written, so a reader can skip copying packets it's already seen
+    return LoadAcquire(&GetSlot(pShared, ID)->Sequence);
+
+}// OrionCommSharedSequence
+
+BOOL OrionCommSharedRead(const OrionCommShared_t *pShared, UInt8 ID, OrionPkt_t *pPkt, UInt64 *pTime)
+{
+    const OrionCommSharedSlot_t *pSlot = GetSlot(pShared, ID);
+    UInt32 Before, After, Length;
+    UInt64 Time;
+    int i;
+
+    for (i = 0; i < ORION_COMM_SHARED_RETRIES; i++)
+    {
+        Before = LoadAcquire(&pSlot->Sequence);
+
+        // Nothing's ever been written here
+        if (Before == 0)
+            return FALSE;
+
+        // Try again if the writer is part way through
+        if (Before & 1)
+            continue;
+
+        // Copy everything out, taking the length only once in case it's changing
+        Time = pSlot->Time;
+        Length = MIN(pSlot->Frame[3], ORION_PKT_MAX_SIZE);
+        memcpy(pPkt, pSlot->Frame, Length + ORION_PKT_OVERHEAD);
+
+        // If the sequence number didn't move then nothing changed while we were copying
+        FenceAcquire();
+        After = LoadRelaxed(&pSlot->Sequence);
+
+        if (After == Before)
+        {
+            if (pTime != NULL)
+                *pTime = Time;
+
+            return TRUE;
+        }
+    }
+
+    // The writer never let go of the slot, so it probably died in the middle of writing it
+    return FALSE;
+
+}// OrionCommSharedRead
+
+// Create or open the shared memory segment, and map it for writing or just for reading
+static BOOL MapSegment(OrionCommShared_t *pShared, const char *pName, BOOL Writer)
+{
+    UInt32 Size = (UInt32)(sizeof(OrionCommSharedHeader_t) + NUM_SLOTS * SLOT_STRIDE);
+    char Path[128];
+    void *pMap;
+
+    memset(pShared, 0, sizeof(*pShared));
+
+#ifdef _WIN32
+    // Segments live in the session's namespace so every process in this login can see them
+    sprintf_s(Path, sizeof(Path), "Local\\%s", (pName != NULL) ? pName : ORION_COMM_SHARED_NAME);
+
+    if (Writer)
+        pShared->Mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, Size, Path);
+    else
+        pShared->Mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, Path);
+
+    if (pShared->Mapping == NULL)
+        return FALSE;
+
+    if ((pMap = MapViewOfFile(pShared->Mapping, Writer ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0)) == NULL)
+    {
+        CloseHandle(pShared->Mapping);
+        return FALSE;
+    }
+
+    // Readers can't ask how big the mapping is, but it's never smaller than the writer asked for
+    if (!Writer)
+    {
+        MEMORY_BASIC_INFORMATION Info;
+
+        VirtualQuery(pMap, &Info, sizeof(Info));
+        Size = (UInt32)Info.RegionSize;
+    }
+#else
+    struct stat Stat;
+    int Fd;
+
+    // POSIX shared memory names start with a slash
+    snprintf(Path, sizeof(Path), "/%s", (pName != NULL) ? pName : ORION_COMM_SHARED_NAME);
+
+    if ((Fd = shm_open(Path, Writer ? (O_RDWR | O_CREAT) : O_RDONLY, 0644)) < 0)
+        return FALSE;
+
+    // The writer sets the size, and readers map however big it is
+    if ((Writer && (ftruncate(Fd, Size) != 0)) || (fstat(Fd, &Stat) != 0) || (Stat.st_size < (off_t)sizeof(OrionCommSharedHeader_t)))
+    {
+        close(Fd);
+        return FALSE;
+    }
+
+    Size = (UInt32)Stat.st_size;
+    pMap = mmap(NULL, Size, Writer ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, Fd, 0);
+
+    // The mapping holds its own reference to the segment
+    close(Fd);
+
+    if (pMap == MAP_FAILED)
+        return FALSE;
+#endif // _WIN32
+
+    pShared->pHeader = (OrionCommSharedHeader_t *)pMap;
+    pShared->pSlots = (UInt8 *)pMap + sizeof(OrionCommSharedHeader_t);
+    pShared->SlotSize = SLOT_STRIDE;
+    pShared->Size = Size;
+    pShared->Writer = Writer;
+    return TRUE;
+
+}// MapSegment
+
+// Slot for a packet ID
+static OrionCommSharedSlot_t *GetSlot(const OrionCommShared_t *pShared, UInt8 ID)
+{
+    return (OrionCommSharedSlot_t *)&pShared->pSlots[(UInt32)ID * pShared->SlotSize];
+
+}// GetSlot
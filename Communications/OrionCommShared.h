@@ -0,0 +1,116 @@
+#ifndef ORIONCOMMSHARED_H
+#define ORIONCOMMSHARED_H
+
+#include "OrionComm.h"
+
+// Shared memory store of the latest packet of every ID, for processes that need the gimbal's current
+//   state but not every packet. One process (usually the one that owns the gimbal connection) writes to
+//   the store, e.g. by handing it to OrionCommShareEx(), and any number of processes read from it.
+//
+// Each packet ID has its own slot protected by a sequence lock: the writer makes the slot's sequence
+//   number odd, copies the packet in and then makes it even again, and a reader copies the slot out
+//   and tries again if the sequence number was odd or changed underneath it. Readers never block the
+//   writer or each other, and never make a system call. Slots hold packets as they came off the wire
+//   rather than decoded structures, so a reader built against a different protocol version decodes them
+//   with its own generated decode functions, which fill in defaults for fields it doesn't get and skip
+//   fields it doesn't know about.
+
+// Default name of the shared memory segment
+#define ORION_COMM_SHARED_NAME      "OrionTelemetry"
+
+// Identifies the segment, and the version of its layout, which only changes if the header or slots do
+#define ORION_COMM_SHARED_MAGIC     0x4D53524F
+#define ORION_COMM_SHARED_LAYOUT    1
+
+// Number of times a reader retries a slot that keeps changing before giving up
+#define ORION_COMM_SHARED_RETRIES   1000
+
+//! Header at the start of the segment
+typedef struct
+{
+    //! ORION_COMM_SHARED_MAGIC, written last so a half-made segment is never opened
+    UInt32 Magic;
+
+    //! ORION_COMM_SHARED_LAYOUT, and the size and number of the slots that follow the header
+    UInt16 Layout;
+    UInt16 SlotSize;
+    UInt32 NumSlots;
+
+    //! Incremented every time a writer takes over the segment
+    UInt32 Generation;
+
+    //! Protocol version the writer was built against, from getOrionPublicVersion()
+    char Protocol[16];
+
+    //! Pads the header out to a cache line
+    UInt8 Reserved[32];
+
+} OrionCommSharedHeader_t;
+
+//! Latest packet with one ID
+typedef struct
+{
+    //! Odd while the writer is changing the slot, and zero if it's never been written
+    UInt32 Sequence;
+    UInt32 Reserved;
+
+    //! Host time in microseconds that the packet was received
+    UInt64 Time;
+
+    //! The packet, from its sync bytes to its checksum
+    UInt8 Frame[ORION_PKT_MAX_SIZE + ORION_PKT_OVERHEAD];
+
+} OrionCommSharedSlot_t;
+
+//! A process's view of the store
+typedef struct OrionCommShared
+{
+    //! Mapped segment, and the size of each slot in it, which may be bigger than this build's
+    OrionCommSharedHeader_t *pHeader;
+    UInt8 *pSlots;
+    UInt32 SlotSize;
+    UInt32 Size;
+
+    //! TRUE if this process is the writer
+    BOOL Writer;
+
+#ifdef _WIN32
+    HANDLE Mapping;
+#endif // _WIN32
+
+} OrionCommShared_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Creating and opening the store, with NULL for the default name
+BOOL OrionCommSharedCreate(OrionCommShared_t *pShared, const char *pName);
+BOOL OrionCommSharedOpen(OrionCommShared_t *pShared, const char *pName);
+void OrionCommSharedClose(OrionCommShared_t *pShared);
+
+// Writing, which only one process should do
+void OrionCommSharedWrite(OrionCommShared_t *pShared, const OrionPkt_t *pPkt, UInt64 Time);
+
+// Reading
+UInt32 OrionCommSharedSequence(const OrionCommShared_t *pShared, UInt8 ID);
+BOOL OrionCommSharedRead(const OrionCommShared_t *pShared, UInt8 ID, OrionPkt_t *pPkt, UInt64 *pTime);
+
+#ifdef __cplusplus
+}
+#endif
+
+// Defines OrionCommSharedDecode<Name>(pShared, pUser, pTime), which reads the latest Name packet and
+//   decodes it with the generated decodeNamePacketStructure() into a Type, calling it directly so it
+//   keeps its own types. Use it once at file scope for each packet a reader wants decoded, e.g.
+//   ORION_COMM_SHARED_DECODER(OrionCameraState, OrionCameraState_t)
+#define ORION_COMM_SHARED_DECODER(Name, Type)                                                               \
+    static __inline BOOL OrionCommSharedDecode##Name(const OrionCommShared_t *pShared, Type *pUser, UInt64 *pTime) \
+    {                                                                                                       \
+        OrionPkt_t Pkt;                                                                                     \
+        return OrionCommSharedRead(pShared, get##Name##PacketID(), &Pkt, pTime) &&                          \
+               decode##Name##PacketStructure(&Pkt, pUser);                                                  \
+    }
+
+#endif // ORIONCOMMSHARED_H
@@ -0,0 +1,141 @@
+#include "OrionComm.h"
+#include "Atomics.h"
+
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif // _WIN32
+
+static int HistogramBucket(UInt32 Value);
+static void HistogramLoad(OrionCommHistogram_t *pDst, const OrionCommHistogram_t *pSrc);
+
+void OrionCommGetStatsEx(const OrionCommContext_t *pContext, OrionCommStats_t *pStats)
+{
+    const OrionCommStats_t *pSrc = &pContext->Stats;
+    int i;
+
+    // Load each counter whole, since the receive thread may be storing to it right now. The counters
+    //   can still be a packet or two apart from each other, but none of them can tear.
+    pStats->BytesRx = atomicLoadRelaxed32(&pSrc->BytesRx);
+    pStats->BytesTx = atomicLoadRelaxed32(&pSrc->BytesTx);
+    pStats->PacketsRx = atomicLoadRelaxed32(&pSrc->PacketsRx);
+    pStats->PacketsTx = atomicLoadRelaxed32(&pSrc->PacketsTx);
+    pStats->PacketBytesRx = atomicLoadRelaxed32(&pSrc->PacketBytesRx);
+    pStats->TxDropped = atomicLoadRelaxed32(&pSrc->TxDropped);
+    pStats->ChecksumErrors = atomicLoadRelaxed32(&pSrc->ChecksumErrors);
+    pStats->ResyncBytes = atomicLoadRelaxed32(&pSrc->ResyncBytes);
+    pStats->Jitter = atomicLoadRelaxed32(&pSrc->Jitter);
+    pStats->LastGap = atomicLoadRelaxed32(&pSrc->LastGap);
+    pStats->LastRxTime = atomicLoadRelaxed64(&pSrc->LastRxTime);
+
+    for (i = 0; i < 256; i++)
+        pStats->PacketsPerId[i] = atomicLoadRelaxed32(&pSrc->PacketsPerId[i]);
+
+    HistogramLoad(&pStats->InterArrival, &pSrc->InterArrival);
+    HistogramLoad(&pStats->Latency, &pSrc->Latency);
+
+}// OrionCommGetStatsEx
+
+UInt64 OrionCommStatsTime(void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER Frequency;
+    LARGE_INTEGER Count;
+
+    // The counter frequency is fixed at boot, so only look it up once
+    if (Frequency.QuadPart == 0)
+        QueryPerformanceFrequency(&Frequency);
+
+    QueryPerformanceCounter(&Count);
+    return (UInt64)(Count.QuadPart / Frequency.QuadPart) * 1000000 + (UInt64)(Count.QuadPart % Frequency.QuadPart) * 1000000 / Frequency.QuadPart;
+#else
+    struct timespec Now;
+
+    // The monotonic clock doesn't jump when the wall clock gets set, which would wreck the gaps
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return (UInt64)Now.tv_sec * 1000000 + Now.tv_nsec / 1000;
+#endif // _WIN32
+
+}// OrionCommStatsTime
+
+void OrionCommStatsLatency(OrionCommStats_t *pStats, UInt32 Microseconds)
+{
+    // Nothing to do if there's nowhere to put it
+    if (pStats != NULL)
+        OrionCommHistogramAdd(&pStats->Latency, Microseconds, 1);
+
+}// OrionCommStatsLatency
+
+void OrionCommHistogramAdd(OrionCommHistogram_t *pHistogram, UInt32 Value, UInt32 Count)
+{
+    UInt32 *pCount = &pHistogram->Count[HistogramBucket(Value)];
+
+    // Add Count samples of Value to the bucket it falls into, storing it whole for anyone taking a snapshot
+    atomicStoreRelaxed32(pCount, *pCount + Count);
+
+}// OrionCommHistogramAdd
+
+UInt32 OrionCommHistogramPercentile(const OrionCommHistogram_t *pHistogram, float Fraction)
+{
+    UInt64 Total = 0, Sum = 0;
+    int i;
+
+    // Add up every sample
+    for (i = 0; i < ORION_COMM_HISTOGRAM_SIZE; i++)
+        Total += pHistogram->Count[i];
+
+    // Walk up the buckets until we've passed the requested fraction of the samples
+    for (i = 0; i < ORION_COMM_HISTOGRAM_SIZE; i++)
+    {
+        Sum += pHistogram->Count[i];
+
+        // Return the top of the bucket, which the value is no more than
+        if ((Sum > 0) && (Sum >= Fraction * Total))
+            return (i < ORION_COMM_HISTOGRAM_SIZE - 1) ? (UInt32)((1ULL << i) - 1) : 0xFFFFFFFFu;
+    }
+
+    // An empty histogram has nothing to say
+    return 0;
+
+}// OrionCommHistogramPercentile
+
+// Bucket index for a value, which is the number of bits it takes up, with the last bucket catching everything bigger
+static int HistogramBucket(UInt32 Value)
+{
+    int Bits = 0;
+
+    if (Value == 0)
+        return 0;
+
+#if defined(__GNUC__)
+    Bits = 32 - __builtin_clz(Value);
+#elif defined(_MSC_VER)
+    {
+        unsigned long Index;
+        _BitScanReverse(&Index, Value);
+        Bits = (int)Index + 1;
+    }
+#else
+    while (Value != 0)
+    {
+        Value >>= 1;
+        Bits++;
+    }
+#endif
+
+    return MIN(Bits, ORION_COMM_HISTOGRAM_SIZE - 1);
+
+}// HistogramBucket
+
+static void HistogramLoad(OrionCommHistogram_t *pDst, const OrionCommHistogram_t *pSrc)
+{
+    int i;
+
+    // Same as the counters, one whole bucket at a time
+    for (i = 0; i < ORION_COMM_HISTOGRAM_SIZE; i++)
+        pDst->Count[i] = atomicLoadRelaxed32(&pSrc->Count[i]);
+
+}// HistogramLoad
@@ -6,16 +6,28 @@
 #include <stdio.h>
 #include <ws2tcpip.h>
 
-static HANDLE SerialHandle = INVALID_HANDLE_VALUE;
-static SOCKET TcpSocket = INVALID_SOCKET;
+static struct sockaddr *GetSockAddr(struct sockaddr_in *pSockAddr, uint32_t Address, unsigned short Port);
+static void PostLoopRead(OrionCommContext_t *pContext);
+static BOOL SerialIo(OrionCommContext_t *pContext, BOOL Write, void *pData, DWORD Size, DWORD *pBytes);
 
-static struct sockaddr *GetSockAddr(uint32_t Address, unsigned short Port);
-
-BOOL OrionCommOpenSerial(const char *pPath)
+BOOL OrionCommOpenSerialBaudEx(OrionCommContext_t *pContext, const char *pPath, UInt32 Baud)
 {
-	// Declare variables and structures
+    HANDLE SerialHandle;
+
+    // Close whatever this context already has open, so opening it again doesn't leak it
+    OrionCommCloseEx(pContext);
+
+    // Start off from a closed context: empty buffers, no capture, relay, store or serial event, a fresh clock
+    //   estimate and no network connection
+    memset(pContext, 0, sizeof(OrionCommContext_t));
+    OrionCommRxReset(&pContext->Rx);
+    OrionCommClockReset(&pContext->Clock);
+    pContext->TcpSocket = INVALID_SOCKET;
+    pContext->Address = 0;
+
+	// Open the port for overlapped I/O, so an event loop can wait on it along with its sockets
     SerialHandle = CreateFileA(pPath, GENERIC_READ | GENERIC_WRITE, 0, NULL,
-                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED, NULL);
 
     // If the handle is valid
     if (SerialHandle != INVALID_HANDLE_VALUE)
@@ -31,8 +43,8 @@ BOOL OrionCommOpenSerial(const char *pPath)
             SerialHandle = INVALID_HANDLE_VALUE;
         }
 
-        // Otherwise, fill in the fields we care about
-        Params.BaudRate = CBR_115200;
+        // Otherwise, fill in the fields we care about - drivers take any rate they can divide down to
+        Params.BaudRate = Baud;
         Params.ByteSize = 8;
         Params.StopBits = ONESTOPBIT;
         Params.Parity   = NOPARITY;
@@ -65,18 +77,35 @@ BOOL OrionCommOpenSerial(const char *pPath)
             CloseHandle(SerialHandle);
             SerialHandle = INVALID_HANDLE_VALUE;
         }
+
+        // Ask for driver buffers big enough to ride out a slow pass through the event loop at high baud rates
+        SetupComm(SerialHandle, ORION_COMM_RX_BUFFER_SIZE, ORION_COMM_TX_BUFFER_SIZE);
+
+        // Reads and writes all wait on the same event, and only one happens at a time
+        if ((pContext->SerialEvent = CreateEvent(NULL, TRUE, FALSE, NULL)) == NULL)
+        {
+            CloseHandle(SerialHandle);
+            SerialHandle = INVALID_HANDLE_VALUE;
+        }
     }
 
-    // Tell the user if this failed or, if not, which COM port they're trying to use
+    // Tell the user if this failed, dropping the event along with the port, or if not, which COM port they're trying to use
     if (SerialHandle == INVALID_HANDLE_VALUE)
-        printf("Failed to open %s\n", pPath);
+    {
+        if (pContext->SerialEvent != NULL)
+            CloseHandle(pContext->SerialEvent);
+
+        pContext->SerialEvent = NULL;
+        printf("Failed to open %s at %u baud\n", pPath, Baud);
+    }
     else
-        printf("Looking for gimbal on %s...\n", pPath);
+        printf("Looking for gimbal on %s at %u baud...\n", pPath, Baud);
 
-    // Return false
+    // Hang onto the handle and tell the caller whether it's valid
+    pContext->SerialHandle = SerialHandle;
     return SerialHandle != INVALID_HANDLE_VALUE;
 
-}// OrionCommOpenSerial
+}// OrionCommOpenSerialBaudEx
 
 BOOL OrionCommIpStringValid(const char *pAddress)
 {
@@ -97,209 +126,572 @@ BOOL OrionCommSerialPathValid(const char *pPath)
 
 }// OrionCommSerialPathValid
 
-BOOL OrionCommOpenNetworkIp(const char *pAddress)
+BOOL OrionCommOpenNetworkIpEx(OrionCommContext_t *pContext, const char *pAddress)
 {
-    // Open a new UDP socket for auto-discovery
-    WSADATA WsaData;
-    WSAStartup(MAKEWORD(2, 0), &WsaData);
-    SOCKET UdpHandle = socket(AF_INET, SOCK_DGRAM, 0);
-    uint32_t BroadcastAddr;
+    OrionCommGimbal_t Gimbal;
+    struct sockaddr_in SockAddr;
 
-    // If we were passed a valid IP string
-    if (OrionCommIpStringValid(pAddress) == TRUE)
+    // Start off with no connection, closing whatever this context already has open
+    OrionCommCloseEx(pContext);
+    pContext->Address = 0;
+
+    // Make sure the address is a valid IPv4 string before we go any further
+    if (OrionCommIpStringValid(pAddress) == FALSE)
+        return FALSE;
+
+    // Now print out the broadcast address we're pinging
+    printf("Looking for gimbal on %s...\n", pAddress);
+
+    // Take the first gimbal that answers within the same 2 s window the old polling loop gave up after
+    if ((OrionCommDiscover(pAddress, 2000, &Gimbal, 1) == 1) && (OrionCommConnectAll(pContext, &Gimbal, 1, 2000) == 1))
     {
-        // Convert the IP address string to a 32-bit IPv4 address value
-        BroadcastAddr = inet_addr(pAddress);
-
-        // Now print out the broadcast address we're pinging
-        printf("Looking for gimbal on %s...\n", inet_ntoa(((struct sockaddr_in *)GetSockAddr(BroadcastAddr, UDP_OUT_PORT))->sin_addr));
-        
-        // Roll the bytes for our GetSockAddr function
-        BroadcastAddr = ntohl(BroadcastAddr);
+        // Now print out the IP address that we connected to
+        printf("Connected to %s\n", inet_ntoa(((struct sockaddr_in *)GetSockAddr(&SockAddr, pContext->Address, TCP_PORT))->sin_addr));
     }
     else
     {
-        // Close the discovery handle and return a failure
-		if (UdpHandle != INVALID_SOCKET)
-          close(UdpHandle);
-
-        return FALSE;
+        // Let the user know we failed to connect
+        printf("Failed to connect to %s\n", pAddress);
     }
 
-    // If the socket looks good
-    if (UdpHandle != INVALID_SOCKET)
-    {
-        BOOL Broadcast = TRUE;
-        int WaitCount = 0;
-        char Buffer[64];
-        OrionPkt_t Pkt;
-        u_long Arg = 1;
+    // Return a possibly valid handle to this socket
+    return pContext->TcpSocket != INVALID_SOCKET;
 
-        // Bind to the proper port to get responses from the gimbal
-        bind(UdpHandle, GetSockAddr(INADDR_ANY, UDP_IN_PORT), sizeof(struct sockaddr_in));
+}// OrionCommOpenNetworkIpEx
 
-        // Make this socket non blocking
-        ioctlsocket(UdpHandle, FIONBIO, &Arg);
+int OrionCommDiscover(const char *pAddress, int Timeout, OrionCommGimbal_t *pGimbals, int Max)
+{
+    WSADATA WsaData;
+    uint32_t BroadcastAddr;
+    struct sockaddr_in SockAddr;
+    BOOL Broadcast = TRUE;
+    u_long Arg = 1;
+    DWORD Start;
+    SOCKET UdpHandle;
+    int Elapsed, NextPing = 0, Count = 0;
+    OrionPkt_t Pkt;
+
+    // Make sure the address is a valid IPv4 string and there's somewhere to put the answers
+    if ((OrionCommIpStringValid(pAddress) == FALSE) || (Max <= 0))
+        return 0;
+
+    // Convert the IP address string to a 32-bit IPv4 address value, then roll the bytes for GetSockAddr
+    BroadcastAddr = ntohl(inet_addr(pAddress));
+
+    // Open a new UDP socket for auto-discovery
+    WSAStartup(MAKEWORD(2, 0), &WsaData);
+    if ((UdpHandle = socket(AF_INET, SOCK_DGRAM, 0)) == INVALID_SOCKET)
+        return 0;
+
+    // Bind to the proper port to get responses from the gimbal
+    bind(UdpHandle, GetSockAddr(&SockAddr, INADDR_ANY, UDP_IN_PORT), sizeof(struct sockaddr_in));
+
+    // Make this socket non blocking
+    ioctlsocket(UdpHandle, FIONBIO, &Arg);
+
+    // Allow the socket to send packets to the broadcast address
+    setsockopt(UdpHandle, SOL_SOCKET, SO_BROADCAST, (char *)&Broadcast, sizeof(BOOL));
+
+    // Build a version request packet (note that it doesn't matter what you send...)
+    MakeOrionPacket(&Pkt, ORION_PKT_CROWN_VERSION, 0);
+
+    // Run until the deadline, or until we've got as many gimbals as the caller has room for
+    Start = GetTickCount();
+    while ((Count < Max) && ((Elapsed = (int)(GetTickCount() - Start)) < Timeout))
+    {
+        struct timeval Wait;
+        fd_set Set;
+        int Next;
+
+        // Ping the network, and again every so often in case a datagram got dropped along the way
+        if (Elapsed >= NextPing)
+        {
+            sendto(UdpHandle, (char *)&Pkt, Pkt.Length + ORION_PKT_OVERHEAD, 0, GetSockAddr(&SockAddr, BroadcastAddr, UDP_OUT_PORT), sizeof(struct sockaddr_in));
+            NextPing = Elapsed + ORION_COMM_DISCOVER_PING_MS;
+        }
 
-        // Allow the socket to send packets to the broadcast address
-        setsockopt(UdpHandle, SOL_SOCKET, SO_BROADCAST, (char *)&Broadcast, sizeof(BOOL));
+        // Sleep until a reply shows up, it's time to ping again or we run out of time
+        Next = (NextPing < Timeout) ? NextPing : Timeout;
+        Wait.tv_sec = (Next - Elapsed) / 1000;
+        Wait.tv_usec = ((Next - Elapsed) % 1000) * 1000;
+        FD_ZERO(&Set);
+        FD_SET(UdpHandle, &Set);
 
-        // Build a version request packet (note that it doesn't matter what you send...)
-        MakeOrionPacket(&Pkt, ORION_PKT_CROWN_VERSION, 0);
+        // Nothing yet, go back around and check the clock
+        if (select(0, &Set, NULL, NULL, &Wait) <= 0)
+            continue;
 
-        // Wait for up to 20 iterations
-        while (WaitCount++ < 20)
+        // Drain every reply that's waiting on the socket
+        while (Count < Max)
         {
             int Size = sizeof(struct sockaddr_in);
+            OrionPkt_t Reply;
+            int Bytes, i;
 
-            // Send a version request packet
-            sendto(UdpHandle, (char *)&Pkt, Pkt.Length + ORION_PKT_OVERHEAD, 0, GetSockAddr(BroadcastAddr, UDP_OUT_PORT), sizeof(struct sockaddr_in));
+            // Stop once the socket runs dry
+            if ((Bytes = recvfrom(UdpHandle, (char *)&Reply, sizeof(Reply), 0, (struct sockaddr *)&SockAddr, &Size)) <= 0)
+                break;
+
+            // Pull the gimbal's IP address from the datagram header and skip gimbals we've already heard from
+            pGimbals[Count].Address = ntohl(SockAddr.sin_addr.s_addr);
+            for (i = 0; (i < Count) && (pGimbals[i].Address != pGimbals[Count].Address); i++);
 
-            // If we get data back forom the gimbal
-            if (recvfrom(UdpHandle, Buffer, 64, 0, GetSockAddr(INADDR_ANY, UDP_IN_PORT), &Size) > 0)
+            // New gimbal: the reply should be a crown version packet, but hold onto the address even if it isn't
+            if (i == Count)
             {
-                // Pull the gimbal's IP address from the datagram header
-                UInt32 Address = ntohl(((struct sockaddr_in *)GetSockAddr(0, 0))->sin_addr.s_addr);
+                memset(&pGimbals[Count].Version, 0, sizeof(OrionCrownVersion_t));
+                pGimbals[Count].VersionValid = (Bytes >= ORION_PKT_OVERHEAD) && (Bytes >= Reply.Length + ORION_PKT_OVERHEAD) &&
+                                               decodeOrionCrownVersionPacketStructure(&Reply, &pGimbals[Count].Version);
+                Count++;
+            }
+        }
+    }
 
-                // Open a file descriptor for the TCP comm socket
-                TcpSocket = socket(AF_INET, SOCK_STREAM, 0);
+    // Close the UDP socket now that we're done with it
+    closesocket(UdpHandle);
 
-                // Bind to the right incoming port
-                bind(TcpSocket, GetSockAddr(INADDR_ANY, TCP_PORT), sizeof(struct sockaddr_in));
+    // Tell the caller how many gimbals answered
+    return Count;
 
-                // Connect to the gimbal's server socket (note this is a blocking call)
-                connect(TcpSocket, GetSockAddr(Address, TCP_PORT), sizeof(struct sockaddr_in));
+}// OrionCommDiscover
 
-                // Now make the socket non-blocking for future reads/writes
-                ioctlsocket(TcpSocket, FIONBIO, &Arg);
+int OrionCommConnectAll(OrionCommContext_t *pContexts, const OrionCommGimbal_t *pGimbals, int Count, int Timeout)
+{
+    BOOL Pending[ORION_COMM_LOOP_MAX_CONTEXTS];
+    struct sockaddr_in SockAddr;
+    WSADATA WsaData;
+    DWORD Start;
+    int i, Elapsed, NumPending = 0, Connected = 0;
 
-                // Now print out the IP address that we connected to and break out of the loop
-                printf("Connected to %s\n", inet_ntoa(((struct sockaddr_in *)GetSockAddr(0, 0))->sin_addr));
-                break;
-            }
+    // We only select on a fixed number of sockets at once
+    if (Count > ORION_COMM_LOOP_MAX_CONTEXTS)
+        Count = ORION_COMM_LOOP_MAX_CONTEXTS;
 
-            // Sleep for 1/10th of a second
-            Sleep(100);
+    // Kick off every connection before waiting on any of them
+    WSAStartup(MAKEWORD(2, 0), &WsaData);
+    for (i = 0; i < Count; i++)
+    {
+        OrionCommContext_t *pContext = &pContexts[i];
+        BOOL Reuse = TRUE;
+        u_long Arg = 1;
+
+        // Start off from a closed context: no connection or serial event, empty buffers, no capture, relay or store
+        //   and a fresh clock estimate, closing whatever it already had open first so it doesn't leak
+        OrionCommCloseEx(pContext);
+        memset(pContext, 0, sizeof(OrionCommContext_t));
+        pContext->SerialHandle = INVALID_HANDLE_VALUE;
+        pContext->TcpSocket = INVALID_SOCKET;
+        pContext->Address = pGimbals[i].Address;
+        OrionCommRxReset(&pContext->Rx);
+        OrionCommClockReset(&pContext->Clock);
+        Pending[i] = FALSE;
+
+        // Open a socket for the TCP comm link
+        if ((pContext->TcpSocket = socket(AF_INET, SOCK_STREAM, 0)) == INVALID_SOCKET)
+            continue;
+
+        // Bind to the right incoming port, sharing it between sockets - if that fails we just get an ephemeral port
+        setsockopt(pContext->TcpSocket, SOL_SOCKET, SO_REUSEADDR, (char *)&Reuse, sizeof(BOOL));
+        bind(pContext->TcpSocket, GetSockAddr(&SockAddr, INADDR_ANY, TCP_PORT), sizeof(struct sockaddr_in));
+
+        // Make the socket non-blocking before connecting, so the connect doesn't hold everyone else up
+        ioctlsocket(pContext->TcpSocket, FIONBIO, &Arg);
+
+        // Connect to the gimbal's server socket, which will almost always finish later
+        if (connect(pContext->TcpSocket, GetSockAddr(&SockAddr, pContext->Address, TCP_PORT), sizeof(struct sockaddr_in)) == 0)
+            continue;
+        else if (WSAGetLastError() == WSAEWOULDBLOCK)
+            Pending[i] = TRUE, NumPending++;
+        else
+            OrionCommCloseEx(pContext);
+    }
+
+    // Wait for the handshakes to finish, all in parallel
+    Start = GetTickCount();
+    while ((NumPending > 0) && ((Elapsed = (int)(GetTickCount() - Start)) < Timeout))
+    {
+        struct timeval Wait = { (Timeout - Elapsed) / 1000, ((Timeout - Elapsed) % 1000) * 1000 };
+        fd_set Done, Failed;
+
+        // Windows reports a finished connect as writable and a failed one as an exception
+        FD_ZERO(&Done);
+        FD_ZERO(&Failed);
+        for (i = 0; i < Count; i++)
+        {
+            if (Pending[i])
+            {
+                FD_SET(pContexts[i].TcpSocket, &Done);
+                FD_SET(pContexts[i].TcpSocket, &Failed);
+            }
         }
 
-        // If we timed out waiting for a response, let the user know
-        if (WaitCount >= 20)
+        // Sleep until something connects or fails
+        if (select(0, NULL, &Done, &Failed, &Wait) <= 0)
+            continue;
+
+        // Any socket that's done no longer needs watching
+        for (i = 0; i < Count; i++)
         {
-            // Broadcast address byte roll, part one million
-            BroadcastAddr = htonl(BroadcastAddr);
+            if (Pending[i] && FD_ISSET(pContexts[i].TcpSocket, &Failed))
+                OrionCommCloseEx(&pContexts[i]);
 
-            // Let the user know we failed to connect
-            printf("Failed to connect to %s\n", inet_ntoa(((struct sockaddr_in *)GetSockAddr(BroadcastAddr, UDP_OUT_PORT))->sin_addr));
+            if (Pending[i] && (FD_ISSET(pContexts[i].TcpSocket, &Done) || (pContexts[i].TcpSocket == INVALID_SOCKET)))
+            {
+                Pending[i] = FALSE;
+                NumPending--;
+            }
         }
+    }
+
+    // Now sort out which connections made it
+    for (i = 0; i < Count; i++)
+    {
+        OrionCommContext_t *pContext = &pContexts[i];
+
+        // Never got started, failed, or still pending at the deadline
+        if (Pending[i])
+            OrionCommCloseEx(pContext);
 
-        // Close the UDP socket now that we're done with it
-        closesocket(UdpHandle);
+        if (pContext->TcpSocket == INVALID_SOCKET)
+            continue;
+
+        // Batching is up to OrionCommQueue, so don't let Nagle hold up small sends by default
+        OrionCommSetNoDelayEx(pContext, TRUE);
+        Connected++;
     }
 
-    // Return a possibly valid handle to this socket
-    return TcpSocket != INVALID_SOCKET;
+    // Tell the caller how many connections are up
+    return Connected;
 
-}// OrionCommOpenNetworkIp
+}// OrionCommConnectAll
 
-void OrionCommClose(void)
+void OrionCommCloseEx(OrionCommContext_t *pContext)
 {
-    // Easy enough, just close the file descriptor
-    CloseHandle(SerialHandle);
-    closesocket(TcpSocket);
+    // Close whichever handle is open
+    if (pContext->SerialHandle != INVALID_HANDLE_VALUE)
+        CloseHandle(pContext->SerialHandle);
+
+    if (pContext->TcpSocket != INVALID_SOCKET)
+        closesocket(pContext->TcpSocket);
+
+    if (pContext->SerialEvent != NULL)
+        CloseHandle(pContext->SerialEvent);
+
+    // Then invalidate both of them
+    pContext->SerialHandle = INVALID_HANDLE_VALUE;
+    pContext->TcpSocket = INVALID_SOCKET;
+    pContext->SerialEvent = NULL;
 
-}// OrionCommClose
+}// OrionCommCloseEx
 
-BOOL OrionCommSend(const OrionPkt_t *pPkt)
+BOOL OrionCommSetNoDelayEx(OrionCommContext_t *pContext, BOOL NoDelay)
 {
-    DWORD Bytes;
+    BOOL Flag = NoDelay;
 
-    // Write the packet, including header data, to the file descriptor
-    if (SerialHandle != INVALID_HANDLE_VALUE)
-        return WriteFile(SerialHandle, (char *)pPkt, pPkt->Length + ORION_PKT_OVERHEAD, &Bytes, NULL);
-    else
-        return send(TcpSocket, (char *)pPkt, pPkt->Length + ORION_PKT_OVERHEAD, 0) != SOCKET_ERROR;
+    // Serial ports don't have a Nagle algorithm to turn off
+    if (pContext->TcpSocket == INVALID_SOCKET)
+        return TRUE;
+
+    // Otherwise enable or disable TCP_NODELAY on the socket
+    return setsockopt(pContext->TcpSocket, IPPROTO_TCP, TCP_NODELAY, (char *)&Flag, sizeof(Flag)) == 0;
 
-}// OrionCommSend
+}// OrionCommSetNoDelayEx
 
-BOOL OrionCommReceive(OrionPkt_t *pPkt)
+BOOL OrionCommIsOpenEx(const OrionCommContext_t *pContext)
 {
-    static OrionPkt_t Pkt = { 0 };
-    UInt8 Byte;
+    // Return TRUE if one of the handles is valid
+    return (pContext->SerialHandle != INVALID_HANDLE_VALUE) || (pContext->TcpSocket != INVALID_SOCKET);
 
-    if (SerialHandle != INVALID_HANDLE_VALUE)
+}// OrionCommIsOpenEx
+
+// Writes the send queue plus an optional packet with a single call, queueing up anything that
+//   doesn't make it out. Returns FALSE on a write error or if the leftovers won't fit.
+BOOL OrionCommTxWrite(OrionCommContext_t *pContext, const OrionPkt_t *pPkt)
+{
+    DWORD Bytes = 0;
+
+    if (pContext->SerialHandle != INVALID_HANDLE_VALUE)
+    {
+        // Serial writes only take one buffer, so stack the packet up behind the queued data
+        if ((pPkt != NULL) && !OrionCommTxAppend(&pContext->Tx, (const UInt8 *)pPkt, pPkt->Length + ORION_PKT_OVERHEAD))
+        {
+            // If there wasn't room, get the queue out of the way first
+            if (SerialIo(pContext, TRUE, pContext->Tx.Data, pContext->Tx.Size, &Bytes) == FALSE)
+                return FALSE;
+
+            // Now try again
+            if (!OrionCommTxWritten(&pContext->Tx, pPkt, Bytes))
+                return FALSE;
+
+            return OrionCommTxWrite(pContext, NULL);
+        }
+
+        // Write the whole queue out in one go
+        if ((pContext->Tx.Size > 0) && (SerialIo(pContext, TRUE, pContext->Tx.Data, pContext->Tx.Size, &Bytes) == FALSE))
+            return FALSE;
+
+        // Drop whatever got written and hang onto the rest
+        return OrionCommTxWritten(&pContext->Tx, NULL, Bytes);
+    }
+    else
     {
-        COMSTAT Status;
+        WSABUF Buffers[2];
+        DWORD Count = 0;
 
-        // As long as there are bytes to be read out of the receive queue
-        while (ClearCommError(SerialHandle, NULL, &Status) && (Status.cbInQue > 0))
+        // Queued data goes out first to keep everything in order
+        if (pContext->Tx.Size > 0)
         {
-            DWORD BytesRead = 0;
+            Buffers[Count].buf = (char *)pContext->Tx.Data;
+            Buffers[Count++].len = pContext->Tx.Size;
+        }
+
+        // Followed by the new packet, straight out of the caller's buffer
+        if (pPkt != NULL)
+        {
+            Buffers[Count].buf = (char *)pPkt;
+            Buffers[Count++].len = pPkt->Length + ORION_PKT_OVERHEAD;
+        }
 
-            // Read a byte
-            ReadFile(SerialHandle, &Byte, 1, &BytesRead, NULL);
+        // If there's nothing to do, we're done
+        if (Count == 0)
+            return TRUE;
 
-            // If this byte is the end of a valid packet
-            if ((BytesRead == 1) && (LookForOrionPacketInByte(&Pkt, Byte) == TRUE))
-            {
-                // Copy the packet into the passed-in location and return a success
-                *pPkt = Pkt;
-                return TRUE;
-            }
-            // Otherwise, if some sort of error occurred
-            else if (BytesRead != 1)
+        // A full socket buffer isn't an error, the data just waits in the queue until the next flush
+        if (WSASend(pContext->TcpSocket, Buffers, Count, &Bytes, 0, NULL, NULL) == SOCKET_ERROR)
+        {
+            if (WSAGetLastError() != WSAEWOULDBLOCK)
+                return FALSE;
+
+            Bytes = 0;
+        }
+
+        // Drop whatever got written and hang onto the rest
+        return OrionCommTxWritten(&pContext->Tx, pPkt, Bytes);
+    }
+
+}// OrionCommTxWrite
+
+// Reads as much data as will fit into a context's receive ring buffer
+int OrionCommRxFill(OrionCommContext_t *pContext)
+{
+    UInt8 *pData[2];
+    UInt32 Size[2];
+    int i, Count, Total = 0;
+
+    // Get the free regions on either side of the ring's wrap point
+    Count = OrionCommRxGetFree(&pContext->Rx, pData, Size);
+
+    if (pContext->SerialHandle != INVALID_HANDLE_VALUE)
+    {
+        // For each free region in the ring
+        for (i = 0; i < Count; i++)
+        {
+            DWORD BytesRead = 0;
+
+            // Read whatever's queued up in one go - the port timeouts make this return immediately
+            if (SerialIo(pContext, FALSE, pData[i], Size[i], &BytesRead) == FALSE)
             {
-                // Close and invalidate the serial port
-                CloseHandle(SerialHandle);
-                SerialHandle = INVALID_HANDLE_VALUE;
+                // Close and invalidate the serial port on error
+                CloseHandle(pContext->SerialHandle);
+                pContext->SerialHandle = INVALID_HANDLE_VALUE;
+                break;
             }
+
+            Total += BytesRead;
+
+            // If this region didn't fill up, the receive queue is empty
+            if (BytesRead < Size[i])
+                break;
         }
     }
-    else
+    else if (Count > 0)
     {
-        // As long as we keep getting bytes, keep reading them in one by one
-        while (recv(TcpSocket, (char *)&Byte, 1, 0) == 1)
+        WSABUF Buffers[2];
+        DWORD BytesRead = 0, Flags = 0;
+
+        // Point a socket buffer at each free region
+        for (i = 0; i < Count; i++)
         {
-            // If this byte is the end of a valid packet
-            if (LookForOrionPacketInByte(&Pkt, Byte))
+            Buffers[i].buf = (char *)pData[i];
+            Buffers[i].len = Size[i];
+        }
+
+        // Read whatever's available in a single call - the socket is non-blocking
+        if (WSARecv(pContext->TcpSocket, Buffers, Count, &BytesRead, &Flags, NULL, NULL) != SOCKET_ERROR)
+        {
+            Total = BytesRead;
+
+            // A successful zero-byte read means the gimbal closed the connection
+            if (BytesRead == 0)
             {
-                // Copy the packet into the passed-in location and return a success
-                *pPkt = Pkt;
-                return TRUE;
+                closesocket(pContext->TcpSocket);
+                pContext->TcpSocket = INVALID_SOCKET;
             }
         }
     }
 
-    // Nope, no packets yet
-    return FALSE;
+    // Move the ring's write index up past the new data
+    OrionCommRxCommit(&pContext->Rx, Total);
+    return Total;
 
-}// OrionCommReceive
+}// OrionCommRxFill
 
-BOOL OrionCommIsOpen(void)
+BOOL OrionCommLoopInit(OrionCommLoop_t *pLoop)
 {
-    // Return TRUE if one of the handles is valid
-    return (SerialHandle != INVALID_HANDLE_VALUE) || (TcpSocket != INVALID_SOCKET);
+    // Start off with no handlers and no connections
+    memset(pLoop, 0, sizeof(*pLoop));
+
+    // Create the completion port that socket reads will be queued on
+    pLoop->Port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, 1);
+
+    // Return TRUE if we got a valid port
+    return pLoop->Port != NULL;
 
-}// OrionCommIsOpen
+}// OrionCommLoopInit
 
-// Quickly and easily constructs a sockaddr pointer for a bunch of different functions.
-//   Call this function with Address == Port == 0 to access the pointer, or pass in
-//   actual values to construct a new sockaddr.
-static struct sockaddr *GetSockAddr(uint32_t Address, unsigned short Port)
+void OrionCommLoopFree(OrionCommLoop_t *pLoop)
 {
-    static struct sockaddr_in SockAddr;
+    // Close the completion port, but leave the connections open
+    if (pLoop->Port != NULL)
+        CloseHandle(pLoop->Port);
+
+    pLoop->Port = NULL;
+    pLoop->NumContexts = 0;
+
+}// OrionCommLoopFree
 
-    // If address and port are both zero, don't modify the structure
-    if (Address || Port)
+BOOL OrionCommLoopWatch(OrionCommLoop_t *pLoop, OrionCommContext_t *pContext)
+{
+    HANDLE Handle = (pContext->TcpSocket != INVALID_SOCKET) ? (HANDLE)pContext->TcpSocket : pContext->SerialHandle;
+
+    // Serial ports wake the loop up whenever a byte comes in
+    if ((pContext->TcpSocket == INVALID_SOCKET) && (SetCommMask(pContext->SerialHandle, EV_RXCHAR) == FALSE))
+        return FALSE;
+
+    // Associate the socket or port with the completion port, keyed by the connection pointer
+    pContext->RxPending = FALSE;
+    return CreateIoCompletionPort(Handle, pLoop->Port, (ULONG_PTR)pContext, 0) != NULL;
+
+}// OrionCommLoopWatch
+
+void OrionCommLoopUnwatch(OrionCommLoop_t *pLoop, OrionCommContext_t *pContext)
+{
+    // Cancel any outstanding read request or event wait - the completion that follows gets ignored
+    if ((pContext->TcpSocket != INVALID_SOCKET) && pContext->RxPending)
+        CancelIoEx((HANDLE)pContext->TcpSocket, &pContext->RxOverlapped);
+    else if ((pContext->SerialHandle != INVALID_HANDLE_VALUE) && pContext->RxPending)
+        CancelIoEx(pContext->SerialHandle, &pContext->RxOverlapped);
+
+}// OrionCommLoopUnwatch
+
+int OrionCommLoopRun(OrionCommLoop_t *pLoop, int Timeout)
+{
+    DWORD Wait = (Timeout < 0) ? INFINITE : (DWORD)Timeout;
+    int i, Total;
+
+    // Finish off anything that ran out of turns last time, and if there was any, don't wait for more
+    if ((Total = OrionCommLoopDispatchReady(pLoop)) > 0)
+        Wait = 0;
+
+    // Make sure every connection has a read request or event wait queued up so the port wakes us when data arrives
+    for (i = 0; i < pLoop->NumContexts; i++)
+    {
+        if (!pLoop->pContexts[i]->RxPending)
+            PostLoopRead(pLoop->pContexts[i]);
+    }
+
+    while (1)
+    {
+        OrionCommContext_t *pContext = NULL;
+        OVERLAPPED *pOverlapped = NULL;
+        DWORD Bytes;
+
+        // Wait for the first completion, then just collect whatever else has already finished
+        BOOL Result = GetQueuedCompletionStatus(pLoop->Port, &Bytes, (PULONG_PTR)&pContext, &pOverlapped, Wait);
+
+        // If nothing completed, we're done waiting
+        if (pOverlapped == NULL)
+            break;
+
+        // This connection's read request is no longer outstanding
+        pContext->RxPending = FALSE;
+        Wait = 0;
+
+        // Pull up to a turn's worth of packets off the connection and hand them out to the callbacks
+        Total += OrionCommLoopDispatch(pLoop, pContext);
+
+        // If the read failed or the gimbal went away, drop the connection so we don't keep waking up for it
+        if (((Result == FALSE) || !OrionCommIsOpenEx(pContext)) && OrionCommLoopRemove(pLoop, pContext))
+            OrionCommCloseEx(pContext);
+    }
+
+    // Tell the caller how many packets got dispatched
+    return Total;
+
+}// OrionCommLoopRun
+
+// Queues up a zero-byte overlapped read, which completes as soon as the socket has data, or a wait for a
+//   serial port's receive event, which completes as soon as a byte arrives or if one already has
+static void PostLoopRead(OrionCommContext_t *pContext)
+{
+    WSABUF Buffer = { 0, NULL };
+    DWORD Flags = 0;
+
+    // Start with a clean overlapped structure each time
+    memset(&pContext->RxOverlapped, 0, sizeof(pContext->RxOverlapped));
+
+    // The completion will get posted to the port whether this finishes now or later
+    if (pContext->TcpSocket != INVALID_SOCKET)
+    {
+        if ((WSARecv(pContext->TcpSocket, &Buffer, 1, NULL, &Flags, &pContext->RxOverlapped, NULL) == 0) ||
+            (WSAGetLastError() == WSA_IO_PENDING))
+            pContext->RxPending = TRUE;
+    }
+    else if (pContext->SerialHandle != INVALID_HANDLE_VALUE)
     {
-        // Otherwise, populate it with the requested IP address and port
-        memset(&SockAddr, 0, sizeof(SockAddr));
-        SockAddr.sin_family = AF_INET;
-        SockAddr.sin_addr.s_addr = htonl(Address);
-        SockAddr.sin_port = htons(Port);
+        if (WaitCommEvent(pContext->SerialHandle, &pContext->CommEvent, &pContext->RxOverlapped) ||
+            (GetLastError() == ERROR_IO_PENDING))
+            pContext->RxPending = TRUE;
     }
 
+}// PostLoopRead
+
+// Runs an overlapped read or write on a serial port to completion. Setting the low bit of the event
+//   handle keeps the completion off any event loop's completion port, since nothing there is waiting for it.
+static BOOL SerialIo(OrionCommContext_t *pContext, BOOL Write, void *pData, DWORD Size, DWORD *pBytes)
+{
+    OVERLAPPED Overlapped;
+    BOOL Result;
+
+    memset(&Overlapped, 0, sizeof(Overlapped));
+    Overlapped.hEvent = (HANDLE)((ULONG_PTR)pContext->SerialEvent | 1);
+    *pBytes = 0;
+
+    if (Write)
+        Result = WriteFile(pContext->SerialHandle, pData, Size, NULL, &Overlapped);
+    else
+        Result = ReadFile(pContext->SerialHandle, pData, Size, NULL, &Overlapped);
+
+    // Reads finish straight away with whatever the driver has, writes once it's taken all of the data
+    if ((Result == FALSE) && (GetLastError() != ERROR_IO_PENDING))
+        return FALSE;
+
+    return GetOverlappedResult(pContext->SerialHandle, &Overlapped, pBytes, TRUE);
+
+}// SerialIo
+
+// Quickly and easily fills in a caller-supplied sockaddr for a bunch of different functions,
+//   returning it as a generic sockaddr pointer.
+static struct sockaddr *GetSockAddr(struct sockaddr_in *pSockAddr, uint32_t Address, unsigned short Port)
+{
+    // Populate the structure with the requested IP address and port
+    memset(pSockAddr, 0, sizeof(*pSockAddr));
+    pSockAddr->sin_family = AF_INET;
+    pSockAddr->sin_addr.s_addr = htonl(Address);
+    pSockAddr->sin_port = htons(Port);
+
     // Return a casted pointer to the sockaddr_in structure
-    return (struct sockaddr *)&SockAddr;
+    return (struct sockaddr *)pSockAddr;
 
 }// GetSockAddr
 #endif // _WIN32
@@ -0,0 +1,268 @@
+// OrionPublicDispatch.c was generated by GenerateOrionDispatch.sh from OrionPublicPacket.h
+
+#include "OrionPublicDispatch.h"
+
+static int dispatchDecodeGeolocateTelemetryCore(const void *pPkt, void *pData)
+{
+    return decodeGeolocateTelemetryCorePacketStructure(pPkt, (GeolocateTelemetryCore_t *)pData);
+}
+
+static int dispatchDecodeOrionPerformance(const void *pPkt, void *pData)
+{
+    return decodeOrionPerformancePacketStructure(pPkt, (OrionPerformance_t *)pData);
+}
+
+static int dispatchDecodeOrionDiagnostics(const void *pPkt, void *pData)
+{
+    return decodeOrionDiagnosticsPacketStructure(pPkt, (OrionDiagnostics_t *)pData);
+}
+
+static int dispatchDecodeOrionFault(const void *pPkt, void *pData)
+{
+    return decodeOrionFaultPacketStructure(pPkt, (OrionFault_t *)pData);
+}
+
+static int dispatchDecodeOrionSoftwareDiagnostics(const void *pPkt, void *pData)
+{
+    return decodeOrionSoftwareDiagnosticsPacketStructure(pPkt, (OrionSoftwareDiagnostics_t *)pData);
+}
+
+static int dispatchDecodeOrionVibration(const void *pPkt, void *pData)
+{
+    return decodeOrionVibrationPacketStructure(pPkt, (OrionVibration_t *)pData);
+}
+
+static int dispatchDecodeNetworkDiagnostics(const void *pPkt, void *pData)
+{
+    return decodeNetworkDiagnosticsPacketStructure(pPkt, (NetworkDiagnostics_t *)pData);
+}
+
+static int dispatchDecodeStareStart(const void *pPkt, void *pData)
+{
+    return decodeStareStartPacketStructure(pPkt, (StareStart_t *)pData);
+}
+
+static int dispatchDecodeDebugString(const void *pPkt, void *pData)
+{
+    return decodeDebugStringPacketStructure(pPkt, (DebugString_t *)pData);
+}
+
+static int dispatchDecodeGpsData(const void *pPkt, void *pData)
+{
+    return decodeGpsDataPacketStructure(pPkt, (GpsData_t *)pData);
+}
+
+static int dispatchDecodeInsQuality(const void *pPkt, void *pData)
+{
+    return decodeInsQualityPacketStructure(pPkt, (InsQuality_t *)pData);
+}
+
+static int dispatchDecodeOrionStartupCmd(const void *pPkt, void *pData)
+{
+    return decodeOrionStartupCmdPacketStructure(pPkt, (OrionStartupCmd_t *)pData);
+}
+
+static int dispatchDecodeOrionPositions(const void *pPkt, void *pData)
+{
+    return decodeOrionPositionsPacketStructure(pPkt, (OrionPositions_t *)pData);
+}
+
+static int dispatchDecodeOrionPath(const void *pPkt, void *pData)
+{
+    return decodeOrionPathPacketStructure(pPkt, (OrionPath_t *)pData);
+}
+
+static int dispatchDecodeOrionCameraState(const void *pPkt, void *pData)
+{
+    return decodeOrionCameraStatePacketStructure(pPkt, (OrionCameraState_t *)pData);
+}
+
+static int dispatchDecodeOrionFlirSettings(const void *pPkt, void *pData)
+{
+    return decodeOrionFlirSettingsPacketStructure(pPkt, (OrionFlirSettings_t *)pData);
+}
+
+static int dispatchDecodeOrionAptinaSettings(const void *pPkt, void *pData)
+{
+    return decodeOrionAptinaSettingsPacketStructure(pPkt, (OrionAptinaSettings_t *)pData);
+}
+
+static int dispatchDecodeOrionZafiroSettings(const void *pPkt, void *pData)
+{
+    return decodeOrionZafiroSettingsPacketStructure(pPkt, (OrionZafiroSettings_t *)pData);
+}
+
+static int dispatchDecodeOrionHitachiSettings(const void *pPkt, void *pData)
+{
+    return decodeOrionHitachiSettingsPacketStructure(pPkt, (OrionHitachiSettings_t *)pData);
+}
+
+static int dispatchDecodeOrionSonySettings(const void *pPkt, void *pData)
+{
+    return decodeOrionSonySettingsPacketStructure(pPkt, (OrionSonySettings_t *)pData);
+}
+
+static int dispatchDecodeOrionKtncSettings(const void *pPkt, void *pData)
+{
+    return decodeOrionKtncSettingsPacketStructure(pPkt, (OrionKtncSettings_t *)pData);
+}
+
+static int dispatchDecodeOrionAttolloSettings(const void *pPkt, void *pData)
+{
+    return decodeOrionAttolloSettingsPacketStructure(pPkt, (OrionAttolloSettings_t *)pData);
+}
+
+static int dispatchDecodeOrionUserData(const void *pPkt, void *pData)
+{
+    return decodeOrionUserDataPacketStructure(pPkt, (OrionUserData_t *)pData);
+}
+
+static int dispatchDecodeOrionLaserCommand(const void *pPkt, void *pData)
+{
+    return decodeOrionLaserCommandPacketStructure(pPkt, (OrionLaserCommand_t *)pData);
+}
+
+static int dispatchDecodeOrionLaserStates(const void *pPkt, void *pData)
+{
+    return decodeOrionLaserStatesPacketStructure(pPkt, (OrionLaserStates_t *)pData);
+}
+
+static int dispatchDecodeOrionUartConfig(const void *pPkt, void *pData)
+{
+    return decodeOrionUartConfigPacketStructure(pPkt, (OrionUartConfig_t *)pData);
+}
+
+static int dispatchDecodeOrionLimitsData(const void *pPkt, void *pData)
+{
+    return decodeOrionLimitsDataPacketStructure(pPkt, (OrionLimitsData_t *)pData);
+}
+
+static int dispatchDecodeInsOptions(const void *pPkt, void *pData)
+{
+    return decodeInsOptionsPacketStructure(pPkt, (InsOptions_t *)pData);
+}
+
+static int dispatchDecodeOrionNetworkSettings(const void *pPkt, void *pData)
+{
+    return decodeOrionNetworkSettingsPacketStructure(pPkt, (OrionNetworkSettings_t *)pData);
+}
+
+static int dispatchDecodeOrionNetworkVideo(const void *pPkt, void *pData)
+{
+    return decodeOrionNetworkVideoPacketStructure(pPkt, (OrionNetworkVideo_t *)pData);
+}
+
+static int dispatchDecodeOrionCameras(const void *pPkt, void *pData)
+{
+    return decodeOrionCamerasPacketStructure(pPkt, (OrionCameras_t *)pData);
+}
+
+static int dispatchDecodeOrionClevisVersion(const void *pPkt, void *pData)
+{
+    return decodeOrionClevisVersionPacketStructure(pPkt, (OrionClevisVersion_t *)pData);
+}
+
+static int dispatchDecodeOrionCrownVersion(const void *pPkt, void *pData)
+{
+    return decodeOrionCrownVersionPacketStructure(pPkt, (OrionCrownVersion_t *)pData);
+}
+
+static int dispatchDecodeOrionPayloadVersion(const void *pPkt, void *pData)
+{
+    return decodeOrionPayloadVersionPacketStructure(pPkt, (OrionPayloadVersion_t *)pData);
+}
+
+static int dispatchDecodeOrionTrackerVersion(const void *pPkt, void *pData)
+{
+    return decodeOrionTrackerVersionPacketStructure(pPkt, (OrionTrackerVersion_t *)pData);
+}
+
+static int dispatchDecodeOrionRetractVersion(const void *pPkt, void *pData)
+{
+    return decodeOrionRetractVersionPacketStructure(pPkt, (OrionRetractVersion_t *)pData);
+}
+
+static int dispatchDecodeOrionLensCtlVersion(const void *pPkt, void *pData)
+{
+    return decodeOrionLensCtlVersionPacketStructure(pPkt, (OrionLensCtlVersion_t *)pData);
+}
+
+static int dispatchDecodeOrionBoard(const void *pPkt, void *pData)
+{
+    return decodeOrionBoardPacketStructure(pPkt, (OrionBoard_t *)pData);
+}
+
+static int dispatchDecodeOrionAutopilotData(const void *pPkt, void *pData)
+{
+    return decodeOrionAutopilotDataPacketStructure(pPkt, (OrionAutopilotData_t *)pData);
+}
+
+OrionDispatchEntry_t OrionDispatchTable[256] =
+{
+    [(ORION_PKT_GEOLOCATE_TELEMETRY)] = { dispatchDecodeGeolocateTelemetryCore, (46), (8*NUM_GIMBAL_AXES+84) },
+    [(ORION_PKT_PERFORMANCE)] = { dispatchDecodeOrionPerformance, (10*NUM_GIMBAL_AXES), (10*NUM_GIMBAL_AXES) },
+    [(ORION_PKT_DIAGNOSTICS)] = { dispatchDecodeOrionDiagnostics, (28), (30) },
+    [(ORION_PKT_FAULTS)] = { dispatchDecodeOrionFault, (11), (11) },
+    [(ORION_PKT_SOFTWARE_DIAGNOSTICS)] = { dispatchDecodeOrionSoftwareDiagnostics, (4), (134) },
+    [(ORION_PKT_VIBRATION)] = { dispatchDecodeOrionVibration, (4*NUM_AXES+16*(2*NUM_AXES+2)), (4*NUM_AXES+16*(2*NUM_AXES+2)) },
+    [(ORION_PKT_NETWORK_DIAGNOSTICS)] = { dispatchDecodeNetworkDiagnostics, (36), (36) },
+    [(ORION_PKT_STARE_START)] = { dispatchDecodeStareStart, (20), (52) },
+    [(ORION_PKT_DEBUG_STRING)] = { dispatchDecodeDebugString, (5), (132) },
+    [(ORION_PKT_GPS_DATA)] = { dispatchDecodeGpsData, (55), (73) },
+    [(ORION_PKT_INS_QUALITY)] = { dispatchDecodeInsQuality, (34), (2*NUM_GIMBAL_AXES+75) },
+    [(ORION_PKT_STARTUP_CMD)] = { dispatchDecodeOrionStartupCmd, (2*NUM_GIMBAL_AXES+3), (2*NUM_GIMBAL_AXES+3) },
+    [(ORION_PKT_POSITIONS)] = { dispatchDecodeOrionPositions, (1), (NUM_POSITIONS*8+1) },
+    [(ORION_PKT_PATH)] = { dispatchDecodeOrionPath, (2), (MAX_PATH_POINTS*9+5) },
+    [(ORION_PKT_CAMERA_STATE)] = { dispatchDecodeOrionCameraState, (2), (5) },
+    [(ORION_PKT_FLIR_SETTINGS)] = { dispatchDecodeOrionFlirSettings, (5), (9) },
+    [(ORION_PKT_APTINA_SETTINGS)] = { dispatchDecodeOrionAptinaSettings, (13), (18) },
+    [(ORION_PKT_ZAFIRO_SETTINGS)] = { dispatchDecodeOrionZafiroSettings, (6), (7) },
+    [(ORION_PKT_HITACHI_SETTINGS)] = { dispatchDecodeOrionHitachiSettings, (5), (7) },
+    [(ORION_PKT_SONY_SETTINGS)] = { dispatchDecodeOrionSonySettings, (12), (12) },
+    [(ORION_PKT_KTNC_SETTINGS)] = { dispatchDecodeOrionKtncSettings, (5), (16) },
+    [(ORION_PKT_ATTOLLO_SETTINGS)] = { dispatchDecodeOrionAttolloSettings, (9), (13) },
+    [(ORION_PKT_USER_DATA)] = { dispatchDecodeOrionUserData, (6), (134) },
+    [(ORION_PKT_LASER_CMD)] = { dispatchDecodeOrionLaserCommand, (11), (29) },
+    [(ORION_PKT_LASER_STATES)] = { dispatchDecodeOrionLaserStates, (1), (MAX_LASERS*6+1) },
+    [(ORION_PKT_UART_CONFIG)] = { dispatchDecodeOrionUartConfig, (5), (10) },
+    [(ORION_PKT_LIMITS)] = { dispatchDecodeOrionLimitsData, (16*NUM_GIMBAL_AXES), (17*NUM_GIMBAL_AXES) },
+    [(ORION_PKT_INS_OPTIONS)] = { dispatchDecodeInsOptions, (2*NUM_AXES+6), (4*NUM_AXES+22) },
+    [(ORION_PKT_NETWORK_SETTINGS)] = { dispatchDecodeOrionNetworkSettings, (12), (19) },
+    [(ORION_PKT_NETWORK_VIDEO)] = { dispatchDecodeOrionNetworkVideo, (6), (14) },
+    [(ORION_PKT_CAMERAS)] = { dispatchDecodeOrionCameras, (4), (4+NUM_CAMERAS*(4*NUM_GIMBAL_AXES+16)) },
+    [(ORION_PKT_CLEVIS_VERSION)] = { dispatchDecodeOrionClevisVersion, (32), (36) },
+    [(ORION_PKT_CROWN_VERSION)] = { dispatchDecodeOrionCrownVersion, (32), (36) },
+    [(ORION_PKT_PAYLOAD_VERSION)] = { dispatchDecodeOrionPayloadVersion, (40), (46) },
+    [(ORION_PKT_TRACKER_VERSION)] = { dispatchDecodeOrionTrackerVersion, (32), (36) },
+    [(ORION_PKT_RETRACT_VERSION)] = { dispatchDecodeOrionRetractVersion, (16), (16) },
+    [(ORION_PKT_LENSCTL_VERSION)] = { dispatchDecodeOrionLensCtlVersion, (16), (16) },
+    [(ORION_PKT_BOARD)] = { dispatchDecodeOrionBoard, (20), (20) },
+    [(ORION_PKT_AUTOPILOT_DATA)] = { dispatchDecodeOrionAutopilotData, (4), (6) },
+};
+
+void OrionDispatchSetCallback(UInt8 ID, OrionDispatchCallback_t pCallback, void *pUser)
+{
+    OrionDispatchTable[ID].pCallback = pCallback;
+    OrionDispatchTable[ID].pUser = pUser;
+}
+
+BOOL OrionDispatch(const OrionPkt_t *pPkt)
+{
+    const OrionDispatchEntry_t *pEntry = &OrionDispatchTable[pPkt->ID];
+    OrionDispatchData_t Data;
+
+    // Nobody cares about this packet
+    if (pEntry->pCallback == NULL)
+        return FALSE;
+
+    // Packets without a structure decoder get passed through undecoded
+    if (pEntry->pDecode == NULL)
+        pEntry->pCallback(pPkt, NULL, pEntry->pUser);
+    // Otherwise reject bad lengths up front, then decode into the structure for this ID
+    else if ((pPkt->Length >= pEntry->MinLength) && (pPkt->Length <= pEntry->MaxLength) && pEntry->pDecode(pPkt, &Data))
+        pEntry->pCallback(pPkt, &Data, pEntry->pUser);
+    else
+        return FALSE;
+
+    return TRUE;
+}
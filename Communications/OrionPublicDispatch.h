@@ -0,0 +1,88 @@
+// OrionPublicDispatch.h was generated by GenerateOrionDispatch.sh from OrionPublicPacket.h
+
+#ifndef _ORIONPUBLICDISPATCH_H
+#define _ORIONPUBLICDISPATCH_H
+
+#include "OrionPublicPacketShim.h"
+
+// C++ compilers: don't mangle us
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Decodes a packet into the structure type for its ID
+typedef int (*OrionDispatchDecode_t)(const void *pPkt, void *pData);
+
+//! Callback for packets routed by OrionDispatch, pData is NULL for IDs without a structure decoder
+typedef void (*OrionDispatchCallback_t)(const OrionPkt_t *pPkt, const void *pData, void *pUser);
+
+//! One entry in the packet ID dispatch table
+typedef struct
+{
+    OrionDispatchDecode_t pDecode;     //!< Structure decode function for this ID, or NULL
+    UInt16 MinLength;                  //!< Minimum encoded data length
+    UInt16 MaxLength;                  //!< Maximum encoded data length
+    OrionDispatchCallback_t pCallback; //!< User callback for this ID, or NULL
+    void *pUser;                       //!< User pointer passed to the callback
+}OrionDispatchEntry_t;
+
+//! Storage for any structure that OrionDispatch can decode
+typedef union
+{
+    GeolocateTelemetryCore_t GeolocateTelemetryCore;
+    OrionPerformance_t OrionPerformance;
+    OrionDiagnostics_t OrionDiagnostics;
+    OrionFault_t OrionFault;
+    OrionSoftwareDiagnostics_t OrionSoftwareDiagnostics;
+    OrionVibration_t OrionVibration;
+    NetworkDiagnostics_t NetworkDiagnostics;
+    StareStart_t StareStart;
+    DebugString_t DebugString;
+    GpsData_t GpsData;
+    InsQuality_t InsQuality;
+    OrionStartupCmd_t OrionStartupCmd;
+    OrionPositions_t OrionPositions;
+    OrionPath_t OrionPath;
+    OrionCameraState_t OrionCameraState;
+    OrionFlirSettings_t OrionFlirSettings;
+    OrionAptinaSettings_t OrionAptinaSettings;
+    OrionZafiroSettings_t OrionZafiroSettings;
+    OrionHitachiSettings_t OrionHitachiSettings;
+    OrionSonySettings_t OrionSonySettings;
+    OrionKtncSettings_t OrionKtncSettings;
+    OrionAttolloSettings_t OrionAttolloSettings;
+    OrionUserData_t OrionUserData;
+    OrionLaserCommand_t OrionLaserCommand;
+    OrionLaserStates_t OrionLaserStates;
+    OrionUartConfig_t OrionUartConfig;
+    OrionLimitsData_t OrionLimitsData;
+    InsOptions_t InsOptions;
+    OrionNetworkSettings_t OrionNetworkSettings;
+    OrionNetworkByteSettings_t OrionNetworkByteSettings;
+    OrionNetworkVideo_t OrionNetworkVideo;
+    OrionNetworkByteVideo_t OrionNetworkByteVideo;
+    OrionCameras_t OrionCameras;
+    OrionClevisVersion_t OrionClevisVersion;
+    OrionCrownVersion_t OrionCrownVersion;
+    OrionPayloadVersion_t OrionPayloadVersion;
+    OrionTrackerVersion_t OrionTrackerVersion;
+    OrionRetractVersion_t OrionRetractVersion;
+    OrionLensCtlVersion_t OrionLensCtlVersion;
+    OrionBoard_t OrionBoard;
+    OrionAutopilotData_t OrionAutopilotData;
+}OrionDispatchData_t;
+
+//! Dispatch table, indexed by packet ID
+extern OrionDispatchEntry_t OrionDispatchTable[256];
+
+//! Set the callback for a packet ID
+void OrionDispatchSetCallback(UInt8 ID, OrionDispatchCallback_t pCallback, void *pUser);
+
+//! Decode a packet and hand it to the callback for its ID
+BOOL OrionDispatch(const OrionPkt_t *pPkt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _ORIONPUBLICDISPATCH_H
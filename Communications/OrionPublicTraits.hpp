@@ -0,0 +1,549 @@
+// OrionPublicTraits.hpp was generated by GenerateOrionCpp.sh from OrionPublicPacket.h
+
+#ifndef _ORIONPUBLICTRAITS_HPP
+#define _ORIONPUBLICTRAITS_HPP
+
+#include "OrionPublicPacketShim.h"
+
+namespace orion
+{
+
+//! Compile time description of a packet structure, only defined for types that are packets
+template <typename T> struct PacketTraits;
+
+//! GeolocateTelemetryCore packet
+template <> struct PacketTraits<GeolocateTelemetryCore_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_GEOLOCATE_TELEMETRY);
+    static constexpr UInt16 MinLength = (46);
+    static constexpr UInt16 MaxLength = (8*NUM_GIMBAL_AXES+84);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "GeolocateTelemetryCore";
+
+    static bool decode(const void *pPkt, GeolocateTelemetryCore_t *pUser) { return decodeGeolocateTelemetryCorePacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const GeolocateTelemetryCore_t *pUser) { encodeGeolocateTelemetryCorePacketStructure(pPkt, pUser); }
+};
+
+//! OrionPerformance packet
+template <> struct PacketTraits<OrionPerformance_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_PERFORMANCE);
+    static constexpr UInt16 MinLength = (10*NUM_GIMBAL_AXES);
+    static constexpr UInt16 MaxLength = (10*NUM_GIMBAL_AXES);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionPerformance";
+
+    static bool decode(const void *pPkt, OrionPerformance_t *pUser) { return decodeOrionPerformancePacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionPerformance_t *pUser) { encodeOrionPerformancePacketStructure(pPkt, pUser); }
+};
+
+//! OrionDiagnostics packet
+template <> struct PacketTraits<OrionDiagnostics_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_DIAGNOSTICS);
+    static constexpr UInt16 MinLength = (28);
+    static constexpr UInt16 MaxLength = (30);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionDiagnostics";
+
+    static bool decode(const void *pPkt, OrionDiagnostics_t *pUser) { return decodeOrionDiagnosticsPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionDiagnostics_t *pUser) { encodeOrionDiagnosticsPacketStructure(pPkt, pUser); }
+};
+
+//! OrionFault packet
+template <> struct PacketTraits<OrionFault_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_FAULTS);
+    static constexpr UInt16 MinLength = (11);
+    static constexpr UInt16 MaxLength = (11);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionFault";
+
+    static bool decode(const void *pPkt, OrionFault_t *pUser) { return decodeOrionFaultPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionFault_t *pUser) { encodeOrionFaultPacketStructure(pPkt, pUser); }
+};
+
+//! OrionSoftwareDiagnostics packet
+template <> struct PacketTraits<OrionSoftwareDiagnostics_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_SOFTWARE_DIAGNOSTICS);
+    static constexpr UInt16 MinLength = (4);
+    static constexpr UInt16 MaxLength = (134);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionSoftwareDiagnostics";
+
+    static bool decode(const void *pPkt, OrionSoftwareDiagnostics_t *pUser) { return decodeOrionSoftwareDiagnosticsPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionSoftwareDiagnostics_t *pUser) { encodeOrionSoftwareDiagnosticsPacketStructure(pPkt, pUser); }
+};
+
+//! OrionVibration packet
+template <> struct PacketTraits<OrionVibration_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_VIBRATION);
+    static constexpr UInt16 MinLength = (4*NUM_AXES+16*(2*NUM_AXES+2));
+    static constexpr UInt16 MaxLength = (4*NUM_AXES+16*(2*NUM_AXES+2));
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionVibration";
+
+    static bool decode(const void *pPkt, OrionVibration_t *pUser) { return decodeOrionVibrationPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionVibration_t *pUser) { encodeOrionVibrationPacketStructure(pPkt, pUser); }
+};
+
+//! NetworkDiagnostics packet
+template <> struct PacketTraits<NetworkDiagnostics_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_NETWORK_DIAGNOSTICS);
+    static constexpr UInt16 MinLength = (36);
+    static constexpr UInt16 MaxLength = (36);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "NetworkDiagnostics";
+
+    static bool decode(const void *pPkt, NetworkDiagnostics_t *pUser) { return decodeNetworkDiagnosticsPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const NetworkDiagnostics_t *pUser) { encodeNetworkDiagnosticsPacketStructure(pPkt, pUser); }
+};
+
+//! StareStart packet
+template <> struct PacketTraits<StareStart_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_STARE_START);
+    static constexpr UInt16 MinLength = (20);
+    static constexpr UInt16 MaxLength = (52);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "StareStart";
+
+    static bool decode(const void *pPkt, StareStart_t *pUser) { return decodeStareStartPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const StareStart_t *pUser) { encodeStareStartPacketStructure(pPkt, pUser); }
+};
+
+//! DebugString packet
+template <> struct PacketTraits<DebugString_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_DEBUG_STRING);
+    static constexpr UInt16 MinLength = (5);
+    static constexpr UInt16 MaxLength = (132);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "DebugString";
+
+    static bool decode(const void *pPkt, DebugString_t *pUser) { return decodeDebugStringPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const DebugString_t *pUser) { encodeDebugStringPacketStructure(pPkt, pUser); }
+};
+
+//! GpsData packet
+template <> struct PacketTraits<GpsData_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_GPS_DATA);
+    static constexpr UInt16 MinLength = (55);
+    static constexpr UInt16 MaxLength = (73);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "GpsData";
+
+    static bool decode(const void *pPkt, GpsData_t *pUser) { return decodeGpsDataPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const GpsData_t *pUser) { encodeGpsDataPacketStructure(pPkt, pUser); }
+};
+
+//! InsQuality packet
+template <> struct PacketTraits<InsQuality_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_INS_QUALITY);
+    static constexpr UInt16 MinLength = (34);
+    static constexpr UInt16 MaxLength = (2*NUM_GIMBAL_AXES+75);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "InsQuality";
+
+    static bool decode(const void *pPkt, InsQuality_t *pUser) { return decodeInsQualityPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const InsQuality_t *pUser) { encodeInsQualityPacketStructure(pPkt, pUser); }
+};
+
+//! OrionStartupCmd packet
+template <> struct PacketTraits<OrionStartupCmd_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_STARTUP_CMD);
+    static constexpr UInt16 MinLength = (2*NUM_GIMBAL_AXES+3);
+    static constexpr UInt16 MaxLength = (2*NUM_GIMBAL_AXES+3);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionStartupCmd";
+
+    static bool decode(const void *pPkt, OrionStartupCmd_t *pUser) { return decodeOrionStartupCmdPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionStartupCmd_t *pUser) { encodeOrionStartupCmdPacketStructure(pPkt, pUser); }
+};
+
+//! OrionPositions packet
+template <> struct PacketTraits<OrionPositions_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_POSITIONS);
+    static constexpr UInt16 MinLength = (1);
+    static constexpr UInt16 MaxLength = (NUM_POSITIONS*8+1);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionPositions";
+
+    static bool decode(const void *pPkt, OrionPositions_t *pUser) { return decodeOrionPositionsPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionPositions_t *pUser) { encodeOrionPositionsPacketStructure(pPkt, pUser); }
+};
+
+//! OrionPath packet
+template <> struct PacketTraits<OrionPath_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_PATH);
+    static constexpr UInt16 MinLength = (2);
+    static constexpr UInt16 MaxLength = (MAX_PATH_POINTS*9+5);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionPath";
+
+    static bool decode(const void *pPkt, OrionPath_t *pUser) { return decodeOrionPathPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionPath_t *pUser) { encodeOrionPathPacketStructure(pPkt, pUser); }
+};
+
+//! OrionCameraState packet
+template <> struct PacketTraits<OrionCameraState_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_CAMERA_STATE);
+    static constexpr UInt16 MinLength = (2);
+    static constexpr UInt16 MaxLength = (5);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionCameraState";
+
+    static bool decode(const void *pPkt, OrionCameraState_t *pUser) { return decodeOrionCameraStatePacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionCameraState_t *pUser) { encodeOrionCameraStatePacketStructure(pPkt, pUser); }
+};
+
+//! OrionFlirSettings packet
+template <> struct PacketTraits<OrionFlirSettings_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_FLIR_SETTINGS);
+    static constexpr UInt16 MinLength = (5);
+    static constexpr UInt16 MaxLength = (9);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionFlirSettings";
+
+    static bool decode(const void *pPkt, OrionFlirSettings_t *pUser) { return decodeOrionFlirSettingsPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionFlirSettings_t *pUser) { encodeOrionFlirSettingsPacketStructure(pPkt, pUser); }
+};
+
+//! OrionAptinaSettings packet
+template <> struct PacketTraits<OrionAptinaSettings_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_APTINA_SETTINGS);
+    static constexpr UInt16 MinLength = (13);
+    static constexpr UInt16 MaxLength = (18);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionAptinaSettings";
+
+    static bool decode(const void *pPkt, OrionAptinaSettings_t *pUser) { return decodeOrionAptinaSettingsPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionAptinaSettings_t *pUser) { encodeOrionAptinaSettingsPacketStructure(pPkt, pUser); }
+};
+
+//! OrionZafiroSettings packet
+template <> struct PacketTraits<OrionZafiroSettings_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_ZAFIRO_SETTINGS);
+    static constexpr UInt16 MinLength = (6);
+    static constexpr UInt16 MaxLength = (7);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionZafiroSettings";
+
+    static bool decode(const void *pPkt, OrionZafiroSettings_t *pUser) { return decodeOrionZafiroSettingsPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionZafiroSettings_t *pUser) { encodeOrionZafiroSettingsPacketStructure(pPkt, pUser); }
+};
+
+//! OrionHitachiSettings packet
+template <> struct PacketTraits<OrionHitachiSettings_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_HITACHI_SETTINGS);
+    static constexpr UInt16 MinLength = (5);
+    static constexpr UInt16 MaxLength = (7);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionHitachiSettings";
+
+    static bool decode(const void *pPkt, OrionHitachiSettings_t *pUser) { return decodeOrionHitachiSettingsPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionHitachiSettings_t *pUser) { encodeOrionHitachiSettingsPacketStructure(pPkt, pUser); }
+};
+
+//! OrionSonySettings packet
+template <> struct PacketTraits<OrionSonySettings_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_SONY_SETTINGS);
+    static constexpr UInt16 MinLength = (12);
+    static constexpr UInt16 MaxLength = (12);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionSonySettings";
+
+    static bool decode(const void *pPkt, OrionSonySettings_t *pUser) { return decodeOrionSonySettingsPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionSonySettings_t *pUser) { encodeOrionSonySettingsPacketStructure(pPkt, pUser); }
+};
+
+//! OrionKtncSettings packet
+template <> struct PacketTraits<OrionKtncSettings_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_KTNC_SETTINGS);
+    static constexpr UInt16 MinLength = (5);
+    static constexpr UInt16 MaxLength = (16);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionKtncSettings";
+
+    static bool decode(const void *pPkt, OrionKtncSettings_t *pUser) { return decodeOrionKtncSettingsPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionKtncSettings_t *pUser) { encodeOrionKtncSettingsPacketStructure(pPkt, pUser); }
+};
+
+//! OrionAttolloSettings packet
+template <> struct PacketTraits<OrionAttolloSettings_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_ATTOLLO_SETTINGS);
+    static constexpr UInt16 MinLength = (9);
+    static constexpr UInt16 MaxLength = (13);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionAttolloSettings";
+
+    static bool decode(const void *pPkt, OrionAttolloSettings_t *pUser) { return decodeOrionAttolloSettingsPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionAttolloSettings_t *pUser) { encodeOrionAttolloSettingsPacketStructure(pPkt, pUser); }
+};
+
+//! OrionUserData packet
+template <> struct PacketTraits<OrionUserData_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_USER_DATA);
+    static constexpr UInt16 MinLength = (6);
+    static constexpr UInt16 MaxLength = (134);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionUserData";
+
+    static bool decode(const void *pPkt, OrionUserData_t *pUser) { return decodeOrionUserDataPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionUserData_t *pUser) { encodeOrionUserDataPacketStructure(pPkt, pUser); }
+};
+
+//! OrionLaserCommand packet
+template <> struct PacketTraits<OrionLaserCommand_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_LASER_CMD);
+    static constexpr UInt16 MinLength = (11);
+    static constexpr UInt16 MaxLength = (29);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionLaserCommand";
+
+    static bool decode(const void *pPkt, OrionLaserCommand_t *pUser) { return decodeOrionLaserCommandPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionLaserCommand_t *pUser) { encodeOrionLaserCommandPacketStructure(pPkt, pUser); }
+};
+
+//! OrionLaserStates packet
+template <> struct PacketTraits<OrionLaserStates_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_LASER_STATES);
+    static constexpr UInt16 MinLength = (1);
+    static constexpr UInt16 MaxLength = (MAX_LASERS*6+1);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionLaserStates";
+
+    static bool decode(const void *pPkt, OrionLaserStates_t *pUser) { return decodeOrionLaserStatesPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionLaserStates_t *pUser) { encodeOrionLaserStatesPacketStructure(pPkt, pUser); }
+};
+
+//! OrionUartConfig packet
+template <> struct PacketTraits<OrionUartConfig_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_UART_CONFIG);
+    static constexpr UInt16 MinLength = (5);
+    static constexpr UInt16 MaxLength = (10);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionUartConfig";
+
+    static bool decode(const void *pPkt, OrionUartConfig_t *pUser) { return decodeOrionUartConfigPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionUartConfig_t *pUser) { encodeOrionUartConfigPacketStructure(pPkt, pUser); }
+};
+
+//! OrionLimitsData packet
+template <> struct PacketTraits<OrionLimitsData_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_LIMITS);
+    static constexpr UInt16 MinLength = (16*NUM_GIMBAL_AXES);
+    static constexpr UInt16 MaxLength = (17*NUM_GIMBAL_AXES);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionLimitsData";
+
+    static bool decode(const void *pPkt, OrionLimitsData_t *pUser) { return decodeOrionLimitsDataPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionLimitsData_t *pUser) { encodeOrionLimitsDataPacketStructure(pPkt, pUser); }
+};
+
+//! InsOptions packet
+template <> struct PacketTraits<InsOptions_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_INS_OPTIONS);
+    static constexpr UInt16 MinLength = (2*NUM_AXES+6);
+    static constexpr UInt16 MaxLength = (4*NUM_AXES+22);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "InsOptions";
+
+    static bool decode(const void *pPkt, InsOptions_t *pUser) { return decodeInsOptionsPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const InsOptions_t *pUser) { encodeInsOptionsPacketStructure(pPkt, pUser); }
+};
+
+//! OrionNetworkSettings packet
+template <> struct PacketTraits<OrionNetworkSettings_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_NETWORK_SETTINGS);
+    static constexpr UInt16 MinLength = (12);
+    static constexpr UInt16 MaxLength = (19);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionNetworkSettings";
+
+    static bool decode(const void *pPkt, OrionNetworkSettings_t *pUser) { return decodeOrionNetworkSettingsPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionNetworkSettings_t *pUser) { encodeOrionNetworkSettingsPacketStructure(pPkt, pUser); }
+};
+
+//! OrionNetworkByteSettings packet
+template <> struct PacketTraits<OrionNetworkByteSettings_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_NETWORK_SETTINGS);
+    static constexpr UInt16 MinLength = (12);
+    static constexpr UInt16 MaxLength = (19);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionNetworkByteSettings";
+
+    static bool decode(const void *pPkt, OrionNetworkByteSettings_t *pUser) { return decodeOrionNetworkByteSettingsPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionNetworkByteSettings_t *pUser) { encodeOrionNetworkByteSettingsPacketStructure(pPkt, pUser); }
+};
+
+//! OrionNetworkVideo packet
+template <> struct PacketTraits<OrionNetworkVideo_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_NETWORK_VIDEO);
+    static constexpr UInt16 MinLength = (6);
+    static constexpr UInt16 MaxLength = (14);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionNetworkVideo";
+
+    static bool decode(const void *pPkt, OrionNetworkVideo_t *pUser) { return decodeOrionNetworkVideoPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionNetworkVideo_t *pUser) { encodeOrionNetworkVideoPacketStructure(pPkt, pUser); }
+};
+
+//! OrionNetworkByteVideo packet
+template <> struct PacketTraits<OrionNetworkByteVideo_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_NETWORK_VIDEO);
+    static constexpr UInt16 MinLength = (6);
+    static constexpr UInt16 MaxLength = (14);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionNetworkByteVideo";
+
+    static bool decode(const void *pPkt, OrionNetworkByteVideo_t *pUser) { return decodeOrionNetworkByteVideoPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionNetworkByteVideo_t *pUser) { encodeOrionNetworkByteVideoPacketStructure(pPkt, pUser); }
+};
+
+//! OrionCameras packet
+template <> struct PacketTraits<OrionCameras_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_CAMERAS);
+    static constexpr UInt16 MinLength = (4);
+    static constexpr UInt16 MaxLength = (4+NUM_CAMERAS*(4*NUM_GIMBAL_AXES+16));
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionCameras";
+
+    static bool decode(const void *pPkt, OrionCameras_t *pUser) { return decodeOrionCamerasPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionCameras_t *pUser) { encodeOrionCamerasPacketStructure(pPkt, pUser); }
+};
+
+//! OrionClevisVersion packet
+template <> struct PacketTraits<OrionClevisVersion_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_CLEVIS_VERSION);
+    static constexpr UInt16 MinLength = (32);
+    static constexpr UInt16 MaxLength = (36);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionClevisVersion";
+
+    static bool decode(const void *pPkt, OrionClevisVersion_t *pUser) { return decodeOrionClevisVersionPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionClevisVersion_t *pUser) { encodeOrionClevisVersionPacketStructure(pPkt, pUser); }
+};
+
+//! OrionCrownVersion packet
+template <> struct PacketTraits<OrionCrownVersion_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_CROWN_VERSION);
+    static constexpr UInt16 MinLength = (32);
+    static constexpr UInt16 MaxLength = (36);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionCrownVersion";
+
+    static bool decode(const void *pPkt, OrionCrownVersion_t *pUser) { return decodeOrionCrownVersionPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionCrownVersion_t *pUser) { encodeOrionCrownVersionPacketStructure(pPkt, pUser); }
+};
+
+//! OrionPayloadVersion packet
+template <> struct PacketTraits<OrionPayloadVersion_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_PAYLOAD_VERSION);
+    static constexpr UInt16 MinLength = (40);
+    static constexpr UInt16 MaxLength = (46);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionPayloadVersion";
+
+    static bool decode(const void *pPkt, OrionPayloadVersion_t *pUser) { return decodeOrionPayloadVersionPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionPayloadVersion_t *pUser) { encodeOrionPayloadVersionPacketStructure(pPkt, pUser); }
+};
+
+//! OrionTrackerVersion packet
+template <> struct PacketTraits<OrionTrackerVersion_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_TRACKER_VERSION);
+    static constexpr UInt16 MinLength = (32);
+    static constexpr UInt16 MaxLength = (36);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionTrackerVersion";
+
+    static bool decode(const void *pPkt, OrionTrackerVersion_t *pUser) { return decodeOrionTrackerVersionPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionTrackerVersion_t *pUser) { encodeOrionTrackerVersionPacketStructure(pPkt, pUser); }
+};
+
+//! OrionRetractVersion packet
+template <> struct PacketTraits<OrionRetractVersion_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_RETRACT_VERSION);
+    static constexpr UInt16 MinLength = (16);
+    static constexpr UInt16 MaxLength = (16);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionRetractVersion";
+
+    static bool decode(const void *pPkt, OrionRetractVersion_t *pUser) { return decodeOrionRetractVersionPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionRetractVersion_t *pUser) { encodeOrionRetractVersionPacketStructure(pPkt, pUser); }
+};
+
+//! OrionLensCtlVersion packet
+template <> struct PacketTraits<OrionLensCtlVersion_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_LENSCTL_VERSION);
+    static constexpr UInt16 MinLength = (16);
+    static constexpr UInt16 MaxLength = (16);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionLensCtlVersion";
+
+    static bool decode(const void *pPkt, OrionLensCtlVersion_t *pUser) { return decodeOrionLensCtlVersionPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionLensCtlVersion_t *pUser) { encodeOrionLensCtlVersionPacketStructure(pPkt, pUser); }
+};
+
+//! OrionBoard packet
+template <> struct PacketTraits<OrionBoard_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_BOARD);
+    static constexpr UInt16 MinLength = (20);
+    static constexpr UInt16 MaxLength = (20);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionBoard";
+
+    static bool decode(const void *pPkt, OrionBoard_t *pUser) { return decodeOrionBoardPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionBoard_t *pUser) { encodeOrionBoardPacketStructure(pPkt, pUser); }
+};
+
+//! OrionAutopilotData packet
+template <> struct PacketTraits<OrionAutopilotData_t>
+{
+    static constexpr UInt8 ID = (ORION_PKT_AUTOPILOT_DATA);
+    static constexpr UInt16 MinLength = (4);
+    static constexpr UInt16 MaxLength = (6);
+    static constexpr bool CanEncode = true;
+    static constexpr const char *Name = "OrionAutopilotData";
+
+    static bool decode(const void *pPkt, OrionAutopilotData_t *pUser) { return decodeOrionAutopilotDataPacketStructure(pPkt, pUser) != 0; }
+    static void encode(void *pPkt, const OrionAutopilotData_t *pUser) { encodeOrionAutopilotDataPacketStructure(pPkt, pUser); }
+};
+
+} // namespace orion
+
+#endif // _ORIONPUBLICTRAITS_HPP
@@ -0,0 +1 @@
+SRC = OrionComm.c OrionCommCapture.c OrionCommClock.c OrionCommExecutor.c OrionCommLinux.c OrionCommMulticast.c OrionCommReliable.c OrionCommShared.c OrionCommStats.c OrionCommWindows.c OrionPublicDispatch.c OrionPublicPacket.c fielddecode.c fieldencode.c floatspecial.c scaleddecode.c scaledencode.c
@@ -7,8 +7,10 @@ SUBDIRS += \
     GpsAndHeading \
     LineOfSight \
     PathTrack \
+    Relay \
     SendCommand \
     SendConfig \
+    SharedState \
     UserData
 
 unix:SUBDIRS += \
@@ -6,9 +6,28 @@
 
 #include "LineOfSight.h"
 #include "GeolocateTelemetry.h"
+#include "WGS84.h"
+#include "fastmath.h"
 #include "OrionComm.h"
+#include "TileCache.h"
+#include "TerrainPack.h"
 
-#define TILE_CACHE 25
+// Preprocessed terrain, used instead of downloading tiles wherever it has them
+#define TERRAIN_PACK_FILE "terrain.pack"
+
+// Memory the tile cache can use, and the number of threads fetching and decoding tiles
+#define TILE_CACHE_BUDGET   (256 * 1024 * 1024)
+#define TILE_CACHE_WORKERS  4
+
+// How far out along the line of sight to prefetch tiles, which matches how far the ray march
+//   looks, and how many seconds ahead along the aircraft's velocity
+#define PREFETCH_RANGE      15000.0
+#define PREFETCH_SECONDS    30.0
+#define PREFETCH_MAX_STEPS  64
+
+// Number of U/V units per tile side, and the grid size limit
+#define TILE_UV_MAX 32768
+#define GRID_MAX_SIZE 256
 // #define DEBUG
 
 #ifdef DEBUG
@@ -18,85 +37,137 @@
 #endif
 
 static int TriangleContainsPoint(const double A[NLLA], const double B[NLLA], const double C[NLLA], double P[NLLA]);
-static int GetTile(const TileInfo_t *pTile);
-static float GetElevation(double TargetLat, double TargetLon);
+static void GetTileInfo(double Lat, double Lon, TileInfo_t *pTileInfo);
+static size_t LoadTile(void *pUser, const TileInfo_t *pTileInfo, Tile_t *pTile);
+static size_t MapTile(void *pUser, const TileInfo_t *pTileInfo, Tile_t *pTile);
+static size_t ReadTerrainFile(const char *pPath, const TileInfo_t *pTileInfo, Tile_t *pTile);
+static void FreeTile(void *pUser, Tile_t *pTile);
+static void GetVertexLla(const Tile_t *pTile, uint16_t Index, double Lla[NLLA]);
+static int BuildPack(const char *pPath);
+static int ParseTilePath(const char *pPath, TileInfo_t *pTileInfo);
+static void PrefetchTiles(const GeolocateTelemetry_t *pGeo);
+static void PrefetchLine(double Lat, double Lon, double North, double East, double Step, double Distance);
+static void BuildGrid(Tile_t *pTile, const double CenterLla[NLLA], double Scale);
+static int GetGridCell(int Size, double Value);
+static float GetElevation(const TerrainProvider_t *pTerrain, double TargetLat, double TargetLon);
+static BOOL GetElevationBounds(const TerrainProvider_t *pTerrain, double LatMin, double LonMin, double LatMax, double LonMax, float *pMin, float *pMax);
 static void KillProcess(const char *pMessage, int Value);
 static void ProcessArgs(int argc, char **argv, int *pLevel);
+static void HandleGeolocate(OrionCommContext_t *pContext, const OrionPkt_t *pPkt, void *pUser);
 
-static OrionPkt_t PktIn, PktOut;
-static Tile_t Tiles[TILE_CACHE];
-static int TileIndex = 0;
+static OrionPkt_t PktOut;
+static TileCache_t Cache;
+static TerrainPack_t Pack;
+
+// Number of elevation lookups that hit a tile that's still loading, during the current ray march
+static int PendingTiles = 0;
 
 // Elevation tile level of detail - defaults to 12
 static int TileLevel = 12;
 
+// Terrain model backed by the tile cache, with per-tile height bounds for skipping empty space
+static const TerrainProvider_t Terrain = { GetElevation, GetElevationBounds, 1.0f, 0.0f, NULL, NULL };
+
+// Most tiles to look through for a single height bounds query
+#define BOUNDS_MAX_TILES 16
+
 int main(int argc, char **argv)
 {
+    OrionCommLoop_t Loop;
+
+    // Build a terrain pack from a list of downloaded tiles instead of connecting to a gimbal
+    if ((argc == 3) && (strcmp(argv[1], "--pack") == 0))
+        return BuildPack(argv[2]);
+
     // Process the command line arguments
     ProcessArgs(argc, argv, &TileLevel);
 
-    // Loop forever
-    while (1)
-    {
-        GeolocateTelemetry_t Geo;
+    // Start up the tile cache and its worker threads
+    if (!TileCacheInit(&Cache, TILE_CACHE_BUDGET, TILE_CACHE_WORKERS, LoadTile, FreeTile, NULL))
+        KillProcess("Failed to start the tile cache", 1);
 
-        // Pull all queued up packets off the comm interface
-        while (OrionCommReceive(&PktIn))
-        {
-            // If this packet is a geolocate telemetry packet
-            if (DecodeGeolocateTelemetry(&PktIn, &Geo))
-            {
-                double TargetLla[NLLA], Range;
+    // Tiles in the terrain pack, if there is one, go straight from the mapped file into the cache
+    if (TerrainPackOpen(&Pack, TERRAIN_PACK_FILE))
+        TileCacheSetFastLoader(&Cache, MapTile);
 
-                // If we got a valid target position from the gimbal
-                if (Geo.slantRange > 0)
-                {
-                    double TargetEcef[NECEF], LosEcef[NECEF];
+    // Set up an event loop that calls HandleGeolocate for each geolocate telemetry packet
+    if (!OrionCommLoopInit(&Loop) || !OrionCommLoopAdd(&Loop, OrionCommGetDefaultContext()))
+        KillProcess("Failed to start the event loop", 1);
 
-                    // Convert the 32-bit line of sight vector to double precision
-                    vector3Convertf(Geo.base.losECEF, LosEcef);
+    OrionCommLoopSetHandler(&Loop, ORION_PKT_GEOLOCATE_TELEMETRY, HandleGeolocate, NULL);
 
-                    // Add the line of sight vector to the gimbal position, both are in the ECEF coordinate frame
-                    vector3Sum(Geo.posECEF, LosEcef, TargetEcef);
+    // Sleep until packets arrive and dispatch them, for as long as the gimbal stays connected
+    while (OrionCommIsOpen() && (OrionCommLoopRun(&Loop, -1) >= 0))
+        fflush(stdout);
 
-                    // Convert the target position from ECEF to LLA
-                    ecefToLLA(TargetEcef, TargetLla);
+    // Finally, be done!
+    OrionCommLoopFree(&Loop);
+    TileCacheFree(&Cache);
+    TerrainPackClose(&Pack);
+    return 0;
+}
 
-                    // Grab the slant range for printing
-                    Range = Geo.slantRange;
-                }
-                // As a fallback, try finding an intersection with the WGS-84 ellipsoid
-                else if (getTerrainIntersection(&Geo, GetElevation, TargetLla, &Range))
-                {
-                    // Send the computed slant range data to the gimbal
-                    encodeOrionRangeDataPacket(&PktOut, Range, 1000, RANGE_SRC_OTHER);
-                    OrionCommSend(&PktOut);
-                }
-                // If both methods fail
-                else
-                {
-                    // Let the user know that we didn't come up with a valid image location and move on
-                    printf("TARGET LLA: %-44s\r", "INVALID");
-                    continue;
-                }
+// Event loop callback for geolocate telemetry packets
+static void HandleGeolocate(OrionCommContext_t *pContext, const OrionPkt_t *pPkt, void *pUser)
+{
+    GeolocateTelemetry_t Geo;
 
-                // If we got a valid intersection, print it out (note that we convert altitude to MSL)
-                printf("TARGET LLA: %10.6lf %11.6lf %6.1lf, RANGE: %6.0lf\r",
-                       degrees(TargetLla[LAT]),
-                       degrees(TargetLla[LON]),
-                       TargetLla[ALT] - Geo.base.geoidUndulation,
-                       Range);
-            }
+    // If this packet is a geolocate telemetry packet
+    if (DecodeGeolocateTelemetry(pPkt, &Geo))
+    {
+        double TargetLla[NLLA], Range;
+
+        // Get the tiles we're likely to need next on their way, so the ray march doesn't end up waiting on them
+        PrefetchTiles(&Geo);
+        PendingTiles = 0;
+
+        // If we got a valid target position from the gimbal
+        if (Geo.slantRange > 0)
+        {
+            double TargetEcef[NECEF], LosEcef[NECEF];
+
+            // Convert the 32-bit line of sight vector to double precision
+            vector3Convertf(Geo.base.losECEF, LosEcef);
+
+            // Add the line of sight vector to the gimbal position, both are in the ECEF coordinate frame
+            vector3Sum(Geo.posECEF, LosEcef, TargetEcef);
+
+            // Convert the target position from ECEF to LLA
+            ecefToLLA(TargetEcef, TargetLla);
+
+            // Grab the slant range for printing
+            Range = Geo.slantRange;
+        }
+        // As a fallback, try finding an intersection with the WGS-84 ellipsoid
+        else if (getTerrainIntersectionEx(&Geo, &Terrain, TargetLla, &Range) && (PendingTiles == 0))
+        {
+            // Send the computed slant range data to the gimbal
+            encodeOrionRangeDataPacket(&PktOut, Range, 1000, RANGE_SRC_OTHER);
+            OrionCommSendEx(pContext, &PktOut);
+        }
+        // If the ray march went through terrain that hasn't loaded yet, its answer can't be trusted
+        else if (PendingTiles > 0)
+        {
+            printf("TARGET LLA: %-44s\r", "LOADING TERRAIN");
+            return;
+        }
+        // If both methods fail
+        else
+        {
+            // Let the user know that we didn't come up with a valid image location and move on
+            printf("TARGET LLA: %-44s\r", "INVALID");
+            return;
         }
 
-        // Sleep for 20 ms so as not to hog the entire CPU
-        fflush(stdout);
-        usleep(20000);
+        // If we got a valid intersection, print it out (note that we convert altitude to MSL)
+        printf("TARGET LLA: %10.6lf %11.6lf %6.1lf, RANGE: %6.0lf\r",
+               degrees(TargetLla[LAT]),
+               degrees(TargetLla[LON]),
+               TargetLla[ALT] - Geo.base.geoidUndulation,
+               Range);
     }
 
-    // Finally, be done!
-    return 0;
-}
+}// HandleGeolocate
 
 // This function just shuts things down consistently with a nice message for the user
 static void KillProcess(const char *pMessage, int Value)
@@ -163,55 +234,70 @@ static __inline int TriangleContainsPoint(const double A[NLLA], const double B[N
 
 }// TriangleContainsPoint
 
-static int GetTile(const TileInfo_t *pTileInfo)
+// Fills in the description of the tile at the current level of detail that contains a lat/lon
+static void GetTileInfo(double Lat, double Lon, TileInfo_t *pTileInfo)
 {
-    char Cmd[64], File[64];
-    FILE *pFile;
-    int i, MaxIndex;
+    double Scale = PId / (1 << TileLevel);
 
-    for (i = 0; i < MIN(TILE_CACHE, TileIndex); i++)
-    {
-        if (pTileInfo->Level != Tiles[i].Info.Level)
-            continue;
-        else if (pTileInfo->X != Tiles[i].Info.X)
-            continue;
-        else if (pTileInfo->Y != Tiles[i].Info.Y)
-            continue;
-        else
-            return i;
-    }
+    pTileInfo->Level = TileLevel;
+    pTileInfo->X = (Lon + PId * 1.0f) / Scale;
+    pTileInfo->Y = (Lat + PId * 0.5f) / Scale;
+
+}// GetTileInfo
+
+// Fetches and decodes a tile, called from the tile cache's worker threads
+static size_t LoadTile(void *pUser, const TileInfo_t *pTileInfo, Tile_t *pTile)
+{
+    char Cmd[64], File[64];
 
     // Pull the appropriate tile from the server and construct the file name string
     sprintf(Cmd, "./get_tile.sh %d %d %d", pTileInfo->Level, pTileInfo->X, pTileInfo->Y);
     system(Cmd);
     sprintf(File, "cache/%d/%d/%d.terrain", pTileInfo->Level, pTileInfo->X, pTileInfo->Y);
 
+    return ReadTerrainFile(File, pTileInfo, pTile);
+
+}// LoadTile
+
+// Finds a tile in the terrain pack, which is cheap enough for the cache to do without a worker
+static size_t MapTile(void *pUser, const TileInfo_t *pTileInfo, Tile_t *pTile)
+{
+    // Mapped tiles don't take up any heap, just the tile structure itself
+    return TerrainPackFind(&Pack, pTileInfo, pTile) ? sizeof(Tile_t) : 0;
+
+}// MapTile
+
+// Reads and decodes a quantized-mesh terrain file, returning the bytes it takes up or 0 on failure
+static size_t ReadTerrainFile(const char *pPath, const TileInfo_t *pTileInfo, Tile_t *pTile)
+{
+    FILE *pFile;
+    int i, MaxIndex;
+
     // Open the terrain file
-    pFile = fopen(File, "rb");
+    pFile = fopen(pPath, "rb");
 
     // If the file opens successfully
     if (pFile != NULL)
     {
-        Tile_t *pTile = &Tiles[TileIndex % TILE_CACHE];
         double CenterLla[NLLA], Scale = PId / (1 << pTileInfo->Level);
         int16_t U = 0, V = 0, H = 0;
         Header_t Header;
 
-        // Delete all heap-allocated storage
-        free(pTile->Triangles.pIndices);
-        free(pTile->Vertices.pLla);
-        free(pTile->Vertices.pH);
-        free(pTile->Vertices.pV);
-        free(pTile->Vertices.pU);
-
-        // Read header structure
-        fread(&Header, sizeof(Header_t), 1, pFile);
+        // Read the header structure and the vertex count, which has to fit in the 16-bit triangle indices
+        if ((fread(&Header, sizeof(Header_t), 1, pFile) != 1) ||
+            (fread(&pTile->Vertices.Count, sizeof(uint32_t), 1, pFile) != 1) ||
+            (pTile->Vertices.Count > 65536))
+        {
+            fclose(pFile);
+            return 0;
+        }
 
         // Convert the ECEF center point of this tile to LLA
         ecefToLLA((double *)&Header, CenterLla);
 
-        // Read in the vertex count
-        fread(&pTile->Vertices.Count, sizeof(uint32_t), 1, pFile);
+        // Keep the height range around for terrain bounds queries and for decoding vertex heights
+        pTile->MinHeight = Header.MinHeight;
+        pTile->MaxHeight = Header.MaxHeight;
 
 #ifdef DEBUG
         // Set up constants for degrees-to-meters Taylor series expansion
@@ -224,11 +310,10 @@ static int GetTile(const TileInfo_t *pTileInfo)
         DEBUG_PRINT(" Points       = %d\n", pTile->Vertices.Count);
 #endif // DEBUG
 
-        // Allocate space for vertex data (U/V/H as well as LLA)
+        // Allocate space for vertex data, which stays quantized: LLA positions are only worked out for the triangles a lookup tests
         pTile->Vertices.pU = (uint16_t *)malloc(pTile->Vertices.Count * sizeof(uint16_t));
         pTile->Vertices.pV = (uint16_t *)malloc(pTile->Vertices.Count * sizeof(uint16_t));
         pTile->Vertices.pH = (uint16_t *)malloc(pTile->Vertices.Count * sizeof(uint16_t));
-        pTile->Vertices.pLla = (double *)malloc(pTile->Vertices.Count * 3 * sizeof(double));
 
         // Now read the U/V/H data from the file
         fread(pTile->Vertices.pU, sizeof(uint16_t) * pTile->Vertices.Count, 1, pFile);
@@ -243,10 +328,10 @@ static int GetTile(const TileInfo_t *pTileInfo)
             V += (pTile->Vertices.pV[i] >> 1) ^ (-(pTile->Vertices.pV[i] & 1));
             H += (pTile->Vertices.pH[i] >> 1) ^ (-(pTile->Vertices.pH[i] & 1));
 
-            // Compute and store the LLA position of this point
-            pTile->Vertices.pLla[i * NLLA + LAT] = CenterLla[LAT] + (V / 32767.0f - 0.5f) * Scale;
-            pTile->Vertices.pLla[i * NLLA + LON] = CenterLla[LON] + (U / 32767.0f - 0.5f) * Scale;
-            pTile->Vertices.pLla[i * NLLA + ALT] = H * (Header.MaxHeight - Header.MinHeight) / 32767.0f + Header.MinHeight;
+            // Hang onto the decoded U/V/H position
+            pTile->Vertices.pU[i] = U;
+            pTile->Vertices.pV[i] = V;
+            pTile->Vertices.pH[i] = H;
         }
 
         // Now read the number of triangles that follow
@@ -269,47 +354,204 @@ static int GetTile(const TileInfo_t *pTileInfo)
                 pTile->Triangles.pIndices[i] = MaxIndex - pTile->Triangles.pIndices[i];
         }
 
+        // Bin the triangles by U/V position so lookups only have to test a few of them
+        BuildGrid(pTile, CenterLla, Scale);
+
         pTile->Info = *pTileInfo;
 
-        // Tell the caller that we got the tile
-        return (TileIndex++ % TILE_CACHE);
+        // Tell the cache how much memory the tile takes up
+        return sizeof(Tile_t) +
+               pTile->Vertices.Count * 3 * sizeof(uint16_t) +
+               pTile->Triangles.Count * 3 * sizeof(uint16_t) +
+               (pTile->Grid.Size * pTile->Grid.Size + 1 + pTile->Grid.pStart[pTile->Grid.Size * pTile->Grid.Size]) * sizeof(uint32_t);
     }
 
     // No data available... or something
-    return -1;
+    return 0;
 
-}// GetTile
+}// ReadTerrainFile
 
-static float GetElevation(double TargetLat, double TargetLon)
+// Deletes all of a tile's heap-allocated storage
+static void FreeTile(void *pUser, Tile_t *pTile)
+{
+    // Tiles from the terrain pack point into the pack, which stays mapped
+    if (pTile->Mapped)
+        return;
+
+    free(pTile->Grid.pTriangles);
+    free(pTile->Grid.pStart);
+    free(pTile->Triangles.pIndices);
+    free(pTile->Vertices.pH);
+    free(pTile->Vertices.pV);
+    free(pTile->Vertices.pU);
+
+}// FreeTile
+
+// Works out the LLA position of one of a tile's quantized vertices
+static __inline void GetVertexLla(const Tile_t *pTile, uint16_t Index, double Lla[NLLA])
+{
+    const Grid_t *pGrid = &pTile->Grid;
+
+    Lla[LAT] = pGrid->Lat + (pTile->Vertices.pV[Index] / 32767.0 - 0.5) * pGrid->Scale;
+    Lla[LON] = pGrid->Lon + (pTile->Vertices.pU[Index] / 32767.0 - 0.5) * pGrid->Scale;
+    Lla[ALT] = pTile->Vertices.pH[Index] * (pTile->MaxHeight - pTile->MinHeight) / 32767.0 + pTile->MinHeight;
+
+}// GetVertexLla
+
+// Packs up a list of downloaded terrain files, one path per line on stdin, into a terrain pack
+static int BuildPack(const char *pPath)
+{
+    TerrainPackWriter_t Writer;
+    TileInfo_t TileInfo;
+    Tile_t Tile;
+    char Line[512];
+    int Count = 0;
+
+    if (!TerrainPackCreate(&Writer, pPath))
+    {
+        printf("Failed to create %s\n", pPath);
+        return 1;
+    }
+
+    while (fgets(Line, sizeof(Line), stdin) != NULL)
+    {
+        // Strip the line ending, and skip anything that isn't named like a tile in the download cache
+        Line[strcspn(Line, "\r\n")] = '\0';
+        if (!ParseTilePath(Line, &TileInfo))
+            continue;
+
+        // Decode the tile just like it was being loaded, and skip it if that doesn't work
+        memset(&Tile, 0, sizeof(Tile));
+        if (ReadTerrainFile(Line, &TileInfo, &Tile) == 0)
+            continue;
+
+        if (!TerrainPackAdd(&Writer, &Tile))
+        {
+            printf("Failed to write %s\n", pPath);
+            FreeTile(NULL, &Tile);
+            TerrainPackFinish(&Writer);
+            return 1;
+        }
+
+        FreeTile(NULL, &Tile);
+        Count++;
+    }
+
+    // Write the index, and we're done
+    if (!TerrainPackFinish(&Writer))
+    {
+        printf("Failed to write %s\n", pPath);
+        return 1;
+    }
+
+    printf("Packed %d tiles into %s\n", Count, pPath);
+    return 0;
+
+}// BuildPack
+
+// Gets the level and X/Y index of a tile from a path ending in level/x/y.terrain
+static int ParseTilePath(const char *pPath, TileInfo_t *pTileInfo)
+{
+    const char *p = pPath + strlen(pPath);
+    int Slashes = 0;
+
+    // Back up to the start of the last three path components
+    while ((p > pPath) && (Slashes < 3))
+    {
+        if ((*--p == '/') || (*p == '\\'))
+            Slashes++;
+    }
+
+    if ((*p == '/') || (*p == '\\'))
+        p++;
+
+    return sscanf(p, "%d%*[/\\]%d%*[/\\]%d.terrain", &pTileInfo->Level, &pTileInfo->X, &pTileInfo->Y) == 3;
+
+}// ParseTilePath
+
+// Asks the tile cache for the tiles the next few ray marches are likely to need
+static void PrefetchTiles(const GeolocateTelemetry_t *pGeo)
 {
-    double TargetLla[NLLA] = { TargetLat, TargetLon, -10000.0 };
     double Scale = PId / (1 << TileLevel);
+    double North = pGeo->base.velNED[0], East = pGeo->base.velNED[1], Speed = sqrt(North * North + East * East);
+    double Step;
+    float SinAz, CosAz;
+
+    // This only decides which tiles to ask for early, so coarse trig is plenty
+    fastmathSinCos(Coarse, pGeo->cameraEuler[AXIS_YAW], &SinAz, &CosAz);
+
+    // Step half a tile at a time, measured east-west where the tiles are narrowest
+    Step = 0.5 * Scale * datum_meanRadius * MAX(fastmathCos(Coarse, (float)pGeo->base.posLat), 0.01);
+
+    // Tiles under the line of sight come first, since the ray march needs them right away
+    PrefetchLine(pGeo->base.posLat, pGeo->base.posLon, CosAz, SinAz, Step, PREFETCH_RANGE);
+
+    // Then the tiles along where the aircraft is headed
+    if (Speed > 1.0)
+        PrefetchLine(pGeo->base.posLat, pGeo->base.posLon, North / Speed, East / Speed, Step, Speed * PREFETCH_SECONDS);
+
+}// PrefetchTiles
+
+// Prefetches the tiles along a straight line over the ground, given its north/east direction and length in meters
+static void PrefetchLine(double Lat, double Lon, double North, double East, double Step, double Distance)
+{
+    double LonRadius = datum_meanRadius * MAX(cos(Lat), 0.01), d;
+    TileInfo_t TileInfo, Last = { -1, -1, -1 };
+    int Steps;
+
+    for (d = 0, Steps = 0; (d <= Distance) && (Steps < PREFETCH_MAX_STEPS); d += Step, Steps++)
+    {
+        GetTileInfo(Lat + North * d / datum_meanRadius, Lon + East * d / LonRadius, &TileInfo);
+
+        // Consecutive steps usually land in the same tile, which only needs asking for once
+        if ((TileInfo.X != Last.X) || (TileInfo.Y != Last.Y))
+            TileCachePrefetch(&Cache, &TileInfo);
+
+        Last = TileInfo;
+    }
+
+}// PrefetchLine
+
+static float GetElevation(const TerrainProvider_t *pTerrain, double TargetLat, double TargetLon)
+{
+    double TargetLla[NLLA] = { TargetLat, TargetLon, TERRAIN_NO_DATA };
     TileInfo_t TileInfo;
-    int Index;
+    const Tile_t *pTile;
+    TileState_t State;
 
-    // Load up the tile description structure with
-    TileInfo.Level = TileLevel;
-    TileInfo.X = (TargetLon + PId * 1.0f) / Scale;
-    TileInfo.Y = (TargetLat + PId * 0.5f) / Scale;
+    // Load up the tile description structure with the tile containing this point
+    GetTileInfo(TargetLat, TargetLon, &TileInfo);
 
-    Index = GetTile(&TileInfo);
+    // Look the tile up, which never waits on a tile that isn't loaded yet, but keep track of having missed one
+    State = TileCacheGet(&Cache, &TileInfo, &pTile);
+    if ((State != TILE_READY) && (State != TILE_MISSING))
+        PendingTiles++;
 
     // If we can get the elevation tile containing this lat/lon
-    if (Index >= 0)
+    if (pTile != NULL)
     {
-        Tile_t *pTile = &Tiles[Index];
-        int i;
+        const Grid_t *pGrid = &pTile->Grid;
+        int Cell;
+        uint32_t i;
 
-        // For each triangle in the list
-        for (i = 0; i < pTile->Triangles.Count; i++)
+        // Find the grid cell this point falls in, using the same U/V mapping as the vertices
+        Cell = GetGridCell(pGrid->Size, ((TargetLat - pGrid->Lat) / pGrid->Scale + 0.5) * 32767.0) * pGrid->Size +
+               GetGridCell(pGrid->Size, ((TargetLon - pGrid->Lon) / pGrid->Scale + 0.5) * 32767.0);
+
+        // For each triangle that overlaps this cell
+        for (i = pGrid->pStart[Cell]; i < pGrid->pStart[Cell + 1]; i++)
         {
-            // Get pointers to the LLA data of the three vertices in this triangle
-            double *pA = &pTile->Vertices.pLla[pTile->Triangles.pIndices[i * 3 + 0] * NLLA];
-            double *pB = &pTile->Vertices.pLla[pTile->Triangles.pIndices[i * 3 + 1] * NLLA];
-            double *pC = &pTile->Vertices.pLla[pTile->Triangles.pIndices[i * 3 + 2] * NLLA];
+            const uint16_t *pIndices = &pTile->Triangles.pIndices[pGrid->pTriangles[i] * 3];
+
+            double A[NLLA], B[NLLA], C[NLLA];
+
+            // Get the LLA positions of the three vertices in this triangle
+            GetVertexLla(pTile, pIndices[0], A);
+            GetVertexLla(pTile, pIndices[1], B);
+            GetVertexLla(pTile, pIndices[2], C);
 
             // If the point we're looking for is contained within this triangle
-            if (TriangleContainsPoint(pA, pB, pC, TargetLla))
+            if (TriangleContainsPoint(A, B, C, TargetLla))
             {
                 // No need to continue searching
                 break;
@@ -321,3 +563,116 @@ static float GetElevation(double TargetLat, double TargetLon)
     return TargetLla[ALT];
 
 }// GetElevation
+
+// Gets the height range over a lat/lon box from the headers of the tiles it covers, as long as they're all cached
+static BOOL GetElevationBounds(const TerrainProvider_t *pTerrain, double LatMin, double LonMin, double LatMax, double LonMax, float *pMin, float *pMax)
+{
+    TileInfo_t First, Last, TileInfo;
+
+    // Find the range of tiles that the box covers
+    GetTileInfo(LatMin, LonMin, &First);
+    GetTileInfo(LatMax, LonMax, &Last);
+
+    // Don't bother if that's a lot of tiles
+    if ((Last.X - First.X + 1) * (Last.Y - First.Y + 1) > BOUNDS_MAX_TILES)
+        return FALSE;
+
+    *pMin = 1e9f;
+    *pMax = -1e9f;
+    TileInfo.Level = TileLevel;
+
+    // Combine the bounds of every tile, but give up if any of them haven't been loaded yet
+    for (TileInfo.Y = First.Y; TileInfo.Y <= Last.Y; TileInfo.Y++)
+    {
+        for (TileInfo.X = First.X; TileInfo.X <= Last.X; TileInfo.X++)
+        {
+            const Tile_t *pTile = TileCacheFind(&Cache, &TileInfo);
+
+            if (pTile == NULL)
+                return FALSE;
+
+            *pMin = MIN(*pMin, pTile->MinHeight);
+            *pMax = MAX(*pMax, pTile->MaxHeight);
+        }
+    }
+
+    return TRUE;
+
+}// GetElevationBounds
+
+// Returns the grid row or column for a U or V value, clamped to the edges of the grid
+static int GetGridCell(int Size, double Value)
+{
+    int Cell = (int)floor(Value * Size / TILE_UV_MAX);
+
+    return (Cell < 0) ? 0 : (Cell >= Size) ? Size - 1 : Cell;
+
+}// GetGridCell
+
+// Builds a uniform grid over a tile's U/V space, listing the triangles whose bounding box overlaps each cell
+static void BuildGrid(Tile_t *pTile, const double CenterLla[NLLA], double Scale)
+{
+    Grid_t *pGrid = &pTile->Grid;
+    uint32_t i, Cells, Total;
+    int Pass;
+
+    // Aim for a couple of triangles per cell
+    pGrid->Size = (int)sqrt(pTile->Triangles.Count / 2.0);
+    pGrid->Size = MAX(1, MIN(pGrid->Size, GRID_MAX_SIZE));
+    pGrid->Lat = CenterLla[LAT];
+    pGrid->Lon = CenterLla[LON];
+    pGrid->Scale = Scale;
+    Cells = pGrid->Size * pGrid->Size;
+
+    // Cell counts go in pStart, which gets turned into offsets between the two passes
+    pGrid->pStart = (uint32_t *)calloc(Cells + 1, sizeof(uint32_t));
+    pGrid->pTriangles = NULL;
+
+    // The first pass counts the triangles in each cell, and the second one files them away
+    for (Pass = 0; Pass < 2; Pass++)
+    {
+        for (i = 0; i < pTile->Triangles.Count; i++)
+        {
+            const uint16_t *pIndices = &pTile->Triangles.pIndices[i * 3];
+            int U0 = TILE_UV_MAX, U1 = 0, V0 = TILE_UV_MAX, V1 = 0, j, U, V;
+
+            // Find the U/V bounding box of this triangle
+            for (j = 0; j < 3; j++)
+            {
+                U0 = MIN(U0, pTile->Vertices.pU[pIndices[j]]);
+                U1 = MAX(U1, pTile->Vertices.pU[pIndices[j]]);
+                V0 = MIN(V0, pTile->Vertices.pV[pIndices[j]]);
+                V1 = MAX(V1, pTile->Vertices.pV[pIndices[j]]);
+            }
+
+            // Pad it by a unit so rounding in the vertex LLA conversion can't push a point out of its cell
+            for (V = GetGridCell(pGrid->Size, V0 - 1); V <= GetGridCell(pGrid->Size, V1 + 1); V++)
+            {
+                for (U = GetGridCell(pGrid->Size, U0 - 1); U <= GetGridCell(pGrid->Size, U1 + 1); U++)
+                {
+                    if (Pass == 0)
+                        pGrid->pStart[V * pGrid->Size + U + 1]++;
+                    else
+                        pGrid->pTriangles[pGrid->pStart[V * pGrid->Size + U]++] = i;
+                }
+            }
+        }
+
+        // After counting, turn the counts into offsets and make room for the lists
+        if (Pass == 0)
+        {
+            for (i = 0; i < Cells; i++)
+                pGrid->pStart[i + 1] += pGrid->pStart[i];
+
+            Total = pGrid->pStart[Cells];
+            pGrid->pTriangles = (uint32_t *)malloc(MAX(Total, 1) * sizeof(uint32_t));
+        }
+    }
+
+    // Filing the triangles pushed each offset up to the start of the next list, so shift them back down
+    for (i = Cells; i > 0; i--)
+        pGrid->pStart[i] = pGrid->pStart[i - 1];
+
+    pGrid->pStart[0] = 0;
+
+}// BuildGrid
@@ -25,15 +25,12 @@ typedef struct
     // Number of vertices
     uint32_t Count;
 
-    // North/east position in tile
+    // East/north position in tile, from 0 to 32767
     uint16_t *pU;
     uint16_t *pV;
 
-    // Height of vertex
+    // Height of vertex, from 0 to 32767 between the tile's minimum and maximum height
     uint16_t *pH;
-
-    // LLA position of vertex
-    double *pLla;
 } Vertices_t;
 
 typedef struct
@@ -57,11 +54,37 @@ typedef struct
     int Y;
 } TileInfo_t;
 
+typedef struct
+{
+    // Number of cells along each side of the grid
+    int Size;
+
+    // LLA position of the tile center and the width of the tile, in radians
+    double Lat;
+    double Lon;
+    double Scale;
+
+    // Offset of each cell's list in pTriangles, plus one more entry for the end of the last list
+    uint32_t *pStart;
+
+    // Indices of the triangles that overlap each cell, one list after another
+    uint32_t *pTriangles;
+} Grid_t;
+
 typedef struct
 {
     TileInfo_t Info;
+
+    // Minimum and maximum height in this tile, from the header
+    float MinHeight;
+    float MaxHeight;
+
     Vertices_t Vertices;
     Triangles_t Triangles;
+    Grid_t Grid;
+
+    // Set if the arrays point into a memory-mapped terrain pack instead of the heap
+    int Mapped;
 } Tile_t;
 
 #endif // LINEOFSIGHT_H
@@ -3,7 +3,9 @@ CONFIG += console
 CONFIG -= app_bundle
 CONFIG -= qt
 
-SOURCES += LineOfSight.c
+SOURCES += LineOfSight.c \
+    TileCache.c \
+    TerrainPack.c
 
 INCLUDEPATH += ../../Communications \
     ../../Utils
@@ -16,4 +18,6 @@ CONFIG(debug, debug|release) {
 
 LIBS += -lOrionComm -lOrionUtils
 
+unix:LIBS += -lpthread
+
 win32:LIBS += -lws2_32
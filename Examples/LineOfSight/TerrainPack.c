@@ -0,0 +1,345 @@
+#include "TerrainPack.h"
+#include "Constants.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif // _WIN32
+
+// Terrain packs start with these four bytes
+static const char Magic[4] = { 'T', 'P', 'A', 'K' };
+
+static uint64_t GetTileSize(const TerrainPackTile_t *pTile);
+static int CompareEntries(const void *pLeft, const void *pRight);
+static int WritePadding(FILE *pFile, uint64_t *pOffset, uint32_t Alignment);
+
+int TerrainPackOpen(TerrainPack_t *pPack, const char *pPath)
+{
+    const TerrainPackHeader_t *pHeader;
+#ifdef _WIN32
+    LARGE_INTEGER Size;
+#else
+    struct stat Stat;
+    int Handle;
+#endif // _WIN32
+
+    // Start off with nothing mapped
+    memset(pPack, 0, sizeof(TerrainPack_t));
+
+#ifdef _WIN32
+    // Open the file and map the whole thing read-only
+    pPack->File = CreateFileA(pPath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, NULL);
+    pPack->Mapping = NULL;
+
+    if ((pPack->File == INVALID_HANDLE_VALUE) || !GetFileSizeEx(pPack->File, &Size) || (Size.QuadPart < (LONGLONG)sizeof(TerrainPackHeader_t)))
+    {
+        TerrainPackClose(pPack);
+        return 0;
+    }
+
+    pPack->Size = (size_t)Size.QuadPart;
+    pPack->Mapping = CreateFileMappingA(pPack->File, NULL, PAGE_READONLY, 0, 0, NULL);
+
+    if (pPack->Mapping != NULL)
+        pPack->pData = (const uint8_t *)MapViewOfFile(pPack->Mapping, FILE_MAP_READ, 0, 0, 0);
+#else
+    // Open the file and map the whole thing read-only
+    if ((Handle = open(pPath, O_RDONLY)) < 0)
+        return 0;
+
+    if ((fstat(Handle, &Stat) == 0) && (Stat.st_size >= (off_t)sizeof(TerrainPackHeader_t)))
+    {
+        void *pData = mmap(NULL, (size_t)Stat.st_size, PROT_READ, MAP_SHARED, Handle, 0);
+
+        // Queries hop around from tile to tile, so reading ahead would only waste memory
+        if (pData != MAP_FAILED)
+        {
+            madvise(pData, (size_t)Stat.st_size, MADV_RANDOM);
+            pPack->pData = (const uint8_t *)pData;
+            pPack->Size = (size_t)Stat.st_size;
+        }
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    close(Handle);
+#endif // _WIN32
+
+    if (pPack->pData == NULL)
+    {
+        TerrainPackClose(pPack);
+        return 0;
+    }
+
+    pHeader = (const TerrainPackHeader_t *)pPack->pData;
+
+    // Make sure this is a pack we know how to read, and that its index fits in the file
+    if ((memcmp(pHeader->Magic, Magic, sizeof(Magic)) != 0) || (pHeader->Version != TERRAIN_PACK_VERSION) ||
+        (pHeader->IndexOffset % 8) || (pHeader->IndexOffset > pPack->Size) ||
+        ((pPack->Size - pHeader->IndexOffset) / sizeof(TerrainPackEntry_t) < pHeader->Count))
+    {
+        TerrainPackClose(pPack);
+        return 0;
+    }
+
+    pPack->pIndex = (const TerrainPackEntry_t *)(pPack->pData + pHeader->IndexOffset);
+    pPack->Count = pHeader->Count;
+    return 1;
+
+}// TerrainPackOpen
+
+void TerrainPackClose(TerrainPack_t *pPack)
+{
+#ifdef _WIN32
+    // Unmap the view and close both handles
+    if (pPack->pData != NULL)
+        UnmapViewOfFile(pPack->pData);
+
+    if (pPack->Mapping != NULL)
+        CloseHandle(pPack->Mapping);
+
+    if (pPack->File != INVALID_HANDLE_VALUE)
+        CloseHandle(pPack->File);
+
+    pPack->Mapping = NULL;
+    pPack->File = INVALID_HANDLE_VALUE;
+#else
+    // Unmap the file
+    if (pPack->pData != NULL)
+        munmap((void *)pPack->pData, pPack->Size);
+#endif // _WIN32
+
+    // Then forget everything
+    pPack->pData = NULL;
+    pPack->Size = 0;
+    pPack->pIndex = NULL;
+    pPack->Count = 0;
+
+}// TerrainPackClose
+
+int TerrainPackFind(const TerrainPack_t *pPack, const TileInfo_t *pInfo, Tile_t *pTile)
+{
+    TerrainPackEntry_t Key;
+    const TerrainPackEntry_t *pEntry;
+    const TerrainPackTile_t *pHeader;
+    const uint8_t *pData;
+    uint32_t Cells;
+
+    if (pPack->pIndex == NULL)
+        return 0;
+
+    // Look the tile up in the index
+    memset(&Key, 0, sizeof(Key));
+    Key.Level = pInfo->Level;
+    Key.X = pInfo->X;
+    Key.Y = pInfo->Y;
+
+    if ((pEntry = (const TerrainPackEntry_t *)bsearch(&Key, pPack->pIndex, pPack->Count, sizeof(TerrainPackEntry_t), CompareEntries)) == NULL)
+        return 0;
+
+    // Don't trust a tile that doesn't fit in the file or has no grid
+    if ((pEntry->Offset % 8) || (pEntry->Offset > pPack->Size - sizeof(TerrainPackTile_t)))
+        return 0;
+
+    pData = pPack->pData + pEntry->Offset;
+    pHeader = (const TerrainPackTile_t *)pData;
+    Cells = pHeader->GridSize * pHeader->GridSize;
+
+    if ((pHeader->GridSize == 0) || (pHeader->GridSize > 0xFFFF) || (GetTileSize(pHeader) > pPack->Size - pEntry->Offset))
+        return 0;
+
+    // Point the tile at the arrays, which are used just as they are in the file
+    memset(pTile, 0, sizeof(Tile_t));
+    pTile->Info = *pInfo;
+    pTile->MinHeight = pHeader->MinHeight;
+    pTile->MaxHeight = pHeader->MaxHeight;
+    pTile->Mapped = 1;
+
+    pData += sizeof(TerrainPackTile_t);
+    pTile->Vertices.Count = pHeader->VertexCount;
+    pTile->Vertices.pU = (uint16_t *)pData;
+    pTile->Vertices.pV = pTile->Vertices.pU + pHeader->VertexCount;
+    pTile->Vertices.pH = pTile->Vertices.pV + pHeader->VertexCount;
+
+    pData += pHeader->VertexCount * 3 * sizeof(uint16_t);
+    pTile->Triangles.Count = pHeader->TriangleCount;
+    pTile->Triangles.pIndices = (uint16_t *)pData;
+
+    pData += pHeader->TriangleCount * 3 * sizeof(uint16_t);
+    pData += (4 - (pData - pPack->pData) % 4) % 4;
+    pTile->Grid.Size = (int)pHeader->GridSize;
+    pTile->Grid.Lat = pHeader->Lat;
+    pTile->Grid.Lon = pHeader->Lon;
+    pTile->Grid.Scale = pHeader->Scale;
+    pTile->Grid.pStart = (uint32_t *)pData;
+    pTile->Grid.pTriangles = pTile->Grid.pStart + Cells + 1;
+
+    return 1;
+
+}// TerrainPackFind
+
+int TerrainPackCreate(TerrainPackWriter_t *pWriter, const char *pPath)
+{
+    TerrainPackHeader_t Header;
+
+    // Start off with no tiles
+    memset(pWriter, 0, sizeof(TerrainPackWriter_t));
+
+    if ((pWriter->pFile = fopen(pPath, "wb")) == NULL)
+        return 0;
+
+    // The header gets written again with the real count and index offset at the end
+    memset(&Header, 0, sizeof(Header));
+    memcpy(Header.Magic, Magic, sizeof(Magic));
+    Header.Version = TERRAIN_PACK_VERSION;
+
+    if (fwrite(&Header, sizeof(Header), 1, pWriter->pFile) != 1)
+    {
+        fclose(pWriter->pFile);
+        pWriter->pFile = NULL;
+        return 0;
+    }
+
+    pWriter->Offset = sizeof(Header);
+    return 1;
+
+}// TerrainPackCreate
+
+int TerrainPackAdd(TerrainPackWriter_t *pWriter, const Tile_t *pTile)
+{
+    uint32_t Cells = pTile->Grid.Size * pTile->Grid.Size, Count = pTile->Vertices.Count;
+    TerrainPackEntry_t *pEntry;
+    TerrainPackTile_t Header;
+    int Result = 1;
+
+    if (pWriter->pFile == NULL)
+        return 0;
+
+    // Make room in the index
+    if (pWriter->Count == pWriter->Capacity)
+    {
+        uint32_t Capacity = MAX(pWriter->Capacity * 2, 256);
+        TerrainPackEntry_t *pIndex = (TerrainPackEntry_t *)realloc(pWriter->pIndex, Capacity * sizeof(TerrainPackEntry_t));
+
+        if (pIndex == NULL)
+            return 0;
+
+        pWriter->pIndex = pIndex;
+        pWriter->Capacity = Capacity;
+    }
+
+    // Describe the tile
+    memset(&Header, 0, sizeof(Header));
+    Header.Lat = pTile->Grid.Lat;
+    Header.Lon = pTile->Grid.Lon;
+    Header.Scale = pTile->Grid.Scale;
+    Header.MinHeight = pTile->MinHeight;
+    Header.MaxHeight = pTile->MaxHeight;
+    Header.VertexCount = Count;
+    Header.TriangleCount = pTile->Triangles.Count;
+    Header.GridSize = (uint32_t)pTile->Grid.Size;
+    Header.GridTotal = pTile->Grid.pStart[Cells];
+
+    // Then write it out, array after array, in the same layout TerrainPackFind expects
+    pEntry = &pWriter->pIndex[pWriter->Count];
+    memset(pEntry, 0, sizeof(TerrainPackEntry_t));
+    pEntry->Level = pTile->Info.Level;
+    pEntry->X = pTile->Info.X;
+    pEntry->Y = pTile->Info.Y;
+    pEntry->Offset = pWriter->Offset;
+
+    Result &= fwrite(&Header, sizeof(Header), 1, pWriter->pFile) == 1;
+    Result &= fwrite(pTile->Vertices.pU, sizeof(uint16_t), Count, pWriter->pFile) == Count;
+    Result &= fwrite(pTile->Vertices.pV, sizeof(uint16_t), Count, pWriter->pFile) == Count;
+    Result &= fwrite(pTile->Vertices.pH, sizeof(uint16_t), Count, pWriter->pFile) == Count;
+    Result &= fwrite(pTile->Triangles.pIndices, sizeof(uint16_t) * 3, Header.TriangleCount, pWriter->pFile) == Header.TriangleCount;
+    pWriter->Offset += sizeof(Header) + (Count + Header.TriangleCount) * 3 * sizeof(uint16_t);
+
+    Result &= WritePadding(pWriter->pFile, &pWriter->Offset, 4);
+    Result &= fwrite(pTile->Grid.pStart, sizeof(uint32_t), Cells + 1, pWriter->pFile) == Cells + 1;
+    Result &= fwrite(pTile->Grid.pTriangles, sizeof(uint32_t), Header.GridTotal, pWriter->pFile) == Header.GridTotal;
+    pWriter->Offset += (Cells + 1 + Header.GridTotal) * sizeof(uint32_t);
+
+    // The next tile starts on an 8 byte boundary, for its doubles
+    Result &= WritePadding(pWriter->pFile, &pWriter->Offset, 8);
+
+    if (Result)
+        pWriter->Count++;
+
+    return Result;
+
+}// TerrainPackAdd
+
+int TerrainPackFinish(TerrainPackWriter_t *pWriter)
+{
+    TerrainPackHeader_t Header;
+    int Result = 1;
+
+    if (pWriter->pFile == NULL)
+        return 0;
+
+    // Sort the index so tiles can be found with a binary search, and write it at the end
+    qsort(pWriter->pIndex, pWriter->Count, sizeof(TerrainPackEntry_t), CompareEntries);
+    Result &= fwrite(pWriter->pIndex, sizeof(TerrainPackEntry_t), pWriter->Count, pWriter->pFile) == pWriter->Count;
+
+    // Now the header can say where the index is
+    memset(&Header, 0, sizeof(Header));
+    memcpy(Header.Magic, Magic, sizeof(Magic));
+    Header.Version = TERRAIN_PACK_VERSION;
+    Header.Count = pWriter->Count;
+    Header.IndexOffset = pWriter->Offset;
+
+    Result &= fseek(pWriter->pFile, 0, SEEK_SET) == 0;
+    Result &= fwrite(&Header, sizeof(Header), 1, pWriter->pFile) == 1;
+    Result &= fclose(pWriter->pFile) == 0;
+
+    // Done with the writer
+    free(pWriter->pIndex);
+    memset(pWriter, 0, sizeof(TerrainPackWriter_t));
+
+    return Result;
+
+}// TerrainPackFinish
+
+// Bytes a tile takes up in the file, not counting the padding after it
+static uint64_t GetTileSize(const TerrainPackTile_t *pTile)
+{
+    uint64_t Size = sizeof(TerrainPackTile_t) + ((uint64_t)pTile->VertexCount + pTile->TriangleCount) * 3 * sizeof(uint16_t);
+
+    // Tiles start on an 8 byte boundary, so padding the 16-bit arrays out to 4 bytes works out the same here
+    Size = (Size + 3) & ~(uint64_t)3;
+
+    return Size + ((uint64_t)pTile->GridSize * pTile->GridSize + 1 + pTile->GridTotal) * sizeof(uint32_t);
+
+}// GetTileSize
+
+// Orders index entries by level, then X, then Y
+static int CompareEntries(const void *pLeft, const void *pRight)
+{
+    const TerrainPackEntry_t *pA = (const TerrainPackEntry_t *)pLeft, *pB = (const TerrainPackEntry_t *)pRight;
+
+    if (pA->Level != pB->Level)
+        return (pA->Level < pB->Level) ? -1 : 1;
+    else if (pA->X != pB->X)
+        return (pA->X < pB->X) ? -1 : 1;
+    else if (pA->Y != pB->Y)
+        return (pA->Y < pB->Y) ? -1 : 1;
+    else
+        return 0;
+
+}// CompareEntries
+
+// Writes zeros until the file offset is a multiple of Alignment
+static int WritePadding(FILE *pFile, uint64_t *pOffset, uint32_t Alignment)
+{
+    static const uint8_t Zeros[8] = { 0 };
+    uint32_t Bytes = (uint32_t)((Alignment - *pOffset % Alignment) % Alignment);
+
+    *pOffset += Bytes;
+    return (Bytes == 0) || (fwrite(Zeros, 1, Bytes, pFile) == Bytes);
+
+}// WritePadding
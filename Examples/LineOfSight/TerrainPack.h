@@ -0,0 +1,106 @@
+#ifndef TERRAINPACK_H
+#define TERRAINPACK_H
+
+#include "LineOfSight.h"
+
+#include <stdio.h>
+#include <stddef.h>
+
+#ifdef _WIN32
+# include <windows.h>
+#endif // _WIN32
+
+// Preprocessed terrain tiles in a single file that gets memory-mapped and used in place. Each
+//   tile is stored already decoded, in the same quantized U/V/H form and with the same triangle
+//   grid that LineOfSight builds for a downloaded tile, so opening a pack and finding a tile in
+//   it costs a binary search and nothing else. Pages only get read in as queries touch them.
+//
+// The file is a TerrainPackHeader_t, then the tiles, then an index of TerrainPackEntry_t sorted
+//   by level, X and Y. Everything is in the host's byte order, so packs are built on the
+//   machine, or at least the architecture, that uses them.
+
+#define TERRAIN_PACK_VERSION 1
+
+typedef struct
+{
+    // "TPAK" and TERRAIN_PACK_VERSION, which also fails to match if the byte order is wrong
+    char Magic[4];
+    uint32_t Version;
+
+    // Number of tiles, and where their index starts
+    uint32_t Count;
+    uint32_t Reserved;
+    uint64_t IndexOffset;
+} TerrainPackHeader_t;
+
+typedef struct
+{
+    // Which tile this is, and where it starts in the file
+    int32_t Level;
+    int32_t X;
+    int32_t Y;
+    uint32_t Reserved;
+    uint64_t Offset;
+} TerrainPackEntry_t;
+
+typedef struct
+{
+    // LLA position of the tile center and the width of the tile, in radians
+    double Lat;
+    double Lon;
+    double Scale;
+
+    // Height range that the quantized heights span
+    float MinHeight;
+    float MaxHeight;
+
+    // Vertices, triangles, cells along each side of the grid, and entries in the grid's triangle lists.
+    //   These are followed by U, V and H for every vertex, three indices per triangle, then the
+    //   grid's list offsets and lists, the 32-bit arrays starting on a 4 byte boundary.
+    uint32_t VertexCount;
+    uint32_t TriangleCount;
+    uint32_t GridSize;
+    uint32_t GridTotal;
+} TerrainPackTile_t;
+
+typedef struct
+{
+    // The whole file, mapped read-only, and its index
+    const uint8_t *pData;
+    size_t Size;
+    const TerrainPackEntry_t *pIndex;
+    uint32_t Count;
+
+#ifdef _WIN32
+    // File and mapping handles, needed to unmap the file
+    HANDLE File;
+    HANDLE Mapping;
+#endif // _WIN32
+
+} TerrainPack_t;
+
+typedef struct
+{
+    FILE *pFile;
+
+    // Index entries so far, in the order the tiles were added, and where the next tile goes
+    TerrainPackEntry_t *pIndex;
+    uint32_t Count;
+    uint32_t Capacity;
+    uint64_t Offset;
+
+} TerrainPackWriter_t;
+
+// Returns 0 if the file couldn't be mapped or isn't a terrain pack
+int TerrainPackOpen(TerrainPack_t *pPack, const char *pPath);
+void TerrainPackClose(TerrainPack_t *pPack);
+
+// Fills in a tile whose arrays point straight into the pack, returns 0 if the pack doesn't have it
+int TerrainPackFind(const TerrainPack_t *pPack, const TileInfo_t *pInfo, Tile_t *pTile);
+
+// Writing a pack: create it, add decoded tiles one at a time, then finish it to write the index
+int TerrainPackCreate(TerrainPackWriter_t *pWriter, const char *pPath);
+int TerrainPackAdd(TerrainPackWriter_t *pWriter, const Tile_t *pTile);
+int TerrainPackFinish(TerrainPackWriter_t *pWriter);
+
+#endif // TERRAINPACK_H
@@ -0,0 +1,458 @@
+#include "TileCache.h"
+#include "Constants.h"
+#include "Atomics.h"
+
+#include <string.h>
+
+#ifdef _WIN32
+# define MutexInit(p)     InitializeCriticalSection(p)
+# define MutexFree(p)     DeleteCriticalSection(p)
+# define MutexLock(p)     EnterCriticalSection(p)
+# define MutexUnlock(p)   LeaveCriticalSection(p)
+# define CondInit(p)      InitializeConditionVariable(p)
+# define CondFree(p)
+# define CondWait(p, m)   SleepConditionVariableCS((p), (m), INFINITE)
+# define CondSignal(p)    WakeConditionVariable(p)
+# define CondBroadcast(p) WakeAllConditionVariable(p)
+#else
+# define MutexInit(p)     pthread_mutex_init((p), NULL)
+# define MutexFree(p)     pthread_mutex_destroy(p)
+# define MutexLock(p)     pthread_mutex_lock(p)
+# define MutexUnlock(p)   pthread_mutex_unlock(p)
+# define CondInit(p)      pthread_cond_init((p), NULL)
+# define CondFree(p)      pthread_cond_destroy(p)
+# define CondWait(p, m)   pthread_cond_wait((p), (m))
+# define CondSignal(p)    pthread_cond_signal(p)
+# define CondBroadcast(p) pthread_cond_broadcast(p)
+#endif // _WIN32
+
+static uint32_t HashTile(const TileInfo_t *pInfo);
+static int Lookup(const TileCache_t *pCache, const TileInfo_t *pInfo);
+static int Request(TileCache_t *pCache, const TileInfo_t *pInfo, int Demand);
+static void Promote(TileCache_t *pCache, int Index);
+static void Touch(TileCache_t *pCache, int Index);
+static void LruRemove(TileCache_t *pCache, int Index);
+static void LruInsert(TileCache_t *pCache, int Index);
+static void Trim(TileCache_t *pCache);
+static void Evict(TileCache_t *pCache, int Index);
+static void WorkerLoop(TileCache_t *pCache);
+
+#ifdef _WIN32
+static DWORD WINAPI WorkerThread(LPVOID pArg)
+#else
+static void *WorkerThread(void *pArg)
+#endif // _WIN32
+{
+    WorkerLoop((TileCache_t *)pArg);
+    return 0;
+
+}// WorkerThread
+
+int TileCacheInit(TileCache_t *pCache, size_t Budget, int Workers, TileLoader_t pLoad, TileFreer_t pFree, void *pUser)
+{
+    int i;
+
+    // Start out empty, with every entry on the free list and every bucket empty
+    memset(pCache, 0, sizeof(TileCache_t));
+    for (i = 0; i < TILE_CACHE_ENTRIES; i++)
+        pCache->Entries[i].HashNext = (i + 1 < TILE_CACHE_ENTRIES) ? i + 1 : -1;
+
+    for (i = 0; i < TILE_CACHE_BUCKETS; i++)
+        pCache->Buckets[i] = -1;
+
+    pCache->FreeList = 0;
+    pCache->LruHead = pCache->LruTail = -1;
+    pCache->Budget = Budget;
+    pCache->pLoad = pLoad;
+    pCache->pFree = pFree;
+    pCache->pUser = pUser;
+
+    MutexInit(&pCache->Mutex);
+    CondInit(&pCache->Cond);
+
+    // Start up as many workers as we can, up to the number asked for
+    for (i = 0; i < MIN(MAX(Workers, 1), TILE_CACHE_MAX_WORKERS); i++)
+    {
+#ifdef _WIN32
+        if ((pCache->Workers[i] = CreateThread(NULL, 0, WorkerThread, pCache, 0, NULL)) == NULL)
+            break;
+#else
+        if (pthread_create(&pCache->Workers[i], NULL, WorkerThread, pCache) != 0)
+            break;
+#endif // _WIN32
+
+        pCache->NumWorkers++;
+    }
+
+    // Without a single worker, nothing would ever get loaded
+    if (pCache->NumWorkers == 0)
+    {
+        CondFree(&pCache->Cond);
+        MutexFree(&pCache->Mutex);
+        return 0;
+    }
+
+    return 1;
+
+}// TileCacheInit
+
+void TileCacheSetFastLoader(TileCache_t *pCache, TileLoader_t pFastLoad)
+{
+    pCache->pFastLoad = pFastLoad;
+
+}// TileCacheSetFastLoader
+
+void TileCacheFree(TileCache_t *pCache)
+{
+    int i;
+
+    // Tell the workers to stop, then wait for them to finish whatever they're loading
+    MutexLock(&pCache->Mutex);
+    pCache->Stop = 1;
+    CondBroadcast(&pCache->Cond);
+    MutexUnlock(&pCache->Mutex);
+
+    for (i = 0; i < pCache->NumWorkers; i++)
+    {
+#ifdef _WIN32
+        WaitForSingleObject(pCache->Workers[i], INFINITE);
+        CloseHandle(pCache->Workers[i]);
+#else
+        pthread_join(pCache->Workers[i], NULL);
+#endif // _WIN32
+    }
+
+    // Now that nobody else is touching the tiles, free the loaded ones
+    for (i = 0; i < TILE_CACHE_ENTRIES; i++)
+    {
+        if (pCache->Entries[i].State == TILE_READY)
+            pCache->pFree(pCache->pUser, &pCache->Entries[i].Tile);
+    }
+
+    CondFree(&pCache->Cond);
+    MutexFree(&pCache->Mutex);
+    memset(pCache, 0, sizeof(TileCache_t));
+
+}// TileCacheFree
+
+TileState_t TileCacheGet(TileCache_t *pCache, const TileInfo_t *pInfo, const Tile_t **ppTile)
+{
+    int Index = Lookup(pCache, pInfo);
+    TileState_t State;
+
+    *ppTile = NULL;
+
+    // On a miss, ask for the tile and move on. If it couldn't even be queued, it's still just missing for now.
+    if (Index < 0)
+    {
+        pCache->Misses++;
+        return (Request(pCache, pInfo, 1) >= 0) ? TILE_QUEUED : TILE_FREE;
+    }
+
+    State = (TileState_t)atomicLoadAcquire32(&pCache->Entries[Index].State);
+
+    // Tiles that are done loading, one way or the other, count as hits
+    if ((State == TILE_READY) || (State == TILE_MISSING))
+    {
+        pCache->Hits++;
+        Touch(pCache, Index);
+
+        if (State == TILE_READY)
+            *ppTile = &pCache->Entries[Index].Tile;
+    }
+    // Anything still on its way is needed now, so move it ahead of the prefetches
+    else
+    {
+        pCache->Misses++;
+        Promote(pCache, Index);
+    }
+
+    return State;
+
+}// TileCacheGet
+
+const Tile_t *TileCacheFind(TileCache_t *pCache, const TileInfo_t *pInfo)
+{
+    int Index = Lookup(pCache, pInfo);
+
+    // Only tiles that are ready count
+    if ((Index < 0) || (atomicLoadAcquire32(&pCache->Entries[Index].State) != TILE_READY))
+        return NULL;
+
+    Touch(pCache, Index);
+    return &pCache->Entries[Index].Tile;
+
+}// TileCacheFind
+
+void TileCachePrefetch(TileCache_t *pCache, const TileInfo_t *pInfo)
+{
+    // Anything already in the cache, loaded or not, is taken care of
+    if (Lookup(pCache, pInfo) < 0)
+        Request(pCache, pInfo, 0);
+
+}// TileCachePrefetch
+
+// Spreads the tile level and index over the hash buckets
+static uint32_t HashTile(const TileInfo_t *pInfo)
+{
+    return (((uint32_t)pInfo->X * 73856093u) ^ ((uint32_t)pInfo->Y * 19349663u) ^ ((uint32_t)pInfo->Level * 83492791u)) % TILE_CACHE_BUCKETS;
+
+}// HashTile
+
+// Returns the entry index of a tile, or -1 if the cache doesn't know about it
+static int Lookup(const TileCache_t *pCache, const TileInfo_t *pInfo)
+{
+    int Index;
+
+    for (Index = pCache->Buckets[HashTile(pInfo)]; Index >= 0; Index = pCache->Entries[Index].HashNext)
+    {
+        const TileInfo_t *pKey = &pCache->Entries[Index].Key;
+
+        if ((pKey->X == pInfo->X) && (pKey->Y == pInfo->Y) && (pKey->Level == pInfo->Level))
+            return Index;
+    }
+
+    return -1;
+
+}// Lookup
+
+// Adds a new tile to the cache and queues it for the workers, returns its entry index or -1 if there's no room
+static int Request(TileCache_t *pCache, const TileInfo_t *pInfo, int Demand)
+{
+    TileCacheEntry_t *pEntry;
+    uint32_t Bucket;
+    int Index;
+
+    // Get under budget first, which also frees up an entry if there aren't any
+    Trim(pCache);
+
+    MutexLock(&pCache->Mutex);
+
+    // If there's no entry, give up on this one for now
+    if (pCache->FreeList < 0)
+    {
+        MutexUnlock(&pCache->Mutex);
+        pCache->Dropped++;
+        return -1;
+    }
+
+    // Set up the entry at the head of the free list for this tile
+    Index = pCache->FreeList;
+    pEntry = &pCache->Entries[Index];
+
+    memset(&pEntry->Tile, 0, sizeof(Tile_t));
+    pEntry->Key = pEntry->Tile.Info = *pInfo;
+    pEntry->Bytes = 0;
+    pEntry->Demanded = Demand;
+
+    // Tiles the fast loader has are ready straight away, without bothering the workers
+    if ((pCache->pFastLoad != NULL) && ((pEntry->Bytes = pCache->pFastLoad(pCache->pUser, pInfo, &pEntry->Tile)) != 0))
+    {
+        pCache->Bytes += pEntry->Bytes;
+        pCache->Loads++;
+        atomicStoreRelease32(&pEntry->State, TILE_READY);
+    }
+    // Otherwise it's up to the workers, as long as there's room in the queue
+    else if (( Demand && (pCache->DemandIn - pCache->DemandOut >= TILE_CACHE_DEMAND_QUEUE)) ||
+             (!Demand && (pCache->PrefetchIn - pCache->PrefetchOut >= TILE_CACHE_PREFETCH_QUEUE)))
+    {
+        MutexUnlock(&pCache->Mutex);
+        pCache->Dropped++;
+        return -1;
+    }
+    else
+    {
+        atomicStoreRelease32(&pEntry->State, TILE_QUEUED);
+
+        if (Demand)
+            pCache->Demand[pCache->DemandIn++ % TILE_CACHE_DEMAND_QUEUE] = Index;
+        else
+            pCache->Prefetch[pCache->PrefetchIn++ % TILE_CACHE_PREFETCH_QUEUE] = Index;
+
+        CondSignal(&pCache->Cond);
+    }
+
+    // Take the entry off the free list now that it's being used
+    pCache->FreeList = pEntry->HashNext;
+    MutexUnlock(&pCache->Mutex);
+
+    // Finally, file it in its bucket and at the front of the LRU list
+    Bucket = HashTile(pInfo);
+    pEntry->HashNext = pCache->Buckets[Bucket];
+    pCache->Buckets[Bucket] = Index;
+    LruInsert(pCache, Index);
+
+    return Index;
+
+}// Request
+
+// Queues a prefetched tile that's now needed as a demand miss, if a worker hasn't picked it up yet
+static void Promote(TileCache_t *pCache, int Index)
+{
+    TileCacheEntry_t *pEntry = &pCache->Entries[Index];
+
+    if (pEntry->Demanded)
+        return;
+
+    MutexLock(&pCache->Mutex);
+
+    // Whichever queue a worker gets to first wins, and the other one finds it already taken
+    if ((pEntry->State == TILE_QUEUED) && (pCache->DemandIn - pCache->DemandOut < TILE_CACHE_DEMAND_QUEUE))
+    {
+        pCache->Demand[pCache->DemandIn++ % TILE_CACHE_DEMAND_QUEUE] = Index;
+        pEntry->Demanded = 1;
+        CondSignal(&pCache->Cond);
+    }
+
+    MutexUnlock(&pCache->Mutex);
+
+}// Promote
+
+// Moves an entry to the front of the LRU list
+static void Touch(TileCache_t *pCache, int Index)
+{
+    if (pCache->LruHead != Index)
+    {
+        LruRemove(pCache, Index);
+        LruInsert(pCache, Index);
+    }
+
+}// Touch
+
+static void LruRemove(TileCache_t *pCache, int Index)
+{
+    TileCacheEntry_t *pEntry = &pCache->Entries[Index];
+
+    // Point the neighbors at each other, or at the ends of the list
+    if (pEntry->LruPrev >= 0)
+        pCache->Entries[pEntry->LruPrev].LruNext = pEntry->LruNext;
+    else
+        pCache->LruHead = pEntry->LruNext;
+
+    if (pEntry->LruNext >= 0)
+        pCache->Entries[pEntry->LruNext].LruPrev = pEntry->LruPrev;
+    else
+        pCache->LruTail = pEntry->LruPrev;
+
+}// LruRemove
+
+static void LruInsert(TileCache_t *pCache, int Index)
+{
+    TileCacheEntry_t *pEntry = &pCache->Entries[Index];
+
+    // New and recently used entries go at the front
+    pEntry->LruPrev = -1;
+    pEntry->LruNext = pCache->LruHead;
+
+    if (pCache->LruHead >= 0)
+        pCache->Entries[pCache->LruHead].LruPrev = Index;
+    else
+        pCache->LruTail = Index;
+
+    pCache->LruHead = Index;
+
+}// LruInsert
+
+// Evicts the least recently used tiles until the cache is under budget and has a free entry
+static void Trim(TileCache_t *pCache)
+{
+    int Index;
+
+    MutexLock(&pCache->Mutex);
+
+    // Start at the back of the LRU list, skipping tiles the workers still have
+    for (Index = pCache->LruTail; (Index >= 0) && ((pCache->Bytes > pCache->Budget) || (pCache->FreeList < 0)); )
+    {
+        int Prev = pCache->Entries[Index].LruPrev;
+        int State = pCache->Entries[Index].State;
+
+        if ((State == TILE_READY) || (State == TILE_MISSING))
+            Evict(pCache, Index);
+
+        Index = Prev;
+    }
+
+    MutexUnlock(&pCache->Mutex);
+
+}// Trim
+
+// Throws a tile out of the cache, with the mutex held
+static void Evict(TileCache_t *pCache, int Index)
+{
+    TileCacheEntry_t *pEntry = &pCache->Entries[Index];
+    int *pLink = &pCache->Buckets[HashTile(&pEntry->Key)];
+
+    // Free the tile's data and stop counting it against the budget
+    if (pEntry->State == TILE_READY)
+        pCache->pFree(pCache->pUser, &pEntry->Tile);
+
+    pCache->Bytes -= pEntry->Bytes;
+    pCache->Evictions++;
+
+    // Any stale queue slots still pointing here will see that the entry isn't queued any more
+    atomicStoreRelease32(&pEntry->State, TILE_FREE);
+
+    // Unlink it from its bucket and the LRU list, and put it back on the free list
+    while (*pLink != Index)
+        pLink = &pCache->Entries[*pLink].HashNext;
+
+    *pLink = pEntry->HashNext;
+    LruRemove(pCache, Index);
+    pEntry->HashNext = pCache->FreeList;
+    pCache->FreeList = Index;
+
+}// Evict
+
+// Worker thread body: load queued tiles, demand misses first, until told to stop
+static void WorkerLoop(TileCache_t *pCache)
+{
+    MutexLock(&pCache->Mutex);
+
+    for (;;)
+    {
+        TileCacheEntry_t *pEntry;
+        TileInfo_t Info;
+        size_t Bytes;
+        int Index;
+
+        // Wait for something to do
+        while (!pCache->Stop && (pCache->DemandIn == pCache->DemandOut) && (pCache->PrefetchIn == pCache->PrefetchOut))
+            CondWait(&pCache->Cond, &pCache->Mutex);
+
+        if (pCache->Stop)
+            break;
+
+        if (pCache->DemandIn != pCache->DemandOut)
+            Index = pCache->Demand[pCache->DemandOut++ % TILE_CACHE_DEMAND_QUEUE];
+        else
+            Index = pCache->Prefetch[pCache->PrefetchOut++ % TILE_CACHE_PREFETCH_QUEUE];
+
+        // Skip entries that another worker already took, or that have been evicted since
+        pEntry = &pCache->Entries[Index];
+        if (pEntry->State != TILE_QUEUED)
+            continue;
+
+        // Claim the tile, then load it without holding up anyone else
+        atomicStoreRelease32(&pEntry->State, TILE_LOADING);
+        Info = pEntry->Tile.Info;
+        MutexUnlock(&pCache->Mutex);
+
+        Bytes = pCache->pLoad(pCache->pUser, &Info, &pEntry->Tile);
+        pEntry->Tile.Info = Info;
+        pEntry->Bytes = Bytes;
+
+        // Count it, then publish it. A loader that comes up empty leaves nothing to free.
+        MutexLock(&pCache->Mutex);
+        pCache->Bytes += Bytes;
+
+        if (Bytes)
+            pCache->Loads++;
+        else
+            pCache->Failures++;
+
+        atomicStoreRelease32(&pEntry->State, Bytes ? TILE_READY : TILE_MISSING);
+    }
+
+    MutexUnlock(&pCache->Mutex);
+
+}// WorkerLoop
@@ -0,0 +1,138 @@
+#ifndef TILECACHE_H
+#define TILECACHE_H
+
+#include "LineOfSight.h"
+
+#include <stddef.h>
+
+#ifdef _WIN32
+# include <windows.h>
+typedef HANDLE TileThread_t;
+typedef CRITICAL_SECTION TileMutex_t;
+typedef CONDITION_VARIABLE TileCond_t;
+#else
+# include <pthread.h>
+typedef pthread_t TileThread_t;
+typedef pthread_mutex_t TileMutex_t;
+typedef pthread_cond_t TileCond_t;
+#endif // _WIN32
+
+// Terrain tile cache that never makes its caller wait. Tiles are found by hashing their level
+//   and X/Y index, a miss queues the tile for a pool of worker threads to fetch and decode and
+//   returns right away, and the least recently used tiles are thrown out once the cache goes
+//   over its memory budget. Demand misses are loaded ahead of prefetches.
+//
+// Everything except the workers runs on one thread, which owns the hash table and the LRU list
+//   and is the only one that evicts. That lets lookups skip the lock entirely: the workers only
+//   ever touch a tile between the owner queueing it and the worker publishing it as ready.
+
+// Most tiles the cache keeps track of, including ones waiting to be loaded, and the hash table size
+#define TILE_CACHE_ENTRIES  256
+#define TILE_CACHE_BUCKETS  512
+
+// Most tiles waiting on the workers, for demand misses and prefetches
+#define TILE_CACHE_DEMAND_QUEUE     32
+#define TILE_CACHE_PREFETCH_QUEUE   64
+
+// Most worker threads
+#define TILE_CACHE_MAX_WORKERS 16
+
+typedef enum
+{
+    TILE_FREE,      // Entry isn't in use
+    TILE_QUEUED,    // Waiting for a worker
+    TILE_LOADING,   // A worker is fetching and decoding it
+    TILE_READY,     // Loaded and ready to use
+    TILE_MISSING    // Failed to load, which is remembered so it doesn't get fetched over and over
+} TileState_t;
+
+// Loads a tile, returning the number of bytes it takes up or 0 if there's no data for it. Called
+//   from the worker threads, so it mustn't touch anything shared.
+typedef size_t (*TileLoader_t)(void *pUser, const TileInfo_t *pInfo, Tile_t *pTile);
+
+// Frees whatever the loader allocated for a tile, on the owner thread
+typedef void (*TileFreer_t)(void *pUser, Tile_t *pTile);
+
+typedef struct
+{
+    // The tile this entry is for, which only the owner thread touches, and the tile itself
+    TileInfo_t Key;
+    Tile_t Tile;
+
+    // Load state, written with release semantics by whoever changes it, and bytes used once it's loaded
+    volatile uint32_t State;
+    size_t Bytes;
+
+    // Next entry in this entry's hash bucket (or the free list), and its neighbors in the LRU list
+    int HashNext;
+    int LruPrev;
+    int LruNext;
+
+    // Set once it's been queued for a demand miss, so it doesn't get queued again
+    int Demanded;
+
+} TileCacheEntry_t;
+
+typedef struct
+{
+    // Every entry, the head of each hash bucket, and unused entries in a list starting at FreeList
+    TileCacheEntry_t Entries[TILE_CACHE_ENTRIES];
+    int Buckets[TILE_CACHE_BUCKETS];
+    int FreeList;
+
+    // Most recently used entry first, and the number of bytes the loaded tiles take up versus the budget
+    int LruHead;
+    int LruTail;
+    size_t Bytes;
+    size_t Budget;
+
+    // Loader and freer callbacks, and the user pointer handed to them. The fast loader, if there
+    //   is one, gets a try at each tile on the owner thread before it's queued for the workers.
+    TileLoader_t pLoad;
+    TileLoader_t pFastLoad;
+    TileFreer_t pFree;
+    void *pUser;
+
+    // Work queues of entry indices, guarded by Mutex along with Stop, Bytes, Loads and Failures.
+    //   Workers wait on Cond.
+    TileMutex_t Mutex;
+    TileCond_t Cond;
+    int Demand[TILE_CACHE_DEMAND_QUEUE];
+    int Prefetch[TILE_CACHE_PREFETCH_QUEUE];
+    uint32_t DemandIn, DemandOut;
+    uint32_t PrefetchIn, PrefetchOut;
+    int Stop;
+
+    TileThread_t Workers[TILE_CACHE_MAX_WORKERS];
+    int NumWorkers;
+
+    // Lookups that found a tile and ones that didn't, requests that couldn't be queued, and
+    //   tiles thrown out to stay under budget. Loads and Failures are counted by the workers.
+    uint32_t Hits;
+    uint32_t Misses;
+    uint32_t Dropped;
+    uint32_t Evictions;
+    uint32_t Loads;
+    uint32_t Failures;
+
+} TileCache_t;
+
+// Returns 0 if the cache couldn't be set up
+int TileCacheInit(TileCache_t *pCache, size_t Budget, int Workers, TileLoader_t pLoad, TileFreer_t pFree, void *pUser);
+void TileCacheFree(TileCache_t *pCache);
+
+// Set a loader for tiles that are cheap enough to load without a worker, like ones that are
+//   already sitting in memory. It runs on the owner thread and returns 0 for tiles it doesn't have.
+void TileCacheSetFastLoader(TileCache_t *pCache, TileLoader_t pFastLoad);
+
+// Look up a tile, queueing it for loading if it isn't in the cache yet. *ppTile is set for
+//   ready tiles, and stays valid until the next call into the cache.
+TileState_t TileCacheGet(TileCache_t *pCache, const TileInfo_t *pInfo, const Tile_t **ppTile);
+
+// Look up a tile without asking for it to be loaded, returns NULL unless it's ready
+const Tile_t *TileCacheFind(TileCache_t *pCache, const TileInfo_t *pInfo);
+
+// Ask for a tile to be loaded in the background if it isn't already cached
+void TileCachePrefetch(TileCache_t *pCache, const TileInfo_t *pInfo);
+
+#endif // TILECACHE_H
@@ -8,48 +8,42 @@
 #include "linearalgebra.h"
 #include "earthposition.h"
 #include "OrionComm.h"
+#include "PathStream.h"
 
-static int GetPathData(OrionPath_t *pPath);
+static int GetPathData(PathStream_t *pStream, const OrionPath_t *pSettings);
 static void KillProcess(const char *pMessage, int Value);
 static void ProcessArgs(int argc, char **argv, OrionPath_t *pPath);
+static void HandleGeolocate(OrionCommContext_t *pContext, const OrionPkt_t *pPkt, void *pUser);
 
-static OrionPkt_t PktIn, PktOut;
+static OrionPkt_t PktOut;
 
 int main(int argc, char **argv)
 {
     OrionPath_t Path = { 0 };
+    PathStream_t Stream;
+    OrionCommLoop_t Loop;
 
     // Process the command line arguments
     ProcessArgs(argc, argv, &Path);
 
-    // Grab the path points (up to 15) from path.csv
-    if (GetPathData(&Path))
+    // Grab the whole route from path.csv, however long it is
+    if (GetPathData(&Stream, &Path) && pathStreamStart(&Stream, &PktOut))
     {
-        // Now encode and send the path to the gimbal
-        encodeOrionPathPacketStructure(&PktOut, &Path);
+        // Now send the start of the route to the gimbal, the rest gets sent as the gimbal moves along it
         OrionCommSend(&PktOut);
 
-        // Now just loop forever, looking for packets
-        while (1)
-        {
-            // Pull any pending packets off the comm port
-            while (OrionCommReceive(&PktIn))
-            {
-                GeolocateTelemetryCore_t Geo;
-
-                // If this is a valid geolocate telemetry packet
-                if (decodeGeolocateTelemetryCorePacketStructure(&PktIn, &Geo))
-                {
-                    // Print the current path segment information
-                    printf("Path segment: from point %2d to point %2d (%3.0f%%), stare time = %.1f\r", Geo.pathFrom, Geo.pathTo, Geo.pathProgress * 100.0f, Geo.stareTime);
-                }
+        // Set up an event loop that calls HandleGeolocate for each geolocate telemetry packet
+        if (!OrionCommLoopInit(&Loop) || !OrionCommLoopAdd(&Loop, OrionCommGetDefaultContext()))
+            KillProcess("Failed to start the event loop", 1);
 
-            }
+        OrionCommLoopSetHandler(&Loop, getGeolocateTelemetryCorePacketID(), HandleGeolocate, &Stream);
 
-            // Give the rest of the system 20ms to work
+        // Now just sleep until packets arrive and dispatch them, for as long as the gimbal stays connected
+        while (OrionCommIsOpen() && (OrionCommLoopRun(&Loop, -1) >= 0))
             fflush(stdout);
-            usleep(20000);
-        }
+
+        OrionCommLoopFree(&Loop);
+        free(Stream.pPoints);
     }
     // Path.numPoints is zero for some reason
     else
@@ -59,6 +53,26 @@ int main(int argc, char **argv)
     return 0;
 }
 
+// Event loop callback for geolocate telemetry packets
+static void HandleGeolocate(OrionCommContext_t *pContext, const OrionPkt_t *pPkt, void *pUser)
+{
+    PathStream_t *pStream = (PathStream_t *)pUser;
+    GeolocateTelemetryCore_t Geo;
+
+    // If this is a valid geolocate telemetry packet
+    if (decodeGeolocateTelemetryCorePacketStructure(pPkt, &Geo))
+    {
+        // Send the gimbal the next part of the route if it's getting close to the end of what it has
+        if (pathStreamUpdate(pStream, &Geo, &PktOut))
+            OrionCommSendEx(pContext, &PktOut);
+
+        // Print the current path segment information, numbered along the whole route
+        printf("Path segment: from point %4d to point %4d of %d (%3.0f%%), stare time = %.1f, %u uploads%s\r", pStream->From, pStream->To,
+               pStream->NumPoints, pStream->Progress * 100.0f, Geo.stareTime, pStream->Uploads, pathStreamFinished(pStream) ? ", done" : "");
+    }
+
+}// HandleGeolocate
+
 // This function just shuts things down consistently with a nice message for the user
 static void KillProcess(const char *pMessage, int Value)
 {
@@ -99,31 +113,51 @@ static void ProcessArgs(int argc, char **argv, OrionPath_t *pPath)
 
 }// ProcessArgs
 
-static int GetPathData(OrionPath_t *pPath)
+static int GetPathData(PathStream_t *pStream, const OrionPath_t *pSettings)
 {
     FILE *pFile = fopen("path.csv", "r");
+    double (*pLla)[NLLA] = NULL;
+    Point_t *pPoints;
+    int Count = 0, Max = 0;
 
     // If the file can actually be opened
     if (pFile != NULL)
     {
-        double Ecef[NECEF], Lla[NLLA];
         char Buffer[64];
 
         // Read as many lines out as possible
         while (!feof(pFile) && fgets(Buffer, sizeof(Buffer), pFile))
         {
-            // If this line seems to contain an LLA point and we haven't filled this path segment yet
-            if ((fscanf(pFile, "%lf, %lf, %lf", &Lla[LAT], &Lla[LON], &Lla[ALT]) == 3) && (pPath->numPoints < MAX_PATH_POINTS))
+            double Lla[NLLA];
+
+            // If this line seems to contain an LLA point
+            if (fscanf(pFile, "%lf, %lf, %lf", &Lla[LAT], &Lla[LON], &Lla[ALT]) == 3)
             {
-                // Grab a pointer to the current path point and increment the point count
-                Point_t *pPoint = &pPath->Point[pPath->numPoints++];
+                // Make room for more points as the route grows
+                if (Count == Max)
+                {
+                    double (*pGrown)[NLLA] = realloc(pLla, (Max ? Max * 2 : 256) * sizeof(pLla[0]));
+
+                    // If there's no more memory, give up on the whole route rather than fly part of it
+                    if (pGrown == NULL)
+                    {
+                        printf("Out of memory reading point %d\n", Count + 1);
+                        Count = 0;
+                        break;
+                    }
+
+                    pLla = pGrown;
+                    Max = Max ? Max * 2 : 256;
+                }
 
-                // Convert from LLA to ECEF, then down-cast the vector to single-precision
-                llaToECEF(Lla, Ecef);
-                vector3Convert(Ecef, pPoint->posEcef);
+                // The file is in degrees, but the conversion to ECEF works in radians
+                pLla[Count][LAT] = radians(Lla[LAT]);
+                pLla[Count][LON] = radians(Lla[LON]);
+                pLla[Count][ALT] = Lla[ALT];
+                Count++;
 
                 // Print the point index and location out for the user
-                printf("POINT %2d: %10.6lf, %11.6lf, %.0lf\n", pPath->numPoints, Lla[LAT], Lla[LON], Lla[ALT]);
+                printf("POINT %4d: %10.6lf, %11.6lf, %.0lf\n", Count, Lla[LAT], Lla[LON], Lla[ALT]);
             }
         }
 
@@ -131,7 +165,20 @@ static int GetPathData(OrionPath_t *pPath)
         fclose(pFile);
     }
 
+    // Convert the whole route to ECEF in one go, so sending each part of it is just a copy
+    pPoints = (Count > 0) ? malloc(Count * sizeof(Point_t)) : NULL;
+
+    if (pathStreamInit(pStream, pPoints, Count, pSettings))
+        pathStreamAddLla(pStream, (const double (*)[NLLA])pLla, Count);
+    else
+    {
+        free(pPoints);
+        Count = 0;
+    }
+
+    free(pLla);
+
     // Return the number of points we got from the file
-    return pPath->numPoints;
+    return Count;
 
 }// GetPathData
@@ -0,0 +1,143 @@
+#include "OrionPublicPacket.h"
+#include "OrionComm.h"
+#include "OrionCommMulticast.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// A few helper functions, etc.
+static void KillProcess(const char *pMessage, int Value);
+static void ProcessArgs(int argc, char **argv, BOOL *pListen, const char **ppGroup, UInt16 *pPort);
+static void RunRelay(const char *pGroup, UInt16 Port);
+static void RunListener(const char *pGroup, UInt16 Port);
+
+int main(int argc, char **argv)
+{
+    const char *pGroup = ORION_COMM_MULTICAST_GROUP;
+    UInt16 Port = ORION_COMM_MULTICAST_PORT;
+    BOOL Listen = FALSE;
+
+    // Process the command line arguments, which connects to the gimbal unless we're just listening
+    ProcessArgs(argc, argv, &Listen, &pGroup, &Port);
+
+    // Then either pass the gimbal's packets on to the group, or print what comes in from it
+    if (Listen)
+        RunListener(pGroup, Port);
+    else
+        RunRelay(pGroup, Port);
+
+    // Done
+    return 0;
+
+}// main
+
+// Republish everything the gimbal sends to a multicast group
+static void RunRelay(const char *pGroup, UInt16 Port)
+{
+    OrionCommPublisher_t Publisher;
+    OrionCommLoop_t Loop;
+    UInt32 LastFrames = 0;
+
+    // Open a publisher that can cross a couple of routers, and relay every received packet through it
+    if (!OrionCommPublisherOpen(&Publisher, pGroup, Port, NULL, 4))
+        KillProcess("Failed to open the multicast publisher", 1);
+
+    OrionCommRelay(&Publisher);
+
+    // The event loop does the receiving, and packets are published as they're received
+    if (!OrionCommLoopInit(&Loop) || !OrionCommLoopAdd(&Loop, OrionCommGetDefaultContext()))
+        KillProcess("Failed to start the event loop", 1);
+
+    printf("Relaying to %s:%u\n", pGroup, Port);
+
+    // Loop for as long as the gimbal stays connected
+    while (OrionCommIsOpen())
+    {
+        if (OrionCommLoopRun(&Loop, 1000) < 0)
+            break;
+
+        // Print how busy the relay has been about once a second
+        printf("\r%u frames/s in %u datagrams, %u dropped  ", Publisher.FramesSent - LastFrames, Publisher.DatagramsSent, Publisher.SendErrors);
+        LastFrames = Publisher.FramesSent;
+        fflush(stdout);
+    }
+
+    // Done
+    OrionCommRelay(NULL);
+    OrionCommPublisherClose(&Publisher);
+    OrionCommLoopFree(&Loop);
+
+}// RunRelay
+
+// Print the telemetry being published to a multicast group
+static void RunListener(const char *pGroup, UInt16 Port)
+{
+    OrionCommSubscriber_t Subscriber;
+    GeolocateTelemetryCore_t Geo;
+    OrionPkt_t Pkts[32];
+    int i, Count;
+
+    // Join the group
+    if (!OrionCommSubscriberOpen(&Subscriber, pGroup, Port, NULL))
+        KillProcess("Failed to join the multicast group", 1);
+
+    printf("Listening to %s:%u\n", pGroup, Port);
+
+    // Keep going until the user gives up
+    while ((Count = OrionCommSubscriberReceive(&Subscriber, Pkts, 32, -1)) >= 0)
+    {
+        for (i = 0; i < Count; i++)
+        {
+            // Print the position and pointing out of each telemetry packet, along with how much got lost on the way
+            if (decodeGeolocateTelemetryCorePacketStructure(&Pkts[i], &Geo))
+            {
+                printf("\rLat %10.6lf, Lon %11.6lf, Pan %7.2f, Tilt %7.2f - %u frames, %u lost  ",
+                       degrees(Geo.posLat), degrees(Geo.posLon), degreesf(Geo.pan), degreesf(Geo.tilt),
+                       Subscriber.FramesReceived, Subscriber.FramesLost);
+                fflush(stdout);
+            }
+        }
+    }
+
+    // Done
+    OrionCommSubscriberClose(&Subscriber);
+
+}// RunListener
+
+// This function just shuts things down consistently with a nice message for the user
+static void KillProcess(const char *pMessage, int Value)
+{
+    // Print out the error message that got us here
+    printf("%s\n", pMessage);
+    fflush(stdout);
+
+    // Close down the active file descriptors
+    OrionCommClose();
+
+    // Finally exit with the proper return value
+    exit(Value);
+
+}// KillProcess
+
+static void ProcessArgs(int argc, char **argv, BOOL *pListen, const char **ppGroup, UInt16 *pPort)
+{
+    // Listeners don't talk to the gimbal at all
+    if ((argc > 1) && (strcmp(argv[1], "listen") == 0))
+    {
+        *pListen = TRUE;
+        argc--;
+        argv = &argv[1];
+    }
+    // If we can't connect to a gimbal, kill the app right now
+    else if (OrionCommOpen(&argc, &argv) == FALSE)
+        KillProcess("", 1);
+
+    // If the user specified a multicast group, and maybe a port
+    if (argc > 1)
+        *ppGroup = argv[1];
+
+    if (argc > 2)
+        *pPort = (UInt16)atoi(argv[2]);
+
+}// ProcessArgs
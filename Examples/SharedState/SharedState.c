@@ -0,0 +1,151 @@
+#include "OrionPublicPacket.h"
+#include "OrionComm.h"
+#include "OrionCommShared.h"
+#include "GeolocateTelemetry.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// A few helper functions, etc.
+static void KillProcess(const char *pMessage, int Value);
+static void ProcessArgs(int argc, char **argv, BOOL *pRead, const char **ppName);
+static void RunWriter(const char *pName);
+static void RunReader(const char *pName);
+
+// Typed readers for the packets that get decoded straight out of the store
+ORION_COMM_SHARED_DECODER(OrionCameraState, OrionCameraState_t)
+ORION_COMM_SHARED_DECODER(OrionLaserStates, OrionLaserStates_t)
+
+int main(int argc, char **argv)
+{
+    const char *pName = ORION_COMM_SHARED_NAME;
+    BOOL Read = FALSE;
+
+    // Process the command line arguments, which connects to the gimbal unless we're just reading
+    ProcessArgs(argc, argv, &Read, &pName);
+
+    // Then either keep the store up to date, or print what's in it
+    if (Read)
+        RunReader(pName);
+    else
+        RunWriter(pName);
+
+    // Done
+    return 0;
+
+}// main
+
+// Write every packet the gimbal sends to the store
+static void RunWriter(const char *pName)
+{
+    OrionCommShared_t Shared;
+    OrionCommLoop_t Loop;
+
+    // Create the store and have every received packet written to it
+    if (!OrionCommSharedCreate(&Shared, pName))
+        KillProcess("Failed to create the shared memory store", 1);
+
+    OrionCommShare(&Shared);
+
+    // The event loop does the receiving, and the store gets written as packets are received
+    if (!OrionCommLoopInit(&Loop) || !OrionCommLoopAdd(&Loop, OrionCommGetDefaultContext()))
+        KillProcess("Failed to start the event loop", 1);
+
+    printf("Writing to %s\n", pName);
+
+    // Loop for as long as the gimbal stays connected
+    while (OrionCommIsOpen())
+    {
+        if (OrionCommLoopRun(&Loop, 1000) < 0)
+            break;
+    }
+
+    // Done
+    OrionCommShare(NULL);
+    OrionCommSharedClose(&Shared);
+    OrionCommLoopFree(&Loop);
+
+}// RunWriter
+
+// Print the gimbal's current state out of the store ten times a second
+static void RunReader(const char *pName)
+{
+    OrionCommShared_t Shared;
+    UInt32 Sequence = 0;
+
+    // Open the store, which the writer has to have created already
+    if (!OrionCommSharedOpen(&Shared, pName))
+        KillProcess("Failed to open the shared memory store", 1);
+
+    printf("Reading from %s, written by protocol version %s\n", pName, Shared.pHeader->Protocol);
+
+    while (1)
+    {
+        GeolocateTelemetry_t Geo;
+        OrionCameraState_t Camera;
+        OrionLaserStates_t Lasers;
+        OrionPkt_t Pkt;
+        UInt64 Time;
+
+        // Only bother decoding telemetry when there's a new packet
+        if (OrionCommSharedSequence(&Shared, getGeolocateTelemetryCorePacketID()) != Sequence)
+        {
+            Sequence = OrionCommSharedSequence(&Shared, getGeolocateTelemetryCorePacketID());
+
+            // Geolocate telemetry has its own decoder that fills in the derived fields
+            if (OrionCommSharedRead(&Shared, getGeolocateTelemetryCorePacketID(), &Pkt, &Time) && DecodeGeolocateTelemetry(&Pkt, &Geo))
+            {
+                printf("\rLat %10.6lf, Lon %11.6lf, Pan %7.2f, Tilt %7.2f, %5.1f ms old", degrees(Geo.base.posLat), degrees(Geo.base.posLon),
+                       degreesf(Geo.base.pan), degreesf(Geo.base.tilt), (OrionCommStatsTime() - Time) / 1000.0);
+            }
+
+            // Everything else goes through the typed readers, which call the generated decode functions
+            if (OrionCommSharedDecodeOrionCameraState(&Shared, &Camera, NULL))
+                printf(", Camera %d zoom %4.1f", Camera.Index, Camera.Zoom);
+
+            if (OrionCommSharedDecodeOrionLaserStates(&Shared, &Lasers, NULL))
+                printf(", %d lasers", Lasers.NumLasers);
+
+            printf("  ");
+            fflush(stdout);
+        }
+
+        usleep(100000);
+    }
+
+}// RunReader
+
+// This function just shuts things down consistently with a nice message for the user
+static void KillProcess(const char *pMessage, int Value)
+{
+    // Print out the error message that got us here
+    printf("%s\n", pMessage);
+    fflush(stdout);
+
+    // Close down the active file descriptors
+    OrionCommClose();
+
+    // Finally exit with the proper return value
+    exit(Value);
+
+}// KillProcess
+
+static void ProcessArgs(int argc, char **argv, BOOL *pRead, const char **ppName)
+{
+    // Readers don't talk to the gimbal at all
+    if ((argc > 1) && (strcmp(argv[1], "read") == 0))
+    {
+        *pRead = TRUE;
+        argc--;
+        argv = &argv[1];
+    }
+    // If we can't connect to a gimbal, kill the app right now
+    else if (OrionCommOpen(&argc, &argv) == FALSE)
+        KillProcess("", 1);
+
+    // If the user specified a store name
+    if (argc > 1)
+        *ppName = argv[1];
+
+}// ProcessArgs
@@ -5,24 +5,31 @@
 #include <stdio.h>
 #include <string.h>
 
-// Incoming and outgoing packet structures. Inco0ming structure *MUST* be persistent
-//  between calls to ProcessData.
-static OrionPkt_t PktIn, PktOut;
+// Outgoing packet structure
+static OrionPkt_t PktOut;
 
 // A few helper functions, etc.
 static void KillProcess(const char *pMessage, int Value);
 static void ProcessArgs(int argc, char **argv, OrionUserData_t *pUser);
 static int ProcessKeyboard(void);
+static void HandleUserData(OrionCommContext_t *pContext, const OrionPkt_t *pPkt, void *pUser);
 
 int main(int argc, char **argv)
 {
     OrionUserData_t UserIn = { USER_DATA_PORT_ETHERNET }, UserOut = { USER_DATA_PORT_PRIMARY };
+    OrionCommLoop_t Loop;
 
     // Process the command line arguments
     ProcessArgs(argc, argv, &UserOut);
 
-    // Loop forever
-    while (1)
+    // Set up an event loop that calls HandleUserData for each incoming user data packet
+    if (!OrionCommLoopInit(&Loop) || !OrionCommLoopAdd(&Loop, OrionCommGetDefaultContext()))
+        KillProcess("Failed to start the event loop", 1);
+
+    OrionCommLoopSetHandler(&Loop, getOrionUserDataPacketID(), HandleUserData, &UserIn);
+
+    // Loop for as long as the gimbal stays connected
+    while (OrionCommIsOpen())
     {
         // Record the initial buffer size
         int Byte, Size = UserOut.size;
@@ -46,30 +53,37 @@ int main(int argc, char **argv)
             UserOut.size = 0;
         }
 
-        // Look for any incoming gimbal packets
-        while (OrionCommReceive(&PktIn))
-        {
-            // If we find a user data packet
-            if (decodeOrionUserDataPacketStructure(&PktIn, &UserIn))
-            {
-                // Add a null terminator to the string
-                UserIn.data[UserIn.size] = 0;
-
-                // Now print the incoming data to stdout
-                printf("Received Packet %d: %s\n", UserIn.id, (char *)UserIn.data);
-            }
-        }
+        // Dispatch incoming packets as they arrive, checking the keyboard again within 1/4 second
+        if (OrionCommLoopRun(&Loop, 250) < 0)
+            break;
 
-        // Flush the stdout buffer and sleep for 1/4 second
+        // Flush the stdout buffer
         fflush(stdout);
-        usleep(250000);
     }
 
-    // Done (actually, we'll never get here...)
+    // Done
+    OrionCommLoopFree(&Loop);
     return 0;
 
 }// main
 
+// Event loop callback for user data packets
+static void HandleUserData(OrionCommContext_t *pContext, const OrionPkt_t *pPkt, void *pUser)
+{
+    OrionUserData_t *pUserIn = (OrionUserData_t *)pUser;
+
+    // If we find a user data packet
+    if (decodeOrionUserDataPacketStructure(pPkt, pUserIn))
+    {
+        // Add a null terminator to the string
+        pUserIn->data[pUserIn->size] = 0;
+
+        // Now print the incoming data to stdout
+        printf("Received Packet %d: %s\n", pUserIn->id, (char *)pUserIn->data);
+    }
+
+}// HandleUserData
+
 // This function just shuts things down consistently with a nice message for the user
 static void KillProcess(const char *pMessage, int Value)
 {
@@ -29,4 +29,20 @@ int get_video_buffer(AVFrame *frame, int align);
 
 #endif // LIBAVCODEC_VERSION_INT < AV_VERSION_INT(55,28,1)
 
+// Reference counted frames, which let decoded frames be handed out without copying them
+#if LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(55,28,1)
+#define FFMPEG_HAS_FRAME_REFS 1
+#endif
+
+// Reference counted packets, which let the pipeline threads share packets without copying them
+#if LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(57,12,100)
+#define FFMPEG_HAS_PACKET_REFS 1
+#endif
+
+// Hardware decoding through the hwcontext device API (NVDEC/CUDA, VAAPI, etc.)
+#if LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(58,18,100)
+#include "libavutil/hwcontext.h"
+#define FFMPEG_HAS_HWACCEL 1
+#endif
+
 #endif //  FFMPEG_H
@@ -0,0 +1,134 @@
+#include "FrameSync.h"
+#include "Constants.h"
+
+#include <string.h>
+
+// Milliseconds in a GPS week, and between the UNIX and GPS epochs
+#define GPS_WEEK_MS         604800000LL
+#define GPS_EPOCH_UNIX_MS   315964800000LL
+
+static int64_t TelemetryGpsMs(const GeolocateTelemetry_t *pGeo);
+static void EmitPair(FrameSync_t *pSync, const GeolocateTelemetry_t *pGeo, uint32_t SystemTime, int Interpolated, FrameSyncPair_t *pPair);
+
+void FrameSyncInit(FrameSync_t *pSync, GeolocateHistory_t *pHistory)
+{
+    // Start out with no frames and no idea how the stream clock relates to UTC
+    memset(pSync, 0, sizeof(FrameSync_t));
+    pSync->pHistory = pHistory;
+
+}// FrameSyncInit
+
+void FrameSyncSetClock(FrameSync_t *pSync, int64_t StreamUs, uint64_t UtcUs)
+{
+    // Every KLV packet carries a UTC time stamp and the PTS of the packet it arrived in, which
+    //   is all we need to map frame PTS values onto UTC
+    pSync->StreamToUtcUs = (int64_t)UtcUs - StreamUs;
+    pSync->HaveClock = 1;
+
+}// FrameSyncSetClock
+
+int FrameSyncPushFrame(FrameSync_t *pSync, int64_t StreamUs, void *pUser)
+{
+    FrameSyncFrame_t *pFrame;
+
+    // If the queue is full, this frame is dropped: FrameSyncPull() isn't keeping up
+    if (pSync->In - pSync->Out >= FRAME_SYNC_QUEUE)
+    {
+        pSync->Dropped++;
+        return 0;
+    }
+
+    // Add the frame to the end of the queue
+    pFrame = &pSync->Frames[pSync->In % FRAME_SYNC_QUEUE];
+    pFrame->StreamUs = StreamUs;
+    pFrame->pUser = pUser;
+    pSync->In++;
+
+    return 1;
+
+}// FrameSyncPushFrame
+
+int FrameSyncPull(FrameSync_t *pSync, FrameSyncPair_t *pPair)
+{
+    // Work through the queue, oldest frame first
+    while (pSync->In != pSync->Out)
+    {
+        const FrameSyncFrame_t *pFrame = &pSync->Frames[pSync->Out % FRAME_SYNC_QUEUE];
+        const GeolocateTelemetry_t *pNewest = geolocateHistoryGet(pSync->pHistory, 0);
+        int Full = (pSync->In - pSync->Out) >= FRAME_SYNC_QUEUE;
+        int64_t FrameGpsMs;
+        uint32_t SystemTime, LeapSeconds;
+
+        // No telemetry at all yet, so hang on to the frame unless we're out of space
+        if (pNewest == NULL)
+        {
+            if (!Full)
+                return 0;
+
+            pSync->Dropped++;
+            pSync->Out++;
+            continue;
+        }
+
+        // Without a stream clock the best we can do is the newest telemetry
+        if (!pSync->HaveClock)
+        {
+            EmitPair(pSync, pNewest, pNewest->base.systemTime, 0, pPair);
+            return 1;
+        }
+
+        // Use the gimbal's leap seconds if it knows them
+        LeapSeconds = (pNewest->base.leapSeconds != 0) ? pNewest->base.leapSeconds : LEAP_SECONDS;
+
+        // Frame time in GPS milliseconds, then the system time it corresponds to
+        FrameGpsMs = (pFrame->StreamUs + pSync->StreamToUtcUs) / 1000 + (LeapSeconds * 1000LL) - GPS_EPOCH_UNIX_MS;
+        SystemTime = pNewest->base.systemTime + (uint32_t)(FrameGpsMs - TelemetryGpsMs(pNewest));
+
+        // If the frame is newer than the newest telemetry, wait for more telemetry to arrive
+        if ((int32_t)(SystemTime - pNewest->base.systemTime) > 0)
+        {
+            if (!Full)
+                return 0;
+
+            // Out of room, so emit the frame with what we've got
+            EmitPair(pSync, pNewest, SystemTime, 0, pPair);
+            return 1;
+        }
+
+        // Otherwise, interpolate the telemetry to the frame time
+        if (geolocateHistoryInterpolate(pSync->pHistory, SystemTime, &pPair->Geo))
+        {
+            EmitPair(pSync, NULL, SystemTime, 1, pPair);
+            return 1;
+        }
+
+        // The frame is older than all the telemetry we have, so there's nothing to pair it with
+        pSync->Dropped++;
+        pSync->Out++;
+    }
+
+    // Nothing ready yet
+    return 0;
+
+}// FrameSyncPull
+
+static int64_t TelemetryGpsMs(const GeolocateTelemetry_t *pGeo)
+{
+    // GPS week and time of week, in milliseconds since the GPS epoch
+    return pGeo->base.gpsWeek * GPS_WEEK_MS + pGeo->base.gpsITOW;
+
+}// TelemetryGpsMs
+
+static void EmitPair(FrameSync_t *pSync, const GeolocateTelemetry_t *pGeo, uint32_t SystemTime, int Interpolated, FrameSyncPair_t *pPair)
+{
+    // Copy the frame out and pop it off the queue
+    pPair->Frame = pSync->Frames[pSync->Out % FRAME_SYNC_QUEUE];
+    pPair->SystemTime = SystemTime;
+    pPair->Interpolated = Interpolated;
+    pSync->Out++;
+
+    // Copy the telemetry in, if it isn't already there
+    if (pGeo != NULL)
+        copyGeolocateTelemetry(pGeo, &pPair->Geo);
+
+}// EmitPair
@@ -0,0 +1,69 @@
+#ifndef FRAMESYNC_H
+#define FRAMESYNC_H
+
+#include "GeolocateHistory.h"
+
+#include <stdint.h>
+
+// Matches decoded video frames with the telemetry the gimbal reported at the moment each frame
+//   was captured. Frames are keyed by their presentation time in microseconds on the stream's
+//   clock, telemetry by its system time. The two clocks are tied together through GPS time:
+//   the KLV time stamp ties the stream clock to UTC, and each telemetry packet ties system time
+//   to GPS time. Frames wait in a bounded queue until telemetry past their capture time has
+//   arrived, then come out of FrameSyncPull() with telemetry interpolated to that exact time.
+
+// Number of frames that can wait for telemetry, must be a power of two
+#define FRAME_SYNC_QUEUE 16
+
+typedef struct
+{
+    // Presentation time on the stream clock in microseconds
+    int64_t StreamUs;
+
+    // Opaque frame handle supplied by the caller
+    void *pUser;
+
+} FrameSyncFrame_t;
+
+typedef struct
+{
+    // The frame, as it was passed to FrameSyncPushFrame()
+    FrameSyncFrame_t Frame;
+
+    // Telemetry system time that the frame maps to, in milliseconds
+    uint32_t SystemTime;
+
+    // 1 if Geo was interpolated to the frame time, 0 if it's just the closest older telemetry
+    int Interpolated;
+
+    // Telemetry at the time of the frame
+    GeolocateTelemetry_t Geo;
+
+} FrameSyncPair_t;
+
+typedef struct
+{
+    // Telemetry source, which FrameSync reads as the consumer
+    GeolocateHistory_t *pHistory;
+
+    // Frames that are waiting for telemetry
+    FrameSyncFrame_t Frames[FRAME_SYNC_QUEUE];
+    uint32_t In, Out;
+
+    // UTC microseconds minus stream microseconds, valid once HaveClock is set
+    int64_t StreamToUtcUs;
+    int HaveClock;
+
+    // Frames that were dropped because the queue was full, or because they
+    //   were older than any telemetry
+    uint32_t Dropped;
+
+} FrameSync_t;
+
+void FrameSyncInit(FrameSync_t *pSync, GeolocateHistory_t *pHistory);
+
+void FrameSyncSetClock(FrameSync_t *pSync, int64_t StreamUs, uint64_t UtcUs);
+int FrameSyncPushFrame(FrameSync_t *pSync, int64_t StreamUs, void *pUser);
+int FrameSyncPull(FrameSync_t *pSync, FrameSyncPair_t *pPair);
+
+#endif // FRAMESYNC_H
@@ -0,0 +1,371 @@
+#include "KlvEncoder.h"
+#include "KlvStream.h"
+#include "scaledencode.h"
+#include "Constants.h"
+
+#include <math.h>
+#include <string.h>
+
+// Milliseconds in a GPS week, and between the UNIX and GPS epochs
+#define GPS_WEEK_MS         604800000LL
+#define GPS_EPOCH_UNIX_MS   315964800000LL
+
+// Longest value that fits a short form BER length, which is all the encoder ever writes for a tag
+#define KLV_MAX_TAG_LENGTH  127
+
+// The TagInfo ranges are in radians if RADIANS is defined, and so are the values we're handed
+#ifdef RADIANS
+# define ENCODE_ANGLE(x) (x)
+#else
+# define ENCODE_ANGLE(x) degrees(x)
+#endif // RADIANS
+
+static const uint8_t KlvUasKey[16] = {
+    0x06, 0x0E, 0x2B, 0x34, 0x02, 0x0B, 0x01, 0x01,
+    0x0E, 0x01, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00
+};
+
+// Room left in front of the tags for the universal key and a long form BER length of up to two bytes
+#define KLV_HEADER_MAX (sizeof(KlvUasKey) + 3)
+
+typedef struct
+{
+    KlvEncoder_t *pEncoder;
+
+    // Where the tags go and how many bytes of them there are so far
+    uint8_t *pTags;
+    uint32_t Size;
+    uint32_t Capacity;
+
+    // Sums of the bytes at even and odd offsets from the start of the tags, which become the
+    //   checksum once we know which side of a word boundary the tags start on
+    uint32_t Sums[2];
+
+    // Set if anything didn't fit
+    int Overflow;
+
+} KlvWriter_t;
+
+static void WriteBytes(KlvWriter_t *pWriter, const uint8_t *pData, uint32_t Length);
+static void WriteTag(KlvWriter_t *pWriter, uint8_t Key, const uint8_t *pValue, uint32_t Length);
+static void WriteDouble(KlvWriter_t *pWriter, uint8_t Key, double Value, uint32_t Length);
+static void WriteUInt(KlvWriter_t *pWriter, uint8_t Key, uint64_t Value, uint32_t Length);
+static void WriteString(KlvWriter_t *pWriter, uint8_t Key, const char *pString);
+static double WrapAngle(double Angle, double Min);
+
+void KlvEncoderInit(KlvEncoder_t *pEncoder, int ChangedOnly, uint32_t RefreshInterval)
+{
+    // Start out with nothing sent, so the first set has every tag in it
+    memset(pEncoder, 0, sizeof(KlvEncoder_t));
+    pEncoder->ChangedOnly = ChangedOnly;
+    pEncoder->RefreshInterval = RefreshInterval;
+
+}// KlvEncoderInit
+
+void KlvEncoderReset(KlvEncoder_t *pEncoder)
+{
+    // A zero length never matches a real encoding, so every tag goes out next time
+    memset(pEncoder->LastLength, 0, sizeof(pEncoder->LastLength));
+    pEncoder->SinceRefresh = 0;
+
+}// KlvEncoderReset
+
+uint32_t KlvEncodeTelemetry(KlvEncoder_t *pEncoder, const GeolocateTelemetry_t *pGeo, const KlvPlatformData_t *pPlatform,
+                            uint8_t *pBuffer, uint32_t Capacity)
+{
+    const GeolocateTelemetryCore_t *pCore = &pGeo->base;
+    const KlvTagInfo_t *pPitchInfo = KlvGetTagInfo(KLV_UAS_PLATFORM_PITCH_SHORT);
+    const KlvTagInfo_t *pRollInfo = KlvGetTagInfo(KLV_UAS_PLATFORM_ROLL_SHORT);
+    static const uint8_t ChecksumTag[2] = { KLV_UAS_CHECKSUM, 2 };
+    KlvWriter_t Writer;
+    uint8_t Bytes[8];
+    uint32_t LeapSeconds, Length, Header;
+    uint64_t UnixUs;
+    double Heading, Pitch, Roll;
+    uint16_t Sum;
+    int i;
+
+    // There has to be room for the header at the very least
+    if (Capacity <= KLV_HEADER_MAX)
+    {
+        pEncoder->Overflows++;
+        return 0;
+    }
+
+    // Periodically send everything, for the benefit of receivers that missed the earlier sets
+    if (!pEncoder->ChangedOnly || (pEncoder->RefreshInterval && (pEncoder->SinceRefresh >= pEncoder->RefreshInterval)))
+        KlvEncoderReset(pEncoder);
+
+    // Tags go after the room we've left for the header, which gets filled in once we know the length
+    memset(&Writer, 0, sizeof(Writer));
+    Writer.pEncoder = pEncoder;
+    Writer.pTags = pBuffer + KLV_HEADER_MAX;
+    Writer.Capacity = Capacity - KLV_HEADER_MAX;
+
+    // Use the gimbal's leap seconds if it knows them
+    LeapSeconds = (pCore->leapSeconds != 0) ? pCore->leapSeconds : LEAP_SECONDS;
+
+    // The time stamp goes first and goes out every time: microseconds since the UNIX epoch, in UTC
+    UnixUs = (uint64_t)(pCore->gpsWeek * GPS_WEEK_MS + pCore->gpsITOW + GPS_EPOCH_UNIX_MS - LeapSeconds * 1000LL) * 1000;
+    Bytes[0] = KLV_UAS_TIME_STAMP;
+    Bytes[1] = 8;
+    WriteBytes(&Writer, Bytes, 2);
+    for (i = 7; i >= 0; i--, UnixUs >>= 8)
+        Bytes[i] = (uint8_t)UnixUs;
+    WriteBytes(&Writer, Bytes, 8);
+
+    // Platform strings, if we've got any
+    if (pPlatform != NULL)
+    {
+        WriteString(&Writer, KLV_UAS_MISSION_ID, pPlatform->pMissionId);
+        WriteString(&Writer, KLV_UAS_TAIL_NUMBER, pPlatform->pTailNumber);
+        WriteString(&Writer, KLV_UAS_PLATFORM_ID, pPlatform->pPlatformDesignation);
+        WriteString(&Writer, KLV_UAS_SENSOR_ID, pPlatform->pSensorName);
+    }
+
+    // Platform attitude from the caller, or the gimbal mount's attitude otherwise
+    if ((pPlatform != NULL) && pPlatform->HaveAttitude)
+    {
+        Heading = pPlatform->Heading;
+        Pitch = pPlatform->Pitch;
+        Roll = pPlatform->Roll;
+    }
+    else
+    {
+        Heading = pGeo->gimbalEuler[AXIS_YAW];
+        Pitch = pGeo->gimbalEuler[AXIS_PITCH];
+        Roll = pGeo->gimbalEuler[AXIS_ROLL];
+    }
+
+    WriteDouble(&Writer, KLV_UAS_PLATFORM_YAW, ENCODE_ANGLE(WrapAngle(Heading, 0)), 2);
+
+    // Use the short pitch and roll tags that everyone understands, unless the value is out of their range
+    if (INSIDE(pPitchInfo->Min, ENCODE_ANGLE(Pitch), pPitchInfo->Max))
+        WriteDouble(&Writer, KLV_UAS_PLATFORM_PITCH_SHORT, ENCODE_ANGLE(Pitch), 2);
+    else
+        WriteDouble(&Writer, KLV_UAS_PLATFORM_PITCH, ENCODE_ANGLE(Pitch), 4);
+
+    if (INSIDE(pRollInfo->Min, ENCODE_ANGLE(Roll), pRollInfo->Max))
+        WriteDouble(&Writer, KLV_UAS_PLATFORM_ROLL_SHORT, ENCODE_ANGLE(Roll), 2);
+    else
+        WriteDouble(&Writer, KLV_UAS_PLATFORM_ROLL, ENCODE_ANGLE(Roll), 4);
+
+    // Sensor position, with the altitude converted from the ellipsoid to MSL
+    WriteDouble(&Writer, KLV_UAS_SENSOR_LAT, ENCODE_ANGLE(pCore->posLat), 4);
+    WriteDouble(&Writer, KLV_UAS_SENSOR_LON, ENCODE_ANGLE(pCore->posLon), 4);
+    WriteDouble(&Writer, KLV_UAS_SENSOR_MSL, pCore->posAlt - pCore->geoidUndulation, 2);
+
+    // Field of view, and the sensor's angles relative to the platform
+    WriteDouble(&Writer, KLV_UAS_SENSOR_HFOV, ENCODE_ANGLE(pCore->hfov), 2);
+    WriteDouble(&Writer, KLV_UAS_SENSOR_VFOV, ENCODE_ANGLE(pCore->vfov), 2);
+    WriteDouble(&Writer, KLV_UAS_SENSOR_PAN, ENCODE_ANGLE(WrapAngle(pCore->pan, 0)), 4);
+    WriteDouble(&Writer, KLV_UAS_SENSOR_TILT, ENCODE_ANGLE(WrapAngle(pCore->tilt, -PId)), 4);
+    WriteDouble(&Writer, KLV_UAS_SENSOR_ROLL, 0, 4);
+
+    // The image location only means something if the gimbal has a range to go with it. The geoid
+    //   height at the gimbal is close enough to the geoid height at the image for MSL.
+    if (pCore->rangeSource != RANGE_SRC_NONE)
+    {
+        WriteDouble(&Writer, KLV_UAS_SLANT_RANGE, pGeo->slantRange, 4);
+        WriteDouble(&Writer, KLV_UAS_IMAGE_LAT, ENCODE_ANGLE(pGeo->imagePosLLA[LAT]), 4);
+        WriteDouble(&Writer, KLV_UAS_IMAGE_LON, ENCODE_ANGLE(pGeo->imagePosLLA[LON]), 4);
+        WriteDouble(&Writer, KLV_UAS_IMAGE_MSL, pGeo->imagePosLLA[ALT] - pCore->geoidUndulation, 2);
+    }
+
+    // Velocity, along with the ground speed rounded to the nearest meter per second
+    WriteUInt(&Writer, KLV_UAS_GROUND_SPEED, (uint64_t)MIN(sqrt(pCore->velNED[0] * pCore->velNED[0] + pCore->velNED[1] * pCore->velNED[1]) + 0.5, 255), 1);
+    WriteDouble(&Writer, KLV_UAS_NORTH_VELOCITY, pCore->velNED[0], 2);
+    WriteDouble(&Writer, KLV_UAS_EAST_VELOCITY, pCore->velNED[1], 2);
+
+    WriteUInt(&Writer, KLV_UAS_VERSION, KLV_ENCODER_VERSION, 1);
+
+    // The checksum tag's key and length are part of the checksum, its value isn't
+    WriteBytes(&Writer, ChecksumTag, sizeof(ChecksumTag));
+
+    // If anything didn't fit, the set is no good, and whatever we think we sent wasn't
+    if (Writer.Overflow || (Writer.Size + 2 > Writer.Capacity))
+    {
+        KlvEncoderReset(pEncoder);
+        pEncoder->Overflows++;
+        return 0;
+    }
+
+    // Now that we know how long the set is, pick the shortest BER length and put the header
+    //   right in front of the tags
+    Length = Writer.Size + 2;
+    Header = sizeof(KlvUasKey) + ((Length < 128) ? 1 : (Length < 256) ? 2 : 3);
+    pBuffer += KLV_HEADER_MAX - Header;
+    memcpy(pBuffer, KlvUasKey, sizeof(KlvUasKey));
+
+    if (Length < 128)
+        pBuffer[16] = (uint8_t)Length;
+    else if (Length < 256)
+    {
+        pBuffer[16] = 0x81;
+        pBuffer[17] = (uint8_t)Length;
+    }
+    else
+    {
+        pBuffer[16] = 0x82;
+        pBuffer[17] = (uint8_t)(Length >> 8);
+        pBuffer[18] = (uint8_t)Length;
+    }
+
+    // Checksum the header, then fold in the tags according to whether they start on an even byte
+    Sum = KlvChecksum(pBuffer, Header);
+    if (Header & 1)
+        Sum += (uint16_t)((Writer.Sums[1] << 8) + Writer.Sums[0]);
+    else
+        Sum += (uint16_t)((Writer.Sums[0] << 8) + Writer.Sums[1]);
+
+    Writer.pTags[Writer.Size++] = (uint8_t)(Sum >> 8);
+    Writer.pTags[Writer.Size++] = (uint8_t)Sum;
+
+    // Slide the whole set down to the start of the buffer if the header came out short
+    if (pBuffer != Writer.pTags - KLV_HEADER_MAX)
+        memmove(Writer.pTags - KLV_HEADER_MAX, pBuffer, Header + Length);
+
+    pEncoder->Sets++;
+    pEncoder->SinceRefresh++;
+
+    return Header + Length;
+
+}// KlvEncodeTelemetry
+
+static void WriteBytes(KlvWriter_t *pWriter, const uint8_t *pData, uint32_t Length)
+{
+    uint32_t i;
+
+    // Don't write past the end of the buffer
+    if (pWriter->Size + Length > pWriter->Capacity)
+    {
+        pWriter->Overflow = 1;
+        return;
+    }
+
+    // Copy the bytes in, summing them as they go by
+    for (i = 0; i < Length; i++, pWriter->Size++)
+    {
+        pWriter->pTags[pWriter->Size] = pData[i];
+        pWriter->Sums[pWriter->Size & 1] += pData[i];
+    }
+
+}// WriteBytes
+
+static void WriteTag(KlvWriter_t *pWriter, uint8_t Key, const uint8_t *pValue, uint32_t Length)
+{
+    KlvEncoder_t *pEncoder = pWriter->pEncoder;
+    uint8_t Header[2];
+
+    // Leave the tag out if it's exactly what we sent last time
+    if ((Length <= KLV_ENCODER_MAX_VALUE) && (Length == pEncoder->LastLength[Key]) && (memcmp(pValue, pEncoder->Last[Key], Length) == 0))
+    {
+        pEncoder->Unchanged++;
+        return;
+    }
+
+    // Remember this encoding for next time, anything too long to keep just goes out every time
+    if (Length <= KLV_ENCODER_MAX_VALUE)
+    {
+        memcpy(pEncoder->Last[Key], pValue, Length);
+        pEncoder->LastLength[Key] = (uint8_t)Length;
+    }
+    else
+        pEncoder->LastLength[Key] = 0;
+
+    // Every key we write fits in one byte, and every value fits a short form length
+    Header[0] = Key;
+    Header[1] = (uint8_t)Length;
+    WriteBytes(pWriter, Header, sizeof(Header));
+    WriteBytes(pWriter, pValue, Length);
+
+}// WriteTag
+
+static void WriteDouble(KlvWriter_t *pWriter, uint8_t Key, double Value, uint32_t Length)
+{
+    const KlvTagInfo_t *pInfo = KlvGetTagInfo(Key);
+    double Min = pInfo->Min, Max = pInfo->Max;
+    uint8_t Bytes[8];
+    int Index = 0;
+
+    // The inverse of the parser's scale for this element
+    double Scaler = ldexp(1.0, Length * 8) / (Max - Min);
+
+    // Asymmetrical values are encoded as unsigned offsets from the minimum
+    if (Min + Max != 0)
+    {
+        // Switch on tag length
+        switch (Length)
+        {
+        // Use the appropriate Protogen function to put the value
+        case 1: float64ScaledTo1UnsignedBytes(Value,   Bytes, &Index, Min, Scaler); break;
+        case 2: float64ScaledTo2UnsignedBeBytes(Value, Bytes, &Index, Min, Scaler); break;
+        case 3: float64ScaledTo3UnsignedBeBytes(Value, Bytes, &Index, Min, Scaler); break;
+        case 4: float64ScaledTo4UnsignedBeBytes(Value, Bytes, &Index, Min, Scaler); break;
+        case 5: float64ScaledTo5UnsignedBeBytes(Value, Bytes, &Index, Min, Scaler); break;
+        case 6: float64ScaledTo6UnsignedBeBytes(Value, Bytes, &Index, Min, Scaler); break;
+        case 7: float64ScaledTo7UnsignedBeBytes(Value, Bytes, &Index, Min, Scaler); break;
+        case 8: float64ScaledTo8UnsignedBeBytes(Value, Bytes, &Index, Min, Scaler); break;
+        default: return;
+        }
+    }
+    else
+    {
+        // Switch on tag length
+        switch (Length)
+        {
+        // Use the appropriate Protogen function to put the value
+        case 1: float64ScaledTo1SignedBytes(Value,   Bytes, &Index, Scaler); break;
+        case 2: float64ScaledTo2SignedBeBytes(Value, Bytes, &Index, Scaler); break;
+        case 3: float64ScaledTo3SignedBeBytes(Value, Bytes, &Index, Scaler); break;
+        case 4: float64ScaledTo4SignedBeBytes(Value, Bytes, &Index, Scaler); break;
+        case 5: float64ScaledTo5SignedBeBytes(Value, Bytes, &Index, Scaler); break;
+        case 6: float64ScaledTo6SignedBeBytes(Value, Bytes, &Index, Scaler); break;
+        case 7: float64ScaledTo7SignedBeBytes(Value, Bytes, &Index, Scaler); break;
+        case 8: float64ScaledTo8SignedBeBytes(Value, Bytes, &Index, Scaler); break;
+        default: return;
+        }
+    }
+
+    WriteTag(pWriter, Key, Bytes, (uint32_t)Index);
+
+}// WriteDouble
+
+static void WriteUInt(KlvWriter_t *pWriter, uint8_t Key, uint64_t Value, uint32_t Length)
+{
+    uint8_t Bytes[8];
+    int i;
+
+    // Big endian, in as many bytes as the tag calls for
+    for (i = (int)Length - 1; i >= 0; i--, Value >>= 8)
+        Bytes[i] = (uint8_t)Value;
+
+    WriteTag(pWriter, Key, Bytes, Length);
+
+}// WriteUInt
+
+static void WriteString(KlvWriter_t *pWriter, uint8_t Key, const char *pString)
+{
+    uint32_t Length;
+
+    // Leave out strings the caller doesn't have
+    if ((pString == NULL) || (pString[0] == '\0'))
+        return;
+
+    // Strings longer than a short form length allows are cut off
+    Length = (uint32_t)strlen(pString);
+    WriteTag(pWriter, Key, (const uint8_t *)pString, MIN(Length, KLV_MAX_TAG_LENGTH));
+
+}// WriteString
+
+static double WrapAngle(double Angle, double Min)
+{
+    // Bring an angle in radians into [Min, Min + 2pi)
+    while (Angle < Min)
+        Angle += 2 * PId;
+    while (Angle >= Min + 2 * PId)
+        Angle -= 2 * PId;
+
+    return Angle;
+
+}// WrapAngle
@@ -0,0 +1,73 @@
+#ifndef KLVENCODER_H
+#define KLVENCODER_H
+
+#include "KlvParser.h"
+#include "GeolocateTelemetry.h"
+
+#include <stdint.h>
+
+// MISB 0601 UAS local set encoder. Each call turns one GeolocateTelemetry_t, along with whatever
+//   platform data the caller has, into a complete local set in a caller-supplied buffer. Scaled
+//   values use the same TagInfo ranges the parser decodes with, so anything this writes reads
+//   back through KlvNewData() or KlvStream_t. Nothing is allocated, and the checksum is summed
+//   as the bytes are written rather than in a second pass.
+//
+// In changed-only mode, tags whose encoded bytes match the last set are left out, which the
+//   standard allows since receivers carry values over from earlier sets. The time stamp and
+//   checksum always go out, and every RefreshInterval sets a full set is sent so that receivers
+//   joining late pick everything up.
+
+// Largest set the encoder will ever write, which is a safe size for the caller's buffer
+#define KLV_ENCODER_MAX_SET 1024
+
+// Longest tag value whose last encoding is kept for changed-only mode, longer values always go out
+#define KLV_ENCODER_MAX_VALUE 32
+
+// UAS local set version written in tag 65
+#define KLV_ENCODER_VERSION 11
+
+// Platform data that isn't part of the gimbal telemetry, any string may be NULL to leave it out
+typedef struct
+{
+    const char *pMissionId;
+    const char *pTailNumber;
+    const char *pPlatformDesignation;
+    const char *pSensorName;
+
+    // Set HaveAttitude to send this platform attitude, in radians, instead of the gimbal
+    //   mount attitude from the telemetry
+    int HaveAttitude;
+    double Heading;
+    double Pitch;
+    double Roll;
+
+} KlvPlatformData_t;
+
+typedef struct
+{
+    // Leave out unchanged tags, and send a full set every RefreshInterval sets (0 for never)
+    int ChangedOnly;
+    uint32_t RefreshInterval;
+    uint32_t SinceRefresh;
+
+    // Last encoding of each tag, a length of 0 meaning it has to go out next time
+    uint8_t Last[KLV_UAS_NUM_ELEMENTS][KLV_ENCODER_MAX_VALUE];
+    uint8_t LastLength[KLV_UAS_NUM_ELEMENTS];
+
+    // Sets written, tags left out for being unchanged, and sets that didn't fit the buffer
+    uint32_t Sets;
+    uint32_t Unchanged;
+    uint32_t Overflows;
+
+} KlvEncoder_t;
+
+void KlvEncoderInit(KlvEncoder_t *pEncoder, int ChangedOnly, uint32_t RefreshInterval);
+
+// Force the next set to include every tag
+void KlvEncoderReset(KlvEncoder_t *pEncoder);
+
+// Returns the number of bytes written, or 0 if the set didn't fit in Capacity bytes. pPlatform may be NULL.
+uint32_t KlvEncodeTelemetry(KlvEncoder_t *pEncoder, const GeolocateTelemetry_t *pGeo, const KlvPlatformData_t *pPlatform,
+                            uint8_t *pBuffer, uint32_t Capacity);
+
+#endif // KLVENCODER_H
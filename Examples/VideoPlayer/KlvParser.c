@@ -6,33 +6,13 @@
 #include <inttypes.h>
 #include <stdio.h>
 
-// Define to output data in radians, undefine for degrees
-#define RADIANS
-
 #ifdef RADIANS
 # define CONVERT_ANGLE(x) radians(x)
 #else
 # define CONVERT_ANGLE(x) (x)
 #endif // RADIANS
 
-typedef enum
-{
-    KLV_TYPE_UINT,
-    KLV_TYPE_INT,
-    KLV_TYPE_DOUBLE,
-    KLV_TYPE_STRING,
-    KLV_TYPE_OTHER
-} KlvType_t;
-
-typedef struct
-{
-    char Name[64];
-    KlvType_t Type;
-    double Min;
-    double Max;
-} KlvTagInfo_t;
-
-KlvTagInfo_t TagInfo[KLV_UAS_NUM_ELEMENTS] = {
+static const KlvTagInfo_t TagInfo[KLV_UAS_NUM_ELEMENTS] = {
     { "KLV_UAS_NULL", /* = 0, */                  KLV_TYPE_OTHER },
     { "KLV_UAS_CHECKSUM", /* = 1, */              KLV_TYPE_UINT },
     { "KLV_UAS_TIME_STAMP", /* = 2, */            KLV_TYPE_UINT },
@@ -130,6 +110,13 @@ KlvTagInfo_t TagInfo[KLV_UAS_NUM_ELEMENTS] = {
     { "KLV_UAS_CORE_ID", /* = 94 */               KLV_TYPE_OTHER },
 };
 
+const KlvTagInfo_t *KlvGetTagInfo(uint32_t Key)
+{
+    // Only the keys we know about have a name, type, and range
+    return (Key < KLV_UAS_NUM_ELEMENTS) ? &TagInfo[Key] : NULL;
+
+}// KlvGetTagInfo
+
 static uint64_t KlvGetLength(const uint8_t *pData, uint64_t *pIndex)
 {
     if (pData[*pIndex] & 0x80)
@@ -148,8 +135,13 @@ static uint64_t KlvGetLength(const uint8_t *pData, uint64_t *pIndex)
 
 void KlvNewData(const uint8_t *pData, int Length)
 {
-    // Get the length of the whole shebang
+    // Get the length of the whole shebang, which can't be more than we were handed
     uint64_t i = 16, DataLength = KlvGetLength(pData, &i) + i;
+    DataLength = MIN(DataLength, (uint64_t)Length);
+
+    // Hand the whole packet to the KLV tree, which keeps a copy for the tags to point into
+    if (!KlvTreeBegin(pData, DataLength))
+        return;
 
     // As long as there's more data to read out
     while (i < DataLength)
@@ -159,18 +151,55 @@ void KlvNewData(const uint8_t *pData, int Length)
         uint64_t KeyLength = KlvGetLength(pData, &i);
 
         // Clip the length to the number of bytes remaining
-        KeyLength = MIN(KeyLength, DataLength - i);
+        KeyLength = (i < DataLength) ? MIN(KeyLength, DataLength - i) : 0;
 
-        // Pass the data to the KLV tree
-        KlvTreeSetValue(Key, KeyLength, &pData[i]);
+        // Point the KLV tree at the tag's data
+        KlvTreeSetValue(Key, i, KeyLength);
 
         // Now increment the array index by the data size
         i += KeyLength;
     }
 
+    // Hang on to the last known value of any tag this packet didn't have
+    KlvTreeEnd();
+
 }// KlvNewData
 
 
+int KlvDecodeValue(uint32_t Key, const uint8_t *pData, uint32_t Length, KlvValue_t *pValue)
+{
+    // Start with the raw data, which is all there is for strings and anything we don't know about
+    pValue->Key = Key;
+    pValue->Type = (Key < KLV_UAS_NUM_ELEMENTS) ? TagInfo[Key].Type : KLV_TYPE_OTHER;
+    pValue->pData = pData;
+    pValue->Length = Length;
+    pValue->Valid = 0;
+
+    // Decode numbers according to their type and range
+    switch (pValue->Type)
+    {
+    case KLV_TYPE_DOUBLE:
+        pValue->Value.Double = KlvDecodeDouble(pData, Length, TagInfo[Key].Min, TagInfo[Key].Max, &pValue->Valid);
+        break;
+
+    case KLV_TYPE_UINT:
+        pValue->Value.UInt = KlvDecodeUInt(pData, Length, &pValue->Valid);
+        break;
+
+    case KLV_TYPE_INT:
+        pValue->Value.Int = KlvDecodeInt(pData, Length, &pValue->Valid);
+        break;
+
+    // Strings and everything else are only valid as raw data
+    default:
+        pValue->Valid = 1;
+        break;
+    }
+
+    return pValue->Valid;
+
+}// KlvDecodeValue
+
 double KlvGetValueDouble(KlvUasDataElement_t Element, int *pResult)
 {
     // If this is a valid key
@@ -286,13 +315,13 @@ uint64_t KlvGetValueUInt(KlvUasDataElement_t Element, int *pResult)
 
 }// KlvGetValueUInt
 
-const char *KlvGetValueString(KlvUasDataElement_t Element)
+const char *KlvGetValueString(KlvUasDataElement_t Element, char *pBuffer, uint32_t Size)
 {
     const char *pValue = 0;
 
     // If this is a valid key
     if ((Element < KLV_UAS_NUM_ELEMENTS) && (TagInfo[Element].Type == KLV_TYPE_STRING))
-        pValue = KlvTreeGetValueString(Element);
+        pValue = KlvTreeGetValueString(Element, pBuffer, Size);
 
     return pValue;
 
@@ -336,8 +365,12 @@ void KlvPrintData(void)
 
             // Decode this tag as a string and print
             case KLV_TYPE_STRING:
-                printf("%s\n", KlvGetValueString((KlvUasDataElement_t)i));
+            {
+                char String[256];
+
+                printf("%s\n", KlvGetValueString((KlvUasDataElement_t)i, String, sizeof(String)));
                 break;
+            }
 
             // Print anything else as a hexdump
             default:
@@ -3,6 +3,9 @@
 
 #include <stdint.h>
 
+// Define to output data in radians, undefine for degrees
+#define RADIANS
+
 typedef enum
 {
 	KLV_UAS_NULL,// = 0
@@ -103,12 +106,58 @@ typedef enum
     KLV_UAS_NUM_ELEMENTS
 } KlvUasDataElement_t;
 
+typedef enum
+{
+    KLV_TYPE_UINT,
+    KLV_TYPE_INT,
+    KLV_TYPE_DOUBLE,
+    KLV_TYPE_STRING,
+    KLV_TYPE_OTHER
+} KlvType_t;
+
+// Name, type, and for scaled values the range of a single tag
+typedef struct
+{
+    char Name[64];
+    KlvType_t Type;
+    double Min;
+    double Max;
+} KlvTagInfo_t;
+
+// A single tag, along with its value decoded according to the tag's type
+typedef struct
+{
+    // Tag key and type
+    uint32_t Key;
+    KlvType_t Type;
+
+    // Raw value bytes, which is the only form strings and local sets come in
+    const uint8_t *pData;
+    uint32_t Length;
+
+    // 1 if the value decoded properly
+    int Valid;
+
+    // Decoded value for numeric types
+    union
+    {
+        double Double;
+        int64_t Int;
+        uint64_t UInt;
+    } Value;
+} KlvValue_t;
+
 void KlvNewData(const uint8_t *pData, int Length);
 
+// Returns NULL for keys past the end of the table
+const KlvTagInfo_t *KlvGetTagInfo(uint32_t Key);
+
+int KlvDecodeValue(uint32_t Key, const uint8_t *pData, uint32_t Length, KlvValue_t *pValue);
+
 double KlvGetValueDouble(KlvUasDataElement_t Element, int *pResult);
 int64_t KlvGetValueInt(KlvUasDataElement_t Element, int *pResult);
 uint64_t KlvGetValueUInt(KlvUasDataElement_t Element, int *pResult);
-const char *KlvGetValueString(KlvUasDataElement_t Element);
+const char *KlvGetValueString(KlvUasDataElement_t Element, char *pBuffer, uint32_t Size);
 
 void KlvPrintData(void);
 
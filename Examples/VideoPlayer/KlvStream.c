@@ -0,0 +1,401 @@
+#include "KlvStream.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Parser states
+enum
+{
+    KLV_STATE_SYNC,
+    KLV_STATE_SET_LENGTH,
+    KLV_STATE_TAG_KEY,
+    KLV_STATE_TAG_LENGTH,
+    KLV_STATE_TAG_VALUE
+};
+
+// UAS LS universal key
+static const uint8_t KlvUasKey[16] = {
+    0x06, 0x0E, 0x2B, 0x34, 0x02, 0x0B, 0x01, 0x01,
+    0x0E, 0x01, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00
+};
+
+static void Append(KlvStream_t *pStream, const uint8_t *pData, uint32_t Length);
+static int ReadBerLength(KlvStream_t *pStream, uint8_t Byte, uint64_t *pLength);
+static void BeginSet(KlvStream_t *pStream, uint64_t SetLength);
+static void BeginTag(KlvStream_t *pStream, uint64_t TagLength);
+static void EndTag(KlvStream_t *pStream);
+static void EndSet(KlvStream_t *pStream, KlvSetStatus_t Status);
+
+void KlvStreamInit(KlvStream_t *pStream, KlvTagCallback_t pTagCallback, KlvSetCallback_t pSetCallback, void *pUser)
+{
+    // Start out looking for a universal key, with no buffer yet
+    memset(pStream, 0, sizeof(KlvStream_t));
+    pStream->pTagCallback = pTagCallback;
+    pStream->pSetCallback = pSetCallback;
+    pStream->pUser = pUser;
+
+}// KlvStreamInit
+
+void KlvStreamFree(KlvStream_t *pStream)
+{
+    // The buffer is the only thing we allocate
+    free(pStream->pBuffer);
+    pStream->pBuffer = NULL;
+    pStream->Capacity = 0;
+    KlvStreamReset(pStream);
+
+}// KlvStreamFree
+
+void KlvStreamReset(KlvStream_t *pStream)
+{
+    // Throw away any partial set and go back to looking for a universal key
+    pStream->State = KLV_STATE_SYNC;
+    pStream->Match = 0;
+    pStream->Size = 0;
+
+}// KlvStreamReset
+
+int KlvStreamIsIdle(const KlvStream_t *pStream)
+{
+    // Idle means we haven't seen any part of the next set's key yet
+    return (pStream->State == KLV_STATE_SYNC) && (pStream->Match == 0);
+
+}// KlvStreamIsIdle
+
+void KlvStreamPush(KlvStream_t *pStream, const uint8_t *pData, uint32_t Length)
+{
+    uint32_t i = 0;
+
+    // Work through the whole fragment, which may hold the end of one set and the start of another
+    while (i < Length)
+    {
+        uint8_t Byte = pData[i];
+        uint64_t Value;
+
+        switch (pStream->State)
+        {
+        case KLV_STATE_SYNC:
+            // Match the universal key a byte at a time. Its first byte appears nowhere else
+            //   in the key, so on a mismatch that's the only place a match could restart.
+            if (Byte == KlvUasKey[pStream->Match])
+                pStream->Match++;
+            else
+                pStream->Match = (Byte == KlvUasKey[0]);
+            i++;
+
+            // If we've got the whole key, start a new set with it
+            if (pStream->Match == sizeof(KlvUasKey))
+            {
+                // The buffer is allocated once, big enough for any set we'll take
+                if ((pStream->pBuffer == NULL) && ((pStream->pBuffer = (uint8_t *)malloc(KLV_STREAM_MAX_SET)) != NULL))
+                    pStream->Capacity = KLV_STREAM_MAX_SET;
+
+                // Without a buffer, there's nothing we can do with the set
+                if (pStream->pBuffer == NULL)
+                {
+                    pStream->Dropped++;
+                    KlvStreamReset(pStream);
+                    break;
+                }
+
+                pStream->Size = 0;
+                pStream->Sum = 0;
+                pStream->HaveChecksum = 0;
+                pStream->LengthBytes = 0;
+                Append(pStream, KlvUasKey, sizeof(KlvUasKey));
+                pStream->State = KLV_STATE_SET_LENGTH;
+            }
+            break;
+
+        case KLV_STATE_SET_LENGTH:
+            // Accumulate the set's BER length
+            Append(pStream, &Byte, 1);
+            i++;
+
+            switch (ReadBerLength(pStream, Byte, &Value))
+            {
+            case 1:  BeginSet(pStream, Value); break;
+            case -1: pStream->Dropped++; KlvStreamReset(pStream); break;
+            default: break;
+            }
+            break;
+
+        case KLV_STATE_TAG_KEY:
+            // Accumulate the tag's BER-OID key, 7 bits at a time
+            Append(pStream, &Byte, 1);
+            pStream->SetRemaining--;
+            i++;
+
+            pStream->TagKey = (pStream->TagKey << 7) | (Byte & 0x7F);
+            if ((Byte & 0x80) == 0)
+            {
+                pStream->LengthBytes = 0;
+                pStream->State = KLV_STATE_TAG_LENGTH;
+            }
+
+            // The set can't end in the middle of a tag
+            if (pStream->SetRemaining == 0)
+                EndSet(pStream, KLV_SET_TRUNCATED);
+            break;
+
+        case KLV_STATE_TAG_LENGTH:
+            // Accumulate the tag's BER length
+            Append(pStream, &Byte, 1);
+            pStream->SetRemaining--;
+            i++;
+
+            switch (ReadBerLength(pStream, Byte, &Value))
+            {
+            case 1:
+                // If the tag claims to run past the end of the set, the set is bad
+                if (Value > pStream->SetRemaining)
+                    EndSet(pStream, KLV_SET_TRUNCATED);
+                else
+                    BeginTag(pStream, Value);
+                break;
+
+            case -1:
+                EndSet(pStream, KLV_SET_TRUNCATED);
+                break;
+
+            default:
+                // Still reading, but the set can't end in the middle of a tag
+                if (pStream->SetRemaining == 0)
+                    EndSet(pStream, KLV_SET_TRUNCATED);
+                break;
+            }
+            break;
+
+        case KLV_STATE_TAG_VALUE:
+        {
+            // Take as much of the value as this fragment has in one go
+            uint32_t Bytes = (uint32_t)((pStream->TagRemaining < (Length - i)) ? pStream->TagRemaining : (Length - i));
+
+            Append(pStream, &pData[i], Bytes);
+            pStream->TagRemaining -= Bytes;
+            pStream->SetRemaining -= Bytes;
+            i += Bytes;
+
+            // If that finished the tag, hand it out
+            if (pStream->TagRemaining == 0)
+                EndTag(pStream);
+            break;
+        }
+
+        default:
+            KlvStreamReset(pStream);
+            break;
+        }
+    }
+
+}// KlvStreamPush
+
+static void Append(KlvStream_t *pStream, const uint8_t *pData, uint32_t Length)
+{
+    uint32_t i;
+
+    // BeginSet checked that the whole set fits, so this is just belt and braces
+    if (pStream->Size + Length > pStream->Capacity)
+        return;
+
+    // Add the bytes to the checksum as 16-bit big endian words, counting from the start of the key
+    for (i = 0; i < Length; i++)
+    {
+        uint32_t Index = pStream->Size + i;
+
+        pStream->Sum += (Index & 1) ? pData[i] : (uint16_t)(pData[i] << 8);
+        pStream->pBuffer[Index] = pData[i];
+    }
+
+    pStream->Size += Length;
+
+}// Append
+
+static int ReadBerLength(KlvStream_t *pStream, uint8_t Byte, uint64_t *pLength)
+{
+    // If this is the first byte of the length
+    if (pStream->LengthBytes == 0)
+    {
+        // Short form: the byte is the length
+        if ((Byte & 0x80) == 0)
+        {
+            *pLength = Byte;
+            return 1;
+        }
+
+        // Long form: the byte is the number of length bytes to follow, which has to fit in 64 bits
+        pStream->LengthBytes = Byte & 0x7F;
+        pStream->Accum = 0;
+        return ((pStream->LengthBytes == 0) || (pStream->LengthBytes > 8)) ? -1 : 0;
+    }
+
+    // Build the length up from the individual bytes
+    pStream->Accum = (pStream->Accum << 8) | Byte;
+    if (--pStream->LengthBytes == 0)
+    {
+        *pLength = pStream->Accum;
+        return 1;
+    }
+
+    // Still going
+    return 0;
+
+}// ReadBerLength
+
+static void BeginSet(KlvStream_t *pStream, uint64_t SetLength)
+{
+    // Skip sets that are too big to buffer, which are garbage anyway
+    if (SetLength > pStream->Capacity - pStream->Size)
+    {
+        pStream->Dropped++;
+        KlvStreamReset(pStream);
+        return;
+    }
+
+    // Now we're into the tags, unless the set is empty
+    pStream->SetRemaining = SetLength;
+    pStream->TagKey = 0;
+    pStream->State = KLV_STATE_TAG_KEY;
+
+    if (SetLength == 0)
+        EndSet(pStream, KLV_SET_NO_CHECKSUM);
+
+}// BeginSet
+
+static void BeginTag(KlvStream_t *pStream, uint64_t TagLength)
+{
+    // The checksum covers everything up to the checksum value itself, key and length included
+    if (pStream->TagKey == KLV_UAS_CHECKSUM)
+        pStream->SumAtChecksum = pStream->Sum;
+
+    // Get ready to read the value
+    pStream->TagOffset = pStream->Size;
+    pStream->TagRemaining = TagLength;
+    pStream->State = KLV_STATE_TAG_VALUE;
+
+    // Empty tags are done already
+    if (TagLength == 0)
+        EndTag(pStream);
+
+}// BeginTag
+
+static void EndTag(KlvStream_t *pStream)
+{
+    const uint8_t *pValue = &pStream->pBuffer[pStream->TagOffset];
+    uint32_t Length = pStream->Size - pStream->TagOffset;
+
+    // Hang on to the checksum, which gets checked when the set ends
+    if ((pStream->TagKey == KLV_UAS_CHECKSUM) && (Length == 2))
+    {
+        pStream->Checksum = (uint16_t)((pValue[0] << 8) | pValue[1]);
+        pStream->HaveChecksum = 1;
+    }
+
+    // Hand the tag out, decoded if it's a type we know
+    if (pStream->pTagCallback)
+    {
+        KlvValue_t Value;
+
+        KlvDecodeValue(pStream->TagKey, pValue, Length, &Value);
+        pStream->pTagCallback(pStream->pUser, &Value);
+    }
+
+    // On to the next tag
+    pStream->TagKey = 0;
+    pStream->State = KLV_STATE_TAG_KEY;
+
+    // Unless that was the last one, in which case the set is done and we can check the checksum
+    if (pStream->SetRemaining == 0)
+    {
+        if (pStream->HaveChecksum)
+            EndSet(pStream, (pStream->Checksum == pStream->SumAtChecksum) ? KLV_SET_OK : KLV_SET_BAD_CHECKSUM);
+        else
+            EndSet(pStream, KLV_SET_NO_CHECKSUM);
+    }
+
+}// EndTag
+
+static void EndSet(KlvStream_t *pStream, KlvSetStatus_t Status)
+{
+    // Keep count of what we've seen
+    pStream->Sets++;
+    if (Status == KLV_SET_BAD_CHECKSUM)
+        pStream->BadChecksums++;
+    else if (Status == KLV_SET_TRUNCATED)
+        pStream->Dropped++;
+
+    // Hand the whole set out
+    if (pStream->pSetCallback)
+        pStream->pSetCallback(pStream->pUser, pStream->pBuffer, pStream->Size, Status);
+
+    // Now go looking for the next one
+    KlvStreamReset(pStream);
+
+}// EndSet
+
+int KlvParseLocalSet(const uint8_t *pData, uint32_t Length, KlvTagCallback_t pCallback, void *pUser)
+{
+    uint32_t i = 0;
+
+    // As long as there's more data to read out
+    while (i < Length)
+    {
+        KlvValue_t Value;
+        uint64_t TagLength = 0;
+        uint32_t Key = 0;
+
+        // Grab the BER-OID key
+        while ((i < Length) && (pData[i] & 0x80))
+            Key = (Key << 7) | (pData[i++] & 0x7F);
+        if (i >= Length)
+            return 0;
+        Key = (Key << 7) | pData[i++];
+
+        // Then the BER length
+        if (i >= Length)
+            return 0;
+        if (pData[i] & 0x80)
+        {
+            uint32_t Bytes = pData[i++] & 0x7F;
+
+            if ((Bytes == 0) || (Bytes > 8) || (Bytes > Length - i))
+                return 0;
+            while (Bytes--)
+                TagLength = (TagLength << 8) | pData[i++];
+        }
+        else
+            TagLength = pData[i++];
+
+        // The value has to fit in what's left
+        if (TagLength > Length - i)
+            return 0;
+
+        // Nested sets have their own tag definitions, so all we can give out is the raw data
+        memset(&Value, 0, sizeof(Value));
+        Value.Key = Key;
+        Value.Type = KLV_TYPE_OTHER;
+        Value.pData = &pData[i];
+        Value.Length = (uint32_t)TagLength;
+        Value.Valid = 1;
+        pCallback(pUser, &Value);
+
+        i += (uint32_t)TagLength;
+    }
+
+    // The whole set parsed
+    return 1;
+
+}// KlvParseLocalSet
+
+uint16_t KlvChecksum(const uint8_t *pData, uint32_t Length)
+{
+    uint16_t Sum = 0;
+    uint32_t i;
+
+    // Sum the data as 16-bit big endian words
+    for (i = 0; i < Length; i++)
+        Sum += (i & 1) ? pData[i] : (uint16_t)(pData[i] << 8);
+
+    return Sum;
+
+}// KlvChecksum
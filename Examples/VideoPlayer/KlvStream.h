@@ -0,0 +1,89 @@
+#ifndef KLVSTREAM_H
+#define KLVSTREAM_H
+
+#include "KlvParser.h"
+
+#include <stdint.h>
+
+// Incremental MISB 0601 UAS local set parser. Data is pushed in as it arrives, in fragments of
+//   any size, so the set key, BER lengths, and tag values can all straddle fragment boundaries.
+//   The checksum is computed as the bytes go by. Each tag is handed to the tag callback, decoded,
+//   as soon as its value is complete, and the set callback gets the whole set along with its
+//   checksum status once it ends. Tags come out before the checksum can be checked, so callers
+//   that can't tolerate corrupt values should stage them and commit on KLV_SET_OK.
+//
+// Nested local sets (VMTI, RVT, etc.) are handed out as raw values. Call KlvParseLocalSet()
+//   on them only if they're needed.
+
+// Largest local set the parser will buffer, anything bigger is skipped. The buffer is allocated
+//   once, the first time a set shows up.
+#define KLV_STREAM_MAX_SET 65536
+
+typedef enum
+{
+    KLV_SET_OK,             // The checksum matched
+    KLV_SET_NO_CHECKSUM,    // There was no checksum tag to check
+    KLV_SET_BAD_CHECKSUM,   // The checksum didn't match
+    KLV_SET_TRUNCATED       // A tag ran past the end of the set
+} KlvSetStatus_t;
+
+// Called for each tag, pValue is only valid for the duration of the call
+typedef void (*KlvTagCallback_t)(void *pUser, const KlvValue_t *pValue);
+
+// Called at the end of each set with the whole set, universal key and all
+typedef void (*KlvSetCallback_t)(void *pUser, const uint8_t *pSet, uint32_t Length, KlvSetStatus_t Status);
+
+typedef struct
+{
+    // Callbacks and the user pointer handed back to them, either callback may be NULL
+    KlvTagCallback_t pTagCallback;
+    KlvSetCallback_t pSetCallback;
+    void *pUser;
+
+    // Parser state, and how far into the universal key or a BER field we are
+    int State;
+    uint32_t Match;
+    uint32_t LengthBytes;
+    uint64_t Accum;
+
+    // Bytes left in the set and in the current tag, and the current tag's key and offset
+    uint64_t SetRemaining;
+    uint64_t TagRemaining;
+    uint32_t TagKey;
+    uint32_t TagOffset;
+
+    // The set so far, starting with the universal key
+    uint8_t *pBuffer;
+    uint32_t Size;
+    uint32_t Capacity;
+
+    // Running checksum and its value up to the checksum tag's value, along with
+    //   the checksum the set itself carries
+    uint16_t Sum;
+    uint16_t SumAtChecksum;
+    uint16_t Checksum;
+    int HaveChecksum;
+
+    // Sets parsed, sets with bad checksums, and sets dropped for being malformed or too big
+    uint32_t Sets;
+    uint32_t BadChecksums;
+    uint32_t Dropped;
+
+} KlvStream_t;
+
+void KlvStreamInit(KlvStream_t *pStream, KlvTagCallback_t pTagCallback, KlvSetCallback_t pSetCallback, void *pUser);
+void KlvStreamFree(KlvStream_t *pStream);
+
+void KlvStreamPush(KlvStream_t *pStream, const uint8_t *pData, uint32_t Length);
+void KlvStreamReset(KlvStream_t *pStream);
+
+// Returns 1 if the parser is between sets
+int KlvStreamIsIdle(const KlvStream_t *pStream);
+
+// Walk a nested local set, handing each of its tags to pCallback as raw data
+int KlvParseLocalSet(const uint8_t *pData, uint32_t Length, KlvTagCallback_t pCallback, void *pUser);
+
+// Compute a MISB 0601 checksum over a buffer that starts with the universal key
+uint16_t KlvChecksum(const uint8_t *pData, uint32_t Length);
+
+#endif // KLVSTREAM_H
@@ -9,100 +9,167 @@
 
 #include <math.h>
 
-typedef struct KlvTag_t
+// One slot per possible key, since keys are a single byte
+#define KLV_TREE_KEYS 256
+
+// A tag's value, as a slice of the retained KLV data
+typedef struct
 {
-    uint8_t Key;
+    uint32_t Offset;
     uint32_t Length;
+} KlvSlice_t;
+
+// Retained KLV data and the tags found in it
+typedef struct
+{
+    // Copy of the KLV packet, followed by any values carried over from the last packet
     uint8_t *pData;
-    struct KlvTag_t *pNext;
-} KlvTag_t;
+    uint32_t Size;
+    uint32_t Capacity;
+
+    // Tag values indexed by key, and which keys have one
+    KlvSlice_t Tags[KLV_TREE_KEYS];
+    uint8_t Present[KLV_TREE_KEYS];
+
+    // Keys that have a value, in the order they showed up
+    uint8_t Keys[KLV_TREE_KEYS];
+    uint32_t NumKeys;
+} KlvTable_t;
 
-static KlvTag_t *pHeadTag = NULL;
+// Double buffered, so any tag a new packet leaves out can be carried over from the last one
+static KlvTable_t Tables[2];
+static int Current = 0;
 
-KlvTag_t *KlvCreateTag(void)
+static const uint8_t *KlvFindTag(uint8_t Key, uint32_t *pLength)
 {
-    KlvTag_t *pTag = (KlvTag_t *)calloc(1, sizeof(KlvTag_t)), *pHead = pHeadTag;
+    const KlvTable_t *pTable = &Tables[Current];
 
-    // As long as we have a pointer to a tag and its next sibling, keep iterating
-    while (pHead && pHead->pNext) { pHead = pHead->pNext; }
+    // Direct lookup: either the key has a value or it doesn't
+    if (pTable->Present[Key])
+    {
+        *pLength = pTable->Tags[Key].Length;
+        return &pTable->pData[pTable->Tags[Key].Offset];
+    }
 
-    // If we have a valid tag pointer, attach the new node as its sibling
-    if (pHead) pHead->pNext = pTag;
-    
-    // Return a pointer to the new tag
-    return pTag;
+    // Return NULL if no result
+    *pLength = 0;
+    return NULL;
 
-}// KlvCreateTag
+}// KlvFindTag
 
-KlvTag_t *KlvFindTag(uint8_t Key)
+int KlvTreeBegin(const uint8_t *pData, uint32_t Length)
 {
-    // Start at the head tag
-    KlvTag_t *pHead = pHeadTag;
+    KlvTable_t *pOld = &Tables[Current], *pNew = &Tables[Current ^ 1];
+    uint32_t i, Capacity;
+
+    // Room for the packet and everything we might carry over
+    Capacity = Length + pOld->Size + KLV_TREE_KEYS;
 
-    // As long as we have a valid tag pointer
-    while (pHead)
+    // If the buffer's too small, grow it. This stops happening once packet sizes settle down.
+    if (pNew->Capacity < Capacity)
     {
-        // If this is the one we're looking for, stop looping
-        if (pHead->Key == Key)
-            break;
-        // Otherwise, move down to the next element in the list
-        else
-            pHead = pHead->pNext;
+        uint8_t *pBuffer = (uint8_t *)realloc(pNew->pData, Capacity);
+
+        // No dice - leave the current values alone
+        if (pBuffer == NULL)
+            return 0;
+
+        pNew->pData = pBuffer;
+        pNew->Capacity = Capacity;
     }
 
-    // Return a pointer to the given tag, or NULL if no result
-    return pHead;
+    // Forget the values from two packets ago
+    for (i = 0; i < pNew->NumKeys; i++)
+        pNew->Present[pNew->Keys[i]] = 0;
+    pNew->NumKeys = 0;
 
-}// KlvFindTag
+    // Retain a copy of the packet, which all of the new tag values will point into
+    memcpy(pNew->pData, pData, Length);
+    pNew->Size = Length;
+
+    // The new table is the current one from here on out
+    Current ^= 1;
+    return 1;
 
-int KlvTreeSetValue(uint8_t Key, uint32_t Length, const uint8_t *pData)
+}// KlvTreeBegin
+
+int KlvTreeSetValue(uint8_t Key, uint32_t Offset, uint32_t Length)
 {
-    KlvTag_t *pTag = KlvFindTag(Key);
+    KlvTable_t *pTable = &Tables[Current];
+
+    // The value has to lie within the packet passed to KlvTreeBegin
+    if ((Offset > pTable->Size) || (Length > pTable->Size - Offset))
+        return 0;
 
-    // If we found an existing tag or are able to create a new one
-    if (pTag || (pTag = KlvCreateTag()))
+    // If this key is new to this packet, add it to the key list
+    if (pTable->Present[Key] == 0)
     {
-        // Copy in the key and length, and also try to allocate enough space for the data
-        pTag->Key = Key;
-        pTag->Length = Length;
-        pTag->pData = (uint8_t *)realloc(pTag->pData, Length);
+        pTable->Present[Key] = 1;
+        pTable->Keys[pTable->NumKeys++] = Key;
+    }
+
+    // Point the tag at its value
+    pTable->Tags[Key].Offset = Offset;
+    pTable->Tags[Key].Length = Length;
+    return 1;
+
+}// KlvTreeSetValue
+
+void KlvTreeEnd(void)
+{
+    KlvTable_t *pTable = &Tables[Current];
+    const KlvTable_t *pOld = &Tables[Current ^ 1];
+    uint32_t i;
+
+    // For every tag the last packet had and this one didn't
+    for (i = 0; i < pOld->NumKeys; i++)
+    {
+        uint8_t Key = pOld->Keys[i];
 
-        // If we have a good data pointer
-        if (pTag->pData)
+        if (pTable->Present[Key] == 0)
         {
-            // If we don't have a valid head element yet, install this one
-            if (pHeadTag == NULL)
-                pHeadTag = pTag;
+            const KlvSlice_t *pSlice = &pOld->Tags[Key];
 
-            // Copy in the incoming data and return 1 to indicate success
-            memcpy(pTag->pData, pData, Length);
-            return 1;
+            // Carry its value over to the end of the new buffer, which KlvTreeBegin made room for
+            memcpy(&pTable->pData[pTable->Size], &pOld->pData[pSlice->Offset], pSlice->Length);
+            pTable->Tags[Key].Offset = pTable->Size;
+            pTable->Tags[Key].Length = pSlice->Length;
+            pTable->Size += pSlice->Length;
+
+            // Add it to the key list
+            pTable->Present[Key] = 1;
+            pTable->Keys[pTable->NumKeys++] = Key;
         }
     }
 
-    // No dice - return 0
-    return 0;
-    
-}// KlvTreeSetValue
+}// KlvTreeEnd
 
 int KlvTreeHasKey(uint8_t Key)
 {
     // Return 1 if a tag with this key was parsed, or 0 if not
-    return (KlvFindTag(Key) != NULL);
+    return Tables[Current].Present[Key];
 
 }// KlvTreeHasKey
 
 double KlvTreeGetValueDouble(uint8_t Key, double Min, double Max, int *pResult)
 {
-    // Try to grab the right tag from our linked list
-    KlvTag_t *pTag = KlvFindTag(Key);
+    // Try to grab the right tag from the table, then decode whatever we find
+    uint32_t Length;
+    const uint8_t *pData = KlvFindTag(Key, &Length);
+
+    return KlvDecodeDouble(pData, Length, Min, Max, pResult);
+
+}// KlvTreeGetValueDouble
+
+double KlvDecodeDouble(const uint8_t *pData, uint32_t Length, double Min, double Max, int *pResult)
+{
     double Value = 0;
 
-    // Check for valid tag and data array
-    if (pTag && pTag->pData)
+    // Check for a valid data array
+    if (pData)
     {
         // Compute the inverse scale for this element
-        double Scale = (Max - Min) / (pow(2, pTag->Length * 8));
+        double Scale = (Max - Min) / (pow(2, Length * 8));
         int Index = 0;
 
         // Default result is success
@@ -112,17 +179,17 @@ double KlvTreeGetValueDouble(uint8_t Key, double Min, double Max, int *pResult)
         if (Min + Max != 0)
         {
             // Switch on tag length
-            switch (pTag->Length)
+            switch (Length)
             {
             // Use the appropriate Protogen function to get a value
-            case 1: Value = float64ScaledFrom1UnsignedBytes(pTag->pData,   &Index, Min, Scale); break;
-            case 2: Value = float64ScaledFrom2UnsignedBeBytes(pTag->pData, &Index, Min, Scale); break;
-            case 3: Value = float64ScaledFrom3UnsignedBeBytes(pTag->pData, &Index, Min, Scale); break;
-            case 4: Value = float64ScaledFrom4UnsignedBeBytes(pTag->pData, &Index, Min, Scale); break;
-            case 5: Value = float64ScaledFrom5UnsignedBeBytes(pTag->pData, &Index, Min, Scale); break;
-            case 6: Value = float64ScaledFrom6UnsignedBeBytes(pTag->pData, &Index, Min, Scale); break;
-            case 7: Value = float64ScaledFrom7UnsignedBeBytes(pTag->pData, &Index, Min, Scale); break;
-            case 8: Value = float64ScaledFrom8UnsignedBeBytes(pTag->pData, &Index, Min, Scale); break;
+            case 1: Value = float64ScaledFrom1UnsignedBytes(pData,   &Index, Min, Scale); break;
+            case 2: Value = float64ScaledFrom2UnsignedBeBytes(pData, &Index, Min, Scale); break;
+            case 3: Value = float64ScaledFrom3UnsignedBeBytes(pData, &Index, Min, Scale); break;
+            case 4: Value = float64ScaledFrom4UnsignedBeBytes(pData, &Index, Min, Scale); break;
+            case 5: Value = float64ScaledFrom5UnsignedBeBytes(pData, &Index, Min, Scale); break;
+            case 6: Value = float64ScaledFrom6UnsignedBeBytes(pData, &Index, Min, Scale); break;
+            case 7: Value = float64ScaledFrom7UnsignedBeBytes(pData, &Index, Min, Scale); break;
+            case 8: Value = float64ScaledFrom8UnsignedBeBytes(pData, &Index, Min, Scale); break;
 
             // Unhandled length: no dice
             default:
@@ -133,17 +200,17 @@ double KlvTreeGetValueDouble(uint8_t Key, double Min, double Max, int *pResult)
         else
         {
             // Switch on tag length
-            switch (pTag->Length)
+            switch (Length)
             {
             // Use the appropriate Protogen function to get a value
-            case 1: Value = float64ScaledFrom1SignedBytes(pTag->pData,   &Index, Scale); break;
-            case 2: Value = float64ScaledFrom2SignedBeBytes(pTag->pData, &Index, Scale); break;
-            case 3: Value = float64ScaledFrom3SignedBeBytes(pTag->pData, &Index, Scale); break;
-            case 4: Value = float64ScaledFrom4SignedBeBytes(pTag->pData, &Index, Scale); break;
-            case 5: Value = float64ScaledFrom5SignedBeBytes(pTag->pData, &Index, Scale); break;
-            case 6: Value = float64ScaledFrom6SignedBeBytes(pTag->pData, &Index, Scale); break;
-            case 7: Value = float64ScaledFrom7SignedBeBytes(pTag->pData, &Index, Scale); break;
-            case 8: Value = float64ScaledFrom8SignedBeBytes(pTag->pData, &Index, Scale); break;
+            case 1: Value = float64ScaledFrom1SignedBytes(pData,   &Index, Scale); break;
+            case 2: Value = float64ScaledFrom2SignedBeBytes(pData, &Index, Scale); break;
+            case 3: Value = float64ScaledFrom3SignedBeBytes(pData, &Index, Scale); break;
+            case 4: Value = float64ScaledFrom4SignedBeBytes(pData, &Index, Scale); break;
+            case 5: Value = float64ScaledFrom5SignedBeBytes(pData, &Index, Scale); break;
+            case 6: Value = float64ScaledFrom6SignedBeBytes(pData, &Index, Scale); break;
+            case 7: Value = float64ScaledFrom7SignedBeBytes(pData, &Index, Scale); break;
+            case 8: Value = float64ScaledFrom8SignedBeBytes(pData, &Index, Scale); break;
 
             // Unhandled length: no dice
             default:
@@ -158,16 +225,24 @@ double KlvTreeGetValueDouble(uint8_t Key, double Min, double Max, int *pResult)
 
     return Value;
 
-}// KlvTreeGetValueDouble
+}// KlvDecodeDouble
 
 int64_t KlvTreeGetValueInt(uint8_t Key, int *pResult)
 {
-    // Try to grab the right tag from our linked list
-    KlvTag_t *pTag = KlvFindTag(Key);
+    // Try to grab the right tag from the table, then decode whatever we find
+    uint32_t Length;
+    const uint8_t *pData = KlvFindTag(Key, &Length);
+
+    return KlvDecodeInt(pData, Length, pResult);
+
+}// KlvTreeGetValueInt
+
+int64_t KlvDecodeInt(const uint8_t *pData, uint32_t Length, int *pResult)
+{
     int64_t Value = 0;
 
-    // Check for valid tag and data array
-    if (pTag && pTag->pData)
+    // Check for a valid data array
+    if (pData)
     {
         int Index = 0;
 
@@ -175,17 +250,17 @@ int64_t KlvTreeGetValueInt(uint8_t Key, int *pResult)
         *pResult = 1;
 
         // Switch on tag length
-        switch (pTag->Length)
+        switch (Length)
         {
         // Use the appropriate Protogen function to get a value
-        case 1: Value = int8FromBytes(pTag->pData,    &Index); break;
-        case 2: Value = int16FromBeBytes(pTag->pData, &Index); break;
-        case 3: Value = int24FromBeBytes(pTag->pData, &Index); break;
-        case 4: Value = int32FromBeBytes(pTag->pData, &Index); break;
-        case 5: Value = int40FromBeBytes(pTag->pData, &Index); break;
-        case 6: Value = int48FromBeBytes(pTag->pData, &Index); break;
-        case 7: Value = int56FromBeBytes(pTag->pData, &Index); break;
-        case 8: Value = int64FromBeBytes(pTag->pData, &Index); break;
+        case 1: Value = int8FromBytes(pData,    &Index); break;
+        case 2: Value = int16FromBeBytes(pData, &Index); break;
+        case 3: Value = int24FromBeBytes(pData, &Index); break;
+        case 4: Value = int32FromBeBytes(pData, &Index); break;
+        case 5: Value = int40FromBeBytes(pData, &Index); break;
+        case 6: Value = int48FromBeBytes(pData, &Index); break;
+        case 7: Value = int56FromBeBytes(pData, &Index); break;
+        case 8: Value = int64FromBeBytes(pData, &Index); break;
 
         // Unhandled length: no dice
         default:
@@ -199,16 +274,24 @@ int64_t KlvTreeGetValueInt(uint8_t Key, int *pResult)
 
     return Value;
 
-}// KlvTreeGetValueInt
+}// KlvDecodeInt
 
 uint64_t KlvTreeGetValueUInt(uint8_t Key, int *pResult)
 {
-    // Try to grab the right tag from our linked list
-    KlvTag_t *pTag = KlvFindTag(Key);
+    // Try to grab the right tag from the table, then decode whatever we find
+    uint32_t Length;
+    const uint8_t *pData = KlvFindTag(Key, &Length);
+
+    return KlvDecodeUInt(pData, Length, pResult);
+
+}// KlvTreeGetValueUInt
+
+uint64_t KlvDecodeUInt(const uint8_t *pData, uint32_t Length, int *pResult)
+{
     uint64_t Value = 0;
 
-    // Check for valid tag and data array
-    if (pTag && pTag->pData)
+    // Check for a valid data array
+    if (pData)
     {
         int Index = 0;
 
@@ -216,17 +299,17 @@ uint64_t KlvTreeGetValueUInt(uint8_t Key, int *pResult)
         *pResult = 1;
 
         // Switch on tag length
-        switch (pTag->Length)
+        switch (Length)
         {
         // Use the appropriate Protogen function to get a value
-        case 1: Value = uint8FromBytes(pTag->pData,    &Index); break;
-        case 2: Value = uint16FromBeBytes(pTag->pData, &Index); break;
-        case 3: Value = uint24FromBeBytes(pTag->pData, &Index); break;
-        case 4: Value = uint32FromBeBytes(pTag->pData, &Index); break;
-        case 5: Value = uint40FromBeBytes(pTag->pData, &Index); break;
-        case 6: Value = uint48FromBeBytes(pTag->pData, &Index); break;
-        case 7: Value = uint56FromBeBytes(pTag->pData, &Index); break;
-        case 8: Value = uint64FromBeBytes(pTag->pData, &Index); break;
+        case 1: Value = uint8FromBytes(pData,    &Index); break;
+        case 2: Value = uint16FromBeBytes(pData, &Index); break;
+        case 3: Value = uint24FromBeBytes(pData, &Index); break;
+        case 4: Value = uint32FromBeBytes(pData, &Index); break;
+        case 5: Value = uint40FromBeBytes(pData, &Index); break;
+        case 6: Value = uint48FromBeBytes(pData, &Index); break;
+        case 7: Value = uint56FromBeBytes(pData, &Index); break;
+        case 8: Value = uint64FromBeBytes(pData, &Index); break;
 
         // Unhandled length: no dice
         default:
@@ -240,66 +323,52 @@ uint64_t KlvTreeGetValueUInt(uint8_t Key, int *pResult)
 
     return Value;
 
-}// KlvTreeGetValueInt
+}// KlvDecodeUInt
 
-const char *KlvTreeGetValueString(uint8_t Key)
+const char *KlvTreeGetValueString(uint8_t Key, char *pBuffer, uint32_t Size)
 {
-    // If we can find the right tag, just cast its value data to a string and return
-    KlvTag_t *pTag = KlvFindTag(Key);
-
-    // If this is a valid tag with a valid data pointer
-    if (pTag && pTag->pData)
-    {
-        // If the string is not null terminated
-        if (pTag->pData[pTag->Length - 1] != 0)
-        {
-            // Add a null byte to the end
-            pTag->pData = (uint8_t *)realloc(pTag->pData, pTag->Length + 1);
-            pTag->pData[pTag->Length++] = 0;
-        }
+    uint32_t Length;
+    const uint8_t *pData = KlvFindTag(Key, &Length);
 
-        // Return a C string
-        return (const char *)pTag->pData;
-    }
-    else
+    // If this isn't a valid tag or there's nowhere to put it, there's no string
+    if ((pData == NULL) || (Size == 0))
         return NULL;
 
+    // Copy out as much of the string as fits, and terminate the copy
+    if (Length > Size - 1)
+        Length = Size - 1;
+
+    memcpy(pBuffer, pData, Length);
+    pBuffer[Length] = 0;
+
+    // Return a C string
+    return pBuffer;
+
 }// KlvTreeGetValueString
 
 const uint8_t *KlvTreeGetValue(uint8_t Key, uint32_t *pLength)
 {
-    // If we can find the right tag, just cast its value data to a string and return
-    KlvTag_t *pTag = KlvFindTag(Key);
+    // Fill out the length and return the data pointer, or NULL if there's no such tag
+    return KlvFindTag(Key, pLength);
 
-    // If this is a valid tag with a valid data pointer
-    if (pTag && pTag->pData)
-    {
-        // Fill out the length and return the data pointer
-        *pLength = pTag->Length;
-        return pTag->pData;
-    }
-    else
-    {
-        *pLength = 0;
-        return NULL;
-    }
-
-}
+}// KlvTreeGetValue
 
 void KlvTreePrint(void)
 {
-    KlvTag_t *pTag = pHeadTag;
+    const KlvTable_t *pTable = &Tables[Current];
+    uint32_t k;
 
-    while (pTag)
+    // For each tag, in the order the tags showed up
+    for (k = 0; k < pTable->NumKeys; k++)
     {
+        const KlvSlice_t *pSlice = &pTable->Tags[pTable->Keys[k]];
+        const uint8_t *pData = &pTable->pData[pSlice->Offset];
         int i;
 
-        printf("TAG: Key = 0x%02x, Length = %d, Value = { ", pTag->Key, pTag->Length);
-
-        for (i = 0; i < pTag->Length; i++)
-            printf("0x%02x%s", pTag->pData[i], (i < pTag->Length - 1) ? ", " : " }\n");
+        printf("TAG: Key = 0x%02x, Length = %d, Value = { ", pTable->Keys[k], pSlice->Length);
 
-        pTag = pTag->pNext;
+        for (i = 0; i < pSlice->Length; i++)
+            printf("0x%02x%s", pData[i], (i < pSlice->Length - 1) ? ", " : " }\n");
     }
 
-}
+}// KlvTreePrint
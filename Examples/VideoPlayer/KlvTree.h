@@ -3,14 +3,30 @@
 
 #include <stdint.h>
 
-int KlvTreeSetValue(uint8_t Key, uint32_t Length, const uint8_t *pData);
+// Tag values are slices of a retained copy of the KLV packet, held in a table indexed
+//   directly by key. Each packet is loaded by calling KlvTreeBegin() with the whole packet,
+//   KlvTreeSetValue() with the offset and length of each tag's value within it, then
+//   KlvTreeEnd(), which keeps the last known value of any tag the packet left out. Pointers
+//   returned by the getters stay valid until the next KlvTreeBegin().
+int KlvTreeBegin(const uint8_t *pData, uint32_t Length);
+int KlvTreeSetValue(uint8_t Key, uint32_t Offset, uint32_t Length);
+void KlvTreeEnd(void);
+
 const uint8_t *KlvTreeGetValue(uint8_t Key, uint32_t *pLength);
 int KlvTreeHasKey(uint8_t Key);
 
 double KlvTreeGetValueDouble(uint8_t Key, double Min, double Max, int *pResult);
 int64_t KlvTreeGetValueInt(uint8_t Key, int *pResult);
 uint64_t KlvTreeGetValueUInt(uint8_t Key, int *pResult);
-const char *KlvTreeGetValueString(uint8_t Key);
+
+// Copies a string tag into pBuffer, truncated and null terminated to fit Size bytes,
+//   returning pBuffer or NULL if there's no such tag
+const char *KlvTreeGetValueString(uint8_t Key, char *pBuffer, uint32_t Size);
+
+// Decode a raw tag value, the same way the KlvTreeGetValue functions do
+double KlvDecodeDouble(const uint8_t *pData, uint32_t Length, double Min, double Max, int *pResult);
+int64_t KlvDecodeInt(const uint8_t *pData, uint32_t Length, int *pResult);
+uint64_t KlvDecodeUInt(const uint8_t *pData, uint32_t Length, int *pResult);
 
 void KlvTreePrint(void);
 
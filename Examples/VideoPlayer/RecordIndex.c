@@ -0,0 +1,302 @@
+#include "RecordIndex.h"
+#include "fieldencode.h"
+#include "fielddecode.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// How much of the index to buffer between flushes
+#define RECORD_INDEX_BUFFER (64 * 1024)
+
+static int EntriesFor(const RecordIndex_t *pIndex, int Clock, const RecordIndexEntry_t **ppEntries);
+static int64_t EntryTime(const RecordIndexEntry_t *pEntry, int Clock);
+static int Search(const RecordIndexEntry_t *pEntries, int Count, int Clock, int64_t Time);
+static size_t ExtensionStart(const char *pPath);
+
+int RecordIndexPath(const char *pRecordPath, char *pPath, int Size)
+{
+    size_t Length = ExtensionStart(pRecordPath);
+
+    // Swap the recording's extension for .idx
+    return snprintf(pPath, Size, "%.*s.idx", (int)Length, pRecordPath) < Size;
+
+}// RecordIndexPath
+
+int RecordSegmentPath(const char *pRecordPath, int Segment, int Numbered, char *pPath, int Size)
+{
+    size_t Length = ExtensionStart(pRecordPath);
+
+    // A single file recording is just the path it was given
+    if (!Numbered)
+        return snprintf(pPath, Size, "%s", pRecordPath) < Size;
+
+    // Otherwise the segment number goes in front of the extension
+    return snprintf(pPath, Size, "%.*s_%04d%s", (int)Length, pRecordPath, Segment, &pRecordPath[Length]) < Size;
+
+}// RecordSegmentPath
+
+int RecordIndexCreate(RecordIndexWriter_t *pWriter, const char *pRecordPath, uint64_t StartUs)
+{
+    uint8_t Header[RECORD_INDEX_HEADER_SIZE];
+    char Path[256];
+    int Index = 0;
+
+    pWriter->pFile = NULL;
+
+    // Open the index, with a buffer big enough that records only hit the disk when flushed
+    if (!RecordIndexPath(pRecordPath, Path, sizeof(Path)) || (pWriter->pFile = fopen(Path, "wb")) == NULL)
+        return 0;
+
+    setvbuf(pWriter->pFile, NULL, _IOFBF, RECORD_INDEX_BUFFER);
+
+    // Write out the header
+    memcpy(Header, "OVID", 4);
+    Index = 4;
+    uint16ToLeBytes(RECORD_INDEX_VERSION, Header, &Index);
+    uint16ToLeBytes(RECORD_INDEX_RECORD_SIZE, Header, &Index);
+    uint64ToLeBytes(StartUs, Header, &Index);
+
+    if (fwrite(Header, 1, Index, pWriter->pFile) != (size_t)Index)
+    {
+        RecordIndexFinish(pWriter);
+        return 0;
+    }
+
+    return 1;
+
+}// RecordIndexCreate
+
+int RecordIndexWrite(RecordIndexWriter_t *pWriter, const RecordIndexEntry_t *pEntry, int Flush)
+{
+    uint8_t Record[RECORD_INDEX_RECORD_SIZE];
+    int Index = 0;
+
+    if (pWriter->pFile == NULL)
+        return 0;
+
+    // Pack the record
+    Record[Index++] = pEntry->Type;
+    Record[Index++] = pEntry->Flags;
+    uint16ToLeBytes(pEntry->Segment, Record, &Index);
+    uint32ToLeBytes(pEntry->SystemTime, Record, &Index);
+    int64ToLeBytes(pEntry->StreamUs, Record, &Index);
+    uint64ToLeBytes(pEntry->TimeUs, Record, &Index);
+    uint64ToLeBytes(pEntry->Offset, Record, &Index);
+
+    if (fwrite(Record, 1, Index, pWriter->pFile) != (size_t)Index)
+        return 0;
+
+    // Push it out to the OS if asked, so it survives the application going down
+    return !Flush || (fflush(pWriter->pFile) == 0);
+
+}// RecordIndexWrite
+
+void RecordIndexFinish(RecordIndexWriter_t *pWriter)
+{
+    if (pWriter->pFile)
+        fclose(pWriter->pFile);
+
+    pWriter->pFile = NULL;
+
+}// RecordIndexFinish
+
+int RecordIndexOpen(RecordIndex_t *pIndex, const char *pRecordPath)
+{
+    uint8_t *pData = NULL;
+    char Path[256];
+    FILE *pFile;
+    long Size;
+    int Count, i, Index = 0;
+
+    memset(pIndex, 0, sizeof(RecordIndex_t));
+
+    // Read the whole index in one go, it's only 32 bytes a keyframe
+    if (!RecordIndexPath(pRecordPath, Path, sizeof(Path)) || (pFile = fopen(Path, "rb")) == NULL)
+        return 0;
+
+    if ((fseek(pFile, 0, SEEK_END) == 0) && ((Size = ftell(pFile)) >= RECORD_INDEX_HEADER_SIZE) &&
+        (fseek(pFile, 0, SEEK_SET) == 0) && ((pData = (uint8_t *)malloc(Size)) != NULL) &&
+        (fread(pData, 1, Size, pFile) == (size_t)Size))
+    {
+        Index = 4;
+    }
+
+    fclose(pFile);
+
+    // Check the header, which is all that's left if the read failed
+    if ((Index == 0) || (memcmp(pData, "OVID", 4) != 0) ||
+        (uint16FromLeBytes(pData, &Index) != RECORD_INDEX_VERSION) ||
+        (uint16FromLeBytes(pData, &Index) != RECORD_INDEX_RECORD_SIZE))
+    {
+        free(pData);
+        return 0;
+    }
+
+    strncpy(pIndex->Path, pRecordPath, sizeof(pIndex->Path) - 1);
+    pIndex->StartUs = uint64FromLeBytes(pData, &Index);
+
+    // A partial record at the end is from a crash mid-write, just leave it off
+    Count = (int)((Size - RECORD_INDEX_HEADER_SIZE) / RECORD_INDEX_RECORD_SIZE);
+    pIndex->pKeyframes = (RecordIndexEntry_t *)malloc((Count + 1) * sizeof(RecordIndexEntry_t));
+    pIndex->pClocks = (RecordIndexEntry_t *)malloc((Count + 1) * sizeof(RecordIndexEntry_t));
+
+    if ((pIndex->pKeyframes == NULL) || (pIndex->pClocks == NULL))
+    {
+        free(pData);
+        RecordIndexClose(pIndex);
+        return 0;
+    }
+
+    // Unpack each record
+    for (i = 0; i < Count; i++)
+    {
+        RecordIndexEntry_t Entry;
+
+        Entry.Type       = pData[Index++];
+        Entry.Flags      = pData[Index++];
+        Entry.Segment    = uint16FromLeBytes(pData, &Index);
+        Entry.SystemTime = uint32FromLeBytes(pData, &Index);
+        Entry.StreamUs   = int64FromLeBytes(pData, &Index);
+        Entry.TimeUs     = uint64FromLeBytes(pData, &Index);
+        Entry.Offset     = uint64FromLeBytes(pData, &Index);
+
+        // Sort it by type, skipping anything a later version might have added
+        switch (Entry.Type)
+        {
+        case RECORD_INDEX_SEGMENT:
+            if (Entry.Segment >= pIndex->NumSegments)
+                pIndex->NumSegments = Entry.Segment + 1;
+            pIndex->Numbered = (Entry.Flags & RECORD_INDEX_NUMBERED) != 0;
+            break;
+
+        case RECORD_INDEX_KEYFRAME: pIndex->pKeyframes[pIndex->NumKeyframes++] = Entry; break;
+        case RECORD_INDEX_CLOCK:    pIndex->pClocks[pIndex->NumClocks++] = Entry; break;
+        default: break;
+        }
+    }
+
+    free(pData);
+
+    return 1;
+
+}// RecordIndexOpen
+
+void RecordIndexClose(RecordIndex_t *pIndex)
+{
+    free(pIndex->pKeyframes);
+    free(pIndex->pClocks);
+    memset(pIndex, 0, sizeof(RecordIndex_t));
+
+}// RecordIndexClose
+
+int RecordIndexConvert(const RecordIndex_t *pIndex, int FromClock, int64_t Time, int ToClock, int64_t *pResult)
+{
+    const RecordIndexEntry_t *pEntries, *pEntry;
+    int64_t StreamUs = Time;
+    int Count;
+
+    // Everything goes through the stream clock, which every record has. The keyframe records
+    //   relate it to the host clock and the clock records to UTC and the gimbal's system time.
+    if (FromClock != RECORD_CLOCK_STREAM)
+    {
+        if ((Count = EntriesFor(pIndex, FromClock, &pEntries)) == 0)
+            return 0;
+
+        // Offset from the nearest record at or before the time
+        pEntry = &pEntries[Search(pEntries, Count, FromClock, Time)];
+        StreamUs = pEntry->StreamUs + (Time - EntryTime(pEntry, FromClock)) * (FromClock == RECORD_CLOCK_SYSTEM ? 1000 : 1);
+    }
+
+    if (ToClock == RECORD_CLOCK_STREAM)
+    {
+        *pResult = StreamUs;
+        return 1;
+    }
+
+    if ((Count = EntriesFor(pIndex, ToClock, &pEntries)) == 0)
+        return 0;
+
+    pEntry = &pEntries[Search(pEntries, Count, RECORD_CLOCK_STREAM, StreamUs)];
+    *pResult = EntryTime(pEntry, ToClock) + (StreamUs - pEntry->StreamUs) / (ToClock == RECORD_CLOCK_SYSTEM ? 1000 : 1);
+
+    return 1;
+
+}// RecordIndexConvert
+
+int RecordIndexFind(const RecordIndex_t *pIndex, int Clock, int64_t Time, RecordIndexEntry_t *pKeyframe)
+{
+    int64_t StreamUs;
+
+    // Keyframes are in stream order, so find the time on the stream clock and search for it
+    if ((pIndex->NumKeyframes == 0) || !RecordIndexConvert(pIndex, Clock, Time, RECORD_CLOCK_STREAM, &StreamUs))
+        return 0;
+
+    *pKeyframe = pIndex->pKeyframes[Search(pIndex->pKeyframes, pIndex->NumKeyframes, RECORD_CLOCK_STREAM, StreamUs)];
+
+    return 1;
+
+}// RecordIndexFind
+
+static int EntriesFor(const RecordIndex_t *pIndex, int Clock, const RecordIndexEntry_t **ppEntries)
+{
+    switch (Clock)
+    {
+    case RECORD_CLOCK_STREAM:
+    case RECORD_CLOCK_HOST:
+        *ppEntries = pIndex->pKeyframes;
+        return pIndex->NumKeyframes;
+
+    case RECORD_CLOCK_UTC:
+    case RECORD_CLOCK_SYSTEM:
+        *ppEntries = pIndex->pClocks;
+        return pIndex->NumClocks;
+
+    default:
+        return 0;
+    }
+
+}// EntriesFor
+
+static int64_t EntryTime(const RecordIndexEntry_t *pEntry, int Clock)
+{
+    switch (Clock)
+    {
+    case RECORD_CLOCK_STREAM: return pEntry->StreamUs;
+    case RECORD_CLOCK_SYSTEM: return pEntry->SystemTime;
+    default:                  return (int64_t)pEntry->TimeUs;
+    }
+
+}// EntryTime
+
+static int Search(const RecordIndexEntry_t *pEntries, int Count, int Clock, int64_t Time)
+{
+    int Low = 0, High = Count - 1;
+
+    // Binary search for the last entry at or before the time, or the first entry if there isn't one
+    while (Low < High)
+    {
+        int Middle = Low + (High - Low + 1) / 2;
+
+        if (EntryTime(&pEntries[Middle], Clock) <= Time)
+            Low = Middle;
+        else
+            High = Middle - 1;
+    }
+
+    return Low;
+
+}// Search
+
+static size_t ExtensionStart(const char *pPath)
+{
+    const char *pDot = strrchr(pPath, '.');
+    const char *pSlash = strrchr(pPath, '/');
+    const char *pBackslash = strrchr(pPath, '\\');
+
+    // Only a dot in the file name itself starts an extension
+    if ((pDot == NULL) || (pSlash && (pDot < pSlash)) || (pBackslash && (pDot < pBackslash)))
+        return strlen(pPath);
+
+    return (size_t)(pDot - pPath);
+
+}// ExtensionStart
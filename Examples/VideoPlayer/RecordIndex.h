@@ -0,0 +1,110 @@
+#ifndef RECORDINDEX_H
+#define RECORDINDEX_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Sidecar index for a segmented video recording, which lets a player jump to any moment of a
+//   multi-hour mission without scanning the video. A recording made to "mission.ts" is written to
+//   mission_0000.ts, mission_0001.ts and so on, with the index in mission.idx. The index is a 16
+//   byte header followed by fixed size 32 byte records, all little endian:
+//
+//   File header: "OVID", UInt16 Version, UInt16 record size, UInt64 host time the recording started
+//   Record:      UInt8 Type, UInt8 Flags, UInt16 Segment, UInt32 gimbal system time in ms,
+//                Int64 stream time in us, UInt64 time in us, UInt64 byte offset into the segment
+//
+// Segment records mark the start of each segment file. Keyframe records give the host wall clock
+//   time each keyframe arrived at, in the same microseconds since the Unix epoch that telemetry
+//   captures (OrionCommCapture.h) use, so a capture recorded alongside can be seeked to match.
+//   Clock records tie the stream clock to UTC and the gimbal's system time, whenever the
+//   application knows them. Stream times are the timestamps in the recorded files, which are
+//   continuous across segments. Records are flushed at every keyframe, so a crash loses at most
+//   the last group of pictures.
+
+// Index format version written to the file header
+#define RECORD_INDEX_VERSION     1
+
+// Sizes of the file header and each record in bytes
+#define RECORD_INDEX_HEADER_SIZE 16
+#define RECORD_INDEX_RECORD_SIZE 32
+
+// Record types
+#define RECORD_INDEX_SEGMENT     1
+#define RECORD_INDEX_KEYFRAME    2
+#define RECORD_INDEX_CLOCK       3
+
+// Flag on segment records whose file names are numbered, rather than the recording path itself
+#define RECORD_INDEX_NUMBERED    0x01
+
+// Clocks that a time can be given in, all in microseconds except for the system time in ms
+#define RECORD_CLOCK_STREAM      0
+#define RECORD_CLOCK_HOST        1
+#define RECORD_CLOCK_UTC         2
+#define RECORD_CLOCK_SYSTEM      3
+
+typedef struct
+{
+    // RECORD_INDEX_SEGMENT, KEYFRAME or CLOCK, its flags, and the segment it's in
+    uint8_t Type;
+    uint8_t Flags;
+    uint16_t Segment;
+
+    // Stream time in microseconds, which every record has
+    int64_t StreamUs;
+
+    // Host arrival time for segment and keyframe records, UTC and gimbal system time in ms for clock records
+    uint64_t TimeUs;
+    uint32_t SystemTime;
+
+    // Where the keyframe, or the segment, starts in its file
+    uint64_t Offset;
+
+} RecordIndexEntry_t;
+
+// An index being written alongside a recording
+typedef struct
+{
+    FILE *pFile;
+
+} RecordIndexWriter_t;
+
+// An index read back into memory
+typedef struct
+{
+    // Keyframe and clock records, each in the order they were written
+    RecordIndexEntry_t *pKeyframes;
+    int NumKeyframes;
+    RecordIndexEntry_t *pClocks;
+    int NumClocks;
+
+    // Number of segment files and whether they're numbered
+    int NumSegments;
+    int Numbered;
+
+    // Host time the recording started, and the path it was recorded to
+    uint64_t StartUs;
+    char Path[256];
+
+} RecordIndex_t;
+
+// Names of the index and of each segment for a recording path, returns 0 if they don't fit
+int RecordIndexPath(const char *pRecordPath, char *pPath, int Size);
+int RecordSegmentPath(const char *pRecordPath, int Segment, int Numbered, char *pPath, int Size);
+
+// Writing an index
+int RecordIndexCreate(RecordIndexWriter_t *pWriter, const char *pRecordPath, uint64_t StartUs);
+int RecordIndexWrite(RecordIndexWriter_t *pWriter, const RecordIndexEntry_t *pEntry, int Flush);
+void RecordIndexFinish(RecordIndexWriter_t *pWriter);
+
+// Reading the index of a recording, which may have been cut short by a crash
+int RecordIndexOpen(RecordIndex_t *pIndex, const char *pRecordPath);
+void RecordIndexClose(RecordIndex_t *pIndex);
+
+// Convert a time from one clock to another, returns 0 if the index can't relate the two
+int RecordIndexConvert(const RecordIndex_t *pIndex, int FromClock, int64_t Time, int ToClock, int64_t *pResult);
+
+// Find the last keyframe at or before a time on any clock, or the first keyframe if the time is
+//   before the recording started, returns 0 if there isn't one
+int RecordIndexFind(const RecordIndex_t *pIndex, int Clock, int64_t Time, RecordIndexEntry_t *pKeyframe);
+
+#endif // RECORDINDEX_H
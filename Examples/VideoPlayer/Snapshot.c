@@ -0,0 +1,731 @@
+#include "Snapshot.h"
+#include "Constants.h"
+#include "FFmpeg.h"
+#include "SpscQueue.h"
+#include "mathutilities.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include <jpeglib.h>
+
+// Compressing into memory takes libjpeg 8 or libjpeg-turbo, anything older compresses straight to the file
+#if defined(MEM_SRCDST_SUPPORTED) || (JPEG_LIB_VERSION >= 80)
+#define SNAPSHOT_MEM_DEST 1
+#endif
+
+// Idle time for a worker that has nothing to do, in microseconds
+#define WORKER_IDLE_US 2000
+
+// Luma rows in each strip handed to libjpeg, which is one row of 4:2:0 MCUs
+#define STRIP_ROWS 16
+
+// A frame waiting to be saved
+typedef struct
+{
+    AVFrame *pFrame;
+    SnapshotInfo_t Info;
+
+} SnapshotSlot_t;
+
+// The planes of a 4:2:0 image, with U and V in one plane for NV12
+typedef struct
+{
+    const uint8_t *pY, *pU, *pV;
+    int StrideY, StrideUV;
+    int Width, Height;
+
+    // 1 if U and V alternate in pU, and 1 if the samples already go from 0 to 255 like JPEG's do
+    int Interleaved;
+    int FullRange;
+
+} SnapshotPlanes_t;
+
+typedef struct
+{
+    SnapshotWriter_t *pWriter;
+
+    // Slots waiting for this worker, and this worker's slots that are free to be filled again
+    SpscQueue_t Jobs;
+    SpscQueue_t Free;
+
+    pthread_t Thread;
+    int Running;
+
+    // Frames downloaded from GPU memory, and frames converted from formats that aren't 4:2:0
+    AVFrame *pSwFrame;
+    struct SwsContext *pSwsContext;
+    uint8_t *pConverted;
+    size_t ConvertedBytes;
+
+    // Range-mapped rows on their way to libjpeg
+    uint8_t *pStrip;
+    size_t StripBytes;
+
+    // Compressed image on its way to the disk
+    unsigned char *pJpeg;
+    size_t JpegBytes;
+
+    // Snapshots this worker saved and failed to save, written only by the worker
+    uint32_t Saved;
+    uint32_t Failed;
+
+} SnapshotWorker_t;
+
+struct SnapshotWriter
+{
+    // Worker threads, each with its own share of the slots
+    SnapshotWorker_t *pWorkers;
+    int NumWorkers;
+    SnapshotSlot_t *pSlots;
+    int NumSlots;
+
+    int Quality;
+    SnapshotCallback_t pCallback;
+
+    // Worker that gets the next snapshot, and the producer's counters
+    int Next;
+    uint32_t Queued;
+    uint32_t Dropped;
+
+    // Set when the workers should finish what's queued and exit
+    int Stop;
+
+    // Sample maps from full range and limited range luma and chroma to JPEG's full range
+    uint8_t Identity[256];
+    uint8_t RangeY[256];
+    uint8_t RangeUV[256];
+};
+
+static void *WorkerThread(void *pArg);
+static const AVFrame *GetSoftwareFrame(SnapshotWorker_t *pWorker, const AVFrame *pFrame);
+static int SaveFrame(SnapshotWorker_t *pWorker, const AVFrame *pFrame, const SnapshotInfo_t *pInfo);
+static int ConvertFrame(SnapshotWorker_t *pWorker, const AVFrame *pFrame, SnapshotPlanes_t *pPlanes);
+static int EncodeYuv(SnapshotWorker_t *pWorker, const SnapshotPlanes_t *pPlanes, const SnapshotInfo_t *pInfo);
+static void FillStrip(SnapshotWorker_t *pWorker, const SnapshotPlanes_t *pPlanes, int Row, int PadY, int PadUV, JSAMPIMAGE pRows);
+static int GrowBuffer(uint8_t **ppBuffer, size_t *pBytes, size_t Bytes);
+static void WriteExifData(struct jpeg_compress_struct *pInfo, const double Lla[NLLA], uint64_t TimeStamp);
+
+SnapshotWriter_t *SnapshotWriterOpen(int Threads, int Slots, int Quality, SnapshotCallback_t pCallback)
+{
+    SnapshotWriter_t *pWriter;
+    uint32_t Capacity = 2;
+    int i, PerWorker;
+
+    // Every worker needs at least one slot, and the slots get split up evenly
+    if (Threads < 1)
+        Threads = 1;
+
+    PerWorker = (Slots + Threads - 1) / Threads;
+    if (PerWorker < 1)
+        PerWorker = 1;
+
+    // Each worker's queues hold all of its slots, so pushing onto them can never fail
+    while (Capacity < (uint32_t)PerWorker)
+        Capacity <<= 1;
+
+    if ((pWriter = (SnapshotWriter_t *)calloc(1, sizeof(SnapshotWriter_t))) == NULL)
+        return NULL;
+
+    pWriter->Quality = Quality;
+    pWriter->pCallback = pCallback;
+
+    // Limited range video puts black at 16 and white at 235, with chroma from 16 to 240 around 128
+    for (i = 0; i < 256; i++)
+    {
+        int Y = ((i - 16) * 255 + 109) / 219;
+        int C = 128 + ((i - 128) * 255 + ((i < 128) ? -112 : 112)) / 224;
+
+        pWriter->Identity[i] = (uint8_t)i;
+        pWriter->RangeY[i] = (uint8_t)((Y < 0) ? 0 : (Y > 255) ? 255 : Y);
+        pWriter->RangeUV[i] = (uint8_t)((C < 0) ? 0 : (C > 255) ? 255 : C);
+    }
+
+    pWriter->pWorkers = (SnapshotWorker_t *)calloc(Threads, sizeof(SnapshotWorker_t));
+    pWriter->pSlots = (SnapshotSlot_t *)calloc(Threads * PerWorker, sizeof(SnapshotSlot_t));
+    if ((pWriter->pWorkers == NULL) || (pWriter->pSlots == NULL))
+    {
+        SnapshotWriterClose(pWriter);
+        return NULL;
+    }
+
+    pWriter->NumWorkers = Threads;
+    pWriter->NumSlots = Threads * PerWorker;
+
+    // Each slot holds on to one frame reference while it waits
+    for (i = 0; i < pWriter->NumSlots; i++)
+    {
+        if ((pWriter->pSlots[i].pFrame = av_frame_alloc()) == NULL)
+        {
+            SnapshotWriterClose(pWriter);
+            return NULL;
+        }
+    }
+
+    // Hand each worker its slots, then start it up
+    for (i = 0; i < Threads; i++)
+    {
+        SnapshotWorker_t *pWorker = &pWriter->pWorkers[i];
+        int j;
+
+        pWorker->pWriter = pWriter;
+
+        if (!SpscQueueInit(&pWorker->Jobs, Capacity) || !SpscQueueInit(&pWorker->Free, Capacity) ||
+            ((pWorker->pSwFrame = av_frame_alloc()) == NULL))
+        {
+            SnapshotWriterClose(pWriter);
+            return NULL;
+        }
+
+        for (j = 0; j < PerWorker; j++)
+            SpscQueuePush(&pWorker->Free, &pWriter->pSlots[i * PerWorker + j]);
+
+        if (pthread_create(&pWorker->Thread, NULL, WorkerThread, pWorker) != 0)
+        {
+            SnapshotWriterClose(pWriter);
+            return NULL;
+        }
+
+        pWorker->Running = 1;
+    }
+
+    return pWriter;
+
+}// SnapshotWriterOpen
+
+void SnapshotWriterClose(SnapshotWriter_t *pWriter)
+{
+    int i;
+
+    if (pWriter == NULL)
+        return;
+
+    // Let the workers finish everything that's been queued, then wait for them to exit
+    __atomic_store_n(&pWriter->Stop, 1, __ATOMIC_RELEASE);
+
+    for (i = 0; i < pWriter->NumWorkers; i++)
+    {
+        SnapshotWorker_t *pWorker = &pWriter->pWorkers[i];
+
+        if (pWorker->Running)
+            pthread_join(pWorker->Thread, NULL);
+
+        SpscQueueFree(&pWorker->Jobs);
+        SpscQueueFree(&pWorker->Free);
+        av_frame_free(&pWorker->pSwFrame);
+        sws_freeContext(pWorker->pSwsContext);
+        free(pWorker->pConverted);
+        free(pWorker->pStrip);
+        free(pWorker->pJpeg);
+    }
+
+    // Freeing the slots' frames lets go of anything that never made it to a worker
+    for (i = 0; i < pWriter->NumSlots; i++)
+        av_frame_free(&pWriter->pSlots[i].pFrame);
+
+    free(pWriter->pWorkers);
+    free(pWriter->pSlots);
+    free(pWriter);
+
+}// SnapshotWriterClose
+
+int SnapshotWriterQueue(SnapshotWriter_t *pWriter, AVFrame *pFrame, const SnapshotInfo_t *pInfo)
+{
+#ifdef FFMPEG_HAS_FRAME_REFS
+    int i;
+
+    // Start with the worker whose turn it is, moving on to the others if all of its slots are busy
+    for (i = 0; i < pWriter->NumWorkers; i++)
+    {
+        int Index = (pWriter->Next + i) % pWriter->NumWorkers;
+        SnapshotWorker_t *pWorker = &pWriter->pWorkers[Index];
+        SnapshotSlot_t *pSlot = (SnapshotSlot_t *)SpscQueuePop(&pWorker->Free);
+
+        if (pSlot != NULL)
+        {
+            // Take over the caller's reference, so the frame itself never gets copied
+            av_frame_move_ref(pSlot->pFrame, pFrame);
+            pSlot->Info = *pInfo;
+
+            SpscQueuePush(&pWorker->Jobs, pSlot);
+            pWriter->Next = (Index + 1) % pWriter->NumWorkers;
+            pWriter->Queued++;
+            return 1;
+        }
+    }
+#endif // FFMPEG_HAS_FRAME_REFS
+
+    // Every slot is busy, or frames can't be shared in this FFmpeg
+    pWriter->Dropped++;
+    return 0;
+
+}// SnapshotWriterQueue
+
+void SnapshotWriterGetStats(const SnapshotWriter_t *pWriter, SnapshotStats_t *pStats)
+{
+    int i;
+
+    pStats->Queued = pWriter->Queued;
+    pStats->Dropped = pWriter->Dropped;
+    pStats->Saved = pStats->Failed = 0;
+
+    // Each worker counts its own results
+    for (i = 0; i < pWriter->NumWorkers; i++)
+    {
+        pStats->Saved += __atomic_load_n(&pWriter->pWorkers[i].Saved, __ATOMIC_RELAXED);
+        pStats->Failed += __atomic_load_n(&pWriter->pWorkers[i].Failed, __ATOMIC_RELAXED);
+    }
+
+}// SnapshotWriterGetStats
+
+static void *WorkerThread(void *pArg)
+{
+    SnapshotWorker_t *pWorker = (SnapshotWorker_t *)pArg;
+    SnapshotWriter_t *pWriter = pWorker->pWriter;
+    SnapshotSlot_t *pSlot;
+
+    // Keep going until we're told to stop and there's nothing left to save
+    while (1)
+    {
+        // Check for the stop request before popping, so nothing queued before it is lost
+        int Stop = __atomic_load_n(&pWriter->Stop, __ATOMIC_ACQUIRE);
+
+        if ((pSlot = (SnapshotSlot_t *)SpscQueuePop(&pWorker->Jobs)) != NULL)
+        {
+            const AVFrame *pFrame = GetSoftwareFrame(pWorker, pSlot->pFrame);
+            int Saved = (pFrame != NULL) && SaveFrame(pWorker, pFrame, &pSlot->Info);
+
+            __atomic_fetch_add(Saved ? &pWorker->Saved : &pWorker->Failed, 1, __ATOMIC_RELAXED);
+
+            // Let the application know, while the frame is still around for it to look at
+            if (pWriter->pCallback != NULL)
+                pWriter->pCallback(&pSlot->Info, pFrame, Saved);
+
+            // Let go of the frame, then give the slot back to the producer
+            av_frame_unref(pSlot->pFrame);
+            av_frame_unref(pWorker->pSwFrame);
+            SpscQueuePush(&pWorker->Free, pSlot);
+        }
+        else if (Stop)
+            break;
+        else
+            usleep(WORKER_IDLE_US);
+    }
+
+    return NULL;
+
+}// WorkerThread
+
+static const AVFrame *GetSoftwareFrame(SnapshotWorker_t *pWorker, const AVFrame *pFrame)
+{
+#ifdef FFMPEG_HAS_HWACCEL
+    // Frames that live in GPU memory have to be downloaded first, which usually gives NV12
+    if (pFrame->hw_frames_ctx != NULL)
+    {
+        if ((av_hwframe_transfer_data(pWorker->pSwFrame, pFrame, 0) < 0) || (av_frame_copy_props(pWorker->pSwFrame, pFrame) < 0))
+            return NULL;
+
+        return pWorker->pSwFrame;
+    }
+#endif // FFMPEG_HAS_HWACCEL
+
+    // Everything else is already in system memory
+    return pFrame;
+
+}// GetSoftwareFrame
+
+static int SaveFrame(SnapshotWorker_t *pWorker, const AVFrame *pFrame, const SnapshotInfo_t *pInfo)
+{
+    SnapshotPlanes_t Planes;
+
+    if ((pFrame->width <= 0) || (pFrame->height <= 0))
+        return 0;
+
+    Planes.Width = pFrame->width;
+    Planes.Height = pFrame->height;
+    Planes.FullRange = (pFrame->color_range == AVCOL_RANGE_JPEG);
+
+    switch (pFrame->format)
+    {
+    case AV_PIX_FMT_YUVJ420P:
+        Planes.FullRange = 1;
+        // Fall through
+    case AV_PIX_FMT_YUV420P:
+        // Software decoders hand out the planes just the way libjpeg wants them
+        Planes.pY = pFrame->data[0];
+        Planes.pU = pFrame->data[1];
+        Planes.pV = pFrame->data[2];
+        Planes.StrideY = pFrame->linesize[0];
+        Planes.StrideUV = pFrame->linesize[1];
+        Planes.Interleaved = 0;
+        break;
+
+    case AV_PIX_FMT_NV12:
+        // Hardware decoders interleave the chroma, which gets pulled apart a strip at a time
+        Planes.pY = pFrame->data[0];
+        Planes.pU = pFrame->data[1];
+        Planes.pV = pFrame->data[1] + 1;
+        Planes.StrideY = pFrame->linesize[0];
+        Planes.StrideUV = pFrame->linesize[1];
+        Planes.Interleaved = 1;
+        break;
+
+    default:
+        // Anything else (4:2:2, 10 bit, ...) goes through swscale first
+        if (!ConvertFrame(pWorker, pFrame, &Planes))
+            return 0;
+        break;
+    }
+
+    return EncodeYuv(pWorker, &Planes, pInfo);
+
+}// SaveFrame
+
+static int ConvertFrame(SnapshotWorker_t *pWorker, const AVFrame *pFrame, SnapshotPlanes_t *pPlanes)
+{
+    int ChromaWidth = (pFrame->width + 1) / 2, ChromaHeight = (pFrame->height + 1) / 2;
+    int StrideY = (pFrame->width + 31) & ~31, StrideUV = (ChromaWidth + 31) & ~31;
+    uint8_t *pData[4];
+    int Stride[4] = { StrideY, StrideUV, StrideUV, 0 };
+
+    // Convert into a buffer that's kept from one snapshot to the next, growing it for bigger frames
+    if (!GrowBuffer(&pWorker->pConverted, &pWorker->ConvertedBytes, (size_t)StrideY * pFrame->height + (size_t)StrideUV * ChromaHeight * 2))
+        return 0;
+
+    pData[0] = pWorker->pConverted;
+    pData[1] = pData[0] + (size_t)StrideY * pFrame->height;
+    pData[2] = pData[1] + (size_t)StrideUV * ChromaHeight;
+    pData[3] = NULL;
+
+    // Reuse the converter from the last call, which only gets rebuilt if the frame size or format has changed
+    pWorker->pSwsContext = sws_getCachedContext(pWorker->pSwsContext, pFrame->width, pFrame->height, pFrame->format,
+                                                pFrame->width, pFrame->height, AV_PIX_FMT_YUV420P,
+                                                SWS_FAST_BILINEAR, NULL, NULL, NULL);
+    if (pWorker->pSwsContext == NULL)
+        return 0;
+
+    sws_scale(pWorker->pSwsContext, (const uint8_t **)pFrame->data, pFrame->linesize, 0, pFrame->height, pData, Stride);
+
+    // swscale writes limited range 4:2:0
+    pPlanes->pY = pData[0];
+    pPlanes->pU = pData[1];
+    pPlanes->pV = pData[2];
+    pPlanes->StrideY = StrideY;
+    pPlanes->StrideUV = StrideUV;
+    pPlanes->Width = pFrame->width;
+    pPlanes->Height = pFrame->height;
+    pPlanes->Interleaved = 0;
+    pPlanes->FullRange = 0;
+    return 1;
+
+}// ConvertFrame
+
+static int EncodeYuv(SnapshotWorker_t *pWorker, const SnapshotPlanes_t *pPlanes, const SnapshotInfo_t *pInfo)
+{
+    int Width = pPlanes->Width, Height = pPlanes->Height, ChromaHeight = (Height + 1) / 2;
+
+    // libjpeg reads whole 8x8 blocks, so rows have to be readable out to a multiple of 8 samples
+    int PadY = (Width + 7) & ~7, PadUV = ((Width + 1) / 2 + 7) & ~7;
+
+    // Full range planes with room for the padding can go to libjpeg without being touched
+    int Direct = pPlanes->FullRange && !pPlanes->Interleaved && (pPlanes->StrideY >= PadY) && (pPlanes->StrideUV >= PadUV);
+
+    struct jpeg_compress_struct Info;
+    struct jpeg_error_mgr Error;
+    JSAMPROW pRowsY[STRIP_ROWS], pRowsU[STRIP_ROWS / 2], pRowsV[STRIP_ROWS / 2];
+    JSAMPARRAY pRows[3] = { pRowsY, pRowsU, pRowsV };
+    int Row, i, Result = 1;
+    FILE *pFile;
+#ifdef SNAPSHOT_MEM_DEST
+    unsigned char *pOut;
+    unsigned long OutBytes;
+#endif // SNAPSHOT_MEM_DEST
+
+    // Everything else gets mapped into a strip buffer one row of MCUs at a time
+    if (!Direct && !GrowBuffer(&pWorker->pStrip, &pWorker->StripBytes, (size_t)(PadY + PadUV) * STRIP_ROWS))
+        return 0;
+
+#ifdef SNAPSHOT_MEM_DEST
+    // A byte per pixel is plenty for any sensible quality, and libjpeg grows the buffer if it isn't
+    if (!GrowBuffer(&pWorker->pJpeg, &pWorker->JpegBytes, (size_t)Width * Height + 65536))
+        return 0;
+
+    pOut = pWorker->pJpeg;
+    OutBytes = (unsigned long)pWorker->JpegBytes;
+#else
+    if ((pFile = fopen(pInfo->Path, "wb")) == NULL)
+        return 0;
+#endif // SNAPSHOT_MEM_DEST
+
+    // Not sure why this has to happen first...
+    Info.err = jpeg_std_error(&Error);
+
+    // Initialize the compressor subsystem
+    jpeg_create_compress(&Info);
+#ifdef SNAPSHOT_MEM_DEST
+    jpeg_mem_dest(&Info, &pOut, &OutBytes);
+#else
+    jpeg_stdio_dest(&Info, pFile);
+#endif // SNAPSHOT_MEM_DEST
+
+    // Populate some information regarding the image format
+    Info.image_width      = Width;
+    Info.image_height     = Height;
+    Info.input_components = 3;
+    Info.in_color_space   = JCS_YCbCr;
+
+    // Now initialize all the internal stuff to defaults
+    jpeg_set_defaults(&Info);
+
+    // Take the planes as they are, with chroma at half resolution both ways
+    Info.raw_data_in = TRUE;
+    Info.comp_info[0].h_samp_factor = Info.comp_info[0].v_samp_factor = 2;
+    Info.comp_info[1].h_samp_factor = Info.comp_info[1].v_samp_factor = 1;
+    Info.comp_info[2].h_samp_factor = Info.comp_info[2].v_samp_factor = 1;
+#if JPEG_LIB_VERSION >= 70
+    Info.do_fancy_downsampling = FALSE;
+#endif
+
+    // It's definitely called fastest for a reason... May want to disable this, though, for quality's sake
+    Info.dct_method = JDCT_FASTEST;
+
+    // Set quality and get to compressin'
+    jpeg_set_quality(&Info, pWorker->pWriter->Quality, 1);
+    jpeg_start_compress(&Info, 1);
+
+    // Write the EXIF data (if any)
+    WriteExifData(&Info, pInfo->Lla, pInfo->TimeStamp);
+
+    // Hand over one row of MCUs at a time, repeating the last row of the image to fill out the last one
+    for (Row = 0; Row < Height; Row += STRIP_ROWS)
+    {
+        if (Direct)
+        {
+            for (i = 0; i < STRIP_ROWS; i++)
+                pRowsY[i] = (JSAMPROW)(pPlanes->pY + (ptrdiff_t)pPlanes->StrideY * ((Row + i < Height) ? Row + i : Height - 1));
+
+            for (i = 0; i < STRIP_ROWS / 2; i++)
+            {
+                int ChromaRow = (Row / 2 + i < ChromaHeight) ? Row / 2 + i : ChromaHeight - 1;
+
+                pRowsU[i] = (JSAMPROW)(pPlanes->pU + (ptrdiff_t)pPlanes->StrideUV * ChromaRow);
+                pRowsV[i] = (JSAMPROW)(pPlanes->pV + (ptrdiff_t)pPlanes->StrideUV * ChromaRow);
+            }
+        }
+        else
+            FillStrip(pWorker, pPlanes, Row, PadY, PadUV, pRows);
+
+        jpeg_write_raw_data(&Info, pRows, STRIP_ROWS);
+    }
+
+    // Finish up the compressor
+    jpeg_finish_compress(&Info);
+    jpeg_destroy_compress(&Info);
+
+#ifdef SNAPSHOT_MEM_DEST
+    // If libjpeg had to swap in a bigger buffer, that one's ours to keep and the old one is ours to free
+    if (pOut != pWorker->pJpeg)
+    {
+        free(pWorker->pJpeg);
+        pWorker->pJpeg = pOut;
+        pWorker->JpegBytes = OutBytes;
+    }
+
+    // Now write the whole file in one go
+    if ((pFile = fopen(pInfo->Path, "wb")) == NULL)
+        return 0;
+
+    Result = (fwrite(pOut, 1, OutBytes, pFile) == OutBytes);
+#endif // SNAPSHOT_MEM_DEST
+
+    // Finally, close the file
+    if (fclose(pFile) != 0)
+        Result = 0;
+
+    return Result;
+
+}// EncodeYuv
+
+static void FillStrip(SnapshotWorker_t *pWorker, const SnapshotPlanes_t *pPlanes, int Row, int PadY, int PadUV, JSAMPIMAGE pRows)
+{
+    const SnapshotWriter_t *pWriter = pWorker->pWriter;
+    const uint8_t *pMapY = pPlanes->FullRange ? pWriter->Identity : pWriter->RangeY;
+    const uint8_t *pMapUV = pPlanes->FullRange ? pWriter->Identity : pWriter->RangeUV;
+    int Width = pPlanes->Width, ChromaWidth = (Width + 1) / 2, ChromaHeight = (pPlanes->Height + 1) / 2;
+    int Step = pPlanes->Interleaved ? 2 : 1;
+    uint8_t *pStrip = pWorker->pStrip;
+    int i, x;
+
+    // Luma rows, repeating the last row and column out to the padding
+    for (i = 0; i < STRIP_ROWS; i++)
+    {
+        int SourceRow = (Row + i < pPlanes->Height) ? Row + i : pPlanes->Height - 1;
+        const uint8_t *pSource = pPlanes->pY + (ptrdiff_t)pPlanes->StrideY * SourceRow;
+        uint8_t *pDest = pStrip + (size_t)PadY * i;
+
+        for (x = 0; x < Width; x++)
+            pDest[x] = pMapY[pSource[x]];
+
+        for (; x < PadY; x++)
+            pDest[x] = pDest[Width - 1];
+
+        pRows[0][i] = pDest;
+    }
+
+    pStrip += (size_t)PadY * STRIP_ROWS;
+
+    // Then the chroma rows, pulling U and V apart if they're interleaved
+    for (i = 0; i < STRIP_ROWS / 2; i++)
+    {
+        int SourceRow = (Row / 2 + i < ChromaHeight) ? Row / 2 + i : ChromaHeight - 1;
+        const uint8_t *pSourceU = pPlanes->pU + (ptrdiff_t)pPlanes->StrideUV * SourceRow;
+        const uint8_t *pSourceV = pPlanes->pV + (ptrdiff_t)pPlanes->StrideUV * SourceRow;
+        uint8_t *pDestU = pStrip + (size_t)PadUV * i;
+        uint8_t *pDestV = pStrip + (size_t)PadUV * (i + STRIP_ROWS / 2);
+
+        for (x = 0; x < ChromaWidth; x++)
+        {
+            pDestU[x] = pMapUV[pSourceU[x * Step]];
+            pDestV[x] = pMapUV[pSourceV[x * Step]];
+        }
+
+        for (; x < PadUV; x++)
+        {
+            pDestU[x] = pDestU[ChromaWidth - 1];
+            pDestV[x] = pDestV[ChromaWidth - 1];
+        }
+
+        pRows[1][i] = pDestU;
+        pRows[2][i] = pDestV;
+    }
+
+}// FillStrip
+
+static int GrowBuffer(uint8_t **ppBuffer, size_t *pBytes, size_t Bytes)
+{
+    uint8_t *pBuffer;
+
+    // Buffers only ever grow, so after the first few snapshots this never allocates
+    if (*pBytes >= Bytes)
+        return 1;
+
+    if ((pBuffer = (uint8_t *)realloc(*ppBuffer, Bytes)) == NULL)
+        return 0;
+
+    *ppBuffer = pBuffer;
+    *pBytes = Bytes;
+    return 1;
+
+}// GrowBuffer
+
+int SnapshotSaveRgb(const uint8_t *pRgb, int Width, int Height, int Stride, const double Lla[NLLA], uint64_t TimeStamp, const char *pPath, int Quality)
+{
+    struct jpeg_compress_struct Info;
+    struct jpeg_error_mgr Error;
+    FILE *pFile;
+
+    // If we can't open the file we're trying to write to, don't bother
+    if ((pFile = fopen(pPath, "wb")) == NULL)
+        return 0;
+
+    // Not sure why this has to happen first...
+    Info.err = jpeg_std_error(&Error);
+
+    // Initialize the compressor subsystem
+    jpeg_create_compress(&Info);
+    jpeg_stdio_dest(&Info, pFile);
+
+    // Populate some information regarding the image format
+    Info.image_width      = Width;
+    Info.image_height     = Height;
+    Info.input_components = 3;
+    Info.in_color_space   = JCS_RGB;
+
+    // Now initialize all the internal stuff to defaults
+    jpeg_set_defaults(&Info);
+    Info.dct_method = JDCT_FASTEST;
+
+    // Set quality and get to compressin'
+    jpeg_set_quality(&Info, Quality, 1);
+    jpeg_start_compress(&Info, 1);
+
+    // Write the EXIF data (if any)
+    WriteExifData(&Info, Lla, TimeStamp);
+
+    // Write the image a scanline at a time, straight out of the caller's buffer
+    while (Info.next_scanline < Info.image_height)
+    {
+        JSAMPROW pRow = (JSAMPROW)(pRgb + (size_t)Stride * Info.next_scanline);
+        jpeg_write_scanlines(&Info, &pRow, 1);
+    }
+
+    // Finally, finish and close the file
+    jpeg_finish_compress(&Info);
+    jpeg_destroy_compress(&Info);
+    return fclose(pFile) == 0;
+
+}// SnapshotSaveRgb
+
+static const char *LatLonToString(char *pBuffer, double Radians, char SuffixPos, char SuffixNeg)
+{
+    // Convert from lat/lon to unsigned degrees
+    double Degrees = fabs(degrees(Radians));
+
+    // Split into integer and fractional parts
+    double Integer = (int)Degrees, Fraction = Degrees - Integer;
+
+    // Finally, format the data as per the XMP spec
+    sprintf(pBuffer, "%.0lf,%.6lf%c", Integer, Fraction * 60.0, (Radians < 0) ? SuffixNeg : SuffixPos);
+
+    // Now return a pointer to the buffer that the user passed in
+    return pBuffer;
+
+}// LatLonToString
+
+static void WriteExifData(struct jpeg_compress_struct *pInfo, const double Lla[NLLA], uint64_t TimeStamp)
+{
+    // Convert from UNIX microseconds to GPS milliseconds
+    uint64_t GpsTime = TimeStamp / 1000 + (LEAP_SECONDS * 1000) - 315964800000ULL;
+    uint32_t Week = GpsTime / 604800000ULL, Itow = GpsTime - Week * 604800000ULL;
+    uint8_t Month, Day, Hour, Minute, Second;
+    uint16_t Year;
+
+    // Now get date and time from the reconstructed GPS time
+    computeDateAndTimeFromWeekAndItow(Week, Itow, LEAP_SECONDS, &Year, &Month, &Day, &Hour, &Minute, &Second);
+
+    // Check for valid GPS time
+    if (Year > 2012)
+    {
+        char Exif[4096], Buffer[64];
+        int i = 0;
+
+        // XML header garbage
+        i += sprintf(&Exif[i], "http://ns.adobe.com/xap/1.0/");
+        Exif[i++] = 0;
+        i += sprintf(&Exif[i], "<?xpacket begin='\xef\xbb\xbf' id='W5M0MpCehiHzreSzNTczkc9d'?>\n");
+        i += sprintf(&Exif[i], "<x:xmpmeta xmlns:x='adobe:ns:meta/' x:xmptk='XMP Core 5.4.0'>\n");
+        i += sprintf(&Exif[i], "<rdf:RDF xmlns:rdf='http://www.w3.org/1999/02/22-rdf-syntax-ns#'>\n\n");
+        i += sprintf(&Exif[i], " <rdf:Description rdf:about='' xmlns:exif='http://ns.adobe.com/exif/1.0/'>\n");
+
+        // GPS LLA camera position
+        i += sprintf(&Exif[i], "  <exif:GPSLatitude>%s</exif:GPSLatitude>\n", LatLonToString(Buffer, Lla[LAT], 'N', 'S'));
+        i += sprintf(&Exif[i], "  <exif:GPSLongitude>%s</exif:GPSLongitude>\n", LatLonToString(Buffer, Lla[LON], 'E', 'W'));
+        i += sprintf(&Exif[i], "  <exif:GPSAltitude>%.1lf</exif:GPSAltitude>\n", Lla[ALT]);
+
+        // GPS date/time
+        i += sprintf(&Exif[i],"  <exif:GPSTimeStamp>%u:%02u:%02u %02u:%02u:%02u</exif:GPSTimeStamp>\n", Year, Month, Day, Hour, Minute, Second);
+
+        // XML footer garbage
+        i += sprintf(&Exif[i], " </rdf:Description>\n");
+        i += sprintf(&Exif[i], "</rdf:RDF>\n");
+        i += sprintf(&Exif[i], "</x:xmpmeta>\n");
+
+        // Now write the data to the JPEG file
+        jpeg_write_marker(pInfo, 0xe1, (const uint8_t *)Exif, i);
+    }
+
+}// WriteExifData
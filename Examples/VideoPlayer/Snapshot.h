@@ -0,0 +1,68 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "earthposition.h"
+
+#include <stdint.h>
+
+struct AVFrame;
+
+// Background JPEG snapshot writer. Frames are queued by reference straight from the decoder and
+//   compressed on worker threads from their own YUV planes through libjpeg's raw data interface,
+//   so there's no RGB conversion and no copy of the image on the caller's thread. Full range
+//   4:2:0 frames are compressed in place; limited range and NV12 frames, which is what most
+//   decoders and hardware downloads produce, are range-mapped a strip of 16 rows at a time.
+//
+// Each worker keeps its strip, conversion and JPEG output buffers from one snapshot to the next,
+//   growing them to fit whatever frame size comes along, and the frames wait in a fixed pool of
+//   slots, so bursts at full frame rate don't allocate anything. If every slot is busy the
+//   snapshot is dropped and counted rather than waited for.
+typedef struct SnapshotWriter SnapshotWriter_t;
+
+// What to write along with a frame
+typedef struct
+{
+    // Camera position in radians and meters MSL, and UNIX time in microseconds, for the EXIF block
+    double Lla[NLLA];
+    uint64_t TimeStamp;
+
+    // File to save to
+    char Path[64];
+
+    // Anything the caller wants back in the callback
+    void *pUser;
+
+} SnapshotInfo_t;
+
+// Called on a worker thread once a snapshot has been saved, or has failed to save. pFrame is the
+//   frame in system memory, or NULL if it couldn't be downloaded, and is only valid during the call.
+typedef void (*SnapshotCallback_t)(const SnapshotInfo_t *pInfo, const struct AVFrame *pFrame, int Saved);
+
+typedef struct
+{
+    // Snapshots queued, and dropped because every slot was busy
+    uint32_t Queued;
+    uint32_t Dropped;
+
+    // Snapshots written to disk, and ones that couldn't be downloaded, compressed or written
+    uint32_t Saved;
+    uint32_t Failed;
+
+} SnapshotStats_t;
+
+// Open a writer with the given number of worker threads and slots, which close down once
+//   everything queued has been saved
+SnapshotWriter_t *SnapshotWriterOpen(int Threads, int Slots, int Quality, SnapshotCallback_t pCallback);
+void SnapshotWriterClose(SnapshotWriter_t *pWriter);
+
+// Queue a frame from StreamRefVideoFrame, taking over its reference if this succeeds. Only one
+//   thread may queue snapshots.
+int SnapshotWriterQueue(SnapshotWriter_t *pWriter, struct AVFrame *pFrame, const SnapshotInfo_t *pInfo);
+
+// Counters, which are only a snapshot while the workers are running
+void SnapshotWriterGetStats(const SnapshotWriter_t *pWriter, SnapshotStats_t *pStats);
+
+// Compress and save an RGB24 image with the same EXIF block, on the caller's thread
+int SnapshotSaveRgb(const uint8_t *pRgb, int Width, int Height, int Stride, const double Lla[NLLA], uint64_t TimeStamp, const char *pPath, int Quality);
+
+#endif // SNAPSHOT_H
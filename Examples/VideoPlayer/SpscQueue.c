@@ -0,0 +1,66 @@
+#include "SpscQueue.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+int SpscQueueInit(SpscQueue_t *pQueue, uint32_t Capacity)
+{
+    // Start out empty, the ring checks that the capacity is a power of two
+    memset(pQueue, 0, sizeof(SpscQueue_t));
+    if (!spscRingInit(&pQueue->Ring, Capacity))
+        return 0;
+
+    // Allocate the slots
+    if ((pQueue->pSlots = (void **)calloc(Capacity, sizeof(void *))) == NULL)
+        return 0;
+
+    return 1;
+
+}// SpscQueueInit
+
+void SpscQueueFree(SpscQueue_t *pQueue)
+{
+    // Items still in the queue belong to the caller, who should have drained it first
+    free(pQueue->pSlots);
+    memset(pQueue, 0, sizeof(SpscQueue_t));
+
+}// SpscQueueFree
+
+int SpscQueuePush(SpscQueue_t *pQueue, void *pItem)
+{
+    uint32_t Head;
+
+    // If the consumer hasn't kept up, the ring counts the drop and the caller deals with the item
+    if (!spscRingReserve(&pQueue->Ring, &Head))
+        return 0;
+
+    // Fill the slot, then publish it
+    pQueue->pSlots[Head & pQueue->Ring.Mask] = pItem;
+    spscRingCommit(&pQueue->Ring);
+
+    return 1;
+
+}// SpscQueuePush
+
+void *SpscQueuePop(SpscQueue_t *pQueue)
+{
+    uint32_t Tail = pQueue->Ring.Tail;
+    void *pItem;
+
+    // Nothing to do if the producer hasn't published anything new
+    if (Tail == spscRingHead(&pQueue->Ring))
+        return NULL;
+
+    // Empty the slot, then hand it back to the producer
+    pItem = pQueue->pSlots[Tail & pQueue->Ring.Mask];
+    spscRingRelease(&pQueue->Ring, Tail + 1);
+
+    return pItem;
+
+}// SpscQueuePop
+
+uint32_t SpscQueueDepth(const SpscQueue_t *pQueue)
+{
+    return spscRingDepth(&pQueue->Ring);
+
+}// SpscQueueDepth
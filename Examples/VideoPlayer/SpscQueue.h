@@ -0,0 +1,34 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include "SpscRing.h"
+
+// Bounded lock-free queue of pointers between exactly one producer thread and one consumer
+//   thread, on the same ring (SpscRing.h) that the telemetry history uses. Neither side ever
+//   waits on the other: a push onto a full queue fails and is counted, which is how the pipeline
+//   stages report backpressure instead of stalling whoever feeds them.
+
+typedef struct
+{
+    // Slot storage, the capacity is a power of two
+    void **pSlots;
+
+    // Indices, along with the pushes that failed because the queue was full and the deepest the
+    //   queue has been
+    SpscRing_t Ring;
+
+} SpscQueue_t;
+
+int SpscQueueInit(SpscQueue_t *pQueue, uint32_t Capacity);
+void SpscQueueFree(SpscQueue_t *pQueue);
+
+// Producer side
+int SpscQueuePush(SpscQueue_t *pQueue, void *pItem);
+
+// Consumer side, returns NULL if the queue is empty
+void *SpscQueuePop(SpscQueue_t *pQueue);
+
+// Number of items waiting, which is only a snapshot if called from a third thread
+uint32_t SpscQueueDepth(const SpscQueue_t *pQueue);
+
+#endif // SPSCQUEUE_H
@@ -1,363 +1,1268 @@
 #include "StreamDecoder.h"
 #include "Constants.h"
 #include "FFmpeg.h"
+#include "SpscQueue.h"
+#include "KlvStream.h"
+#include "RecordIndex.h"
+#include "libavutil/time.h"
 
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
-static AVFormatContext *pInputContext = NULL;
-static AVFormatContext *pOutputContext = NULL;
-static AVCodecContext *pCodecContext = NULL;
-static AVFrame *pFrame = NULL;
-static AVFrame *pFrameCopy = NULL;
-static AVPacket Packet;
+// The pipeline threads hand packets between stages by reference, so they need packet refcounting,
+//   and they use GCC/Clang atomics to signal the end of the stream
+#if defined(FFMPEG_HAS_PACKET_REFS) && defined(__GNUC__)
+#define STREAM_THREADS 1
+#include <pthread.h>
+#include <unistd.h>
+#endif // FFMPEG_HAS_PACKET_REFS && __GNUC__
+
+// Depths of the queues between pipeline stages. Packets are small and shared by reference, so
+//   the packet queues can ride out several seconds of a slow disk; decoded frames are big, so
+//   only a few are kept waiting for the caller.
+#define DECODE_QUEUE_SIZE   256
+#define KLV_QUEUE_SIZE      64
+#define RECORD_QUEUE_SIZE   1024
+#define FRAME_QUEUE_SIZE    8
+#define METADATA_QUEUE_SIZE 16
+#define CLOCK_QUEUE_SIZE    16
+
+// Biggest step forward between video packets that a recording takes as continuous, any bigger
+//   step or any step back is a timestamp reset that the recorded clock gets carried across
+#define RECORD_JUMP_US 10000000LL
+
+// Idle time for a pipeline stage that has nothing to do, in microseconds
+#define STAGE_IDLE_US 1000
+
+// Set by the reader on the keyframe that follows video packets it had to throw away, and cleared
+//   by whichever stage takes the packet, since it means nothing to FFmpeg
+#define PKT_FLAG_DISCONTINUITY 0x40000000
+
+// A complete KLV packet on its way from the KLV stage to the caller
+typedef struct
+{
+    int64_t Time;
+    int Bytes;
+    uint8_t Data[1];
+
+} StreamKlv_t;
+
+#ifdef STREAM_THREADS
+// The reader's view of the video going to one stage: set once a video packet for it had to be
+//   dropped, until the next keyframe gets through, and the video packets skipped in the meantime
+typedef struct
+{
+    int Gap;
+    volatile uint32_t Skipped;
+
+} StreamGap_t;
+#endif // STREAM_THREADS
+
+struct StreamDecoder
+{
+    // Demuxer, decoder and remuxer contexts
+    AVFormatContext *pInputContext;
+    AVFormatContext *pOutputContext;
+    AVCodecContext *pCodecContext;
+
+    // Decoder output frame and the latest frame handed to the user
+    AVFrame *pFrame;
+    AVFrame *pFrameCopy;
+    AVPacket Packet;
+
+    // Hardware frames are downloaded here before colorspace conversion
+    AVFrame *pSwFrame;
+
+    // Colorspace converter, kept as long as the frame size and format don't change
+    struct SwsContext *pSwsContext;
+
+    // Hardware device the decoder runs on and its surface format, or NULL and AV_PIX_FMT_NONE
+    AVBufferRef *pHwDevice;
+    enum AVPixelFormat HwFormat;
+
+    // Incremental KLV parser, which reassembles and checks local sets as their fragments arrive
+    KlvStream_t KlvStream;
+
+    // Last local set to come out of the parser, and the time of the packet it started in
+    uint8_t *pMetaData;
+    uint64_t MetaDataBufferSize;
+    uint64_t MetaDataBytes;
+    int64_t MetaDataStart;
+
+    // Times of the packet being parsed and of the packet the next local set started in,
+    //   and whether a set was finished by the packet being parsed
+    int64_t MetaDataPacketTime;
+    int64_t MetaDataPending;
+    int MetaDataComplete;
+
+    // Latest complete KLV data handed to the user
+    const uint8_t *pKlv;
+    int KlvBytes;
+
+    // Presentation times of the last frame and KLV packet in microseconds
+    int64_t MetaDataTime;
+    int64_t VideoTime;
+
+    // Stream indices for video and metadata, and their time bases
+    int VideoStream;
+    int DataStream;
+    AVRational VideoTimeBase;
+    AVRational DataTimeBase;
+
+    // Recording path, whether it's split into numbered segments and where to split them
+    char RecordPath[256];
+    int Numbered;
+    int64_t SegmentUs;
+    uint64_t SegmentBytes;
+
+    // Set if the recording opened, and once it has a keyframe to start from
+    int Recording;
+    int RecordStarted;
+
+    // Segment being written, when it started on the recorded clock, and the index
+    int Segment;
+    int64_t SegmentStartUs;
+    RecordIndexWriter_t RecordIndex;
+
+    // Offset from the input's clock to the recorded clock that keeps the recording continuous,
+    //   along with the last recorded video time and the usual step between video packets
+    int64_t RecordOffsetUs;
+    int64_t LastRecordUs;
+    int64_t RecordStepUs;
+
+    // Clock records on their way from StreamSetRecordClock to the recorder
+    SpscQueue_t ClockQueue;
+
+#ifdef STREAM_THREADS
+    // Pipeline stages: the reader feeds the decoder, KLV and recorder stages, and the
+    //   decoder and KLV stages feed the caller
+    pthread_t Reader, Decoder, KlvParser, Recorder;
+    SpscQueue_t DecodeQueue, KlvQueue, RecordQueue;
+    SpscQueue_t FrameQueue, MetaDataQueue;
+
+    // Where the decoder and recorder have a hole in their video, see QueuePacket
+    StreamGap_t DecodeGap, RecordGap;
+
+    // KLV packet that pKlv currently points into
+    StreamKlv_t *pKlvPacket;
+
+    // Set once the stage threads are running
+    int Threaded;
+
+    // Stop tells the reader to quit, and the reader sets Done once it has
+    volatile int Stop;
+    int Done;
+#endif // STREAM_THREADS
+};
+
+static AVCodec *OpenHwDecoder(StreamDecoder_t *pStream, AVCodec *pCodec);
+static int DecodeVideo(StreamDecoder_t *pStream, AVPacket *pPacket);
+static void PublishFrame(StreamDecoder_t *pStream, AVFrame *pFrame);
+static int ReassembleKlv(StreamDecoder_t *pStream, const AVPacket *pPacket);
+static void KlvSetDone(void *pUser, const uint8_t *pSet, uint32_t Length, KlvSetStatus_t Status);
+static StreamDecoder_t *OpenStream(const char *pUrl, const StreamRecordOptions_t *pRecord, int64_t SeekOffset, int Flags);
+static AVFormatContext *OpenSegment(StreamDecoder_t *pStream, int Segment, AVFormatContext *pSource);
+static void CloseSegment(AVFormatContext *pContext);
+static void WriteSegmentRecord(StreamDecoder_t *pStream, uint64_t HostUs);
+static void RecordKeyframe(StreamDecoder_t *pStream, uint64_t ArrivalUs);
+static void RecordPacket(StreamDecoder_t *pStream, AVPacket *pPacket);
+
+#ifdef STREAM_THREADS
+static int StartPipeline(StreamDecoder_t *pStream);
+static void StopPipeline(StreamDecoder_t *pStream);
+static int InterruptRead(void *pArg);
+static void *ReaderThread(void *pArg);
+static void *DecoderThread(void *pArg);
+static void *KlvThread(void *pArg);
+static void *RecorderThread(void *pArg);
+#endif // STREAM_THREADS
+
+#ifdef FFMPEG_HAS_HWACCEL
+static enum AVPixelFormat GetHwFormat(AVCodecContext *pContext, const enum AVPixelFormat *pFormats);
+#endif // FFMPEG_HAS_HWACCEL
+
+StreamDecoder_t *StreamOpen(const char *pUrl, const char *pRecordPath)
+{
+    // Use a hardware decoder whenever one's available
+    return StreamOpenEx(pUrl, pRecordPath, 0);
+
+}// StreamOpen
+
+StreamDecoder_t *StreamOpenEx(const char *pUrl, const char *pRecordPath, int Flags)
+{
+    StreamRecordOptions_t Record = { pRecordPath, 0, 0 };
+
+    // Record everything to the one file
+    return StreamOpenRecord(pUrl, pRecordPath ? &Record : NULL, Flags);
+
+}// StreamOpenEx
+
+StreamDecoder_t *StreamOpenRecord(const char *pUrl, const StreamRecordOptions_t *pRecord, int Flags)
+{
+    // Play from wherever the stream happens to be
+    return OpenStream(pUrl, pRecord, -1, Flags);
+
+}// StreamOpenRecord
+
+StreamDecoder_t *StreamOpenIndexed(const char *pRecordPath, int Clock, int64_t Time, uint64_t *pHostUs, int Flags)
+{
+    StreamDecoder_t *pStream = NULL;
+    RecordIndexEntry_t Keyframe;
+    RecordIndex_t Index;
+    char *pUrl = NULL;
+    int Segments = 0, Length, i;
 
-static uint8_t *pMetaData = NULL;
-static uint64_t MetaDataBufferSize = 0;
-static uint64_t MetaDataSize = 0;
-static uint64_t MetaDataBytes = 0;
+    // Look up the keyframe to start from
+    if (!RecordIndexOpen(&Index, pRecordPath))
+        return NULL;
 
-static int VideoStream = 0;
-static int DataStream = 0;
+    if (RecordIndexFind(&Index, Clock, Time, &Keyframe))
+    {
+        // Every segment from the keyframe's onwards gets played, so there's no gap at the next boundary
+        Segments = (Index.NumSegments > Keyframe.Segment) ? Index.NumSegments - Keyframe.Segment : 1;
+        pUrl = (char *)malloc(Segments * (sizeof(Index.Path) + 16) + 8);
+    }
+
+    if (pUrl != NULL)
+    {
+        // Join the segments up with the concat protocol, the keyframe's offset is into the first one
+        Length = sprintf(pUrl, "%s", (Segments > 1) ? "concat:" : "");
+        for (i = 0; i < Segments; i++)
+        {
+            if (i > 0)
+                pUrl[Length++] = '|';
+
+            RecordSegmentPath(Index.Path, Keyframe.Segment + i, Index.Numbered, &pUrl[Length], sizeof(Index.Path) + 16);
+            Length += strlen(&pUrl[Length]);
+        }
+
+        // Open it up at the keyframe, and tell the caller when that keyframe arrived
+        if (((pStream = OpenStream(pUrl, NULL, Keyframe.Offset, Flags)) != NULL) && pHostUs)
+            *pHostUs = Keyframe.TimeUs;
+
+        free(pUrl);
+    }
 
-int StreamOpen(const char *pUrl, const char *pRecordPath)
+    RecordIndexClose(&Index);
+    return pStream;
+
+}// StreamOpenIndexed
+
+static StreamDecoder_t *OpenStream(const char *pUrl, const StreamRecordOptions_t *pRecord, int64_t SeekOffset, int Flags)
 {
+    StreamDecoder_t *pStream;
     AVCodec *pCodec;
 
-    // FFmpeg startup stuff
+    // Allocate a zeroed decoder instance, all of the stream state lives in here
+    if ((pStream = (StreamDecoder_t *)calloc(1, sizeof(StreamDecoder_t))) == NULL)
+        return NULL;
+
+    // No hardware has been set up yet
+    pStream->HwFormat = AV_PIX_FMT_NONE;
+
+    // Set up the KLV parser, which we only need whole local sets from
+    KlvStreamInit(&pStream->KlvStream, NULL, KlvSetDone, pStream);
+
+    // FFmpeg startup stuff, which is safe to repeat for each stream
     avcodec_register_all();
     av_register_all();
     avformat_network_init();
     av_log_set_level(AV_LOG_QUIET);
 
     // Allocate a new format context
-    pInputContext = avformat_alloc_context();
+    pStream->pInputContext = avformat_alloc_context();
+
+#ifdef STREAM_THREADS
+    // Let StreamClose break the reader thread out of a blocking read
+    pStream->pInputContext->interrupt_callback.callback = InterruptRead;
+    pStream->pInputContext->interrupt_callback.opaque = pStream;
+#endif // STREAM_THREADS
 
     // Have avformat_open_input timeout after 5s
     AVDictionary *pOptions = 0;
     av_dict_set(&pOptions, "timeout", "5000000", 0);
 
     // If the stream doesn't open
-    if (avformat_open_input(&pInputContext, pUrl, NULL, &pOptions) < 0)
+    if (avformat_open_input(&pStream->pInputContext, pUrl, NULL, &pOptions) < 0)
     {
         // Clean up the allocated resources (if any...) and exit with a failure code
-        StreamClose();
-        return 0;
+        StreamClose(pStream);
+        return NULL;
     }
 
     // If there don't appear to be an valid streams in the transport stream
-    if (pInputContext->nb_streams == 0)
+    if (pStream->pInputContext->nb_streams == 0)
     {
         // Clean up the allocated resources (if any...) and exit with a failure code
-        StreamClose();
-        return 0;
+        StreamClose(pStream);
+        return NULL;
     }
 
     // Get the stream indices for video and metadata
-    VideoStream = av_find_best_stream(pInputContext, AVMEDIA_TYPE_VIDEO, -1, -1, NULL, 0);
-    DataStream  = av_find_best_stream(pInputContext, AVMEDIA_TYPE_DATA,  -1, -1, NULL, 0);
+    pStream->VideoStream = av_find_best_stream(pStream->pInputContext, AVMEDIA_TYPE_VIDEO, -1, -1, NULL, 0);
+    pStream->DataStream  = av_find_best_stream(pStream->pInputContext, AVMEDIA_TYPE_DATA,  -1, -1, NULL, 0);
+
+    // Keep the time bases around, so presentation times can be converted without touching the demuxer
+    pStream->VideoTimeBase = pStream->pInputContext->streams[pStream->VideoStream]->time_base;
+    if (pStream->DataStream >= 0)
+        pStream->DataTimeBase = pStream->pInputContext->streams[pStream->DataStream]->time_base;
+
+    // Jump to where the caller wants to start playing from, before anything's been read
+    if (SeekOffset >= 0)
+        av_seek_frame(pStream->pInputContext, -1, SeekOffset, AVSEEK_FLAG_BYTE);
 
     // Set the format context to playing
-    av_read_play(pInputContext);
+    av_read_play(pStream->pInputContext);
+
+    // Get a codec pointer based on the video stream's codec ID
+    pCodec = avcodec_find_decoder(pStream->pInputContext->streams[pStream->VideoStream]->codec->codec_id);
 
-    // Get a codec pointer based on the video stream's codec ID and allocate a context
-    pCodec = avcodec_find_decoder(pInputContext->streams[VideoStream]->codec->codec_id);
-    pCodecContext = avcodec_alloc_context3(pCodec);
+    // Look for a hardware decoder unless the caller asked us not to
+    if ((Flags & STREAM_OPEN_NO_HWACCEL) == 0)
+        pCodec = OpenHwDecoder(pStream, pCodec);
 
-    // Open the newly allocated codec context
-    avcodec_open2(pCodecContext, pCodec, NULL);
+    // Allocate a context if the hardware setup didn't already
+    if (pStream->pCodecContext == NULL)
+        pStream->pCodecContext = avcodec_alloc_context3(pCodec);
 
-    // If the user passed in a record path
-    if (pRecordPath && strlen(pRecordPath))
+    // Open the newly allocated codec context, falling back to software if the hardware decoder won't open
+    if (avcodec_open2(pStream->pCodecContext, pCodec, NULL) < 0)
     {
-        int i;
+        avcodec_free_context(&pStream->pCodecContext);
+        av_buffer_unref(&pStream->pHwDevice);
+        pStream->HwFormat = AV_PIX_FMT_NONE;
 
+        pCodec = avcodec_find_decoder(pStream->pInputContext->streams[pStream->VideoStream]->codec->codec_id);
+        pStream->pCodecContext = avcodec_alloc_context3(pCodec);
+        avcodec_open2(pStream->pCodecContext, pCodec, NULL);
+    }
+
+    // If the user passed in a record path that fits
+    if (pRecord && pRecord->pPath && strlen(pRecord->pPath) && (strlen(pRecord->pPath) < sizeof(pStream->RecordPath)))
+    {
         // Pull any additional stream information out of the file
         //   NOTE: Older FFmpeg/libav builds may hang indefinitely here!
-        avformat_find_stream_info(pInputContext, NULL);
+        avformat_find_stream_info(pStream->pInputContext, NULL);
+
+        // Segment files are only numbered if the recording gets split up
+        strcpy(pStream->RecordPath, pRecord->pPath);
+        pStream->Numbered = (pRecord->SegmentSeconds > 0) || (pRecord->SegmentBytes > 0);
+        pStream->SegmentUs = (int64_t)pRecord->SegmentSeconds * 1000000;
+        pStream->SegmentBytes = pRecord->SegmentBytes;
+
+        // Open the first segment and the index, and mark where the segment starts
+        if (((pStream->pOutputContext = OpenSegment(pStream, 0, pStream->pInputContext)) != NULL) &&
+            RecordIndexCreate(&pStream->RecordIndex, pStream->RecordPath, av_gettime()) &&
+            SpscQueueInit(&pStream->ClockQueue, CLOCK_QUEUE_SIZE))
+        {
+            WriteSegmentRecord(pStream, av_gettime());
+            pStream->Recording = 1;
+        }
+    }
 
-        // Allocate a format context for the output file
-        avformat_alloc_output_context2(&pOutputContext, NULL, NULL, pRecordPath);
+    // Allocate the decode, output and hardware download frame structures
+    pStream->pFrame = av_frame_alloc();
+    pStream->pFrameCopy = av_frame_alloc();
+    pStream->pSwFrame = av_frame_alloc();
 
-        // For each stream in the UDP stream
-        for (i = 0; i < pInputContext->nb_streams; i++)
-        {
-            // Mirror this stream to the output format context
-            AVStream *pStream = avformat_new_stream(pOutputContext, pInputContext->streams[i]->codec->codec);
-            avcodec_copy_context(pStream->codec, pInputContext->streams[i]->codec);
+    // Finally, initialize the AVPacket structure
+    av_init_packet(&pStream->Packet);
+    pStream->Packet.data = NULL;
+    pStream->Packet.size = 0;
+
+#ifdef STREAM_THREADS
+    // Start up the pipeline threads, unless the caller wants everything done inline
+    if ((Flags & STREAM_OPEN_NO_THREADS) == 0)
+        StartPipeline(pStream);
+#endif // STREAM_THREADS
+
+    // Done - hand the new decoder back to the caller
+    return pStream;
+
+}// StreamOpenEx
+
+static AVCodec *OpenHwDecoder(StreamDecoder_t *pStream, AVCodec *pCodec)
+{
+#ifdef FFMPEG_HAS_HWACCEL
+    char Name[64];
+    int i;
+
+    // Try each hardware configuration the decoder supports (CUDA/NVDEC, VAAPI, ...) until a device opens
+    for (i = 0; pCodec != NULL; i++)
+    {
+        const AVCodecHWConfig *pConfig = avcodec_get_hw_config(pCodec, i);
+
+        // Out of configurations
+        if (pConfig == NULL)
+            break;
+
+        // We can only use configurations that decode onto a device we create
+        if ((pConfig->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) == 0)
+            continue;
 
-            // Add a stream header if the output format calls for it
-            if (pOutputContext->oformat->flags & AVFMT_GLOBALHEADER)
-                pStream->codec->flags |= CODEC_FLAG_GLOBAL_HEADER;
+        // If this device exists on this machine
+        if (av_hwdevice_ctx_create(&pStream->pHwDevice, pConfig->device_type, NULL, NULL, 0) >= 0)
+        {
+            // Set up a decoder context that hands frames out in the device's surface format
+            pStream->HwFormat = pConfig->pix_fmt;
+            pStream->pCodecContext = avcodec_alloc_context3(pCodec);
+            pStream->pCodecContext->hw_device_ctx = av_buffer_ref(pStream->pHwDevice);
+            pStream->pCodecContext->opaque = pStream;
+            pStream->pCodecContext->get_format = GetHwFormat;
+            return pCodec;
         }
+    }
 
-        // Open the record file and write the header out
-        avio_open(&pOutputContext->pb, pRecordPath, AVIO_FLAG_WRITE);
-        avformat_write_header(pOutputContext, NULL);
+    // Otherwise look for a V4L2 memory-to-memory decoder, which is how Jetson and most other SoCs
+    //   expose their video decoders. These output ordinary (or DRM PRIME) frames directly.
+    if (pCodec != NULL)
+    {
+        AVCodec *pM2M;
+
+        snprintf(Name, sizeof(Name), "%s_v4l2m2m", avcodec_get_name(pCodec->id));
+        if ((pM2M = avcodec_find_decoder_by_name(Name)) != NULL)
+            return pM2M;
     }
+#endif // FFMPEG_HAS_HWACCEL
 
-    // Allocate the decode and output frame structures
-    pFrame = av_frame_alloc();
-    pFrameCopy = av_frame_alloc();
+    // Stick with the software decoder
+    return pCodec;
 
-    // Finally, initialize the AVPacket structure
-    av_init_packet(&Packet);
-    Packet.data = NULL;
-    Packet.size = 0;
+}// OpenHwDecoder
 
-    // Done - return 1 to indicate success
-    return 1;
+#ifdef FFMPEG_HAS_HWACCEL
+static enum AVPixelFormat GetHwFormat(AVCodecContext *pContext, const enum AVPixelFormat *pFormats)
+{
+    const StreamDecoder_t *pStream = (const StreamDecoder_t *)pContext->opaque;
+    const enum AVPixelFormat *pFormat;
 
-}// StreamOpen
+    // Pick the hardware surface format if the decoder offers it
+    for (pFormat = pFormats; *pFormat != AV_PIX_FMT_NONE; pFormat++)
+    {
+        if (*pFormat == pStream->HwFormat)
+            return *pFormat;
+    }
 
-void StreamClose(void)
+    // Otherwise take the decoder's first choice, which is software
+    return pFormats[0];
+
+}// GetHwFormat
+#endif // FFMPEG_HAS_HWACCEL
+
+void StreamClose(StreamDecoder_t *pStream)
 {
-    // Free the AVFrames
-    av_frame_free(&pFrame);
-    av_frame_free(&pFrameCopy);
+    // Closing a stream that never opened is harmless
+    if (pStream == NULL)
+        return;
+
+#ifdef STREAM_THREADS
+    // Shut the pipeline down first, which flushes whatever the recorder still has queued
+    StopPipeline(pStream);
+#endif // STREAM_THREADS
+
+    // Free the AVFrames and the colorspace converter
+    av_frame_free(&pStream->pFrame);
+    av_frame_free(&pStream->pFrameCopy);
+    av_frame_free(&pStream->pSwFrame);
+    sws_freeContext(pStream->pSwsContext);
 
     // If we allocated a codec context
-    if (pCodecContext)
+    if (pStream->pCodecContext)
     {
         // Close it then free it
-        avcodec_close(pCodecContext);
-        av_free(pCodecContext);
+        avcodec_close(pStream->pCodecContext);
+        av_free(pStream->pCodecContext);
     }
 
     // If we allocated a format context
-    if (pInputContext)
+    if (pStream->pInputContext)
     {
         // Pause, close and free it
-        av_read_pause(pInputContext);
-        avformat_close_input(&pInputContext);
-        avformat_free_context(pInputContext);
+        av_read_pause(pStream->pInputContext);
+        avformat_close_input(&pStream->pInputContext);
+        avformat_free_context(pStream->pInputContext);
     }
 
-    // If there's an output context open
-    if (pOutputContext)
+    // If there's a segment open, finish it off along with the index
+    if (pStream->pOutputContext)
+        CloseSegment(pStream->pOutputContext);
+
+    RecordIndexFinish(&pStream->RecordIndex);
+
+    // Drop any clock records the recorder never got to
+    if (pStream->Recording)
     {
-        // Write a trailer to the file and close it out
-        av_write_trailer(pOutputContext);
-        avio_close(pOutputContext->pb);
-        avformat_free_context(pOutputContext);
+        while (SpscQueueDepth(&pStream->ClockQueue) != 0)
+            free(SpscQueuePop(&pStream->ClockQueue));
+        SpscQueueFree(&pStream->ClockQueue);
     }
 
-    // Nullify all the pointers we just messed with
-    pCodecContext  = NULL;
-    pFrame         = NULL;
-    pInputContext = NULL;
-    pOutputContext  = NULL;
+    // Let go of the hardware device, if there is one
+    av_buffer_unref(&pStream->pHwDevice);
+
+    // Free the KLV buffer and the instance itself
+    KlvStreamFree(&pStream->KlvStream);
+    free(pStream->pMetaData);
+    free(pStream);
 
 }// StreamClose
 
-int StreamProcess(void)
+int StreamProcess(StreamDecoder_t *pStream)
 {
-    // New video/metadata flags - note that NewMetaData == 1 if it's not in the TS
-    int NewVideo = 0, NewMetaData = (pInputContext->nb_streams < 2);
+#ifdef STREAM_THREADS
+    // If the pipeline is running, all the work has been done already and we just pick up the results
+    if (pStream->Threaded)
+    {
+        AVFrame *pFrame = (AVFrame *)SpscQueuePop(&pStream->FrameQueue);
+        StreamKlv_t *pKlv = (StreamKlv_t *)SpscQueuePop(&pStream->MetaDataQueue);
+        int Flags = 0;
+
+        // If the decoder has finished a frame, make it the current one
+        if (pFrame != NULL)
+        {
+            PublishFrame(pStream, pFrame);
+            av_frame_free(&pFrame);
+            Flags |= STREAM_NEW_VIDEO;
+        }
+
+        // If the KLV stage has finished a packet, swap it in for the last one
+        if (pKlv != NULL)
+        {
+            free(pStream->pKlvPacket);
+            pStream->pKlvPacket = pKlv;
+            pStream->pKlv = pKlv->Data;
+            pStream->KlvBytes = pKlv->Bytes;
+            pStream->MetaDataTime = pKlv->Time;
+            Flags |= STREAM_NEW_METADATA;
+        }
+
+        // Tell the caller what's new, if anything
+        return Flags;
+    }
+#endif // STREAM_THREADS
 
     // As long as we can keep reading packets from the UDP socket
-    while (av_read_frame(pInputContext, &Packet) >= 0)
+    while (av_read_frame(pStream->pInputContext, &pStream->Packet) >= 0)
     {
-        int Index = Packet.stream_index;
+        int Index = pStream->Packet.stream_index, NewVideo = 0, NewMetaData = 0;
 
-        // If this packet belongs to the video stream
-        if (Index == VideoStream)
+        // If this packet belongs to the video stream and finished a frame, make that frame the current one
+        if (Index == pStream->VideoStream)
         {
-            // Pass it to the h.264 decoder
-            avcodec_decode_video2(pCodecContext, pFrame, &NewVideo, &Packet);
-
-            // If this packet finished a video frame
-            if (NewVideo)
+            if ((NewVideo = DecodeVideo(pStream, &pStream->Packet)) != 0)
+                PublishFrame(pStream, pStream->pFrame);
+        }
+        // If this is the KLV stream data and it finished a KLV packet, point the user at it
+        else if (Index == pStream->DataStream)
+        {
+            if ((NewMetaData = ReassembleKlv(pStream, &pStream->Packet)) != 0)
             {
-                // If the incoming frame size doesn't match the output frame
-                if ((pFrame->width  != pFrameCopy->width) ||
-                    (pFrame->height != pFrameCopy->height))
-                {
-                    // Free the output frame and allocate a new one
-                    av_frame_free(&pFrameCopy);
-                    pFrameCopy = av_frame_alloc();
-
-                    // Copy all the metadata (width, height, etc.) over
-                    //   NOTE: av_frame_copy_props *should* do this but doesn't seem to...
-                    memcpy(pFrameCopy, pFrame, sizeof(AVFrame));
-
-                    // Now allocate a data buffer associated with this frame
-                    av_frame_get_buffer(pFrameCopy, 0);
-                }
-
-                // Copy the image data from the decoder frame to the output frame
-                av_frame_copy(pFrameCopy, pFrame);
-
-                // Finally, unref the frame and free the packet
-                av_frame_unref(pFrame);
+                pStream->pKlv = pStream->pMetaData;
+                pStream->KlvBytes = pStream->MetaDataBytes;
+                pStream->MetaDataTime = pStream->MetaDataStart;
             }
         }
-        // If this is the KLV stream data
-        else if (Index == DataStream)
+
+        // If we're recording, write the packet out along with the time it arrived
+        if (pStream->Recording)
         {
-            // If we have a full metadata packet in memory, zero out the size and index
-            if (MetaDataBytes == MetaDataSize)
-                MetaDataBytes = MetaDataSize = 0;
+            pStream->Packet.pos = av_gettime();
+            RecordPacket(pStream, &pStream->Packet);
+        }
 
-            // If we don't have any metadata buffered up yet and this packet is big enough for a US key and size
-            if ((MetaDataBytes == 0) && (Packet.size > 17))
-            {
-                // UAS LS universal key
-                static const uint8_t KlvHeader[16] = {
-                    0x06, 0x0E, 0x2B, 0x34, 0x02, 0x0B, 0x01, 0x01,
-                    0x0E, 0x01, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00
-                };
-
-                // Try finding the KLV header in this packet
-                const uint8_t *pStart = memmem(Packet.data, Packet.size, KlvHeader, 16);
-                const uint8_t *pSize = pStart + 16;
-
-                // If we found the header and the size tag is contained in this packet
-                if ((pStart != 0) && ((pSize - Packet.data) < Packet.size))
-                {
-                    // Initialize the header size to US key + 1 size byte and zero KLV tag bytes
-                    uint64_t KlvSize = 0, HeaderSize = 17;
-
-                    // If the size is a multi-byte BER-OID size
-                    if (pSize[0] & 0x80)
-                    {
-                        // Get the size of the size (up to )
-                        int Bytes = pSize[0] & 0x07, i;
-
-                        // If the entire size field is contained in this packet
-                        if (&pSize[Bytes] < &Packet.data[Packet.size])
-                        {
-                            // Build the size up from the individual bytes
-                            for (i = 0; i < Bytes; i++)
-                                KlvSize = (KlvSize << 8) | pSize[i + 1];
-                        }
-
-                        // Add the additional size bytes to the header size
-                        HeaderSize += Bytes;
-                    }
-                    // Otherwise, just read the size byte straight out of byte 16
-                    else
-                        KlvSize = pSize[0];
-
-                    // If we got a valid local set size
-                    if (KlvSize > 0)
-                    {
-                        // Compute the maximum bytes to copy out of the packet
-                        int MaxBytes = Packet.size - (pStart - Packet.data);
-                        int TotalSize = HeaderSize + KlvSize;
-                        int BytesToCopy = MIN(MaxBytes, TotalSize);
-
-                        // If our local buffer is too small for the incoming data
-                        if (MetaDataBufferSize < TotalSize)
-                        {
-                            // Reallocate enough space and store the new buffer size
-                            pMetaData = (uint8_t *)realloc(pMetaData, TotalSize);
-                            MetaDataBufferSize = TotalSize;
-                        }
-
-                        // Now copy the new data into the start of the local buffer
-                        memcpy(pMetaData, pStart, BytesToCopy);
-                        MetaDataSize = TotalSize;
-                        MetaDataBytes = BytesToCopy;
-                    }
-                }
-            }
-            // Otherwise, if we're mid-packet
-            else if (MetaDataBytes < MetaDataSize)
-            {
-                // Figure out the number of bytes to copy out of this particular packet
-                int BytesToCopy = MIN(Packet.size, MetaDataSize - MetaDataBytes);
+        // Free the packet data
+        av_free_packet(&pStream->Packet);
 
-                // Copy into the local buffer in the right spot and increment the index
-                memcpy(&pMetaData[MetaDataBytes], Packet.data, BytesToCopy);
-                MetaDataBytes += BytesToCopy;
-            }
+        // Return as soon as either a video frame or a KLV packet has been read in, so the
+        //   caller can pair them up by time rather than by arrival order
+        if (NewVideo || NewMetaData)
+            return (NewVideo ? STREAM_NEW_VIDEO : 0) | (NewMetaData ? STREAM_NEW_METADATA : 0);
+    }
+
+    // No new data if we made it here
+    return 0;
+
+}// StreamProcess
+
+static int DecodeVideo(StreamDecoder_t *pStream, AVPacket *pPacket)
+{
+    int NewVideo = 0;
+
+    // Pass the packet to the h.264 decoder, which tells us if it finished a frame in pFrame
+    avcodec_decode_video2(pStream->pCodecContext, pStream->pFrame, &NewVideo, pPacket);
+    return NewVideo;
+
+}// DecodeVideo
+
+static void PublishFrame(StreamDecoder_t *pStream, AVFrame *pFrame)
+{
+    // Convert the frame's presentation time to microseconds
+    pStream->VideoTime = av_rescale_q(pFrame->best_effort_timestamp, pStream->VideoTimeBase, AV_TIME_BASE_Q);
+
+#ifdef FFMPEG_HAS_FRAME_REFS
+    // Hand the decoded frame's buffers over to the output frame without copying them.
+    //   Anyone holding a reference from StreamRefVideoFrame keeps the old frame alive.
+    av_frame_unref(pStream->pFrameCopy);
+    av_frame_move_ref(pStream->pFrameCopy, pFrame);
+#else
+    // If the incoming frame size doesn't match the output frame
+    if ((pFrame->width  != pStream->pFrameCopy->width) ||
+        (pFrame->height != pStream->pFrameCopy->height))
+    {
+        // Free the output frame and allocate a new one
+        av_frame_free(&pStream->pFrameCopy);
+        pStream->pFrameCopy = av_frame_alloc();
+
+        // Copy all the metadata (width, height, etc.) over
+        //   NOTE: av_frame_copy_props *should* do this but doesn't seem to...
+        memcpy(pStream->pFrameCopy, pFrame, sizeof(AVFrame));
+
+        // Now allocate a data buffer associated with this frame
+        av_frame_get_buffer(pStream->pFrameCopy, 0);
+    }
+
+    // Copy the image data from the decoder frame to the output frame
+    av_frame_copy(pStream->pFrameCopy, pFrame);
+
+    // Finally, unref the frame
+    av_frame_unref(pFrame);
+#endif // FFMPEG_HAS_FRAME_REFS
+
+}// PublishFrame
+
+static int ReassembleKlv(StreamDecoder_t *pStream, const AVPacket *pPacket)
+{
+    // Convert this packet's time to microseconds
+    pStream->MetaDataPacketTime = av_rescale_q(pPacket->pts, pStream->DataTimeBase, AV_TIME_BASE_Q);
+
+    // If the parser is between sets, the next one can't start any earlier than this packet
+    if (KlvStreamIsIdle(&pStream->KlvStream))
+        pStream->MetaDataPending = pStream->MetaDataPacketTime;
+
+    // Feed the packet to the parser, which calls KlvSetDone for every local set it finishes
+    pStream->MetaDataComplete = 0;
+    KlvStreamPush(&pStream->KlvStream, pPacket->data, pPacket->size);
+
+    // There's new metadata if this packet finished a set
+    return pStream->MetaDataComplete;
+
+}// ReassembleKlv
+
+static void KlvSetDone(void *pUser, const uint8_t *pSet, uint32_t Length, KlvSetStatus_t Status)
+{
+    StreamDecoder_t *pStream = (StreamDecoder_t *)pUser;
+
+    // The KLV packet's time is the time of the packet that it started in, and anything after
+    //   this set in the current packet starts the next one
+    int64_t Start = pStream->MetaDataPending;
+    pStream->MetaDataPending = pStream->MetaDataPacketTime;
+
+    // Throw away sets that are corrupt, which the parser has already counted
+    if ((Status == KLV_SET_BAD_CHECKSUM) || (Status == KLV_SET_TRUNCATED))
+        return;
+
+    // If our local buffer is too small for the incoming data
+    if (pStream->MetaDataBufferSize < Length)
+    {
+        uint8_t *pBuffer = (uint8_t *)realloc(pStream->pMetaData, Length);
+
+        // No dice - hang on to the last set instead
+        if (pBuffer == NULL)
+            return;
+
+        // Store the new buffer and its size
+        pStream->pMetaData = pBuffer;
+        pStream->MetaDataBufferSize = Length;
+    }
+
+    // Copy the set out of the parser, which reuses its buffer for the next one
+    memcpy(pStream->pMetaData, pSet, Length);
+    pStream->MetaDataBytes = Length;
+    pStream->MetaDataStart = Start;
+    pStream->MetaDataComplete = 1;
+
+}// KlvSetDone
+
+static AVFormatContext *OpenSegment(StreamDecoder_t *pStream, int Segment, AVFormatContext *pSource)
+{
+    AVFormatContext *pContext = NULL;
+    char Path[sizeof(pStream->RecordPath) + 16];
+    int i;
+
+    // Allocate a format context for the segment file, which is the same format as the recording path
+    if (!RecordSegmentPath(pStream->RecordPath, Segment, pStream->Numbered, Path, sizeof(Path)) ||
+        (avformat_alloc_output_context2(&pContext, NULL, NULL, Path) < 0))
+        return NULL;
+
+    // For each stream in the input, or in the last segment
+    for (i = 0; i < pSource->nb_streams; i++)
+    {
+        // Mirror this stream to the output format context
+        AVStream *pOutStream = avformat_new_stream(pContext, pSource->streams[i]->codec->codec);
+        avcodec_copy_context(pOutStream->codec, pSource->streams[i]->codec);
+
+        // Add a stream header if the output format calls for it
+        if (pContext->oformat->flags & AVFMT_GLOBALHEADER)
+            pOutStream->codec->flags |= CODEC_FLAG_GLOBAL_HEADER;
+    }
+
+    // Open the segment file and write the header out
+    if ((avio_open(&pContext->pb, Path, AVIO_FLAG_WRITE) < 0) || (avformat_write_header(pContext, NULL) < 0))
+    {
+        if (pContext->pb)
+            avio_close(pContext->pb);
+        avformat_free_context(pContext);
+        return NULL;
+    }
+
+    return pContext;
+
+}// OpenSegment
+
+static void CloseSegment(AVFormatContext *pContext)
+{
+    // Write a trailer to the file and close it out
+    av_write_trailer(pContext);
+    avio_close(pContext->pb);
+    avformat_free_context(pContext);
+
+}// CloseSegment
+
+static void WriteSegmentRecord(StreamDecoder_t *pStream, uint64_t HostUs)
+{
+    RecordIndexEntry_t Entry;
+
+    // Note where the segment's packets start, which is right after its header
+    memset(&Entry, 0, sizeof(Entry));
+    Entry.Type = RECORD_INDEX_SEGMENT;
+    Entry.Flags = pStream->Numbered ? RECORD_INDEX_NUMBERED : 0;
+    Entry.Segment = pStream->Segment;
+    Entry.StreamUs = pStream->LastRecordUs;
+    Entry.TimeUs = HostUs;
+    Entry.Offset = avio_tell(pStream->pOutputContext->pb);
+    RecordIndexWrite(&pStream->RecordIndex, &Entry, 1);
+
+}// WriteSegmentRecord
+
+static void RecordKeyframe(StreamDecoder_t *pStream, uint64_t ArrivalUs)
+{
+    AVIOContext *pOutput = pStream->pOutputContext->pb;
+    RecordIndexEntry_t Entry;
+
+    // If this segment is long or big enough, start the next one here. If the new file won't open
+    //   we carry on with this one and try again at the next keyframe.
+    if (pStream->RecordStarted && pStream->Numbered &&
+        (((pStream->SegmentUs > 0) && (pStream->LastRecordUs - pStream->SegmentStartUs >= pStream->SegmentUs)) ||
+         ((pStream->SegmentBytes > 0) && ((uint64_t)avio_tell(pOutput) >= pStream->SegmentBytes))))
+    {
+        AVFormatContext *pNext = OpenSegment(pStream, pStream->Segment + 1, pStream->pOutputContext);
+
+        if (pNext != NULL)
+        {
+            CloseSegment(pStream->pOutputContext);
+            pStream->pOutputContext = pNext;
+            pStream->Segment++;
+            pStream->SegmentStartUs = pStream->LastRecordUs;
+            WriteSegmentRecord(pStream, ArrivalUs);
+            pOutput = pNext->pb;
+        }
+    }
+
+    // Recording starts here if it hasn't already
+    pStream->RecordStarted = 1;
+
+    // Get everything up to the keyframe onto the disk, so the index never points past the end of
+    //   the segment, then index the keyframe at the point it's about to be written to
+    avio_flush(pOutput);
+
+    memset(&Entry, 0, sizeof(Entry));
+    Entry.Type = RECORD_INDEX_KEYFRAME;
+    Entry.Segment = pStream->Segment;
+    Entry.StreamUs = pStream->LastRecordUs;
+    Entry.TimeUs = ArrivalUs;
+    Entry.Offset = avio_tell(pOutput);
+    RecordIndexWrite(&pStream->RecordIndex, &Entry, 1);
+
+}// RecordKeyframe
+
+static void RecordPacket(StreamDecoder_t *pStream, AVPacket *pPacket)
+{
+    int Index = pPacket->stream_index;
+    int64_t Time = (pPacket->dts != AV_NOPTS_VALUE) ? pPacket->dts : pPacket->pts;
+    AVRational InBase = pStream->pInputContext->streams[Index]->time_base, OutBase;
+    int Discontinuous = (pPacket->flags & PKT_FLAG_DISCONTINUITY) != 0;
+    RecordIndexEntry_t *pClock;
+
+    // Keep the reader's flag out of the file
+    pPacket->flags &= ~PKT_FLAG_DISCONTINUITY;
+
+    // The recorded clock follows the video packets
+    if ((Index == pStream->VideoStream) && (Time != AV_NOPTS_VALUE))
+    {
+        // Any clock records that have come in are for frames that are already recorded, so move
+        //   them onto the recorded clock before this packet has a chance to change the offset
+        while (pStream->RecordStarted && ((pClock = (RecordIndexEntry_t *)SpscQueuePop(&pStream->ClockQueue)) != NULL))
+        {
+            pClock->StreamUs -= pStream->RecordOffsetUs;
+            pClock->Segment = pStream->Segment;
+            RecordIndexWrite(&pStream->RecordIndex, pClock, 0);
+            free(pClock);
+        }
+
+        int64_t InputUs = av_rescale_q(Time, InBase, AV_TIME_BASE_Q);
+        int64_t StepUs = InputUs - pStream->RecordOffsetUs - pStream->LastRecordUs;
+
+
+        // Until recording starts, the recorded clock starts from zero at whichever packet this
+        //   is. After that, if the input's timestamps reset, pick up where the last packet left off.
+        //   A keyframe after video the reader dropped really is that far on, however far that is,
+        //   so the recording keeps the hole rather than closing it up, and the step is left alone.
+        if (!pStream->RecordStarted)
+            pStream->RecordOffsetUs = InputUs;
+        else if ((StepUs <= 0) || (!Discontinuous && (StepUs > RECORD_JUMP_US)))
+            pStream->RecordOffsetUs = InputUs - pStream->LastRecordUs - pStream->RecordStepUs;
+        else if (!Discontinuous)
+            pStream->RecordStepUs = StepUs;
+
+        pStream->LastRecordUs = InputUs - pStream->RecordOffsetUs;
+
+        // Keyframes are where segments start and where the index can seek to, and the packet's
+        //   position has been swapped for the time it arrived
+        if ((pPacket->flags & AV_PKT_FLAG_KEY) && (pStream->pOutputContext != NULL))
+            RecordKeyframe(pStream, (uint64_t)pPacket->pos);
+    }
+
+    // Nothing before the first keyframe can be decoded, so there's no point recording it
+    if (!pStream->RecordStarted || (pStream->pOutputContext == NULL))
+        return;
+
+    // Shift every stream by the same offset, in the output's time base
+    OutBase = pStream->pOutputContext->streams[Index]->time_base;
+    if (pPacket->pts != AV_NOPTS_VALUE)
+        pPacket->pts = av_rescale_q(pPacket->pts, InBase, OutBase) - av_rescale_q(pStream->RecordOffsetUs, AV_TIME_BASE_Q, OutBase);
+    if (pPacket->dts != AV_NOPTS_VALUE)
+        pPacket->dts = av_rescale_q(pPacket->dts, InBase, OutBase) - av_rescale_q(pStream->RecordOffsetUs, AV_TIME_BASE_Q, OutBase);
+    pPacket->duration = av_rescale_q(pPacket->duration, InBase, OutBase);
+    pPacket->pos = -1;
+
+    // Write the packet straight to the file. It's already in the order it arrived in, and holding
+    //   it back to interleave would put keyframes somewhere other than where the index says.
+    av_write_frame(pStream->pOutputContext, pPacket);
+
+}// RecordPacket
+
+void StreamSetRecordClock(StreamDecoder_t *pStream, int64_t StreamUs, uint64_t UtcUs, uint32_t SystemTime)
+{
+    RecordIndexEntry_t *pEntry;
+
+    // Nothing to do unless we're recording
+    if (!pStream->Recording || ((pEntry = (RecordIndexEntry_t *)calloc(1, sizeof(RecordIndexEntry_t))) == NULL))
+        return;
+
+    pEntry->Type = RECORD_INDEX_CLOCK;
+    pEntry->StreamUs = StreamUs;
+    pEntry->TimeUs = UtcUs;
+    pEntry->SystemTime = SystemTime;
+
+    // The recorder writes it to the index at the next keyframe, or if it's that far behind, it's dropped
+    if (!SpscQueuePush(&pStream->ClockQueue, pEntry))
+        free(pEntry);
+
+}// StreamSetRecordClock
+
+#ifdef STREAM_THREADS
+
+static int StartPipeline(StreamDecoder_t *pStream)
+{
+    int Decoder = 0, Klv = 0, Recorder = 0;
+
+    // Nothing's been dropped yet
+    memset(&pStream->DecodeGap, 0, sizeof(StreamGap_t));
+    memset(&pStream->RecordGap, 0, sizeof(StreamGap_t));
+
+    // Set up the queues between the stages
+    if (!SpscQueueInit(&pStream->DecodeQueue, DECODE_QUEUE_SIZE) ||
+        !SpscQueueInit(&pStream->KlvQueue, KLV_QUEUE_SIZE) ||
+        !SpscQueueInit(&pStream->RecordQueue, RECORD_QUEUE_SIZE) ||
+        !SpscQueueInit(&pStream->FrameQueue, FRAME_QUEUE_SIZE) ||
+        !SpscQueueInit(&pStream->MetaDataQueue, METADATA_QUEUE_SIZE))
+    {
+        StopPipeline(pStream);
+        return 0;
+    }
+
+    // Start the downstream stages first, so they're ready by the time the reader hands them anything
+    Decoder = (pthread_create(&pStream->Decoder, NULL, DecoderThread, pStream) == 0);
+    Klv = Decoder && (pthread_create(&pStream->KlvParser, NULL, KlvThread, pStream) == 0);
+    Recorder = Klv && (pthread_create(&pStream->Recorder, NULL, RecorderThread, pStream) == 0);
+
+    // Finally the reader, which runs the whole thing
+    if (Recorder && (pthread_create(&pStream->Reader, NULL, ReaderThread, pStream) == 0))
+    {
+        pStream->Threaded = 1;
+        return 1;
+    }
+
+    // If any thread failed to start, tell the ones that did to quit and fall back to doing everything inline
+    pStream->Done = 1;
+    if (Decoder)  pthread_join(pStream->Decoder, NULL);
+    if (Klv)      pthread_join(pStream->KlvParser, NULL);
+    if (Recorder) pthread_join(pStream->Recorder, NULL);
+    pStream->Done = 0;
+    StopPipeline(pStream);
+
+    return 0;
+
+}// StartPipeline
+
+static void StopPipeline(StreamDecoder_t *pStream)
+{
+    AVPacket *pPacket;
+    AVFrame *pFrame;
+
+    // If the threads are running
+    if (pStream->Threaded)
+    {
+        // Stop the reader, which in turn lets the other stages run dry and exit
+        pStream->Stop = 1;
+        pthread_join(pStream->Reader, NULL);
+        pthread_join(pStream->Decoder, NULL);
+        pthread_join(pStream->KlvParser, NULL);
+        pthread_join(pStream->Recorder, NULL);
+        pStream->Threaded = 0;
+    }
+
+    // Throw away anything still in the queues
+    while ((pPacket = (AVPacket *)SpscQueuePop(&pStream->DecodeQueue)) != NULL)
+        av_packet_free(&pPacket);
+    while ((pPacket = (AVPacket *)SpscQueuePop(&pStream->KlvQueue)) != NULL)
+        av_packet_free(&pPacket);
+    while ((pPacket = (AVPacket *)SpscQueuePop(&pStream->RecordQueue)) != NULL)
+        av_packet_free(&pPacket);
+    while ((pFrame = (AVFrame *)SpscQueuePop(&pStream->FrameQueue)) != NULL)
+        av_frame_free(&pFrame);
+    while (SpscQueueDepth(&pStream->MetaDataQueue) != 0)
+        free(SpscQueuePop(&pStream->MetaDataQueue));
+
+    // Free the queues themselves and the last KLV packet
+    SpscQueueFree(&pStream->DecodeQueue);
+    SpscQueueFree(&pStream->KlvQueue);
+    SpscQueueFree(&pStream->RecordQueue);
+    SpscQueueFree(&pStream->FrameQueue);
+    SpscQueueFree(&pStream->MetaDataQueue);
+    free(pStream->pKlvPacket);
+    pStream->pKlvPacket = NULL;
+    pStream->pKlv = NULL;
+
+}// StopPipeline
+
+static int InterruptRead(void *pArg)
+{
+    // Non-zero aborts whatever blocking read the demuxer is in
+    return ((StreamDecoder_t *)pArg)->Stop;
+
+}// InterruptRead
+
+static void QueuePacket(SpscQueue_t *pQueue, const AVPacket *pPacket, StreamGap_t *pGap)
+{
+    int Key = (pPacket->flags & AV_PKT_FLAG_KEY) != 0;
+    AVPacket *pRef;
+
+    // Once a video packet has been dropped, every packet after it up to the next keyframe refers
+    //   to a frame the stage never got, so don't bother queueing any of them
+    if ((pGap != NULL) && pGap->Gap && !Key)
+    {
+        atomicStoreRelaxed32(&pGap->Skipped, pGap->Skipped + 1);
+        return;
+    }
+
+    // Each stage gets its own reference to the packet data, which isn't copied
+    if ((pRef = av_packet_clone(pPacket)) == NULL)
+        return;
+
+    // A keyframe that ends a hole tells the stage to start over from it
+    if ((pGap != NULL) && pGap->Gap)
+        pRef->flags |= PKT_FLAG_DISCONTINUITY;
+
+    // If the stage is backed up, drop the packet: that's counted by the queue, and it's better than
+    //   making the reader fall behind the socket. Dropping video opens a hole up to the next keyframe.
+    if (SpscQueuePush(pQueue, pRef))
+    {
+        if (pGap != NULL)
+            pGap->Gap = 0;
+    }
+    else
+    {
+        av_packet_free(&pRef);
+        if (pGap != NULL)
+            pGap->Gap = 1;
+    }
+
+}// QueuePacket
+
+static void *ReaderThread(void *pArg)
+{
+    StreamDecoder_t *pStream = (StreamDecoder_t *)pArg;
+    AVPacket *pPacket = av_packet_alloc();
+
+    // Keep reading packets off of the socket until we're told to stop or the stream ends. This
+    //   thread does nothing else, so the socket is drained as fast as packets arrive.
+    while ((pPacket != NULL) && !pStream->Stop && (av_read_frame(pStream->pInputContext, pPacket) >= 0))
+    {
+        int Index = pPacket->stream_index;
+
+        // Send video to the decoder and KLV data to the KLV parser
+        if (Index == pStream->VideoStream)
+            QueuePacket(&pStream->DecodeQueue, pPacket, &pStream->DecodeGap);
+        else if (Index == pStream->DataStream)
+            QueuePacket(&pStream->KlvQueue, pPacket, NULL);
+
+        // And everything to the recorder, if we're recording. The recorder has no use for the
+        //   packet's position in the input, so that carries the time the packet arrived instead.
+        if (pStream->Recording)
+        {
+            pPacket->pos = av_gettime();
+            QueuePacket(&pStream->RecordQueue, pPacket, (Index == pStream->VideoStream) ? &pStream->RecordGap : NULL);
+        }
+
+        // Let go of our reference to the packet
+        av_packet_unref(pPacket);
+    }
 
-            // There's new metadata if the size is non-zero and equal to the number of bytes read in
-            NewMetaData = (MetaDataSize != 0) && (MetaDataBytes == MetaDataSize);
+    // Let the other stages know that nothing more is coming
+    av_packet_free(&pPacket);
+    __atomic_store_n(&pStream->Done, 1, __ATOMIC_RELEASE);
+
+    return NULL;
+
+}// ReaderThread
+
+static AVPacket *NextPacket(StreamDecoder_t *pStream, SpscQueue_t *pQueue)
+{
+    // Wait for the reader to queue something up
+    while (1)
+    {
+        // Check for completion before popping, so nothing queued before the reader quit is missed
+        int Done = __atomic_load_n(&pStream->Done, __ATOMIC_ACQUIRE);
+        AVPacket *pPacket = (AVPacket *)SpscQueuePop(pQueue);
+
+        // Either hand the packet back or, if the reader's gone and the queue is empty, tell the stage to quit
+        if (pPacket != NULL)
+            return pPacket;
+        else if (Done)
+            return NULL;
+
+        // Nothing yet, so idle for a bit
+        usleep(STAGE_IDLE_US);
+    }
+
+}// NextPacket
+
+static void *DecoderThread(void *pArg)
+{
+    StreamDecoder_t *pStream = (StreamDecoder_t *)pArg;
+    AVPacket *pPacket;
+
+    // For each video packet the reader hands us
+    while ((pPacket = NextPacket(pStream, &pStream->DecodeQueue)) != NULL)
+    {
+        // If the reader had to drop video, forget the frames that came before the hole and start
+        //   over from this keyframe, rather than decode it against references that are gone
+        if (pPacket->flags & PKT_FLAG_DISCONTINUITY)
+        {
+            pPacket->flags &= ~PKT_FLAG_DISCONTINUITY;
+            avcodec_flush_buffers(pStream->pCodecContext);
         }
 
-        // If we have an open output file
-        if (pOutputContext)
+        // If this packet finished a frame
+        if (DecodeVideo(pStream, pPacket))
         {
-            static int64_t StartPts = 0, StartDts = 0;
-            static int64_t LastPts = -1, LastDts = -1;
+            // Move the frame out of the decoder and hand it to the caller, or drop it if the caller is behind
+            AVFrame *pFrame = av_frame_alloc();
 
-            // If we just jumped into the middle of the stream or its timestamps have reset
-            if ((LastPts < 0) || (Packet.pts < LastPts))
+            if (pFrame != NULL)
             {
-                // Create an adjustment parameter for both PTS and DTS
-                StartPts += (Packet.pts - LastPts) - 1;
-                StartDts += (Packet.dts - LastDts) - 1;
+                av_frame_move_ref(pFrame, pStream->pFrame);
+                if (!SpscQueuePush(&pStream->FrameQueue, pFrame))
+                    av_frame_free(&pFrame);
             }
+            else
+                av_frame_unref(pStream->pFrame);
+        }
+
+        // Done with the packet
+        av_packet_free(&pPacket);
+    }
 
-            // Save the current PTS/DTS for detecting discontinuities
-            LastPts = Packet.pts;
-            LastDts = Packet.dts;
+    return NULL;
 
-            // Adjust the PTS/DTS values to create a continuous stream
-            Packet.pts -= StartPts;
-            Packet.dts -= StartDts;
+}// DecoderThread
 
-            // Rescale all the PTS/DTS nonsense
-            Packet.pts = av_rescale_q(Packet.pts, pOutputContext->streams[Index]->time_base, pInputContext->streams[Index]->time_base);
-            Packet.dts = av_rescale_q(Packet.dts, pOutputContext->streams[Index]->time_base, pInputContext->streams[Index]->time_base);
-            Packet.duration = av_rescale_q(Packet.duration, pOutputContext->streams[Index]->time_base, pInputContext->streams[Index]->time_base);
-            Packet.pos = -1;
+static void *KlvThread(void *pArg)
+{
+    StreamDecoder_t *pStream = (StreamDecoder_t *)pArg;
+    AVPacket *pPacket;
+
+    // For each KLV packet the reader hands us
+    while ((pPacket = NextPacket(pStream, &pStream->KlvQueue)) != NULL)
+    {
+        // If this packet finished a KLV packet
+        if (ReassembleKlv(pStream, pPacket))
+        {
+            // Copy it out of the reassembly buffer and hand it to the caller, or drop it if the caller is behind
+            StreamKlv_t *pKlv = (StreamKlv_t *)malloc(sizeof(StreamKlv_t) + pStream->MetaDataBytes);
 
-            // Write the frame to the file
-            av_interleaved_write_frame(pOutputContext, &Packet);
+            if (pKlv != NULL)
+            {
+                pKlv->Time = pStream->MetaDataStart;
+                pKlv->Bytes = pStream->MetaDataBytes;
+                memcpy(pKlv->Data, pStream->pMetaData, pStream->MetaDataBytes);
+                if (!SpscQueuePush(&pStream->MetaDataQueue, pKlv))
+                    free(pKlv);
+            }
         }
 
-        // Free the packet data
-        av_free_packet(&Packet);
+        // Done with the packet
+        av_packet_free(&pPacket);
+    }
 
-        // Return 1 if both a video frame and KLV packet have been read in
-        if (NewVideo && NewMetaData)
-            return 1;
+    return NULL;
+
+}// KlvThread
+
+static void *RecorderThread(void *pArg)
+{
+    StreamDecoder_t *pStream = (StreamDecoder_t *)pArg;
+    AVPacket *pPacket;
+
+    // Write each packet out to the record file. This is the only stage that waits on the disk,
+    //   so a slow disk backs up the record queue and nothing else.
+    while ((pPacket = NextPacket(pStream, &pStream->RecordQueue)) != NULL)
+    {
+        RecordPacket(pStream, pPacket);
+        av_packet_free(&pPacket);
     }
 
-    // No new data if we made it here
-    return 0;
+    return NULL;
 
-}// StreamProcess
+}// RecorderThread
 
-int StreamGetVideoFrame(uint8_t *pFrameData, int *pWidth, int *pHeight, int MaxBytes)
+#endif // STREAM_THREADS
+
+int StreamGetVideoFrame(StreamDecoder_t *pStream, uint8_t *pFrameData, int *pWidth, int *pHeight, int MaxBytes)
 {
-    // If we actually have frame data to copy out and it won't overrun pFrameData
-    if ((pFrameCopy->width > 0) && (pFrameCopy->height > 0) && ((pFrame->width * pFrame->height * 3) < MaxBytes))
+    const AVFrame *pSource = pStream->pFrameCopy;
+
+    // If we don't actually have frame data to copy out, or it would overrun pFrameData
+    if ((pSource->width <= 0) || (pSource->height <= 0) || ((pSource->width * pSource->height * 3) >= MaxBytes))
+        return 0;
+
+#ifdef FFMPEG_HAS_HWACCEL
+    // Frames that live in GPU memory have to be downloaded first
+    if (pSource->hw_frames_ctx != NULL)
+    {
+        av_frame_unref(pStream->pSwFrame);
+        if (av_hwframe_transfer_data(pStream->pSwFrame, pSource, 0) < 0)
+            return 0;
+
+        pSource = pStream->pSwFrame;
+    }
+#endif // FFMPEG_HAS_HWACCEL
+
     {
-        // Allocate a context for colorspace conversion and do some data marshaling 
-        struct SwsContext *pContext  = sws_getContext(pFrameCopy->width, pFrameCopy->height, pFrameCopy->format,
-                                                      pFrameCopy->width, pFrameCopy->height, AV_PIX_FMT_RGB24,
-                                                      SWS_FAST_BILINEAR, NULL, NULL, NULL);
         uint8_t *pData[3] = { pFrameData, NULL, NULL };
-        int Stride[3] = { pFrameCopy->width * 3, 0, 0 };
+        int Stride[3] = { pSource->width * 3, 0, 0 };
+
+        // Reuse the colorspace converter from the last call, which only gets rebuilt if the frame
+        //   size or format has changed
+        pStream->pSwsContext = sws_getCachedContext(pStream->pSwsContext, pSource->width, pSource->height, pSource->format,
+                                                    pSource->width, pSource->height, AV_PIX_FMT_RGB24,
+                                                    SWS_FAST_BILINEAR, NULL, NULL, NULL);
+        if (pStream->pSwsContext == NULL)
+            return 0;
 
         // Copy the frame width/height out to the caller
-        *pWidth  = pFrameCopy->width;
-        *pHeight = pFrameCopy->height;
+        *pWidth  = pSource->width;
+        *pHeight = pSource->height;
 
         // Now do the actual colorspace conversion
-        sws_scale(pContext, (const uint8_t **)pFrameCopy->data, pFrameCopy->linesize, 0, pFrameCopy->height, pData, Stride);
-        sws_freeContext(pContext);
+        sws_scale(pStream->pSwsContext, (const uint8_t **)pSource->data, pSource->linesize, 0, pSource->height, pData, Stride);
+    }
+
+    // Tell the caller this function succeeded
+    return 1;
+
+}// StreamGetVideoFrame
 
-        // Tell the caller this function succeeded
+int StreamRefVideoFrame(StreamDecoder_t *pStream, AVFrame *pFrame)
+{
+#ifdef FFMPEG_HAS_FRAME_REFS
+    // Give the caller its own reference to the latest frame, which stays valid after the decoder
+    //   moves on. Hardware frames stay in GPU memory, so the caller can render or encode them directly.
+    if ((pStream->pFrameCopy->width > 0) && (av_frame_ref(pFrame, pStream->pFrameCopy) >= 0))
         return 1;
+#endif // FFMPEG_HAS_FRAME_REFS
+
+    // No frame yet, or no reference counting in this FFmpeg
+    return 0;
+
+}// StreamRefVideoFrame
+
+int StreamRefDrmFrame(StreamDecoder_t *pStream, AVFrame *pFrame)
+{
+#ifdef FFMPEG_HAS_HWACCEL
+    const AVFrame *pSource = pStream->pFrameCopy;
+
+    // Frames that are already DMA-BUFs (V4L2 M2M decoders) only need another reference
+    if (pSource->format == AV_PIX_FMT_DRM_PRIME)
+        return av_frame_ref(pFrame, pSource) >= 0;
+
+    // Other hardware frames (VAAPI, for example) can often be mapped to DMA-BUFs in place
+    if (pSource->hw_frames_ctx != NULL)
+    {
+        pFrame->format = AV_PIX_FMT_DRM_PRIME;
+        if (av_hwframe_map(pFrame, pSource, AV_HWFRAME_MAP_READ) >= 0)
+            return 1;
+
+        av_frame_unref(pFrame);
     }
+#endif // FFMPEG_HAS_HWACCEL
 
-    // No such data
+    // This frame can't be exported as a DMA-BUF
     return 0;
 
-}// StreamGetVideoFrame
+}// StreamRefDrmFrame
+
+int StreamIsHwAccelerated(const StreamDecoder_t *pStream)
+{
+    // Either a hwcontext device or a V4L2 M2M decoder counts
+    return (pStream->pHwDevice != NULL) || ((pStream->pCodecContext != NULL) && (strstr(pStream->pCodecContext->codec->name, "_v4l2m2m") != NULL));
+
+}// StreamIsHwAccelerated
+
+int64_t StreamGetVideoTime(const StreamDecoder_t *pStream)
+{
+    // Presentation time of the frame that StreamGetVideoFrame would return
+    return pStream->VideoTime;
+
+}// StreamGetVideoTime
+
+int64_t StreamGetMetaDataTime(const StreamDecoder_t *pStream)
+{
+    // Presentation time of the KLV packet that StreamGetMetaData would return
+    return pStream->MetaDataTime;
+
+}// StreamGetMetaDataTime
 
-int StreamGetMetaData(uint8_t *pData, int *pBytes, int MaxBytes)
+int StreamGetMetaData(StreamDecoder_t *pStream, uint8_t *pData, int *pBytes, int MaxBytes)
 {
-    // If there's a valid metadata buffer and we're not going to overrun pData
-    if ((pMetaData != 0) && (MetaDataBytes < MaxBytes))
+    // If there's a complete KLV packet and we're not going to overrun pData
+    if ((pStream->pKlv != 0) && (pStream->KlvBytes < MaxBytes))
     {
-        // Copy the buffered KLV data into pData and send out the buffer size
-        memcpy(pData, pMetaData, MetaDataBytes);
-        *pBytes = MetaDataBytes;
+        // Copy the KLV data into pData and send out the buffer size
+        memcpy(pData, pStream->pKlv, pStream->KlvBytes);
+        *pBytes = pStream->KlvBytes;
 
         // A return value of 1 signifies that that pData contains a whole KLV UAS data packet
         return 1;
@@ -368,3 +1273,42 @@ int StreamGetMetaData(uint8_t *pData, int *pBytes, int MaxBytes)
 
 }// StreamGetMetaData
 
+
+#ifdef STREAM_THREADS
+static void GetQueueStats(const SpscQueue_t *pQueue, const StreamGap_t *pGap, StreamQueueStats_t *pStats)
+{
+    // Everything that was pushed successfully, everything that wasn't, what was skipped after
+    //   that, and what's waiting now
+    pStats->Queued    = atomicLoadRelaxed32(&pQueue->Ring.Head);
+    pStats->Dropped   = atomicLoadRelaxed32(&pQueue->Ring.Dropped);
+    pStats->Skipped   = (pGap != NULL) ? atomicLoadRelaxed32(&pGap->Skipped) : 0;
+    pStats->Depth     = SpscQueueDepth(pQueue);
+    pStats->HighWater = atomicLoadRelaxed32(&pQueue->Ring.HighWater);
+
+}// GetQueueStats
+#endif // STREAM_THREADS
+
+int StreamGetStats(const StreamDecoder_t *pStream, StreamStats_t *pStats)
+{
+    // Start out with nothing to report but the KLV parser's counts
+    memset(pStats, 0, sizeof(StreamStats_t));
+    pStats->KlvBadChecksums = pStream->KlvStream.BadChecksums;
+    pStats->KlvDropped = pStream->KlvStream.Dropped;
+
+#ifdef STREAM_THREADS
+    // Only the pipeline has queues to report on
+    if (pStream->Threaded)
+    {
+        GetQueueStats(&pStream->DecodeQueue,   &pStream->DecodeGap, &pStats->Decode);
+        GetQueueStats(&pStream->KlvQueue,      NULL,                &pStats->Klv);
+        GetQueueStats(&pStream->RecordQueue,   &pStream->RecordGap, &pStats->Record);
+        GetQueueStats(&pStream->FrameQueue,    NULL,                &pStats->Frames);
+        GetQueueStats(&pStream->MetaDataQueue, NULL,                &pStats->MetaData);
+        return 1;
+    }
+#endif // STREAM_THREADS
+
+    // Everything is done inline, so nothing can back up
+    return 0;
+
+}// StreamGetStats
@@ -3,12 +3,101 @@
 
 #include <stdint.h>
 
-int StreamOpen(const char *pUrl, const char *pRecordPath);
-void StreamClose(void);
+struct AVFrame;
 
-int StreamProcess(void);
+// One MPEG-TS video/KLV stream. Each instance keeps all of its own state, so any number of streams
+//   can be decoded at once, each from its own thread. A single instance isn't thread safe.
+//
+// Unless STREAM_OPEN_NO_THREADS is passed, each stream runs as a pipeline: a reader thread drains
+//   the socket and hands packets to decoder, KLV and recorder threads over bounded lock-free
+//   queues, and StreamProcess just picks up the finished frames and KLV packets. A stage that
+//   falls behind drops its own work rather than stalling the reader; StreamGetStats reports it.
+//   Video is only ever dropped up to the next keyframe, which the stage then starts over from.
+typedef struct StreamDecoder StreamDecoder_t;
 
-int StreamGetVideoFrame(uint8_t *pFrameData, int *pWidth, int *pHeight, int MaxBytes);
-int StreamGetMetaData(uint8_t *pMetaData, int *pBytes, int MaxBytes);
+// Flags for StreamOpenEx
+#define STREAM_OPEN_NO_HWACCEL 0x01
+#define STREAM_OPEN_NO_THREADS 0x02
+
+// Backpressure counters for one pipeline queue
+typedef struct
+{
+    // Items that went into the queue, and items dropped because it was full. A dropped video
+    //   packet also costs every packet after it up to the next keyframe, which are counted in
+    //   Skipped and never queued, since they couldn't be decoded without it.
+    uint32_t Queued;
+    uint32_t Dropped;
+    uint32_t Skipped;
+
+    // Items waiting right now, and the most that have ever been waiting
+    uint32_t Depth;
+    uint32_t HighWater;
+
+} StreamQueueStats_t;
+
+typedef struct
+{
+    // Packets from the reader to the decoder, KLV and recorder stages
+    StreamQueueStats_t Decode;
+    StreamQueueStats_t Klv;
+    StreamQueueStats_t Record;
+
+    // Decoded frames and KLV packets waiting for StreamProcess
+    StreamQueueStats_t Frames;
+    StreamQueueStats_t MetaData;
+
+    // KLV local sets thrown away for a bad checksum, and for being malformed
+    uint32_t KlvBadChecksums;
+    uint32_t KlvDropped;
+
+} StreamStats_t;
+
+// How to record a stream. Recordings are split into segment files at the first keyframe after
+//   SegmentSeconds or SegmentBytes, whichever comes first, so each segment plays on its own; zero
+//   for both records one file at pPath. Either way a RecordIndex.h index is written alongside,
+//   with the host time every keyframe arrived at and its byte offset.
+typedef struct
+{
+    const char *pPath;
+    int SegmentSeconds;
+    uint64_t SegmentBytes;
+
+} StreamRecordOptions_t;
+
+StreamDecoder_t *StreamOpen(const char *pUrl, const char *pRecordPath);
+StreamDecoder_t *StreamOpenEx(const char *pUrl, const char *pRecordPath, int Flags);
+StreamDecoder_t *StreamOpenRecord(const char *pUrl, const StreamRecordOptions_t *pRecord, int Flags);
+void StreamClose(StreamDecoder_t *pStream);
+
+// Open a recording made by StreamOpenRecord at the last keyframe at or before a time on one of
+//   the RECORD_CLOCK_ clocks, and give back the host time of that keyframe, which is where a
+//   telemetry capture recorded alongside should be seeked to
+StreamDecoder_t *StreamOpenIndexed(const char *pRecordPath, int Clock, int64_t Time, uint64_t *pHostUs, int Flags);
+
+// Tie a presentation time from StreamGetVideoTime to UTC and the gimbal's system time in the
+//   recording's index. Only one thread may call this while the stream is being recorded.
+void StreamSetRecordClock(StreamDecoder_t *pStream, int64_t StreamUs, uint64_t UtcUs, uint32_t SystemTime);
+
+// Flags returned by StreamProcess
+#define STREAM_NEW_VIDEO    0x01
+#define STREAM_NEW_METADATA 0x02
+
+int StreamProcess(StreamDecoder_t *pStream);
+
+// Presentation time in microseconds of the last decoded frame and KLV packet
+int64_t StreamGetVideoTime(const StreamDecoder_t *pStream);
+int64_t StreamGetMetaDataTime(const StreamDecoder_t *pStream);
+
+int StreamGetVideoFrame(StreamDecoder_t *pStream, uint8_t *pFrameData, int *pWidth, int *pHeight, int MaxBytes);
+
+// Zero-copy access to the latest frame: these add a reference to it in pFrame, which the caller
+//   must release with av_frame_unref(). Hardware decoded frames stay in GPU memory.
+int StreamRefVideoFrame(StreamDecoder_t *pStream, struct AVFrame *pFrame);
+int StreamRefDrmFrame(StreamDecoder_t *pStream, struct AVFrame *pFrame);
+int StreamIsHwAccelerated(const StreamDecoder_t *pStream);
+int StreamGetMetaData(StreamDecoder_t *pStream, uint8_t *pMetaData, int *pBytes, int MaxBytes);
+
+// Pipeline queue and KLV statistics, returns 0 if the stream isn't running as a pipeline
+int StreamGetStats(const StreamDecoder_t *pStream, StreamStats_t *pStats);
 
 #endif // STREAMDECODER_H
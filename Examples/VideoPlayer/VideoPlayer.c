@@ -1,7 +1,12 @@
 #include "OrionPublicPacket.h"
 #include "fielddecode.h"
 #include "OrionComm.h"
+#include "OrionCommCapture.h"
 #include "StreamDecoder.h"
+#include "FrameSync.h"
+#include "Snapshot.h"
+#include "GeolocateHistory.h"
+#include "Orthorectify.h"
 #include "FFmpeg.h"
 #include "KlvParser.h"
 #include "earthposition.h"
@@ -11,26 +16,71 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
-
-#include <jpeglib.h>
+#include <stdint.h>
+#include <unistd.h>
 
 // Incoming and outgoing packet structures. Incoming structure *MUST* be persistent
-//  between calls to ProcessData.
-static OrionPkt_t PktOut;
+//  between calls to ProcessTelemetry.
+static OrionPkt_t PktIn, PktOut;
+
+// Telemetry history, which holds a couple of seconds of telemetry at 10 Hz
+#define HISTORY_SIZE 64
+static GeolocateTelemetry_t HistoryEntries[HISTORY_SIZE];
+static GeolocateHistory_t History;
+
+// Matches up video frames with telemetry
+static FrameSync_t Sync;
+
+// The video stream decoder
+static StreamDecoder_t *pStream = NULL;
+
+// Recordings are split into segments of this many seconds, and the telemetry is captured alongside
+#define RECORD_SEGMENT_SECONDS 600
+static OrionCommCaptureWriter_t Capture;
+static int Capturing = 0;
+
+// Stream time of the frame that last tied the recording's clock to UTC and the gimbal's clock
+#define RECORD_CLOCK_US 1000000
+static int64_t LastRecordClock = 0;
+
+// A frame that's been grabbed for a snapshot and is waiting to be paired with telemetry
+typedef struct
+{
+    // Reference to the decoded frame, and its frame number or 0 if this entry is free
+    AVFrame *pFrame;
+    int Frame;
+
+} Snapshot_t;
+
+// Grabbed frames are kept by frame number, with room for more than the frame synchronizer can hold
+#define SNAPSHOT_PENDING 32
+static Snapshot_t Pending[SNAPSHOT_PENDING];
+static int NumPending = 0;
+
+// Snapshots are compressed and saved on their own threads, so a slow encode or disk never holds up the video
+#define SNAPSHOT_THREADS 2
+#define SNAPSHOT_SLOTS   16
+static SnapshotWriter_t *pSnapshots = NULL;
 
 // A few helper functions, etc.
 static void KillProcess(const char *pMessage, int Value);
 static void ProcessArgs(int argc, char **argv, OrionNetworkVideo_t *pSettings, char *pVideoUrl, char *pRecordPath);
 static int ProcessKeyboard(void);
-static void SaveJpeg(uint8_t *pData, const double Lla[NLLA], uint64_t TimeStamp, int Width, int Height, const char *pPath, int Quality);
-static void WriteExifData(struct jpeg_compress_struct *pInfo, const double Lla[NLLA], uint64_t TimeStamp);
+static void ProcessTelemetry(void);
+static void GrabSnapshot(int Frame, const double Lla[NLLA], uint64_t TimeStamp);
+static void QueueSnapshot(Snapshot_t *pSnapshot, const double Lla[NLLA], uint64_t TimeStamp, const GeolocateTelemetry_t *pGeo);
+static void SnapshotSaved(const SnapshotInfo_t *pInfo, const AVFrame *pFrame, int Saved);
+static void SaveOrthoJpeg(const SnapshotInfo_t *pInfo, const AVFrame *pFrame, const GeolocateTelemetry_t *pGeo);
 
 int main(int argc, char **argv)
 {
-    uint8_t VideoFrame[1280 * 720 * 3] = { 0 }, MetaData[1024] = { 0 };
+    uint8_t MetaData[1024] = { 0 };
     OrionNetworkVideo_t Settings;
     char VideoUrl[32] = "", RecordPath[256] = "";
-    int FrameCount = 0;
+    StreamRecordOptions_t Record = { RecordPath, RECORD_SEGMENT_SECONDS, 0 };
+    int FrameCount = 0, SnapshotRequested = 0, Burst = 0, Size = 0, i;
+    double Lla[NLLA] = { 0, 0, 0 };
+    uint64_t TimeStamp = 0;
 
     // Zero out the video settings packet to set everything to 'no change'
     memset(&Settings, 0, sizeof(Settings));
@@ -42,76 +92,156 @@ int main(int argc, char **argv)
     // Process the command line arguments   
     ProcessArgs(argc, argv, &Settings, VideoUrl, RecordPath);
 
+    // Set up the telemetry history and the frame/telemetry synchronizer on top of it
+    geolocateHistoryInit(&History, HistoryEntries, HISTORY_SIZE, 2000);
+    FrameSyncInit(&Sync, &History);
+
+    // Start up the JPEG writer, and make room for references to the frames waiting to go to it
+    if ((pSnapshots = SnapshotWriterOpen(SNAPSHOT_THREADS, SNAPSHOT_SLOTS, 75, SnapshotSaved)) == NULL)
+        KillProcess("Failed to start the JPEG writer", 1);
+
+    for (i = 0; i < SNAPSHOT_PENDING; i++)
+    {
+        if ((Pending[i].pFrame = av_frame_alloc()) == NULL)
+            KillProcess("Failed to allocate snapshot frames", 1);
+    }
+
     // Send the network video settings
     encodeOrionNetworkVideoPacketStructure(&PktOut, &Settings);
     OrionCommSend(&PktOut);
 
+    // If we're recording, capture the telemetry too so it can be played back along with the video
+    if (strlen(RecordPath))
+    {
+        char CapturePath[sizeof(RecordPath) + 8];
+
+        snprintf(CapturePath, sizeof(CapturePath), "%s.ocap", RecordPath);
+        if ((Capturing = OrionCommCaptureCreate(&Capture, CapturePath, 0)) != FALSE)
+            OrionCommRecord(&Capture, 0);
+        else
+            printf("Failed to create telemetry capture %s\n", CapturePath);
+    }
+
     // If we can't open the video stream
-    if (StreamOpen(VideoUrl, RecordPath) == 0)
+    if ((pStream = StreamOpenRecord(VideoUrl, &Record, 0)) == NULL)
     {
         // Tell the user and get out of here
         printf("Failed to open video at %s\n", VideoUrl);
         KillProcess("", 1);
     }
     else
-        printf("Press S to capture a snapshot or Q to quit\n");
+        printf("Press S to capture a snapshot, B to start or stop a burst of snapshots, or Q to quit\n");
 
     // Loop forever
     while (1)
     {
-        // Run the MPEG-TS stream processor
-        while (StreamProcess())
-        {
-            // If we got a new frame/metadata pair, print a little info to the screen
-            printf("Captured %5d frames\r", ++FrameCount);
-        }
+        FrameSyncPair_t Pair;
+        StreamStats_t Stats;
+        int Flags;
 
-        // Switch on keyboard input (if any)
-        switch (ProcessKeyboard())
-        {
-        case 's':
-        case 'S':
-        {
-            double Lla[NLLA] = { 0, 0, 0 };
-            int Width, Height, Size;
-            uint64_t TimeStamp;
-            char Path[64];
+        // Pull in any new telemetry from the gimbal
+        ProcessTelemetry();
 
-            // If we can read a KLV UAS data packet out of the decoder
-            if (StreamGetMetaData(MetaData, &Size, sizeof(MetaData)))
+        // Run the MPEG-TS stream processor
+        while ((Flags = StreamProcess(pStream)) != 0)
+        {
+            // If we can read a new KLV UAS data packet out of the decoder
+            if ((Flags & STREAM_NEW_METADATA) && StreamGetMetaData(pStream, MetaData, &Size, sizeof(MetaData)))
             {
                 int Result;
 
                 // Send the new metadata to the KLV parser
                 KlvNewData(MetaData, Size);
 
-                // Grab the gimbal's LLA out of the KLV data
+                // Grab the gimbal's LLA out of the KLV data, in case there's no telemetry to use instead
                 Lla[LAT] = KlvGetValueDouble(KLV_UAS_SENSOR_LAT, &Result);
                 Lla[LON] = KlvGetValueDouble(KLV_UAS_SENSOR_LON, &Result);
                 Lla[ALT] = KlvGetValueDouble(KLV_UAS_SENSOR_MSL, &Result);
 
-                // Grab the UNIX timestamp as well
+                // The UNIX timestamp ties the stream clock to UTC
                 TimeStamp = KlvGetValueUInt(KLV_UAS_TIME_STAMP, &Result);
+                if (Result)
+                    FrameSyncSetClock(&Sync, StreamGetMetaDataTime(pStream), TimeStamp);
+            }
 
-                // Print the gimbal LLA data to stdout
-                printf("\nImage Pos: %11.6lf %11.6lf %7.1lf", degrees(Lla[LAT]), degrees(Lla[LON]), Lla[ALT]);
+            // If we got a new video frame
+            if (Flags & STREAM_NEW_VIDEO)
+            {
+                // If the user asked for a snapshot, or for every frame, hang on to a reference to this one
+                if (SnapshotRequested || Burst)
+                {
+                    GrabSnapshot(FrameCount + 1, Lla, TimeStamp);
+                    SnapshotRequested = 0;
+                }
+
+                // Queue the frame up to be matched with telemetry
+                FrameSyncPushFrame(&Sync, StreamGetVideoTime(pStream), (void *)(intptr_t)++FrameCount);
+
+                // Print a little info to the screen, including anything the pipeline had to drop
+                StreamGetStats(pStream, &Stats);
+                printf("Captured %5d frames, dropped %u packets and %u frames\r", FrameCount,
+                       Stats.Decode.Dropped + Stats.Decode.Skipped + Stats.Klv.Dropped + Stats.Record.Dropped + Stats.Record.Skipped,
+                       Stats.Frames.Dropped);
             }
+        }
+
+        // Now go through all the frames that have been matched up with telemetry
+        while (FrameSyncPull(&Sync, &Pair))
+        {
+            Snapshot_t *pSnapshot = &Pending[(intptr_t)Pair.Frame.pUser % SNAPSHOT_PENDING];
 
-            // If we can read the current frame out of the decoder
-            if (StreamGetVideoFrame(VideoFrame, &Width, &Height, sizeof(VideoFrame)))
+            // Every so often, note how this frame's time relates to UTC and the gimbal's clock in the recording's index
+            if (Sync.HaveClock && ((Pair.Frame.StreamUs - LastRecordClock >= RECORD_CLOCK_US) || (Pair.Frame.StreamUs < LastRecordClock)))
             {
-                // Create a file path based on the current frame index
-                sprintf(Path, "%05d.jpg", FrameCount);
+                StreamSetRecordClock(pStream, Pair.Frame.StreamUs, Pair.Frame.StreamUs + Sync.StreamToUtcUs, Pair.SystemTime);
+                LastRecordClock = Pair.Frame.StreamUs;
+            }
 
-                // Now save the image as a JPEG
-                SaveJpeg(VideoFrame, Lla, TimeStamp, Width, Height, Path, 75);
+            // If this is a frame we took a snapshot of
+            if (pSnapshot->Frame == (intptr_t)Pair.Frame.pUser)
+            {
+                // Use the telemetry at the exact frame time, with MSL altitude to match the KLV data
+                Lla[LAT] = Pair.Geo.base.posLat;
+                Lla[LON] = Pair.Geo.base.posLon;
+                Lla[ALT] = Pair.Geo.base.posAlt - Pair.Geo.base.geoidUndulation;
+                if (Sync.HaveClock)
+                    TimeStamp = Pair.Frame.StreamUs + Sync.StreamToUtcUs;
+
+                // Print the position, then hand the image off to be saved as a JPEG along with the
+                //   whole telemetry, so the writer can drape the frame onto the map
+                printf("\nImage Pos: %11.6lf %11.6lf %7.1lf (%s)", degrees(Lla[LAT]), degrees(Lla[LON]), Lla[ALT], Pair.Interpolated ? "interpolated" : "nearest");
+                QueueSnapshot(pSnapshot, Lla, TimeStamp, &Pair.Geo);
+            }
+        }
 
-                // Print some confirmation to stdout
-                printf("\nSaved file %s\n", Path);
+        // If there's no telemetry to match frames against, save snapshots with the KLV position right away
+        if ((NumPending > 0) && (geolocateHistoryCount(&History) == 0))
+        {
+            for (i = 0; i < SNAPSHOT_PENDING; i++)
+            {
+                if (Pending[i].Frame != 0)
+                {
+                    printf("\nImage Pos: %11.6lf %11.6lf %7.1lf", degrees(Lla[LAT]), degrees(Lla[LON]), Lla[ALT]);
+                    QueueSnapshot(&Pending[i], Lla, TimeStamp, NULL);
+                }
             }
+        }
+
+        // Switch on keyboard input (if any)
+        switch (ProcessKeyboard())
+        {
+        case 's':
+        case 'S':
+            // Snapshot the next decoded frame
+            SnapshotRequested = 1;
+            break;
 
+        case 'b':
+        case 'B':
+            // Start or stop snapshotting every decoded frame
+            Burst = !Burst;
+            printf("\n%s burst capture\n", Burst ? "Starting" : "Stopping");
             break;
-        }
 
         case 'q':
         case 'Q':
@@ -132,136 +262,156 @@ int main(int argc, char **argv)
 
 }// main
 
-static void SaveJpeg(uint8_t *pData, const double Lla[NLLA], uint64_t TimeStamp, int Width, int Height, const char *pPath, int Quality)
+static void ProcessTelemetry(void)
 {
-    FILE *pFile;
-
-    // If we manage to open the file we're trying to write to
-    if ((pFile = fopen(pPath, "wb")) != NULL)
+    // Loop through any new incoming packets
+    while (OrionCommReceive(&PktIn))
     {
-        struct jpeg_compress_struct Info;
-        struct jpeg_error_mgr Error;
-        unsigned int i;
-
-        // Not sure why this has to happen first...
-        Info.err = jpeg_std_error(&Error);
-
-        // Initialize the compressor subsystem
-        jpeg_create_compress(&Info);
-        jpeg_stdio_dest(&Info, pFile);
+        // If this is geolocate telemetry, decode it straight into the history
+        if (PktIn.ID == getGeolocateTelemetryCorePacketID())
+        {
+            GeolocateTelemetry_t *pGeo = geolocateHistoryReserve(&History);
 
-        // Populate some information regarding the image format
-        Info.image_width      = Width;
-        Info.image_height     = Height;
-        Info.input_components = 3;
-        Info.in_color_space   = JCS_RGB;
+            if ((pGeo != NULL) && DecodeGeolocateTelemetry(&PktIn, pGeo))
+                geolocateHistoryCommit(&History);
+        }
+    }
 
-        // Now initialize all the internal stuff to defaults
-        jpeg_set_defaults(&Info);
+}// ProcessTelemetry
 
-        // It's definitely called fastest for a reason... May want to disable this, though, for quality's sake
-        Info.dct_method = JDCT_FASTEST;
+static void GrabSnapshot(int Frame, const double Lla[NLLA], uint64_t TimeStamp)
+{
+    Snapshot_t *pSnapshot = &Pending[Frame % SNAPSHOT_PENDING];
 
-        // Set quality and get to compressin'
-        jpeg_set_quality(&Info, Quality, 1);
-        jpeg_start_compress(&Info, 1);
+    // If an older frame never got paired with telemetry, save it with the KLV position instead of losing it
+    if (pSnapshot->Frame != 0)
+        QueueSnapshot(pSnapshot, Lla, TimeStamp, NULL);
 
-        // Write the EXIF data (if any)
-        WriteExifData(&Info, Lla, TimeStamp);
+    // Take a reference to the frame rather than a copy, the decoder moves on to a new frame of its own
+    if (StreamRefVideoFrame(pStream, pSnapshot->pFrame))
+    {
+        pSnapshot->Frame = Frame;
+        NumPending++;
+    }
+    else
+        printf("\nCouldn't grab frame %d for a snapshot\n", Frame);
 
-        // Allocate a scanline array
-        JSAMPARRAY pScanLines = (JSAMPARRAY)malloc(Height * sizeof(JSAMPROW));
+}// GrabSnapshot
 
-        // For each scanline in the image
-        for (i = 0; i < Height; i++)
-        {
-            // Point this scanline row to the appropriate row in the input data
-            pScanLines[i] = &pData[i * Info.image_width * Info.input_components];
-        }
+static void QueueSnapshot(Snapshot_t *pSnapshot, const double Lla[NLLA], uint64_t TimeStamp, const GeolocateTelemetry_t *pGeo)
+{
+    SnapshotInfo_t Info;
 
-        // Write the JPEG data to disk
-        jpeg_write_scanlines(&Info, pScanLines, Height);
+    // Fill in everything the JPEG writer needs besides the image itself
+    memcpy(Info.Lla, Lla, sizeof(Info.Lla));
+    Info.TimeStamp = TimeStamp;
+    sprintf(Info.Path, "%05d.jpg", pSnapshot->Frame);
 
-        // Free the scanline array
-        free(pScanLines);
+    // Frames that were paired with telemetry take a copy of it along, so they can be draped onto the map
+    Info.pUser = NULL;
+    if ((pGeo != NULL) && ((Info.pUser = malloc(sizeof(GeolocateTelemetry_t))) != NULL))
+        memcpy(Info.pUser, pGeo, sizeof(GeolocateTelemetry_t));
 
-        // Finally, finish and close the file
-        jpeg_finish_compress(&Info);
-        jpeg_destroy_compress(&Info);
-        fclose(pFile);
+    // If the writer is still busy with earlier snapshots, drop this one rather than wait for it
+    if (!SnapshotWriterQueue(pSnapshots, pSnapshot->pFrame, &Info))
+    {
+        printf("\nJPEG writer is busy, dropped %s\n", Info.Path);
+        av_frame_unref(pSnapshot->pFrame);
+        free(Info.pUser);
     }
 
-}// SaveJpeg
+    // Either way, this entry is free for another frame
+    pSnapshot->Frame = 0;
+    NumPending--;
 
-const char *LatLonToString(char *pBuffer, double Radians, char SuffixPos, char SuffixNeg)
-{
-    // Convert from lat/lon to unsigned degrees
-    double Degrees = fabs(degrees(Radians));
+}// QueueSnapshot
 
-    // Split into integer and fractional parts
-    double Integer = (int)Degrees, Fraction = Degrees - Integer;
+static void SnapshotSaved(const SnapshotInfo_t *pInfo, const AVFrame *pFrame, int Saved)
+{
+    // This runs on one of the JPEG writer's threads, so let the user know how it went
+    printf(Saved ? "\nSaved file %s\n" : "\nFailed to save %s\n", pInfo->Path);
 
-    // Finally, format the data as per the XMP spec
-    sprintf(pBuffer, "%.0lf,%.6lf%c", Integer, Fraction * 60.0, (Radians < 0) ? SuffixNeg : SuffixPos);
+    // Frames that were paired with telemetry get an orthorectified copy as well
+    if ((pInfo->pUser != NULL) && (pFrame != NULL))
+        SaveOrthoJpeg(pInfo, pFrame, (const GeolocateTelemetry_t *)pInfo->pUser);
 
-    // Now return a pointer to the buffer that the user passed in
-    return pBuffer;
+    fflush(stdout);
+    free(pInfo->pUser);
 
-}// LatLonToString
+}// SnapshotSaved
 
-static void WriteExifData(struct jpeg_compress_struct *pInfo, const double Lla[NLLA], uint64_t TimeStamp)
+static void SaveOrthoJpeg(const SnapshotInfo_t *pInfo, const AVFrame *pFrame, const GeolocateTelemetry_t *pGeo)
 {
-    // Convert from UNIX microseconds to GPS milliseconds
-    uint64_t GpsTime = TimeStamp / 1000 + (LEAP_SECONDS * 1000) - 315964800000ULL;
-    uint32_t Week = GpsTime / 604800000ULL, Itow = GpsTime - Week * 604800000ULL;
-    uint8_t Month, Day, Hour, Minute, Second;
-    uint16_t Year;
+    // Each writer thread can be draping a frame at once, and the mesh is too big for the stack
+    OrthoMesh_t *pMesh = (OrthoMesh_t *)malloc(sizeof(OrthoMesh_t));
+    OrthoImage_t Image = { NULL, pFrame->width, pFrame->height, pFrame->width * 3, 3 }, Out = { NULL };
+    struct SwsContext *pSwsContext = NULL;
+    OrthoTile_t Tile;
+    char Path[80];
+
+    // The warp works on RGB, so convert the frame first
+    if ((pMesh != NULL) && ((Image.pData = (uint8_t *)malloc((size_t)Image.height * Image.stride)) != NULL) &&
+        ((pSwsContext = sws_getContext(Image.width, Image.height, pFrame->format, Image.width, Image.height,
+                                       AV_PIX_FMT_RGB24, SWS_FAST_BILINEAR, NULL, NULL, NULL)) != NULL))
+    {
+        sws_scale(pSwsContext, (const uint8_t **)pFrame->data, pFrame->linesize, 0, Image.height, &Image.pData, &Image.stride);
 
-    // Now get date and time from the reconstructed GPS time
-    computeDateAndTimeFromWeekAndItow(Week, Itow, LEAP_SECONDS, &Year, &Month, &Day, &Hour, &Minute, &Second);
+        // Geolocate a mesh of points across the frame onto the plane of the image location, there's no terrain model here
+        orthoMeshInit(pMesh, 17, 10);
+        if ((orthoMeshProject(pMesh, pGeo, Image.width, Image.height, 0, 0, NULL) != 0) && orthoTileFit(&Tile, pMesh, 1280))
+        {
+            // Warp the frame onto a north-up tile around its footprint, leaving black wherever the frame doesn't reach
+            Out.width = Tile.width;
+            Out.height = Tile.height;
+            Out.stride = Tile.width * 3;
+            Out.channels = 3;
+            if ((Out.pData = (uint8_t *)calloc((size_t)Out.height * Out.stride, 1)) != NULL)
+            {
+                orthoWarp(pMesh, &Image, &Tile, &Out);
 
-    // Check for valid GPS time
-    if (Year > 2012)
-    {
-        char Exif[4096], Buffer[64];
-        int i = 0;
-
-        // XML header garbage
-        i += sprintf(&Exif[i], "http://ns.adobe.com/xap/1.0/");
-        Exif[i++] = 0;
-        i += sprintf(&Exif[i], "<?xpacket begin='\xef\xbb\xbf' id='W5M0MpCehiHzreSzNTczkc9d'?>\n");
-        i += sprintf(&Exif[i], "<x:xmpmeta xmlns:x='adobe:ns:meta/' x:xmptk='XMP Core 5.4.0'>\n");
-        i += sprintf(&Exif[i], "<rdf:RDF xmlns:rdf='http://www.w3.org/1999/02/22-rdf-syntax-ns#'>\n\n");
-        i += sprintf(&Exif[i], " <rdf:Description rdf:about='' xmlns:exif='http://ns.adobe.com/exif/1.0/'>\n");
-
-        // GPS LLA camera position
-        i += sprintf(&Exif[i], "  <exif:GPSLatitude>%s</exif:GPSLatitude>\n", LatLonToString(Buffer, Lla[LAT], 'N', 'S'));
-        i += sprintf(&Exif[i], "  <exif:GPSLongitude>%s</exif:GPSLongitude>\n", LatLonToString(Buffer, Lla[LON], 'E', 'W'));
-        i += sprintf(&Exif[i], "  <exif:GPSAltitude>%.1lf</exif:GPSAltitude>\n", Lla[ALT]);
-
-        // GPS date/time
-        i += sprintf(&Exif[i],"  <exif:GPSTimeStamp>%u:%02u:%02u %02u:%02u:%02u</exif:GPSTimeStamp>\n", Year, Month, Day, Hour, Minute, Second);
-
-        // XML footer garbage
-        i += sprintf(&Exif[i], " </rdf:Description>\n");
-        i += sprintf(&Exif[i], "</rdf:RDF>\n");
-        i += sprintf(&Exif[i], "</x:xmpmeta>\n");
-
-        // Now write the data to the JPEG file
-        jpeg_write_marker(pInfo, 0xe1, (const uint8_t *)Exif, i);        
+                // Save it next to the original, along with the corners of the tile
+                snprintf(Path, sizeof(Path), "%.*s_ortho.jpg", (int)strlen(pInfo->Path) - 4, pInfo->Path);
+                if (SnapshotSaveRgb(Out.pData, Out.width, Out.height, Out.stride, pInfo->Lla, pInfo->TimeStamp, Path, 75))
+                    printf("Saved file %s, %11.6lf %11.6lf to %11.6lf %11.6lf\n", Path, degrees(Tile.south), degrees(Tile.west), degrees(Tile.north), degrees(Tile.east));
+            }
+        }
     }
 
-}// WriteExifData
+    // Clean up whatever got allocated
+    sws_freeContext(pSwsContext);
+    free(Out.pData);
+    free(Image.pData);
+    free(pMesh);
+
+}// SaveOrthoJpeg
 
 // This function just shuts things down consistently with a nice message for the user
 static void KillProcess(const char *pMessage, int Value)
 {
+    int i;
+
     // Print out the error message that got us here
     printf("%s\n", pMessage);
     fflush(stdout);
 
     // Kill the video stream parser/recorder
-    StreamClose();
+    StreamClose(pStream);
+    pStream = NULL;
+
+    // Stop capturing telemetry and finish off the capture file
+    if (Capturing)
+    {
+        OrionCommRecord(NULL, 0);
+        OrionCommCaptureFinish(&Capture);
+        Capturing = 0;
+    }
+
+    // Let the JPEG writer finish any snapshots it has queued up, and let go of any still waiting for telemetry
+    SnapshotWriterClose(pSnapshots);
+    pSnapshots = NULL;
+
+    for (i = 0; i < SNAPSHOT_PENDING; i++)
+        av_frame_free(&Pending[i].pFrame);
 
     // Close down the active file descriptors
     OrionCommClose();
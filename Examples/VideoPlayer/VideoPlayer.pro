@@ -7,7 +7,13 @@ SOURCES += VideoPlayer.c \
     FFmpeg.c \
     KlvParser.c \
     KlvTree.c \
-    StreamDecoder.c
+    KlvStream.c \
+    KlvEncoder.c \
+    StreamDecoder.c \
+    FrameSync.c \
+    SpscQueue.c \
+    Snapshot.c \
+    RecordIndex.c
 
 INCLUDEPATH += ../../Communications \
     ../../Utils
@@ -20,4 +26,6 @@ CONFIG(debug, debug|release) {
 
 LIBS += -lOrionComm -lOrionUtils -lavutil -lavcodec -lavformat -lswscale -ljpeg
 
+unix:LIBS += -lpthread
+
 win32:LIBS += -lws2_32
@@ -0,0 +1,67 @@
+# Windows port of GenerateOrionCpp.sh - builds OrionPublicTraits.hpp, compile time traits for every
+#  packet structure that OrionComm.hpp uses, from the declarations in ProtoGen's OrionPublicPacket.h
+
+param([string]$OutDir = (Join-Path $PSScriptRoot "Communications"))
+
+$Header = Join-Path $OutDir "OrionPublicPacket.h"
+
+if (-not (Test-Path $Header)) {
+    Write-Output "$Header not found, run ProtoGen first"
+    exit 1
+}
+
+$Names = @()
+$Types = @{}
+$Encodes = @{}
+$Defines = @{}
+
+foreach ($Line in Get-Content $Header) {
+    # int decodeXxxPacketStructure(const void* pkt, Xxx_t* user);
+    if ($Line -match '^int decode([A-Za-z0-9_]*)PacketStructure\(const void\* pkt, ([A-Za-z0-9_]*)\* user\);') {
+        $Names += $Matches[1]
+        $Types[$Matches[1]] = $Matches[2]
+    }
+    # void encodeXxxPacketStructure(void* pkt, const Xxx_t* user);
+    elseif ($Line -match '^void encode([A-Za-z0-9_]*)PacketStructure\(void\* pkt, const [A-Za-z0-9_]*\* user\);') {
+        $Encodes[$Matches[1]] = 1
+    }
+    # #define getXxxPacketID() (ORION_PKT_XXX), and likewise for the min and max lengths
+    elseif ($Line -match '^#define get([A-Za-z0-9_]*(PacketID|MinDataLength|MaxDataLength))\(\) (.*)$') {
+        $Defines[$Matches[1]] = $Matches[3]
+    }
+}
+
+$H = @(
+    "// OrionPublicTraits.hpp was generated by GenerateOrionCpp.ps1 from OrionPublicPacket.h", "",
+    "#ifndef _ORIONPUBLICTRAITS_HPP", "#define _ORIONPUBLICTRAITS_HPP", "",
+    "#include `"OrionPublicPacketShim.h`"", "",
+    "namespace orion", "{", "",
+    "//! Compile time description of a packet structure, only defined for types that are packets",
+    "template <typename T> struct PacketTraits;", "")
+
+# Structures that are shared between packets only get traits for the first one
+$Used = @{}
+foreach ($Name in $Names) {
+    $Type = $Types[$Name]
+    if (-not $Defines[$Name + "PacketID"] -or $Used.ContainsKey($Type)) { continue }
+
+    $Used[$Type] = 1
+    $CanEncode = if ($Encodes.ContainsKey($Name)) { "true" } else { "false" }
+    $H += @("//! $Name packet", "template <> struct PacketTraits<$Type>", "{",
+        "    static constexpr UInt8 ID = $($Defines[$Name + 'PacketID']);",
+        "    static constexpr UInt16 MinLength = $($Defines[$Name + 'MinDataLength']);",
+        "    static constexpr UInt16 MaxLength = $($Defines[$Name + 'MaxDataLength']);",
+        "    static constexpr bool CanEncode = $CanEncode;",
+        "    static constexpr const char *Name = `"$Name`";", "",
+        "    static bool decode(const void *pPkt, $Type *pUser) { return decode$($Name)PacketStructure(pPkt, pUser) != 0; }")
+    if ($Encodes.ContainsKey($Name)) {
+        $H += "    static void encode(void *pPkt, const $Type *pUser) { encode$($Name)PacketStructure(pPkt, pUser); }"
+    }
+    $H += @("};", "")
+}
+
+$H += @("} // namespace orion", "", "#endif // _ORIONPUBLICTRAITS_HPP")
+
+Set-Content -Path (Join-Path $OutDir "OrionPublicTraits.hpp") -Value $H
+
+Write-Output "Generated $(Join-Path $OutDir 'OrionPublicTraits.hpp')"
@@ -0,0 +1,71 @@
+#!/bin/sh
+
+# Builds OrionPublicTraits.hpp, compile time traits for every packet structure that the C++ layer in
+#  OrionComm.hpp uses to encode and decode packets, from the declarations in ProtoGen's OrionPublicPacket.h
+
+ROOT_DIR=`dirname $0`
+OUT_DIR=${1:-$ROOT_DIR/Communications}
+
+if [ ! -f $OUT_DIR/OrionPublicPacket.h ]; then
+    echo "$OUT_DIR/OrionPublicPacket.h not found, run ProtoGen first"
+    exit 1
+fi
+
+awk -v HEADER="$OUT_DIR/OrionPublicTraits.hpp" '
+# int decodeXxxPacketStructure(const void* pkt, Xxx_t* user);
+/^int decode[A-Za-z0-9_]*PacketStructure\(const void\* pkt, [A-Za-z0-9_]*\* user\);/ {
+    Name = $2; sub(/^decode/, "", Name); sub(/PacketStructure\(.*$/, "", Name)
+    Type = $5; sub(/\*$/, "", Type)
+    Names[Count++] = Name
+    Types[Name] = Type
+}
+
+# void encodeXxxPacketStructure(void* pkt, const Xxx_t* user);
+/^void encode[A-Za-z0-9_]*PacketStructure\(void\* pkt, const [A-Za-z0-9_]*\* user\);/ {
+    Name = $2; sub(/^encode/, "", Name); sub(/PacketStructure\(.*$/, "", Name)
+    Encodes[Name] = 1
+}
+
+# #define getXxxPacketID() (ORION_PKT_XXX), and likewise for the min and max lengths
+/^#define get[A-Za-z0-9_]*(PacketID|MinDataLength|MaxDataLength)\(\) / {
+    Name = $2; sub(/^get/, "", Name); sub(/\(\)$/, "", Name)
+    Value = $0; sub(/^#define [^ ]* /, "", Value)
+    Defines[Name] = Value
+}
+
+END {
+    print "// OrionPublicTraits.hpp was generated by GenerateOrionCpp.sh from OrionPublicPacket.h\n" > HEADER
+    print "#ifndef _ORIONPUBLICTRAITS_HPP" > HEADER
+    print "#define _ORIONPUBLICTRAITS_HPP\n" > HEADER
+    print "#include \"OrionPublicPacketShim.h\"\n" > HEADER
+    print "namespace orion\n{\n" > HEADER
+    print "//! Compile time description of a packet structure, only defined for types that are packets" > HEADER
+    print "template <typename T> struct PacketTraits;\n" > HEADER
+
+    # Structures that are shared between packets only get traits for the first one
+    for (i = 0; i < Count; i++)
+    {
+        Name = Names[i]
+        Type = Types[Name]
+        if ((Defines[Name "PacketID"] == "") || (Type in Used))
+            continue
+
+        Used[Type] = 1
+        printf "//! %s packet\n", Name > HEADER
+        printf "template <> struct PacketTraits<%s>\n{\n", Type > HEADER
+        printf "    static constexpr UInt8 ID = %s;\n", Defines[Name "PacketID"] > HEADER
+        printf "    static constexpr UInt16 MinLength = %s;\n", Defines[Name "MinDataLength"] > HEADER
+        printf "    static constexpr UInt16 MaxLength = %s;\n", Defines[Name "MaxDataLength"] > HEADER
+        printf "    static constexpr bool CanEncode = %s;\n", (Name in Encodes) ? "true" : "false" > HEADER
+        printf "    static constexpr const char *Name = \"%s\";\n\n", Name > HEADER
+        printf "    static bool decode(const void *pPkt, %s *pUser) { return decode%sPacketStructure(pPkt, pUser) != 0; }\n", Type, Name > HEADER
+        if (Name in Encodes)
+            printf "    static void encode(void *pPkt, const %s *pUser) { encode%sPacketStructure(pPkt, pUser); }\n", Type, Name > HEADER
+        print "};\n" > HEADER
+    }
+
+    print "} // namespace orion\n" > HEADER
+    print "#endif // _ORIONPUBLICTRAITS_HPP" > HEADER
+}' $OUT_DIR/OrionPublicPacket.h
+
+echo "Generated $OUT_DIR/OrionPublicTraits.hpp"
@@ -0,0 +1,94 @@
+# Windows port of GenerateOrionDispatch.sh - builds OrionPublicDispatch.c/.h, a lookup table
+#  indexed by packet ID, from the structure decode functions in ProtoGen's OrionPublicPacket.h
+
+param([string]$OutDir = (Join-Path $PSScriptRoot "Communications"))
+
+$Header = Join-Path $OutDir "OrionPublicPacket.h"
+
+if (-not (Test-Path $Header)) {
+    Write-Output "$Header not found, run ProtoGen first"
+    exit 1
+}
+
+$Names = @()
+$Types = @{}
+$Defines = @{}
+
+foreach ($Line in Get-Content $Header) {
+    # int decodeXxxPacketStructure(const void* pkt, Xxx_t* user);
+    if ($Line -match '^int decode([A-Za-z0-9_]*)PacketStructure\(const void\* pkt, ([A-Za-z0-9_]*)\* user\);') {
+        $Names += $Matches[1]
+        $Types[$Matches[1]] = $Matches[2]
+    }
+    # #define getXxxPacketID() (ORION_PKT_XXX), and likewise for the min and max lengths
+    elseif ($Line -match '^#define get([A-Za-z0-9_]*(PacketID|MinDataLength|MaxDataLength))\(\) (.*)$') {
+        $Defines[$Matches[1]] = $Matches[3]
+    }
+}
+
+# Some IDs have more than one structure (e.g. byte-wise settings), the first one listed wins
+$Used = @{}
+$Entries = @()
+foreach ($Name in $Names) {
+    $Id = $Defines[$Name + "PacketID"]
+    if ($Id -and -not $Used.ContainsKey($Id)) {
+        $Used[$Id] = 1
+        $Entries += $Name
+    }
+}
+
+$H = @(
+    "// OrionPublicDispatch.h was generated by GenerateOrionDispatch.ps1 from OrionPublicPacket.h", "",
+    "#ifndef _ORIONPUBLICDISPATCH_H", "#define _ORIONPUBLICDISPATCH_H", "",
+    "#include `"OrionPublicPacketShim.h`"", "",
+    "// C++ compilers: don't mangle us", "#ifdef __cplusplus", "extern `"C`" {", "#endif", "",
+    "//! Decodes a packet into the structure type for its ID",
+    "typedef int (*OrionDispatchDecode_t)(const void *pPkt, void *pData);", "",
+    "//! Callback for packets routed by OrionDispatch, pData is NULL for IDs without a structure decoder",
+    "typedef void (*OrionDispatchCallback_t)(const OrionPkt_t *pPkt, const void *pData, void *pUser);", "",
+    "//! One entry in the packet ID dispatch table", "typedef struct", "{",
+    "    OrionDispatchDecode_t pDecode;     //!< Structure decode function for this ID, or NULL",
+    "    UInt16 MinLength;                  //!< Minimum encoded data length",
+    "    UInt16 MaxLength;                  //!< Maximum encoded data length",
+    "    OrionDispatchCallback_t pCallback; //!< User callback for this ID, or NULL",
+    "    void *pUser;                       //!< User pointer passed to the callback",
+    "}OrionDispatchEntry_t;", "",
+    "//! Storage for any structure that OrionDispatch can decode", "typedef union", "{")
+foreach ($Name in $Names) { $H += "    $($Types[$Name]) $Name;" }
+$H += @("}OrionDispatchData_t;", "",
+    "//! Dispatch table, indexed by packet ID", "extern OrionDispatchEntry_t OrionDispatchTable[256];", "",
+    "//! Set the callback for a packet ID",
+    "void OrionDispatchSetCallback(UInt8 ID, OrionDispatchCallback_t pCallback, void *pUser);", "",
+    "//! Decode a packet and hand it to the callback for its ID", "BOOL OrionDispatch(const OrionPkt_t *pPkt);", "",
+    "#ifdef __cplusplus", "}", "#endif", "", "#endif // _ORIONPUBLICDISPATCH_H")
+
+$C = @("// OrionPublicDispatch.c was generated by GenerateOrionDispatch.ps1 from OrionPublicPacket.h", "",
+    "#include `"OrionPublicDispatch.h`"", "")
+
+# Thin wrappers give every decode function the same signature
+foreach ($Name in $Entries) {
+    $C += @("static int dispatchDecode$Name(const void *pPkt, void *pData)", "{",
+        "    return decode$($Name)PacketStructure(pPkt, ($($Types[$Name]) *)pData);", "}", "")
+}
+
+$C += @("OrionDispatchEntry_t OrionDispatchTable[256] =", "{")
+foreach ($Name in $Entries) {
+    $C += "    [$($Defines[$Name + 'PacketID'])] = { dispatchDecode$Name, $($Defines[$Name + 'MinDataLength']), $($Defines[$Name + 'MaxDataLength']) },"
+}
+$C += @("};", "",
+    "void OrionDispatchSetCallback(UInt8 ID, OrionDispatchCallback_t pCallback, void *pUser)", "{",
+    "    OrionDispatchTable[ID].pCallback = pCallback;", "    OrionDispatchTable[ID].pUser = pUser;", "}", "",
+    "BOOL OrionDispatch(const OrionPkt_t *pPkt)", "{",
+    "    const OrionDispatchEntry_t *pEntry = &OrionDispatchTable[pPkt->ID];", "    OrionDispatchData_t Data;", "",
+    "    // Nobody cares about this packet", "    if (pEntry->pCallback == NULL)", "        return FALSE;", "",
+    "    // Packets without a structure decoder get passed through undecoded",
+    "    if (pEntry->pDecode == NULL)", "        pEntry->pCallback(pPkt, NULL, pEntry->pUser);",
+    "    // Otherwise reject bad lengths up front, then decode into the structure for this ID",
+    "    else if ((pPkt->Length >= pEntry->MinLength) && (pPkt->Length <= pEntry->MaxLength) && pEntry->pDecode(pPkt, &Data))",
+    "        pEntry->pCallback(pPkt, &Data, pEntry->pUser);", "    else", "        return FALSE;", "",
+    "    return TRUE;", "}")
+
+Set-Content -Path (Join-Path $OutDir "OrionPublicDispatch.h") -Value $H
+Set-Content -Path (Join-Path $OutDir "OrionPublicDispatch.c") -Value $C
+
+Write-Output "Generated $(Join-Path $OutDir 'OrionPublicDispatch.c')"
@@ -0,0 +1,110 @@
+#!/bin/sh
+
+# Builds OrionPublicDispatch.c/.h, a lookup table indexed by packet ID, from the
+#  structure decode functions, packet IDs and lengths in ProtoGen's OrionPublicPacket.h
+
+ROOT_DIR=`dirname $0`
+OUT_DIR=${1:-$ROOT_DIR/Communications}
+
+if [ ! -f $OUT_DIR/OrionPublicPacket.h ]; then
+    echo "$OUT_DIR/OrionPublicPacket.h not found, run ProtoGen first"
+    exit 1
+fi
+
+awk -v HEADER="$OUT_DIR/OrionPublicDispatch.h" -v SOURCE="$OUT_DIR/OrionPublicDispatch.c" '
+# int decodeXxxPacketStructure(const void* pkt, Xxx_t* user);
+/^int decode[A-Za-z0-9_]*PacketStructure\(const void\* pkt, [A-Za-z0-9_]*\* user\);/ {
+    Name = $2; sub(/^decode/, "", Name); sub(/PacketStructure\(.*$/, "", Name)
+    Type = $5; sub(/\*$/, "", Type)
+    Names[Count++] = Name
+    Types[Name] = Type
+}
+
+# #define getXxxPacketID() (ORION_PKT_XXX), and likewise for the min and max lengths
+/^#define get[A-Za-z0-9_]*(PacketID|MinDataLength|MaxDataLength)\(\) / {
+    Name = $2; sub(/^get/, "", Name); sub(/\(\)$/, "", Name)
+    Value = $0; sub(/^#define [^ ]* /, "", Value)
+    Defines[Name] = Value
+}
+
+END {
+    print "// OrionPublicDispatch.h was generated by GenerateOrionDispatch.sh from OrionPublicPacket.h\n" > HEADER
+    print "#ifndef _ORIONPUBLICDISPATCH_H" > HEADER
+    print "#define _ORIONPUBLICDISPATCH_H\n" > HEADER
+    print "#include \"OrionPublicPacketShim.h\"\n" > HEADER
+    print "// C++ compilers: don'"'"'t mangle us" > HEADER
+    print "#ifdef __cplusplus\nextern \"C\" {\n#endif\n" > HEADER
+    print "//! Decodes a packet into the structure type for its ID" > HEADER
+    print "typedef int (*OrionDispatchDecode_t)(const void *pPkt, void *pData);\n" > HEADER
+    print "//! Callback for packets routed by OrionDispatch, pData is NULL for IDs without a structure decoder" > HEADER
+    print "typedef void (*OrionDispatchCallback_t)(const OrionPkt_t *pPkt, const void *pData, void *pUser);\n" > HEADER
+    print "//! One entry in the packet ID dispatch table" > HEADER
+    print "typedef struct\n{" > HEADER
+    print "    OrionDispatchDecode_t pDecode;     //!< Structure decode function for this ID, or NULL" > HEADER
+    print "    UInt16 MinLength;                  //!< Minimum encoded data length" > HEADER
+    print "    UInt16 MaxLength;                  //!< Maximum encoded data length" > HEADER
+    print "    OrionDispatchCallback_t pCallback; //!< User callback for this ID, or NULL" > HEADER
+    print "    void *pUser;                       //!< User pointer passed to the callback" > HEADER
+    print "}OrionDispatchEntry_t;\n" > HEADER
+    print "//! Storage for any structure that OrionDispatch can decode" > HEADER
+    print "typedef union\n{" > HEADER
+    for (i = 0; i < Count; i++)
+        printf "    %s %s;\n", Types[Names[i]], Names[i] > HEADER
+    print "}OrionDispatchData_t;\n" > HEADER
+    print "//! Dispatch table, indexed by packet ID" > HEADER
+    print "extern OrionDispatchEntry_t OrionDispatchTable[256];\n" > HEADER
+    print "//! Set the callback for a packet ID" > HEADER
+    print "void OrionDispatchSetCallback(UInt8 ID, OrionDispatchCallback_t pCallback, void *pUser);\n" > HEADER
+    print "//! Decode a packet and hand it to the callback for its ID" > HEADER
+    print "BOOL OrionDispatch(const OrionPkt_t *pPkt);\n" > HEADER
+    print "#ifdef __cplusplus\n}\n#endif\n" > HEADER
+    print "#endif // _ORIONPUBLICDISPATCH_H" > HEADER
+
+    print "// OrionPublicDispatch.c was generated by GenerateOrionDispatch.sh from OrionPublicPacket.h\n" > SOURCE
+    print "#include \"OrionPublicDispatch.h\"\n" > SOURCE
+
+    # Some IDs have more than one structure (e.g. byte-wise settings), the first one listed wins
+    for (i = 0; i < Count; i++)
+    {
+        Id = Defines[Names[i] "PacketID"]
+        if ((Id != "") && !(Id in Used))
+        {
+            Used[Id] = 1
+            Entries[NumEntries++] = Names[i]
+        }
+    }
+
+    # Thin wrappers give every decode function the same signature
+    for (i = 0; i < NumEntries; i++)
+    {
+        Name = Entries[i]
+        printf "static int dispatchDecode%s(const void *pPkt, void *pData)\n{\n", Name > SOURCE
+        printf "    return decode%sPacketStructure(pPkt, (%s *)pData);\n}\n\n", Name, Types[Name] > SOURCE
+    }
+
+    print "OrionDispatchEntry_t OrionDispatchTable[256] =\n{" > SOURCE
+    for (i = 0; i < NumEntries; i++)
+    {
+        Name = Entries[i]
+        printf "    [%s] = { dispatchDecode%s, %s, %s },\n", Defines[Name "PacketID"], Name, Defines[Name "MinDataLength"], Defines[Name "MaxDataLength"] > SOURCE
+    }
+    print "};\n" > SOURCE
+
+    print "void OrionDispatchSetCallback(UInt8 ID, OrionDispatchCallback_t pCallback, void *pUser)\n{" > SOURCE
+    print "    OrionDispatchTable[ID].pCallback = pCallback;" > SOURCE
+    print "    OrionDispatchTable[ID].pUser = pUser;\n}\n" > SOURCE
+    print "BOOL OrionDispatch(const OrionPkt_t *pPkt)\n{" > SOURCE
+    print "    const OrionDispatchEntry_t *pEntry = &OrionDispatchTable[pPkt->ID];" > SOURCE
+    print "    OrionDispatchData_t Data;\n" > SOURCE
+    print "    // Nobody cares about this packet" > SOURCE
+    print "    if (pEntry->pCallback == NULL)\n        return FALSE;\n" > SOURCE
+    print "    // Packets without a structure decoder get passed through undecoded" > SOURCE
+    print "    if (pEntry->pDecode == NULL)\n        pEntry->pCallback(pPkt, NULL, pEntry->pUser);" > SOURCE
+    print "    // Otherwise reject bad lengths up front, then decode into the structure for this ID" > SOURCE
+    print "    else if ((pPkt->Length >= pEntry->MinLength) && (pPkt->Length <= pEntry->MaxLength) && pEntry->pDecode(pPkt, &Data))" > SOURCE
+    print "        pEntry->pCallback(pPkt, &Data, pEntry->pUser);" > SOURCE
+    print "    else\n        return FALSE;\n" > SOURCE
+    print "    return TRUE;\n}" > SOURCE
+}' $OUT_DIR/OrionPublicPacket.h
+
+echo "Generated $OUT_DIR/OrionPublicDispatch.c"
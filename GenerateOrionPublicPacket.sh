@@ -2,5 +2,5 @@
 
 ROOT_DIR=`dirname $0`
 
-$ROOT_DIR/Protogen/Protogen.sh $ROOT_DIR/Communications/OrionPublicProtocol.xml $ROOT_DIR/Communications -no-doxygen
+$ROOT_DIR/Protogen/Protogen.sh $ROOT_DIR/Communications/OrionPublicProtocol.xml $ROOT_DIR/Communications -no-doxygen && $ROOT_DIR/GenerateOrionDispatch.sh $ROOT_DIR/Communications && $ROOT_DIR/GenerateOrionCpp.sh $ROOT_DIR/Communications
 
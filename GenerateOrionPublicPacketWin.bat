@@ -1,3 +1,5 @@
 set ROOT=%~dp0
 "%ROOT%\Protogen\Windows\ProtoGen.exe" "%ROOT%\Communications\OrionPublicProtocol.xml" "%ROOT%\Communications" -no-doxygen
+powershell -NoProfile -ExecutionPolicy Bypass -File "%ROOT%\GenerateOrionDispatch.ps1" "%ROOT%\Communications"
+powershell -NoProfile -ExecutionPolicy Bypass -File "%ROOT%\GenerateOrionCpp.ps1" "%ROOT%\Communications"
 exit /b 0
@@ -0,0 +1,113 @@
+#ifndef ATOMICS_H
+#define ATOMICS_H
+
+/*!
+ * \file
+ * Loads and stores of 32 and 64 bit words that threads share without a lock.
+ * An acquire load keeps everything after it from moving ahead of it, and a
+ * release store keeps everything before it from moving past it, so a thread
+ * that fills in some data and then publishes an index with a release store
+ * only lets a thread that reads the index with an acquire load see it once
+ * the data is there. Relaxed accesses are single, untorn accesses with no
+ * ordering, for counters that another thread only takes snapshots of.
+ *
+ * GCC and clang use their __atomic builtins. MSVC uses the __iso_volatile
+ * intrinsics, which are plain accesses whatever /volatile is set to, with
+ * explicit barriers: a compiler barrier on x86 and x64, which already keep
+ * loads and stores in this order, and a dmb on ARM and ARM64, where the
+ * default of /volatile:iso gives volatile accesses no ordering at all. 64 bit
+ * accesses go through cmpxchg8b on 32 bit x86 and ldrexd on 32 bit ARM, which
+ * have no plain 64 bit access that can't tear. Any other compiler gets plain
+ * volatile accesses, which is only enough for single core targets.
+ */
+
+#include <stdint.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// C++ compilers: don't mangle us
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Size in bytes of a cache line, which indices written by different threads are padded apart by
+#define ATOMIC_CACHE_LINE 64
+
+#if defined(__GNUC__) || defined(__clang__)
+
+static __inline uint32_t atomicLoadAcquire32(const volatile uint32_t *p) { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+static __inline void atomicStoreRelease32(volatile uint32_t *p, uint32_t v) { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+static __inline uint32_t atomicLoadRelaxed32(const volatile uint32_t *p) { return __atomic_load_n(p, __ATOMIC_RELAXED); }
+static __inline void atomicStoreRelaxed32(volatile uint32_t *p, uint32_t v) { __atomic_store_n(p, v, __ATOMIC_RELAXED); }
+static __inline uint64_t atomicLoadRelaxed64(const volatile uint64_t *p) { return __atomic_load_n(p, __ATOMIC_RELAXED); }
+static __inline void atomicStoreRelaxed64(volatile uint64_t *p, uint64_t v) { __atomic_store_n(p, v, __ATOMIC_RELAXED); }
+
+#elif defined(_MSC_VER)
+
+#if defined(_M_ARM64)
+# define atomicBarrier() __dmb(_ARM64_BARRIER_ISH)
+#elif defined(_M_ARM)
+# define atomicBarrier() __dmb(_ARM_BARRIER_ISH)
+#else
+# define atomicBarrier() _ReadWriteBarrier()
+#endif
+
+static __inline uint32_t atomicLoadAcquire32(const volatile uint32_t *p)
+{
+    uint32_t v = (uint32_t)__iso_volatile_load32((const volatile __int32 *)p);
+    atomicBarrier();
+    return v;
+}
+
+static __inline void atomicStoreRelease32(volatile uint32_t *p, uint32_t v)
+{
+    atomicBarrier();
+    __iso_volatile_store32((volatile __int32 *)p, (__int32)v);
+}
+
+static __inline uint32_t atomicLoadRelaxed32(const volatile uint32_t *p) { return (uint32_t)__iso_volatile_load32((const volatile __int32 *)p); }
+static __inline void atomicStoreRelaxed32(volatile uint32_t *p, uint32_t v) { __iso_volatile_store32((volatile __int32 *)p, (__int32)v); }
+
+#if defined(_M_IX86) || defined(_M_ARM)
+
+static __inline uint64_t atomicLoadRelaxed64(const volatile uint64_t *p)
+{
+    // Comparing against zero and swapping in zero only ever changes a zero, so this is just a load
+    return (uint64_t)_InterlockedCompareExchange64((volatile __int64 *)p, 0, 0);
+}
+
+static __inline void atomicStoreRelaxed64(volatile uint64_t *p, uint64_t v)
+{
+    __int64 Old = (__int64)atomicLoadRelaxed64(p);
+    __int64 Seen;
+
+    // Keep swapping until nothing else got in between the load and the swap
+    while ((Seen = _InterlockedCompareExchange64((volatile __int64 *)p, (__int64)v, Old)) != Old)
+        Old = Seen;
+}
+
+#else
+
+static __inline uint64_t atomicLoadRelaxed64(const volatile uint64_t *p) { return (uint64_t)__iso_volatile_load64((const volatile __int64 *)p); }
+static __inline void atomicStoreRelaxed64(volatile uint64_t *p, uint64_t v) { __iso_volatile_store64((volatile __int64 *)p, (__int64)v); }
+
+#endif // _M_IX86 || _M_ARM
+
+#else
+
+static __inline uint32_t atomicLoadAcquire32(const volatile uint32_t *p) { return *p; }
+static __inline void atomicStoreRelease32(volatile uint32_t *p, uint32_t v) { *p = v; }
+static __inline uint32_t atomicLoadRelaxed32(const volatile uint32_t *p) { return *p; }
+static __inline void atomicStoreRelaxed32(volatile uint32_t *p, uint32_t v) { *p = v; }
+static __inline uint64_t atomicLoadRelaxed64(const volatile uint64_t *p) { return *p; }
+static __inline void atomicStoreRelaxed64(volatile uint64_t *p, uint64_t v) { *p = v; }
+
+#endif // __GNUC__ || __clang__
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ATOMICS_H
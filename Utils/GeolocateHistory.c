@@ -0,0 +1,407 @@
+#include "GeolocateHistory.h"
+#include "mathutilities.h"
+#include "earthrotation.h"
+#include "linearalgebra.h"
+#include "quaternion.h"
+#include <string.h>
+
+static uint32_t trimHistory(GeolocateHistory_t *pHist, uint32_t *pTail);
+static uint32_t searchHistory(const GeolocateHistory_t *pHist, uint32_t Tail, uint32_t Head, uint32_t systemTime);
+static float interpolateAnglef(float first, float second, float t);
+
+/*!
+ * Initialize a geolocate history over user supplied storage
+ * \param pHist is the history to initialize
+ * \param pEntries is storage for Capacity entries, which must outlive the history
+ * \param Capacity is the number of entries, which must be a power of two and at least 4
+ * \param RetainMs is the milliseconds of history behind the newest entry that
+ *        the consumer keeps, or 0 to keep as much as fits
+ * \return TRUE if the history was initialized, FALSE if Capacity isn't valid
+ */
+BOOL geolocateHistoryInit(GeolocateHistory_t *pHist, GeolocateTelemetry_t *pEntries, uint32_t Capacity, uint32_t RetainMs)
+{
+    memset(pHist, 0, sizeof(GeolocateHistory_t));
+
+    // The ring checks for a power of two, the consumer needs a few entries to keep a quarter free
+    if ((Capacity < 4) || !spscRingInit(&pHist->Ring, Capacity))
+        return FALSE;
+
+    pHist->pEntries = pEntries;
+    pHist->RetainMs = RetainMs;
+
+    return TRUE;
+
+}// geolocateHistoryInit
+
+
+/*!
+ * Get the entry that the next call to geolocateHistoryCommit() will publish,
+ * so the producer can decode straight into the history. Only the producer
+ * thread may call this.
+ * \param pHist is the history
+ * \return the next entry, or NULL if the ring is full
+ */
+GeolocateTelemetry_t *geolocateHistoryReserve(GeolocateHistory_t *pHist)
+{
+    uint32_t Head;
+
+    // Never hand out an entry that the consumer hasn't released
+    if (!spscRingReserve(&pHist->Ring, &Head))
+        return NULL;
+
+    return &pHist->pEntries[Head & pHist->Ring.Mask];
+
+}// geolocateHistoryReserve
+
+
+/*!
+ * Publish the entry returned by geolocateHistoryReserve() to the consumer.
+ * Only the producer thread may call this.
+ * \param pHist is the history
+ */
+void geolocateHistoryCommit(GeolocateHistory_t *pHist)
+{
+    spscRingCommit(&pHist->Ring);
+
+}// geolocateHistoryCommit
+
+
+/*!
+ * Copy a geolocate telemetry structure into the history. Only the producer
+ * thread may call this.
+ * \param pHist is the history
+ * \param pGeo is the telemetry to add, which must be no older than the last one added
+ * \return TRUE if the telemetry was added, FALSE if the ring was full and it was dropped
+ */
+BOOL geolocateHistoryPush(GeolocateHistory_t *pHist, const GeolocateTelemetry_t *pGeo)
+{
+    GeolocateTelemetry_t *pEntry = geolocateHistoryReserve(pHist);
+
+    if (pEntry == NULL)
+        return FALSE;
+
+    copyGeolocateTelemetry(pGeo, pEntry);
+    geolocateHistoryCommit(pHist);
+
+    return TRUE;
+
+}// geolocateHistoryPush
+
+
+/*!
+ * Release the entries that the consumer no longer needs and get the range of
+ * entries that remain.
+ * \param pHist is the history
+ * \param pTail receives the index of the oldest entry
+ * \return the index one past the newest entry
+ */
+static uint32_t trimHistory(GeolocateHistory_t *pHist, uint32_t *pTail)
+{
+    uint32_t Head = spscRingHead(&pHist->Ring);
+    uint32_t Tail = pHist->Ring.Tail;
+    uint32_t Keep = pHist->Ring.Mask + 1 - (pHist->Ring.Mask + 1)/4;
+    uint32_t Newest;
+
+    if (Head == Tail)
+    {
+        *pTail = Tail;
+        return Head;
+    }
+
+    Newest = pHist->pEntries[(Head - 1) & pHist->Ring.Mask].base.systemTime;
+
+    while (Head - Tail > 1)
+    {
+        // Time from this entry, and the one after it, to the newest entry
+        int32_t Age = (int32_t)(Newest - pHist->pEntries[Tail & pHist->Ring.Mask].base.systemTime);
+        int32_t NextAge = (int32_t)(Newest - pHist->pEntries[(Tail + 1) & pHist->Ring.Mask].base.systemTime);
+
+        // Entries from the "future" are from before the system time went backwards
+        if (Age < 0)
+            Tail++;
+        // Leave the producer room to work
+        else if (Head - Tail > Keep)
+            Tail++;
+        // Keep one entry at or beyond the retention span, so it can be interpolated against
+        else if ((pHist->RetainMs != 0) && (NextAge >= (int32_t)pHist->RetainMs))
+            Tail++;
+        else
+            break;
+    }
+
+    // Hand the released entries back to the producer
+    if (Tail != pHist->Ring.Tail)
+        spscRingRelease(&pHist->Ring, Tail);
+
+    *pTail = Tail;
+    return Head;
+
+}// trimHistory
+
+
+/*!
+ * Binary search the history for the newest entry at or before a system time
+ * \param pHist is the history
+ * \param Tail is the index of the oldest entry
+ * \param Head is the index one past the newest entry
+ * \param systemTime is the system time to search for in milliseconds
+ * \return the index of the entry, or Head if every entry is newer than systemTime
+ */
+static uint32_t searchHistory(const GeolocateHistory_t *pHist, uint32_t Tail, uint32_t Head, uint32_t systemTime)
+{
+    // Search by offset from the tail, since the indices themselves can wrap
+    uint32_t Low = 0, High = Head - Tail;
+
+    // Find the first entry newer than systemTime. Times are compared by
+    // difference so that the search works across the 32-bit wrap.
+    while (Low < High)
+    {
+        uint32_t Mid = Low + (High - Low)/2;
+
+        if ((int32_t)(pHist->pEntries[(Tail + Mid) & pHist->Ring.Mask].base.systemTime - systemTime) <= 0)
+            Low = Mid + 1;
+        else
+            High = Mid;
+    }
+
+    // The entry before that is the one we want
+    return (Low == 0) ? Head : Tail + Low - 1;
+
+}// searchHistory
+
+
+/*!
+ * Get the number of entries available to the consumer. Only the consumer
+ * thread may call this.
+ * \param pHist is the history
+ * \return the number of entries
+ */
+uint32_t geolocateHistoryCount(GeolocateHistory_t *pHist)
+{
+    uint32_t Tail, Head = trimHistory(pHist, &Tail);
+
+    return Head - Tail;
+
+}// geolocateHistoryCount
+
+
+/*!
+ * Get an entry by its age. Only the consumer thread may call this, and the
+ * returned entry is valid until its next call into the history.
+ * \param pHist is the history
+ * \param Age is the number of entries back from the newest, 0 being the newest
+ * \return the entry, or NULL if there aren't that many entries
+ */
+const GeolocateTelemetry_t *geolocateHistoryGet(GeolocateHistory_t *pHist, uint32_t Age)
+{
+    uint32_t Tail, Head = trimHistory(pHist, &Tail);
+
+    if (Age >= Head - Tail)
+        return NULL;
+
+    return &pHist->pEntries[(Head - 1 - Age) & pHist->Ring.Mask];
+
+}// geolocateHistoryGet
+
+
+/*!
+ * Get the newest entry at or before a system time. Only the consumer thread
+ * may call this, and the returned entry is valid until its next call into
+ * the history.
+ * \param pHist is the history
+ * \param systemTime is the system time in milliseconds
+ * \return the entry, or NULL if every entry is newer than systemTime
+ */
+const GeolocateTelemetry_t *geolocateHistoryFind(GeolocateHistory_t *pHist, uint32_t systemTime)
+{
+    uint32_t Tail, Head = trimHistory(pHist, &Tail);
+    uint32_t Index = searchHistory(pHist, Tail, Head, systemTime);
+
+    if (Index == Head)
+        return NULL;
+
+    return &pHist->pEntries[Index & pHist->Ring.Mask];
+
+}// geolocateHistoryFind
+
+
+/*!
+ * Get the newest entry that is at least dt milliseconds older than the newest
+ * entry. Only the consumer thread may call this, and the returned entry is
+ * valid until its next call into the history.
+ * \param pHist is the history
+ * \param dt is the age in milliseconds, 0 for the newest entry
+ * \return the entry, or NULL if the history doesn't go back that far
+ */
+const GeolocateTelemetry_t *geolocateHistoryAgo(GeolocateHistory_t *pHist, uint32_t dt)
+{
+    uint32_t Tail, Head = trimHistory(pHist, &Tail), Index;
+
+    if (Head == Tail)
+        return NULL;
+
+    Index = searchHistory(pHist, Tail, Head, pHist->pEntries[(Head - 1) & pHist->Ring.Mask].base.systemTime - dt);
+
+    if (Index == Head)
+        return NULL;
+
+    return &pHist->pEntries[Index & pHist->Ring.Mask];
+
+}// geolocateHistoryAgo
+
+
+/*!
+ * Interpolate between two angles along the shortest path
+ * \param first is the angle at t = 0 in radians
+ * \param second is the angle at t = 1 in radians
+ * \param t is the fraction of the way from first to second
+ * \return the interpolated angle in radians, from -pi to pi
+ */
+static float interpolateAnglef(float first, float second, float t)
+{
+    return addAnglesf(first, subtractAnglesf(second, first)*t);
+
+}// interpolateAnglef
+
+
+/*!
+ * Construct the geolocate telemetry at an arbitrary system time, typically
+ * the capture time of a video frame, from the two entries either side of it.
+ * Position, velocity, angles, fields of view and the line of sight are
+ * interpolated linearly, the gimbal and INS attitude by quaternion slerp.
+ * Everything else comes from the nearer entry. Only the consumer thread may
+ * call this.
+ * \param pHist is the history
+ * \param systemTime is the system time in milliseconds
+ * \param pGeo receives the interpolated telemetry
+ * \return TRUE if systemTime is within the history, else FALSE
+ */
+BOOL geolocateHistoryInterpolate(GeolocateHistory_t *pHist, uint32_t systemTime, GeolocateTelemetry_t *pGeo)
+{
+    const GeolocateTelemetryCore_t *pA, *pB;
+    GeolocateTelemetryCore_t Core;
+    uint32_t Tail, Head = trimHistory(pHist, &Tail), Index;
+    int32_t Span;
+    float t;
+    int i;
+
+    Index = searchHistory(pHist, Tail, Head, systemTime);
+
+    // Before the oldest entry
+    if (Index == Head)
+        return FALSE;
+
+    pA = &pHist->pEntries[Index & pHist->Ring.Mask].base;
+
+    // An exact hit needs no interpolation
+    if (pA->systemTime == systemTime)
+    {
+        copyGeolocateTelemetry(&pHist->pEntries[Index & pHist->Ring.Mask], pGeo);
+        return TRUE;
+    }
+
+    // After the newest entry
+    if (Index + 1 == Head)
+        return FALSE;
+
+    pB = &pHist->pEntries[(Index + 1) & pHist->Ring.Mask].base;
+
+    // Fraction of the way from A to B
+    Span = (int32_t)(pB->systemTime - pA->systemTime);
+    t = (float)(int32_t)(systemTime - pA->systemTime) / (float)Span;
+
+    // Start with whichever entry is closer for all the discrete data
+    Core = (t < 0.5f) ? *pA : *pB;
+    Core.systemTime = systemTime;
+    Core.gpsITOW = pA->gpsITOW + (uint32_t)(int32_t)(t*(int32_t)(pB->gpsITOW - pA->gpsITOW) + 0.5f);
+
+    // Position, longitude is interpolated as an angle so it works across the date line
+    Core.posLat = pA->posLat + (pB->posLat - pA->posLat)*t;
+    Core.posLon = addAngles(pA->posLon, subtractAngles(pB->posLon, pA->posLon)*t);
+    Core.posAlt = pA->posAlt + (pB->posAlt - pA->posAlt)*t;
+    Core.geoidUndulation = pA->geoidUndulation + (pB->geoidUndulation - pA->geoidUndulation)*t;
+
+    for (i = 0; i < NNED; i++)
+        Core.velNED[i] = pA->velNED[i] + (pB->velNED[i] - pA->velNED[i])*t;
+
+    // Attitude
+    quaternionSlerp(pA->gimbalQuat, pB->gimbalQuat, t, Core.gimbalQuat);
+    quaternionSlerp(pA->insQuat, pB->insQuat, t, Core.insQuat);
+    Core.pan  = interpolateAnglef(pA->pan,  pB->pan,  t);
+    Core.tilt = interpolateAnglef(pA->tilt, pB->tilt, t);
+    Core.imageRotation = interpolateAnglef(pA->imageRotation, pB->imageRotation, t);
+
+    for (i = 0; i < NUM_GIMBAL_AXES; i++)
+        Core.outputShifts[i] = pA->outputShifts[i] + (pB->outputShifts[i] - pA->outputShifts[i])*t;
+
+    // Fields of view
+    Core.hfov = pA->hfov + (pB->hfov - pA->hfov)*t;
+    Core.vfov = pA->vfov + (pB->vfov - pA->vfov)*t;
+
+    // The line of sight only means the same thing at both ends if the range came from the same place
+    if (pA->rangeSource == pB->rangeSource)
+    {
+        for (i = 0; i < NECEF; i++)
+            Core.losECEF[i] = pA->losECEF[i] + (pB->losECEF[i] - pA->losECEF[i])*t;
+    }
+
+    // Rebuild all the derived data
+    ConvertGeolocateTelemetryCore(&Core, pGeo);
+
+    return TRUE;
+
+}// geolocateHistoryInterpolate
+
+
+/*!
+ * Get the velocity of the terrain intersection from the history. Only the
+ * consumer thread may call this. If the producer converts telemetry lazily
+ * it must complete GEOLOCATE_IMAGE_POS before committing each entry.
+ * \param pHist is the history
+ * \param dt is the desired time interval in milliseconds
+ * \param imageVel receives the velocity of the image location in North, East, Down, meters per second
+ * \return TRUE if the velocity was computed, else FALSE
+ */
+BOOL getImageVelocity(GeolocateHistory_t *pHist, uint32_t dt, float imageVel[NNED])
+{
+    const GeolocateTelemetry_t *pOld, *pNew;
+    uint32_t Tail, Head = trimHistory(pHist, &Tail), Index;
+    int32_t diff;
+
+    if (Head - Tail < 2)
+        return FALSE;
+
+    // Both entries are read in place
+    pNew = &pHist->pEntries[(Head - 1) & pHist->Ring.Mask];
+
+    Index = searchHistory(pHist, Tail, Head, pNew->base.systemTime - dt);
+    if (Index == Head)
+        return FALSE;
+
+    pOld = &pHist->pEntries[Index & pHist->Ring.Mask];
+
+    // Compute time delta in milliseconds
+    diff = pNew->base.systemTime - pOld->base.systemTime;
+
+    // If the newest entry has no range data, don't compute anything. Also skip internal
+    //   range estimates because they assume a velocity of zero
+    if ((pNew->base.rangeSource == RANGE_SRC_NONE) || (pNew->base.rangeSource == RANGE_SRC_INTERNAL))
+        return FALSE;
+    // Otherwise, delta time is good and the two range sources match
+    else if ((diff > 0) && (diff >= (int32_t)dt) && (pOld->base.rangeSource == pNew->base.rangeSource))
+    {
+        double DeltaECEF[NECEF], DeltaNED[NNED];
+
+        // Compute the NED distance between the two image positions
+        vector3Difference(pNew->imagePosECEF, pOld->imagePosECEF, DeltaECEF);
+        ecefToNEDtrig(DeltaECEF, DeltaNED, &pNew->llaTrig);
+        vector3Convert(DeltaNED, imageVel);
+
+        // Now convert to velocity by multiplying by 1000 / dt (in ms)
+        vector3Scalef(imageVel, imageVel, 1000.0f / diff);
+        return TRUE;
+    }
+
+    return FALSE;
+
+}// getImageVelocity
@@ -0,0 +1,81 @@
+#ifndef GEOLOCATEHISTORY_H
+#define GEOLOCATEHISTORY_H
+
+/*!
+ * \file
+ * History of geolocate telemetry, shared between the thread that receives
+ * telemetry and the thread that consumes it (typically video overlays). The
+ * history is a lock-free single producer, single consumer ring. The producer
+ * owns the head index and the consumer owns the tail index, so neither side
+ * ever waits on the other.
+ *
+ * The consumer reads entries in place: pointers returned by the lookup
+ * functions remain valid until the consumer's next call into the history,
+ * because the producer never overwrites an entry the consumer hasn't
+ * released. The consumer releases old entries automatically on each call,
+ * keeping the requested time span and leaving at least a quarter of the ring
+ * free for the producer. If the consumer stops calling in, the producer drops
+ * new entries rather than overwriting ones that might be in use.
+ *
+ * Entries are keyed by GeolocateTelemetryCore_t::systemTime, which must not
+ * decrease. If it does (the gimbal rebooted) the consumer discards the older
+ * entries the next time it calls in.
+ */
+
+#include "GeolocateTelemetry.h"
+#include "SpscRing.h"
+
+// C++ compilers: don't mangle us
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    //! Storage for the entries, supplied by the user
+    GeolocateTelemetry_t *pEntries;
+
+    //! Milliseconds of history the consumer keeps behind the newest entry, 0 to keep as much as fits
+    uint32_t RetainMs;
+
+    //! Indices of the entries, and the count of entries the producer dropped because the ring was full
+    SpscRing_t Ring;
+
+} GeolocateHistory_t;
+
+//! Initialize a geolocate history over user supplied storage
+BOOL geolocateHistoryInit(GeolocateHistory_t *pHist, GeolocateTelemetry_t *pEntries, uint32_t Capacity, uint32_t RetainMs);
+
+//! Producer: get the entry that the next commit will publish, or NULL if the ring is full
+GeolocateTelemetry_t *geolocateHistoryReserve(GeolocateHistory_t *pHist);
+
+//! Producer: publish the entry returned by geolocateHistoryReserve()
+void geolocateHistoryCommit(GeolocateHistory_t *pHist);
+
+//! Producer: copy a geolocate telemetry structure into the history
+BOOL geolocateHistoryPush(GeolocateHistory_t *pHist, const GeolocateTelemetry_t *pGeo);
+
+//! Consumer: get the number of entries available
+uint32_t geolocateHistoryCount(GeolocateHistory_t *pHist);
+
+//! Consumer: get an entry by its age in entries, 0 being the newest
+const GeolocateTelemetry_t *geolocateHistoryGet(GeolocateHistory_t *pHist, uint32_t Age);
+
+//! Consumer: get the newest entry at or before a system time
+const GeolocateTelemetry_t *geolocateHistoryFind(GeolocateHistory_t *pHist, uint32_t systemTime);
+
+//! Consumer: get the newest entry that is at least dt milliseconds older than the newest entry
+const GeolocateTelemetry_t *geolocateHistoryAgo(GeolocateHistory_t *pHist, uint32_t dt);
+
+//! Consumer: construct the geolocate telemetry at an arbitrary system time
+BOOL geolocateHistoryInterpolate(GeolocateHistory_t *pHist, uint32_t systemTime, GeolocateTelemetry_t *pGeo);
+
+//! Consumer: get the velocity of the terrain intersection from two entries dt apart, see ImageVelocity.h
+//!   for a smoothed estimate that costs the same no matter how long it averages over
+BOOL getImageVelocity(GeolocateHistory_t *pHist, uint32_t dt, float imageVel[NNED]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GEOLOCATEHISTORY_H
@@ -41,6 +41,27 @@ BOOL DecodeGeolocateTelemetry(const OrionPkt_t *pPkt, GeolocateTelemetry_t *pGeo
 }// DecodeGeolocateTelemetry
 
 
+/*!
+ * Parse a GeolocateTelemetry packet, constructing only the ECEF position, trig
+ * data and DCMs. Use CompleteGeolocateTelemetry() for the rest.
+ * \param pPkt is the received packet packet
+ * \param pGeo receives the parsed data, including locally constructed data
+ * \return TRUE if the packet was successfully decoded
+ */
+BOOL DecodeGeolocateTelemetryLazy(const OrionPkt_t *pPkt, GeolocateTelemetry_t *pGeo)
+{
+    // Only parse this packet if the ID and length look right
+    if (decodeGeolocateTelemetryCorePacketStructure(pPkt, &pGeo->base))
+    {
+        ConvertGeolocateTelemetryCoreLazy(&pGeo->base, pGeo);
+        return TRUE;
+    }
+    else
+        return FALSE;
+
+}// DecodeGeolocateTelemetryLazy
+
+
 /*!
  * Convert a GeolocateTelemetryCore_t struct to GeolocateTelemetry_t
  * \param pCore is a GeolocateTelemetryCore_t message to be converted
@@ -48,35 +69,40 @@ BOOL DecodeGeolocateTelemetry(const OrionPkt_t *pPkt, GeolocateTelemetry_t *pGeo
  */
 void ConvertGeolocateTelemetryCore(const GeolocateTelemetryCore_t *pCore, GeolocateTelemetry_t *pGeo)
 {
-    stackAllocateDCM(tempDcm);
+    ConvertGeolocateTelemetryCoreLazy(pCore, pGeo);
+    CompleteGeolocateTelemetry(pGeo, GEOLOCATE_ALL);
+
+}// ConvertGeolocateTelemetryCore
+
+
+/*!
+ * Convert a GeolocateTelemetryCore_t struct to GeolocateTelemetry_t, constructing
+ * only the ECEF position, trig data and the gimbal and camera DCMs. The other
+ * fields are left for CompleteGeolocateTelemetry().
+ * \param pCore is a GeolocateTelemetryCore_t message to be converted
+ * \param pGeo receives a copy of pCore, as well as some locally constructed data
+ */
+void ConvertGeolocateTelemetryCoreLazy(const GeolocateTelemetryCore_t *pCore, GeolocateTelemetry_t *pGeo)
+{
+    DCM3_t tempDcm;
     float Pan, Tilt;
 
     // Copy the core data in (if need be)
     if (pCore != &pGeo->base)
         memcpy(&pGeo->base, pCore, sizeof(GeolocateTelemetryCore_t));
 
-    // Date and time
-    computeDateAndTimeFromWeekAndItow(pGeo->base.gpsWeek, pGeo->base.gpsITOW, pGeo->base.leapSeconds, &pGeo->Year, &pGeo->Month, &pGeo->Day, &pGeo->Hour, &pGeo->Minute, &pGeo->Second);
+    // None of the on demand fields go with this packet yet
+    pGeo->validFields = 0;
 
     // convert tilt from -180 to 180 into -270 to 90
     if(pGeo->base.tilt > deg2radf(90))
         pGeo->base.tilt -= deg2radf(360);
 
-    // Construct the data that was not transmitted
-    structInitDCM(pGeo->gimbalDcm);
-    structInitDCM(pGeo->cameraDcm);
-
-    // ECEF position and velocity
+    // Construct the data that was not transmitted, starting with ECEF position
     llaToECEFandTrig(&(pGeo->base.posLat), pGeo->posECEF, &pGeo->llaTrig);
-    nedToECEFtrigf(pGeo->base.velNED, pGeo->velECEF, &pGeo->llaTrig);
 
     // Rotation from gimbal to nav
-    quaternionToDCM(pGeo->base.gimbalQuat, &pGeo->gimbalDcm);
-
-    // Gimbals Euler attitude
-    pGeo->gimbalEuler[AXIS_ROLL]  = dcmRoll(&pGeo->gimbalDcm);
-    pGeo->gimbalEuler[AXIS_PITCH] = dcmPitch(&pGeo->gimbalDcm);
-    pGeo->gimbalEuler[AXIS_YAW]   = dcmYaw(&pGeo->gimbalDcm);
+    quaternionToDCM3(pGeo->base.gimbalQuat, &pGeo->gimbalDcm);
 
     // Offset the pan/tilt angles with the current estab output shifts
     Pan  = subtractAnglesf(pGeo->base.pan,  pGeo->base.outputShifts[GIMBAL_AXIS_PAN]);
@@ -88,29 +114,90 @@ void ConvertGeolocateTelemetryCore(const GeolocateTelemetryCore_t *pCore, Geoloc
     // Rotation from camera to gimbal, note that this only works if pan
     // is over tilt (pan first, then tilt, just like Euler)
     if (fabsf(pGeo->base.imageRotation) > radiansf(0.1f))
-        setDCMBasedOnEuler(&tempDcm, Pan, Tilt, pGeo->base.imageRotation);
+        dcm3FromEuler(&tempDcm, Pan, Tilt, pGeo->base.imageRotation);
     else
-        setDCMBasedOnPanTilt(&tempDcm, Pan, Tilt);
+        dcm3FromPanTilt(&tempDcm, Pan, Tilt);
 
     // Now create the rotation from camera to nav.
-    matrixMultiplyf(&pGeo->gimbalDcm, &tempDcm, &pGeo->cameraDcm);
+    dcm3Multiply(&pGeo->gimbalDcm, &tempDcm, &pGeo->cameraDcm);
+
+}// ConvertGeolocateTelemetryCoreLazy
+
+
+/*!
+ * Construct fields of a GeolocateTelemetry_t that were left out by
+ * ConvertGeolocateTelemetryCoreLazy(). Fields that were already constructed
+ * for this packet are left alone, so this is cheap to call before every use.
+ * \param pGeo is the geolocate telemetry to complete
+ * \param fields is a combination of GEOLOCATE_ flags for the fields to construct
+ */
+void CompleteGeolocateTelemetry(GeolocateTelemetry_t *pGeo, UInt32 fields)
+{
+    // Only do the ones that haven't been done yet
+    fields &= ~pGeo->validFields;
+
+    // Date and time
+    if (fields & GEOLOCATE_DATE)
+    {
+        uint16_t week = pGeo->base.gpsWeek;
+        uint32_t itow = pGeo->base.gpsITOW, day;
+
+        // Watch for wrap when we subtract the leap seconds, which converts the GPS time to UTC time
+        if(itow < pGeo->base.leapSeconds*1000u)
+        {
+            week--;
+            itow += 86400000*7;
+        }
+
+        itow -= pGeo->base.leapSeconds*1000u;
+
+        // The calendar conversion only needs doing once a day, the time of day is cheap
+        day = week*7u + itow/86400000;
+        if (pGeo->dateDay != day + 1)
+        {
+            computeDateFromWeekAndItow(week, itow, &pGeo->Year, &pGeo->Month, &pGeo->Day);
+            pGeo->dateDay = day + 1;
+        }
+
+        computeTimeFromItow(itow, &pGeo->Hour, &pGeo->Minute, &pGeo->Second);
+    }
+
+    // ECEF velocity
+    if (fields & GEOLOCATE_VELOCITY)
+        nedToECEFtrigf(pGeo->base.velNED, pGeo->velECEF, &pGeo->llaTrig);
+
+    // Gimbals Euler attitude
+    if (fields & GEOLOCATE_GIMBAL_EULER)
+    {
+        pGeo->gimbalEuler[AXIS_ROLL]  = dcm3Roll(&pGeo->gimbalDcm);
+        pGeo->gimbalEuler[AXIS_PITCH] = dcm3Pitch(&pGeo->gimbalDcm);
+        pGeo->gimbalEuler[AXIS_YAW]   = dcm3Yaw(&pGeo->gimbalDcm);
+    }
 
     // The cameras quaternion and Euler angles
-    dcmToQuaternion(&pGeo->cameraDcm, pGeo->cameraQuat);
-    pGeo->cameraEuler[AXIS_ROLL]  = dcmRoll(&pGeo->cameraDcm);
-    pGeo->cameraEuler[AXIS_PITCH] = dcmPitch(&pGeo->cameraDcm);
-    pGeo->cameraEuler[AXIS_YAW]   = dcmYaw(&pGeo->cameraDcm);
+    if (fields & GEOLOCATE_CAMERA)
+    {
+        dcm3ToQuaternion(&pGeo->cameraDcm, pGeo->cameraQuat);
+        pGeo->cameraEuler[AXIS_ROLL]  = dcm3Roll(&pGeo->cameraDcm);
+        pGeo->cameraEuler[AXIS_PITCH] = dcm3Pitch(&pGeo->cameraDcm);
+        pGeo->cameraEuler[AXIS_YAW]   = dcm3Yaw(&pGeo->cameraDcm);
+    }
+
+    if (fields & GEOLOCATE_IMAGE_POS)
+    {
+        // Slant range is the vector magnitude of the line of sight ECEF vector
+        pGeo->slantRange = vector3Lengthf(pGeo->base.losECEF);
 
-    // Slant range is the vector magnitude of the line of sight ECEF vector
-    pGeo->slantRange = vector3Lengthf(pGeo->base.losECEF);
+        // Gimbal ECEF position + line of sight ECEF vector = ECEF image position
+        vector3Sum(pGeo->posECEF, vector3Convertf(pGeo->base.losECEF, pGeo->imagePosECEF), pGeo->imagePosECEF);
 
-    // Gimbal ECEF position + line of sight ECEF vector = ECEF image position
-    vector3Sum(pGeo->posECEF, vector3Convertf(pGeo->base.losECEF, pGeo->imagePosECEF), pGeo->imagePosECEF);
+        // Convert ECEF image position to LLA
+        ecefToLLA(pGeo->imagePosECEF, pGeo->imagePosLLA);
+    }
 
-    // Convert ECEF image position to LLA
-    ecefToLLA(pGeo->imagePosECEF, pGeo->imagePosLLA);
+    pGeo->validFields |= fields;
 
-}// ConvertGeolocateTelemetryCore
+}// CompleteGeolocateTelemetry
 
 
 /*!
@@ -165,7 +252,7 @@ BOOL offsetImageLocation(const GeolocateTelemetry_t *geo, const double imagePosL
     shift[VECTOR3Z] = -zdev;
 
     // Rotate this shift from camera frame to NED (body to nav)
-    dcmApplyRotation(&geo->cameraDcm, shift, shift);
+    dcm3ApplyRotation(&geo->cameraDcm, shift, shift);
 
     // Add this to the vector that goes from gimbal to image,
     // to create a new vector that goes from gimbal to new location.
@@ -221,15 +308,15 @@ double distanceToHorizonM(double latRad, double altMSLMeters)
 void offsetImageLocationOcean( const GeolocateTelemetry_t *geoloc, float deltaYawRad, float deltaPitchRad, double newPosLLA[NLLA], double* slantRangeM)
 {
     // Get the DCM to rotate from the delta position in FOV to camera centerline
-    stackAllocateDCM(deltaDcm);
-    setDCMBasedOnPanTilt(&deltaDcm, deltaYawRad, deltaPitchRad);
+    DCM3_t deltaDcm;
+    dcm3FromPanTilt(&deltaDcm, deltaYawRad, deltaPitchRad);
 
     // Get the total rotation from the delta position to NED
-    stackAllocateDCM(dcmDeltaToNED);
-    dcmMultiply(&geoloc->cameraDcm, &deltaDcm, &dcmDeltaToNED);
+    DCM3_t dcmDeltaToNED;
+    dcm3Multiply(&geoloc->cameraDcm, &deltaDcm, &dcmDeltaToNED);
 
     // The line-of-sight unit vector from the gimbal is the first column (note switch to [N,E,UP]
-    double u = -(double)dcmGet(&dcmDeltaToNED,2,0);
+    double u = -(double)dcm3Get(&dcmDeltaToNED,2,0);
 
     // Use the geocentric radius of the earth at the gimbal
     double geocentric[NLLA] = {geoloc->base.posLat, geoloc->base.posLon, 0};
@@ -283,7 +370,7 @@ void offsetImageLocationOcean( const GeolocateTelemetry_t *geoloc, float deltaYa
 
     double GimbalEcef[NECEF], ImgPosECEF[NECEF];
     float LineOfSight[NECEF], Ecef[NECEF];
-    stackAllocateDCM(Dcm);
+    DCM3_t Dcm;
     llaTrig_t Trig;
 
     // Create a line of sight vector looking north.
@@ -292,8 +379,8 @@ void offsetImageLocationOcean( const GeolocateTelemetry_t *geoloc, float deltaYa
     LineOfSight[ECEFZ] = 0.0f;
 
     // Now rotate that vector into the nav frame
-    setDCMBasedOnEuler(&Dcm, dcmYaw(&dcmDeltaToNED), dcmPitch(&dcmDeltaToNED), dcmRoll(&dcmDeltaToNED));
-    dcmApplyRotation(&Dcm, LineOfSight, LineOfSight);
+    dcm3FromEuler(&Dcm, dcm3Yaw(&dcmDeltaToNED), dcm3Pitch(&dcmDeltaToNED), dcm3Roll(&dcmDeltaToNED));
+    dcm3ApplyRotation(&Dcm, LineOfSight, LineOfSight);
 
     // Get gimbal pos in ECEF
     llaToECEFandTrig(GimbalLla, GimbalEcef, &Trig);
@@ -312,6 +399,23 @@ void offsetImageLocationOcean( const GeolocateTelemetry_t *geoloc, float deltaYa
 
 }// offsetImageLocationOcean
 
+//! Most line of sight steps that are looked up together when the terrain is close
+#define RAY_BATCH 8
+
+//! Adapts a bare elevation lookup function to the terrain provider interface
+typedef struct
+{
+    TerrainProvider_t base;
+    float (*getElevationHAE)(double, double);
+} LegacyTerrain_t;
+
+//! Terrain provider callback that forwards to a bare elevation lookup function
+static float getLegacyElevation(const TerrainProvider_t *pTerrain, double lat, double lon)
+{
+    return ((const LegacyTerrain_t *)pTerrain)->getElevationHAE(lat, lon);
+
+}// getLegacyElevation
+
 /*! Get the terrain intersection of the current line of sight given gimbal geolocate telemetry data.
  *  \param pGeo[in] A pointer to incoming geolocate telemetry data
  *  \param getElevationHAE[in] Pointer to a terrain model lookup function, which should take a lat/lon
@@ -323,228 +427,474 @@ void offsetImageLocationOcean( const GeolocateTelemetry_t *geoloc, float deltaYa
  */
 BOOL getTerrainIntersection(const GeolocateTelemetry_t *pGeo, float (*getElevationHAE)(double, double), double PosLLA[NLLA], double *pRange)
 {
-    double UnitNED[NNED], UnitECEF[NECEF], LineOfSight[NECEF], Step, End;
-    float Temp[NNED] = { 1.0f, 0.0f, 0.0f };
+    // Wrap the lookup function in a provider with no height bounds, so every step gets sampled
+    LegacyTerrain_t Terrain = { { getLegacyElevation, NULL, 1.0f, 0.0f, NULL, NULL }, getElevationHAE };
 
-    // Coarse and fine line of sight ray step distances, in meters
-    static const double StepCoarse = 30.0, StepFine = 1.0;
+    return getTerrainIntersectionEx(pGeo, &Terrain.base, PosLLA, pRange);
 
-    // Maximum distance to follow a ray before giving up
-    static const double MaxDistance = 15000.0;
+}// getTerrainIntersection
 
-    // Rotate a unit line of sight vector by the camera DCM to get a 1-meter NED look vector
-    dcmApplyRotation(&pGeo->cameraDcm, Temp, Temp);
+/*! Find the position along a line of sight at some range, and how far above the terrain it is
+ *  \param Origin[in] ECEF start of the line of sight
+ *  \param Unit[in] ECEF unit vector along the line of sight
+ *  \param Range[in] Distance along the line of sight in meters
+ *  \param pTerrain[in] Terrain model to compare against
+ *  \param PosLLA[out] LLA position at this range
+ *  \param pGround[out] Terrain height at this position
+ *  \return Height of the line of sight above the terrain, negative if it's under ground
+ */
+static double getRayClearance(const double Origin[NECEF], const double Unit[NECEF], double Range, const TerrainProvider_t *pTerrain, double PosLLA[NLLA], float *pGround)
+{
+    double Ecef[NECEF];
+
+    // Scale the unit vector out to this range and add it to the start position
+    vector3Scale(Unit, Ecef, Range);
+    vector3Sum(Origin, Ecef, Ecef);
+
+    // Convert to LLA and look up the ground height under it
+    ecefToLLA(Ecef, PosLLA);
+    *pGround = pTerrain->getElevationHAE(pTerrain, PosLLA[LAT], PosLLA[LON]);
+
+    return PosLLA[ALT] - *pGround;
+
+}// getRayClearance
+
+/*! Find the positions along a line of sight at several ranges, and how far above the terrain they are.
+ *  The terrain heights are looked up all at once if the provider can do that.
+ *  \param Origin[in] ECEF start of the line of sight
+ *  \param Unit[in] ECEF unit vector along the line of sight
+ *  \param Range[in] Distance along the line of sight of each position in meters
+ *  \param n[in] Number of positions, up to RAY_BATCH
+ *  \param pTerrain[in] Terrain model to compare against
+ *  \param Lat[out] Latitude of each position in radians
+ *  \param Lon[out] Longitude of each position in radians
+ *  \param Alt[out] Altitude of each position in meters
+ *  \param Ground[out] Terrain height at each position
+ *  \return Index of the first position that's under ground, or n if none of them are
+ */
+static int getRayClearances(const double Origin[NECEF], const double Unit[NECEF], const double *Range, int n, const TerrainProvider_t *pTerrain,
+                            double *Lat, double *Lon, double *Alt, float *Ground)
+{
+    double X[RAY_BATCH], Y[RAY_BATCH], Z[RAY_BATCH];
+    int i;
 
-    // Convert the unit vector in Temp[NNED] from single to double precision
-    vector3Convertf(Temp, UnitNED);
+    // Scale the unit vector out to each range and add it to the start position
+    for(i = 0; i < n; i++)
+    {
+        X[i] = Origin[ECEFX] + Unit[ECEFX] * Range[i];
+        Y[i] = Origin[ECEFY] + Unit[ECEFY] * Range[i];
+        Z[i] = Origin[ECEFZ] + Unit[ECEFZ] * Range[i];
+    }
 
-    // Convert the unit vector to ECEF
-    nedToECEFtrig(UnitNED, UnitECEF, &pGeo->llaTrig);
+    // Convert them all to LLA and look up the ground heights under them
+    ecefToLLAArray(X, Y, Z, n, Lat, Lon, Alt);
 
-    // Start with a step value of StepCoarse and loop until MaxDistance
-    Step = StepCoarse;
-    End = MaxDistance;
+    if(pTerrain->getElevationsHAE != NULL)
+        pTerrain->getElevationsHAE(pTerrain, Lat, Lon, Ground, n);
+    else
+    {
+        for(i = 0; i < n; i++)
+            Ground[i] = pTerrain->getElevationHAE(pTerrain, Lat[i], Lon[i]);
+    }
 
-    // Initialize the line of sight vector with the gimbal position
-    vector3Copy(pGeo->posECEF, LineOfSight);
+    for(i = 0; i < n; i++)
+    {
+        if(Alt[i] - Ground[i] <= 0)
+            break;
+    }
+
+    return i;
 
-    // Loop through LOS ranges
-    for (*pRange = Step; *pRange <= End; *pRange += Step)
+}// getRayClearances
+
+/*! Check whether a stretch of a line of sight is guaranteed to stay above the terrain
+ *  \param pTerrain[in] Terrain model to check against
+ *  \param PosLLA[in] LLA position at the start of the stretch
+ *  \param Descent[in] Meters of altitude lost per meter of range
+ *  \param Span[in] Length of the stretch in meters
+ *  \return TRUE if the terrain height bounds show that the stretch can't touch the ground
+ */
+static BOOL isRayClear(const TerrainProvider_t *pTerrain, const double PosLLA[NLLA], double Descent, double Span)
+{
+    // Smaller than any earth radius, so the box below always covers the whole stretch
+    static const double MinRadius = 6300000.0;
+
+    double dLat = Span / MinRadius, dLon = Span / (MinRadius * MAX(cos(PosLLA[LAT]), 1e-6));
+    float Min, Max;
+
+    // Prefer tight bounds over a box around the stretch, falling back to the bounds for the whole model
+    if ((pTerrain->getElevationBounds == NULL) ||
+        !pTerrain->getElevationBounds(pTerrain, PosLLA[LAT] - dLat, PosLLA[LON] - dLon, PosLLA[LAT] + dLat, PosLLA[LON] + dLon, &Min, &Max))
     {
-        double StepECEF[NECEF], GroundHeight;
+        // No bounds at all, so nothing can be skipped
+        if (pTerrain->minHAE > pTerrain->maxHAE)
+            return FALSE;
 
-        // Scale the ECEF unit vector to the step length
-        vector3Scale(UnitECEF, StepECEF, Step);
+        Max = pTerrain->maxHAE;
+    }
 
-        // Increment the ECEF line of sight vector by the Step-sized unit vector
-        vector3Sum(LineOfSight, StepECEF, LineOfSight);
+    // Earth curvature only ever makes the ray climb away from the ground, so the straight-line descent is a safe bound
+    return PosLLA[ALT] - Span * MAX(Descent, 0.0) > Max;
 
-        // Convert the ECEF line of sight position to LLA
-        ecefToLLA(LineOfSight, PosLLA);
+}// isRayClear
 
-        // Get the ground HAE
-        GroundHeight = getElevationHAE(PosLLA[LAT], PosLLA[LON]);
+/*! Follow a line of sight out from a point until it hits the terrain. Stretches of the line of
+ *  sight that the terrain provider's height bounds show to be above the terrain are skipped in one
+ *  go, the rest is sampled at the same spacing as getTerrainIntersection, and the crossing is
+ *  refined with a safeguarded secant search rather than a fine step.
+ *  \param Origin[in] ECEF position of the start of the line of sight in meters
+ *  \param UnitECEF[in] ECEF unit vector along the line of sight
+ *  \param Descent[in] Down component of the line of sight unit vector in NED
+ *  \param pTerrain[in] Terrain model to intersect with
+ *  \param PosLLA[out] Terrain intersection location in the LLA frame
+ *  \param pRange[out] Distance to the intersection in meters
+ *  \return TRUE if a valid intersection was found, otherwise FALSE
+ */
+static BOOL intersectRay(const double Origin[NECEF], const double UnitECEF[NECEF], double Descent, const TerrainProvider_t *pTerrain, double PosLLA[NLLA], double *pRange)
+{
+    double HighLLA[NLLA], Low = 0, LowClear, High, HighClear, Skip;
+    double Range[RAY_BATCH], Lat[RAY_BATCH], Lon[RAY_BATCH], Alt[RAY_BATCH];
+    float Ground, HighGround, Grounds[RAY_BATCH];
+    int Count, Hit;
+
+    // Coarse line of sight ray step distance and intersection tolerance, in meters
+    static const double StepCoarse = 30.0, StepFine = 1.0;
+
+    // Maximum distance to follow a ray before giving up
+    static const double MaxDistance = 15000.0;
 
-        // If we're still coarsely stepping
-        if (Step != StepFine)
+    // Start at the gimbal, with the smallest skip distance
+    LowClear = getRayClearance(Origin, UnitECEF, Low, pTerrain, PosLLA, &Ground);
+    Skip = StepCoarse;
+
+    // Walk out along the line of sight, keeping the last point known to be above ground in PosLLA
+    while (Low < MaxDistance)
+    {
+        // Normal sample spacing is the greater of 1% of the current range or StepCoarse
+        double Step = MAX(StepCoarse, Low * 0.01);
+
+        // Try doubling the last skip distance, then back off until the terrain bounds say it's clear
+        Skip = MIN(Skip * 2, MaxDistance - Low);
+        while ((Skip > Step) && !isRayClear(pTerrain, PosLLA, Descent, Skip))
+            Skip /= 2;
+
+        // If there's something to skip, that's the only step to take
+        if (Skip > Step)
+        {
+            Range[0] = Low + Skip;
+            Count = 1;
+        }
+        // Otherwise the terrain is close, so take a batch of normal steps and look them all up at once
+        else
         {
-            // Set the step size to the greater of 1% of current range or StepCoarse
-            Step = MAX(StepCoarse, *pRange * 0.01f);
+            for (Count = 0, High = Low; (Count < RAY_BATCH) && (High < MaxDistance); Count++)
+                Range[Count] = High = High + MAX(StepCoarse, High * 0.01);
+
+            Skip = Step;
         }
 
-        // If the end of this ray is under ground
-        if (PosLLA[ALT] <= GroundHeight)
+        // See where the ray is after each step
+        Hit = getRayClearances(Origin, UnitECEF, Range, Count, pTerrain, Lat, Lon, Alt, Grounds);
+
+        // If one of them is under ground, the intersection is somewhere in the step before it
+        if (Hit < Count)
         {
-            // Decrease the range by one step
-            if (Step != StepFine)
+            // The step before it is the new low end
+            if (Hit > 0)
             {
-                // Back up one step
-                *pRange -= Step;
+                Low = Range[Hit - 1];
+                LowClear = Alt[Hit - 1] - Grounds[Hit - 1];
+                PosLLA[LAT] = Lat[Hit - 1];
+                PosLLA[LON] = Lon[Hit - 1];
+                PosLLA[ALT] = Alt[Hit - 1];
+            }
 
-                // Change to the fine step and loop until the current range
-                End = *pRange + Step;
-                Step = StepFine;
+            High = Range[Hit];
+            HighClear = Alt[Hit] - Grounds[Hit];
+            HighGround = Grounds[Hit];
+            HighLLA[LAT] = Lat[Hit];
+            HighLLA[LON] = Lon[Hit];
+            HighLLA[ALT] = Alt[Hit];
 
-                // Subtract one unit step from the LOS vector and rescale the unit to the new step distance
-                vector3Difference(LineOfSight, StepECEF, LineOfSight);
-            }
-            // If we're fine stepping, we've found the terrain intersection
-            else
+            // Narrow it down until the bracket is no wider than the fine step
+            while (High - Low > StepFine)
             {
-                // Clamp the altitude to the ground and tell the caller that the image position is good
-                PosLLA[ALT] = GroundHeight;
-                return TRUE;
+                double Mid, MidLLA[NLLA], MidClear, Width = High - Low;
+                float MidGround;
+
+                // Interpolate to where the ray crosses the ground, but never too close to either end of the bracket
+                Mid = (LowClear > 0) ? Low + Width * LowClear / (LowClear - HighClear) : Low + Width * 0.5;
+                Mid = MIN(MAX(Mid, Low + Width * 0.1), High - Width * 0.1);
+                MidClear = getRayClearance(Origin, UnitECEF, Mid, pTerrain, MidLLA, &MidGround);
+
+                // Keep whichever half still brackets the crossing
+                if (MidClear <= 0)
+                {
+                    High = Mid;
+                    HighClear = MidClear;
+                    HighGround = MidGround;
+                    vector3Copy(MidLLA, HighLLA);
+                }
+                else
+                {
+                    Low = Mid;
+                    LowClear = MidClear;
+                }
             }
+
+            // Clamp the altitude to the ground and tell the caller that the image position is good
+            vector3Copy(HighLLA, PosLLA);
+            PosLLA[ALT] = HighGround;
+            *pRange = High;
+            return TRUE;
         }
+
+        // Still above ground, so move up to the last step
+        Low = Range[Count - 1];
+        LowClear = Alt[Count - 1] - Grounds[Count - 1];
+        PosLLA[LAT] = Lat[Count - 1];
+        PosLLA[LON] = Lon[Count - 1];
+        PosLLA[ALT] = Alt[Count - 1];
     }
 
     // No valid image position
+    *pRange = Low;
     return FALSE;
 
-}// getTerrainIntersection
-
+}// intersectRay
 
-/*!
- * Get the velocity of the terrain intersection
- * \param buf points to the geolocate buffer
- * \param dt is the desired timer interval in milliseconds
- * \param imageVel receives the velocity of the image in North, East Down, meters
- * \return TRUE if the velocity was computed, else FALSE
+/*! Get the terrain intersection of the current line of sight using a terrain provider, skipping
+ *  over stretches of the line of sight that the provider's height bounds show to be clear.
+ *  \param pGeo[in] A pointer to incoming geolocate telemetry data
+ *  \param pTerrain[in] Terrain model to intersect with
+ *  \param PosLLA[out] Terrain intersection location in the LLA frame
+ *  \param pRange[out] Target range in meters to be sent to the gimbal
+ *  \return TRUE if a valid intersection was found, otherwise FALSE. Note that if this function
+ *          returns FALSE, the data in PosLLA and pRange will still be overwritten with invalid data.
  */
-BOOL getImageVelocity(const GeolocateBuffer_t* buf, uint32_t dt, float imageVel[NNED])
+BOOL getTerrainIntersectionEx(const GeolocateTelemetry_t *pGeo, const TerrainProvider_t *pTerrain, double PosLLA[NLLA], double *pRange)
 {
-    GeolocateTelemetry_t Old, New;
-    int32_t diff;
+    double UnitNED[NNED], UnitECEF[NECEF];
+    float Temp[NNED] = { 1.0f, 0.0f, 0.0f };
 
-    if (getGeolocateBuffer(buf, dt, &Old) == FALSE)
-        return FALSE;
-    else if (getGeolocateBuffer(buf, 0, &New) == FALSE)
-        return FALSE;
+    // Rotate a unit line of sight vector by the camera DCM to get a 1-meter NED look vector
+    dcm3ApplyRotation(&pGeo->cameraDcm, Temp, Temp);
 
-    // Compute time delta in milliseconds
-    diff = New.base.systemTime - Old.base.systemTime;
+    // Convert the unit vector in Temp[NNED] from single to double precision
+    vector3Convertf(Temp, UnitNED);
 
+    // Convert the unit vector to ECEF
+    nedToECEFtrig(UnitNED, UnitECEF, &pGeo->llaTrig);
 
-    // If the newest entry has no range data, don't compute anything. Also skip internal
-    //   range estimates because they assume a velocity of zero
-    if ((New.base.rangeSource == RANGE_SRC_NONE) || (New.base.rangeSource == RANGE_SRC_INTERNAL))
-        return FALSE;
-    // Otherwise, delta time is good and the two range sources match
-    else if ((diff >= (int32_t)dt) && (Old.base.rangeSource == New.base.rangeSource))
-    {
-        double DeltaECEF[NECEF], DeltaNED[NNED];
+    // And follow it out to the terrain
+    return intersectRay(pGeo->posECEF, UnitECEF, UnitNED[DOWN], pTerrain, PosLLA, pRange);
 
-        // Compute the NED distance between the two image positions
-        vector3Difference(New.imagePosECEF, Old.imagePosECEF, DeltaECEF);
-        ecefToNEDtrig(DeltaECEF, DeltaNED, &New.llaTrig);
-        vector3Convert(DeltaNED, imageVel);
+}// getTerrainIntersectionEx
 
-        // Now convert to velocity by multiplying by 1000 / dt (in ms)
-        vector3Scalef(imageVel, imageVel, 1000.0f / diff);
-        return TRUE;
+/*!
+ * Geolocate many points in the image at once, e.g. the frame corners and any
+ * number of tracker or user click points. The per-frame setup (the camera DCM
+ * axes, the line of sight to the image location and the NED to ECEF rotation)
+ * is done once, and the points are processed in blocks laid out as separate
+ * arrays per component so that the inner loops can be vectorized.
+ *
+ * \param geo is the geolocate telemetry from the gimbal.
+ * \param dev gives the angular deviation of each point in radians from the
+ *        center of the image, [0] in the right camera direction and [1] in the
+ *        up camera direction, as used by offsetImageLocation().
+ * \param n is the number of points.
+ * \param pTerrain is the terrain model to intersect each line of sight with.
+ *        If this is NULL each point is projected onto a plane at the altitude
+ *        of geo->imagePosLLA, exactly like offsetImageLocation(). If geo was
+ *        converted lazily it needs GEOLOCATE_IMAGE_POS for this.
+ * \param posLLA receives the position of each point.
+ * \param slantRange receives the slant range to each point in meters, can be NULL.
+ * \param valid receives TRUE for each point that was located, can be NULL.
+ *        Points that could not be located have undefined outputs.
+ * \return the number of points that were located.
+ */
+int geolocatePoints(const GeolocateTelemetry_t *geo, const float (*dev)[2], int n, const TerrainProvider_t *pTerrain,
+                    double (*posLLA)[NLLA], double *slantRange, BOOL *valid)
+{
+    float tanY[GEOLOCATE_BATCH], tanZ[GEOLOCATE_BATCH];
+    float north[GEOLOCATE_BATCH], east[GEOLOCATE_BATCH], down[GEOLOCATE_BATCH];
+    float axisX[NNED], axisY[NNED], axisZ[NNED];
+    float imageNED[NNED], imageRange = 0, imageDown = 0;
+    double rotation[NECEF][NNED];
+    const llaTrig_t *trig = &geo->llaTrig;
+    int start, count = 0, i, j;
+
+    // The camera axes in NED are the columns of the camera DCM
+    for(j = 0; j < NNED; j++)
+    {
+        axisX[j] = dcm3Get(&geo->cameraDcm, j, 0);
+        axisY[j] = dcm3Get(&geo->cameraDcm, j, 1);
+        axisZ[j] = dcm3Get(&geo->cameraDcm, j, 2);
     }
 
-    return FALSE;
+    if(pTerrain == NULL)
+    {
+        // Vector from the gimbal to the image location in NED, notice that Altitue and Down have different signs
+        imageNED[NORTH] = (float)((geo->imagePosLLA[LAT] - geo->base.posLat)*datum_meanRadius);
+        imageNED[EAST]  = (float)((geo->imagePosLLA[LON] - geo->base.posLon)*datum_meanRadius*trig->cosLat);
+        imageNED[DOWN]  = (float)(geo->base.posAlt - geo->imagePosLLA[ALT]);
+        imageDown = imageNED[DOWN];
+        imageRange = vector3Lengthf(imageNED);
+
+        // Bail out on numerical problems at the poles, and if the image altitude isn't lower than the gimbal altitude
+        if((trig->cosLat == 0) || (imageDown <= 0))
+        {
+            for(i = 0; (valid != NULL) && (i < n); i++)
+                valid[i] = FALSE;
 
-}// getImageVelocity
+            return 0;
+        }
+    }
+    else
+    {
+        // NED to ECEF rotation matrix at the gimbal, the same terms as nedToECEFtrig()
+        rotation[ECEFX][NORTH] = -trig->sinLat*trig->cosLon;
+        rotation[ECEFX][EAST]  = -trig->sinLon;
+        rotation[ECEFX][DOWN]  = -trig->cosLat*trig->cosLon;
+        rotation[ECEFY][NORTH] = -trig->sinLat*trig->sinLon;
+        rotation[ECEFY][EAST]  =  trig->cosLon;
+        rotation[ECEFY][DOWN]  = -trig->cosLat*trig->sinLon;
+        rotation[ECEFZ][NORTH] =  trig->cosLat;
+        rotation[ECEFZ][EAST]  =  0;
+        rotation[ECEFZ][DOWN]  = -trig->sinLat;
+    }
 
+    for(start = 0; start < n; start += GEOLOCATE_BATCH)
+    {
+        int num = MIN(n - start, GEOLOCATE_BATCH);
 
-/*!
- * Get a buffered geolocate telemetry struct
- * \param buf points to the geolocate buffer
- * \param dt is the desired timer interval in milliseconds
- * \param imageVel receives the velocity of the gimbal in North, East Down, meters
- * \return TRUE if the velocity was computed, else FALSE
- */
-BOOL getGeolocateBuffer(const GeolocateBuffer_t* buf, uint32_t dt, GeolocateTelemetry_t* geo)
-{
-    int newest, oldest, index;
+        // Angular deviations become offsets in the image plane
+        for(i = 0; i < num; i++)
+        {
+            tanY[i] = tanf(dev[start + i][0]);
+            tanZ[i] = tanf(dev[start + i][1]);
+        }
 
-    if(buf->holding < 2)
-        return FALSE;
+        if(pTerrain == NULL)
+        {
+            // Shift the vector to the image location by the offset in camera frame, scaled by the
+            // range. Notice that the offset is given positive up, but camera Z is positive down.
+            for(i = 0; i < num; i++)
+            {
+                north[i] = imageNED[NORTH] + imageRange*(tanY[i]*axisY[NORTH] - tanZ[i]*axisZ[NORTH]);
+                east[i]  = imageNED[EAST]  + imageRange*(tanY[i]*axisY[EAST]  - tanZ[i]*axisZ[EAST]);
+                down[i]  = imageNED[DOWN]  + imageRange*(tanY[i]*axisY[DOWN]  - tanZ[i]*axisZ[DOWN]);
+            }
 
-    // The newest entry is one behind the in pointer
-    newest = buf->in - 1;
-    if(newest < 0)
-        newest += GEOLOCATE_BUFFER_SIZE;
+            // Make each vector longer or shorter until it hits the same altitude as the image location
+            for(i = 0; i < num; i++)
+            {
+                float scale = (down[i] > 0) ? imageDown/down[i] : 0;
 
-    // If the user is asking for the newest buffer
-    if (dt == 0)
-    {
-        // Copy it out immediately and return TRUE
-        copyGeolocateTelemetry(&buf->geobuf[newest], geo);
-        return TRUE;
-    }
+                north[i] *= scale;
+                east[i]  *= scale;
+                down[i]  *= scale;
+            }
 
-    // The oldest entry (if holding == 1, then oldest and newest are the same)
-    oldest = newest - (buf->holding - 1);
-    if(oldest < 0)
-        oldest += GEOLOCATE_BUFFER_SIZE;
+            // Finally compute the new locations, any that pointed above the horizon are no good
+            for(i = 0; i < num; i++)
+            {
+                double *lla = posLLA[start + i];
+                BOOL good = (down[i] > 0);
 
-    // Go backwards in time until we match or exceed dt
-    index = newest - 1;
-    if(index < 0)
-        index += GEOLOCATE_BUFFER_SIZE;
+                lla[LAT] = addAngles(geo->base.posLat, north[i]/datum_meanRadius);
+                lla[LON] = addAngles(geo->base.posLon, east[i]/(datum_meanRadius*trig->cosLat));
+                lla[ALT] = geo->base.posAlt - down[i];
 
-    while (index != oldest)
-    {
-        // The difference in time in milliseconds
-        const GeolocateTelemetry_t *pOld = &buf->geobuf[index], *pNew = &buf->geobuf[newest];
-        int32_t diff = pNew->base.systemTime - pOld->base.systemTime;
+                if(slantRange != NULL)
+                    slantRange[start + i] = sqrtf(north[i]*north[i] + east[i]*east[i] + down[i]*down[i]);
 
-        // If we've got at least dt milliseconds of data
-        if (diff >= (int32_t)dt)
-        {
-            copyGeolocateTelemetry(pOld, geo);
-            return TRUE;
+                if(valid != NULL)
+                    valid[start + i] = good;
+
+                count += good;
+            }
         }
+        else
+        {
+            // Line of sight to each point in NED, normalized to a unit vector
+            for(i = 0; i < num; i++)
+            {
+                float scale = 1.0f/sqrtf(1.0f + tanY[i]*tanY[i] + tanZ[i]*tanZ[i]);
 
-        // Go back one more
-        if (--index < 0)
-            index += GEOLOCATE_BUFFER_SIZE;
-    }
+                north[i] = (axisX[NORTH] + tanY[i]*axisY[NORTH] - tanZ[i]*axisZ[NORTH])*scale;
+                east[i]  = (axisX[EAST]  + tanY[i]*axisY[EAST]  - tanZ[i]*axisZ[EAST])*scale;
+                down[i]  = (axisX[DOWN]  + tanY[i]*axisY[DOWN]  - tanZ[i]*axisZ[DOWN])*scale;
+            }
 
-    // Couldn't find a buffer at least dt milliseconds old
-    return FALSE;
+            // Rotate each line of sight to ECEF and follow it out to the terrain
+            for(i = 0; i < num; i++)
+            {
+                double unitECEF[NECEF], range;
+                BOOL good;
+
+                for(j = 0; j < NECEF; j++)
+                    unitECEF[j] = rotation[j][NORTH]*north[i] + rotation[j][EAST]*east[i] + rotation[j][DOWN]*down[i];
 
-}// getGeolocateBuffer
+                good = intersectRay(geo->posECEF, unitECEF, down[i], pTerrain, posLLA[start + i], &range);
 
+                if(slantRange != NULL)
+                    slantRange[start + i] = range;
+
+                if(valid != NULL)
+                    valid[start + i] = good;
+
+                count += good;
+            }
+        }
+    }
+
+    return count;
+
+}// geolocatePoints
 
 /*!
- * Push a new geolocate telemetry into a geolocate buffer
- * \param buf is the geolocate buffer to put new data into
- * \param geo is the new data to load, which will be copied into the buffer
+ * Geolocate the image footprint, i.e. the four corners of the image and its
+ * center, in a single pass. The corners are in the order that MISB ST 0601
+ * uses for KLV_UAS_CORNER1_LAT through KLV_UAS_CORNER4_LON: upper left, upper
+ * right, lower right, lower left.
+ *
+ * \param geo is the geolocate telemetry from the gimbal.
+ * \param pTerrain is the terrain model to intersect with, or NULL to use the
+ *        altitude of geo->imagePosLLA as with geolocatePoints().
+ * \param posLLA receives the four corners followed by the center.
+ * \param slantRange receives the slant range to each point in meters, can be NULL.
+ * \param valid receives TRUE for each point that was located, can be NULL.
+ * \return the number of points that were located.
  */
-void pushGeolocateBuffer(GeolocateBuffer_t* buf, const GeolocateTelemetry_t* geo)
+int geolocateFootprint(const GeolocateTelemetry_t *geo, const TerrainProvider_t *pTerrain,
+                       double posLLA[GEOLOCATE_FOOTPRINT][NLLA], double slantRange[GEOLOCATE_FOOTPRINT], BOOL valid[GEOLOCATE_FOOTPRINT])
 {
-    // Copy the data into the buffer, cannot do simple assignment
-    copyGeolocateTelemetry(geo, &buf->geobuf[buf->in]);
+    float h = 0.5f*geo->base.hfov, v = 0.5f*geo->base.vfov;
 
-    // Adjust in pointer, in always points to the next entry to go in, which is
-    // also the oldest entry when the buffer is full
-    buf->in++;
-    if(buf->in >= GEOLOCATE_BUFFER_SIZE)
-        buf->in = 0;
+    // Angular deviations of each point, in the same order as the KLV corners
+    float dev[GEOLOCATE_FOOTPRINT][2] =
+    {
+        {-h,  v},
+        { h,  v},
+        { h, -v},
+        {-h, -v},
+        { 0,  0}
+    };
 
-    // Count number of entries
-    if(buf->holding < GEOLOCATE_BUFFER_SIZE)
-        buf->holding++;
+    return geolocatePoints(geo, (const float (*)[2])dev, GEOLOCATE_FOOTPRINT, pTerrain, posLLA, slantRange, valid);
 
-}// pushGeolocateBuffer
+}// geolocateFootprint
 
 
 /*!
- * Copy a geolocate structure, which cannot be done with simple assignment due to the DCM pointers
+ * Copy a geolocate structure. The DCMs are held by value, so this is the same
+ * as simple assignment, and is kept for existing callers
  * \param source is the source structure whose contents are copied.
  * \param dest receives a copy of the data in source.
  */
 void copyGeolocateTelemetry(const GeolocateTelemetry_t* source, GeolocateTelemetry_t* dest)
 {
-    // Simple assignment here
     (*dest) = (*source);
-
-    // Now fix the pointers, the dest DCM data pointers need to be pointing at the dest data, not the source data
-    dest->cameraDcm.data = &dest->cameraDcmdata[0];
-    dest->gimbalDcm.data = &dest->gimbalDcmdata[0];
 }
 
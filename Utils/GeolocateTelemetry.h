@@ -11,21 +11,46 @@
  *  attitude data in multiple redundant forms, for the convenience of anyone
  *  who receives this data. The DecodeGeolocateTelemetry() function fills out
  *  the redundant data.
+ *
+ *  Consumers that only need some of the redundant data can decode with
+ *  DecodeGeolocateTelemetryLazy() instead, which only constructs the ECEF
+ *  position, the trig data and the gimbal and camera DCMs. The rest is
+ *  constructed by CompleteGeolocateTelemetry() the first time it's asked for,
+ *  and kept until the next packet is decoded into the structure.
  */
 
 #ifndef GEOLOCATETELEMETRY_H_
 #define GEOLOCATETELEMETRY_H_
 
 #include "earthposition.h"
-#include "quaternion.h"
+#include "dcm3.h"
 #include "Constants.h"
 #include "OrionPublicPacket.h"
 #include "OrionPublicPacketShim.h"
+#include "TerrainProvider.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif // __cplusplus
 
+//! Year, Month, Day, Hour, Minute and Second of GeolocateTelemetry_t
+#define GEOLOCATE_DATE          0x01
+
+//! velECEF of GeolocateTelemetry_t
+#define GEOLOCATE_VELOCITY      0x02
+
+//! gimbalEuler of GeolocateTelemetry_t
+#define GEOLOCATE_GIMBAL_EULER  0x04
+
+//! cameraQuat and cameraEuler of GeolocateTelemetry_t
+#define GEOLOCATE_CAMERA        0x08
+
+//! slantRange, imagePosECEF and imagePosLLA of GeolocateTelemetry_t
+#define GEOLOCATE_IMAGE_POS     0x10
+
+//! Every field of GeolocateTelemetry_t that can be constructed on demand
+#define GEOLOCATE_ALL           0x1F
+
 //! The information needed to determine location of gimbal image
 typedef struct
 {
@@ -65,7 +90,7 @@ typedef struct
 	float gimbalEuler[NUM_AXES];
 
     //! The DCM of the gimbal (body to nav NED)
-	structAllocateDCM(gimbalDcm);
+	DCM3_t gimbalDcm;
 
     //! Quaternion attitude of the camera (body to nav NED)
 	float cameraQuat[NQUATERNION];
@@ -74,7 +99,7 @@ typedef struct
 	float cameraEuler[NUM_AXES];
 
     //! The DCM of the camera (body to nav NED)
-	structAllocateDCM(cameraDcm);
+	DCM3_t cameraDcm;
 
 	//! Slant range to target in meters
 	float slantRange;
@@ -83,19 +108,13 @@ typedef struct
     double imagePosECEF[NECEF];
     double imagePosLLA[NLLA];
 
-}GeolocateTelemetry_t;
+    //! GEOLOCATE_ flags for the on demand fields that have been constructed for the current packet
+    UInt32 validFields;
 
-//! Number of entries to keep in the geolocate telemetry buffer
-#define GEOLOCATE_BUFFER_SIZE 100
+    //! Day number since the GPS epoch, plus one, that Year, Month and Day were constructed for
+    UInt32 dateDay;
 
-/*! A buffer of geolocate telemetry data */
-typedef struct
-{
-	GeolocateTelemetry_t geobuf[GEOLOCATE_BUFFER_SIZE];
-	uint32_t in;
-	uint32_t holding;
-	
-}GeolocateBuffer_t;
+}GeolocateTelemetry_t;
 
 //! Create a GeolocateTelemetry packet
 void FormGeolocateTelemetry(OrionPkt_t *pPkt, const GeolocateTelemetry_t *pGeo);
@@ -103,9 +122,18 @@ void FormGeolocateTelemetry(OrionPkt_t *pPkt, const GeolocateTelemetry_t *pGeo);
 //! Decode a GeolocateTelemetry packet
 BOOL DecodeGeolocateTelemetry(const OrionPkt_t *pPkt, GeolocateTelemetry_t *pGeo);
 
+//! Decode a GeolocateTelemetry packet, leaving the fields that can be constructed on demand for later
+BOOL DecodeGeolocateTelemetryLazy(const OrionPkt_t *pPkt, GeolocateTelemetry_t *pGeo);
+
 //! Convert a GeolocateTelemetryCore_t structure to a GeolocateTelemetry_t
 void ConvertGeolocateTelemetryCore(const GeolocateTelemetryCore_t *pCore, GeolocateTelemetry_t *pGeo);
 
+//! Convert a GeolocateTelemetryCore_t structure to a GeolocateTelemetry_t, leaving the fields that can be constructed on demand for later
+void ConvertGeolocateTelemetryCoreLazy(const GeolocateTelemetryCore_t *pCore, GeolocateTelemetry_t *pGeo);
+
+//! Construct the GEOLOCATE_ fields of a lazily converted GeolocateTelemetry_t that haven't been constructed yet
+void CompleteGeolocateTelemetry(GeolocateTelemetry_t *pGeo, UInt32 fields);
+
 //! Offset an image location according to a user click
 BOOL offsetImageLocation(const GeolocateTelemetry_t *geo, const double imagePosLLA[NLLA], float ydev, float zdev, double newPosLLA[NLLA], double* slantRangeM);
 
@@ -129,16 +157,24 @@ void offsetImageLocationOcean(const GeolocateTelemetry_t *geoloc, float deltaYaw
 //! Get the terrain intersection based on the current telemetry
 BOOL getTerrainIntersection(const GeolocateTelemetry_t *pGeo, float (*getElevationHAE)(double, double), double PosLLA[NLLA], double *pRange);
 
-//! Get the velocity of the terrain intersection
-BOOL getImageVelocity(const GeolocateBuffer_t* buf, uint32_t dt, float imageVel[NNED]);
+//! Get the terrain intersection based on the current telemetry, skipping empty space using a terrain provider's height bounds
+BOOL getTerrainIntersectionEx(const GeolocateTelemetry_t *pGeo, const TerrainProvider_t *pTerrain, double PosLLA[NLLA], double *pRange);
+
+//! Number of points that geolocatePoints() processes per block
+#define GEOLOCATE_BATCH 64
+
+//! Number of points in an image footprint: four corners and the center
+#define GEOLOCATE_FOOTPRINT 5
 
-//! Push a new geolocate telemetry into a geolocate buffer
-void pushGeolocateBuffer(GeolocateBuffer_t* buf, const GeolocateTelemetry_t* geo);
+//! Geolocate many image points at once, sharing the per-frame setup
+int geolocatePoints(const GeolocateTelemetry_t *geo, const float (*dev)[2], int n, const TerrainProvider_t *pTerrain,
+                    double (*posLLA)[NLLA], double *slantRange, BOOL *valid);
 
-//! Get a buffered geolocate telemetry structure
-BOOL getGeolocateBuffer(const GeolocateBuffer_t* buf, uint32_t dt, GeolocateTelemetry_t* geo);
+//! Geolocate the four image corners and the image center in a single pass
+int geolocateFootprint(const GeolocateTelemetry_t *geo, const TerrainProvider_t *pTerrain,
+                       double posLLA[GEOLOCATE_FOOTPRINT][NLLA], double slantRange[GEOLOCATE_FOOTPRINT], BOOL valid[GEOLOCATE_FOOTPRINT]);
 
-//! Copy a geolocate structure, which cannot be done with simple assignment due to the DCM pointers
+//! Copy a geolocate structure, which is the same as simple assignment
 void copyGeolocateTelemetry(const GeolocateTelemetry_t* source, GeolocateTelemetry_t* dest);
 
 #ifdef __cplusplus
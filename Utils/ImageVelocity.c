@@ -0,0 +1,355 @@
+#include "ImageVelocity.h"
+#include "earthrotation.h"
+#include <string.h>
+#include <math.h>
+
+// Sums with no new scatter in them decay towards zero, and get flushed to zero before they turn denormal,
+//   which would make every update an order of magnitude slower
+#define IMAGE_VELOCITY_TINY 1e-200
+
+static int solveFit(const ImageVelocity_t *pEst, double beta[NECEF][IMAGE_VELOCITY_TERMS], double M[IMAGE_VELOCITY_TERMS][IMAGE_VELOCITY_TERMS]);
+static void rotateToNED(const ImageVelocity_t *pEst, const double ecef[NECEF], float ned[NNED]);
+
+/*!
+ * Initialize an image velocity estimator
+ * \param pEst is the estimator to initialize
+ * \param TimeConstantMs is the milliseconds it takes the weight of a sample to
+ *        decay by a factor of e, which plays the same part as the dt argument
+ *        of getImageVelocity(). Longer is smoother but slower to respond.
+ * \param Acceleration should be TRUE to fit a quadratic and estimate acceleration
+ *        as well, which removes the lag a straight line has when the image is
+ *        speeding up or slowing down but makes the velocity noisier
+ */
+void imageVelocityInit(ImageVelocity_t *pEst, uint32_t TimeConstantMs, BOOL Acceleration)
+{
+    memset(pEst, 0, sizeof(ImageVelocity_t));
+    pEst->TimeConstant = ((TimeConstantMs > 0) ? TimeConstantMs : 1) * 1e-3;
+    pEst->Terms = Acceleration ? 3 : 2;
+
+}// imageVelocityInit
+
+
+/*!
+ * Start the fit over, keeping the estimator's settings
+ * \param pEst is the estimator
+ */
+void imageVelocityReset(ImageVelocity_t *pEst)
+{
+    double TimeConstant = pEst->TimeConstant;
+    int Terms = pEst->Terms;
+
+    memset(pEst, 0, sizeof(ImageVelocity_t));
+    pEst->TimeConstant = TimeConstant;
+    pEst->Terms = Terms;
+
+}// imageVelocityReset
+
+
+/*!
+ * Add a geolocate telemetry sample to the fit. This takes the same time no
+ * matter how many samples have gone before it.
+ * \param pEst is the estimator
+ * \param pGeo is the new sample, which should be newer than the last one and
+ *        must have GEOLOCATE_IMAGE_POS in its validFields
+ * \return TRUE if the sample was used, FALSE if it had no usable range data,
+ *         no image position or was a repeat
+ */
+BOOL imageVelocityUpdate(ImageVelocity_t *pEst, const GeolocateTelemetry_t *pGeo)
+{
+    const GeolocateTelemetryCore_t *pCore = &pGeo->base;
+    int i, j, k, n = 2*IMAGE_VELOCITY_TERMS - 1;
+
+    // Without range data, or with internal range estimates that assume the image isn't moving, there's nothing to fit
+    if ((pCore->rangeSource == RANGE_SRC_NONE) || (pCore->rangeSource == RANGE_SRC_INTERNAL))
+    {
+        imageVelocityReset(pEst);
+        return FALSE;
+    }
+
+    // A lazily converted sample whose image position was never constructed can't be fit, but says nothing against the samples before it
+    if ((pGeo->validFields & GEOLOCATE_IMAGE_POS) == 0)
+        return FALSE;
+
+    // Image positions from different range sources don't line up, and time going backwards means the gimbal rebooted
+    if ((pEst->Samples > 0) && ((pCore->rangeSource != pEst->rangeSource) || ((int32_t)(pCore->systemTime - pEst->LastTime) < 0)))
+        imageVelocityReset(pEst);
+
+    if (pEst->Samples > 0)
+    {
+        double dt = (pCore->systemTime - pEst->LastTime) * 1e-3;
+        double lambda, power[2*IMAGE_VELOCITY_TERMS - 1], S[2*IMAGE_VELOCITY_TERMS - 1], B[IMAGE_VELOCITY_TERMS];
+        double c[NECEF];
+
+        // The same sample twice adds nothing
+        if (dt <= 0.0)
+            return FALSE;
+
+        // Powers of -dt, for moving the origin of time up to the new sample
+        power[0] = 1.0;
+        for (k = 1; k < n; k++)
+            power[k] = -dt*power[k-1];
+
+        // Every existing sample gets older by dt, which decays its weight
+        lambda = exp(-dt/pEst->TimeConstant);
+
+        // Each sample's t becomes t - dt, so the sums of w*t^k expand binomially into the old sums
+        for (k = 0; k < n; k++)
+        {
+            double binomial = 1.0;
+
+            S[k] = 0.0;
+            for (j = k; j >= 0; j--)
+            {
+                S[k] += binomial*power[k-j]*pEst->S[j];
+                binomial = binomial*j/(k - j + 1);
+            }
+        }
+
+        for (i = 0; i < NECEF; i++)
+        {
+            for (k = 0; k < IMAGE_VELOCITY_TERMS; k++)
+            {
+                double binomial = 1.0;
+
+                B[k] = 0.0;
+                for (j = k; j >= 0; j--)
+                {
+                    B[k] += binomial*power[k-j]*pEst->B[i][j];
+                    binomial = binomial*j/(k - j + 1);
+                }
+            }
+
+            for (k = 0; k < IMAGE_VELOCITY_TERMS; k++)
+                pEst->B[i][k] = (fabs(B[k]) < IMAGE_VELOCITY_TINY) ? 0.0 : lambda*B[k];
+        }
+
+        for (k = 0; k < n; k++)
+            pEst->S[k] = lambda*S[k];
+
+        pEst->W2 *= lambda*lambda;
+
+        for (i = 0; i < NECEF; i++)
+        {
+            for (j = 0; j < NECEF; j++)
+                pEst->XX[i][j] = (fabs(pEst->XX[i][j]) < IMAGE_VELOCITY_TINY) ? 0.0 : lambda*pEst->XX[i][j];
+        }
+
+        // Then move the origin of position up to the new sample too, so the sums stay small
+        for (i = 0; i < NECEF; i++)
+            c[i] = pGeo->imagePosECEF[i] - pEst->Ref[i];
+
+        for (i = 0; i < NECEF; i++)
+        {
+            for (j = 0; j < NECEF; j++)
+                pEst->XX[i][j] += -c[i]*pEst->B[j][0] - c[j]*pEst->B[i][0] + c[i]*c[j]*pEst->S[0];
+        }
+
+        for (i = 0; i < NECEF; i++)
+        {
+            for (k = 0; k < IMAGE_VELOCITY_TERMS; k++)
+                pEst->B[i][k] -= c[i]*pEst->S[k];
+        }
+    }
+
+    // Note when the fit started, so we know how much time it covers
+    if (pEst->Samples == 0)
+        pEst->FirstTime = pCore->systemTime;
+
+    // The new sample sits at the origin of time and position, so it only adds to the weights
+    pEst->S[0] += 1.0;
+    pEst->W2 += 1.0;
+    pEst->Samples++;
+
+    // And it becomes the reference for next time
+    for (i = 0; i < NECEF; i++)
+        pEst->Ref[i] = pGeo->imagePosECEF[i];
+
+    pEst->LastTime = pCore->systemTime;
+    pEst->rangeSource = pCore->rangeSource;
+    pEst->llaTrig = pGeo->llaTrig;
+
+    return TRUE;
+
+}// imageVelocityUpdate
+
+
+/*!
+ * Get the image velocity in NED
+ * \param pEst is the estimator
+ * \param imageVel receives the velocity of the image in meters per second
+ * \return TRUE if there's an estimate, FALSE if the fit doesn't cover a time constant yet
+ */
+BOOL imageVelocityGet(const ImageVelocity_t *pEst, float imageVel[NNED])
+{
+    return imageVelocityGetEx(pEst, imageVel, NULL, NULL);
+
+}// imageVelocityGet
+
+
+/*!
+ * Get the image velocity, acceleration and velocity covariance in NED, as of
+ * the newest sample. This takes the same time no matter how many samples have
+ * gone into the fit.
+ * \param pEst is the estimator
+ * \param imageVel receives the velocity of the image in meters per second
+ * \param imageAccel receives the acceleration of the image in meters per second
+ *        squared, which is zero unless the estimator fits acceleration. Can be NULL.
+ * \param velCov receives the approximate covariance of imageVel in meters squared
+ *        per second squared. Can be NULL.
+ * \return TRUE if there's an estimate, FALSE if the fit doesn't cover a time constant yet
+ */
+BOOL imageVelocityGetEx(const ImageVelocity_t *pEst, float imageVel[NNED], float imageAccel[NNED], float velCov[NNED][NNED])
+{
+    double beta[NECEF][IMAGE_VELOCITY_TERMS], M[IMAGE_VELOCITY_TERMS][IMAGE_VELOCITY_TERMS];
+    double vel[NECEF], accel[NECEF];
+    int i, j, k, Terms = solveFit(pEst, beta, M);
+
+    if (Terms == 0)
+        return FALSE;
+
+    // The fit is x = beta0 + beta1*t + beta2*t^2 with t = 0 at the newest sample
+    for (i = 0; i < NECEF; i++)
+    {
+        vel[i] = beta[i][1];
+        accel[i] = (Terms > 2) ? 2.0*beta[i][2] : 0.0;
+    }
+
+    rotateToNED(pEst, vel, imageVel);
+
+    if (imageAccel != NULL)
+        rotateToNED(pEst, accel, imageAccel);
+
+    if (velCov != NULL)
+    {
+        double neff = pEst->S[0]*pEst->S[0]/pEst->W2, scale, cov[NECEF][NECEF], col[NECEF], ned[NNED], tmp[NNED][NECEF];
+
+        // Weighted scatter of the samples about the fit, scaled to a variance by the effective number of samples
+        scale = M[1][1]/(pEst->S[0]*(1.0 - Terms/neff));
+
+        for (i = 0; i < NECEF; i++)
+        {
+            for (j = 0; j < NECEF; j++)
+            {
+                double rss = pEst->XX[i][j];
+
+                for (k = 0; k < Terms; k++)
+                    rss -= beta[i][k]*pEst->B[j][k];
+
+                cov[i][j] = rss*scale;
+            }
+        }
+
+        // Rotate into NED, R*C*R' with the columns of C rotated first and then the rows of the result
+        for (j = 0; j < NECEF; j++)
+        {
+            for (i = 0; i < NECEF; i++)
+                col[i] = cov[i][j];
+
+            ecefToNEDtrig(col, ned, &pEst->llaTrig);
+
+            for (i = 0; i < NNED; i++)
+                tmp[i][j] = ned[i];
+        }
+
+        for (i = 0; i < NNED; i++)
+        {
+            ecefToNEDtrig(tmp[i], ned, &pEst->llaTrig);
+
+            for (j = 0; j < NNED; j++)
+                velCov[i][j] = (float)ned[j];
+        }
+    }
+
+    return TRUE;
+
+}// imageVelocityGetEx
+
+
+/*!
+ * Solve the weighted least squares fit on each ECEF axis
+ * \param pEst is the estimator
+ * \param beta receives the polynomial coefficients for each axis
+ * \param M receives the inverse of the normal matrix
+ * \return the number of terms in the fit, or 0 if there isn't enough data for one
+ */
+static int solveFit(const ImageVelocity_t *pEst, double beta[NECEF][IMAGE_VELOCITY_TERMS], double M[IMAGE_VELOCITY_TERMS][IMAGE_VELOCITY_TERMS])
+{
+    const double *S = pEst->S;
+    int i, k, Terms = pEst->Terms;
+    double det;
+
+    // Like getImageVelocity(), wait for the samples to span the time constant, and there have to be more
+    //   of them than terms to have any idea of the scatter
+    if (((pEst->LastTime - pEst->FirstTime)*1e-3 < pEst->TimeConstant) || (pEst->Samples <= (uint32_t)Terms) ||
+        (pEst->W2 <= 0.0) || (S[0]*S[0]/pEst->W2 <= Terms))
+        return 0;
+
+    memset(M, 0, sizeof(double)*IMAGE_VELOCITY_TERMS*IMAGE_VELOCITY_TERMS);
+
+    if (Terms == 2)
+    {
+        // Normal matrix is [S0 S1; S1 S2]
+        det = S[0]*S[2] - S[1]*S[1];
+
+        // If the samples are bunched up in time the fit can't tell position from velocity
+        if (det <= 1e-12*S[0]*S[2])
+            return 0;
+
+        M[0][0] = S[2]/det;
+        M[0][1] = M[1][0] = -S[1]/det;
+        M[1][1] = S[0]/det;
+    }
+    else
+    {
+        // Normal matrix is [S0 S1 S2; S1 S2 S3; S2 S3 S4], inverted by cofactors since it's symmetric
+        double c00 = S[2]*S[4] - S[3]*S[3];
+        double c01 = S[2]*S[3] - S[1]*S[4];
+        double c02 = S[1]*S[3] - S[2]*S[2];
+        double c11 = S[0]*S[4] - S[2]*S[2];
+        double c12 = S[1]*S[2] - S[0]*S[3];
+        double c22 = S[0]*S[2] - S[1]*S[1];
+
+        det = S[0]*c00 + S[1]*c01 + S[2]*c02;
+
+        if (det <= 1e-12*S[0]*S[2]*S[4])
+            return 0;
+
+        M[0][0] = c00/det; M[0][1] = M[1][0] = c01/det; M[0][2] = M[2][0] = c02/det;
+        M[1][1] = c11/det; M[1][2] = M[2][1] = c12/det;
+        M[2][2] = c22/det;
+    }
+
+    // beta = M*B on each axis
+    for (i = 0; i < NECEF; i++)
+    {
+        for (k = 0; k < Terms; k++)
+        {
+            int j;
+
+            beta[i][k] = 0.0;
+            for (j = 0; j < Terms; j++)
+                beta[i][k] += M[k][j]*pEst->B[i][j];
+        }
+    }
+
+    return Terms;
+
+}// solveFit
+
+
+/*!
+ * Rotate an ECEF vector into NED at the gimbal's position in the newest sample, as getImageVelocity() does
+ * \param pEst is the estimator
+ * \param ecef is the vector in ECEF
+ * \param ned receives the vector in NED
+ */
+static void rotateToNED(const ImageVelocity_t *pEst, const double ecef[NECEF], float ned[NNED])
+{
+    double result[NNED];
+
+    ecefToNEDtrig(ecef, result, &pEst->llaTrig);
+    ned[NORTH] = (float)result[NORTH];
+    ned[EAST] = (float)result[EAST];
+    ned[DOWN] = (float)result[DOWN];
+
+}// rotateToNED
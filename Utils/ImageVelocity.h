@@ -0,0 +1,91 @@
+#ifndef IMAGEVELOCITY_H
+#define IMAGEVELOCITY_H
+
+/*!
+ * \file
+ * Streaming estimate of the velocity of the image (the terrain intersection
+ * of the line of sight), updated with every geolocate telemetry sample in
+ * constant time rather than by searching a history for an older sample to
+ * difference against.
+ *
+ * The estimator fits a straight line, or a quadratic if acceleration is
+ * wanted, to imagePosECEF against time by least squares, with the weight of
+ * each sample decaying exponentially with its age. The weighted sums behind
+ * the fit are kept relative to the newest sample and moved up with each new
+ * one, so neither an update nor a query depends on how many samples have
+ * gone into the fit. The scatter of the samples about the fit gives an
+ * approximate covariance for the velocity.
+ *
+ * Like getImageVelocity(), samples without range data or with internally
+ * estimated range (which assumes the image isn't moving) aren't used, and
+ * the fit starts over if the range source changes or the gimbal's system
+ * time goes backwards.
+ *
+ * The fit reads imagePosECEF, so samples converted with
+ * ConvertGeolocateTelemetryCoreLazy() or DecodeGeolocateTelemetryLazy() must
+ * have GEOLOCATE_IMAGE_POS completed with CompleteGeolocateTelemetry() first,
+ * else imageVelocityUpdate() ignores them.
+ */
+
+#include "GeolocateTelemetry.h"
+
+// C++ compilers: don't mangle us
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Number of polynomial terms in the largest fit, which is a quadratic
+#define IMAGE_VELOCITY_TERMS 3
+
+typedef struct
+{
+    //! Seconds for the weight of a sample to decay by a factor of e
+    double TimeConstant;
+
+    //! Number of polynomial terms being fit, 2 for velocity only or 3 for acceleration as well
+    int Terms;
+
+    //! Number of samples in the fit since it last started over
+    uint32_t Samples;
+
+    //! System time of the first sample since the fit started over
+    uint32_t FirstTime;
+
+    //! System time, range source, ECEF image position and gimbal position trig of the newest sample
+    uint32_t LastTime;
+    RangeDataSrc_t rangeSource;
+    double Ref[NECEF];
+    llaTrig_t llaTrig;
+
+    //! Sums of w*t^k for k = 0 to 4, with t in seconds relative to the newest sample, and of w^2
+    double S[2*IMAGE_VELOCITY_TERMS - 1];
+    double W2;
+
+    //! Sums of w*t^k*x for k = 0 to 2 on each ECEF axis, with x in meters relative to the newest sample
+    double B[NECEF][IMAGE_VELOCITY_TERMS];
+
+    //! Sums of w*x*y for each pair of ECEF axes
+    double XX[NECEF][NECEF];
+
+} ImageVelocity_t;
+
+//! Initialize an image velocity estimator
+void imageVelocityInit(ImageVelocity_t *pEst, uint32_t TimeConstantMs, BOOL Acceleration);
+
+//! Start the fit over
+void imageVelocityReset(ImageVelocity_t *pEst);
+
+//! Add a geolocate telemetry sample, which must have GEOLOCATE_IMAGE_POS in its validFields, to the fit
+BOOL imageVelocityUpdate(ImageVelocity_t *pEst, const GeolocateTelemetry_t *pGeo);
+
+//! Get the image velocity in NED
+BOOL imageVelocityGet(const ImageVelocity_t *pEst, float imageVel[NNED]);
+
+//! Get the image velocity, acceleration and velocity covariance in NED
+BOOL imageVelocityGetEx(const ImageVelocity_t *pEst, float imageVel[NNED], float imageAccel[NNED], float velCov[NNED][NNED]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // IMAGEVELOCITY_H
@@ -7,6 +7,8 @@
 #include "OrionPublicProtocol.h"
 #include "OrionPublicPacketShim.h"
 
+#include <string.h>
+
 
 //! \return the packet data pointer from the packet
 uint8_t* getOrionPublicPacketData(void* pkt)
@@ -37,3 +39,18 @@ uint32_t getOrionPublicPacketID(const void* pkt)
 {
 	return ((OrionPkt_t*)pkt)->ID;
 }
+
+//! Point a view at a packet without copying it
+void makeOrionPktView(OrionPktView_t *pView, const OrionPkt_t *pPkt)
+{
+	pView->pPkt = pPkt;
+	pView->ID = pPkt->ID;
+	pView->Length = pPkt->Length;
+	pView->Time = 0;
+}
+
+//! Copy out just the header, payload and checksum that a view points to
+void copyOrionPktView(const OrionPktView_t *pView, OrionPkt_t *pPkt)
+{
+	memcpy(pPkt, pView->pPkt, pView->Length + ORION_PKT_OVERHEAD);
+}
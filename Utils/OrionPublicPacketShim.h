@@ -19,10 +19,33 @@ extern "C" {
 typedef TrilliumPkt_t OrionPkt_t;
 typedef TrilliumPktInfo_t OrionPktInfo_t;
 
+//! Read-only view of a packet that lives in someone else's buffer (e.g. a receive ring)
+typedef struct
+{
+    const OrionPkt_t *pPkt; //!< Packet header and payload, only valid until the buffer is reused
+    UInt8 ID;               //!< Packet ID
+    UInt8 Length;           //!< Payload length in bytes
+    UInt64 Time;            //!< Host time in microseconds that the packet was received at, or zero
+} OrionPktView_t;
+
 // And they share the same basic parsing functions
-#define LookForOrionPacketInByte(a, b)      LookForTrilliumPacketInByte((TrilliumPkt_t *)a, ORION_SYNC, b)
-#define LookForOrionPacketInByteEx(a, b, c) LookForTrilliumPacketInByteEx((TrilliumPkt_t *)a, (TrilliumPktInfo_t *)b, ORION_SYNC, c)
-#define MakeOrionPacket(a, b, c)            MakeTrilliumPacket(a, ORION_SYNC, b, c)
+#define LookForOrionPacketInByte(a, b)                  LookForTrilliumPacketInByte((TrilliumPkt_t *)a, ORION_SYNC, b)
+#define LookForOrionPacketInByteEx(a, b, c)             LookForTrilliumPacketInByteEx((TrilliumPkt_t *)a, (TrilliumPktInfo_t *)b, ORION_SYNC, c)
+#define LookForOrionPacketsInBuffer(a, b, c, d, e)      LookForTrilliumPacketsInBuffer((TrilliumPkt_t *)a, ORION_SYNC, b, c, d, e)
+#define LookForOrionPacketsInBufferEx(a, b, c, d, e, f) LookForTrilliumPacketsInBufferEx((TrilliumPkt_t *)a, (TrilliumPktInfo_t *)b, ORION_SYNC, c, d, e, f)
+#define MakeOrionPacket(a, b, c)                        MakeTrilliumPacket(a, ORION_SYNC, b, c)
+
+// Packet view helpers
+void makeOrionPktView(OrionPktView_t *pView, const OrionPkt_t *pPkt);
+void copyOrionPktView(const OrionPktView_t *pView, OrionPkt_t *pPkt);
+
+// Any of the generated decode functions can be used on a view's packet directly, e.g.
+//   decodeGeolocateTelemetryCorePacketStructure(getOrionPktViewPacket(&View), &Geo)
+#define getOrionPktViewPacket(pView) ((const void *)(pView)->pPkt)
+
+// The same thing, as a macro so the decode function is called directly with its own types rather
+//   than through a cast function pointer, e.g. decodeOrionPktView(&View, decodeOrionCameraStatePacketStructure, &Camera)
+#define decodeOrionPktView(pView, Decode, pUser) Decode(getOrionPktViewPacket(pView), (pUser))
 
 // Defines for backward compatibility. NOTE: THESE *WILL* BE DEPRECATED IN THE FUTURE
 #define encodeOrionCmdPacketStructure encodeOrionCmdPacket
@@ -0,0 +1,365 @@
+#include "Orthorectify.h"
+#include "WGS84.h"
+#include <math.h>
+#include <string.h>
+
+static void tileCoordinates(const OrthoTile_t *pTile, const double posLLA[NLLA], float *pX, float *pY);
+static double mercatorY(double lat);
+static int drawTriangle(const OrthoImage_t *pImage, OrthoImage_t *pOut, const float x[3], const float y[3], const float u[3], const float v[3]);
+static void sampleSpan(const OrthoImage_t *pImage, uint8_t *pDest, int count, float u, float v, float dudx, float dvdx);
+
+
+/*!
+ * Set up a mesh of image points
+ * \param pMesh is the mesh to set up
+ * \param cols is the number of points across the image, from 2 to ORTHO_MESH_MAX_SIDE
+ * \param rows is the number of points down the image, from 2 to ORTHO_MESH_MAX_SIDE
+ * \return TRUE if the mesh was set up, FALSE if it has too few or too many points
+ */
+BOOL orthoMeshInit(OrthoMesh_t *pMesh, int cols, int rows)
+{
+    memset(pMesh, 0, sizeof(OrthoMesh_t));
+
+    if((cols < 2) || (rows < 2) || (cols > ORTHO_MESH_MAX_SIDE) || (rows > ORTHO_MESH_MAX_SIDE))
+        return FALSE;
+
+    pMesh->cols = cols;
+    pMesh->rows = rows;
+
+    return TRUE;
+
+}// orthoMeshInit
+
+
+/*!
+ * Geolocate every point of a mesh for one frame, all in one batch
+ * \param pMesh is the mesh to project
+ * \param pGeo is the telemetry at the time the frame was captured
+ * \param imageWidth is the width of the frame in pixels
+ * \param imageHeight is the height of the frame in pixels
+ * \param hfov is the horizontal field of view in radians, or 0 to use the one in pGeo
+ * \param vfov is the vertical field of view in radians, or 0 to use the one in pGeo
+ * \param pTerrain is the terrain to drape the frame on, or NULL to project it onto
+ *        the plane of the image location, like offsetImageLocation()
+ * \return the number of points that were located
+ */
+int orthoMeshProject(OrthoMesh_t *pMesh, const GeolocateTelemetry_t *pGeo, int imageWidth, int imageHeight,
+                     float hfov, float vfov, const TerrainProvider_t *pTerrain)
+{
+    float focalX, focalY;
+    int row, col, i;
+
+    if(hfov <= 0)
+        hfov = pGeo->base.hfov;
+
+    if(vfov <= 0)
+        vfov = pGeo->base.vfov;
+
+    // Focal lengths in pixels, from the field of view across the whole image
+    focalX = 0.5f*imageWidth/tanf(0.5f*hfov);
+    focalY = 0.5f*imageHeight/tanf(0.5f*vfov);
+
+    // Spread the points from edge to edge, and work out the angle to each one from the middle of the image
+    for(row = 0, i = 0; row < pMesh->rows; row++)
+    {
+        for(col = 0; col < pMesh->cols; col++, i++)
+        {
+            pMesh->u[i] = (float)imageWidth*col/(pMesh->cols - 1);
+            pMesh->v[i] = (float)imageHeight*row/(pMesh->rows - 1);
+            pMesh->dev[i][0] = atanf((pMesh->u[i] - 0.5f*imageWidth)/focalX);
+            pMesh->dev[i][1] = atanf((0.5f*imageHeight - pMesh->v[i])/focalY);
+        }
+    }
+
+    pMesh->imageWidth = imageWidth;
+    pMesh->imageHeight = imageHeight;
+
+    // Then geolocate them all at once
+    pMesh->located = geolocatePoints(pGeo, (const float (*)[2])pMesh->dev, i, pTerrain, pMesh->posLLA, NULL, pMesh->valid);
+
+    return pMesh->located;
+
+}// orthoMeshProject
+
+
+/*!
+ * Fit a lat/lon tile around every point of a mesh that was located, with
+ * pixels that are square on the ground
+ * \param pTile receives the tile
+ * \param pMesh is a projected mesh
+ * \param maxSize is the width or height of the tile in pixels, whichever is longer
+ * \return TRUE if the tile was fit, FALSE if none of the mesh was located
+ */
+BOOL orthoTileFit(OrthoTile_t *pTile, const OrthoMesh_t *pMesh, int maxSize)
+{
+    double width, height, scale;
+    int i, n = pMesh->rows*pMesh->cols;
+
+    pTile->west =  pTile->south =  1e9;
+    pTile->east =  pTile->north = -1e9;
+    pTile->mercator = FALSE;
+
+    for(i = 0; i < n; i++)
+    {
+        if(!pMesh->valid[i])
+            continue;
+
+        pTile->west  = MIN(pTile->west,  pMesh->posLLA[i][LON]);
+        pTile->east  = MAX(pTile->east,  pMesh->posLLA[i][LON]);
+        pTile->south = MIN(pTile->south, pMesh->posLLA[i][LAT]);
+        pTile->north = MAX(pTile->north, pMesh->posLLA[i][LAT]);
+    }
+
+    if(pTile->east < pTile->west)
+        return FALSE;
+
+    // Ground size of the box, with east and west squeezed together away from the equator
+    width = (pTile->east - pTile->west)*cos(0.5*(pTile->north + pTile->south));
+    height = pTile->north - pTile->south;
+    scale = maxSize/MAX(MAX(width, height), 1e-12);
+
+    pTile->width = MAX(1, (int)(width*scale + 0.5));
+    pTile->height = MAX(1, (int)(height*scale + 0.5));
+
+    return TRUE;
+
+}// orthoTileFit
+
+
+/*!
+ * Set up a square web mercator tile, numbered the same way as the usual
+ * slippy map tiles, x going east from 180 degrees west and y going south
+ * from the top of the map
+ * \param pTile receives the tile
+ * \param zoom is the zoom level, with 2^zoom tiles along each side of the map
+ * \param x is the column of the tile
+ * \param y is the row of the tile
+ * \param size is the width and height of the tile in pixels, usually 256
+ */
+void orthoTileXYZ(OrthoTile_t *pTile, int zoom, int x, int y, int size)
+{
+    double tiles = ldexp(1.0, zoom);
+
+    pTile->west  = PId*(2.0*x/tiles - 1.0);
+    pTile->east  = PId*(2.0*(x + 1)/tiles - 1.0);
+    pTile->north = atan(sinh(PId*(1.0 - 2.0*y/tiles)));
+    pTile->south = atan(sinh(PId*(1.0 - 2.0*(y + 1)/tiles)));
+    pTile->width = pTile->height = size;
+    pTile->mercator = TRUE;
+
+}// orthoTileXYZ
+
+
+/*!
+ * Warp a frame onto a map tile using a mesh that was projected for it. Each
+ * cell of the mesh whose corners were all located is drawn as two triangles.
+ * Pixels that the frame doesn't cover are left as they were.
+ * \param pMesh is the mesh, projected with the telemetry for this frame
+ * \param pImage is the frame, which must be the size the mesh was projected for and at least 2x2
+ * \param pTile is the map area that the output covers
+ * \param pOut is the output image, with the size of the tile and the same number of channels as the frame
+ * \return the number of tile pixels that were drawn, or -1 if the images don't match
+ */
+int orthoWarp(const OrthoMesh_t *pMesh, const OrthoImage_t *pImage, const OrthoTile_t *pTile, OrthoImage_t *pOut)
+{
+    float tileX[ORTHO_MESH_MAX], tileY[ORTHO_MESH_MAX];
+    int row, col, i, n = pMesh->rows*pMesh->cols, count = 0;
+
+    if((pImage->channels != pOut->channels) || (pImage->width < 2) || (pImage->height < 2) ||
+       (pImage->width != pMesh->imageWidth) || (pImage->height != pMesh->imageHeight) ||
+       (pOut->width != pTile->width) || (pOut->height != pTile->height))
+        return -1;
+
+    // Where each point of the mesh lands on the tile
+    for(i = 0; i < n; i++)
+    {
+        if(pMesh->valid[i])
+            tileCoordinates(pTile, pMesh->posLLA[i], &tileX[i], &tileY[i]);
+    }
+
+    // Two triangles for each cell of the mesh, split along the same diagonal every time so they fit together
+    for(row = 0; row < pMesh->rows - 1; row++)
+    {
+        for(col = 0; col < pMesh->cols - 1; col++)
+        {
+            int corner[4], tri[2][3] = { { 0, 1, 3 }, { 0, 3, 2 } }, t, k;
+
+            corner[0] = row*pMesh->cols + col;
+            corner[1] = corner[0] + 1;
+            corner[2] = corner[0] + pMesh->cols;
+            corner[3] = corner[2] + 1;
+
+            for(t = 0; t < 2; t++)
+            {
+                float x[3], y[3], u[3], v[3];
+                BOOL good = TRUE;
+
+                for(k = 0; k < 3; k++)
+                {
+                    i = corner[tri[t][k]];
+                    good = good && pMesh->valid[i];
+                    x[k] = tileX[i];
+                    y[k] = tileY[i];
+                    u[k] = pMesh->u[i];
+                    v[k] = pMesh->v[i];
+                }
+
+                // Points that didn't hit the ground leave a hole
+                if(good)
+                    count += drawTriangle(pImage, pOut, x, y, u, v);
+            }
+        }
+    }
+
+    return count;
+
+}// orthoWarp
+
+
+/*!
+ * Find where a position lands on a tile
+ * \param pTile is the tile
+ * \param posLLA is the position
+ * \param pX receives the distance from the left edge of the tile in pixels
+ * \param pY receives the distance from the top edge of the tile in pixels
+ */
+static void tileCoordinates(const OrthoTile_t *pTile, const double posLLA[NLLA], float *pX, float *pY)
+{
+    *pX = (float)((posLLA[LON] - pTile->west)/(pTile->east - pTile->west)*pTile->width);
+
+    if(pTile->mercator)
+    {
+        double top = mercatorY(pTile->north);
+
+        *pY = (float)((top - mercatorY(posLLA[LAT]))/(top - mercatorY(pTile->south))*pTile->height);
+    }
+    else
+        *pY = (float)((pTile->north - posLLA[LAT])/(pTile->north - pTile->south)*pTile->height);
+
+}// tileCoordinates
+
+
+//! Web mercator northing of a latitude, in units of the earth's radius
+static double mercatorY(double lat)
+{
+    return log(tan(0.25*PId + 0.5*lat));
+
+}// mercatorY
+
+
+/*!
+ * Draw one triangle of the warped frame. Image coordinates vary linearly
+ * across the triangle, so each row of it is a straight line through the
+ * frame that's sampled at a constant step.
+ * \param pImage is the frame
+ * \param pOut is the tile image
+ * \param x is the distance of each corner from the left edge of the tile in pixels
+ * \param y is the distance of each corner from the top edge of the tile in pixels
+ * \param u is the image column of each corner
+ * \param v is the image row of each corner
+ * \return the number of tile pixels that were drawn
+ */
+static int drawTriangle(const OrthoImage_t *pImage, OrthoImage_t *pOut, const float x[3], const float y[3], const float u[3], const float v[3])
+{
+    float det, dudx, dudy, dvdx, dvdy, top, bottom;
+    int lo = 0, mid = 1, hi = 2, row, rowEnd, count = 0;
+
+    // Image coordinates as a plane over the tile, which a triangle with no area doesn't have
+    det = (x[1] - x[0])*(y[2] - y[0]) - (x[2] - x[0])*(y[1] - y[0]);
+    if(fabsf(det) < 1e-6f)
+        return 0;
+
+    dudx = ((u[1] - u[0])*(y[2] - y[0]) - (u[2] - u[0])*(y[1] - y[0]))/det;
+    dudy = ((u[2] - u[0])*(x[1] - x[0]) - (u[1] - u[0])*(x[2] - x[0]))/det;
+    dvdx = ((v[1] - v[0])*(y[2] - y[0]) - (v[2] - v[0])*(y[1] - y[0]))/det;
+    dvdy = ((v[2] - v[0])*(x[1] - x[0]) - (v[1] - v[0])*(x[2] - x[0]))/det;
+
+    // Sort the corners from top to bottom
+    if(y[lo] > y[mid]) { int t = lo; lo = mid; mid = t; }
+    if(y[mid] > y[hi]) { int t = mid; mid = hi; hi = t; }
+    if(y[lo] > y[mid]) { int t = lo; lo = mid; mid = t; }
+
+    // Rows whose pixel centers are inside the triangle, clipped to the tile
+    top = MAX(y[lo], 0.0f);
+    bottom = MIN(y[hi], (float)pOut->height);
+    if(top >= bottom)
+        return 0;
+
+    row = (int)ceilf(top - 0.5f);
+    rowEnd = (int)ceilf(bottom - 0.5f);
+
+    for(; row < rowEnd; row++)
+    {
+        float center = row + 0.5f, left, right, t;
+        int col, colEnd;
+
+        // One side of the row is on the long edge, the other on whichever short edge spans this row
+        t = (center - y[lo])/(y[hi] - y[lo]);
+        left = x[lo] + t*(x[hi] - x[lo]);
+
+        if(center < y[mid])
+            right = x[lo] + (center - y[lo])/(y[mid] - y[lo])*(x[mid] - x[lo]);
+        else
+            right = x[mid] + (center - y[mid])/(y[hi] - y[mid])*(x[hi] - x[mid]);
+
+        if(left > right) { t = left; left = right; right = t; }
+
+        // Pixels whose centers are inside, with shared edges only drawn by one of the two triangles
+        col = (int)ceilf(MAX(left, 0.0f) - 0.5f);
+        colEnd = (int)ceilf(MIN(right, (float)pOut->width) - 0.5f);
+        if(col >= colEnd)
+            continue;
+
+        sampleSpan(pImage, pOut->pData + (size_t)row*pOut->stride + (size_t)col*pOut->channels, colEnd - col,
+                   u[0] + dudx*(col + 0.5f - x[0]) + dudy*(center - y[0]),
+                   v[0] + dvdx*(col + 0.5f - x[0]) + dvdy*(center - y[0]), dudx, dvdx);
+
+        count += colEnd - col;
+    }
+
+    return count;
+
+}// drawTriangle
+
+
+/*!
+ * Sample a straight line through a frame into a row of tile pixels, bilinearly
+ * interpolating between the four image pixels around each sample. The step
+ * is done in 16.16 fixed point and the interpolation in 8 bit weights, which
+ * keeps the loop to integer work.
+ * \param pImage is the frame
+ * \param pDest is the first tile pixel to write
+ * \param count is the number of tile pixels to write
+ * \param u is the image column of the first sample
+ * \param v is the image row of the first sample
+ * \param dudx is the change in image column from one sample to the next
+ * \param dvdx is the change in image row from one sample to the next
+ */
+static void sampleSpan(const OrthoImage_t *pImage, uint8_t *pDest, int count, float u, float v, float dudx, float dvdx)
+{
+    const int channels = pImage->channels, stride = pImage->stride;
+
+    // Samples past the edge of the frame take the edge pixels, short of the last one so there's always one to the right and below
+    const int32_t maxU = ((pImage->width - 1) << 16) - 1, maxV = ((pImage->height - 1) << 16) - 1;
+
+    // Pixel centers are at half pixels
+    int32_t fixedU = (int32_t)((u - 0.5f)*65536.0f), fixedV = (int32_t)((v - 0.5f)*65536.0f);
+    int32_t stepU = (int32_t)(dudx*65536.0f), stepV = (int32_t)(dvdx*65536.0f);
+    int i, c;
+
+    for(i = 0; i < count; i++, pDest += channels, fixedU += stepU, fixedV += stepV)
+    {
+        int32_t su = MIN(MAX(fixedU, 0), maxU), sv = MIN(MAX(fixedV, 0), maxV);
+        uint32_t fu = (su >> 8) & 0xFF, fv = (sv >> 8) & 0xFF;
+        const uint8_t *p0 = pImage->pData + (size_t)(sv >> 16)*stride + (size_t)(su >> 16)*channels, *p1 = p0 + stride;
+
+        for(c = 0; c < channels; c++)
+        {
+            uint32_t top = (p0[c] << 8) + fu*(p0[c + channels] - p0[c]);
+            uint32_t bottom = (p1[c] << 8) + fu*(p1[c + channels] - p1[c]);
+
+            pDest[c] = (uint8_t)(((top << 8) + fv*(bottom - top) + 0x8000) >> 16);
+        }
+    }
+
+}// sampleSpan
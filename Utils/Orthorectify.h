@@ -0,0 +1,115 @@
+#ifndef ORTHORECTIFY_H
+#define ORTHORECTIFY_H
+
+/*!
+ * \file Orthorectify.h
+ * \brief Drape video frames onto map tiles using geolocate telemetry.
+ *
+ * A frame is described by a mesh of points spread evenly across the image,
+ * from corner to corner. Every point of the mesh is geolocated in one call to
+ * geolocatePoints(), against the terrain if there's a terrain provider or the
+ * plane of the image location if not. The frame is then warped onto a map
+ * tile by drawing each cell of the mesh as two triangles, along which image
+ * coordinates are interpolated linearly and the frame is sampled bilinearly.
+ * A finer mesh follows the terrain and the perspective more closely, a
+ * coarser one geolocates faster.
+ *
+ * Tiles are either plain lat/lon rasters or web mercator, like the usual
+ * slippy map tiles. Pixels of the tile that the frame doesn't cover are left
+ * alone, so frames can be draped one after another onto the same tile.
+ */
+
+#include "GeolocateTelemetry.h"
+
+// C++ compilers: don't mangle us
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Most points along each side of a mesh
+#define ORTHO_MESH_MAX_SIDE 33
+
+//! Most points in a mesh
+#define ORTHO_MESH_MAX (ORTHO_MESH_MAX_SIDE * ORTHO_MESH_MAX_SIDE)
+
+//! An image with interleaved 8 bit channels, e.g. RGB24 from StreamGetVideoFrame()
+typedef struct
+{
+    //! First pixel of the top row
+    uint8_t *pData;
+
+    //! Size in pixels, bytes from one row to the next, and bytes per pixel
+    int width;
+    int height;
+    int stride;
+    int channels;
+
+} OrthoImage_t;
+
+//! Map area that a tile image covers
+typedef struct
+{
+    //! Edges of the tile in radians
+    double west;
+    double south;
+    double east;
+    double north;
+
+    //! Size of the tile image in pixels
+    int width;
+    int height;
+
+    //! TRUE if rows are spaced evenly in web mercator, FALSE if they're spaced evenly in latitude
+    BOOL mercator;
+
+} OrthoTile_t;
+
+//! Image points geolocated for one frame
+typedef struct
+{
+    //! Points across and down the image
+    int cols;
+    int rows;
+
+    //! Size in pixels of the image that the mesh was last projected for
+    int imageWidth;
+    int imageHeight;
+
+    //! Pixel position of each point in the image, in rows starting from the top left corner
+    float u[ORTHO_MESH_MAX];
+    float v[ORTHO_MESH_MAX];
+
+    //! Angle from the middle of the image to each point, right and up, as used by geolocatePoints()
+    float dev[ORTHO_MESH_MAX][2];
+
+    //! Where each point is on the ground, and whether it was located at all
+    double posLLA[ORTHO_MESH_MAX][NLLA];
+    BOOL valid[ORTHO_MESH_MAX];
+
+    //! Number of points that were located
+    int located;
+
+} OrthoMesh_t;
+
+//! Set up a mesh with a number of points across and down the image
+BOOL orthoMeshInit(OrthoMesh_t *pMesh, int cols, int rows);
+
+//! Geolocate every point of the mesh for a frame
+int orthoMeshProject(OrthoMesh_t *pMesh, const GeolocateTelemetry_t *pGeo, int imageWidth, int imageHeight,
+                     float hfov, float vfov, const TerrainProvider_t *pTerrain);
+
+//! Fit a lat/lon tile around the located part of a mesh
+BOOL orthoTileFit(OrthoTile_t *pTile, const OrthoMesh_t *pMesh, int maxSize);
+
+//! Set up a web mercator tile from its zoom level and X/Y index
+void orthoTileXYZ(OrthoTile_t *pTile, int zoom, int x, int y, int size);
+
+//! Warp a frame onto a tile through a projected mesh
+int orthoWarp(const OrthoMesh_t *pMesh, const OrthoImage_t *pImage, const OrthoTile_t *pTile, OrthoImage_t *pOut);
+
+// C++ compilers: don't mangle us
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ORTHORECTIFY_H
@@ -0,0 +1,221 @@
+#include "PathStream.h"
+#include "linearalgebra.h"
+#include <string.h>
+
+static void buildWindow(PathStream_t *pStream, int Base, OrionPkt_t *pPkt);
+
+//! Number of points converted to ECEF at a time, which sets the size of the scratch arrays on the stack
+#define PATH_STREAM_BATCH 64
+
+/*!
+ * Initialize a path stream over user supplied point storage
+ * \param pStream is the path stream to initialize
+ * \param pPoints is storage for MaxPoints route points, which must outlive the stream
+ * \param MaxPoints is the most points the route can have
+ * \param pSettings supplies the step-stare settings for every window, or NULL for none
+ * \return TRUE if the stream was initialized, FALSE if there's no room for a route
+ */
+BOOL pathStreamInit(PathStream_t *pStream, Point_t *pPoints, int MaxPoints, const OrionPath_t *pSettings)
+{
+    // A path needs at least two points to have a segment
+    if ((pPoints == NULL) || (MaxPoints < 2))
+        return FALSE;
+
+    memset(pStream, 0, sizeof(PathStream_t));
+    pStream->pPoints = pPoints;
+    pStream->MaxPoints = MaxPoints;
+
+    // Only the settings carry over into each window, the points come from the route
+    if (pSettings != NULL)
+    {
+        pStream->Path.numCrossTrackSteps = pSettings->numCrossTrackSteps;
+        pStream->Path.alongTrackStepAngle = pSettings->alongTrackStepAngle;
+        pStream->Path.crossTrackStepRatio = pSettings->crossTrackStepRatio;
+    }
+
+    return TRUE;
+
+}// pathStreamInit
+
+
+/*!
+ * Convert a batch of LLA points to ECEF and add them to the end of the route.
+ * Converting the whole route here means sending a window is just a copy.
+ * \param pStream is the path stream
+ * \param lla is the list of points, latitude and longitude in radians and height above the ellipsoid in meters
+ * \param Count is the number of points in the list
+ * \return the number of points added, which is less than Count if the route storage filled up
+ */
+int pathStreamAddLla(PathStream_t *pStream, const double lla[][NLLA], int Count)
+{
+    Point_t *pPoint = &pStream->pPoints[pStream->NumPoints];
+    double lat[PATH_STREAM_BATCH], lon[PATH_STREAM_BATCH], alt[PATH_STREAM_BATCH];
+    double x[PATH_STREAM_BATCH], y[PATH_STREAM_BATCH], z[PATH_STREAM_BATCH];
+    int i, j, n;
+
+    // Don't go past the end of the user's storage
+    if (Count > pStream->MaxPoints - pStream->NumPoints)
+        Count = pStream->MaxPoints - pStream->NumPoints;
+
+    // Split the points into one array per component a batch at a time, for the array conversion
+    for (i = 0; i < Count; i += n)
+    {
+        n = MIN(Count - i, PATH_STREAM_BATCH);
+
+        for (j = 0; j < n; j++)
+        {
+            lat[j] = lla[i + j][LAT];
+            lon[j] = lla[i + j][LON];
+            alt[j] = lla[i + j][ALT];
+        }
+
+        llaToECEFArray(lat, lon, alt, (size_t)n, x, y, z);
+
+        // The path packet only carries single precision ECEF, to the nearest meter
+        for (j = 0; j < n; j++)
+        {
+            pPoint[i + j].posEcef[ECEFX] = (float)x[j];
+            pPoint[i + j].posEcef[ECEFY] = (float)y[j];
+            pPoint[i + j].posEcef[ECEFZ] = (float)z[j];
+        }
+    }
+
+    pStream->NumPoints += Count;
+    return Count;
+
+}// pathStreamAddLla
+
+
+/*!
+ * Build the path packet for the start of the route, which needs to be sent to
+ * the gimbal to put it in path mode. Sending it again starts the route over.
+ * \param pStream is the path stream
+ * \param pPkt receives the path packet
+ * \return TRUE if pPkt should be sent, FALSE if the route doesn't have a segment yet
+ */
+BOOL pathStreamStart(PathStream_t *pStream, OrionPkt_t *pPkt)
+{
+    if (pStream->NumPoints < 2)
+        return FALSE;
+
+    // Forget about any window the gimbal had before
+    pStream->Base = pStream->Loaded = 0;
+    pStream->From = pStream->To = 0;
+    pStream->Progress = 0.0f;
+    pStream->Started = pStream->Stopped = FALSE;
+
+    buildWindow(pStream, 0, pPkt);
+    return TRUE;
+
+}// pathStreamStart
+
+
+/*!
+ * Track the gimbal's progress along the route from its geolocate telemetry,
+ * and build the next path packet when it's time for the gimbal to have one:
+ * either the next window, or the last one sent again if the gimbal didn't
+ * take it up. Call this with every geolocate telemetry packet.
+ * \param pStream is the path stream
+ * \param pGeo is the latest geolocate telemetry
+ * \param pPkt receives a path packet if one needs to be sent
+ * \return TRUE if pPkt should be sent
+ */
+BOOL pathStreamUpdate(PathStream_t *pStream, const GeolocateTelemetryCore_t *pGeo, OrionPkt_t *pPkt)
+{
+    int From = pGeo->pathFrom, To = pGeo->pathTo;
+
+    // Nothing to do until the route has been started, or once the gimbal has been taken out of path mode
+    if (((pStream->Loaded == 0) && !pStream->Pending) || pStream->Stopped)
+        return FALSE;
+
+    // Note when a window went out, in gimbal time, the first time we hear from the gimbal afterwards
+    if (pStream->Pending && !pStream->SentTimeValid)
+    {
+        pStream->SentTime = pGeo->systemTime;
+        pStream->SentTimeValid = TRUE;
+    }
+
+    if (pGeo->mode == ORION_MODE_PATH)
+    {
+        // Indices below the amount the window moved by can only be in the new window
+        if (pStream->Pending && (!pStream->Started || (From < pStream->PendingBase - pStream->Base)))
+        {
+            pStream->Base = pStream->PendingBase;
+            pStream->Loaded = pStream->PendingLoaded;
+            pStream->Pending = FALSE;
+            pStream->Started = TRUE;
+        }
+
+        // Keep track of where the gimbal is on the route, as long as it's flying a window we know about
+        if (pStream->Started && (From < pStream->Loaded) && (To < pStream->Loaded))
+        {
+            pStream->From = pStream->Base + From;
+            pStream->To = pStream->Base + To;
+            pStream->Progress = pGeo->pathProgress;
+
+            // Once the gimbal is far enough into its window, and there's more route, move the window up to it
+            if (!pStream->Pending && (From >= PATH_STREAM_TRIGGER) && (pStream->Base + pStream->Loaded < pStream->NumPoints))
+            {
+                buildWindow(pStream, pStream->From, pPkt);
+                return TRUE;
+            }
+        }
+    }
+    // Leaving path mode after we got it there means someone else has commanded the gimbal
+    else if (pStream->Started && !pStream->Pending)
+    {
+        pStream->Stopped = TRUE;
+        return FALSE;
+    }
+
+    // If the gimbal hasn't taken up the pending window in time, send it again, moved up to wherever the gimbal
+    //   has got to in the meantime so that its first point is still the one the gimbal is traveling from
+    if (pStream->Pending && (pGeo->systemTime - pStream->SentTime >= PATH_STREAM_RESEND_MS))
+    {
+        buildWindow(pStream, pStream->Started ? pStream->From : 0, pPkt);
+        return TRUE;
+    }
+
+    return FALSE;
+
+}// pathStreamUpdate
+
+
+/*!
+ * Determine if the gimbal has the last window of the route and is on its last segment
+ * \param pStream is the path stream
+ * \return TRUE if the route is finished
+ */
+BOOL pathStreamFinished(const PathStream_t *pStream)
+{
+    return pStream->Started && !pStream->Pending && (pStream->Base + pStream->Loaded == pStream->NumPoints) && (pStream->To == pStream->NumPoints - 1);
+
+}// pathStreamFinished
+
+
+/*!
+ * Build the path packet for a window of the route and mark it as pending
+ * \param pStream is the path stream
+ * \param Base is the route index of the window's first point
+ * \param pPkt receives the path packet
+ */
+static void buildWindow(PathStream_t *pStream, int Base, OrionPkt_t *pPkt)
+{
+    int Count = pStream->NumPoints - Base;
+
+    // As many points as fit in a path packet, or the rest of the route
+    if (Count > MAX_PATH_POINTS)
+        Count = MAX_PATH_POINTS;
+
+    pStream->Path.numPoints = (uint8_t)Count;
+    memcpy(pStream->Path.Point, &pStream->pPoints[Base], Count * sizeof(Point_t));
+    encodeOrionPathPacketStructure(pPkt, &pStream->Path);
+
+    // Wait for the gimbal to take it up, timing it from the next telemetry
+    pStream->Pending = TRUE;
+    pStream->PendingBase = Base;
+    pStream->PendingLoaded = Count;
+    pStream->SentTimeValid = FALSE;
+    pStream->Uploads++;
+
+}// buildWindow
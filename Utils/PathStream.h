@@ -0,0 +1,94 @@
+#ifndef PATHSTREAM_H
+#define PATHSTREAM_H
+
+/*!
+ * \file
+ * Streams a route of any length to the gimbal's path mode, which only takes
+ * MAX_PATH_POINTS points at a time. The whole route is converted to ECEF once,
+ * up front, and the gimbal is given a window of the route that starts with
+ * the point it's traveling from. Each geolocate telemetry packet reports the
+ * segment the gimbal is on (pathFrom and pathTo, indices into the window it
+ * has), and once the gimbal is PATH_STREAM_TRIGGER segments into its window
+ * the next window is sent, again starting with the point it's traveling from.
+ * The gimbal always has at least MAX_PATH_POINTS - 1 - PATH_STREAM_TRIGGER
+ * segments ahead of it, so it never runs out of path while waiting for one.
+ *
+ * Telemetry tells us which window the gimbal is flying: indices below the
+ * amount the window moved by can only come from the new one, and anything
+ * else from the old one. That holds as long as the gimbal doesn't get through
+ * PATH_STREAM_TRIGGER segments while a window is on its way to it. Windows
+ * that the gimbal doesn't take up within PATH_STREAM_RESEND_MS are sent
+ * again, moved up to wherever the gimbal has got to by then.
+ */
+
+#include "OrionPublicPacketShim.h"
+#include "earthposition.h"
+
+// C++ compilers: don't mangle us
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Index into its window of the point the gimbal travels from when it gets the next window
+#define PATH_STREAM_TRIGGER 4
+
+//! Milliseconds to wait for the gimbal to take up a window before sending it again
+#define PATH_STREAM_RESEND_MS 1000
+
+typedef struct
+{
+    //! Every point on the route in ECEF, supplied by the user
+    Point_t *pPoints;
+    int MaxPoints;
+    int NumPoints;
+
+    //! Path settings, with the points of the current window
+    OrionPath_t Path;
+
+    //! Route index of the first point of the window the gimbal is flying, and how many points it has
+    int Base;
+    int Loaded;
+
+    //! TRUE while a window has been sent that the gimbal hasn't taken up yet
+    BOOL Pending;
+    int PendingBase;
+    int PendingLoaded;
+
+    //! Gimbal system time the pending window was last sent at, once we know it
+    uint32_t SentTime;
+    BOOL SentTimeValid;
+
+    //! TRUE once the gimbal has taken up a window, and once it's left path mode after that
+    BOOL Started;
+    BOOL Stopped;
+
+    //! Route indices of the points the gimbal is traveling from and to, and its progress from the last telemetry
+    int From;
+    int To;
+    float Progress;
+
+    //! Number of windows sent, including the ones sent again
+    uint32_t Uploads;
+
+} PathStream_t;
+
+//! Initialize a path stream over user supplied point storage
+BOOL pathStreamInit(PathStream_t *pStream, Point_t *pPoints, int MaxPoints, const OrionPath_t *pSettings);
+
+//! Convert a batch of LLA points to ECEF and add them to the end of the route
+int pathStreamAddLla(PathStream_t *pStream, const double lla[][NLLA], int Count);
+
+//! Build the path packet for the start of the route
+BOOL pathStreamStart(PathStream_t *pStream, OrionPkt_t *pPkt);
+
+//! Track the gimbal's progress, and build the next path packet when it's time to send one
+BOOL pathStreamUpdate(PathStream_t *pStream, const GeolocateTelemetryCore_t *pGeo, OrionPkt_t *pPkt);
+
+//! Determine if the gimbal has the last window of the route and is on its last segment
+BOOL pathStreamFinished(const PathStream_t *pStream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PATHSTREAM_H
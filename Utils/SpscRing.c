@@ -0,0 +1,108 @@
+#include "SpscRing.h"
+#include <string.h>
+
+// The producer publishes Head with release semantics after filling a slot
+// and the consumer publishes Tail with release semantics once it is done
+// with one, each side reading the other's index with acquire semantics.
+
+
+/*!
+ * Initialize an empty ring
+ * \param pRing is the ring to initialize
+ * \param Capacity is the number of slots, which must be a power of two and at least 2
+ * \return TRUE if the ring was initialized, FALSE if Capacity isn't valid
+ */
+BOOL spscRingInit(SpscRing_t *pRing, uint32_t Capacity)
+{
+    memset(pRing, 0, sizeof(SpscRing_t));
+
+    // The capacity has to be a power of two so the indices can wrap freely
+    if ((Capacity < 2) || ((Capacity & (Capacity - 1)) != 0))
+        return FALSE;
+
+    pRing->Mask = Capacity - 1;
+    return TRUE;
+
+}// spscRingInit
+
+
+/*!
+ * Get the slot that the next call to spscRingCommit() will publish. Only the
+ * producer thread may call this.
+ * \param pRing is the ring
+ * \param pIndex receives the index of the slot, which goes in the slot array at *pIndex & Mask
+ * \return TRUE if there was a free slot, FALSE if the ring was full and the drop was counted
+ */
+BOOL spscRingReserve(SpscRing_t *pRing, uint32_t *pIndex)
+{
+    uint32_t Head = pRing->Head, Depth = Head - atomicLoadAcquire32(&pRing->Tail);
+
+    // Never hand out a slot that the consumer hasn't released
+    if (Depth > pRing->Mask)
+    {
+        atomicStoreRelaxed32(&pRing->Dropped, pRing->Dropped + 1);
+        return FALSE;
+    }
+
+    // Keep track of how far behind the consumer has gotten
+    if (Depth + 1 > pRing->HighWater)
+        atomicStoreRelaxed32(&pRing->HighWater, Depth + 1);
+
+    *pIndex = Head;
+    return TRUE;
+
+}// spscRingReserve
+
+
+/*!
+ * Publish the slot returned by spscRingReserve() to the consumer. Only the
+ * producer thread may call this.
+ * \param pRing is the ring
+ */
+void spscRingCommit(SpscRing_t *pRing)
+{
+    atomicStoreRelease32(&pRing->Head, pRing->Head + 1);
+
+}// spscRingCommit
+
+
+/*!
+ * Get the index one past the newest slot the producer has committed. Every
+ * slot from the consumer's Tail up to this one can be read. Only the consumer
+ * thread may call this.
+ * \param pRing is the ring
+ * \return the head index
+ */
+uint32_t spscRingHead(const SpscRing_t *pRing)
+{
+    return atomicLoadAcquire32(&pRing->Head);
+
+}// spscRingHead
+
+
+/*!
+ * Hand slots back to the producer once the consumer is done with them. Only
+ * the consumer thread may call this.
+ * \param pRing is the ring
+ * \param Tail is the index of the oldest slot still in use, every slot before it is released
+ */
+void spscRingRelease(SpscRing_t *pRing, uint32_t Tail)
+{
+    atomicStoreRelease32(&pRing->Tail, Tail);
+
+}// spscRingRelease
+
+
+/*!
+ * Get the number of slots committed but not yet released
+ * \param pRing is the ring
+ * \return the depth, which is only a snapshot if called from a thread other than the producer or consumer
+ */
+uint32_t spscRingDepth(const SpscRing_t *pRing)
+{
+    // Read the tail first, so the depth can never come out negative
+    uint32_t Tail = atomicLoadAcquire32(&pRing->Tail);
+
+    return atomicLoadAcquire32(&pRing->Head) - Tail;
+
+}// spscRingDepth
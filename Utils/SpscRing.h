@@ -0,0 +1,66 @@
+#ifndef SPSCRING_H
+#define SPSCRING_H
+
+/*!
+ * \file
+ * Indices of a bounded lock-free ring shared between exactly one producer
+ * thread and one consumer thread. The ring only keeps count; the slots
+ * themselves belong to the user, in an array of Mask + 1 elements indexed by
+ * an index & Mask, so they can be pointers or whole structures read in place.
+ * The producer reserves the slot at the head, fills it and commits it. The
+ * consumer reads anything from its tail up to the head and releases slots
+ * once it's done with them. Neither side ever waits on the other: a
+ * reservation that finds the ring full fails and is counted as a drop.
+ */
+
+#include "Types.h"
+#include "Atomics.h"
+
+// C++ compilers: don't mangle us
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    //! Number of slots minus one, the capacity is a power of two
+    uint32_t Mask;
+
+    //! Number of slots ever committed, written only by the producer
+    volatile uint32_t Head;
+
+    //! Reservations that failed because the ring was full, and the most slots
+    //! that have been waiting at once, written only by the producer
+    volatile uint32_t Dropped;
+    volatile uint32_t HighWater;
+
+    uint8_t Pad[ATOMIC_CACHE_LINE - 4*sizeof(uint32_t)];
+
+    //! Number of slots ever released, written only by the consumer
+    volatile uint32_t Tail;
+
+} SpscRing_t;
+
+//! Initialize an empty ring with a power of two capacity
+BOOL spscRingInit(SpscRing_t *pRing, uint32_t Capacity);
+
+//! Producer: get the index of the slot the next commit publishes, FALSE if the ring is full
+BOOL spscRingReserve(SpscRing_t *pRing, uint32_t *pIndex);
+
+//! Producer: publish the slot returned by spscRingReserve()
+void spscRingCommit(SpscRing_t *pRing);
+
+//! Consumer: get the index one past the newest committed slot
+uint32_t spscRingHead(const SpscRing_t *pRing);
+
+//! Consumer: hand every slot before Tail back to the producer
+void spscRingRelease(SpscRing_t *pRing, uint32_t Tail);
+
+//! Number of slots committed but not yet released, which is only a snapshot if called from a third thread
+uint32_t spscRingDepth(const SpscRing_t *pRing);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SPSCRING_H
@@ -0,0 +1,889 @@
+#include "TelemetryArchive.h"
+#include "fieldencode.h"
+#include "fielddecode.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+# include <windows.h>
+#else
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <fcntl.h>
+# include <unistd.h>
+#endif // _WIN32
+
+//! Sizes of the file header, and of each block's header before its column lengths
+#define ARCHIVE_FILE_HEADER  8
+#define ARCHIVE_BLOCK_HEADER 24
+
+//! Most bytes a variable length integer takes
+#define ARCHIVE_VARINT_MAX 10
+
+//! In memory types of the columns: plain fields, then the GPS time and the bit fields of GpsData_t
+#define COL_U8            0
+#define COL_U16           1
+#define COL_U32           2
+#define COL_S8            3
+#define COL_ENUM          4
+#define COL_F32           5
+#define COL_F64           6
+#define COL_GEO_TIME      7
+#define COL_GPS_TIME      8
+#define COL_GPS_MULTI_ANT 9
+#define COL_GPS_FIX_TYPE  10
+#define COL_GPS_DETAILED  11
+#define COL_GPS_VERTICAL  12
+
+//! Column codings: differences from one sample to the next, or differences between those
+#define CODE_DELTA  1
+#define CODE_DELTA2 2
+
+//! Ranges of the protocol's encoded types, which quantized floating point fields saturate to
+#define RANGE_U8  0, 255
+#define RANGE_S8  -128, 127
+#define RANGE_U16 0, 65535
+#define RANGE_S16 -32768, 32767
+#define RANGE_U32 0, 4294967295LL
+#define RANGE_S32 (-2147483647LL - 1), 2147483647LL
+
+typedef struct
+{
+    //! Field name, which every element of an array shares, and where the field is in the packet structure
+    const char *pName;
+    size_t Offset;
+
+    //! In memory type, the range and scaler of the protocol's encoding, and how the column is coded
+    int Type;
+    int64_t Min;
+    int64_t Max;
+    double Scaler;
+    int Coding;
+
+} ArchiveColumn_t;
+
+typedef struct
+{
+    //! Columns of the table, the first of which is always the time
+    const ArchiveColumn_t *pColumns;
+    int Count;
+
+    //! Size of the packet structure each row goes in and out of
+    size_t RowSize;
+
+} ArchiveTable_t;
+
+#define GEO(name, field, type, range, scaler) { name, offsetof(GeolocateTelemetryCore_t, field), type, range, scaler, CODE_DELTA }
+#define GPS(name, field, type, range, scaler) { name, offsetof(GpsData_t, field), type, range, scaler, CODE_DELTA }
+
+//! GeolocateTelemetryCore columns, everything but the track data, with the scalers from OrionPublicProtocol.xml
+static const ArchiveColumn_t GeolocateColumns[] =
+{
+    { "gpsTime", 0, COL_GEO_TIME, 0, 0, 1, CODE_DELTA2 },
+    { "systemTime", offsetof(GeolocateTelemetryCore_t, systemTime), COL_U32, RANGE_U32, 1, CODE_DELTA2 },
+    GEO("geoidUndulation",      geoidUndulation,      COL_F64,  RANGE_S16, 273.0583333333333),
+    GEO("posLat",               posLat,               COL_F64,  RANGE_S32, 572957795.1308233),
+    GEO("posLon",               posLon,               COL_F64,  RANGE_S32, 572957795.1308233),
+    GEO("posAlt",               posAlt,               COL_F64,  RANGE_S32, 10000.0),
+    GEO("velNED",               velNED[0],            COL_F32,  RANGE_S16, 100.0),
+    GEO("velNED",               velNED[1],            COL_F32,  RANGE_S16, 100.0),
+    GEO("velNED",               velNED[2],            COL_F32,  RANGE_S16, 100.0),
+    GEO("gimbalQuat",           gimbalQuat[0],        COL_F32,  RANGE_S16, 32767.0),
+    GEO("gimbalQuat",           gimbalQuat[1],        COL_F32,  RANGE_S16, 32767.0),
+    GEO("gimbalQuat",           gimbalQuat[2],        COL_F32,  RANGE_S16, 32767.0),
+    GEO("gimbalQuat",           gimbalQuat[3],        COL_F32,  RANGE_S16, 32767.0),
+    GEO("pan",                  pan,                  COL_F32,  RANGE_S16, 10430.06004058427),
+    GEO("tilt",                 tilt,                 COL_F32,  RANGE_S16, 10430.06004058427),
+    GEO("hfov",                 hfov,                 COL_F32,  RANGE_U16, 10430.21919552736),
+    GEO("vfov",                 vfov,                 COL_F32,  RANGE_U16, 10430.21919552736),
+    GEO("losECEF",              losECEF[0],           COL_F32,  RANGE_S16, 1.0),
+    GEO("losECEF",              losECEF[1],           COL_F32,  RANGE_S16, 1.0),
+    GEO("losECEF",              losECEF[2],           COL_F32,  RANGE_S16, 1.0),
+    GEO("pixelWidth",           pixelWidth,           COL_U16,  RANGE_U16, 1),
+    GEO("pixelHeight",          pixelHeight,          COL_U16,  RANGE_U16, 1),
+    GEO("mode",                 mode,                 COL_ENUM, RANGE_U8,  1),
+    GEO("pathProgress",         pathProgress,         COL_F32,  RANGE_U8,  255.0),
+    GEO("stareTime",            stareTime,            COL_F32,  RANGE_U8,  100.0),
+    GEO("pathFrom",             pathFrom,             COL_U8,   RANGE_U8,  1),
+    GEO("pathTo",               pathTo,               COL_U8,   RANGE_U8,  1),
+    GEO("imageShifts",          imageShifts[0],       COL_F32,  RANGE_S32, 1000000.0),
+    GEO("imageShifts",          imageShifts[1],       COL_F32,  RANGE_S32, 1000000.0),
+    GEO("imageShiftDeltaTime",  imageShiftDeltaTime,  COL_F32,  RANGE_U16, 1000.0),
+    GEO("imageShiftConfidence", imageShiftConfidence, COL_F32,  RANGE_U8,  255.0),
+    GEO("outputShifts",         outputShifts[0],      COL_F32,  RANGE_S16, 10430.06004058427),
+    GEO("outputShifts",         outputShifts[1],      COL_F32,  RANGE_S16, 10430.06004058427),
+    GEO("rangeSource",          rangeSource,          COL_ENUM, RANGE_U8,  1),
+    GEO("leapSeconds",          leapSeconds,          COL_U8,   RANGE_U8,  1),
+    GEO("panAlignment",         panAlignment,         COL_F32,  RANGE_S8,  1000.0),
+    GEO("tiltAlignment",        tiltAlignment,        COL_F32,  RANGE_S8,  1000.0),
+    GEO("insRotationOption",    insRotationOption,    COL_ENUM, RANGE_U8,  1),
+    GEO("insQuat",              insQuat[0],           COL_F32,  RANGE_S16, 32767.0),
+    GEO("insQuat",              insQuat[1],           COL_F32,  RANGE_S16, 32767.0),
+    GEO("insQuat",              insQuat[2],           COL_F32,  RANGE_S16, 32767.0),
+    GEO("insQuat",              insQuat[3],           COL_F32,  RANGE_S16, 32767.0),
+    GEO("imageRotation",        imageRotation,        COL_F32,  RANGE_S16, 10430.06004058427),
+    GEO("cameraIndex",          cameraIndex,          COL_S8,   RANGE_S8,  1),
+    GEO("hasTrackData",         hasTrackData,         COL_U8,   RANGE_U8,  1),
+};
+
+//! GpsData columns, everything but the fields that GpsDataReceive.h works out from these
+static const ArchiveColumn_t GpsColumns[] =
+{
+    { "gpsTime", 0, COL_GPS_TIME, 0, 0, 1, CODE_DELTA2 },
+    { "multiAntHeadingValid",  0, COL_GPS_MULTI_ANT, 0, 1,  1, CODE_DELTA },
+    { "FixType",               0, COL_GPS_FIX_TYPE,  0, 15, 1, CODE_DELTA },
+    GPS("FixState",                FixState,                COL_U8,   RANGE_U8,  1),
+    GPS("TrackedSats",             TrackedSats,             COL_U8,   RANGE_U8,  1),
+    GPS("PDOP",                    PDOP,                    COL_F32,  RANGE_U8,  10.0),
+    GPS("Latitude",                Latitude,                COL_F64,  RANGE_S32, 572957795.1308233),
+    GPS("Longitude",               Longitude,               COL_F64,  RANGE_S32, 572957795.1308233),
+    GPS("Altitude",                Altitude,                COL_F64,  RANGE_S32, 10000.0),
+    GPS("VelNED",                  VelNED[0],               COL_F32,  RANGE_S32, 1000.0),
+    GPS("VelNED",                  VelNED[1],               COL_F32,  RANGE_S32, 1000.0),
+    GPS("VelNED",                  VelNED[2],               COL_F32,  RANGE_S32, 1000.0),
+    GPS("Hacc",                    Hacc,                    COL_F32,  RANGE_S32, 1000.0),
+    GPS("Vacc",                    Vacc,                    COL_F32,  RANGE_S32, 1000.0),
+    GPS("SpeedAcc",                SpeedAcc,                COL_F32,  RANGE_S32, 1000.0),
+    GPS("HeadingAcc",              HeadingAcc,              COL_F32,  RANGE_S32, 5729578.0),
+    GPS("GeoidUndulation",         GeoidUndulation,         COL_F32,  RANGE_S16, 100.0),
+    GPS("source",                  source,                  COL_ENUM, RANGE_U8,  1),
+    { "detailedAccuracyValid", 0, COL_GPS_DETAILED,  0, 1,  1, CODE_DELTA },
+    { "verticalVelocityValid", 0, COL_GPS_VERTICAL,  0, 1,  1, CODE_DELTA },
+    GPS("leapSeconds",             leapSeconds,             COL_U8,   RANGE_U8,  1),
+    GPS("multiAntHeading",         multiAntHeading,         COL_F32,  RANGE_S16, 10430.06004058427),
+    GPS("posAccuracy",             posAccuracy[0],          COL_F32,  RANGE_U16, 1000.0),
+    GPS("posAccuracy",             posAccuracy[1],          COL_F32,  RANGE_U16, 1000.0),
+    GPS("posAccuracy",             posAccuracy[2],          COL_F32,  RANGE_U16, 1000.0),
+    GPS("velAccuracy",             velAccuracy[0],          COL_F32,  RANGE_U16, 1000.0),
+    GPS("velAccuracy",             velAccuracy[1],          COL_F32,  RANGE_U16, 1000.0),
+    GPS("velAccuracy",             velAccuracy[2],          COL_F32,  RANGE_U16, 1000.0),
+    GPS("multiAntHeadingAccuracy", multiAntHeadingAccuracy, COL_F32,  RANGE_S32, 5729578.0),
+};
+
+static const ArchiveTable_t Tables[TELEMETRY_ARCHIVE_TABLES] =
+{
+    { GeolocateColumns, sizeof(GeolocateColumns) / sizeof(GeolocateColumns[0]), sizeof(GeolocateTelemetryCore_t) },
+    { GpsColumns,       sizeof(GpsColumns) / sizeof(GpsColumns[0]),             sizeof(GpsData_t) },
+};
+
+// Archive files start with these four bytes
+static const uint8_t Magic[4] = { 'O', 'T', 'A', 'R' };
+
+static BOOL addRow(TelemetryArchiveWriter_t *pWriter, int Table, const void *pRow);
+static BOOL writeBlock(TelemetryArchiveWriter_t *pWriter, int Table);
+static BOOL nextRow(TelemetryArchiveReader_t *pReader, int Table, void *pRow);
+static BOOL nextBlock(TelemetryArchiveReader_t *pReader);
+static int64_t getColumn(const ArchiveColumn_t *pColumn, const void *pRow);
+static void putColumn(const ArchiveColumn_t *pColumn, void *pRow, int64_t Value);
+static int64_t quantize(const ArchiveColumn_t *pColumn, double Scaled);
+static int encodeColumn(const int64_t *pValues, int Rows, int Coding, uint8_t *pData, int Index);
+static BOOL decodeColumn(const uint8_t *pData, uint32_t Length, int Rows, int Coding, int64_t *pValues);
+
+
+/*!
+ * Create an archive, replacing any file already at the path
+ * \param pWriter is the writer to set up
+ * \param pPath is the path of the archive
+ * \return TRUE if the archive was created, otherwise FALSE, in which case there's nothing to finish
+ */
+BOOL telemetryArchiveCreate(TelemetryArchiveWriter_t *pWriter, const char *pPath)
+{
+    uint8_t Header[ARCHIVE_FILE_HEADER];
+    int Index = 0, Table;
+
+    memset(pWriter, 0, sizeof(TelemetryArchiveWriter_t));
+
+    if ((pWriter->pFile = fopen(pPath, "wb")) == NULL)
+        return FALSE;
+
+    // Room for a block of samples for each table, and for the most any block could encode to
+    for (Table = 0; Table < TELEMETRY_ARCHIVE_TABLES; Table++)
+        pWriter->pValues[Table] = (int64_t *)malloc(Tables[Table].Count * TELEMETRY_ARCHIVE_BLOCK_ROWS * sizeof(int64_t));
+
+    pWriter->pBlock = (uint8_t *)malloc(ARCHIVE_BLOCK_HEADER + TELEMETRY_ARCHIVE_MAX_COLUMNS * (4 + TELEMETRY_ARCHIVE_BLOCK_ROWS * ARCHIVE_VARINT_MAX));
+
+    // The file header is just the magic, the version and the size of a block header
+    memcpy(Header, Magic, sizeof(Magic));
+    Index = sizeof(Magic);
+    uint16ToLeBytes(TELEMETRY_ARCHIVE_VERSION, Header, &Index);
+    uint16ToLeBytes(ARCHIVE_BLOCK_HEADER, Header, &Index);
+
+    if ((pWriter->pValues[TELEMETRY_ARCHIVE_GEOLOCATE] == NULL) || (pWriter->pValues[TELEMETRY_ARCHIVE_GPS] == NULL) ||
+        (pWriter->pBlock == NULL) || (fwrite(Header, 1, Index, pWriter->pFile) != (size_t)Index))
+    {
+        telemetryArchiveFinish(pWriter);
+        return FALSE;
+    }
+
+    return TRUE;
+
+}// telemetryArchiveCreate
+
+
+/*!
+ * Add a geolocate telemetry sample to an archive
+ * \param pWriter is the archive
+ * \param pGeo is the sample, of which the track data aren't archived
+ * \return FALSE if this sample filled a block that couldn't be written, otherwise TRUE
+ */
+BOOL telemetryArchiveAddGeolocate(TelemetryArchiveWriter_t *pWriter, const GeolocateTelemetryCore_t *pGeo)
+{
+    return addRow(pWriter, TELEMETRY_ARCHIVE_GEOLOCATE, pGeo);
+
+}// telemetryArchiveAddGeolocate
+
+
+/*!
+ * Add a GPS sample to an archive
+ * \param pWriter is the archive
+ * \param pGps is the sample, of which the fields GpsDataReceive.h fills in aren't archived
+ * \return FALSE if this sample filled a block that couldn't be written, otherwise TRUE
+ */
+BOOL telemetryArchiveAddGps(TelemetryArchiveWriter_t *pWriter, const GpsData_t *pGps)
+{
+    return addRow(pWriter, TELEMETRY_ARCHIVE_GPS, pGps);
+
+}// telemetryArchiveAddGps
+
+
+/*!
+ * Write out every partly filled block, so everything added so far is on disk.
+ * Each flush starts new blocks, so flushing often makes the archive bigger.
+ * \param pWriter is the archive
+ * \return TRUE if everything was written
+ */
+BOOL telemetryArchiveFlush(TelemetryArchiveWriter_t *pWriter)
+{
+    BOOL Result = TRUE;
+    int Table;
+
+    for (Table = 0; Table < TELEMETRY_ARCHIVE_TABLES; Table++)
+    {
+        if (!writeBlock(pWriter, Table))
+            Result = FALSE;
+    }
+
+    return Result;
+
+}// telemetryArchiveFlush
+
+
+/*!
+ * Flush an archive and close it
+ * \param pWriter is the archive, which can be created again afterwards
+ */
+void telemetryArchiveFinish(TelemetryArchiveWriter_t *pWriter)
+{
+    int Table;
+
+    if ((pWriter->pFile != NULL) && (pWriter->pBlock != NULL))
+        telemetryArchiveFlush(pWriter);
+
+    if (pWriter->pFile != NULL)
+        fclose(pWriter->pFile);
+
+    for (Table = 0; Table < TELEMETRY_ARCHIVE_TABLES; Table++)
+        free(pWriter->pValues[Table]);
+
+    free(pWriter->pBlock);
+    memset(pWriter, 0, sizeof(TelemetryArchiveWriter_t));
+
+}// telemetryArchiveFinish
+
+
+/*!
+ * Open an archive for reading, which maps the file rather than reading it in
+ * \param pReader is the reader to set up
+ * \param pPath is the path of the archive
+ * \return TRUE if the archive was opened, otherwise FALSE, in which case there's nothing to close
+ */
+BOOL telemetryArchiveOpen(TelemetryArchiveReader_t *pReader, const char *pPath)
+{
+    int Index = sizeof(Magic);
+
+    memset(pReader, 0, sizeof(TelemetryArchiveReader_t));
+
+#ifdef _WIN32
+    {
+        LARGE_INTEGER Size;
+        HANDLE hFile = CreateFileA(pPath, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, NULL);
+
+        if (hFile == INVALID_HANDLE_VALUE)
+            return FALSE;
+
+        pReader->hFile = hFile;
+
+        if (GetFileSizeEx(hFile, &Size) && (Size.QuadPart >= ARCHIVE_FILE_HEADER) &&
+            ((pReader->hMapping = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL)) != NULL))
+        {
+            pReader->pMap = (const uint8_t *)MapViewOfFile(pReader->hMapping, FILE_MAP_READ, 0, 0, 0);
+            pReader->Size = (uint64_t)Size.QuadPart;
+        }
+    }
+#else
+    {
+        struct stat Info;
+        void *pMap = MAP_FAILED;
+        int Handle = open(pPath, O_RDONLY);
+
+        if (Handle < 0)
+            return FALSE;
+
+        if ((fstat(Handle, &Info) == 0) && (Info.st_size >= ARCHIVE_FILE_HEADER))
+            pMap = mmap(NULL, (size_t)Info.st_size, PROT_READ, MAP_SHARED, Handle, 0);
+
+        // The mapping stays valid after the descriptor is closed
+        close(Handle);
+
+        // Queries hop over the columns they don't want, so reading ahead would only waste memory
+        if (pMap != MAP_FAILED)
+        {
+            madvise(pMap, (size_t)Info.st_size, MADV_RANDOM);
+            pReader->pMap = (const uint8_t *)pMap;
+            pReader->Size = (uint64_t)Info.st_size;
+        }
+    }
+#endif // _WIN32
+
+    // Room for one block's worth of every column
+    pReader->pValues = (int64_t *)malloc(TELEMETRY_ARCHIVE_MAX_COLUMNS * TELEMETRY_ARCHIVE_BLOCK_ROWS * sizeof(int64_t));
+
+    // Make sure this is an archive we know how to read
+    if ((pReader->pMap == NULL) || (pReader->pValues == NULL) || (memcmp(pReader->pMap, Magic, sizeof(Magic)) != 0) ||
+        (uint16FromLeBytes(pReader->pMap, &Index) != TELEMETRY_ARCHIVE_VERSION) ||
+        (uint16FromLeBytes(pReader->pMap, &Index) != ARCHIVE_BLOCK_HEADER))
+    {
+        telemetryArchiveClose(pReader);
+        return FALSE;
+    }
+
+    // Nothing to read until there's a query
+    pReader->Table = -1;
+    return TRUE;
+
+}// telemetryArchiveOpen
+
+
+/*!
+ * Close an archive that was opened for reading
+ * \param pReader is the archive
+ */
+void telemetryArchiveClose(TelemetryArchiveReader_t *pReader)
+{
+#ifdef _WIN32
+    if (pReader->pMap != NULL)
+        UnmapViewOfFile(pReader->pMap);
+
+    if (pReader->hMapping != NULL)
+        CloseHandle(pReader->hMapping);
+
+    if (pReader->hFile != NULL)
+        CloseHandle(pReader->hFile);
+#else
+    if (pReader->pMap != NULL)
+        munmap((void *)pReader->pMap, (size_t)pReader->Size);
+#endif // _WIN32
+
+    free(pReader->pValues);
+    memset(pReader, 0, sizeof(TelemetryArchiveReader_t));
+
+}// telemetryArchiveClose
+
+
+/*!
+ * Get the column selection for a list of field names in a table. An array
+ * field selects every element of the array, and the time is always read.
+ * \param Table is TELEMETRY_ARCHIVE_GEOLOCATE or TELEMETRY_ARCHIVE_GPS
+ * \param pNames is a list of field names as they appear in the packet structure, separated by commas or spaces
+ * \return the columns for every name that was found
+ */
+uint64_t telemetryArchiveColumns(int Table, const char *pNames)
+{
+    uint64_t Columns = 0;
+    int i;
+
+    if ((Table < 0) || (Table >= TELEMETRY_ARCHIVE_TABLES) || (pNames == NULL))
+        return 0;
+
+    while (*pNames != '\0')
+    {
+        size_t Length;
+
+        // Step over the separators to the next name
+        while ((*pNames == ',') || (*pNames == ' '))
+            pNames++;
+
+        Length = strcspn(pNames, ", ");
+
+        for (i = 0; i < Tables[Table].Count; i++)
+        {
+            const char *pName = Tables[Table].pColumns[i].pName;
+
+            if ((Length > 0) && (strlen(pName) == Length) && (strncmp(pName, pNames, Length) == 0))
+                Columns |= 1ULL << i;
+        }
+
+        pNames += Length;
+    }
+
+    return Columns;
+
+}// telemetryArchiveColumns
+
+
+/*!
+ * Start reading the rows of a table within a time range, from the start of the archive
+ * \param pReader is the archive
+ * \param Table is TELEMETRY_ARCHIVE_GEOLOCATE or TELEMETRY_ARCHIVE_GPS
+ * \param Start is the earliest time to read, in milliseconds since the GPS epoch
+ * \param End is the latest time to read
+ * \param Columns selects the columns to decode, from telemetryArchiveColumns() or TELEMETRY_ARCHIVE_ALL_COLUMNS
+ */
+void telemetryArchiveQuery(TelemetryArchiveReader_t *pReader, int Table, int64_t Start, int64_t End, uint64_t Columns)
+{
+    pReader->Table = ((Table >= 0) && (Table < TELEMETRY_ARCHIVE_TABLES)) ? Table : -1;
+    pReader->Start = Start;
+    pReader->End = End;
+
+    // Rows are picked by time, so the time column is always decoded
+    pReader->Columns = Columns | 1;
+
+    pReader->Offset = ARCHIVE_FILE_HEADER;
+    pReader->Rows = pReader->Row = 0;
+    pReader->BlocksDecoded = pReader->BlocksSkipped = 0;
+
+}// telemetryArchiveQuery
+
+
+/*!
+ * Get the next geolocate telemetry row of a query
+ * \param pReader is the archive, with a query on the geolocate table
+ * \param pGeo receives the row, with every field that wasn't selected zero
+ * \return TRUE if there was another row
+ */
+BOOL telemetryArchiveNextGeolocate(TelemetryArchiveReader_t *pReader, GeolocateTelemetryCore_t *pGeo)
+{
+    return nextRow(pReader, TELEMETRY_ARCHIVE_GEOLOCATE, pGeo);
+
+}// telemetryArchiveNextGeolocate
+
+
+/*!
+ * Get the next GPS row of a query. The fields that GpsDataReceive.h works out
+ * from the rest are left zero, for the caller to fill in if it needs them.
+ * \param pReader is the archive, with a query on the GPS table
+ * \param pGps receives the row, with every field that wasn't selected zero
+ * \return TRUE if there was another row
+ */
+BOOL telemetryArchiveNextGps(TelemetryArchiveReader_t *pReader, GpsData_t *pGps)
+{
+    return nextRow(pReader, TELEMETRY_ARCHIVE_GPS, pGps);
+
+}// telemetryArchiveNextGps
+
+
+//! Quantize a sample into the block being filled for its table, and write the block out once it's full
+static BOOL addRow(TelemetryArchiveWriter_t *pWriter, int Table, const void *pRow)
+{
+    const ArchiveTable_t *pTable = &Tables[Table];
+    int64_t *pValues = pWriter->pValues[Table];
+    int Row = pWriter->Rows[Table], i;
+
+    if ((pWriter->pFile == NULL) || (pValues == NULL))
+        return FALSE;
+
+    // Samples are held column by column, which is how they get coded
+    for (i = 0; i < pTable->Count; i++)
+        pValues[i * TELEMETRY_ARCHIVE_BLOCK_ROWS + Row] = getColumn(&pTable->pColumns[i], pRow);
+
+    if (++pWriter->Rows[Table] < TELEMETRY_ARCHIVE_BLOCK_ROWS)
+        return TRUE;
+
+    return writeBlock(pWriter, Table);
+
+}// addRow
+
+
+//! Code the samples waiting for a table into a block and write it out
+static BOOL writeBlock(TelemetryArchiveWriter_t *pWriter, int Table)
+{
+    const ArchiveTable_t *pTable = &Tables[Table];
+    const int64_t *pValues = pWriter->pValues[Table];
+    uint8_t *pBlock = pWriter->pBlock;
+    int Rows = pWriter->Rows[Table], Index, Header = 0, i;
+    int64_t MinTime, MaxTime;
+
+    if (Rows == 0)
+        return TRUE;
+
+    // These samples are done with whether or not they make it to the disk
+    pWriter->Rows[Table] = 0;
+
+    // The time is always the first column
+    MinTime = MaxTime = pValues[0];
+    for (i = 1; i < Rows; i++)
+    {
+        if (pValues[i] < MinTime)
+            MinTime = pValues[i];
+        else if (pValues[i] > MaxTime)
+            MaxTime = pValues[i];
+    }
+
+    // Code each column one after the other, following the header and the length of every column
+    Index = ARCHIVE_BLOCK_HEADER + pTable->Count * 4;
+    for (i = 0; i < pTable->Count; i++)
+    {
+        int Start = Index, Length = ARCHIVE_BLOCK_HEADER + i * 4;
+
+        Index = encodeColumn(&pValues[i * TELEMETRY_ARCHIVE_BLOCK_ROWS], Rows, pTable->pColumns[i].Coding, pBlock, Index);
+        uint32ToLeBytes((uint32_t)(Index - Start), pBlock, &Length);
+    }
+
+    // Now that the size is known, fill in the header
+    uint32ToLeBytes((uint32_t)Index, pBlock, &Header);
+    pBlock[Header++] = (uint8_t)Table;
+    pBlock[Header++] = (uint8_t)pTable->Count;
+    uint16ToLeBytes((uint16_t)Rows, pBlock, &Header);
+    int64ToLeBytes(MinTime, pBlock, &Header);
+    int64ToLeBytes(MaxTime, pBlock, &Header);
+
+    // Write the block in one go and push it out to the OS, so a crash only loses blocks that were still filling
+    if ((fwrite(pBlock, 1, Index, pWriter->pFile) != (size_t)Index) || (fflush(pWriter->pFile) != 0))
+        return FALSE;
+
+    pWriter->Blocks++;
+    pWriter->RowsWritten += Rows;
+    return TRUE;
+
+}// writeBlock
+
+
+//! Hand back the next row of a query that's in its time range, decoding blocks as they're needed
+static BOOL nextRow(TelemetryArchiveReader_t *pReader, int Table, void *pRow)
+{
+    const ArchiveTable_t *pTable = &Tables[Table];
+    int i;
+
+    // The query has to be on the table the caller expects
+    if ((pReader->pValues == NULL) || (pReader->Table != Table))
+        return FALSE;
+
+    do
+    {
+        while (pReader->Row < pReader->Rows)
+        {
+            int Row = pReader->Row++;
+            int64_t Time = pReader->pValues[Row];
+
+            if ((Time < pReader->Start) || (Time > pReader->End))
+                continue;
+
+            // Fill in the selected fields and leave the rest zero
+            memset(pRow, 0, pTable->RowSize);
+            for (i = 0; i < pTable->Count; i++)
+            {
+                if (pReader->Columns & (1ULL << i))
+                    putColumn(&pTable->pColumns[i], pRow, pReader->pValues[i * TELEMETRY_ARCHIVE_BLOCK_ROWS + Row]);
+            }
+
+            return TRUE;
+        }
+
+    } while (nextBlock(pReader));
+
+    return FALSE;
+
+}// nextRow
+
+
+//! Find the next block of a query that overlaps its time range, and decode the selected columns of it
+static BOOL nextBlock(TelemetryArchiveReader_t *pReader)
+{
+    const ArchiveTable_t *pTable = &Tables[pReader->Table];
+
+    // As long as there's at least a block header left
+    while (pReader->Offset + ARCHIVE_BLOCK_HEADER <= pReader->Size)
+    {
+        const uint8_t *pBlock = &pReader->pMap[pReader->Offset];
+        int Index = 0, Table, Count, Rows, i;
+        int64_t MinTime, MaxTime;
+        uint64_t Data;
+        uint32_t Size;
+        BOOL Good = TRUE;
+
+        Size = uint32FromLeBytes(pBlock, &Index);
+        Table = pBlock[Index++];
+        Count = pBlock[Index++];
+        Rows = uint16FromLeBytes(pBlock, &Index);
+        MinTime = int64FromLeBytes(pBlock, &Index);
+        MaxTime = int64FromLeBytes(pBlock, &Index);
+
+        // A block that runs off the end means the archive was cut short, e.g. by a crash
+        Data = ARCHIVE_BLOCK_HEADER + (uint64_t)Count * 4;
+        if ((Size < Data) || (pReader->Offset + Size > pReader->Size))
+            break;
+
+        pReader->Offset += Size;
+
+        // Pass over blocks of other tables or times without touching their columns
+        if ((Table != pReader->Table) || (MaxTime < pReader->Start) || (MinTime > pReader->End) ||
+            (Count == 0) || (Rows == 0) || (Rows > TELEMETRY_ARCHIVE_BLOCK_ROWS))
+        {
+            pReader->BlocksSkipped++;
+            continue;
+        }
+
+        // Decode the selected columns, stepping over the rest by their lengths. Any columns past
+        //   the ones we know about are from a later version and get left alone.
+        for (i = 0; (i < Count) && Good; i++)
+        {
+            uint32_t Length = uint32FromLeBytes(pBlock, &Index);
+
+            if (Data + Length > Size)
+                Good = FALSE;
+            else if ((i < pTable->Count) && (pReader->Columns & (1ULL << i)))
+                Good = decodeColumn(&pBlock[Data], Length, Rows, pTable->pColumns[i].Coding, &pReader->pValues[i * TELEMETRY_ARCHIVE_BLOCK_ROWS]);
+
+            Data += Length;
+        }
+
+        // Columns that were added after this block was written read as zero
+        for (i = Count; i < pTable->Count; i++)
+            memset(&pReader->pValues[i * TELEMETRY_ARCHIVE_BLOCK_ROWS], 0, Rows * sizeof(int64_t));
+
+        if (!Good)
+        {
+            pReader->BlocksSkipped++;
+            continue;
+        }
+
+        pReader->Rows = Rows;
+        pReader->Row = 0;
+        pReader->BlocksDecoded++;
+        return TRUE;
+    }
+
+    // End of the archive
+    pReader->Rows = pReader->Row = 0;
+    return FALSE;
+
+}// nextBlock
+
+
+//! Get a column's field out of a packet structure, quantized the way the protocol encodes it
+static int64_t getColumn(const ArchiveColumn_t *pColumn, const void *pRow)
+{
+    const uint8_t *pField = (const uint8_t *)pRow + pColumn->Offset;
+    const GeolocateTelemetryCore_t *pGeo = (const GeolocateTelemetryCore_t *)pRow;
+    const GpsData_t *pGps = (const GpsData_t *)pRow;
+
+    switch (pColumn->Type)
+    {
+    case COL_U8:   return *(const uint8_t *)pField;
+    case COL_U16:  return *(const uint16_t *)pField;
+    case COL_U32:  return *(const uint32_t *)pField;
+    case COL_S8:   return *(const int8_t *)pField;
+    case COL_ENUM: return *(const int *)pField;
+
+    // Floating point fields are scaled the same way the packet encoder does it, in their own precision
+    case COL_F32:  return quantize(pColumn, (float)(*(const float *)pField * (float)pColumn->Scaler));
+    case COL_F64:  return quantize(pColumn, *(const double *)pField * pColumn->Scaler);
+
+    case COL_GEO_TIME: return (int64_t)pGeo->gpsWeek * TELEMETRY_ARCHIVE_WEEK_MS + pGeo->gpsITOW;
+    case COL_GPS_TIME: return (int64_t)pGps->Week * TELEMETRY_ARCHIVE_WEEK_MS + pGps->ITOW;
+
+    case COL_GPS_MULTI_ANT: return pGps->multiAntHeadingValid;
+    case COL_GPS_FIX_TYPE:  return pGps->FixType;
+    case COL_GPS_DETAILED:  return pGps->detailedAccuracyValid;
+    case COL_GPS_VERTICAL:  return pGps->verticalVelocityValid;
+    default: return 0;
+    }
+
+}// getColumn
+
+
+//! Put a decoded column value back into its field of a packet structure
+static void putColumn(const ArchiveColumn_t *pColumn, void *pRow, int64_t Value)
+{
+    uint8_t *pField = (uint8_t *)pRow + pColumn->Offset;
+    GeolocateTelemetryCore_t *pGeo = (GeolocateTelemetryCore_t *)pRow;
+    GpsData_t *pGps = (GpsData_t *)pRow;
+
+    switch (pColumn->Type)
+    {
+    case COL_U8:   *(uint8_t *)pField = (uint8_t)Value; break;
+    case COL_U16:  *(uint16_t *)pField = (uint16_t)Value; break;
+    case COL_U32:  *(uint32_t *)pField = (uint32_t)Value; break;
+    case COL_S8:   *(int8_t *)pField = (int8_t)Value; break;
+    case COL_ENUM: *(int *)pField = (int)Value; break;
+    case COL_F32:  *(float *)pField = (float)(Value / pColumn->Scaler); break;
+    case COL_F64:  *(double *)pField = Value / pColumn->Scaler; break;
+
+    case COL_GEO_TIME:
+        pGeo->gpsWeek = (uint16_t)(Value / TELEMETRY_ARCHIVE_WEEK_MS);
+        pGeo->gpsITOW = (uint32_t)(Value % TELEMETRY_ARCHIVE_WEEK_MS);
+        break;
+
+    case COL_GPS_TIME:
+        pGps->Week = (uint16_t)(Value / TELEMETRY_ARCHIVE_WEEK_MS);
+        pGps->ITOW = (uint32_t)(Value % TELEMETRY_ARCHIVE_WEEK_MS);
+        break;
+
+    case COL_GPS_MULTI_ANT: pGps->multiAntHeadingValid = (unsigned)Value & 1; break;
+    case COL_GPS_FIX_TYPE:  pGps->FixType = (unsigned)Value & 15; break;
+    case COL_GPS_DETAILED:  pGps->detailedAccuracyValid = (unsigned)Value & 1; break;
+    case COL_GPS_VERTICAL:  pGps->verticalVelocityValid = (unsigned)Value & 1; break;
+    default: break;
+    }
+
+}// putColumn
+
+
+//! Round a scaled value to the nearest integer, saturating at the limits of its encoded type
+static int64_t quantize(const ArchiveColumn_t *pColumn, double Scaled)
+{
+    // Not a number goes in as zero
+    if (Scaled != Scaled)
+        return 0;
+    else if (Scaled >= (double)pColumn->Max)
+        return pColumn->Max;
+    else if (Scaled <= (double)pColumn->Min)
+        return pColumn->Min;
+    else
+        return (int64_t)((Scaled >= 0) ? (Scaled + 0.5) : (Scaled - 0.5));
+
+}// quantize
+
+
+//! Append a variable length integer, seven bits at a time starting with the least significant
+static int putVarint(uint64_t Value, uint8_t *pData, int Index)
+{
+    while (Value >= 0x80)
+    {
+        pData[Index++] = (uint8_t)(Value | 0x80);
+        Value >>= 7;
+    }
+
+    pData[Index++] = (uint8_t)Value;
+    return Index;
+
+}// putVarint
+
+
+//! Read a variable length integer, returns FALSE if it runs past the end of the data
+static BOOL getVarint(const uint8_t *pData, uint32_t Length, uint32_t *pIndex, uint64_t *pValue)
+{
+    uint64_t Value = 0;
+    int Shift;
+
+    for (Shift = 0; (Shift < 64) && (*pIndex < Length); Shift += 7)
+    {
+        uint8_t Byte = pData[(*pIndex)++];
+
+        Value |= (uint64_t)(Byte & 0x7F) << Shift;
+        if ((Byte & 0x80) == 0)
+        {
+            *pValue = Value;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+
+}// getVarint
+
+
+/*!
+ * Code one column of a block. Each sample becomes its difference from the one
+ * before, or the difference between that and the last difference, starting
+ * from zero so every block decodes on its own. A run of zeros goes in as one
+ * integer with the low bit set, and anything else zigzagged so small negative
+ * numbers stay small, with the low bit clear. The quantized fields are at most
+ * 48 bits wide, so nothing is lost making room for that bit.
+ */
+static int encodeColumn(const int64_t *pValues, int Rows, int Coding, uint8_t *pData, int Index)
+{
+    uint64_t Last = 0, LastDelta = 0, Zeros = 0;
+    int i;
+
+    for (i = 0; i < Rows; i++)
+    {
+        uint64_t Delta = (uint64_t)pValues[i] - Last, Code = Delta;
+
+        if (Coding == CODE_DELTA2)
+        {
+            Code = Delta - LastDelta;
+            LastDelta = Delta;
+        }
+
+        Last = (uint64_t)pValues[i];
+
+        // Save zeros up into runs
+        if (Code == 0)
+        {
+            Zeros++;
+            continue;
+        }
+
+        if (Zeros != 0)
+        {
+            Index = putVarint((Zeros << 1) | 1, pData, Index);
+            Zeros = 0;
+        }
+
+        Index = putVarint(((Code << 1) ^ (uint64_t)((int64_t)Code >> 63)) << 1, pData, Index);
+    }
+
+    if (Zeros != 0)
+        Index = putVarint((Zeros << 1) | 1, pData, Index);
+
+    return Index;
+
+}// encodeColumn
+
+
+//! Decode one column of a block, returns FALSE if it doesn't hold exactly the number of rows it should
+static BOOL decodeColumn(const uint8_t *pData, uint32_t Length, int Rows, int Coding, int64_t *pValues)
+{
+    uint64_t Last = 0, LastDelta = 0, Code, Count, Value;
+    uint32_t Index = 0;
+    int Row = 0;
+
+    while (Row < Rows)
+    {
+        if (!getVarint(pData, Length, &Index, &Code))
+            return FALSE;
+
+        // Either a run of zeros or a single zigzagged value
+        if (Code & 1)
+        {
+            Count = Code >> 1;
+            Value = 0;
+
+            if ((Count == 0) || (Count > (uint64_t)(Rows - Row)))
+                return FALSE;
+        }
+        else
+        {
+            Count = 1;
+            Value = (Code >> 2) ^ (0 - ((Code >> 1) & 1));
+        }
+
+        // Undo the differences
+        while (Count-- > 0)
+        {
+            uint64_t Delta = Value;
+
+            if (Coding == CODE_DELTA2)
+                Delta = LastDelta = LastDelta + Value;
+
+            Last += Delta;
+            pValues[Row++] = (int64_t)Last;
+        }
+    }
+
+    return (Index == Length);
+
+}// decodeColumn
@@ -0,0 +1,135 @@
+#ifndef TELEMETRYARCHIVE_H
+#define TELEMETRYARCHIVE_H
+
+/*!
+ * \file
+ * Columnar archive of GeolocateTelemetryCore and GpsData samples for post-flight
+ * analysis. Samples are kept the way the gimbal sends them: every field is
+ * quantized to the scaling its packet uses in OrionPublicProtocol.xml, and
+ * anything that can be worked out from the rest, like the ECEF, DCM and Euler
+ * fields of GeolocateTelemetry_t, isn't stored at all. The GPS week and time of
+ * week go in as one column of milliseconds since the GPS epoch, which is also
+ * the time that queries are made against.
+ *
+ * Samples of each packet are collected into blocks of TELEMETRY_ARCHIVE_BLOCK_ROWS
+ * rows, and each column of a block is stored on its own as the difference from
+ * the sample before, or for times the difference between differences. Runs of
+ * zeros take a single variable length integer and everything else takes one
+ * each, so a steady 10 Hz clock or a field that never changes costs next to
+ * nothing. Every block starts with the range of times in it and the length of
+ * each of its columns, so a query skips blocks outside its time range and the
+ * columns it didn't ask for without decoding them.
+ *
+ * The reader maps the file rather than loading it and only ever holds one block
+ * decoded, so an archive can be far bigger than memory. Blocks are written out
+ * whole, so an archive cut short by a crash reads back up to its last block.
+ */
+
+#include "OrionPublicPacketShim.h"
+#include <stdio.h>
+
+// C++ compilers: don't mangle us
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Archive format version written to the file header
+#define TELEMETRY_ARCHIVE_VERSION 1
+
+//! Rows in each block, about 100 seconds of 10 Hz telemetry
+#define TELEMETRY_ARCHIVE_BLOCK_ROWS 1024
+
+//! Most columns a table can have
+#define TELEMETRY_ARCHIVE_MAX_COLUMNS 64
+
+//! Milliseconds in a GPS week, for turning a week and time of week into an archive time
+#define TELEMETRY_ARCHIVE_WEEK_MS 604800000LL
+
+//! Tables in an archive, one for each packet
+#define TELEMETRY_ARCHIVE_GEOLOCATE 0
+#define TELEMETRY_ARCHIVE_GPS       1
+#define TELEMETRY_ARCHIVE_TABLES    2
+
+//! Column selection that reads every column
+#define TELEMETRY_ARCHIVE_ALL_COLUMNS 0xFFFFFFFFFFFFFFFFULL
+
+typedef struct
+{
+    //! File being written
+    FILE *pFile;
+
+    //! Quantized samples waiting for the next block of each table, TELEMETRY_ARCHIVE_BLOCK_ROWS per column
+    int64_t *pValues[TELEMETRY_ARCHIVE_TABLES];
+    int Rows[TELEMETRY_ARCHIVE_TABLES];
+
+    //! Buffer each block is encoded into before it's written out
+    uint8_t *pBlock;
+
+    //! Blocks and rows written so far
+    uint32_t Blocks;
+    uint64_t RowsWritten;
+
+} TelemetryArchiveWriter_t;
+
+typedef struct
+{
+    //! Mapped file and its platform handles
+    const uint8_t *pMap;
+    uint64_t Size;
+    void *hFile;
+    void *hMapping;
+
+    //! Table, time range and columns being read
+    int Table;
+    int64_t Start;
+    int64_t End;
+    uint64_t Columns;
+
+    //! Offset of the next block to look at
+    uint64_t Offset;
+
+    //! Decoded columns of the current block, and the next row of it to hand back
+    int64_t *pValues;
+    int Rows;
+    int Row;
+
+    //! Blocks decoded and blocks passed over, which show how well a query narrowed things down
+    uint32_t BlocksDecoded;
+    uint32_t BlocksSkipped;
+
+} TelemetryArchiveReader_t;
+
+//! Create an archive, replacing any file already at the path
+BOOL telemetryArchiveCreate(TelemetryArchiveWriter_t *pWriter, const char *pPath);
+
+//! Add a sample to an archive
+BOOL telemetryArchiveAddGeolocate(TelemetryArchiveWriter_t *pWriter, const GeolocateTelemetryCore_t *pGeo);
+BOOL telemetryArchiveAddGps(TelemetryArchiveWriter_t *pWriter, const GpsData_t *pGps);
+
+//! Write out every partly filled block, so everything added so far is on disk
+BOOL telemetryArchiveFlush(TelemetryArchiveWriter_t *pWriter);
+
+//! Flush an archive and close it
+void telemetryArchiveFinish(TelemetryArchiveWriter_t *pWriter);
+
+//! Open an archive for reading
+BOOL telemetryArchiveOpen(TelemetryArchiveReader_t *pReader, const char *pPath);
+
+//! Close an archive that was opened for reading
+void telemetryArchiveClose(TelemetryArchiveReader_t *pReader);
+
+//! Get the column selection for a comma separated list of field names in a table
+uint64_t telemetryArchiveColumns(int Table, const char *pNames);
+
+//! Start reading the rows of a table with times from Start to End inclusive, decoding only the selected columns
+void telemetryArchiveQuery(TelemetryArchiveReader_t *pReader, int Table, int64_t Start, int64_t End, uint64_t Columns);
+
+//! Get the next row of a query, with the fields that weren't selected left zero
+BOOL telemetryArchiveNextGeolocate(TelemetryArchiveReader_t *pReader, GeolocateTelemetryCore_t *pGeo);
+BOOL telemetryArchiveNextGps(TelemetryArchiveReader_t *pReader, GpsData_t *pGps);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TELEMETRYARCHIVE_H
@@ -0,0 +1,72 @@
+#ifndef TERRAINPROVIDER_H
+#define TERRAINPROVIDER_H
+
+/*!
+ * \file TerrainProvider.h
+ * \brief Interface between terrain models and the terrain intersection code.
+ *
+ * A terrain provider supplies ellipsoid heights for a lat/lon position and,
+ * optionally, bounds on the height over a lat/lon box. The bounds let
+ * getTerrainIntersectionEx() skip over stretches of the line of sight that
+ * can't possibly hit the ground instead of stepping through them. Providers
+ * with their own state should embed this structure as their first member or
+ * use the user pointer.
+ */
+
+#include "Types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+//! Height value that providers return when they have no data for a point
+#define TERRAIN_NO_DATA -10000.0f
+
+typedef struct TerrainProvider
+{
+    /*! Look up the terrain height at a point
+     *  \param pTerrain[in] The terrain provider being queried
+     *  \param lat[in] Latitude in radians
+     *  \param lon[in] Longitude in radians
+     *  \return Height above ellipsoid in meters, or TERRAIN_NO_DATA
+     */
+    float (*getElevationHAE)(const struct TerrainProvider *pTerrain, double lat, double lon);
+
+    /*! Optional: get the minimum and maximum terrain height over a lat/lon box
+     *  \param pTerrain[in] The terrain provider being queried
+     *  \param latMin[in] Southern edge of the box in radians
+     *  \param lonMin[in] Western edge of the box in radians
+     *  \param latMax[in] Northern edge of the box in radians
+     *  \param lonMax[in] Eastern edge of the box in radians
+     *  \param pMinHAE[out] Lowest terrain height in the box in meters
+     *  \param pMaxHAE[out] Highest terrain height in the box in meters
+     *  \return TRUE if the bounds are known, FALSE if the caller should fall back to maxHAE
+     */
+    BOOL (*getElevationBounds)(const struct TerrainProvider *pTerrain, double latMin, double lonMin, double latMax, double lonMax, float *pMinHAE, float *pMaxHAE);
+
+    //! Height bounds over the whole model in meters, or minHAE > maxHAE if they aren't known
+    float minHAE;
+    float maxHAE;
+
+    //! User data for the callbacks
+    void *pUser;
+
+    /*! Optional: look up the terrain height at many points at once, which saves
+     *  providers from finding the same tile over and over. This comes last so that
+     *  providers initialized without it leave it NULL, in which case points are
+     *  looked up one at a time with getElevationHAE.
+     *  \param pTerrain[in] The terrain provider being queried
+     *  \param lat[in] Latitude of each point in radians
+     *  \param lon[in] Longitude of each point in radians
+     *  \param hae[out] Height above ellipsoid of each point in meters, or TERRAIN_NO_DATA
+     *  \param n[in] Number of points
+     */
+    void (*getElevationsHAE)(const struct TerrainProvider *pTerrain, const double *lat, const double *lon, float *hae, int n);
+
+} TerrainProvider_t;
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // TERRAINPROVIDER_H
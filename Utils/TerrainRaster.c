@@ -0,0 +1,580 @@
+#include "TerrainRaster.h"
+#include "Constants.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+# include <windows.h>
+#else
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <fcntl.h>
+# include <unistd.h>
+#endif // _WIN32
+
+//! Tile slot states
+#define RASTER_UNUSED   0
+#define RASTER_LOADED   1
+#define RASTER_MISSING  2
+
+//! Posts below this are void: SRTM marks them with -32768 and DTED with -32767
+#define RASTER_VOID_LIMIT -15000
+
+//! Most tiles a bounds query will look at before giving up on it
+#define RASTER_BOUNDS_TILES 4
+
+//! Size of the DTED user header, data set identification and accuracy records, and of a data record's header
+#define DTED_HEADER_SIZE 3428
+#define DTED_RECORD_HEADER 8
+#define DTED_RECORD_CHECKSUM 4
+
+static float getRasterElevation(const TerrainProvider_t *pTerrain, double lat, double lon);
+static void getRasterElevations(const TerrainProvider_t *pTerrain, const double *lat, const double *lon, float *hae, int n);
+static BOOL getRasterBounds(const TerrainProvider_t *pTerrain, double latMin, double lonMin, double latMax, double lonMax, float *pMinHAE, float *pMaxHAE);
+static const TerrainRasterTile_t *getTile(TerrainRaster_t *pRaster, int lat, int lon);
+static BOOL loadTile(const TerrainRaster_t *pRaster, TerrainRasterTile_t *pTile);
+static BOOL setupSrtm(TerrainRasterTile_t *pTile);
+static BOOL setupDted(TerrainRasterTile_t *pTile);
+static int parseField(const uint8_t *pField, int length);
+static BOOL mapTile(TerrainRasterTile_t *pTile, const char *path);
+static void unloadTile(TerrainRasterTile_t *pTile);
+static int readPost(const TerrainRasterTile_t *pTile, int row, int col);
+static float interpolateTile(const TerrainRaster_t *pRaster, const TerrainRasterTile_t *pTile, double fracLat, double fracLon);
+static const TerrainRasterBlock_t *getBlock(TerrainRasterTile_t *pTile, int blockRow, int blockCol);
+
+
+/*!
+ * Set up a raster terrain provider. No files are opened until the first lookup.
+ * \param pRaster is the provider to set up
+ * \param directory is the directory that the SRTM or DTED tiles are in
+ * \param geoidUndulation is the height of the geoid above the ellipsoid in meters
+ * \return TRUE if the provider was set up, FALSE if the directory path is too long
+ */
+BOOL terrainRasterInit(TerrainRaster_t *pRaster, const char *directory, float geoidUndulation)
+{
+    memset(pRaster, 0, sizeof(TerrainRaster_t));
+
+    if(strlen(directory) >= TERRAIN_RASTER_PATH)
+        return FALSE;
+
+    strcpy(pRaster->directory, directory);
+    pRaster->geoidUndulation = geoidUndulation;
+
+    // Heights over the whole model aren't known, the per block bounds are used instead
+    pRaster->base.getElevationHAE = getRasterElevation;
+    pRaster->base.getElevationBounds = getRasterBounds;
+    pRaster->base.getElevationsHAE = getRasterElevations;
+    pRaster->base.minHAE = 1.0f;
+    pRaster->base.maxHAE = 0.0f;
+
+    return TRUE;
+
+}// terrainRasterInit
+
+
+/*!
+ * Close every tile that a raster terrain provider has open
+ * \param pRaster is the provider to clean up
+ */
+void terrainRasterFree(TerrainRaster_t *pRaster)
+{
+    int i;
+
+    for(i = 0; i < TERRAIN_RASTER_TILES; i++)
+        unloadTile(&pRaster->tiles[i]);
+
+}// terrainRasterFree
+
+
+//! Terrain provider callback for a single height lookup
+static float getRasterElevation(const TerrainProvider_t *pTerrain, double lat, double lon)
+{
+    TerrainRaster_t *pRaster = (TerrainRaster_t *)pTerrain;
+    double latDeg = degrees(lat), lonDeg = degrees(lon);
+    double latCell = floor(latDeg), lonCell = floor(lonDeg);
+    const TerrainRasterTile_t *pTile = getTile(pRaster, (int)latCell, (int)lonCell);
+
+    if(pTile == NULL)
+        return TERRAIN_NO_DATA;
+    else
+        return interpolateTile(pRaster, pTile, latDeg - latCell, lonDeg - lonCell);
+
+}// getRasterElevation
+
+
+//! Terrain provider callback for many height lookups, which only looks a tile up again when the points move to another one
+static void getRasterElevations(const TerrainProvider_t *pTerrain, const double *lat, const double *lon, float *hae, int n)
+{
+    TerrainRaster_t *pRaster = (TerrainRaster_t *)pTerrain;
+    const TerrainRasterTile_t *pTile = NULL;
+    double latCell = 0, lonCell = 0;
+    int i;
+
+    for(i = 0; i < n; i++)
+    {
+        double latDeg = degrees(lat[i]), lonDeg = degrees(lon[i]);
+
+        // Look the tile up again if this point isn't in the same one as the last
+        if((i == 0) || (latDeg < latCell) || (latDeg >= latCell + 1) || (lonDeg < lonCell) || (lonDeg >= lonCell + 1))
+        {
+            latCell = floor(latDeg);
+            lonCell = floor(lonDeg);
+            pTile = getTile(pRaster, (int)latCell, (int)lonCell);
+        }
+
+        if(pTile == NULL)
+            hae[i] = TERRAIN_NO_DATA;
+        else
+            hae[i] = interpolateTile(pRaster, pTile, latDeg - latCell, lonDeg - lonCell);
+    }
+
+}// getRasterElevations
+
+
+//! Terrain provider callback for the height bounds over a box, from the bounds of every block the box touches
+static BOOL getRasterBounds(const TerrainProvider_t *pTerrain, double latMin, double lonMin, double latMax, double lonMax, float *pMinHAE, float *pMaxHAE)
+{
+    TerrainRaster_t *pRaster = (TerrainRaster_t *)pTerrain;
+    double south = degrees(latMin), north = degrees(latMax), west = degrees(lonMin), east = degrees(lonMax);
+    int latStart = (int)floor(south), latEnd = (int)floor(north);
+    int lonStart = (int)floor(west), lonEnd = (int)floor(east);
+    float low = FLT_MAX, high = -FLT_MAX;
+    int lat, lon;
+
+    // Boxes this big aren't worth it, the ray marcher will just try a smaller one
+    if((latEnd - latStart + 1) * (lonEnd - lonStart + 1) > RASTER_BOUNDS_TILES)
+        return FALSE;
+
+    for(lat = latStart; lat <= latEnd; lat++)
+    {
+        for(lon = lonStart; lon <= lonEnd; lon++)
+        {
+            TerrainRasterTile_t *pTile = (TerrainRasterTile_t *)getTile(pRaster, lat, lon);
+            int rowStart, rowEnd, colStart, colEnd, row, col;
+
+            // Lookups in a missing tile come back as no data
+            if(pTile == NULL)
+            {
+                low = MIN(low, TERRAIN_NO_DATA);
+                high = MAX(high, TERRAIN_NO_DATA);
+                continue;
+            }
+
+            // Find the cells between posts that the box covers in this tile, which set the blocks it covers
+            rowStart = (int)(MAX(south - lat, 0.0) * (pTile->rows - 1));
+            rowEnd   = (int)(MIN(north - lat, 1.0) * (pTile->rows - 1));
+            colStart = (int)(MAX(west - lon, 0.0) * (pTile->cols - 1));
+            colEnd   = (int)(MIN(east - lon, 1.0) * (pTile->cols - 1));
+
+            rowStart = MIN(rowStart, pTile->rows - 2) / TERRAIN_RASTER_BLOCK;
+            rowEnd   = MIN(rowEnd,   pTile->rows - 2) / TERRAIN_RASTER_BLOCK;
+            colStart = MIN(colStart, pTile->cols - 2) / TERRAIN_RASTER_BLOCK;
+            colEnd   = MIN(colEnd,   pTile->cols - 2) / TERRAIN_RASTER_BLOCK;
+
+            for(row = rowStart; row <= rowEnd; row++)
+            {
+                for(col = colStart; col <= colEnd; col++)
+                {
+                    const TerrainRasterBlock_t *pBlock = getBlock(pTile, row, col);
+
+                    // Out of memory for the block bounds
+                    if(pBlock == NULL)
+                        return FALSE;
+
+                    // Cells with only void posts come back as no data
+                    if(pBlock->voids)
+                    {
+                        low = MIN(low, TERRAIN_NO_DATA);
+                        high = MAX(high, TERRAIN_NO_DATA);
+                    }
+
+                    if(pBlock->minHeight <= pBlock->maxHeight)
+                    {
+                        low = MIN(low, pBlock->minHeight + pRaster->geoidUndulation);
+                        high = MAX(high, pBlock->maxHeight + pRaster->geoidUndulation);
+                    }
+                }
+            }
+        }
+    }
+
+    *pMinHAE = low;
+    *pMaxHAE = high;
+    return TRUE;
+
+}// getRasterBounds
+
+
+/*!
+ * Find a tile in the cache, loading it if it isn't there
+ * \param pRaster is the provider whose cache to look in
+ * \param lat is the latitude of the southwest corner of the tile in degrees
+ * \param lon is the longitude of the southwest corner of the tile in degrees
+ * \return the tile, or NULL if there's no data for it
+ */
+static const TerrainRasterTile_t *getTile(TerrainRaster_t *pRaster, int lat, int lon)
+{
+    TerrainRasterTile_t *pTile = &pRaster->tiles[pRaster->last];
+    int i, oldest = 0;
+
+    // Keep longitudes from -180 to 179, so tiles on either side of the antimeridian are found
+    lon = ((lon + 180) % 360 + 360) % 360 - 180;
+
+    if((lat < -90) || (lat >= 90))
+        return NULL;
+
+    // Most lookups land in the same tile as the last one
+    if((pTile->state == RASTER_UNUSED) || (pTile->lat != lat) || (pTile->lon != lon))
+    {
+        for(i = 0, pTile = NULL; i < TERRAIN_RASTER_TILES; i++)
+        {
+            TerrainRasterTile_t *pSlot = &pRaster->tiles[i];
+
+            if((pSlot->state != RASTER_UNUSED) && (pSlot->lat == lat) && (pSlot->lon == lon))
+            {
+                pTile = pSlot;
+                break;
+            }
+
+            // Keep track of the slot to load into if the tile isn't found, the first unused one or else the least recently used
+            if((pRaster->tiles[oldest].state != RASTER_UNUSED) &&
+               ((pSlot->state == RASTER_UNUSED) || (pRaster->useCount - pSlot->lastUse > pRaster->useCount - pRaster->tiles[oldest].lastUse)))
+                oldest = i;
+        }
+
+        // Not in the cache, so throw out the oldest tile and load this one in its place
+        if(pTile == NULL)
+        {
+            pTile = &pRaster->tiles[oldest];
+
+            if(pTile->state != RASTER_UNUSED)
+                pRaster->evictions++;
+
+            unloadTile(pTile);
+            pTile->lat = lat;
+            pTile->lon = lon;
+
+            if(loadTile(pRaster, pTile))
+            {
+                pTile->state = RASTER_LOADED;
+                pRaster->loads++;
+            }
+            else
+            {
+                // Remember that it's missing, so it isn't looked for on every lookup
+                pTile->state = RASTER_MISSING;
+                pRaster->missing++;
+            }
+        }
+
+        pRaster->last = (int)(pTile - pRaster->tiles);
+    }
+
+    pTile->lastUse = ++pRaster->useCount;
+
+    return (pTile->state == RASTER_LOADED) ? pTile : NULL;
+
+}// getTile
+
+
+/*!
+ * Load a tile from whichever file has it, SRTM first and then DTED from the highest level down
+ * \param pRaster is the provider, which has the directory to look in
+ * \param pTile is the tile to load, with its lat and lon filled in
+ * \return TRUE if the tile was loaded
+ */
+static BOOL loadTile(const TerrainRaster_t *pRaster, TerrainRasterTile_t *pTile)
+{
+    char path[TERRAIN_RASTER_PATH + 32];
+    int level;
+
+    sprintf(path, "%s/%c%02d%c%03d.hgt", pRaster->directory, (pTile->lat < 0) ? 'S' : 'N', abs(pTile->lat), (pTile->lon < 0) ? 'W' : 'E', abs(pTile->lon));
+
+    if(mapTile(pTile, path) && setupSrtm(pTile))
+        return TRUE;
+
+    unloadTile(pTile);
+
+    for(level = 2; level >= 0; level--)
+    {
+        sprintf(path, "%s/%c%03d/%c%02d.dt%d", pRaster->directory, (pTile->lon < 0) ? 'w' : 'e', abs(pTile->lon), (pTile->lat < 0) ? 's' : 'n', abs(pTile->lat), level);
+
+        if(mapTile(pTile, path) && setupDted(pTile))
+            return TRUE;
+
+        unloadTile(pTile);
+    }
+
+    return FALSE;
+
+}// loadTile
+
+
+//! Lay out a mapped SRTM file: square, big endian, northernmost row first
+static BOOL setupSrtm(TerrainRasterTile_t *pTile)
+{
+    int n = (int)(sqrt(pTile->mapSize / 2.0) + 0.5);
+
+    // The only way to tell the resolution is from the file size
+    if((n < 2) || ((size_t)n * n * 2 != pTile->mapSize))
+        return FALSE;
+
+    pTile->rows = pTile->cols = n;
+    pTile->rowStride = -2 * (ptrdiff_t)n;
+    pTile->colStride = 2;
+    pTile->pOrigin = pTile->pMap + (size_t)(n - 1) * n * 2;
+    pTile->signMagnitude = FALSE;
+
+    return TRUE;
+
+}// setupSrtm
+
+
+//! Lay out a mapped DTED file: big endian, one record per longitude line going east, each one starting at the south
+static BOOL setupDted(TerrainRasterTile_t *pTile)
+{
+    const uint8_t *pData = pTile->pMap;
+    size_t size = pTile->mapSize;
+
+    // Skip over the tape header record if there is one
+    if((size >= 80) && (memcmp(pData, "HDR", 3) == 0))
+    {
+        pData += 80;
+        size -= 80;
+    }
+
+    if((size < DTED_HEADER_SIZE) || (memcmp(pData, "UHL", 3) != 0))
+        return FALSE;
+
+    // The user header has the number of longitude lines and the number of posts along each one
+    pTile->cols = parseField(pData + 47, 4);
+    pTile->rows = parseField(pData + 51, 4);
+
+    if((pTile->rows < 2) || (pTile->cols < 2))
+        return FALSE;
+
+    pTile->rowStride = 2;
+    pTile->colStride = DTED_RECORD_HEADER + 2 * (ptrdiff_t)pTile->rows + DTED_RECORD_CHECKSUM;
+
+    // Make sure every record is there, and that the first one is where it should be
+    if((size - DTED_HEADER_SIZE < (size_t)pTile->cols * pTile->colStride) || (pData[DTED_HEADER_SIZE] != 0xAA))
+        return FALSE;
+
+    pTile->pOrigin = pData + DTED_HEADER_SIZE + DTED_RECORD_HEADER;
+    pTile->signMagnitude = TRUE;
+
+    return TRUE;
+
+}// setupDted
+
+
+//! Parse a fixed width decimal field, returns -1 if it isn't all digits
+static int parseField(const uint8_t *pField, int length)
+{
+    int i, value = 0;
+
+    for(i = 0; i < length; i++)
+    {
+        if((pField[i] < '0') || (pField[i] > '9'))
+            return -1;
+
+        value = value * 10 + (pField[i] - '0');
+    }
+
+    return value;
+
+}// parseField
+
+
+//! Map a whole file read-only into a tile slot, returns FALSE if it can't be opened
+static BOOL mapTile(TerrainRasterTile_t *pTile, const char *path)
+{
+#ifdef _WIN32
+    LARGE_INTEGER size;
+    HANDLE hFile = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, NULL);
+
+    if(hFile == INVALID_HANDLE_VALUE)
+        return FALSE;
+
+    pTile->hFile = hFile;
+
+    if(!GetFileSizeEx(hFile, &size) || (size.QuadPart == 0))
+        return FALSE;
+
+    if((pTile->hMapping = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL)) == NULL)
+        return FALSE;
+
+    if((pTile->pMap = (const uint8_t *)MapViewOfFile(pTile->hMapping, FILE_MAP_READ, 0, 0, 0)) == NULL)
+        return FALSE;
+
+    pTile->mapSize = (size_t)size.QuadPart;
+#else
+    struct stat info;
+    void *pMap = MAP_FAILED;
+    int handle = open(path, O_RDONLY);
+
+    if(handle < 0)
+        return FALSE;
+
+    if((fstat(handle, &info) == 0) && (info.st_size > 0))
+        pMap = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_SHARED, handle, 0);
+
+    // The mapping stays valid after the descriptor is closed
+    close(handle);
+
+    if(pMap == MAP_FAILED)
+        return FALSE;
+
+    // Lookups hop around the tile, so reading ahead would only waste memory
+    madvise(pMap, (size_t)info.st_size, MADV_RANDOM);
+    pTile->pMap = (const uint8_t *)pMap;
+    pTile->mapSize = (size_t)info.st_size;
+#endif // _WIN32
+
+    return TRUE;
+
+}// mapTile
+
+
+//! Unmap a tile's file and free its block bounds, leaving the slot unused
+static void unloadTile(TerrainRasterTile_t *pTile)
+{
+    int lat, lon;
+
+#ifdef _WIN32
+    if(pTile->pMap != NULL)
+        UnmapViewOfFile(pTile->pMap);
+
+    if(pTile->hMapping != NULL)
+        CloseHandle(pTile->hMapping);
+
+    if(pTile->hFile != NULL)
+        CloseHandle(pTile->hFile);
+#else
+    if(pTile->pMap != NULL)
+        munmap((void *)pTile->pMap, pTile->mapSize);
+#endif // _WIN32
+
+    free(pTile->pBlocks);
+
+    // Keep the position, which the loader still needs after a file fails to map
+    lat = pTile->lat;
+    lon = pTile->lon;
+    memset(pTile, 0, sizeof(TerrainRasterTile_t));
+    pTile->lat = lat;
+    pTile->lon = lon;
+
+}// unloadTile
+
+
+//! Read one post from a tile, counting rows north from the southern edge and columns east from the western edge
+static int readPost(const TerrainRasterTile_t *pTile, int row, int col)
+{
+    const uint8_t *pPost = pTile->pOrigin + row * pTile->rowStride + col * pTile->colStride;
+    int value = (pPost[0] << 8) | pPost[1];
+
+    if(pTile->signMagnitude)
+        return (value & 0x8000) ? -(value & 0x7FFF) : value;
+    else
+        return (int16_t)value;
+
+}// readPost
+
+
+/*!
+ * Bilinearly interpolate the height at a point in a tile from the non-void posts around it
+ * \param pRaster is the provider, which has the geoid undulation
+ * \param pTile is the tile that the point is in
+ * \param fracLat is how far north the point is across the tile, from 0 to 1
+ * \param fracLon is how far east the point is across the tile, from 0 to 1
+ * \return the height above the ellipsoid in meters, or TERRAIN_NO_DATA if every post around it is void
+ */
+static float interpolateTile(const TerrainRaster_t *pRaster, const TerrainRasterTile_t *pTile, double fracLat, double fracLon)
+{
+    double y = fracLat * (pTile->rows - 1), x = fracLon * (pTile->cols - 1);
+    int row = MIN((int)y, pTile->rows - 2), col = MIN((int)x, pTile->cols - 2);
+    double fy = y - row, fx = x - col, sum = 0, weight = 0;
+    int post, i;
+
+    for(i = 0; i < 4; i++)
+    {
+        // Corners in the order southwest, southeast, northwest, northeast
+        double w = ((i & 2) ? fy : 1.0 - fy) * ((i & 1) ? fx : 1.0 - fx);
+
+        post = readPost(pTile, row + (i >> 1), col + (i & 1));
+
+        if(post > RASTER_VOID_LIMIT)
+        {
+            sum += w * post;
+            weight += w;
+        }
+    }
+
+    if(weight <= 0)
+        return TERRAIN_NO_DATA;
+    else
+        return (float)(sum / weight) + pRaster->geoidUndulation;
+
+}// interpolateTile
+
+
+/*!
+ * Get the height bounds over one block of a tile, working them out the first time
+ * \param pTile is the tile that the block is in
+ * \param blockRow is the block's row, counting north from the southern edge
+ * \param blockCol is the block's column, counting east from the western edge
+ * \return the block bounds, or NULL if there's no memory for them
+ */
+static const TerrainRasterBlock_t *getBlock(TerrainRasterTile_t *pTile, int blockRow, int blockCol)
+{
+    TerrainRasterBlock_t *pBlock;
+
+    // Blocks cover the cells between posts, so the posts on their edges are shared with the next block
+    if(pTile->pBlocks == NULL)
+    {
+        pTile->blockRows = (pTile->rows - 2) / TERRAIN_RASTER_BLOCK + 1;
+        pTile->blockCols = (pTile->cols - 2) / TERRAIN_RASTER_BLOCK + 1;
+        pTile->pBlocks = (TerrainRasterBlock_t *)calloc((size_t)pTile->blockRows * pTile->blockCols, sizeof(TerrainRasterBlock_t));
+
+        if(pTile->pBlocks == NULL)
+            return NULL;
+    }
+
+    pBlock = &pTile->pBlocks[blockRow * pTile->blockCols + blockCol];
+
+    if(!pBlock->computed)
+    {
+        int rowEnd = MIN((blockRow + 1) * TERRAIN_RASTER_BLOCK, pTile->rows - 1);
+        int colEnd = MIN((blockCol + 1) * TERRAIN_RASTER_BLOCK, pTile->cols - 1);
+        int row, col, post;
+
+        pBlock->minHeight = INT16_MAX;
+        pBlock->maxHeight = INT16_MIN;
+
+        // DTED stores each column together, so walk down the columns
+        for(col = blockCol * TERRAIN_RASTER_BLOCK; col <= colEnd; col++)
+        {
+            for(row = blockRow * TERRAIN_RASTER_BLOCK; row <= rowEnd; row++)
+            {
+                post = readPost(pTile, row, col);
+
+                if(post <= RASTER_VOID_LIMIT)
+                    pBlock->voids = 1;
+                else
+                {
+                    pBlock->minHeight = (int16_t)MIN(pBlock->minHeight, post);
+                    pBlock->maxHeight = (int16_t)MAX(pBlock->maxHeight, post);
+                }
+            }
+        }
+
+        pBlock->computed = 1;
+    }
+
+    return pBlock;
+
+}// getBlock
@@ -0,0 +1,128 @@
+#ifndef TERRAINRASTER_H
+#define TERRAINRASTER_H
+
+/*!
+ * \file TerrainRaster.h
+ * \brief Terrain provider for gridded elevation data in SRTM or DTED files.
+ *
+ * Elevation data is read from one degree by one degree tiles in a directory,
+ * either SRTM height files named like N37W122.hgt or DTED files laid out the
+ * usual way, like w122/n37.dt2. Tiles are memory-mapped as they are needed,
+ * so only the pages that lookups touch ever get read, and a small number of
+ * them are kept open with the least recently used one closed to make room.
+ * Heights are bilinearly interpolated from the four surrounding posts, with
+ * void posts left out.
+ *
+ * Height bounds for skipping stretches of a line of sight are worked out over
+ * blocks of TERRAIN_RASTER_BLOCK by TERRAIN_RASTER_BLOCK posts, each one the
+ * first time a query covers it.
+ *
+ * SRTM and DTED heights are above mean sea level. They are converted to
+ * heights above the ellipsoid with a single geoid undulation, which the user
+ * should keep up to date, e.g. from GeolocateTelemetryCore_t::geoidUndulation.
+ *
+ * The provider keeps its cache in the structure, so it must only be used from
+ * one thread at a time.
+ */
+
+#include "TerrainProvider.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+//! Number of tiles kept open at once
+#define TERRAIN_RASTER_TILES 16
+
+//! Posts along each side of a block that height bounds are kept for
+#define TERRAIN_RASTER_BLOCK 32
+
+//! Longest directory path
+#define TERRAIN_RASTER_PATH 256
+
+//! Height bounds over one block of posts in a tile
+typedef struct
+{
+    //! Lowest and highest height of the non-void posts in meters above mean sea level
+    int16_t minHeight;
+    int16_t maxHeight;
+
+    //! Set once the bounds have been worked out
+    uint8_t computed;
+
+    //! Set if any of the posts are void, or all of them if minHeight > maxHeight
+    uint8_t voids;
+
+} TerrainRasterBlock_t;
+
+typedef struct
+{
+    //! Southwest corner of the tile in degrees, and whether it's loaded, missing, or the slot is unused
+    int lat;
+    int lon;
+    int state;
+
+    //! Value of the use counter the last time the tile was looked at
+    uint32_t lastUse;
+
+    //! Mapped file and its platform handles
+    const uint8_t *pMap;
+    size_t mapSize;
+    void *hFile;
+    void *hMapping;
+
+    //! Southwest post, and the bytes between posts going north and going east
+    const uint8_t *pOrigin;
+    ptrdiff_t rowStride;
+    ptrdiff_t colStride;
+
+    //! Posts going north and going east
+    int rows;
+    int cols;
+
+    //! Set for DTED, which stores heights in sign and magnitude instead of two's complement
+    BOOL signMagnitude;
+
+    //! Height bounds for each block, allocated the first time they're asked for
+    TerrainRasterBlock_t *pBlocks;
+    int blockRows;
+    int blockCols;
+
+} TerrainRasterTile_t;
+
+typedef struct
+{
+    //! Callbacks and bounds for the terrain intersection code, must be first
+    TerrainProvider_t base;
+
+    //! Directory that the tiles are in
+    char directory[TERRAIN_RASTER_PATH];
+
+    //! Height of the geoid above the ellipsoid in meters, added to every height
+    float geoidUndulation;
+
+    //! Open tiles, the one that was looked at last, and a counter for finding the least recently used one
+    TerrainRasterTile_t tiles[TERRAIN_RASTER_TILES];
+    int last;
+    uint32_t useCount;
+
+    //! Tiles that were mapped, found to be missing, and closed to make room
+    uint32_t loads;
+    uint32_t missing;
+    uint32_t evictions;
+
+} TerrainRaster_t;
+
+//! Set up a raster terrain provider for the tiles in a directory, returns FALSE if the path is too long
+BOOL terrainRasterInit(TerrainRaster_t *pRaster, const char *directory, float geoidUndulation);
+
+//! Close every tile that the provider has open
+void terrainRasterFree(TerrainRaster_t *pRaster);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // TERRAINRASTER_H
@@ -1,5 +1,16 @@
 #include "TrilliumPacket.h"
 
+#include <string.h>
+
+// Use SSE2 for the block checksum wherever the compiler says it's available
+#if !defined(TRILLIUM_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define TRILLIUM_CHECKSUM_SSE2
+#include <emmintrin.h>
+#endif
+
+// Largest number of bytes that can be rolled into the 32-bit checksum sums before reducing them
+#define CHECKSUM_BLOCK_SIZE 4096
+
 // Running checksum calculation functions
 static void InitChecksum(UInt8 Byte, UInt16 *pA, UInt16 *pB);
 static void UpdateChecksum(UInt8 Byte, UInt16 *pA, UInt16 *pB);
@@ -56,7 +67,10 @@ BOOL LookForTrilliumPacketInByteEx(TrilliumPkt_t *pPkt, TrilliumPktInfo_t *pInfo
         {
             // If this is the first checksum byte and it doesn match up, restart the state machine
             if ((pInfo->State == pInfo->MaxState - 1) && ((pInfo->Check0 & 0xFF) != Byte))
+            {
                 pInfo->State = 0;
+                pInfo->Errors++;
+            }
             // If we got at least one packet's worth of bytes and it looks like we've got all this packet's data
             else if (pInfo->State >= pInfo->MaxState)
             {
@@ -64,7 +78,10 @@ BOOL LookForTrilliumPacketInByteEx(TrilliumPkt_t *pPkt, TrilliumPktInfo_t *pInfo
                 pInfo->State = 0;
 
                 // And finally, return true if the checksum... checks out
-                return (pInfo->Check1 & 0xFF) == Byte;
+                if ((pInfo->Check1 & 0xFF) == Byte)
+                    return TRUE;
+
+                pInfo->Errors++;
             }
         }
         break;
@@ -75,10 +92,102 @@ BOOL LookForTrilliumPacketInByteEx(TrilliumPkt_t *pPkt, TrilliumPktInfo_t *pInfo
 
 }// LookForOrionPacketInByte
 
+UInt32 LookForTrilliumPacketsInBufferEx(TrilliumPkt_t *pPkt, TrilliumPktInfo_t *pInfo, UInt16 Sync, const UInt8 *pData, UInt32 Size, TrilliumPktHandler_t pHandler, void *pUser)
+{
+    const UInt8 Sync0 = (UInt8)(Sync >> 8), Sync1 = (UInt8)(Sync & 0xFF);
+    UInt32 i = 0;
+
+    // If there's no packet tracking info or nowhere to put partial packets, we can't do this
+    if ((pInfo == NULL) || (pPkt == NULL))
+        return 0;
+
+    // If a packet was split across the last call and this one, finish it off a byte at a time
+    while ((pInfo->State != 0) && (i < Size))
+    {
+        // If this byte completes the partial packet, hand it to the caller
+        if (LookForTrilliumPacketInByteEx(pPkt, pInfo, Sync, pData[i++]))
+        {
+            // Stop here if the caller doesn't want any more packets
+            if ((pHandler != NULL) && (pHandler(pPkt, pUser) == FALSE))
+                return i;
+        }
+    }
+
+    // Now walk through the rest of the buffer
+    while (i < Size)
+    {
+        const UInt8 *pStart = (const UInt8 *)memchr(&pData[i], Sync0, Size - i);
+        UInt32 Remaining, Length;
+
+        // If there's no sync byte anywhere in the rest of the buffer, we're done
+        if (pStart == NULL)
+            return Size;
+
+        // Skip straight to the sync byte
+        i = (UInt32)(pStart - pData);
+        Remaining = Size - i;
+
+        // If the header's not all here, let the state machine hold on to the leftovers
+        if (Remaining < TRILLIUM_PKT_HEADER_SIZE)
+            break;
+
+        // Get the payload length of this potential packet
+        Length = pStart[3];
+
+        // If the second sync byte or the length is bogus, resync starting at the next byte
+        if ((pStart[1] != Sync1) || (Length > TRILLIUM_PKT_MAX_SIZE))
+            i++;
+        // If the whole packet is in the buffer, we can validate it in place
+        else if (Remaining >= Length + TRILLIUM_PKT_OVERHEAD)
+        {
+            UInt16 Check0 = 1, Check1 = 0;
+            UInt32 j = Length + TRILLIUM_PKT_HEADER_SIZE;
+
+            // Roll the header and payload into the checksum
+            UpdateTrilliumChecksum(pStart, j, &Check0, &Check1);
+
+            // If the checksum matches
+            if (((Check0 & 0xFF) == pStart[j]) && ((Check1 & 0xFF) == pStart[j + 1]))
+            {
+                // Skip over the whole packet
+                i += Length + TRILLIUM_PKT_OVERHEAD;
+
+                // Hand the caller a pointer to the packet in their buffer, and stop if they say so
+                if ((pHandler != NULL) && (pHandler((const TrilliumPkt_t *)pStart, pUser) == FALSE))
+                    return i;
+            }
+            // Otherwise count the error and resync starting at the next byte
+            else
+            {
+                pInfo->Errors++;
+                i++;
+            }
+        }
+        // Otherwise this packet runs off the end of the buffer
+        else
+            break;
+    }
+
+    // Pass any leftover bytes to the state machine so the packet can be completed on the next call
+    while (i < Size)
+    {
+        // Complete packets were all handled above, but don't drop one if the state machine finds it
+        if (LookForTrilliumPacketInByteEx(pPkt, pInfo, Sync, pData[i++]))
+        {
+            if ((pHandler != NULL) && (pHandler(pPkt, pUser) == FALSE))
+                return i;
+        }
+    }
+
+    // Tell the caller that we used up the whole buffer
+    return Size;
+
+}// LookForTrilliumPacketsInBufferEx
+
 BOOL MakeTrilliumPacket(TrilliumPkt_t *pPkt, UInt16 Sync, UInt8 ID, UInt16 Length)
 {
     // Get a byte pointer to the start of the packet structure
-    UInt8 *pData = (UInt8 *)pPkt, i;
+    UInt8 *pData = (UInt8 *)pPkt;
 
     // If this is an invalid data length, return FALSE immediately
     if (Length > TRILLIUM_PKT_MAX_SIZE)
@@ -92,9 +201,8 @@ BOOL MakeTrilliumPacket(TrilliumPkt_t *pPkt, UInt16 Sync, UInt8 ID, UInt16 Lengt
     pPkt->Info.Check0 = 1;
     pPkt->Info.Check1 = 0;
 
-    // Roll each byte into the running checksum
-    for (i = 0; i < Length + TRILLIUM_PKT_HEADER_SIZE; i++)
-        UpdateChecksum(pData[i], &pPkt->Info.Check0, &pPkt->Info.Check1);
+    // Roll the header and payload into the checksum
+    UpdateTrilliumChecksum(pData, Length + TRILLIUM_PKT_HEADER_SIZE, &pPkt->Info.Check0, &pPkt->Info.Check1);
 
     // Negate the checksum and paste its bytes onto the end of the data payload
     pPkt->Data[Length++] = (UInt8)(pPkt->Info.Check0 & 0xFF);
@@ -119,3 +227,74 @@ static void UpdateChecksum(UInt8 Byte, UInt16 *pA, UInt16 *pB)
     *pB = (*pB + *pA) % 251;
 
 }// UpdateChecksum
+
+/*!
+ * Roll a block of bytes into a running Fletcher-251 checksum. The results are identical to
+ * feeding the bytes through UpdateChecksum one at a time, but the sums are only reduced mod 251
+ * once every CHECKSUM_BLOCK_SIZE bytes instead of twice per byte.
+ * \param pData points to the bytes to add to the checksum
+ * \param Size is the number of bytes in pData
+ * \param pCheck0 is the running first checksum byte, which must be less than 251
+ * \param pCheck1 is the running second checksum byte, which must be less than 251
+ */
+void UpdateTrilliumChecksum(const UInt8 *pData, UInt32 Size, UInt16 *pCheck0, UInt16 *pCheck1)
+{
+    UInt32 A = *pCheck0, B = *pCheck1;
+
+    while (Size > 0)
+    {
+        // Only take on as many bytes as the 32-bit sums can absorb without overflowing
+        UInt32 Block = (Size < CHECKSUM_BLOCK_SIZE) ? Size : CHECKSUM_BLOCK_SIZE, i = 0;
+
+#ifdef TRILLIUM_CHECKSUM_SSE2
+        // Byte weights for the second sum within a 16-byte chunk, i.e. 16 for the first byte down to 1 for the last
+        const __m128i WeightLo = _mm_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9);
+        const __m128i WeightHi = _mm_setr_epi16(8, 7, 6, 5, 4, 3, 2, 1);
+        const __m128i Zero = _mm_setzero_si128();
+        __m128i Sum = Zero, Prefix = Zero, Weighted = Zero;
+        UInt32 Chunks = Block / 16, Lanes[4];
+
+        for (i = 0; i < Chunks * 16; i += 16)
+        {
+            __m128i Bytes = _mm_loadu_si128((const __m128i *)&pData[i]);
+
+            // Each earlier byte gets added to the second sum once for every byte in this chunk
+            Prefix = _mm_add_epi32(Prefix, Sum);
+
+            // Add up the plain bytes for the first sum...
+            Sum = _mm_add_epi32(Sum, _mm_sad_epu8(Bytes, Zero));
+
+            // ...and the weighted bytes for the second sum
+            Weighted = _mm_add_epi32(Weighted, _mm_madd_epi16(_mm_unpacklo_epi8(Bytes, Zero), WeightLo));
+            Weighted = _mm_add_epi32(Weighted, _mm_madd_epi16(_mm_unpackhi_epi8(Bytes, Zero), WeightHi));
+        }
+
+        // The second sum picks up the starting first sum once per byte, plus everything above
+        B += 16 * Chunks * A;
+
+        _mm_storeu_si128((__m128i *)Lanes, _mm_add_epi32(_mm_slli_epi32(Prefix, 4), Weighted));
+        B += Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+
+        _mm_storeu_si128((__m128i *)Lanes, Sum);
+        A += Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+#endif // TRILLIUM_CHECKSUM_SSE2
+
+        // Pick up whatever's left a byte at a time, without reducing
+        for (; i < Block; i++)
+        {
+            A += pData[i];
+            B += A;
+        }
+
+        // Now do the reduction once for the whole block
+        A %= 251;
+        B %= 251;
+
+        pData += Block;
+        Size -= Block;
+    }
+
+    *pCheck0 = (UInt16)A;
+    *pCheck1 = (UInt16)B;
+
+}// UpdateTrilliumChecksum
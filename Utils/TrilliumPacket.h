@@ -13,6 +13,12 @@ typedef struct
     UInt16 MaxState;
     UInt16 Check0;
     UInt16 Check1;
+
+    // Number of packets with a good header and a bad checksum, which is never reset by the parser
+    UInt16 Errors;
+
+    // Host time in microseconds that the packet was received at, set by receivers that keep time and never by the parser
+    UInt64 Time;
 } TrilliumPktInfo_t;
 
 typedef struct
@@ -27,6 +33,11 @@ typedef struct
     TrilliumPktInfo_t Info;
 } TrilliumPkt_t;
 
+// Callback for complete packets found by LookForTrilliumPacketsInBufferEx. The packet may point
+//   straight into the caller's buffer, so only the header and payload are valid, and only until
+//   the callback returns. Return FALSE to stop parsing immediately after this packet.
+typedef BOOL (*TrilliumPktHandler_t)(const TrilliumPkt_t *pPkt, void *pUser);
+
 #ifdef __cplusplus
 extern "C" {
 #endif // __cplusplus
@@ -34,8 +45,13 @@ extern "C" {
 BOOL LookForTrilliumPacketInByteEx(TrilliumPkt_t *pPkt, TrilliumPktInfo_t *pInfo, UInt16 Sync, UInt8 Byte);
 #define LookForTrilliumPacketInByte(pPkt, Sync, Byte) LookForTrilliumPacketInByteEx(pPkt, &(pPkt)->Info, Sync, Byte)
 
+UInt32 LookForTrilliumPacketsInBufferEx(TrilliumPkt_t *pPkt, TrilliumPktInfo_t *pInfo, UInt16 Sync, const UInt8 *pData, UInt32 Size, TrilliumPktHandler_t pHandler, void *pUser);
+#define LookForTrilliumPacketsInBuffer(pPkt, Sync, pData, Size, pHandler, pUser) LookForTrilliumPacketsInBufferEx(pPkt, &(pPkt)->Info, Sync, pData, Size, pHandler, pUser)
+
 BOOL MakeTrilliumPacket(TrilliumPkt_t *pPkt, UInt16 Sync, UInt8 Type, UInt16 Length);
 
+void UpdateTrilliumChecksum(const UInt8 *pData, UInt32 Size, UInt16 *pCheck0, UInt16 *pCheck1);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
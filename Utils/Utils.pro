@@ -12,25 +12,51 @@ CONFIG += staticlib
 
 SOURCES += dcm.c \
     earthposition.c \
+    earthpositionf.c \
     earthrotation.c \
+    fastmath.c \
     GpsDataReceive.c \
     GeolocateTelemetry.c \
+    GeolocateHistory.c \
+    SpscRing.c \
+    ImageVelocity.c \
+    PathStream.c \
     linearalgebra.c \
+    linearallocator.c \
+    Orthorectify.c \
     mathutilities.c \
     OrionPublicPacketShim.c \
     quaternion.c \
+    TerrainRaster.c \
+    TelemetryArchive.c \
+    Viewshed.c \
     TrilliumPacket.c \
     WGS84.c
 
 HEADERS += dcm.h \
+    dcm3.h \
     earthposition.h \
+    earthpositionf.h \
+    splitfloat.h \
     earthrotation.h \
+    fastmath.h \
     GpsDataReceive.h \
     GeolocateTelemetry.h \
+    GeolocateHistory.h \
+    Atomics.h \
+    SpscRing.h \
+    ImageVelocity.h \
+    PathStream.h \
     linearalgebra.h \
+    linearallocator.h \
+    Orthorectify.h \
     mathutilities.h \
     OrionPublicPacketShim.h \
     quaternion.h \
+    TerrainProvider.h \
+    TerrainRaster.h \
+    TelemetryArchive.h \
+    Viewshed.h \
     TrilliumPacket.h \
     WGS84.h
 
@@ -0,0 +1,484 @@
+#include "Viewshed.h"
+#include "WGS84.h"
+#include "Constants.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+# include <windows.h>
+typedef volatile LONG ViewshedCounter_t;
+# define viewshedNextUnit(p)    (InterlockedIncrement(p) - 1)
+#else
+# include <pthread.h>
+typedef int ViewshedCounter_t;
+# define viewshedNextUnit(p)    __atomic_fetch_add((p), 1, __ATOMIC_RELAXED)
+#endif // _WIN32
+
+//! The three passes over the map, each shared out over the threads a unit of work at a time
+#define PHASE_TERRAIN   0
+#define PHASE_SWEEP     1
+#define PHASE_MERGE     2
+
+//! Rows of the map that are added up in each unit of work of the merge pass
+#define MERGE_ROWS 16
+
+//! Everything the worker threads share
+typedef struct
+{
+    //! What the caller asked for
+    const ViewshedGrid_t *pGrid;
+    const ViewshedSensor_t *pSensor;
+    const double (*trackLLA)[NLLA];
+    int numTrack;
+    const TerrainProvider_t *const *ppTerrain;
+
+    //! Terrain height of every cell of the map padded out to take in the track, and where the map is in it
+    float *pHeight;
+    int rows;
+    int cols;
+    int rowOffset;
+    int colOffset;
+
+    //! Cell size in meters, drop of the line of sight below level per square meter of distance, and the longest ray in cells
+    double cellNorth;
+    double cellEast;
+    double curvature;
+    int reach;
+
+    //! Line of sight slopes that the sensor can point at, and the slant range limits squared
+    double minSlope;
+    double maxSlope;
+    double minRange2;
+    double maxRange2;
+
+    //! Counts for each thread, the first of which is the caller's, and the number of covered cells each thread found while merging
+    uint16_t *pCounts[VIEWSHED_MAX_THREADS];
+    int covered[VIEWSHED_MAX_THREADS];
+
+    //! Number of threads, pass that's running, how many units of work it has, and the next one to hand out
+    int numThreads;
+    int phase;
+    int units;
+    ViewshedCounter_t next;
+
+} ViewshedJob_t;
+
+//! A worker thread's job and which thread it is
+typedef struct
+{
+    ViewshedJob_t *pJob;
+    int index;
+
+} ViewshedWorker_t;
+
+static void runPhase(ViewshedJob_t *pJob, int phase, int units, int numThreads);
+static void runWorker(ViewshedWorker_t *pWorker);
+static void sampleBlock(ViewshedJob_t *pJob, int unit, const TerrainProvider_t *pTerrain);
+static void sweepOctant(ViewshedJob_t *pJob, int track, int octant, uint16_t *pCount);
+static int mergeRows(ViewshedJob_t *pJob, int unit);
+
+
+/*!
+ * Work out how many track positions each cell of a coverage map can be seen
+ * from. The terrain along the way is sampled from the terrain providers, one
+ * per thread, at the cell spacing of the map.
+ * \param pGrid is the layout of the map
+ * \param pSensor gives the limits of what the sensor can see
+ * \param trackLLA is the position of each point along the track, in radians
+ *        and meters above the ellipsoid
+ * \param numTrack is the number of track positions, up to VIEWSHED_MAX_TRACK
+ * \param ppTerrain gives a terrain provider for each thread, which only that
+ *        thread will use
+ * \param numThreads is the number of threads to use, up to VIEWSHED_MAX_THREADS
+ * \param pCount receives the number of track positions each cell can be seen
+ *        from, rows going north with each row going east
+ * \return the number of cells that can be seen from at least one track
+ *         position, or -1 if the arguments are bad or memory ran out
+ */
+int viewshedCompute(const ViewshedGrid_t *pGrid, const ViewshedSensor_t *pSensor, const double (*trackLLA)[NLLA], int numTrack,
+                    const TerrainProvider_t *const *ppTerrain, int numThreads, uint16_t *pCount)
+{
+    ViewshedJob_t Job;
+    double latCenter, sinLat, meridian, transverse, low, high;
+    size_t cells = (size_t)pGrid->rows * pGrid->cols;
+    int i, rowMax, colMax, covered = -1;
+
+    if ((pGrid->rows <= 0) || (pGrid->cols <= 0) || (numTrack < 0) || (numTrack > VIEWSHED_MAX_TRACK) ||
+        (numThreads <= 0) || (numThreads > VIEWSHED_MAX_THREADS))
+        return -1;
+
+    memset(&Job, 0, sizeof(Job));
+    Job.pGrid = pGrid;
+    Job.pSensor = pSensor;
+    Job.trackLLA = trackLLA;
+    Job.numTrack = numTrack;
+    Job.ppTerrain = ppTerrain;
+    Job.numThreads = numThreads;
+
+    // Cells are small enough next to the map that one cell size in meters, from the middle of the map, does for all of them
+    latCenter = pGrid->latMin + pGrid->latStep * (pGrid->rows - 1) * 0.5;
+    sinLat = sin(latCenter);
+    transverse = radiusOfEWCurvFromSinLat(sinLat);
+    meridian = transverse * (1.0 - datum_eSquared) / (1.0 - datum_eSquared * sinLat * sinLat);
+    Job.cellNorth = fabs(pGrid->latStep) * meridian;
+    Job.cellEast = fabs(pGrid->lonStep) * transverse * cos(latCenter);
+    Job.curvature = (1.0 - pSensor->refraction) / (2.0 * sqrt(meridian * transverse));
+
+    // Half the field of view on either side of the elevation limits, as slopes, with straight up or down meaning no limit
+    low = pSensor->minElevation - pSensor->fov * 0.5;
+    high = pSensor->maxElevation + pSensor->fov * 0.5;
+    Job.minSlope = (low <= -PId / 2) ? -HUGE_VAL : tan(low);
+    Job.maxSlope = (high >= PId / 2) ? HUGE_VAL : tan(high);
+    Job.minRange2 = (double)pSensor->minRange * pSensor->minRange;
+    Job.maxRange2 = (pSensor->maxRange > 0) ? (double)pSensor->maxRange * pSensor->maxRange : HUGE_VAL;
+
+    // Pad the map out to take in every track position, so the terrain between the track and the map gets looked at
+    rowMax = pGrid->rows - 1;
+    colMax = pGrid->cols - 1;
+    for (i = 0; i < numTrack; i++)
+    {
+        double row = floor((trackLLA[i][LAT] - pGrid->latMin) / pGrid->latStep + 0.5);
+        double col = floor((trackLLA[i][LON] - pGrid->lonMin) / pGrid->lonStep + 0.5);
+
+        // Positions that are out of range of the whole map don't need any terrain
+        if (Job.maxRange2 < HUGE_VAL)
+        {
+            double north = (row - MIN(MAX(row, 0), rowMax)) * Job.cellNorth;
+            double east = (col - MIN(MAX(col, 0), colMax)) * Job.cellEast;
+
+            if (north * north + east * east > Job.maxRange2)
+                continue;
+        }
+
+        Job.rowOffset = (int)MAX(Job.rowOffset, -row);
+        Job.colOffset = (int)MAX(Job.colOffset, -col);
+        rowMax = (int)MAX(rowMax, row);
+        colMax = (int)MAX(colMax, col);
+    }
+
+    Job.rows = rowMax + Job.rowOffset + 1;
+    Job.cols = colMax + Job.colOffset + 1;
+
+    // Rays never need to be longer than the padded map, or than the range limit
+    Job.reach = MAX(Job.rows, Job.cols);
+    if (pSensor->maxRange > 0)
+        Job.reach = (int)MIN(Job.reach, ceil(pSensor->maxRange / MIN(Job.cellNorth, Job.cellEast)) + 1);
+
+    // One set of counts per thread, so the threads never write to the same memory
+    Job.pCounts[0] = pCount;
+    memset(pCount, 0, cells * sizeof(uint16_t));
+    for (i = 1; i < numThreads; i++)
+        Job.pCounts[i] = (uint16_t *)calloc(cells, sizeof(uint16_t));
+
+    Job.pHeight = (float *)malloc((size_t)Job.rows * Job.cols * sizeof(float));
+
+    for (i = 1; i < numThreads; i++)
+    {
+        if (Job.pCounts[i] == NULL)
+            break;
+    }
+
+    if ((i == numThreads) && (Job.pHeight != NULL))
+    {
+        // Sample the terrain a block at a time, then sweep each octant around each track position, then add up the counts
+        runPhase(&Job, PHASE_TERRAIN, ((Job.rows + VIEWSHED_BLOCK - 1) / VIEWSHED_BLOCK) * ((Job.cols + VIEWSHED_BLOCK - 1) / VIEWSHED_BLOCK), numThreads);
+        runPhase(&Job, PHASE_SWEEP, numTrack * 8, numThreads);
+        runPhase(&Job, PHASE_MERGE, (pGrid->rows + MERGE_ROWS - 1) / MERGE_ROWS, numThreads);
+
+        for (covered = 0, i = 0; i < numThreads; i++)
+            covered += Job.covered[i];
+    }
+
+    for (i = 1; i < numThreads; i++)
+        free(Job.pCounts[i]);
+
+    free(Job.pHeight);
+
+    return covered;
+
+}// viewshedCompute
+
+
+#ifdef _WIN32
+static DWORD WINAPI workerThread(LPVOID pArg)
+{
+    runWorker((ViewshedWorker_t *)pArg);
+    return 0;
+}
+#else
+static void *workerThread(void *pArg)
+{
+    runWorker((ViewshedWorker_t *)pArg);
+    return NULL;
+}
+#endif // _WIN32
+
+
+/*!
+ * Run one pass over the map on a pool of threads, including the calling thread
+ * \param pJob is the job that the pass is part of
+ * \param phase is the pass to run
+ * \param units is the number of units of work in the pass
+ * \param numThreads is the number of threads to run it on
+ */
+static void runPhase(ViewshedJob_t *pJob, int phase, int units, int numThreads)
+{
+    ViewshedWorker_t Workers[VIEWSHED_MAX_THREADS];
+#ifdef _WIN32
+    HANDLE Threads[VIEWSHED_MAX_THREADS];
+#else
+    pthread_t Threads[VIEWSHED_MAX_THREADS];
+#endif // _WIN32
+    BOOL Started[VIEWSHED_MAX_THREADS];
+    int i;
+
+    pJob->phase = phase;
+    pJob->units = units;
+    pJob->next = 0;
+
+    // Threads take units of work from a shared counter until they run out, so a thread that fails to start just leaves more for the others
+    for (i = 0; i < numThreads; i++)
+    {
+        Workers[i].pJob = pJob;
+        Workers[i].index = i;
+        Started[i] = FALSE;
+
+        if (i == 0)
+            continue;
+
+#ifdef _WIN32
+        Started[i] = ((Threads[i] = CreateThread(NULL, 0, workerThread, &Workers[i], 0, NULL)) != NULL);
+#else
+        Started[i] = (pthread_create(&Threads[i], NULL, workerThread, &Workers[i]) == 0);
+#endif // _WIN32
+    }
+
+    runWorker(&Workers[0]);
+
+    for (i = 1; i < numThreads; i++)
+    {
+        if (!Started[i])
+            continue;
+
+#ifdef _WIN32
+        WaitForSingleObject(Threads[i], INFINITE);
+        CloseHandle(Threads[i]);
+#else
+        pthread_join(Threads[i], NULL);
+#endif // _WIN32
+    }
+
+}// runPhase
+
+
+/*!
+ * Do units of work from the current pass until there are none left
+ * \param pWorker is the thread doing the work
+ */
+static void runWorker(ViewshedWorker_t *pWorker)
+{
+    ViewshedJob_t *pJob = pWorker->pJob;
+    int unit;
+
+    while ((unit = viewshedNextUnit(&pJob->next)) < pJob->units)
+    {
+        switch (pJob->phase)
+        {
+        case PHASE_TERRAIN:
+            sampleBlock(pJob, unit, pJob->ppTerrain[pWorker->index]);
+            break;
+
+        case PHASE_SWEEP:
+            sweepOctant(pJob, unit / 8, unit % 8, pJob->pCounts[pWorker->index]);
+            break;
+
+        default:
+            pJob->covered[pWorker->index] += mergeRows(pJob, unit);
+            break;
+        }
+    }
+
+}// runWorker
+
+
+/*!
+ * Sample the terrain height of every cell in one block of the padded map. Each
+ * row of the block is looked up all at once if the provider can do that.
+ * \param pJob is the job to sample the terrain for
+ * \param unit is the block to sample, going east and then north
+ * \param pTerrain is this thread's terrain provider
+ */
+static void sampleBlock(ViewshedJob_t *pJob, int unit, const TerrainProvider_t *pTerrain)
+{
+    double lat[VIEWSHED_BLOCK], lon[VIEWSHED_BLOCK];
+    int blockCols = (pJob->cols + VIEWSHED_BLOCK - 1) / VIEWSHED_BLOCK;
+    int row0 = (unit / blockCols) * VIEWSHED_BLOCK, col0 = (unit % blockCols) * VIEWSHED_BLOCK;
+    int row, col, n = MIN(VIEWSHED_BLOCK, pJob->cols - col0);
+
+    for (col = 0; col < n; col++)
+        lon[col] = pJob->pGrid->lonMin + (col0 + col - pJob->colOffset) * pJob->pGrid->lonStep;
+
+    for (row = row0; row < MIN(row0 + VIEWSHED_BLOCK, pJob->rows); row++)
+    {
+        float *pHeight = &pJob->pHeight[(size_t)row * pJob->cols + col0];
+
+        for (col = 0; col < n; col++)
+            lat[col] = pJob->pGrid->latMin + (row - pJob->rowOffset) * pJob->pGrid->latStep;
+
+        if (pTerrain->getElevationsHAE != NULL)
+            pTerrain->getElevationsHAE(pTerrain, lat, lon, pHeight, n);
+        else
+        {
+            for (col = 0; col < n; col++)
+                pHeight[col] = pTerrain->getElevationHAE(pTerrain, lat[col], lon[col]);
+        }
+    }
+
+}// sampleBlock
+
+
+/*!
+ * Find the cells of the map in one octant around a track position that can be
+ * seen from it. Rays go out from the track position to every cell along the
+ * edge of the octant, and a cell is seen if its slope from the track position
+ * is at least as steep as that of all the terrain before it on the ray. Rays
+ * next to each other cross the same cells near the track position, so each
+ * cell only gets counted by the first ray to reach it, and octants meet along
+ * the axes and diagonals without overlapping.
+ * \param pJob is the job to sweep for
+ * \param track is the index of the track position
+ * \param octant is which octant to sweep: bit 2 set to step north or south
+ *        rather than east or west, bit 0 to step the negative way along that
+ *        axis and bit 1 the negative way across it
+ * \param pCount is this thread's counts
+ */
+static void sweepOctant(ViewshedJob_t *pJob, int track, int octant, uint16_t *pCount)
+{
+    const ViewshedGrid_t *pGrid = pJob->pGrid;
+    const double *lla = pJob->trackLLA[track];
+    double row = (lla[LAT] - pGrid->latMin) / pGrid->latStep + pJob->rowOffset;
+    double col = (lla[LON] - pGrid->lonMin) / pGrid->lonStep + pJob->colOffset;
+    int originRow = (int)floor(row + 0.5), originCol = (int)floor(col + 0.5);
+    int along = (octant & 1) ? -1 : 1, across = (octant & 2) ? -1 : 1, northward = (octant & 4) != 0;
+    int reach = pJob->reach, first = (octant & 2) ? 1 : 0, k, m;
+    double targetHeight = pJob->pSensor->targetHeight;
+
+    // Positions off the padded map were left out because they're out of range
+    if ((originRow < 0) || (originRow >= pJob->rows) || (originCol < 0) || (originCol >= pJob->cols))
+        return;
+
+    // The cell right under the track position only needs a line of sight that can point straight down
+    if (octant == 0)
+    {
+        int mapRow = originRow - pJob->rowOffset, mapCol = originCol - pJob->colOffset;
+        float height = pJob->pHeight[(size_t)originRow * pJob->cols + originCol];
+        double drop = lla[ALT] - (height + targetHeight);
+
+        if ((mapRow < pGrid->rows) && (mapCol < pGrid->cols) && (mapRow >= 0) && (mapCol >= 0) && (height != TERRAIN_NO_DATA) &&
+            (pJob->minSlope == -HUGE_VAL) && (drop >= 0) && (drop * drop >= pJob->minRange2) && (drop * drop <= pJob->maxRange2))
+            pCount[(size_t)mapRow * pGrid->cols + mapCol]++;
+    }
+
+    // One ray to each cell along the edge of the octant, reach cells out
+    for (k = 0; k <= reach; k++)
+    {
+        double steepest = -HUGE_VAL;
+
+        for (m = 1; m <= reach; m++)
+        {
+            // Cells across from the axis that this ray and the one before it are in at this step, rounded to the nearest
+            int d = (int)(((int64_t)2 * m * k + reach) / (2 * reach));
+            int dBefore = (int)(((int64_t)2 * m * (k - 1) + reach) / (2 * reach));
+            int cellRow, cellCol, mapRow, mapCol, last = northward ? m - 1 : m;
+            double north, east, distance2, distance, rise, slope;
+            float height;
+
+            if (northward)
+            {
+                cellRow = originRow + along * m;
+                cellCol = originCol + across * d;
+            }
+            else
+            {
+                cellRow = originRow + across * d;
+                cellCol = originCol + along * m;
+            }
+
+            // Rays only ever move away from the track position, so once one leaves the padded map it's done
+            if ((cellRow < 0) || (cellRow >= pJob->rows) || (cellCol < 0) || (cellCol >= pJob->cols))
+                break;
+
+            north = (cellRow - row) * pJob->cellNorth;
+            east = (cellCol - col) * pJob->cellEast;
+            distance2 = north * north + east * east;
+
+            // Likewise for the range limit
+            if (distance2 > pJob->maxRange2)
+                break;
+
+            // Cells with no terrain data neither block nor get seen
+            height = pJob->pHeight[(size_t)cellRow * pJob->cols + cellCol];
+            if (height == TERRAIN_NO_DATA)
+                continue;
+
+            // Height of the cell relative to the track position, with the earth curving away underneath
+            distance = sqrt(distance2);
+            rise = height - lla[ALT] - distance2 * pJob->curvature;
+
+            // Only count the cell if it's in this octant, on the map, and this is the first ray to get to it
+            mapRow = cellRow - pJob->rowOffset;
+            mapCol = cellCol - pJob->colOffset;
+            if ((d >= first) && (d <= last) && ((k == 0) || (d != dBefore)) &&
+                (mapRow >= 0) && (mapRow < pGrid->rows) && (mapCol >= 0) && (mapCol < pGrid->cols))
+            {
+                double target = rise + targetHeight, range2 = distance2 + target * target;
+
+                slope = target / distance;
+                if ((slope >= steepest) && (slope >= pJob->minSlope) && (slope <= pJob->maxSlope) &&
+                    (range2 >= pJob->minRange2) && (range2 <= pJob->maxRange2))
+                    pCount[(size_t)mapRow * pGrid->cols + mapCol]++;
+            }
+
+            // Once the terrain is steeper than the sensor can look up, nothing further out can be seen
+            slope = rise / distance;
+            if (slope > steepest)
+            {
+                steepest = slope;
+                if (steepest > pJob->maxSlope)
+                    break;
+            }
+        }
+    }
+
+}// sweepOctant
+
+
+/*!
+ * Add up the threads' counts for some rows of the map
+ * \param pJob is the job to merge counts for
+ * \param unit is which MERGE_ROWS rows of the map to merge
+ * \return the number of cells in these rows that can be seen from at least one track position
+ */
+static int mergeRows(ViewshedJob_t *pJob, int unit)
+{
+    size_t cols = (size_t)pJob->pGrid->cols, start = (size_t)unit * MERGE_ROWS * cols;
+    size_t end = MIN(start + MERGE_ROWS * cols, (size_t)pJob->pGrid->rows * cols), i;
+    uint16_t *pCount = pJob->pCounts[0];
+    int t, covered = 0;
+
+    for (t = 1; t < pJob->numThreads; t++)
+    {
+        const uint16_t *pOther = pJob->pCounts[t];
+
+        for (i = start; i < end; i++)
+            pCount[i] += pOther[i];
+    }
+
+    for (i = start; i < end; i++)
+        covered += (pCount[i] != 0);
+
+    return covered;
+
+}// mergeRows
@@ -0,0 +1,95 @@
+#ifndef VIEWSHED_H
+#define VIEWSHED_H
+
+/*!
+ * \file Viewshed.h
+ * \brief Coverage maps of the terrain a gimbal can see from a planned track.
+ *
+ * The map is a lat/lon raster, and each cell gets the number of track
+ * positions it can be seen from. A cell counts as seen when the line of sight
+ * from the track position to a point targetHeight above the ground in the
+ * cell clears the terrain and falls inside the sensor's elevation and range
+ * limits.
+ *
+ * Terrain heights are sampled once for every cell of the raster, padded out
+ * to take in the track, in square blocks so that each one is looked up from
+ * the same terrain tiles. Visibility is then worked out by casting a ray from
+ * each track position to every cell on a square around it and carrying the
+ * steepest terrain slope seen so far along each ray (the R2 viewshed
+ * algorithm), with every cell decided by exactly one ray. Terrain outside of
+ * the padded raster isn't looked at, so ridges beyond the edge of the map
+ * never block anything.
+ *
+ * The work is shared out over a pool of threads: blocks of the raster while
+ * sampling the terrain, then each of the eight octants around each track
+ * position as a separate piece of work. Terrain providers usually keep a
+ * cache in their structure, so every thread needs a provider of its own;
+ * giving each thread its own TerrainRaster_t over the same directory is
+ * cheap, since the tiles are memory-mapped and share the page cache.
+ */
+
+#include "Types.h"
+#include "earthposition.h"
+#include "TerrainProvider.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+//! Most threads that viewshedCompute() will use
+#define VIEWSHED_MAX_THREADS 32
+
+//! Cells along each side of the blocks that terrain heights are sampled in
+#define VIEWSHED_BLOCK 64
+
+//! Most track positions, so that a cell's count can't overflow
+#define VIEWSHED_MAX_TRACK 65535
+
+//! Layout of a coverage map
+typedef struct
+{
+    //! Center of the southwest cell in radians
+    double latMin;
+    double lonMin;
+
+    //! Spacing between cells going north and going east in radians
+    double latStep;
+    double lonStep;
+
+    //! Rows of cells going north and columns going east
+    int rows;
+    int cols;
+
+} ViewshedGrid_t;
+
+//! What the sensor can see from each track position
+typedef struct
+{
+    //! Lowest and highest elevation of the line of sight in radians, negative below the horizon, e.g. from the tilt limits
+    float minElevation;
+    float maxElevation;
+
+    //! Vertical field of view in radians, half of which is added on to either end of the elevation limits
+    float fov;
+
+    //! Shortest and longest slant range in meters, with 0 for maxRange to take in the whole map
+    float minRange;
+    float maxRange;
+
+    //! Height above the terrain of what needs to be seen in meters, e.g. 2 for a vehicle
+    float targetHeight;
+
+    //! Atmospheric refraction coefficient, 0 for straight lines of sight or about 0.13 for visible light
+    float refraction;
+
+} ViewshedSensor_t;
+
+//! Count the track positions that each cell of a coverage map can be seen from, using several threads
+int viewshedCompute(const ViewshedGrid_t *pGrid, const ViewshedSensor_t *pSensor, const double (*trackLLA)[NLLA], int numTrack,
+                    const TerrainProvider_t *const *ppTerrain, int numThreads, uint16_t *pCount);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // VIEWSHED_H
@@ -162,6 +162,7 @@ void dcmSet(DCM_t* M, uint32_t row, uint32_t col, float value)
  * \return a pointer to the newly allocated DCM, or
  *         NULL if the allocation failed.
  */
+#ifndef ORION_PROFILE_FLOAT
 DCM_t* dcmAllocate(void)
 {
     DCM_t* dcm = matrixAllocatef(3, 3);
@@ -176,6 +177,7 @@ DCM_t* dcmAllocate(void)
     return dcm;
 
 }// dcmAllocate
+#endif // ORION_PROFILE_FLOAT
 
 
 /*!
@@ -687,6 +689,9 @@ void attitudeIncrementBigYaw(DCM_t* dcm, float x, float y, float z)
 }// attitudeIncrementBigYaw
 
 
+// The float profile leaves out the linear algebra test, which needs linearalgebra.c, and everything in double precision
+#ifndef ORION_PROFILE_FLOAT
+
 /*!
  * Verify correct operation of key matrix and DCM operations.
  * \return TRUE if the test passed.
@@ -784,6 +789,10 @@ BOOL testLinearAlgebra(void)
     error += fabsf(0 - vector[1]);
     error += fabsf(0.70710678118654752440084436210485f - vector[2]);
 
+    // The factorizations, solves and inverses in double precision
+    if(testMatrixSolvers() != 0)
+        return FALSE;
+
     if(error < 0.0001f)
         return TRUE;
 
@@ -1453,3 +1462,5 @@ void attitudeIncrementBigYawd(DCMd_t* dcm, double x, double y, double z)
     set(dcm, 2, 0, -y);   set(dcm, 2, 1,  x);    set(dcm, 2, 2, 1.0);
 
 }
+
+#endif // ORION_PROFILE_FLOAT
@@ -62,8 +62,10 @@ enum
  */
 #define structInitDCM(M) M.data = M##data; M.numRows = M.numCols = 3
 
+#ifndef ORION_PROFILE_FLOAT
 //! Allocate a DCM, initializing its memory.
 DCM_t* dcmAllocate(void);
+#endif // ORION_PROFILE_FLOAT
 
 //! Get a specific element of a dcm
 float dcmGet(const DCM_t* M, uint32_t row, uint32_t col);
@@ -170,6 +172,9 @@ void attitudeIncrement(DCM_t* dcm, float x, float y, float z);
 //! Convert a 3 elements to a skew symmetric DCM with 1s on the diagonal, allowing the yaw term to be large
 void attitudeIncrementBigYaw(DCM_t* dcm, float x, float y, float z);
 
+// The float profile leaves out the linear algebra test, which needs linearalgebra.c, and everything in double precision
+#ifndef ORION_PROFILE_FLOAT
+
 //! Test the linear algebra code
 BOOL testLinearAlgebra(void);
 
@@ -308,6 +313,8 @@ void attitudeIncrementd(DCMd_t* dcm, double x, double y, double z);
 //! Convert a 3 elements to a skew symmetric DCM with 1s on the diagonal, allowing the yaw term to be large
 void attitudeIncrementBigYawd(DCMd_t* dcm, double x, double y, double z);
 
+#endif // ORION_PROFILE_FLOAT
+
 // C++ compilers: don't mangle us
 #ifdef __cplusplus
 }
@@ -0,0 +1,332 @@
+#ifndef DCM3_H
+#define DCM3_H
+
+/*!
+ * \file
+ * Fixed size 3x3 direction cosine matrix. Unlike DCM_t, which is a generic
+ * Matrixf_t with a data pointer and run time dimensions, DCM3_t holds its nine
+ * elements by value. It can be embedded in structures and copied with simple
+ * assignment, and the functions here are inlined so the hot paths don't pay
+ * for size checks or indirect access. The element layout is the same row major
+ * layout as DCM_t, so dcm3View() can hand a DCM3_t to the generic functions.
+ */
+
+#include "dcm.h"
+#include "quaternion.h"
+#include "Constants.h"
+#include <math.h>
+
+// C++ compilers: don't mangle us
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! A 3x3 matrix of floats held by value
+typedef struct
+{
+    float data[TNUM];
+
+}DCM3_t;
+
+/*!
+ * Macro to declare a DCM_t on the stack that refers to the elements of a DCM3_t.
+ * \param M is the name used to refer to the DCM_t.
+ * \param pDcm3 points to the DCM3_t, which must outlive M.
+ */
+#define dcm3View(M, pDcm3) Matrixf_t M = {3, 3, (pDcm3)->data}
+
+/*!
+ * Get a specific element of a DCM3_t
+ * \param dcm is the matrix to read.
+ * \param row is the zero based row index.
+ * \param col is the zero based column index.
+ * \return the element at row, col.
+ */
+static __inline float dcm3Get(const DCM3_t* dcm, int row, int col)
+{
+    return dcm->data[row*3 + col];
+}
+
+/*!
+ * Set a DCM3_t to identity
+ * \param dcm receives the identity matrix.
+ */
+static __inline void dcm3SetIdentity(DCM3_t* dcm)
+{
+    static const DCM3_t identity = {{1, 0, 0, 0, 1, 0, 0, 0, 1}};
+    *dcm = identity;
+}
+
+/*!
+ * Multiply two DCMs together, C = A*B. C can be the same as A or B.
+ * \param A is the left matrix.
+ * \param B is the right matrix.
+ * \param C receives the product.
+ */
+static __inline void dcm3Multiply(const DCM3_t* A, const DCM3_t* B, DCM3_t* C)
+{
+    const float* a = A->data;
+    const float* b = B->data;
+    DCM3_t c;
+    int i;
+
+    for(i = 0; i < 9; i += 3)
+    {
+        c.data[i + 0] = a[i]*b[0] + a[i + 1]*b[3] + a[i + 2]*b[6];
+        c.data[i + 1] = a[i]*b[1] + a[i + 1]*b[4] + a[i + 2]*b[7];
+        c.data[i + 2] = a[i]*b[2] + a[i + 1]*b[5] + a[i + 2]*b[8];
+    }
+
+    *C = c;
+}
+
+/*!
+ * Multiply the transpose of a DCM against another DCM, C = A'*B. C can be the same as A or B.
+ * \param A is the left matrix, which is transposed.
+ * \param B is the right matrix.
+ * \param C receives the product.
+ */
+static __inline void dcm3MultiplyTransA(const DCM3_t* A, const DCM3_t* B, DCM3_t* C)
+{
+    const float* a = A->data;
+    const float* b = B->data;
+    DCM3_t c;
+    int i;
+
+    for(i = 0; i < 3; i++)
+    {
+        c.data[3*i + 0] = a[i]*b[0] + a[i + 3]*b[3] + a[i + 6]*b[6];
+        c.data[3*i + 1] = a[i]*b[1] + a[i + 3]*b[4] + a[i + 6]*b[7];
+        c.data[3*i + 2] = a[i]*b[2] + a[i + 3]*b[5] + a[i + 6]*b[8];
+    }
+
+    *C = c;
+}
+
+/*!
+ * Multiply a DCM against the transpose of another DCM, C = A*B'. C can be the same as A or B.
+ * \param A is the left matrix.
+ * \param B is the right matrix, which is transposed.
+ * \param C receives the product.
+ */
+static __inline void dcm3MultiplyTransB(const DCM3_t* A, const DCM3_t* B, DCM3_t* C)
+{
+    const float* a = A->data;
+    const float* b = B->data;
+    DCM3_t c;
+    int i;
+
+    for(i = 0; i < 9; i += 3)
+    {
+        c.data[i + 0] = a[i]*b[0] + a[i + 1]*b[1] + a[i + 2]*b[2];
+        c.data[i + 1] = a[i]*b[3] + a[i + 1]*b[4] + a[i + 2]*b[5];
+        c.data[i + 2] = a[i]*b[6] + a[i + 1]*b[7] + a[i + 2]*b[8];
+    }
+
+    *C = c;
+}
+
+/*!
+ * Transpose a DCM
+ * \param A is the matrix to transpose.
+ * \param B receives the transpose, which can be the same as A.
+ */
+static __inline void dcm3Transpose(const DCM3_t* A, DCM3_t* B)
+{
+    const float* a = A->data;
+    DCM3_t b = {{a[0], a[3], a[6], a[1], a[4], a[7], a[2], a[5], a[8]}};
+
+    *B = b;
+}
+
+/*!
+ * Use a DCM to rotate a vector.
+ * \param dcm is the body to reference rotation.
+ * \param input is the vector in the body frame.
+ * \param output receives the vector in the reference frame, which can be the same as input.
+ */
+static __inline void dcm3ApplyRotation(const DCM3_t* dcm, const float input[NVECTOR3], float output[NVECTOR3])
+{
+    const float* d = dcm->data;
+    float x = input[0], y = input[1], z = input[2];
+
+    output[0] = d[0]*x + d[1]*y + d[2]*z;
+    output[1] = d[3]*x + d[4]*y + d[5]*z;
+    output[2] = d[6]*x + d[7]*y + d[8]*z;
+}
+
+/*!
+ * Use a DCM to rotate a vector, in the reverse direction.
+ * \param dcm is the body to reference rotation.
+ * \param input is the vector in the reference frame.
+ * \param output receives the vector in the body frame, which can be the same as input.
+ */
+static __inline void dcm3ApplyReverseRotation(const DCM3_t* dcm, const float input[NVECTOR3], float output[NVECTOR3])
+{
+    const float* d = dcm->data;
+    float x = input[0], y = input[1], z = input[2];
+
+    output[0] = d[0]*x + d[3]*y + d[6]*z;
+    output[1] = d[1]*x + d[4]*y + d[7]*z;
+    output[2] = d[2]*x + d[5]*y + d[8]*z;
+}
+
+/*!
+ * Fill out the direction cosine matrix from Euler angles, as setDCMBasedOnEuler()
+ * \param dcm receives the rotation.
+ * \param yaw is the Euler yaw angle in radians.
+ * \param pitch is the Euler pitch angle in radians.
+ * \param roll is the Euler roll angle in radians.
+ */
+static __inline void dcm3FromEuler(DCM3_t* dcm, float yaw, float pitch, float roll)
+{
+    float cosRoll = cosf(roll), sinRoll = sinf(roll);
+    float cosPitch = cosf(pitch), sinPitch = sinf(pitch);
+    float cosYaw = cosf(yaw), sinYaw = sinf(yaw);
+    float* d = dcm->data;
+
+    d[T11] = cosPitch*cosYaw;
+    d[T12] = sinRoll*sinPitch*cosYaw - cosRoll*sinYaw;
+    d[T13] = cosRoll*sinPitch*cosYaw + sinRoll*sinYaw;
+    d[T21] = cosPitch*sinYaw;
+    d[T22] = sinRoll*sinPitch*sinYaw + cosRoll*cosYaw;
+    d[T23] = cosRoll*sinPitch*sinYaw - sinRoll*cosYaw;
+    d[T31] = -sinPitch;
+    d[T32] = sinRoll*cosPitch;
+    d[T33] = cosRoll*cosPitch;
+}
+
+/*!
+ * Fill out the direction cosine matrix from a pan then a tilt rotation, as setDCMBasedOnPanTilt()
+ * \param dcm receives the rotation.
+ * \param pan is the pan (yaw) angle in radians.
+ * \param tilt is the tilt (pitch) angle in radians.
+ */
+static __inline void dcm3FromPanTilt(DCM3_t* dcm, float pan, float tilt)
+{
+    float cosPitch = cosf(tilt), sinPitch = sinf(tilt);
+    float cosYaw = cosf(pan), sinYaw = sinf(pan);
+    float* d = dcm->data;
+
+    d[T11] = cosPitch*cosYaw;
+    d[T12] = -sinYaw;
+    d[T13] = sinPitch*cosYaw;
+    d[T21] = cosPitch*sinYaw;
+    d[T22] = cosYaw;
+    d[T23] = sinPitch*sinYaw;
+    d[T31] = -sinPitch;
+    d[T32] = 0;
+    d[T33] = cosPitch;
+}
+
+//! Compute the Euler yaw angle of a DCM3_t in radians, from -PI to PI
+static __inline float dcm3Yaw(const DCM3_t* dcm)
+{
+    return atan2f(dcm->data[T21], dcm->data[T11]);
+}
+
+//! Compute the Euler pitch angle of a DCM3_t in radians, from -PI/2 to PI/2
+static __inline float dcm3Pitch(const DCM3_t* dcm)
+{
+    return asinf(SATURATE(-dcm->data[T31], 1.0f));
+}
+
+//! Compute the Euler roll angle of a DCM3_t in radians, from -PI to PI
+static __inline float dcm3Roll(const DCM3_t* dcm)
+{
+    return atan2f(dcm->data[T32], dcm->data[T33]);
+}
+
+/*!
+ * Convert a quaternion to a DCM3_t, as quaternionToDCM()
+ * \param quat is the quaternion to convert.
+ * \param dcm receives the rotation.
+ */
+static __inline void quaternionToDCM3(const float quat[NQUATERNION], DCM3_t* dcm)
+{
+    float q0 = quat[Q0], q1 = quat[Q1], q2 = quat[Q2], q3 = quat[Q3];
+    float q0sq = q0*q0, q1sq = q1*q1, q2sq = q2*q2, q3sq = q3*q3;
+    float* d = dcm->data;
+
+    // This form taken from Groves
+    d[T11] = q0sq + q1sq - q2sq - q3sq;
+    d[T12] = 2*(q1*q2 - q3*q0);
+    d[T13] = 2*(q1*q3 + q2*q0);
+    d[T21] = 2*(q1*q2 + q3*q0);
+    d[T22] = q0sq - q1sq + q2sq - q3sq;
+    d[T23] = 2*(q2*q3 - q1*q0);
+    d[T31] = 2*(q1*q3 - q2*q0);
+    d[T32] = 2*(q2*q3 + q1*q0);
+    d[T33] = q0sq - q1sq - q2sq + q3sq;
+}
+
+/*!
+ * Convert a DCM3_t to a quaternion with a positive leading element, as dcmToQuaternion()
+ * \param dcm is the rotation to convert.
+ * \param quat receives the quaternion.
+ */
+static __inline void dcm3ToQuaternion(const DCM3_t* dcm, float quat[NQUATERNION])
+{
+    const float* d = dcm->data;
+    float mult;
+    int imax = 0, i;
+
+    // The diagonal terms, quat is a temporary here. The fabs protects against
+    // sqrt of negative, and flipping the sign of all terms is the same rotation.
+    quat[Q0] = fabsf(1 + d[T11] + d[T22] + d[T33]);
+    quat[Q1] = fabsf(1 + d[T11] - d[T22] - d[T33]);
+    quat[Q2] = fabsf(1 - d[T11] + d[T22] - d[T33]);
+    quat[Q3] = fabsf(1 - d[T11] - d[T22] + d[T33]);
+
+    // Compute the largest term from the diagonal, to stay away from singularities
+    for(i = 1; i < 4; i++)
+    {
+        if(quat[i] > quat[imax])
+            imax = i;
+    }
+
+    quat[imax] = 0.5f*sqrtf(quat[imax]);
+    mult = 0.25f/quat[imax];
+
+    // The remaining terms come from the off-diagonal elements
+    switch(imax)
+    {
+    default:
+    case Q0:
+        quat[Q1] = mult*(d[T32] - d[T23]);
+        quat[Q2] = mult*(d[T13] - d[T31]);
+        quat[Q3] = mult*(d[T21] - d[T12]);
+        break;
+    case Q1:
+        quat[Q0] = mult*(d[T32] - d[T23]);
+        quat[Q2] = mult*(d[T21] + d[T12]);
+        quat[Q3] = mult*(d[T13] + d[T31]);
+        break;
+    case Q2:
+        quat[Q0] = mult*(d[T13] - d[T31]);
+        quat[Q1] = mult*(d[T21] + d[T12]);
+        quat[Q3] = mult*(d[T32] + d[T23]);
+        break;
+    case Q3:
+        quat[Q0] = mult*(d[T21] - d[T12]);
+        quat[Q1] = mult*(d[T13] + d[T31]);
+        quat[Q2] = mult*(d[T32] + d[T23]);
+        break;
+    }
+
+    // Finally, we would like the leading element to be positive
+    if(quat[Q0] < 0.0f)
+    {
+        quat[Q0] = -quat[Q0];
+        quat[Q1] = -quat[Q1];
+        quat[Q2] = -quat[Q2];
+        quat[Q3] = -quat[Q3];
+    }
+}
+
+// C++ compilers: don't mangle us
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DCM3_H
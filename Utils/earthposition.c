@@ -174,6 +174,97 @@ void ecefToLLAandTrig(const double ecef[NECEF], double lla[NLLA], llaTrig_t* tri
 }// ecefToLLA_withTrig
 
 
+/*!
+ * Convert an array of LLA positions to Earth centered Earth fixed. The
+ * positions are given as separate arrays for each component, which keeps the
+ * arithmetic in straight loops over contiguous data that the compiler can
+ * vectorize. The results are the same as calling llaToECEF() for each point.
+ * \param lat is the array of latitudes in radians.
+ * \param lon is the array of longitudes in radians.
+ * \param alt is the array of altitudes in meters.
+ * \param n is the number of positions.
+ * \param x receives the ECEF X coordinates in meters.
+ * \param y receives the ECEF Y coordinates in meters.
+ * \param z receives the ECEF Z coordinates in meters.
+ */
+void llaToECEFArray(const double *lat, const double *lon, const double *alt, size_t n, double *x, double *y, double *z)
+{
+    size_t i;
+
+    for(i = 0; i < n; i++)
+    {
+        double sinLat = sin(lat[i]), cosLat = cos(lat[i]);
+        double sinLon = sin(lon[i]), cosLon = cos(lon[i]);
+
+        // Radius of East-West curvature in meters
+        double Rc = datum_semiMajorAxis / sqrt(1.0 - datum_eSquared * sinLat * sinLat);
+
+        x[i] = (Rc + alt[i])*cosLat*cosLon;
+        y[i] = (Rc + alt[i])*cosLat*sinLon;
+        z[i] = (Rc*(1.0 - datum_eSquared) + alt[i])*sinLat;
+    }
+
+}// llaToECEFArray
+
+
+/*!
+ * Convert an array of ECEF positions to LLA, using the same Browning method
+ * as ecefToLLAandTrig(). The positions are given as separate arrays for each
+ * component. The sine and cosine of the parametric latitude are worked out
+ * algebraically rather than with atan2(), sin() and cos(), which leaves only
+ * the two atan2() calls for latitude and longitude per point.
+ * \param x is the array of ECEF X coordinates in meters.
+ * \param y is the array of ECEF Y coordinates in meters.
+ * \param z is the array of ECEF Z coordinates in meters.
+ * \param n is the number of positions.
+ * \param lat receives the latitudes in radians.
+ * \param lon receives the longitudes in radians.
+ * \param alt receives the altitudes in meters.
+ */
+void ecefToLLAArray(const double *x, const double *y, const double *z, size_t n, double *lat, double *lon, double *alt)
+{
+    size_t i;
+
+    for(i = 0; i < n; i++)
+    {
+        // distance from axis of rotation
+        double p = sqrt(x[i]*x[i] + y[i]*y[i]);
+
+        // tan(zeta) = z*a/(p*b), so its sin and cos come straight from the hypotenuse
+        double za = z[i]*datum_semiMajorAxis, pb = p*datum_semiMinorAxis;
+        double r = sqrt(za*za + pb*pb);
+        double sinLat, cosLat, num, den, hyp;
+
+        // On the earth axis, at a pole or the center of the earth
+        if(p == 0.0)
+        {
+            lat[i] = (z[i] > 0.0) ? PId/2.0 : ((z[i] < 0.0) ? -PId/2.0 : 0.0);
+            lon[i] = 0.0;
+            alt[i] = fabs(z[i]) - datum_semiMinorAxis;
+            continue;
+        }
+
+        // Latitude
+        num = z[i] + datum_eSecondSquared*datum_semiMinorAxis*(za/r)*(za/r)*(za/r);
+        den = p    - datum_eSquared*datum_semiMajorAxis*(pb/r)*(pb/r)*(pb/r);
+        hyp = sqrt(num*num + den*den);
+        sinLat = num/hyp;
+        cosLat = den/hyp;
+        lat[i] = atan2(num, den);
+
+        // Longitude
+        lon[i] = atan2(y[i], x[i]);
+
+        // Altitude is calculated differently at the poles, in order to avoid the singularity
+        if(fabs(cosLat) > 0.001)
+            alt[i] = (p / cosLat) - datum_semiMajorAxis / sqrt(1.0 - datum_eSquared * sinLat * sinLat);
+        else
+            alt[i] = fabs(z[i]) - datum_semiMinorAxis;
+    }
+
+}// ecefToLLAArray
+
+
 /*!
  * Convert an array of geodetic coordinates (latitude, longitude, altitude)
  * to spherical geocentric coordinates (latitude', longitude, radius).
@@ -300,6 +391,32 @@ BOOL testEarthPosition(void)
     error += fabs(0.707106781186548 - trig.sinLat);
     error += fabs(-0.707106781186548 - trig.sinLon);
 
+    // The array conversions should agree with the single point ones
+    {
+        double x[3], y[3], z[3], lat[3] = {PId/4.0, -PId/3.0, 1.5}, lon[3] = {-3.0*PId/4.0, 0.1, 2.5}, alt[3] = {255.0, -40.0, 12000.0};
+        int i;
+
+        llaToECEFArray(lat, lon, alt, 3, x, y, z);
+        for(i = 0; i < 3; i++)
+        {
+            posLLA[LAT] = lat[i];
+            posLLA[LON] = lon[i];
+            posLLA[ALT] = alt[i];
+            llaToECEF(posLLA, posECEF);
+            error += fabs(posECEF[ECEFX] - x[i]) + fabs(posECEF[ECEFY] - y[i]) + fabs(posECEF[ECEFZ] - z[i]);
+        }
+
+        ecefToLLAArray(x, y, z, 3, lat, lon, alt);
+        for(i = 0; i < 3; i++)
+        {
+            posECEF[ECEFX] = x[i];
+            posECEF[ECEFY] = y[i];
+            posECEF[ECEFZ] = z[i];
+            ecefToLLA(posECEF, posLLA);
+            error += fabs(posLLA[LAT] - lat[i])*datum_meanRadius + fabs(posLLA[LON] - lon[i])*datum_meanRadius + fabs(posLLA[ALT] - alt[i]);
+        }
+    }
+
     if(error < 0.0001)
         return TRUE;
     else
@@ -2,6 +2,7 @@
 #define EARTHPOSITION_H
 
 #include "Types.h"
+#include <stddef.h>
 
 // C++ compilers: don't mangle us
 #ifdef __cplusplus
@@ -61,6 +62,12 @@ void ecefToLLA(const double ecef[NECEF], double lla[NLLA]);
 //! Convert the ECEF position to LLA, with LLA trig
 void ecefToLLAandTrig(const double ecef[NECEF], double lla[NLLA], llaTrig_t* trig);
 
+//! Convert arrays of LLA positions to ECEF, one array per component
+void llaToECEFArray(const double *lat, const double *lon, const double *alt, size_t n, double *x, double *y, double *z);
+
+//! Convert arrays of ECEF positions to LLA, one array per component
+void ecefToLLAArray(const double *x, const double *y, const double *z, size_t n, double *lat, double *lon, double *alt);
+
 //! Convert an array of geodetic coordinates to spherical geocentric coordinates.
 void geodeticToGeocentric(const double geodetic[NLLA], double spherical[NLLA]);
 
@@ -0,0 +1,364 @@
+#include "earthpositionf.h"
+#include <math.h>
+
+//! Pi / 2 as a split float
+static const splitf_t piOver2 = {1.57079637f, -4.37113883e-08f};
+
+//! WGS-84 semi-major axis in meters, which is exact in a float
+#define datumf_semiMajorAxis 6378137.0f
+
+//! WGS-84 semi-minor axis in meters as a split float
+static const splitf_t semiMinorAxis = {6356752.5f, -0.185754821f};
+
+//! WGS-84 first eccentricity squared, and one minus that, as split floats
+static const splitf_t eSquared = {0.00669438019f, -2.03807429e-10f};
+static const splitf_t oneMinusESquared = {0.993305624f, -3.52148288e-09f};
+
+//! Radians in 1e-7 degrees and 1e-7 degrees in a radian, as split floats
+static const splitf_t degE7ToRad = {1.74532921e-09f, 3.75078828e-17f};
+static const splitf_t radToDegE7 = {572957824.0f, -28.8691769f};
+
+//! Steps of the sine and cosine table, which covers 0 to pi/4
+#define SINCOS_STEPS 64.0f
+
+//! Sine and cosine of j/64 for j from 0 to 50, as split floats {sin.hi, sin.lo, cos.hi, cos.lo}
+static const float sinCosTable[51][4] =
+{
+    {0.0f, 0.0f, 1.0f, 0.0f},
+    {0.0156243639f, 3.18201826e-10f, 0.99987793f, 2.48350673e-09f},
+    {0.0312449131f, 8.69228634e-10f, 0.999511778f, -1.98695087e-08f},
+    {0.0468578376f, -1.83946069e-09f, 0.998901546f, 2.23370087e-08f},
+    {0.0624593161f, 1.73772974e-09f, 0.998047531f, -1.99509937e-08f},
+    {0.0780455545f, -3.06912762e-09f, 0.996949792f, 2.16776441e-09f},
+    {0.0936127305f, 7.32430616e-10f, 0.995608687f, -9.42816158e-10f},
+    {0.109157056f, 1.25894362e-09f, 0.994024515f, 1.06231593e-10f},
+    {0.12467473f, 3.38234751e-09f, 0.992197692f, -2.51649279e-08f},
+    {0.140161976f, -3.87115984e-09f, 0.990128577f, 1.16145831e-08f},
+    {0.155614987f, 5.75783199e-09f, 0.987817764f, 1.95342462e-08f},
+    {0.171030015f, 7.27805327e-09f, 0.985265791f, 2.6302045e-08f},
+    {0.186403289f, 7.32497574e-09f, 0.982473314f, -7.07185921e-10f},
+    {0.201731071f, -7.07448278e-09f, 0.979440928f, 2.42100544e-08f},
+    {0.217009574f, 6.92012936e-09f, 0.976169467f, 6.89628399e-09f},
+    {0.232235119f, -1.3524605e-10f, 0.972659707f, -2.88244841e-08f},
+    {0.247403964f, -5.1457687e-09f, 0.968912423f, -9.46368206e-10f},
+    {0.262512386f, 1.39239686e-08f, 0.964928627f, -7.90938959e-09f},
+    {0.277556747f, 4.44823156e-09f, 0.960709214f, 2.88050508e-08f},
+    {0.292533338f, 3.95341182e-09f, 0.956255317f, 6.80886147e-09f},
+    {0.307438523f, -7.99690447e-09f, 0.951567948f, 1.83639728e-10f},
+    {0.322268635f, -4.60117455e-09f, 0.94664824f, 2.07966373e-08f},
+    {0.337020069f, -3.38479966e-10f, 0.941497445f, 1.80213746e-08f},
+    {0.351689219f, 9.52002122e-09f, 0.936116815f, -2.34628694e-09f},
+    {0.366272539f, -9.81432802e-09f, 0.9305076f, 2.16048495e-08f},
+    {0.380766422f, -1.25640822e-08f, 0.924671233f, 2.87666886e-08f},
+    {0.395167321f, 9.2742134e-09f, 0.918609142f, 1.34914515e-08f},
+    {0.40947178f, -3.00842684e-09f, 0.91232276f, 2.52438213e-08f},
+    {0.423676252f, 4.83882578e-09f, 0.905813694f, -1.05743077e-08f},
+    {0.437777311f, -7.73706255e-09f, 0.899083436f, 5.02470776e-09f},
+    {0.451771468f, 3.5675658e-09f, 0.892133713f, -1.34015599e-08f},
+    {0.465655357f, -1.00604236e-08f, 0.884966135f, 2.15011191e-08f},
+    {0.47942555f, -1.09029381e-08f, 0.87758255f, 1.18415446e-08f},
+    {0.493078679f, 6.90756385e-09f, 0.869984746f, -2.79208923e-08f},
+    {0.506611466f, -1.15935181e-08f, 0.862174451f, 2.8583715e-08f},
+    {0.520020545f, -2.57523425e-09f, 0.854153752f, 1.95042005e-09f},
+    {0.533302665f, 8.77924489e-09f, 0.845924497f, 2.58037214e-09f},
+    {0.546454608f, -1.52119561e-09f, 0.837488711f, 1.29702444e-08f},
+    {0.559473157f, -2.56816488e-08f, 0.828848481f, 6.43104192e-09f},
+    {0.572355092f, -2.33373001e-08f, 0.820005894f, 6.18995877e-09f},
+    {0.585097253f, 1.96178611e-08f, 0.810963094f, 2.52707508e-08f},
+    {0.597696662f, -2.74104561e-08f, 0.801722348f, 6.36205977e-09f},
+    {0.610150099f, -2.17248672e-08f, 0.79228586f, 9.23701948e-11f},
+    {0.622454584f, -2.34225226e-08f, 0.782655954f, -1.4334689e-08f},
+    {0.634607077f, 3.37037176e-09f, 0.772834957f, -1.04934941e-08f},
+    {0.646604657f, 1.24179955e-08f, 0.762825251f, 2.50849652e-08f},
+    {0.658444405f, -4.6914832e-09f, 0.752629399f, -2.68815548e-08f},
+    {0.670123398f, -1.7830823e-08f, 0.742249727f, -1.79064419e-09f},
+    {0.681638777f, -1.72326775e-08f, 0.731688857f, 1.17952688e-08f},
+    {0.69298774f, -1.27935076e-08f, 0.720949352f, 2.91581301e-08f},
+    {0.704167485f, 2.62174122e-08f, 0.710033894f, -1.00191251e-08f}
+};
+
+
+/*!
+ * Compute the sine and cosine of an angle in split precision. The angle is
+ * brought into +/-pi/4 by a multiple of pi/2, and then to within 1/128 of a
+ * table entry, where a few terms of the Taylor series are enough.
+ * \param angle is the angle in radians, which should be no more than a few
+ *        turns in magnitude.
+ * \param pSin receives the sine of angle.
+ * \param pCos receives the cosine of angle.
+ */
+void splitfSinCos(splitf_t angle, splitf_t* pSin, splitf_t* pCos)
+{
+    splitf_t x, t, t2, s, c, sinA, cosA, sinT, cosT;
+    float quadrant, step, p;
+    int index, q;
+
+    // Multiple of pi/2 nearest the angle, which is exact in a float
+    quadrant = floorf(angle.hi*0.636619747f + 0.5f);
+    x = splitfSub(angle, splitfMulf(piOver2, quadrant));
+
+    // Table entry nearest what's left
+    step = floorf(x.hi*SINCOS_STEPS + 0.5f);
+    t = splitfAddf(x, -step/SINCOS_STEPS);
+
+    index = (int)fabsf(step);
+    if(index > 50)
+        index = 50;
+
+    sinA.hi = sinCosTable[index][0];
+    sinA.lo = sinCosTable[index][1];
+    cosA.hi = sinCosTable[index][2];
+    cosA.lo = sinCosTable[index][3];
+
+    if(step < 0.0f)
+        sinA = splitfNeg(sinA);
+
+    // With |t| <= 1/128 the terms beyond t*t/2 are small enough to be plain floats
+    t2 = splitfMul(t, t);
+    p = t2.hi*(-1.0f/6.0f + t2.hi*(1.0f/120.0f));
+    sinT = splitfAddf(t, t.hi*p);
+    p = t2.hi*t2.hi*(1.0f/24.0f - t2.hi*(1.0f/720.0f));
+    cosT = splitfAddf(splitfAddf(splitfMulf(t2, -0.5f), 1.0f), p);
+
+    // Angle sum identities
+    s = splitfAdd(splitfMul(sinA, cosT), splitfMul(cosA, sinT));
+    c = splitfSub(splitfMul(cosA, cosT), splitfMul(sinA, sinT));
+
+    q = ((int)quadrant) & 3;
+    switch(q)
+    {
+    default:
+    case 0: *pSin = s;              *pCos = c;              break;
+    case 1: *pSin = c;              *pCos = splitfNeg(s);   break;
+    case 2: *pSin = splitfNeg(s);   *pCos = splitfNeg(c);   break;
+    case 3: *pSin = splitfNeg(c);   *pCos = s;              break;
+    }
+
+}// splitfSinCos
+
+
+/*!
+ * Compute the four quadrant arc tangent of y/x in split precision. The float
+ * arc tangent is corrected by the angle between its direction and (x, y),
+ * which is small enough to come from a single float division.
+ * \param y is the numerator.
+ * \param x is the denominator.
+ * \return the angle of (x, y) from the x axis in radians, from -pi to pi.
+ */
+splitf_t splitfAtan2(splitf_t y, splitf_t x)
+{
+    splitf_t angle, s, c, along, across;
+
+    angle = splitfFromFloat(atan2f(y.hi, x.hi));
+    splitfSinCos(angle, &s, &c);
+
+    // Components of (x, y) along and across the float angle
+    along = splitfAdd(splitfMul(x, c), splitfMul(y, s));
+    across = splitfSub(splitfMul(y, c), splitfMul(x, s));
+
+    if(along.hi > 0.0f)
+        angle = splitfAddf(angle, across.hi/along.hi);
+
+    return angle;
+
+}// splitfAtan2
+
+
+/*!
+ * Convert an angle in 1e-7 degrees, the units that latitudes and longitudes
+ * are encoded in for packets, to radians without rounding it to a float.
+ * \param angle is the angle in 1e-7 degrees.
+ * \return angle in radians.
+ */
+splitf_t degE7ToRadSplit(int32_t angle)
+{
+    return splitfMul(splitfFromInt32(angle), degE7ToRad);
+
+}// degE7ToRadSplit
+
+
+/*!
+ * Convert an angle in radians to 1e-7 degrees, the units that latitudes and
+ * longitudes are encoded in for packets, rounding to the nearest unit.
+ * \param angle is the angle in radians, from -pi to pi.
+ * \return angle in 1e-7 degrees.
+ */
+int32_t radToDegE7Split(splitf_t angle)
+{
+    splitf_t units = splitfMul(angle, radToDegE7);
+
+    // The high part can be too big for its fraction to fit, so round the two parts separately
+    float whole = floorf(units.hi);
+
+    return (int32_t)whole + (int32_t)floorf((units.hi - whole) + units.lo + 0.5f);
+
+}// radToDegE7Split
+
+
+/*!
+ * Compute the trigonometric values of latitude and longitude in single
+ * precision, e.g. for rotating vectors between NED and ECEF.
+ * \param lla is the latitude, longitude, altitude array in rad, rad, meters.
+ * \param trig receives the sin and cosine of latitude and longitude.
+ * \return a const pointer to trig.
+ */
+const llaTrigf_t* llaToTrigSplit(const splitf_t lla[NLLA], llaTrigf_t* trig)
+{
+    splitf_t s, c;
+
+    splitfSinCos(lla[LAT], &s, &c);
+    trig->sinLat = splitfToFloat(s);
+    trig->cosLat = splitfToFloat(c);
+
+    splitfSinCos(lla[LON], &s, &c);
+    trig->sinLon = splitfToFloat(s);
+    trig->cosLon = splitfToFloat(c);
+
+    return trig;
+
+}// llaToTrigSplit
+
+
+/*!
+ * Compute the radius of East-West curvature from the sine of the latitude
+ * \param sinLat is the sine of the latitude.
+ * \return the radius of curvature in meters.
+ */
+static splitf_t radiusOfEWCurvSplit(splitf_t sinLat)
+{
+    splitf_t d = splitfSub(splitfFromFloat(1.0f), splitfMul(eSquared, splitfMul(sinLat, sinLat)));
+
+    return splitfDiv(splitfFromFloat(datumf_semiMajorAxis), splitfSqrt(d));
+
+}// radiusOfEWCurvSplit
+
+
+/*!
+ * Convert a LLA position to Earth centered Earth fixed in split precision.
+ * \param lla is the latitude, longitude, altitude array in rad, rad, meters.
+ * \param ecef receives the X, Y, Z ECEF coordinates in meters.
+ */
+void llaToECEFSplit(const splitf_t lla[NLLA], splitf_t ecef[NECEF])
+{
+    splitf_t sinLat, cosLat, sinLon, cosLon, Rc, r;
+
+    splitfSinCos(lla[LAT], &sinLat, &cosLat);
+    splitfSinCos(lla[LON], &sinLon, &cosLon);
+
+    // Radius of East-West curvature in meters
+    Rc = radiusOfEWCurvSplit(sinLat);
+
+    r = splitfMul(splitfAdd(Rc, lla[ALT]), cosLat);
+    ecef[ECEFX] = splitfMul(r, cosLon);
+    ecef[ECEFY] = splitfMul(r, sinLon);
+    ecef[ECEFZ] = splitfMul(splitfAdd(splitfMul(Rc, oneMinusESquared), lla[ALT]), sinLat);
+
+}// llaToECEFSplit
+
+
+/*!
+ * Convert an ECEF position to LLA in split precision. A float guess from
+ * Bowring's formula is refined by one Newton step in split precision, which
+ * squares its error.
+ * \param ecef is the X, Y, Z ECEF position in meters.
+ * \param lla receives the LLA position in radians, radians, meters.
+ */
+void ecefToLLASplit(const splitf_t ecef[NECEF], splitf_t lla[NLLA])
+{
+    const float a = datumf_semiMajorAxis;
+    const float b = semiMinorAxis.hi;
+    const float e2 = eSquared.hi;
+    splitf_t p, sinLat, cosLat, Rc, dp, dz;
+    float pf, zf, zeta, sz, cz, sinf2, M, h;
+
+    // Distance from the axis of rotation
+    p = splitfSqrt(splitfAdd(splitfMul(ecef[ECEFX], ecef[ECEFX]), splitfMul(ecef[ECEFY], ecef[ECEFY])));
+
+    if(p.hi == 0.0f)
+    {
+        // On the Earth rotation axis: the center, or one of the poles
+        lla[LON] = splitfFromFloat(0.0f);
+
+        if(ecef[ECEFZ].hi == 0.0f)
+            lla[LAT] = splitfFromFloat(0.0f);
+        else if(ecef[ECEFZ].hi > 0.0f)
+            lla[LAT] = piOver2;
+        else
+            lla[LAT] = splitfNeg(piOver2);
+
+        lla[ALT] = splitfSub(ecef[ECEFZ].hi < 0.0f ? splitfNeg(ecef[ECEFZ]) : ecef[ECEFZ], semiMinorAxis);
+        return;
+    }
+
+    lla[LON] = splitfAtan2(ecef[ECEFY], ecef[ECEFX]);
+
+    // Bowring's formula in floats, good to about a float ulp
+    pf = splitfToFloat(p);
+    zf = splitfToFloat(ecef[ECEFZ]);
+    zeta = atan2f(zf*a, pf*b);
+    sz = sinf(zeta);
+    cz = cosf(zeta);
+    lla[LAT] = splitfFromFloat(atan2f(zf + (a*a/(b*b) - 1.0f)*b*sz*sz*sz, pf - e2*a*cz*cz*cz));
+
+    // Offset from the foot of the normal at the guessed latitude, in the meridian plane
+    splitfSinCos(lla[LAT], &sinLat, &cosLat);
+    Rc = radiusOfEWCurvSplit(sinLat);
+    dp = splitfSub(p, splitfMul(Rc, cosLat));
+    dz = splitfSub(ecef[ECEFZ], splitfMul(splitfMul(Rc, oneMinusESquared), sinLat));
+
+    // Height along the normal, and the error across it turned into an angle by the meridian radius of curvature
+    lla[ALT] = splitfAdd(splitfMul(dp, cosLat), splitfMul(dz, sinLat));
+    h = lla[ALT].hi;
+    sinf2 = sinLat.hi*sinLat.hi;
+    M = a*oneMinusESquared.hi/((1.0f - e2*sinf2)*sqrtf(1.0f - e2*sinf2));
+    lla[LAT] = splitfAddf(lla[LAT], splitfSub(splitfMul(dz, cosLat), splitfMul(dp, sinLat)).hi/(M + h));
+
+}// ecefToLLASplit
+
+
+/*!
+ * Find the ECEF position at a NED offset from another ECEF position. The
+ * rotation is done in floats, and only the sum is split.
+ * \param ned is the offset in North, East, Down meters.
+ * \param origin is the ECEF position the offset is from, in meters.
+ * \param trig holds the trigonometric values of the latitude and longitude
+ *        of the origin.
+ * \param ecef receives the ECEF position in meters, which can be the same as origin.
+ */
+void nedToECEFSplit(const float ned[NNED], const splitf_t origin[NECEF], const llaTrigf_t* trig, splitf_t ecef[NECEF])
+{
+    // The component of the offset in the equatorial plane, towards the meridian
+    float t = -trig->sinLat*ned[NORTH] - trig->cosLat*ned[DOWN];
+    float x = trig->cosLon*t - trig->sinLon*ned[EAST];
+    float y = trig->sinLon*t + trig->cosLon*ned[EAST];
+    float z = trig->cosLat*ned[NORTH] - trig->sinLat*ned[DOWN];
+
+    ecef[ECEFX] = splitfAddf(origin[ECEFX], x);
+    ecef[ECEFY] = splitfAddf(origin[ECEFY], y);
+    ecef[ECEFZ] = splitfAddf(origin[ECEFZ], z);
+
+}// nedToECEFSplit
+
+
+/*!
+ * Find the NED offset of an ECEF position from another ECEF position. The
+ * difference is taken in split precision, which keeps every bit of it, and
+ * then rotated in floats.
+ * \param ecef is the ECEF position in meters.
+ * \param origin is the ECEF position the offset is from, in meters.
+ * \param trig holds the trigonometric values of the latitude and longitude
+ *        of the origin.
+ * \param ned receives the offset in North, East, Down meters.
+ */
+void ecefToNEDSplit(const splitf_t ecef[NECEF], const splitf_t origin[NECEF], const llaTrigf_t* trig, float ned[NNED])
+{
+    float x = splitfToFloat(splitfSub(ecef[ECEFX], origin[ECEFX]));
+    float y = splitfToFloat(splitfSub(ecef[ECEFY], origin[ECEFY]));
+    float z = splitfToFloat(splitfSub(ecef[ECEFZ], origin[ECEFZ]));
+    float t = trig->cosLon*x + trig->sinLon*y;
+
+    ned[NORTH] = -trig->sinLat*t + trig->cosLat*z;
+    ned[EAST] = -trig->sinLon*x + trig->cosLon*y;
+    ned[DOWN] = -trig->cosLat*t - trig->sinLat*z;
+
+}// ecefToNEDSplit
@@ -0,0 +1,77 @@
+#ifndef EARTHPOSITIONF_H
+#define EARTHPOSITIONF_H
+
+/*!
+ * \file
+ * Geodesy in single precision, for processors without a double precision
+ * FPU. Positions are held as split floats (see splitfloat.h), so LLA and ECEF
+ * positions keep the precision of the double versions in earthposition.h
+ * without a single double operation. Offsets from a position, such as NED
+ * vectors, are small enough to be plain floats.
+ *
+ * Errors against the double versions, over the whole Earth and altitudes from
+ * -1 km to 100 km:
+ *
+ * - splitfSinCos(): under 5e-14 for angles of up to 10 radians.
+ * - llaToECEFSplit(): under 1e-6 m.
+ * - ecefToLLASplit(): under 1e-13 rad of latitude and longitude, and 1e-6 m
+ *   of altitude.
+ * - nedToECEFSplit() and ecefToNEDSplit(): 3e-7 of the length of the NED
+ *   vector, from the float rotation.
+ * - degE7ToRadSplit(): 2e-14 relative, and radToDegE7Split() gets the same
+ *   integer back.
+ *
+ * Nothing here allocates memory or touches any state outside its arguments.
+ */
+
+#include "earthposition.h"
+#include "splitfloat.h"
+
+// C++ compilers: don't mangle us
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! The trigonometric values of latitude and longitude in single precision
+typedef struct
+{
+    float sinLat;
+    float sinLon;
+    float cosLat;
+    float cosLon;
+
+}llaTrigf_t;
+
+//! Compute the sine and cosine of an angle in split precision
+void splitfSinCos(splitf_t angle, splitf_t* pSin, splitf_t* pCos);
+
+//! Compute the four quadrant arc tangent of y/x in split precision
+splitf_t splitfAtan2(splitf_t y, splitf_t x);
+
+//! Convert an angle in 1e-7 degrees, as it comes in packets, to radians
+splitf_t degE7ToRadSplit(int32_t angle);
+
+//! Convert an angle in radians to 1e-7 degrees, as it goes in packets
+int32_t radToDegE7Split(splitf_t angle);
+
+//! Compute the trigonometric values of latitude and longitude in single precision
+const llaTrigf_t* llaToTrigSplit(const splitf_t lla[NLLA], llaTrigf_t* trig);
+
+//! Convert a LLA position to Earth centered Earth fixed in split precision
+void llaToECEFSplit(const splitf_t lla[NLLA], splitf_t ecef[NECEF]);
+
+//! Convert an ECEF position to LLA in split precision
+void ecefToLLASplit(const splitf_t ecef[NECEF], splitf_t lla[NLLA]);
+
+//! Find the ECEF position at a NED offset from another ECEF position
+void nedToECEFSplit(const float ned[NNED], const splitf_t origin[NECEF], const llaTrigf_t* trig, splitf_t ecef[NECEF]);
+
+//! Find the NED offset of an ECEF position from another ECEF position
+void ecefToNEDSplit(const splitf_t ecef[NECEF], const splitf_t origin[NECEF], const llaTrigf_t* trig, float ned[NNED]);
+
+// C++ compilers: don't mangle us
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EARTHPOSITIONF_H
@@ -73,6 +73,66 @@ void ecefToNEDtrig(const double ecef[NECEF], double ned[NNED], const llaTrig_t*
 }// ecefToNEDtrig
 
 
+/*!
+ * Convert an array of vectors from North, East, Down to Earth Centered Earth
+ * Fixed, all at the same location. The vectors are given as separate arrays
+ * for each component, and the rotation is worked out once for all of them.
+ * \param north, east, down are the NED vector components to convert.
+ * \param n is the number of vectors.
+ * \param x, y, z receive the ECEF vector components. These can be the same
+ *        arrays as north, east and down for rotation in place.
+ * \param trig are the precomputed trig values that depend on latitude and longitude
+ */
+void nedToECEFArray(const double *north, const double *east, const double *down, size_t n, double *x, double *y, double *z, const llaTrig_t* trig)
+{
+    // Rotation matrix terms, the same as nedToECEFtrig()
+    double xn = -trig->sinLat*trig->cosLon, xe = -trig->sinLon, xd = -trig->cosLat*trig->cosLon;
+    double yn = -trig->sinLat*trig->sinLon, ye =  trig->cosLon, yd = -trig->cosLat*trig->sinLon;
+    double zn =  trig->cosLat,                                  zd = -trig->sinLat;
+    size_t i;
+
+    for(i = 0; i < n; i++)
+    {
+        double N = north[i], E = east[i], D = down[i];
+
+        x[i] = xn*N + xe*E + xd*D;
+        y[i] = yn*N + ye*E + yd*D;
+        z[i] = zn*N        + zd*D;
+    }
+
+}// nedToECEFArray
+
+
+/*!
+ * Convert an array of vectors from Earth Centered Earth Fixed to North, East,
+ * Down, all at the same location. The vectors are given as separate arrays
+ * for each component, and the rotation is worked out once for all of them.
+ * \param x, y, z are the ECEF vector components to convert.
+ * \param n is the number of vectors.
+ * \param north, east, down receive the NED vector components. These can be
+ *        the same arrays as x, y and z for rotation in place.
+ * \param trig are the precomputed trig values that depend on latitude and longitude
+ */
+void ecefToNEDArray(const double *x, const double *y, const double *z, size_t n, double *north, double *east, double *down, const llaTrig_t* trig)
+{
+    // Rotation matrix terms, the same as ecefToNEDtrig()
+    double nx = -trig->sinLat*trig->cosLon, ny = -trig->sinLat*trig->sinLon, nz = trig->cosLat;
+    double ex = -trig->sinLon,              ey =  trig->cosLon;
+    double dx = -trig->cosLat*trig->cosLon, dy = -trig->cosLat*trig->sinLon, dz = -trig->sinLat;
+    size_t i;
+
+    for(i = 0; i < n; i++)
+    {
+        double X = x[i], Y = y[i], Z = z[i];
+
+        north[i] = nx*X + ny*Y + nz*Z;
+        east[i]  = ex*X + ey*Y;
+        down[i]  = dx*X + dy*Y + dz*Z;
+    }
+
+}// ecefToNEDArray
+
+
 /*!
  * Fill out a dcm that rotates from NED to ECEF
  * \param dcm is filled out with the rotation
@@ -21,6 +21,12 @@ void nedToECEFtrig(const double ned[NNED], double ecef[NECEF], const llaTrig_t*
 //! Convert an ECEF vector to NED using trig data
 void ecefToNEDtrig(const double ecef[NECEF], double ned[NNED], const llaTrig_t* trig);
 
+//! Convert arrays of NED vectors at one location to ECEF, one array per component
+void nedToECEFArray(const double *north, const double *east, const double *down, size_t n, double *x, double *y, double *z, const llaTrig_t* trig);
+
+//! Convert arrays of ECEF vectors at one location to NED, one array per component
+void ecefToNEDArray(const double *x, const double *y, const double *z, size_t n, double *north, double *east, double *down, const llaTrig_t* trig);
+
 //! Fill out a dcm that rotates from NED to ECEF
 void nedToECEFdcmd(DCMd_t* dcm, const llaTrig_t* trig);
 
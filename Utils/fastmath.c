@@ -0,0 +1,212 @@
+#include "fastmath.h"
+
+
+/*!
+ * Compute the sines and cosines of an array of angles at a given tier
+ * \param angle is the array of angles in radians
+ * \param pSin receives the sine of each angle
+ * \param pCos receives the cosine of each angle
+ * \param n is the number of angles
+ */
+void fastSinCosArrayCoarse(const float* angle, float* pSin, float* pCos, size_t n)
+{
+    size_t i;
+
+    for(i = 0; i < n; i++)
+        fastSinCosCoarse(angle[i], &pSin[i], &pCos[i]);
+
+}// fastSinCosArrayCoarse
+
+void fastSinCosArrayFine(const float* angle, float* pSin, float* pCos, size_t n)
+{
+    size_t i;
+
+    for(i = 0; i < n; i++)
+        fastSinCosFine(angle[i], &pSin[i], &pCos[i]);
+
+}// fastSinCosArrayFine
+
+void fastSinCosArrayExact(const float* angle, float* pSin, float* pCos, size_t n)
+{
+    size_t i;
+
+    for(i = 0; i < n; i++)
+    {
+        pSin[i] = (float)sin(angle[i]);
+        pCos[i] = (float)cos(angle[i]);
+    }
+
+}// fastSinCosArrayExact
+
+
+/*!
+ * Compute the arc tangents of an array of y/x pairs at a given tier
+ * \param y is the array of numerators
+ * \param x is the array of denominators
+ * \param angle receives each arc tangent in radians, from -pi to pi
+ * \param n is the number of pairs
+ */
+void fastAtan2ArrayCoarse(const float* y, const float* x, float* angle, size_t n)
+{
+    size_t i;
+
+    for(i = 0; i < n; i++)
+        angle[i] = fastAtan2Coarse(y[i], x[i]);
+
+}// fastAtan2ArrayCoarse
+
+void fastAtan2ArrayFine(const float* y, const float* x, float* angle, size_t n)
+{
+    size_t i;
+
+    for(i = 0; i < n; i++)
+        angle[i] = fastAtan2Fine(y[i], x[i]);
+
+}// fastAtan2ArrayFine
+
+void fastAtan2ArrayExact(const float* y, const float* x, float* angle, size_t n)
+{
+    size_t i;
+
+    for(i = 0; i < n; i++)
+        angle[i] = (float)atan2(y[i], x[i]);
+
+}// fastAtan2ArrayExact
+
+
+/*!
+ * Compute the arc sines of an array of values at a given tier
+ * \param x is the array of values, from -1 to 1
+ * \param angle receives each arc sine in radians, from -pi/2 to pi/2
+ * \param n is the number of values
+ */
+void fastAsinArrayCoarse(const float* x, float* angle, size_t n)
+{
+    size_t i;
+
+    for(i = 0; i < n; i++)
+        angle[i] = fastAsinCoarse(x[i]);
+
+}// fastAsinArrayCoarse
+
+void fastAsinArrayFine(const float* x, float* angle, size_t n)
+{
+    size_t i;
+
+    for(i = 0; i < n; i++)
+        angle[i] = fastAsinFine(x[i]);
+
+}// fastAsinArrayFine
+
+void fastAsinArrayExact(const float* x, float* angle, size_t n)
+{
+    size_t i;
+
+    for(i = 0; i < n; i++)
+        angle[i] = (float)asin(x[i]);
+
+}// fastAsinArrayExact
+
+
+/*!
+ * Compute the inverse square roots of an array of values at a given tier
+ * \param x is the array of values, which must be positive
+ * \param result receives x ^ -0.5 for each value
+ * \param n is the number of values
+ */
+void fastISqrtArrayCoarse(const float* x, float* result, size_t n)
+{
+    size_t i;
+
+    for(i = 0; i < n; i++)
+        result[i] = fastISqrtCoarse(x[i]);
+
+}// fastISqrtArrayCoarse
+
+void fastISqrtArrayFine(const float* x, float* result, size_t n)
+{
+    size_t i;
+
+    for(i = 0; i < n; i++)
+        result[i] = fastISqrtFine(x[i]);
+
+}// fastISqrtArrayFine
+
+void fastISqrtArrayExact(const float* x, float* result, size_t n)
+{
+    size_t i;
+
+    for(i = 0; i < n; i++)
+        result[i] = (float)(1.0 / sqrt(x[i]));
+
+}// fastISqrtArrayExact
+
+
+//! Number of points that testFastMath() checks each function at
+#define FASTMATH_TEST_POINTS 4096
+
+//! Worst errors that testFastMath() allows for the coarse and fine tiers
+#define FASTMATH_COARSE_TOLERANCE 1e-4
+#define FASTMATH_FINE_TOLERANCE   4e-7
+
+/*!
+ * Check the coarse and fine tiers against the C library over their documented
+ * ranges. Sines and cosines are checked out to 1e4 radians, arc tangents all
+ * the way around the circle, arc sines from -1 to 1 and inverse square roots
+ * over several decades.
+ * \return the number of functions that were out of tolerance, 0 if they all passed
+ */
+int testFastMath(void)
+{
+    double worst[2][5] = {{0}};
+    int i, tier, failures = 0;
+
+    for(i = 0; i < FASTMATH_TEST_POINTS; i++)
+    {
+        double t = (i + 0.5) / FASTMATH_TEST_POINTS;
+
+        // Angles spread out to 1e4 radians and clustered near zero, and the other inputs spread over their ranges
+        float angle = (float)(((i & 1) ? -1.0 : 1.0) * ((i & 2) ? t * 10000.0 : t * 7.0));
+        float y = (float)sin(2*PId*t), x = (float)cos(2*PId*t);
+        float value = (float)(2.0*t - 1.0), positive = (float)pow(10.0, 8.0*t - 4.0);
+
+        for(tier = 0; tier < 2; tier++)
+        {
+            float s, c, a, b, r;
+
+            if(tier == 0)
+            {
+                fastSinCosCoarse(angle, &s, &c);
+                a = fastAtan2Coarse(y, x);
+                b = fastAsinCoarse(value);
+                r = fastISqrtCoarse(positive);
+            }
+            else
+            {
+                fastSinCosFine(angle, &s, &c);
+                a = fastAtan2Fine(y, x);
+                b = fastAsinFine(value);
+                r = fastISqrtFine(positive);
+            }
+
+            // The polynomials are compared with the exact function of the same float inputs
+            worst[tier][0] = MAX(worst[tier][0], fabs(s - sin(angle)));
+            worst[tier][1] = MAX(worst[tier][1], fabs(c - cos(angle)));
+            worst[tier][2] = MAX(worst[tier][2], fabs(a - atan2(y, x)));
+            worst[tier][3] = MAX(worst[tier][3], fabs(b - asin(value)));
+            worst[tier][4] = MAX(worst[tier][4], fabs(r * sqrt(positive) - 1.0));
+        }
+    }
+
+    for(i = 0; i < 5; i++)
+    {
+        if(worst[0][i] > FASTMATH_COARSE_TOLERANCE)
+            failures++;
+
+        if(worst[1][i] > FASTMATH_FINE_TOLERANCE)
+            failures++;
+    }
+
+    return failures;
+
+}// testFastMath
@@ -0,0 +1,214 @@
+#ifndef FASTMATH_H
+#define FASTMATH_H
+
+/*!
+ * \file
+ * Approximate trig and square root functions in three accuracy tiers, so each
+ * call site can pick how much accuracy it pays for. Display code can use the
+ * coarse tier while anything that feeds targeting stays exact.
+ *
+ * - Coarse: float polynomials, maximum absolute error about 1e-4 (relative
+ *   for the inverse square root). Good enough for pixels.
+ * - Fine: float polynomials with a more careful range reduction, maximum
+ *   absolute error about 1e-7 and never more than 4e-7 (arc tangents near
+ *   pi), which is within a couple of float ulps of the result.
+ * - Exact: the C library, in double precision.
+ *
+ * The tier is chosen at compile time by passing Coarse, Fine or Exact to the
+ * fastmath macros, e.g. fastmathSin(Coarse, angle), or FASTMATH_TIER to use
+ * the default tier for the translation unit. The sine and cosine errors hold
+ * for angles of up to 1e4 radians in magnitude.
+ *
+ * The scalar functions are inlined and free of branches, and the array
+ * versions in fastmath.c are plain loops over them, so compilers can
+ * vectorize them.
+ */
+
+#include "Types.h"
+#include "Constants.h"
+#include <math.h>
+#include <stddef.h>
+
+// C++ compilers: don't mangle us
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Default tier for the fastmath macros when a translation unit doesn't pick one
+#ifndef FASTMATH_TIER
+# define FASTMATH_TIER Fine
+#endif
+
+//! Paste a function name and a tier together, after expanding the tier
+#define FASTMATH_PASTE(name, tier) name##tier
+#define FASTMATH_CALL(name, tier) FASTMATH_PASTE(name, tier)
+
+//! Sine, cosine, both at once, arc tangent, arc sine and inverse square root at a given tier
+#define fastmathSin(tier, x)            FASTMATH_CALL(fastSin, tier)(x)
+#define fastmathCos(tier, x)            FASTMATH_CALL(fastCos, tier)(x)
+#define fastmathSinCos(tier, x, s, c)   FASTMATH_CALL(fastSinCos, tier)(x, s, c)
+#define fastmathAtan2(tier, y, x)       FASTMATH_CALL(fastAtan2, tier)(y, x)
+#define fastmathAsin(tier, x)           FASTMATH_CALL(fastAsin, tier)(x)
+#define fastmathISqrt(tier, x)          FASTMATH_CALL(fastISqrt, tier)(x)
+
+//! Array versions of the above, always in single precision
+#define fastmathSinCosArray(tier, x, s, c, n)   FASTMATH_CALL(fastSinCosArray, tier)(x, s, c, n)
+#define fastmathAtan2Array(tier, y, x, a, n)    FASTMATH_CALL(fastAtan2Array, tier)(y, x, a, n)
+#define fastmathAsinArray(tier, x, a, n)        FASTMATH_CALL(fastAsinArray, tier)(x, a, n)
+#define fastmathISqrtArray(tier, x, r, n)       FASTMATH_CALL(fastISqrtArray, tier)(x, r, n)
+
+//! Pi/2 split into three floats for Cody-Waite range reduction, the first two with enough trailing zeros to multiply exactly
+#define FASTMATH_PIO2_1 1.5703125f
+#define FASTMATH_PIO2_2 4.837512969970703125e-4f
+#define FASTMATH_PIO2_3 7.54978995489188216e-8f
+
+/*!
+ * Reduce an angle to the range -pi/4 to pi/4
+ * \param angle is the angle in radians
+ * \param pQuadrant receives the number of quarter turns that were taken off
+ * \return the reduced angle
+ */
+static __inline float fastReduceAngle(float angle, int* pQuadrant)
+{
+    // Round to the nearest quarter turn without floorf, which doesn't vectorize everywhere
+    float k = (float)(int)(angle*(2.0f/PIf) + ((angle >= 0) ? 0.5f : -0.5f));
+
+    *pQuadrant = (int)k;
+
+    return ((angle - k*FASTMATH_PIO2_1) - k*FASTMATH_PIO2_2) - k*FASTMATH_PIO2_3;
+}
+
+//! Coarse sine and cosine of an angle in radians
+static __inline void fastSinCosCoarse(float angle, float* pSin, float* pCos)
+{
+    int q;
+    float r = fastReduceAngle(angle, &q), r2 = r*r;
+
+    // Taylor series out to r^5 and r^6, which are good to 4e-5 over a quarter turn
+    float s = r*(1.0f + r2*(-1.0f/6.0f + r2*(1.0f/120.0f)));
+    float c = 1.0f + r2*(-0.5f + r2*(1.0f/24.0f + r2*(-1.0f/720.0f)));
+
+    // Swap and negate according to the quadrant
+    float sq = (q & 1) ? c : s, cq = (q & 1) ? s : c;
+    *pSin = (q & 2) ? -sq : sq;
+    *pCos = ((q + 1) & 2) ? -cq : cq;
+}
+
+//! Fine sine and cosine of an angle in radians
+static __inline void fastSinCosFine(float angle, float* pSin, float* pCos)
+{
+    int q;
+    float r = fastReduceAngle(angle, &q), r2 = r*r;
+
+    // Taylor series out to r^9 and r^8, which are good to 3e-8 over a quarter turn
+    float s = r*(1.0f + r2*(-1.0f/6.0f + r2*(1.0f/120.0f + r2*(-1.0f/5040.0f + r2*(1.0f/362880.0f)))));
+    float c = 1.0f + r2*(-0.5f + r2*(1.0f/24.0f + r2*(-1.0f/720.0f + r2*(1.0f/40320.0f))));
+
+    float sq = (q & 1) ? c : s, cq = (q & 1) ? s : c;
+    *pSin = (q & 2) ? -sq : sq;
+    *pCos = ((q + 1) & 2) ? -cq : cq;
+}
+
+//! Exact sine and cosine of an angle in radians
+static __inline void fastSinCosExact(double angle, double* pSin, double* pCos)
+{
+    *pSin = sin(angle);
+    *pCos = cos(angle);
+}
+
+static __inline float fastSinCoarse(float angle)  { float s, c; fastSinCosCoarse(angle, &s, &c); return s; }
+static __inline float fastCosCoarse(float angle)  { float s, c; fastSinCosCoarse(angle, &s, &c); return c; }
+static __inline float fastSinFine(float angle)    { float s, c; fastSinCosFine(angle, &s, &c); return s; }
+static __inline float fastCosFine(float angle)    { float s, c; fastSinCosFine(angle, &s, &c); return c; }
+static __inline double fastSinExact(double angle) { return sin(angle); }
+static __inline double fastCosExact(double angle) { return cos(angle); }
+
+/*!
+ * Finish an arc tangent from its value over the first octant
+ * \param r is the arc tangent of min(|y|, |x|) / max(|y|, |x|)
+ * \return the arc tangent in the right quadrant, from -pi to pi
+ */
+static __inline float fastAtan2Octant(float r, float y, float x)
+{
+    r = (fabsf(y) > fabsf(x)) ? (0.5f*PIf - r) : r;
+    r = (x < 0) ? (PIf - r) : r;
+    return (y < 0) ? -r : r;
+}
+
+//! Coarse arc tangent of y/x in radians, from -pi to pi
+static __inline float fastAtan2Coarse(float y, float x)
+{
+    float ax = fabsf(x), ay = fabsf(y), hi = (ax > ay) ? ax : ay, lo = (ax > ay) ? ay : ax;
+    float a = (hi > 0) ? lo / hi : 0.0f, a2 = a*a;
+
+    // Abramowitz and Stegun 4.4.47, good to 1e-5
+    return fastAtan2Octant(a*(0.9998660f + a2*(-0.3302995f + a2*(0.1801410f + a2*(-0.0851330f + a2*0.0208351f)))), y, x);
+}
+
+//! Fine arc tangent of y/x in radians, from -pi to pi
+static __inline float fastAtan2Fine(float y, float x)
+{
+    float ax = fabsf(x), ay = fabsf(y), hi = (ax > ay) ? ax : ay, lo = (ax > ay) ? ay : ax;
+    float a = (hi > 0) ? lo / hi : 0.0f, a2 = a*a;
+
+    // Abramowitz and Stegun 4.4.49, good to 2e-8
+    return fastAtan2Octant(a*(1.0f + a2*(-0.3333314528f + a2*(0.1999355085f + a2*(-0.1420889944f + a2*(0.1065626393f +
+                           a2*(-0.0752896400f + a2*(0.0429096138f + a2*(-0.0161657367f + a2*0.0028662257f)))))))), y, x);
+}
+
+//! Exact arc tangent of y/x in radians, from -pi to pi
+static __inline double fastAtan2Exact(double y, double x) { return atan2(y, x); }
+
+//! Arc sines from -pi/2 to pi/2, as the arc tangent of x over the cosine, which is computed as sqrt((1-x)(1+x)) to stay accurate near 1
+static __inline float fastAsinCoarse(float x) { return fastAtan2Coarse(x, sqrtf((1.0f - x)*(1.0f + x))); }
+static __inline float fastAsinFine(float x)   { return fastAtan2Fine(x, sqrtf((1.0f - x)*(1.0f + x))); }
+static __inline double fastAsinExact(double x) { return asin(x); }
+
+//! Coarse inverse square root, the same trick as fastISqrt() with a second Newton iteration to bring it to 5e-6
+static __inline float fastISqrtCoarse(float x)
+{
+    union { float f; int32_t i; } u;
+    float y;
+
+    u.f = x;
+    u.i = 0x5f3759dfL - (u.i >> 1);
+    y = u.f;
+
+    y = y*(1.5f - 0.5f*x*y*y);
+    return y*(1.5f - 0.5f*x*y*y);
+}
+
+//! Fine inverse square root, which hardware square roots make cheap enough
+static __inline float fastISqrtFine(float x) { return 1.0f / sqrtf(x); }
+
+//! Exact inverse square root
+static __inline double fastISqrtExact(double x) { return 1.0 / sqrt(x); }
+
+//! Sines and cosines of n angles in radians
+void fastSinCosArrayCoarse(const float* angle, float* pSin, float* pCos, size_t n);
+void fastSinCosArrayFine(const float* angle, float* pSin, float* pCos, size_t n);
+void fastSinCosArrayExact(const float* angle, float* pSin, float* pCos, size_t n);
+
+//! Arc tangents of n y/x pairs in radians
+void fastAtan2ArrayCoarse(const float* y, const float* x, float* angle, size_t n);
+void fastAtan2ArrayFine(const float* y, const float* x, float* angle, size_t n);
+void fastAtan2ArrayExact(const float* y, const float* x, float* angle, size_t n);
+
+//! Arc sines of n values in radians
+void fastAsinArrayCoarse(const float* x, float* angle, size_t n);
+void fastAsinArrayFine(const float* x, float* angle, size_t n);
+void fastAsinArrayExact(const float* x, float* angle, size_t n);
+
+//! Inverse square roots of n values
+void fastISqrtArrayCoarse(const float* x, float* result, size_t n);
+void fastISqrtArrayFine(const float* x, float* result, size_t n);
+void fastISqrtArrayExact(const float* x, float* result, size_t n);
+
+//! Check every tier against the C library, returns the number of functions that are out of tolerance
+int testFastMath(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FASTMATH_H
@@ -11,6 +11,12 @@
 # define MAX(x,y) (((x) > (y)) ? (x) : (y))
 #endif
 
+//! Rows and columns per block in the matrix multiplies, sized so a block of doubles fits in L1 cache
+#define MATRIX_BLOCK 64
+
+//! Largest matrix whose inverse can record its row swaps on the stack
+#define MATRIX_PIVOT_STACK 32
+
 /*!
  * Set all elements of a vector3 to a specific value
  * \param vector is the vector3 to change
@@ -378,15 +384,17 @@ Vector_t* vectorSetAll(Vector_t* V, double value)
 /*!
  * Allocate a vector, initializing its memory. The memory will be allocated
  * in a single step so all of the vector's memory can be released by calling
- * free(vector). The vector will initially be zero.
+ * free(vector), or linearAllocatorFree() if it came from another allocator.
+ * The vector will initially be zero.
+ * \param pAllocator is the allocator to use, or NULL for the one set by linearAllocatorSet().
  * \param num is the number of elements of the vector.
  * \return a pointer to the newly allocated matrix, or
  *         NULL if the allocation failed.
  */
-Vector_t* vectorAllocate(uint32_t num)
+Vector_t* vectorAllocateWith(LinearAllocator_t* pAllocator, uint32_t num)
 {
     // Allocate memory for the structure and data
-    Vector_t* V = (Vector_t*)malloc(sizeof(Vector_t) + sizeof(double)*num);
+    Vector_t* V = (Vector_t*)linearAllocatorAlloc(pAllocator, sizeof(Vector_t) + sizeof(double)*num);
 
     // We choose this funky allocation method because it is now possible to
     // free(V) without worrying about separately freeing the data pointer. So
@@ -411,21 +419,34 @@ Vector_t* vectorAllocate(uint32_t num)
 
     return V;
 
+}// vectorAllocateWith
+
+
+/*!
+ * Allocate a vector using the allocator set by linearAllocatorSet(), which is
+ * the heap by default. See vectorAllocateWith().
+ */
+Vector_t* vectorAllocate(uint32_t num)
+{
+    return vectorAllocateWith(NULL, num);
+
 }// vectorAllocate
 
 
 /*!
  * Change the size of a dynamically allocated vector. This can only be used
- * with vectors that were created using vectorAllocate().
+ * with vectors that were created using vectorAllocate() or vectorAllocateWith(),
+ * using the same allocator.
+ * \param pAllocator is the allocator to use, or NULL for the one set by linearAllocatorSet().
  * \param v is the vector whose size will be changed.
  * \param num is the new size of the vector.
  * \param initial is the value given to the new elements of vector if it's size is being increased.
  * \return The new pointer to the vector, or null if the reallocation failed.
  */
-Vector_t* vectorChangeAllocateSize(Vector_t* v, uint32_t num, double initial)
+Vector_t* vectorChangeAllocateSizeWith(LinearAllocator_t* pAllocator, Vector_t* v, uint32_t num, double initial)
 {
     // Re-allocate memory for the structure and data.
-    Vector_t* V = (Vector_t*)realloc(v, sizeof(Vector_t) + sizeof(double)*num);
+    Vector_t* V = (Vector_t*)linearAllocatorRealloc(pAllocator, v, (v != NULL) ? sizeof(Vector_t) + sizeof(double)*v->num : 0, sizeof(Vector_t) + sizeof(double)*num);
 
     // We choose this funky allocation method because it is now possible to
     // free(V) without worrying about separately freeing the data pointer. So
@@ -446,6 +467,17 @@ Vector_t* vectorChangeAllocateSize(Vector_t* v, uint32_t num, double initial)
 
     return V;
 
+}// vectorChangeAllocateSizeWith
+
+
+/*!
+ * Change the size of a vector using the allocator set by linearAllocatorSet(), which is
+ * the heap by default. See vectorChangeAllocateSizeWith().
+ */
+Vector_t* vectorChangeAllocateSize(Vector_t* v, uint32_t num, double initial)
+{
+    return vectorChangeAllocateSizeWith(NULL, v, num, initial);
+
 }// vectorChangeAllocateSize
 
 
@@ -765,6 +797,9 @@ static BOOL matrixInverse2x2(const Matrix_t* A, Matrix_t* B);
 //! Invert a 3x3 matrix
 static BOOL matrixInverse3x3(const Matrix_t* A, Matrix_t* B);
 
+//! Calculate the inverse of a square matrix of any size in place
+static BOOL matrixInverseGaussJordan(Matrix_t* B);
+
 
 /*!
  * Get a specific element of a matrix
@@ -807,16 +842,18 @@ void matrixAddToElement(Matrix_t* M, uint32_t row, uint32_t col, double value)
 
 /*! Allocate a matrix, initializing its memory. The memory will be allocated
  * in a single step so all of the matrix's memory can be released by calling
- * free(matrix). The matrix will initially be zero.
+ * free(matrix), or linearAllocatorFree() if it came from another allocator.
+ * The matrix will initially be zero.
+ * \param pAllocator is the allocator to use, or NULL for the one set by linearAllocatorSet().
  * \param rows is the number of rows of the matrix.
  * \param cols is the number of columns of the matrix.
  * \return a pointer to the newly allocated matrix, or
  *         NULL if the allocation failed.
  */
-Matrix_t* matrixAllocate(uint32_t rows, uint32_t cols)
+Matrix_t* matrixAllocateWith(LinearAllocator_t* pAllocator, uint32_t rows, uint32_t cols)
 {
     // Allocate memory for the structure and data
-    Matrix_t* M = (Matrix_t*)malloc(sizeof(Matrix_t) + sizeof(double)*rows*cols);
+    Matrix_t* M = (Matrix_t*)linearAllocatorAlloc(pAllocator, sizeof(Matrix_t) + sizeof(double)*rows*cols);
 
     // We choose this funky allocation method because it is now possible to
     // free(M) without worrying about separately freeing the data pointer. So
@@ -842,12 +879,25 @@ Matrix_t* matrixAllocate(uint32_t rows, uint32_t cols)
 
     return M;
 
+}// matrixAllocateWith
+
+
+/*!
+ * Allocate a matrix using the allocator set by linearAllocatorSet(), which is
+ * the heap by default. See matrixAllocateWith().
+ */
+Matrix_t* matrixAllocate(uint32_t rows, uint32_t cols)
+{
+    return matrixAllocateWith(NULL, rows, cols);
+
 }// matrixAllocate
 
 
 /*!
  * Change the size of a dynamically allocated matrix. This applies only to
- * matrix allocated via matrixAllocate().
+ * matrix allocated via matrixAllocate() or matrixAllocateWith(),
+ * using the same allocator.
+ * \param pAllocator is the allocator to use, or NULL for the one set by linearAllocatorSet().
  * \param M is the matrix whose size will be changed.
  * \param rows is the new number of rows.
  * \param cols is the new number of columns.
@@ -855,10 +905,10 @@ Matrix_t* matrixAllocate(uint32_t rows, uint32_t cols)
  *        of rows or columns are being increased.
  * \return The reallocated matrix or null if the reallocation failed
  */
-Matrix_t* matrixChangeAllocateSize(Matrix_t* oldM, uint32_t rows, uint32_t cols, double initial)
+Matrix_t* matrixChangeAllocateSizeWith(LinearAllocator_t* pAllocator, Matrix_t* oldM, uint32_t rows, uint32_t cols, double initial)
 {
     // Realllocate memory for the structure and data
-    Matrix_t* M = (Matrix_t*)realloc(oldM, sizeof(Matrix_t) + sizeof(double)*rows*cols);
+    Matrix_t* M = (Matrix_t*)linearAllocatorRealloc(pAllocator, oldM, (oldM != NULL) ? sizeof(Matrix_t) + sizeof(double)*oldM->numRows*oldM->numCols : 0, sizeof(Matrix_t) + sizeof(double)*rows*cols);
 
     // We choose this funky allocation method because it is now possible to
     // free(M) without worrying about separately freeing the data pointer. So
@@ -879,6 +929,17 @@ Matrix_t* matrixChangeAllocateSize(Matrix_t* oldM, uint32_t rows, uint32_t cols,
 
     return M;
 
+}// matrixChangeAllocateSizeWith
+
+
+/*!
+ * Change the size of a matrix using the allocator set by linearAllocatorSet(), which is
+ * the heap by default. See matrixChangeAllocateSizeWith().
+ */
+Matrix_t* matrixChangeAllocateSize(Matrix_t* oldM, uint32_t rows, uint32_t cols, double initial)
+{
+    return matrixChangeAllocateSizeWith(NULL, oldM, rows, cols, initial);
+
 }// matrixChangeAllocateSize
 
 
@@ -1062,7 +1123,8 @@ void matrixSetColumn(Matrix_t* M, uint32_t col, double value)
  */
 BOOL matrixMultiply(const Matrix_t* A, const Matrix_t* B, Matrix_t* C)
 {
-    uint32_t row, col, i;
+    uint32_t row, col, i, col0, i0, colEnd, iEnd;
+    uint32_t m = A->numRows, n = A->numCols, s = B->numCols;
 
     // When multiplying matrices A x B = C we must satisfy the following dimensions:
     // A = m by n    // m rows by n columns
@@ -1072,26 +1134,41 @@ BOOL matrixMultiply(const Matrix_t* A, const Matrix_t* B, Matrix_t* C)
     if((A->numCols != B->numRows) || (A->numRows != C->numRows) || (B->numCols != C->numCols))
         return FALSE;
 
-    /// TODO: there is some potential for optimization here reqarding computing of data indices
-    for(row = 0; row < A->numRows; row++ )
+    // The result is accumulated in place, so it starts at zero
+    memset(C->data, 0, sizeof(double)*m*s);
+
+    // Walk B in blocks small enough to stay in cache while every row of A
+    // passes over them. The inner loop runs along contiguous rows of B and C,
+    // which the compiler can vectorize. Each element still sums over the inner
+    // dimension in ascending order, so the result matches the simple loop.
+    for(col0 = 0; col0 < s; col0 += MATRIX_BLOCK)
     {
-        for(col = 0; col < B->numCols; col++)
+        colEnd = MIN(col0 + MATRIX_BLOCK, s);
+
+        for(i0 = 0; i0 < n; i0 += MATRIX_BLOCK)
         {
-            // Initialize the summation
-            double result = 0.0;
+            iEnd = MIN(i0 + MATRIX_BLOCK, n);
 
-            for(i = 0; i < A->numCols; i++)
+            for(row = 0; row < m; row++)
             {
-                // continue summation
-                result += get(A, row, i)*get(B, i, col);
+                const double* pA = A->data + row*n;
+                double* pC = C->data + row*s;
+
+                for(i = i0; i < iEnd; i++)
+                {
+                    const double a = pA[i];
+                    const double* pB = B->data + i*s;
 
-            }// for the inner dimension
+                    for(col = col0; col < colEnd; col++)
+                        pC[col] += a*pB[col];
 
-            set(C, row, col, result);
+                }// for the inner dimension in this block
 
-        }// for all columns of the result matrix
+            }// for all rows of the result matrix
 
-    }// for all rows of the result matrix
+        }// for all blocks of the inner dimension
+
+    }// for all blocks of result columns
 
     return TRUE;
 
@@ -1107,37 +1184,45 @@ BOOL matrixMultiply(const Matrix_t* A, const Matrix_t* B, Matrix_t* C)
  */
 BOOL matrixMultiplyTransA(const Matrix_t* A, const Matrix_t* B, Matrix_t* C)
 {
-    uint32_t row, col, i;
+    uint32_t row, col, i, col0, colEnd;
 
     // We are going to be using A in transpose. We don't actually take
     // the tranpose, we just access the data according to those rules.
     uint32_t rowsLeft = A->numCols;
     uint32_t colsLeft = A->numRows;
+    uint32_t s = B->numCols;
 
     if((colsLeft != B->numRows) || (rowsLeft != C->numRows) || (B->numCols != C->numCols))
         return FALSE;
 
-    /// TODO: there is some potential for optimization here reqarding computating of data indices
-    for(row = 0; row < rowsLeft; row++ )
+    // The result is accumulated in place, so it starts at zero
+    memset(C->data, 0, sizeof(double)*rowsLeft*s);
+
+    // Row i of A and row i of B together contribute an outer product to C,
+    // so both are read contiguously. Blocking the columns keeps the part of C
+    // being updated in cache.
+    for(col0 = 0; col0 < s; col0 += MATRIX_BLOCK)
     {
-        for(col = 0; col < B->numCols; col++)
+        colEnd = MIN(col0 + MATRIX_BLOCK, s);
+
+        for(i = 0; i < colsLeft; i++)
         {
-            // Initialize the summation
-            double result = 0.0;
+            const double* pA = A->data + i*rowsLeft;
+            const double* pB = B->data + i*s;
 
-            for(i = 0; i < colsLeft; i++)
+            for(row = 0; row < rowsLeft; row++)
             {
-                // continue summation, notice how we access A's data in
-                // transpose by reverseing the row and column indices
-                result += get(A, i, row)*get(B, i, col);
+                const double a = pA[row];
+                double* pC = C->data + row*s;
 
-            }// for the inner dimension
+                for(col = col0; col < colEnd; col++)
+                    pC[col] += a*pB[col];
 
-            set(C, row, col, result);
+            }// for all rows of the result matrix
 
-        }// for all columns of the result matrix
+        }// for the inner dimension
 
-    }// for all rows of the result matrix
+    }// for all blocks of result columns
 
     return TRUE;
 
@@ -1153,7 +1238,7 @@ BOOL matrixMultiplyTransA(const Matrix_t* A, const Matrix_t* B, Matrix_t* C)
  */
 BOOL matrixMultiplyTransB(const Matrix_t* A, const Matrix_t* B, Matrix_t* C)
 {
-    uint32_t row, col, i;
+    uint32_t row, col, i, col0, colEnd;
 
     // We are going to be using B in transpose. We don't actually take
     // the tranpose, we just access the data according to those rules.
@@ -1163,27 +1248,35 @@ BOOL matrixMultiplyTransB(const Matrix_t* A, const Matrix_t* B, Matrix_t* C)
     if((A->numCols != rowsRight) || (A->numRows != C->numRows) || (colsRight != C->numCols))
         return FALSE;
 
-    /// TODO: there is some potential for optimization here reqarding computating of data indices
-    for(row = 0; row < A->numRows; row++ )
+    // Every element is the dot product of a row of A with a row of B, both
+    // contiguous. Blocking the rows of B keeps them in cache while every
+    // row of A passes over them.
+    for(col0 = 0; col0 < colsRight; col0 += MATRIX_BLOCK)
     {
-        for(col = 0; col < colsRight; col++)
+        colEnd = MIN(col0 + MATRIX_BLOCK, colsRight);
+
+        for(row = 0; row < A->numRows; row++)
         {
-            // Initialize the summation
-            double result = 0.0;
+            const double* pA = A->data + row*rowsRight;
+            double* pC = C->data + row*colsRight;
 
-            for(i = 0; i < A->numCols; i++)
+            for(col = col0; col < colEnd; col++)
             {
-                // continue summation, notice how we access B's data in
-                // transpose by reverseing the row and column indices
-                result += get(A, row, i)*get(B, col, i);
+                const double* pB = B->data + col*rowsRight;
 
-            }// for the inner dimension
+                // Initialize the summation
+                double result = 0.0;
 
-            set(C, row, col, result);
+                for(i = 0; i < rowsRight; i++)
+                    result += pA[i]*pB[i];
 
-        }// for all columns of the result matrix
+                pC[col] = result;
 
-    }// for all rows of the result matrix
+            }// for all columns of the result matrix in this block
+
+        }// for all rows of the result matrix
+
+    }// for all blocks of result columns
 
     return TRUE;
 
@@ -1513,9 +1606,10 @@ BOOL matrixTranspose(const Matrix_t* A, Matrix_t* B)
 }// matrixTranspose
 
 
-/*! Calculate the inverse of a square matrix A, for dimensions 1x1, 2x2, or
- *  3x3. The A and B matrices must have the same dimensions. A and B can point
- *  to the same matrix.
+/*! Calculate the inverse of a square matrix A. Dimensions 1x1, 2x2, and 3x3
+ *  use closed form solutions, larger matrices use Gauss-Jordan elimination
+ *  with partial pivoting. The A and B matrices must have the same dimensions.
+ *  A and B can point to the same matrix.
  * \param A is the matrix to take an inverse of.
  * \param B receives the inverse of A.
  * \return TRUE if the matrix dimensions are compatible and A is non-singular.
@@ -1543,7 +1637,9 @@ BOOL matrixInverse(const Matrix_t* A, Matrix_t* B)
         return matrixInverse3x3(A, B);
 
     default:
-        return FALSE;
+        if(B->data != A->data)
+            memcpy(B->data, A->data, sizeof(double)*A->numRows*A->numCols);
+        return matrixInverseGaussJordan(B);
 
     }// switch on size
 
@@ -1632,6 +1728,442 @@ BOOL matrixInverse3x3(const Matrix_t* A, Matrix_t* B)
 }// matrixInverse3x3
 
 
+/*! Calculate the inverse of a square matrix of any size in place, by Gauss-
+ *  Jordan elimination with partial pivoting.
+ * \param B is the matrix to invert, which receives its inverse.
+ * \return TRUE if B is non-singular, else FALSE in which case B is garbage.
+ */
+BOOL matrixInverseGaussJordan(Matrix_t* B)
+{
+    uint32_t pivotStack[MATRIX_PIVOT_STACK];
+    uint32_t n = B->numRows;
+    uint32_t* pivot = pivotStack;
+    uint32_t row, col, j, k;
+    BOOL result = TRUE;
+
+    // Large matrices need somewhere else to record their row swaps
+    if(n > MATRIX_PIVOT_STACK)
+    {
+        pivot = (uint32_t*)linearAllocatorAlloc(NULL, sizeof(uint32_t)*n);
+        if(pivot == NULL)
+            return FALSE;
+    }
+
+    for(col = 0; col < n; col++)
+    {
+        double* pPivot;
+        double big = 0.0, scale;
+
+        // Find the largest remaining element in this column
+        k = col;
+        for(row = col; row < n; row++)
+        {
+            if(fabs(get(B, row, col)) > big)
+            {
+                big = fabs(get(B, row, col));
+                k = row;
+            }
+        }
+
+        if(big == 0.0)
+        {
+            result = FALSE;
+            break;
+        }
+
+        // Swap it into the pivot position
+        pivot[col] = k;
+        if(k != col)
+        {
+            double* pA = B->data + k*n;
+            double* pB = B->data + col*n;
+            for(j = 0; j < n; j++)
+            {
+                double temp = pA[j];
+                pA[j] = pB[j];
+                pB[j] = temp;
+            }
+        }
+
+        // Scale the pivot row, the pivot element takes the place of the
+        // identity column that it is eliminated against
+        pPivot = B->data + col*n;
+        scale = 1.0/pPivot[col];
+        pPivot[col] = 1.0;
+        for(j = 0; j < n; j++)
+            pPivot[j] *= scale;
+
+        // Eliminate this column from every other row
+        for(row = 0; row < n; row++)
+        {
+            double* pRow = B->data + row*n;
+            double factor;
+
+            if(row == col)
+                continue;
+
+            factor = pRow[col];
+            pRow[col] = 0.0;
+            for(j = 0; j < n; j++)
+                pRow[j] -= factor*pPivot[j];
+        }
+
+    }// for all columns
+
+    // Undo the row swaps by swapping columns in reverse order
+    if(result)
+    {
+        for(col = n; col-- > 0;)
+        {
+            if(pivot[col] == col)
+                continue;
+
+            for(row = 0; row < n; row++)
+            {
+                double* pRow = B->data + row*n;
+                double temp = pRow[col];
+                pRow[col] = pRow[pivot[col]];
+                pRow[pivot[col]] = temp;
+            }
+        }
+    }
+
+    if(pivot != pivotStack)
+        linearAllocatorFree(NULL, pivot);
+
+    return result;
+
+}// matrixInverseGaussJordan
+
+
+/*! Compute the Cholesky decomposition A = L x L^T of a symmetric positive
+ *  definite matrix. Only the lower triangle of A is used. A and L can point to
+ *  the same matrix.
+ * \param A is the n by n symmetric positive definite matrix to decompose.
+ * \param L receives the lower triangular factor, with zeroes above the diagonal.
+ * \return TRUE if the dimensions are compatible and A is positive definite, else FALSE.
+ */
+BOOL matrixCholesky(const Matrix_t* A, Matrix_t* L)
+{
+    uint32_t n = A->numRows;
+    uint32_t row, col, k;
+
+    if((A->numRows != A->numCols) || (L->numRows != n) || (L->numCols != n))
+        return FALSE;
+
+    for(col = 0; col < n; col++)
+    {
+        const double* pCol = L->data + col*n;
+        double sum = get(A, col, col);
+
+        // Diagonal element, which must be positive
+        for(k = 0; k < col; k++)
+            sum -= pCol[k]*pCol[k];
+
+        if(sum <= 0.0)
+            return FALSE;
+
+        set(L, col, col, sqrt(sum));
+
+        // Everything below the diagonal in this column. The previous columns
+        // of both rows are already final, and contiguous.
+        for(row = col + 1; row < n; row++)
+        {
+            const double* pRow = L->data + row*n;
+
+            sum = get(A, row, col);
+            for(k = 0; k < col; k++)
+                sum -= pRow[k]*pCol[k];
+
+            set(L, row, col, sum/pCol[col]);
+        }
+
+    }// for all columns
+
+    // Clear the upper triangle, which may still hold A
+    for(row = 0; row < n; row++)
+        for(col = row + 1; col < n; col++)
+            set(L, row, col, 0.0);
+
+    return TRUE;
+
+}// matrixCholesky
+
+
+/*! Solve A x X = B for X, given the Cholesky factor L of A
+ * \param L is the n by n lower triangular factor from matrixCholesky().
+ * \param B is the n by s right hand side.
+ * \param X receives the n by s solution. X and B can point to the same matrix.
+ * \return TRUE if the dimensions are compatible, else FALSE.
+ */
+BOOL matrixCholeskySolve(const Matrix_t* L, const Matrix_t* B, Matrix_t* X)
+{
+    uint32_t n = L->numRows, s = B->numCols;
+    uint32_t row, k, j;
+
+    if((L->numCols != n) || (B->numRows != n) || (X->numRows != n) || (X->numCols != s))
+        return FALSE;
+
+    if(X->data != B->data)
+        memcpy(X->data, B->data, sizeof(double)*n*s);
+
+    // Forward substitution L x Y = B, whole rows at a time
+    for(row = 0; row < n; row++)
+    {
+        double* pX = X->data + row*s;
+        double scale;
+
+        for(k = 0; k < row; k++)
+        {
+            const double factor = get(L, row, k);
+            const double* pY = X->data + k*s;
+            for(j = 0; j < s; j++)
+                pX[j] -= factor*pY[j];
+        }
+
+        scale = 1.0/get(L, row, row);
+        for(j = 0; j < s; j++)
+            pX[j] *= scale;
+    }
+
+    // Back substitution L^T x X = Y
+    for(row = n; row-- > 0;)
+    {
+        double* pX = X->data + row*s;
+        double scale;
+
+        for(k = row + 1; k < n; k++)
+        {
+            const double factor = get(L, k, row);
+            const double* pY = X->data + k*s;
+            for(j = 0; j < s; j++)
+                pX[j] -= factor*pY[j];
+        }
+
+        scale = 1.0/get(L, row, row);
+        for(j = 0; j < s; j++)
+            pX[j] *= scale;
+    }
+
+    return TRUE;
+
+}// matrixCholeskySolve
+
+
+/*! Compute the LU decomposition of a square matrix with partial pivoting, so
+ *  that P x A = L x U. L has a unit diagonal which is not stored. A and LU can
+ *  point to the same matrix.
+ * \param A is the n by n matrix to decompose.
+ * \param LU receives L below the diagonal and U on and above the diagonal.
+ * \param pivot receives n row indices. Row i was swapped with row pivot[i]
+ *        when eliminating column i.
+ * \return TRUE if the dimensions are compatible and A is non-singular, else FALSE.
+ */
+BOOL matrixLUDecompose(const Matrix_t* A, Matrix_t* LU, uint32_t pivot[])
+{
+    uint32_t n = A->numRows;
+    uint32_t row, col, j, k;
+
+    if((A->numRows != A->numCols) || (LU->numRows != n) || (LU->numCols != n))
+        return FALSE;
+
+    if(LU->data != A->data)
+        memcpy(LU->data, A->data, sizeof(double)*n*n);
+
+    for(col = 0; col < n; col++)
+    {
+        const double* pPivot;
+        double big = 0.0, scale;
+
+        // Find the largest remaining element in this column
+        k = col;
+        for(row = col; row < n; row++)
+        {
+            if(fabs(get(LU, row, col)) > big)
+            {
+                big = fabs(get(LU, row, col));
+                k = row;
+            }
+        }
+
+        if(big == 0.0)
+            return FALSE;
+
+        // Swap it into the pivot position
+        pivot[col] = k;
+        if(k != col)
+        {
+            double* pA = LU->data + k*n;
+            double* pB = LU->data + col*n;
+            for(j = 0; j < n; j++)
+            {
+                double temp = pA[j];
+                pA[j] = pB[j];
+                pB[j] = temp;
+            }
+        }
+
+        // Eliminate below the pivot, keeping the multipliers as L
+        pPivot = LU->data + col*n;
+        scale = 1.0/pPivot[col];
+        for(row = col + 1; row < n; row++)
+        {
+            double* pRow = LU->data + row*n;
+            const double factor = pRow[col]*scale;
+
+            pRow[col] = factor;
+            for(j = col + 1; j < n; j++)
+                pRow[j] -= factor*pPivot[j];
+        }
+
+    }// for all columns
+
+    return TRUE;
+
+}// matrixLUDecompose
+
+
+/*! Solve A x X = B for X, given the LU decomposition of A
+ * \param LU is the n by n decomposition from matrixLUDecompose().
+ * \param pivot is the row swaps from matrixLUDecompose().
+ * \param B is the n by s right hand side.
+ * \param X receives the n by s solution. X and B can point to the same matrix.
+ * \return TRUE if the dimensions are compatible, else FALSE.
+ */
+BOOL matrixLUSolve(const Matrix_t* LU, const uint32_t pivot[], const Matrix_t* B, Matrix_t* X)
+{
+    uint32_t n = LU->numRows, s = B->numCols;
+    uint32_t row, k, j;
+
+    if((LU->numCols != n) || (B->numRows != n) || (X->numRows != n) || (X->numCols != s))
+        return FALSE;
+
+    if(X->data != B->data)
+        memcpy(X->data, B->data, sizeof(double)*n*s);
+
+    // Apply the same row swaps to the right hand side
+    for(row = 0; row < n; row++)
+    {
+        if(pivot[row] != row)
+        {
+            double* pA = X->data + row*s;
+            double* pB = X->data + pivot[row]*s;
+            for(j = 0; j < s; j++)
+            {
+                double temp = pA[j];
+                pA[j] = pB[j];
+                pB[j] = temp;
+            }
+        }
+    }
+
+    // Forward substitution L x Y = P x B, L has a unit diagonal
+    for(row = 1; row < n; row++)
+    {
+        double* pX = X->data + row*s;
+
+        for(k = 0; k < row; k++)
+        {
+            const double factor = get(LU, row, k);
+            const double* pY = X->data + k*s;
+            for(j = 0; j < s; j++)
+                pX[j] -= factor*pY[j];
+        }
+    }
+
+    // Back substitution U x X = Y
+    for(row = n; row-- > 0;)
+    {
+        double* pX = X->data + row*s;
+        double scale;
+
+        for(k = row + 1; k < n; k++)
+        {
+            const double factor = get(LU, row, k);
+            const double* pY = X->data + k*s;
+            for(j = 0; j < s; j++)
+                pX[j] -= factor*pY[j];
+        }
+
+        scale = 1.0/get(LU, row, row);
+        for(j = 0; j < s; j++)
+            pX[j] *= scale;
+    }
+
+    return TRUE;
+
+}// matrixLUSolve
+
+
+/*! Propagate a covariance matrix through a linear model, P = F x P x F^T + Q.
+ *  P is assumed symmetric, only the upper triangle of the result is computed
+ *  and it is mirrored into the lower triangle, so the result is exactly
+ *  symmetric.
+ * \param F is the n by n state transition matrix.
+ * \param P is the n by n covariance, which is replaced by the propagated covariance.
+ * \param Q is the n by n process noise to add, which can be NULL.
+ * \param temp is n by n scratch space, which can be NULL in which case it is
+ *        taken from the thread's linear allocator for the duration of the call.
+ * \return TRUE if the dimensions are compatible, else FALSE.
+ */
+BOOL matrixCovarianceUpdate(const Matrix_t* F, Matrix_t* P, const Matrix_t* Q, Matrix_t* temp)
+{
+    uint32_t n = F->numRows;
+    uint32_t row, col, k;
+    Matrix_t scratch;
+
+    if((F->numCols != n) || (P->numRows != n) || (P->numCols != n))
+        return FALSE;
+
+    if((Q != NULL) && ((Q->numRows != n) || (Q->numCols != n)))
+        return FALSE;
+
+    if(temp == NULL)
+    {
+        scratch.numRows = scratch.numCols = n;
+        scratch.data = (double*)linearAllocatorAlloc(NULL, sizeof(double)*n*n);
+        if(scratch.data == NULL)
+            return FALSE;
+    }
+    else if((temp->numRows != n) || (temp->numCols != n) || (temp->data == P->data))
+        return FALSE;
+    else
+        scratch = *temp;
+
+    // First F x P, which is the only full size temporary
+    matrixMultiply(F, P, &scratch);
+
+    // Then (F x P) x F^T, which is symmetric, so only the upper triangle is
+    // computed. Both operands are read along contiguous rows.
+    for(row = 0; row < n; row++)
+    {
+        const double* pFP = scratch.data + row*n;
+
+        for(col = row; col < n; col++)
+        {
+            const double* pF = F->data + col*n;
+            double sum = 0.0;
+
+            for(k = 0; k < n; k++)
+                sum += pFP[k]*pF[k];
+
+            if(Q != NULL)
+                sum += get(Q, row, col);
+
+            set(P, row, col, sum);
+            set(P, col, row, sum);
+        }
+
+    }// for all rows
+
+    if(temp == NULL)
+        linearAllocatorFree(NULL, scratch.data);
+
+    return TRUE;
+
+}// matrixCovarianceUpdate
+
+
 /*!
  * Test for identity by returning the sum of the absolute differences between
  * a Matrix and an identity matrix of the same dimensions.
@@ -1681,6 +2213,132 @@ double testForZeroMatrix(const Matrix_t* M)
 }
 
 
+//! Worst element wise error that testMatrixSolvers() allows in its residuals
+#define LINEAR_ALGEBRA_TOLERANCE 1e-9
+
+/*!
+ * Find the largest element wise difference between two matrices
+ * \param A is the first matrix
+ * \param B is the second matrix, which must have the same dimensions as A
+ * \return the largest absolute difference between A and B
+ */
+static double worstDifference(const Matrix_t* A, const Matrix_t* B)
+{
+    uint32_t i;
+    double worst = 0.0;
+
+    for(i = 0; i < A->numRows*A->numCols; i++)
+    {
+        double error = fabs(A->data[i] - B->data[i]);
+        if(error > worst)
+            worst = error;
+    }
+
+    return worst;
+
+}// worstDifference
+
+
+/*!
+ * Check the factorizations, solves and inverses against their definitions on
+ * fixed, well conditioned matrices: L x L^T against A for the Cholesky factor,
+ * A x X against B for both solvers, A x inverse against identity for the closed
+ * form and Gauss-Jordan inverses, and the covariance update against F x P x F^T
+ * + Q. Also checks that singular input is rejected by the inverse and the LU
+ * decomposition, and that input which is not positive definite is rejected by
+ * the Cholesky decomposition.
+ * \return the number of checks that failed, 0 if they all passed
+ */
+int testMatrixSolvers(void)
+{
+    stackAllocateMatrix(G, 5, 5);
+    stackAllocateMatrix(A, 5, 5);
+    stackAllocateMatrix(I, 5, 5);
+    stackAllocateMatrix(L, 5, 5);
+    stackAllocateMatrix(T, 5, 5);
+    stackAllocateMatrix(P, 5, 5);
+    stackAllocateMatrix(B, 5, 2);
+    stackAllocateMatrix(X, 5, 2);
+    stackAllocateMatrix(R, 5, 2);
+    stackAllocateMatrix(G3, 3, 3);
+    stackAllocateMatrix(T3, 3, 3);
+    stackAllocateMatrix(I3, 3, 3);
+    uint32_t pivot[5];
+    uint32_t row, col;
+    int failures = 0;
+
+    // A general matrix G which needs pivoting, and a symmetric positive definite A = G x G^T + I
+    for(row = 0; row < 5; row++)
+    {
+        for(col = 0; col < 5; col++)
+            matrixSet(&G, row, col, cos(1.3*row + 0.7*col*col) + ((row == 4 - col) ? 3.0 : 0.0));
+
+        matrixSet(&B, row, 0, row + 1.0);
+        matrixSet(&B, row, 1, sin(row + 1.0));
+    }
+
+    matrixMultiplyTransB(&G, &G, &A);
+    matrixAddIdentity(&A);
+    matrixSetIdentity(&I);
+
+    // Cholesky factor and solve
+    if(!matrixCholesky(&A, &L) || !matrixMultiplyTransB(&L, &L, &T) || (worstDifference(&T, &A) > LINEAR_ALGEBRA_TOLERANCE))
+        failures++;
+
+    if(!matrixCholeskySolve(&L, &B, &X) || !matrixMultiply(&A, &X, &R) || (worstDifference(&R, &B) > LINEAR_ALGEBRA_TOLERANCE))
+        failures++;
+
+    // LU decomposition and solve
+    if(!matrixLUDecompose(&G, &T, pivot) || !matrixLUSolve(&T, pivot, &B, &X) || !matrixMultiply(&G, &X, &R) ||
+       (worstDifference(&R, &B) > LINEAR_ALGEBRA_TOLERANCE))
+        failures++;
+
+    // Gauss-Jordan inverse
+    if(!matrixInverse(&G, &T) || !matrixMultiply(&G, &T, &P) || (testForIdentity(&P) > LINEAR_ALGEBRA_TOLERANCE))
+        failures++;
+
+    // Closed form inverse
+    for(row = 0; row < 3; row++)
+        for(col = 0; col < 3; col++)
+            matrixSet(&G3, row, col, matrixGet(&G, row, col));
+
+    if(!matrixInverse(&G3, &T3) || !matrixMultiply(&G3, &T3, &I3) || (testForIdentity(&I3) > LINEAR_ALGEBRA_TOLERANCE))
+        failures++;
+
+    // Covariance update against the explicit products
+    matrixMultiply(&G, &A, &T);
+    matrixMultiplyTransB(&T, &G, &L);
+    matrixAddIdentity(&L);
+    matrixCopy(&A, &P);
+    if(!matrixCovarianceUpdate(&G, &P, &I, NULL) || (worstDifference(&P, &L) > LINEAR_ALGEBRA_TOLERANCE))
+        failures++;
+
+    // A zero column makes G singular, exactly, for every method
+    for(row = 0; row < 5; row++)
+        matrixSet(&G, row, 2, 0.0);
+
+    if(matrixInverse(&G, &T) || matrixLUDecompose(&G, &T, pivot))
+        failures++;
+
+    for(row = 0; row < 3; row++)
+        matrixSet(&G3, row, 1, 0.0);
+
+    if(matrixInverse(&G3, &T3))
+        failures++;
+
+    // Symmetric, but its second pivot is exactly zero so it is not positive definite
+    matrixSet(&T3, 0, 0, 4.0); matrixSet(&T3, 0, 1, 2.0); matrixSet(&T3, 0, 2, 0.0);
+    matrixSet(&T3, 1, 0, 2.0); matrixSet(&T3, 1, 1, 1.0); matrixSet(&T3, 1, 2, 3.0);
+    matrixSet(&T3, 2, 0, 0.0); matrixSet(&T3, 2, 1, 3.0); matrixSet(&T3, 2, 2, 1.0);
+
+    if(matrixCholesky(&T3, &I3))
+        failures++;
+
+    return failures;
+
+}// testMatrixSolvers
+
+
 /*!
  * Evaluate the derivative of quadratic equation at x
  * \param cba is the c, b, and a coeficients in the equation y = ax^2 + bx + c.
@@ -2143,15 +2801,17 @@ Vectorf_t* vectorSetAllf(Vectorf_t* V, float value)
 /*!
  * Allocate a vector, initializing its memory. The memory will be allocated
  * in a single step so all of the vector's memory can be released by calling
- * free(vector). The vector will initially be zero.
+ * free(vector), or linearAllocatorFree() if it came from another allocator.
+ * The vector will initially be zero.
+ * \param pAllocator is the allocator to use, or NULL for the one set by linearAllocatorSet().
  * \param num is the number of elements of the vector.
  * \return a pointer to the newly allocated matrix, or
  *         NULL if the allocation failed.
  */
-Vectorf_t* vectorAllocatef(uint32_t num)
+Vectorf_t* vectorAllocatefWith(LinearAllocator_t* pAllocator, uint32_t num)
 {
     // Allocate memory for the structure and data
-    Vectorf_t* V = (Vectorf_t*)malloc(sizeof(Vectorf_t) + sizeof(float)*num);
+    Vectorf_t* V = (Vectorf_t*)linearAllocatorAlloc(pAllocator, sizeof(Vectorf_t) + sizeof(float)*num);
 
     // We choose this funky allocation method because it is now possible to
     // free(V) without worrying about separately freeing the data pointer. So
@@ -2176,21 +2836,34 @@ Vectorf_t* vectorAllocatef(uint32_t num)
 
     return V;
 
-}// vectorAllocate
+}// vectorAllocatefWith
+
+
+/*!
+ * Allocate a vector using the allocator set by linearAllocatorSet(), which is
+ * the heap by default. See vectorAllocatefWith().
+ */
+Vectorf_t* vectorAllocatef(uint32_t num)
+{
+    return vectorAllocatefWith(NULL, num);
+
+}// vectorAllocatef
 
 
 /*!
  * Change the size of a dynamically allocated vector. This can only be used
- * with vectors that were created using vectorAllocate().
+ * with vectors that were created using vectorAllocatef() or vectorAllocatefWith(),
+ * using the same allocator.
+ * \param pAllocator is the allocator to use, or NULL for the one set by linearAllocatorSet().
  * \param v is the vector whose size will be changed.
  * \param num is the new size of the vector.
  * \param initial is the value given to the new elements of vector if it's size is being increased.
  * \return The new pointer to the vector, or null if the reallocation failed.
  */
-Vectorf_t* vectorChangeAllocateSizef(Vectorf_t* v, uint32_t num, float initial)
+Vectorf_t* vectorChangeAllocateSizefWith(LinearAllocator_t* pAllocator, Vectorf_t* v, uint32_t num, float initial)
 {
     // Re-allocate memory for the structure and data.
-    Vectorf_t* V = (Vectorf_t*)realloc(v, sizeof(Vectorf_t) + sizeof(float)*num);
+    Vectorf_t* V = (Vectorf_t*)linearAllocatorRealloc(pAllocator, v, (v != NULL) ? sizeof(Vectorf_t) + sizeof(float)*v->num : 0, sizeof(Vectorf_t) + sizeof(float)*num);
 
     // We choose this funky allocation method because it is now possible to
     // free(V) without worrying about separately freeing the data pointer. So
@@ -2211,6 +2884,17 @@ Vectorf_t* vectorChangeAllocateSizef(Vectorf_t* v, uint32_t num, float initial)
 
     return V;
 
+}// vectorChangeAllocateSizefWith
+
+
+/*!
+ * Change the size of a vector using the allocator set by linearAllocatorSet(), which is
+ * the heap by default. See vectorChangeAllocateSizefWith().
+ */
+Vectorf_t* vectorChangeAllocateSizef(Vectorf_t* v, uint32_t num, float initial)
+{
+    return vectorChangeAllocateSizefWith(NULL, v, num, initial);
+
 }// vectorChangeAllocateSizef
 
 
@@ -2511,6 +3195,9 @@ static BOOL matrixInverse2x2f(const Matrixf_t* A, Matrixf_t* B);
 //! Invert a 3x3 matrix
 static BOOL matrixInverse3x3f(const Matrixf_t* A, Matrixf_t* B);
 
+//! Calculate the inverse of a square matrix of any size in place
+static BOOL matrixInverseGaussJordanf(Matrixf_t* B);
+
 
 /*!
  * Get a specific element of a matrix
@@ -2553,16 +3240,18 @@ void matrixAddToElementf(Matrixf_t* M, uint32_t row, uint32_t col, float value)
 
 /*! Allocate a matrix, initializing its memory. The memory will be allocated
  * in a single step so all of the matrix's memory can be released by calling
- * free(matrix). The matrix will initially be zero.
+ * free(matrix), or linearAllocatorFree() if it came from another allocator.
+ * The matrix will initially be zero.
+ * \param pAllocator is the allocator to use, or NULL for the one set by linearAllocatorSet().
  * \param rows is the number of rows of the matrix.
  * \param cols is the number of columns of the matrix.
  * \return a pointer to the newly allocated matrix, or
  *         NULL if the allocation failed.
  */
-Matrixf_t* matrixAllocatef(uint32_t rows, uint32_t cols)
+Matrixf_t* matrixAllocatefWith(LinearAllocator_t* pAllocator, uint32_t rows, uint32_t cols)
 {
     // Allocate memory for the structure and data
-    Matrixf_t* M = (Matrixf_t*)malloc(sizeof(Matrixf_t) + sizeof(float)*rows*cols);
+    Matrixf_t* M = (Matrixf_t*)linearAllocatorAlloc(pAllocator, sizeof(Matrixf_t) + sizeof(float)*rows*cols);
 
     // We choose this funky allocation method because it is now possible to
     // free(M) without worrying about separately freeing the data pointer. So
@@ -2588,12 +3277,25 @@ Matrixf_t* matrixAllocatef(uint32_t rows, uint32_t cols)
 
     return M;
 
-}// matrixAllocate
+}// matrixAllocatefWith
+
+
+/*!
+ * Allocate a matrix using the allocator set by linearAllocatorSet(), which is
+ * the heap by default. See matrixAllocatefWith().
+ */
+Matrixf_t* matrixAllocatef(uint32_t rows, uint32_t cols)
+{
+    return matrixAllocatefWith(NULL, rows, cols);
+
+}// matrixAllocatef
 
 
 /*!
  * Change the size of a dynamically allocated matrix. This applies only to
- * matrix allocated via matrixAllocatef().
+ * matrix allocated via matrixAllocatef() or matrixAllocatefWith(),
+ * using the same allocator.
+ * \param pAllocator is the allocator to use, or NULL for the one set by linearAllocatorSet().
  * \param M is the matrix whose size will be changed.
  * \param rows is the new number of rows.
  * \param cols is the new number of columns.
@@ -2601,10 +3303,10 @@ Matrixf_t* matrixAllocatef(uint32_t rows, uint32_t cols)
  *        of rows or columns are being increased.
  * \return The reallocated matrix or null if the reallocation failed
  */
-Matrixf_t* matrixChangeAllocateSizef(Matrixf_t* oldM, uint32_t rows, uint32_t cols, float initial)
+Matrixf_t* matrixChangeAllocateSizefWith(LinearAllocator_t* pAllocator, Matrixf_t* oldM, uint32_t rows, uint32_t cols, float initial)
 {
     // Realllocate memory for the structure and data
-    Matrixf_t* M = (Matrixf_t*)realloc(oldM, sizeof(Matrixf_t) + sizeof(float)*rows*cols);
+    Matrixf_t* M = (Matrixf_t*)linearAllocatorRealloc(pAllocator, oldM, (oldM != NULL) ? sizeof(Matrixf_t) + sizeof(float)*oldM->numRows*oldM->numCols : 0, sizeof(Matrixf_t) + sizeof(float)*rows*cols);
 
     // We choose this funky allocation method because it is now possible to
     // free(M) without worrying about separately freeing the data pointer. So
@@ -2625,6 +3327,17 @@ Matrixf_t* matrixChangeAllocateSizef(Matrixf_t* oldM, uint32_t rows, uint32_t co
 
     return M;
 
+}// matrixChangeAllocateSizefWith
+
+
+/*!
+ * Change the size of a matrix using the allocator set by linearAllocatorSet(), which is
+ * the heap by default. See matrixChangeAllocateSizefWith().
+ */
+Matrixf_t* matrixChangeAllocateSizef(Matrixf_t* oldM, uint32_t rows, uint32_t cols, float initial)
+{
+    return matrixChangeAllocateSizefWith(NULL, oldM, rows, cols, initial);
+
 }// matrixChangeAllocateSizef
 
 
@@ -2803,7 +3516,8 @@ void matrixSetColumnf(Matrixf_t* M, uint32_t col, float value)
  */
 BOOL matrixMultiplyf(const Matrixf_t* A, const Matrixf_t* B, Matrixf_t* C)
 {
-    uint32_t row, col, i;
+    uint32_t row, col, i, col0, i0, colEnd, iEnd;
+    uint32_t m = A->numRows, n = A->numCols, s = B->numCols;
 
     // When multiplying matrices A x B = C we must satisfy the following dimensions:
     // A = m by n    // m rows by n columns
@@ -2813,26 +3527,41 @@ BOOL matrixMultiplyf(const Matrixf_t* A, const Matrixf_t* B, Matrixf_t* C)
     if((A->numCols != B->numRows) || (A->numRows != C->numRows) || (B->numCols != C->numCols))
         return FALSE;
 
-    /// TODO: there is some potential for optimization here reqarding computing of data indices
-    for(row = 0; row < A->numRows; row++ )
+    // The result is accumulated in place, so it starts at zero
+    memset(C->data, 0, sizeof(float)*m*s);
+
+    // Walk B in blocks small enough to stay in cache while every row of A
+    // passes over them. The inner loop runs along contiguous rows of B and C,
+    // which the compiler can vectorize. Each element still sums over the inner
+    // dimension in ascending order, so the result matches the simple loop.
+    for(col0 = 0; col0 < s; col0 += MATRIX_BLOCK)
     {
-        for(col = 0; col < B->numCols; col++)
+        colEnd = MIN(col0 + MATRIX_BLOCK, s);
+
+        for(i0 = 0; i0 < n; i0 += MATRIX_BLOCK)
         {
-            // Initialize the summation
-            float result = 0.0f;
+            iEnd = MIN(i0 + MATRIX_BLOCK, n);
 
-            for(i = 0; i < A->numCols; i++)
+            for(row = 0; row < m; row++)
             {
-                // continue summation
-                result += get(A, row, i)*get(B, i, col);
+                const float* pA = A->data + row*n;
+                float* pC = C->data + row*s;
+
+                for(i = i0; i < iEnd; i++)
+                {
+                    const float a = pA[i];
+                    const float* pB = B->data + i*s;
 
-            }// for the inner dimension
+                    for(col = col0; col < colEnd; col++)
+                        pC[col] += a*pB[col];
 
-            set(C, row, col, result);
+                }// for the inner dimension in this block
 
-        }// for all columns of the result matrix
+            }// for all rows of the result matrix
 
-    }// for all rows of the result matrix
+        }// for all blocks of the inner dimension
+
+    }// for all blocks of result columns
 
     return TRUE;
 
@@ -2848,37 +3577,45 @@ BOOL matrixMultiplyf(const Matrixf_t* A, const Matrixf_t* B, Matrixf_t* C)
  */
 BOOL matrixMultiplyTransAf(const Matrixf_t* A, const Matrixf_t* B, Matrixf_t* C)
 {
-    uint32_t row, col, i;
+    uint32_t row, col, i, col0, colEnd;
 
     // We are going to be using A in transpose. We don't actually take
     // the tranpose, we just access the data according to those rules.
     uint32_t rowsLeft = A->numCols;
     uint32_t colsLeft = A->numRows;
+    uint32_t s = B->numCols;
 
     if((colsLeft != B->numRows) || (rowsLeft != C->numRows) || (B->numCols != C->numCols))
         return FALSE;
 
-    /// TODO: there is some potential for optimization here reqarding computating of data indices
-    for(row = 0; row < rowsLeft; row++ )
+    // The result is accumulated in place, so it starts at zero
+    memset(C->data, 0, sizeof(float)*rowsLeft*s);
+
+    // Row i of A and row i of B together contribute an outer product to C,
+    // so both are read contiguously. Blocking the columns keeps the part of C
+    // being updated in cache.
+    for(col0 = 0; col0 < s; col0 += MATRIX_BLOCK)
     {
-        for(col = 0; col < B->numCols; col++)
+        colEnd = MIN(col0 + MATRIX_BLOCK, s);
+
+        for(i = 0; i < colsLeft; i++)
         {
-            // Initialize the summation
-            float result = 0.0f;
+            const float* pA = A->data + i*rowsLeft;
+            const float* pB = B->data + i*s;
 
-            for(i = 0; i < colsLeft; i++)
+            for(row = 0; row < rowsLeft; row++)
             {
-                // continue summation, notice how we access A's data in
-                // transpose by reverseing the row and column indices
-                result += get(A, i, row)*get(B, i, col);
+                const float a = pA[row];
+                float* pC = C->data + row*s;
 
-            }// for the inner dimension
+                for(col = col0; col < colEnd; col++)
+                    pC[col] += a*pB[col];
 
-            set(C, row, col, result);
+            }// for all rows of the result matrix
 
-        }// for all columns of the result matrix
+        }// for the inner dimension
 
-    }// for all rows of the result matrix
+    }// for all blocks of result columns
 
     return TRUE;
 
@@ -2894,7 +3631,7 @@ BOOL matrixMultiplyTransAf(const Matrixf_t* A, const Matrixf_t* B, Matrixf_t* C)
  */
 BOOL matrixMultiplyTransBf(const Matrixf_t* A, const Matrixf_t* B, Matrixf_t* C)
 {
-    uint32_t row, col, i;
+    uint32_t row, col, i, col0, colEnd;
 
     // We are going to be using B in transpose. We don't actually take
     // the tranpose, we just access the data according to those rules.
@@ -2904,27 +3641,35 @@ BOOL matrixMultiplyTransBf(const Matrixf_t* A, const Matrixf_t* B, Matrixf_t* C)
     if((A->numCols != rowsRight) || (A->numRows != C->numRows) || (colsRight != C->numCols))
         return FALSE;
 
-    /// TODO: there is some potential for optimization here reqarding computating of data indices
-    for(row = 0; row < A->numRows; row++ )
+    // Every element is the dot product of a row of A with a row of B, both
+    // contiguous. Blocking the rows of B keeps them in cache while every
+    // row of A passes over them.
+    for(col0 = 0; col0 < colsRight; col0 += MATRIX_BLOCK)
     {
-        for(col = 0; col < colsRight; col++)
+        colEnd = MIN(col0 + MATRIX_BLOCK, colsRight);
+
+        for(row = 0; row < A->numRows; row++)
         {
-            // Initialize the summation
-            float result = 0.0f;
+            const float* pA = A->data + row*rowsRight;
+            float* pC = C->data + row*colsRight;
 
-            for(i = 0; i < A->numCols; i++)
+            for(col = col0; col < colEnd; col++)
             {
-                // continue summation, notice how we access B's data in
-                // transpose by reverseing the row and column indices
-                result += get(A, row, i)*get(B, col, i);
+                const float* pB = B->data + col*rowsRight;
 
-            }// for the inner dimension
+                // Initialize the summation
+                float result = 0.0f;
 
-            set(C, row, col, result);
+                for(i = 0; i < rowsRight; i++)
+                    result += pA[i]*pB[i];
 
-        }// for all columns of the result matrix
+                pC[col] = result;
 
-    }// for all rows of the result matrix
+            }// for all columns of the result matrix in this block
+
+        }// for all rows of the result matrix
+
+    }// for all blocks of result columns
 
     return TRUE;
 
@@ -3254,9 +3999,10 @@ BOOL matrixTransposef(const Matrixf_t* A, Matrixf_t* B)
 }// matrixTransposef
 
 
-/*! Calculate the inverse of a square matrix A, for dimensions 1x1, 2x2, or
- *  3x3. The A and B matrices must have the same dimensions. A and B can point
- *  to the same matrix.
+/*! Calculate the inverse of a square matrix A. Dimensions 1x1, 2x2, and 3x3
+ *  use closed form solutions, larger matrices use Gauss-Jordan elimination
+ *  with partial pivoting. The A and B matrices must have the same dimensions.
+ *  A and B can point to the same matrix.
  * \param A is the matrix to take an inverse of.
  * \param B receives the inverse of A.
  * \return TRUE if the matrix dimensions are compatible and A is non-singular.
@@ -3284,7 +4030,9 @@ BOOL matrixInversef(const Matrixf_t* A, Matrixf_t* B)
         return matrixInverse3x3f(A, B);
 
     default:
-        return FALSE;
+        if(B->data != A->data)
+            memcpy(B->data, A->data, sizeof(float)*A->numRows*A->numCols);
+        return matrixInverseGaussJordanf(B);
 
     }// switch on size
 
@@ -3373,6 +4121,442 @@ BOOL matrixInverse3x3f(const Matrixf_t* A, Matrixf_t* B)
 }// matrixInverse3x3f
 
 
+/*! Calculate the inverse of a square matrix of any size in place, by Gauss-
+ *  Jordan elimination with partial pivoting.
+ * \param B is the matrix to invert, which receives its inverse.
+ * \return TRUE if B is non-singular, else FALSE in which case B is garbage.
+ */
+BOOL matrixInverseGaussJordanf(Matrixf_t* B)
+{
+    uint32_t pivotStack[MATRIX_PIVOT_STACK];
+    uint32_t n = B->numRows;
+    uint32_t* pivot = pivotStack;
+    uint32_t row, col, j, k;
+    BOOL result = TRUE;
+
+    // Large matrices need somewhere else to record their row swaps
+    if(n > MATRIX_PIVOT_STACK)
+    {
+        pivot = (uint32_t*)linearAllocatorAlloc(NULL, sizeof(uint32_t)*n);
+        if(pivot == NULL)
+            return FALSE;
+    }
+
+    for(col = 0; col < n; col++)
+    {
+        float* pPivot;
+        float big = 0.0f, scale;
+
+        // Find the largest remaining element in this column
+        k = col;
+        for(row = col; row < n; row++)
+        {
+            if(fabsf(get(B, row, col)) > big)
+            {
+                big = fabsf(get(B, row, col));
+                k = row;
+            }
+        }
+
+        if(big == 0.0f)
+        {
+            result = FALSE;
+            break;
+        }
+
+        // Swap it into the pivot position
+        pivot[col] = k;
+        if(k != col)
+        {
+            float* pA = B->data + k*n;
+            float* pB = B->data + col*n;
+            for(j = 0; j < n; j++)
+            {
+                float temp = pA[j];
+                pA[j] = pB[j];
+                pB[j] = temp;
+            }
+        }
+
+        // Scale the pivot row, the pivot element takes the place of the
+        // identity column that it is eliminated against
+        pPivot = B->data + col*n;
+        scale = 1.0f/pPivot[col];
+        pPivot[col] = 1.0f;
+        for(j = 0; j < n; j++)
+            pPivot[j] *= scale;
+
+        // Eliminate this column from every other row
+        for(row = 0; row < n; row++)
+        {
+            float* pRow = B->data + row*n;
+            float factor;
+
+            if(row == col)
+                continue;
+
+            factor = pRow[col];
+            pRow[col] = 0.0f;
+            for(j = 0; j < n; j++)
+                pRow[j] -= factor*pPivot[j];
+        }
+
+    }// for all columns
+
+    // Undo the row swaps by swapping columns in reverse order
+    if(result)
+    {
+        for(col = n; col-- > 0;)
+        {
+            if(pivot[col] == col)
+                continue;
+
+            for(row = 0; row < n; row++)
+            {
+                float* pRow = B->data + row*n;
+                float temp = pRow[col];
+                pRow[col] = pRow[pivot[col]];
+                pRow[pivot[col]] = temp;
+            }
+        }
+    }
+
+    if(pivot != pivotStack)
+        linearAllocatorFree(NULL, pivot);
+
+    return result;
+
+}// matrixInverseGaussJordanf
+
+
+/*! Compute the Cholesky decomposition A = L x L^T of a symmetric positive
+ *  definite matrix. Only the lower triangle of A is used. A and L can point to
+ *  the same matrix.
+ * \param A is the n by n symmetric positive definite matrix to decompose.
+ * \param L receives the lower triangular factor, with zeroes above the diagonal.
+ * \return TRUE if the dimensions are compatible and A is positive definite, else FALSE.
+ */
+BOOL matrixCholeskyf(const Matrixf_t* A, Matrixf_t* L)
+{
+    uint32_t n = A->numRows;
+    uint32_t row, col, k;
+
+    if((A->numRows != A->numCols) || (L->numRows != n) || (L->numCols != n))
+        return FALSE;
+
+    for(col = 0; col < n; col++)
+    {
+        const float* pCol = L->data + col*n;
+        float sum = get(A, col, col);
+
+        // Diagonal element, which must be positive
+        for(k = 0; k < col; k++)
+            sum -= pCol[k]*pCol[k];
+
+        if(sum <= 0.0f)
+            return FALSE;
+
+        set(L, col, col, sqrtf(sum));
+
+        // Everything below the diagonal in this column. The previous columns
+        // of both rows are already final, and contiguous.
+        for(row = col + 1; row < n; row++)
+        {
+            const float* pRow = L->data + row*n;
+
+            sum = get(A, row, col);
+            for(k = 0; k < col; k++)
+                sum -= pRow[k]*pCol[k];
+
+            set(L, row, col, sum/pCol[col]);
+        }
+
+    }// for all columns
+
+    // Clear the upper triangle, which may still hold A
+    for(row = 0; row < n; row++)
+        for(col = row + 1; col < n; col++)
+            set(L, row, col, 0.0f);
+
+    return TRUE;
+
+}// matrixCholeskyf
+
+
+/*! Solve A x X = B for X, given the Cholesky factor L of A
+ * \param L is the n by n lower triangular factor from matrixCholeskyf().
+ * \param B is the n by s right hand side.
+ * \param X receives the n by s solution. X and B can point to the same matrix.
+ * \return TRUE if the dimensions are compatible, else FALSE.
+ */
+BOOL matrixCholeskySolvef(const Matrixf_t* L, const Matrixf_t* B, Matrixf_t* X)
+{
+    uint32_t n = L->numRows, s = B->numCols;
+    uint32_t row, k, j;
+
+    if((L->numCols != n) || (B->numRows != n) || (X->numRows != n) || (X->numCols != s))
+        return FALSE;
+
+    if(X->data != B->data)
+        memcpy(X->data, B->data, sizeof(float)*n*s);
+
+    // Forward substitution L x Y = B, whole rows at a time
+    for(row = 0; row < n; row++)
+    {
+        float* pX = X->data + row*s;
+        float scale;
+
+        for(k = 0; k < row; k++)
+        {
+            const float factor = get(L, row, k);
+            const float* pY = X->data + k*s;
+            for(j = 0; j < s; j++)
+                pX[j] -= factor*pY[j];
+        }
+
+        scale = 1.0f/get(L, row, row);
+        for(j = 0; j < s; j++)
+            pX[j] *= scale;
+    }
+
+    // Back substitution L^T x X = Y
+    for(row = n; row-- > 0;)
+    {
+        float* pX = X->data + row*s;
+        float scale;
+
+        for(k = row + 1; k < n; k++)
+        {
+            const float factor = get(L, k, row);
+            const float* pY = X->data + k*s;
+            for(j = 0; j < s; j++)
+                pX[j] -= factor*pY[j];
+        }
+
+        scale = 1.0f/get(L, row, row);
+        for(j = 0; j < s; j++)
+            pX[j] *= scale;
+    }
+
+    return TRUE;
+
+}// matrixCholeskySolvef
+
+
+/*! Compute the LU decomposition of a square matrix with partial pivoting, so
+ *  that P x A = L x U. L has a unit diagonal which is not stored. A and LU can
+ *  point to the same matrix.
+ * \param A is the n by n matrix to decompose.
+ * \param LU receives L below the diagonal and U on and above the diagonal.
+ * \param pivot receives n row indices. Row i was swapped with row pivot[i]
+ *        when eliminating column i.
+ * \return TRUE if the dimensions are compatible and A is non-singular, else FALSE.
+ */
+BOOL matrixLUDecomposef(const Matrixf_t* A, Matrixf_t* LU, uint32_t pivot[])
+{
+    uint32_t n = A->numRows;
+    uint32_t row, col, j, k;
+
+    if((A->numRows != A->numCols) || (LU->numRows != n) || (LU->numCols != n))
+        return FALSE;
+
+    if(LU->data != A->data)
+        memcpy(LU->data, A->data, sizeof(float)*n*n);
+
+    for(col = 0; col < n; col++)
+    {
+        const float* pPivot;
+        float big = 0.0f, scale;
+
+        // Find the largest remaining element in this column
+        k = col;
+        for(row = col; row < n; row++)
+        {
+            if(fabsf(get(LU, row, col)) > big)
+            {
+                big = fabsf(get(LU, row, col));
+                k = row;
+            }
+        }
+
+        if(big == 0.0f)
+            return FALSE;
+
+        // Swap it into the pivot position
+        pivot[col] = k;
+        if(k != col)
+        {
+            float* pA = LU->data + k*n;
+            float* pB = LU->data + col*n;
+            for(j = 0; j < n; j++)
+            {
+                float temp = pA[j];
+                pA[j] = pB[j];
+                pB[j] = temp;
+            }
+        }
+
+        // Eliminate below the pivot, keeping the multipliers as L
+        pPivot = LU->data + col*n;
+        scale = 1.0f/pPivot[col];
+        for(row = col + 1; row < n; row++)
+        {
+            float* pRow = LU->data + row*n;
+            const float factor = pRow[col]*scale;
+
+            pRow[col] = factor;
+            for(j = col + 1; j < n; j++)
+                pRow[j] -= factor*pPivot[j];
+        }
+
+    }// for all columns
+
+    return TRUE;
+
+}// matrixLUDecomposef
+
+
+/*! Solve A x X = B for X, given the LU decomposition of A
+ * \param LU is the n by n decomposition from matrixLUDecomposef().
+ * \param pivot is the row swaps from matrixLUDecomposef().
+ * \param B is the n by s right hand side.
+ * \param X receives the n by s solution. X and B can point to the same matrix.
+ * \return TRUE if the dimensions are compatible, else FALSE.
+ */
+BOOL matrixLUSolvef(const Matrixf_t* LU, const uint32_t pivot[], const Matrixf_t* B, Matrixf_t* X)
+{
+    uint32_t n = LU->numRows, s = B->numCols;
+    uint32_t row, k, j;
+
+    if((LU->numCols != n) || (B->numRows != n) || (X->numRows != n) || (X->numCols != s))
+        return FALSE;
+
+    if(X->data != B->data)
+        memcpy(X->data, B->data, sizeof(float)*n*s);
+
+    // Apply the same row swaps to the right hand side
+    for(row = 0; row < n; row++)
+    {
+        if(pivot[row] != row)
+        {
+            float* pA = X->data + row*s;
+            float* pB = X->data + pivot[row]*s;
+            for(j = 0; j < s; j++)
+            {
+                float temp = pA[j];
+                pA[j] = pB[j];
+                pB[j] = temp;
+            }
+        }
+    }
+
+    // Forward substitution L x Y = P x B, L has a unit diagonal
+    for(row = 1; row < n; row++)
+    {
+        float* pX = X->data + row*s;
+
+        for(k = 0; k < row; k++)
+        {
+            const float factor = get(LU, row, k);
+            const float* pY = X->data + k*s;
+            for(j = 0; j < s; j++)
+                pX[j] -= factor*pY[j];
+        }
+    }
+
+    // Back substitution U x X = Y
+    for(row = n; row-- > 0;)
+    {
+        float* pX = X->data + row*s;
+        float scale;
+
+        for(k = row + 1; k < n; k++)
+        {
+            const float factor = get(LU, row, k);
+            const float* pY = X->data + k*s;
+            for(j = 0; j < s; j++)
+                pX[j] -= factor*pY[j];
+        }
+
+        scale = 1.0f/get(LU, row, row);
+        for(j = 0; j < s; j++)
+            pX[j] *= scale;
+    }
+
+    return TRUE;
+
+}// matrixLUSolvef
+
+
+/*! Propagate a covariance matrix through a linear model, P = F x P x F^T + Q.
+ *  P is assumed symmetric, only the upper triangle of the result is computed
+ *  and it is mirrored into the lower triangle, so the result is exactly
+ *  symmetric.
+ * \param F is the n by n state transition matrix.
+ * \param P is the n by n covariance, which is replaced by the propagated covariance.
+ * \param Q is the n by n process noise to add, which can be NULL.
+ * \param temp is n by n scratch space, which can be NULL in which case it is
+ *        taken from the thread's linear allocator for the duration of the call.
+ * \return TRUE if the dimensions are compatible, else FALSE.
+ */
+BOOL matrixCovarianceUpdatef(const Matrixf_t* F, Matrixf_t* P, const Matrixf_t* Q, Matrixf_t* temp)
+{
+    uint32_t n = F->numRows;
+    uint32_t row, col, k;
+    Matrixf_t scratch;
+
+    if((F->numCols != n) || (P->numRows != n) || (P->numCols != n))
+        return FALSE;
+
+    if((Q != NULL) && ((Q->numRows != n) || (Q->numCols != n)))
+        return FALSE;
+
+    if(temp == NULL)
+    {
+        scratch.numRows = scratch.numCols = n;
+        scratch.data = (float*)linearAllocatorAlloc(NULL, sizeof(float)*n*n);
+        if(scratch.data == NULL)
+            return FALSE;
+    }
+    else if((temp->numRows != n) || (temp->numCols != n) || (temp->data == P->data))
+        return FALSE;
+    else
+        scratch = *temp;
+
+    // First F x P, which is the only full size temporary
+    matrixMultiplyf(F, P, &scratch);
+
+    // Then (F x P) x F^T, which is symmetric, so only the upper triangle is
+    // computed. Both operands are read along contiguous rows.
+    for(row = 0; row < n; row++)
+    {
+        const float* pFP = scratch.data + row*n;
+
+        for(col = row; col < n; col++)
+        {
+            const float* pF = F->data + col*n;
+            float sum = 0.0f;
+
+            for(k = 0; k < n; k++)
+                sum += pFP[k]*pF[k];
+
+            if(Q != NULL)
+                sum += get(Q, row, col);
+
+            set(P, row, col, sum);
+            set(P, col, row, sum);
+        }
+
+    }// for all rows
+
+    if(temp == NULL)
+        linearAllocatorFree(NULL, scratch.data);
+
+    return TRUE;
+
+}// matrixCovarianceUpdatef
+
+
 /*!
  * Test for identity by returning the sum of the absolute differences between
  * a Matrix and an identity matrix of the same dimensions.
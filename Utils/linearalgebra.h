@@ -13,6 +13,7 @@
  */
 
 #include "Types.h"
+#include "linearallocator.h"
 
 // C++ compilers: don't mangle us
 #ifdef __cplusplus
@@ -131,9 +132,15 @@ Vector_t* vectorSetAll(Vector_t* V, double value);
 //! Allocate a vector, initializing its memory
 Vector_t* vectorAllocate(uint32_t num);
 
+//! As above, using a specific allocator
+Vector_t* vectorAllocateWith(LinearAllocator_t* pAllocator, uint32_t num);
+
 //! Change the size of a dynamically allocated vector
 Vector_t* vectorChangeAllocateSize(Vector_t* v, uint32_t num, double initial);
 
+//! As above, using a specific allocator
+Vector_t* vectorChangeAllocateSizeWith(LinearAllocator_t* pAllocator, Vector_t* v, uint32_t num, double initial);
+
 //! Change the size of a vector
 void vectorChangeSize(Vector_t* v, uint32_t num, double initial);
 
@@ -238,9 +245,15 @@ void matrixSetColumn(Matrix_t* M, uint32_t col, double value);
 //! Allocate a matrix, initializing its memory
 Matrix_t* matrixAllocate(uint32_t rows, uint32_t cols);
 
+//! As above, using a specific allocator
+Matrix_t* matrixAllocateWith(LinearAllocator_t* pAllocator, uint32_t rows, uint32_t cols);
+
 //! Change the size of a matrix
 Matrix_t* matrixChangeAllocateSize(Matrix_t* M, uint32_t rows, uint32_t cols, double initial);
 
+//! As above, using a specific allocator
+Matrix_t* matrixChangeAllocateSizeWith(LinearAllocator_t* pAllocator, Matrix_t* M, uint32_t rows, uint32_t cols, double initial);
+
 //! Change the size of a matrix
 void matrixChangeSize(Matrix_t* M, uint32_t rows, uint32_t cols, double initial);
 
@@ -295,15 +308,33 @@ double matrixDotRows(const Matrix_t *A, uint32_t rowA, uint32_t rowB);
 //! Compute the transpose of a matrix
 BOOL matrixTranspose(const Matrix_t* A, Matrix_t* B);
 
-//! Calculate the inverse of a square matrix A, for dimensions 1x2, 2x2, 3x3
+//! Calculate the inverse of a square matrix A of any size
 BOOL matrixInverse(const Matrix_t* A, Matrix_t* B);
 
+//! Compute the Cholesky factor of a symmetric positive definite matrix
+BOOL matrixCholesky(const Matrix_t* A, Matrix_t* L);
+
+//! Solve A x X = B for X using the Cholesky factor of A
+BOOL matrixCholeskySolve(const Matrix_t* L, const Matrix_t* B, Matrix_t* X);
+
+//! Compute the LU decomposition of a square matrix with partial pivoting
+BOOL matrixLUDecompose(const Matrix_t* A, Matrix_t* LU, uint32_t pivot[]);
+
+//! Solve A x X = B for X using the LU decomposition of A
+BOOL matrixLUSolve(const Matrix_t* LU, const uint32_t pivot[], const Matrix_t* B, Matrix_t* X);
+
+//! Propagate a symmetric covariance through a linear model, P = F x P x F^T + Q
+BOOL matrixCovarianceUpdate(const Matrix_t* F, Matrix_t* P, const Matrix_t* Q, Matrix_t* temp);
+
 //! Test a matrix for its error to identity
 double testForIdentity(const Matrix_t* M);
 
 //! Test a matrix for its error to null
 double testForZeroMatrix(const Matrix_t* M);
 
+//! Check the factorizations, solves and inverses against their definitions, returns the number of checks that failed
+int testMatrixSolvers(void);
+
 //! Evaluate the derivative of quadratic equation at x
 double quadraticDerivativeEvaluation(const double cba[3], double x);
 
@@ -410,6 +441,9 @@ Vectorf_t* vectorSetAllf(Vectorf_t* V, float value);
 //! Allocate a vector, initializing its memory
 Vectorf_t* vectorAllocatef(uint32_t num);
 
+//! As above, using a specific allocator
+Vectorf_t* vectorAllocatefWith(LinearAllocator_t* pAllocator, uint32_t num);
+
 //! Set all elements of a vector to zero
 Vectorf_t* vectorZerof(Vectorf_t* V);
 
@@ -458,6 +492,9 @@ float vectorMinf(const Vectorf_t* v);
 //! Change the size of a dynamically allocated vector
 Vectorf_t* vectorChangeAllocateSizef(Vectorf_t* v, uint32_t num, float initial);
 
+//! As above, using a specific allocator
+Vectorf_t* vectorChangeAllocateSizefWith(LinearAllocator_t* pAllocator, Vectorf_t* v, uint32_t num, float initial);
+
 //! Change the size of a vector
 void vectorChangeSizef(Vectorf_t* v, uint32_t num, float initial);
 
@@ -510,9 +547,15 @@ void matrixSetColumnf(Matrixf_t* M, uint32_t col, float value);
 //! Allocate a matrix, initializing its memory
 Matrixf_t* matrixAllocatef(uint32_t rows, uint32_t cols);
 
+//! As above, using a specific allocator
+Matrixf_t* matrixAllocatefWith(LinearAllocator_t* pAllocator, uint32_t rows, uint32_t cols);
+
 //! Change the size of a matrix
 Matrixf_t* matrixChangeAllocateSizef(Matrixf_t* M, uint32_t rows, uint32_t cols, float initial);
 
+//! As above, using a specific allocator
+Matrixf_t* matrixChangeAllocateSizefWith(LinearAllocator_t* pAllocator, Matrixf_t* M, uint32_t rows, uint32_t cols, float initial);
+
 //! Change the size of a matrix
 void matrixChangeSizef(Matrixf_t* M, uint32_t rows, uint32_t cols, float initial);
 
@@ -567,9 +610,24 @@ float matrixDotRowsf(const Matrixf_t *A, uint32_t rowA, uint32_t rowB);
 //! Compute the transpose of a matrix
 BOOL matrixTransposef(const Matrixf_t* A, Matrixf_t* B);
 
-//! Calculate the inverse of a square matrix A, for dimensions 1x2, 2x2, 3x3
+//! Calculate the inverse of a square matrix A of any size
 BOOL matrixInversef(const Matrixf_t* A, Matrixf_t* B);
 
+//! Compute the Cholesky factor of a symmetric positive definite matrix
+BOOL matrixCholeskyf(const Matrixf_t* A, Matrixf_t* L);
+
+//! Solve A x X = B for X using the Cholesky factor of A
+BOOL matrixCholeskySolvef(const Matrixf_t* L, const Matrixf_t* B, Matrixf_t* X);
+
+//! Compute the LU decomposition of a square matrix with partial pivoting
+BOOL matrixLUDecomposef(const Matrixf_t* A, Matrixf_t* LU, uint32_t pivot[]);
+
+//! Solve A x X = B for X using the LU decomposition of A
+BOOL matrixLUSolvef(const Matrixf_t* LU, const uint32_t pivot[], const Matrixf_t* B, Matrixf_t* X);
+
+//! Propagate a symmetric covariance through a linear model, P = F x P x F^T + Q
+BOOL matrixCovarianceUpdatef(const Matrixf_t* F, Matrixf_t* P, const Matrixf_t* Q, Matrixf_t* temp);
+
 //! Test a matrix for its error to identity
 float testForIdentityf(const Matrixf_t* M);
 
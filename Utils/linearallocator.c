@@ -0,0 +1,301 @@
+#include "linearallocator.h"
+#include <stdlib.h>
+#include <string.h>
+
+//! Round a size up to the allocator alignment
+#define alignSize(size) (((size) + LINEAR_ALLOCATOR_ALIGN - 1) & ~(size_t)(LINEAR_ALLOCATOR_ALIGN - 1))
+
+//! Allocator used by this thread, NULL for the heap
+static LINEAR_THREAD_LOCAL LinearAllocator_t* pThreadAllocator = NULL;
+
+/*!
+ * Set the allocator that the calling thread uses for vectorAllocate(),
+ * matrixAllocate() and the other allocation functions in linearalgebra.
+ * \param pAllocator is the new allocator, or NULL to go back to the heap.
+ * \return the allocator that was in use before, so it can be restored.
+ */
+LinearAllocator_t* linearAllocatorSet(LinearAllocator_t* pAllocator)
+{
+    LinearAllocator_t* pPrevious = pThreadAllocator;
+
+    pThreadAllocator = pAllocator;
+
+    return pPrevious;
+
+}// linearAllocatorSet
+
+
+/*!
+ * Get the allocator that the calling thread is using.
+ * \return the allocator, or NULL for the heap.
+ */
+LinearAllocator_t* linearAllocatorGet(void)
+{
+    return pThreadAllocator;
+
+}// linearAllocatorGet
+
+
+/*!
+ * Allocate memory.
+ * \param pAllocator is the allocator to use, or NULL for the calling thread's allocator.
+ * \param size is the number of bytes to allocate.
+ * \return a pointer to the memory, or NULL if the allocation failed.
+ */
+void* linearAllocatorAlloc(LinearAllocator_t* pAllocator, size_t size)
+{
+    if(pAllocator == NULL)
+        pAllocator = pThreadAllocator;
+
+    if(pAllocator == NULL)
+        return malloc(size);
+    else
+        return pAllocator->alloc(pAllocator, size);
+
+}// linearAllocatorAlloc
+
+
+/*!
+ * Change the size of memory obtained from linearAllocatorAlloc(). The
+ * contents are preserved up to the smaller of the two sizes.
+ * \param pAllocator is the allocator that ptr came from, or NULL for the calling thread's allocator.
+ * \param ptr is the memory to resize, or NULL to allocate new memory.
+ * \param oldSize is the current size of ptr in bytes.
+ * \param newSize is the size needed in bytes.
+ * \return a pointer to the resized memory, or NULL if the allocation failed
+ *         in which case ptr is still valid.
+ */
+void* linearAllocatorRealloc(LinearAllocator_t* pAllocator, void* ptr, size_t oldSize, size_t newSize)
+{
+    void* pNew;
+
+    if(pAllocator == NULL)
+        pAllocator = pThreadAllocator;
+
+    if(pAllocator == NULL)
+        return realloc(ptr, newSize);
+
+    if(pAllocator->realloc != NULL)
+        return pAllocator->realloc(pAllocator, ptr, oldSize, newSize);
+
+    // No resize hook, so allocate and copy
+    pNew = pAllocator->alloc(pAllocator, newSize);
+    if((pNew != NULL) && (ptr != NULL))
+    {
+        memcpy(pNew, ptr, (oldSize < newSize) ? oldSize : newSize);
+        linearAllocatorFree(pAllocator, ptr);
+    }
+
+    return pNew;
+
+}// linearAllocatorRealloc
+
+
+/*!
+ * Release memory obtained from linearAllocatorAlloc().
+ * \param pAllocator is the allocator that ptr came from, or NULL for the calling thread's allocator.
+ * \param ptr is the memory to release, NULL is ignored.
+ */
+void linearAllocatorFree(LinearAllocator_t* pAllocator, void* ptr)
+{
+    if(pAllocator == NULL)
+        pAllocator = pThreadAllocator;
+
+    if(ptr == NULL)
+        return;
+    else if(pAllocator == NULL)
+        free(ptr);
+    else if(pAllocator->free != NULL)
+        pAllocator->free(pAllocator, ptr);
+
+}// linearAllocatorFree
+
+
+//! Arena allocation callback: bump the offset
+static void* arenaAlloc(LinearAllocator_t* pAllocator, size_t size)
+{
+    LinearArena_t* pArena = (LinearArena_t*)pAllocator;
+    size_t start = alignSize(pArena->used);
+
+    // Out of room
+    if((start > pArena->size) || (size > pArena->size - start))
+        return NULL;
+
+    pArena->used = start + size;
+
+    return pArena->pBuffer + start;
+
+}// arenaAlloc
+
+
+//! Arena resize callback: the most recent block can grow or shrink in place
+static void* arenaRealloc(LinearAllocator_t* pAllocator, void* ptr, size_t oldSize, size_t newSize)
+{
+    LinearArena_t* pArena = (LinearArena_t*)pAllocator;
+    uint8_t* pOld = (uint8_t*)ptr;
+    void* pNew;
+
+    if(ptr == NULL)
+        return arenaAlloc(pAllocator, newSize);
+
+    // If this is the last thing allocated just move the end of the arena
+    if(pOld + oldSize == pArena->pBuffer + pArena->used)
+    {
+        size_t start = (size_t)(pOld - pArena->pBuffer);
+
+        if(newSize > pArena->size - start)
+            return NULL;
+
+        pArena->used = start + newSize;
+        return ptr;
+    }
+
+    // Otherwise copy to a new block, the old one is reclaimed when the arena is released
+    pNew = arenaAlloc(pAllocator, newSize);
+    if(pNew != NULL)
+        memcpy(pNew, ptr, (oldSize < newSize) ? oldSize : newSize);
+
+    return pNew;
+
+}// arenaRealloc
+
+
+/*!
+ * Set up an arena allocator over a buffer. Allocations from the arena are
+ * O(1) and never fragment; individual frees are ignored and the memory is
+ * reclaimed with linearArenaRelease() or linearArenaReset().
+ * \param pArena is the arena to set up.
+ * \param pBuffer is the memory to allocate from, which must outlive the arena.
+ * \param size is the size of pBuffer in bytes.
+ * \return the arena as a LinearAllocator_t.
+ */
+LinearAllocator_t* linearArenaInit(LinearArena_t* pArena, void* pBuffer, size_t size)
+{
+    // Align the start of the buffer, so every block is aligned
+    size_t pad = alignSize((size_t)pBuffer) - (size_t)pBuffer;
+
+    pArena->base.alloc = arenaAlloc;
+    pArena->base.realloc = arenaRealloc;
+    pArena->base.free = NULL;
+    pArena->base.pUser = NULL;
+    pArena->pBuffer = (uint8_t*)pBuffer + ((pad < size) ? pad : size);
+    pArena->size = (pad < size) ? size - pad : 0;
+    pArena->used = 0;
+
+    return &pArena->base;
+
+}// linearArenaInit
+
+
+/*!
+ * Get the current position of an arena.
+ * \param pArena is the arena.
+ * \return a mark that can be passed to linearArenaRelease().
+ */
+size_t linearArenaMark(const LinearArena_t* pArena)
+{
+    return pArena->used;
+
+}// linearArenaMark
+
+
+/*!
+ * Release everything allocated from an arena since a mark was taken. Any
+ * vectors or matrices allocated after the mark must no longer be used.
+ * \param pArena is the arena.
+ * \param mark is the value returned by linearArenaMark().
+ */
+void linearArenaRelease(LinearArena_t* pArena, size_t mark)
+{
+    if(mark < pArena->used)
+        pArena->used = mark;
+
+}// linearArenaRelease
+
+
+/*!
+ * Release everything allocated from an arena.
+ * \param pArena is the arena.
+ */
+void linearArenaReset(LinearArena_t* pArena)
+{
+    pArena->used = 0;
+
+}// linearArenaReset
+
+
+//! Pool allocation callback: pop a block off the free list
+static void* poolAlloc(LinearAllocator_t* pAllocator, size_t size)
+{
+    LinearPool_t* pPool = (LinearPool_t*)pAllocator;
+    void* pBlock = pPool->pFree;
+
+    // Too big for a block, or out of blocks
+    if((size > pPool->blockSize) || (pBlock == NULL))
+        return NULL;
+
+    pPool->pFree = *(void**)pBlock;
+
+    return pBlock;
+
+}// poolAlloc
+
+
+//! Pool resize callback: a block can hold anything up to the block size
+static void* poolRealloc(LinearAllocator_t* pAllocator, void* ptr, size_t oldSize, size_t newSize)
+{
+    LinearPool_t* pPool = (LinearPool_t*)pAllocator;
+
+    (void)oldSize;
+
+    if(ptr == NULL)
+        return poolAlloc(pAllocator, newSize);
+    else if(newSize > pPool->blockSize)
+        return NULL;
+    else
+        return ptr;
+
+}// poolRealloc
+
+
+//! Pool release callback: push the block back onto the free list
+static void poolFree(LinearAllocator_t* pAllocator, void* ptr)
+{
+    LinearPool_t* pPool = (LinearPool_t*)pAllocator;
+
+    *(void**)ptr = pPool->pFree;
+    pPool->pFree = ptr;
+
+}// poolFree
+
+
+/*!
+ * Set up a pool allocator of fixed size blocks over a buffer. Allocating and
+ * freeing a block are both O(1), and requests larger than a block fail.
+ * \param pPool is the pool to set up.
+ * \param pBuffer is the memory to allocate from, which must outlive the pool.
+ * \param size is the size of pBuffer in bytes.
+ * \param blockSize is the size of each block in bytes.
+ * \return the pool as a LinearAllocator_t.
+ */
+LinearAllocator_t* linearPoolInit(LinearPool_t* pPool, void* pBuffer, size_t size, size_t blockSize)
+{
+    size_t pad = alignSize((size_t)pBuffer) - (size_t)pBuffer;
+    uint8_t* pBlock = (uint8_t*)pBuffer + pad;
+    size_t count;
+
+    pPool->base.alloc = poolAlloc;
+    pPool->base.realloc = poolRealloc;
+    pPool->base.free = poolFree;
+    pPool->base.pUser = NULL;
+    pPool->blockSize = alignSize((blockSize < sizeof(void*)) ? sizeof(void*) : blockSize);
+    pPool->pFree = NULL;
+
+    // Thread every block onto the free list, last block first so allocations go in address order
+    count = (pad < size) ? (size - pad) / pPool->blockSize : 0;
+    while(count-- > 0)
+        poolFree(&pPool->base, pBlock + count*pPool->blockSize);
+
+    return &pPool->base;
+
+}// linearPoolInit
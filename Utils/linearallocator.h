@@ -0,0 +1,117 @@
+#ifndef LINEARALLOCATOR_H
+#define LINEARALLOCATOR_H
+
+/*!
+ * \file
+ * Allocator hooks for the dynamically allocated vectors and matrices in
+ * linearalgebra. By default vectorAllocate(), matrixAllocate() and friends use
+ * the heap. A different allocator can be installed for the calling thread with
+ * linearAllocatorSet(), or passed to the ...With() variants for a single call.
+ * Two allocators that never touch the heap are provided: an arena, which
+ * allocates by bumping an offset and frees everything at once, and a pool of
+ * fixed size blocks with O(1) allocate and free. Either can also be replaced
+ * by user supplied alloc/realloc/free functions.
+ */
+
+#include "Types.h"
+#include <stddef.h>
+
+// C++ compilers: don't mangle us
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Alignment in bytes of every block handed out by the arena and pool allocators
+#define LINEAR_ALLOCATOR_ALIGN 16
+
+//! Thread local storage qualifier, empty on compilers that don't support it
+#if defined(_MSC_VER)
+# define LINEAR_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+# define LINEAR_THREAD_LOCAL __thread
+#else
+# define LINEAR_THREAD_LOCAL
+#endif
+
+//! Interface for an allocator of vector and matrix memory
+typedef struct LinearAllocator
+{
+    //! Allocate size bytes, returning NULL on failure
+    void* (*alloc)(struct LinearAllocator* pAllocator, size_t size);
+
+    //! Resize a block from oldSize to newSize bytes, preserving its contents, returning NULL on failure
+    void* (*realloc)(struct LinearAllocator* pAllocator, void* ptr, size_t oldSize, size_t newSize);
+
+    //! Release a block, can be NULL for allocators that are only ever cleared as a whole
+    void (*free)(struct LinearAllocator* pAllocator, void* ptr);
+
+    //! User data for the callbacks
+    void* pUser;
+
+}LinearAllocator_t;
+
+//! Bump allocator over a caller provided buffer
+typedef struct
+{
+    //! Must be the first member, so the arena can be used as a LinearAllocator_t
+    LinearAllocator_t base;
+
+    //! Memory handed out by the arena
+    uint8_t* pBuffer;
+    size_t size;
+
+    //! Number of bytes in use, including alignment padding
+    size_t used;
+
+}LinearArena_t;
+
+//! Allocator of fixed size blocks from a caller provided buffer
+typedef struct
+{
+    //! Must be the first member, so the pool can be used as a LinearAllocator_t
+    LinearAllocator_t base;
+
+    //! Size of each block in bytes, rounded up to the alignment
+    size_t blockSize;
+
+    //! Singly linked list of the free blocks
+    void* pFree;
+
+}LinearPool_t;
+
+//! Set the allocator used by the calling thread, NULL for the heap. Returns the previous allocator
+LinearAllocator_t* linearAllocatorSet(LinearAllocator_t* pAllocator);
+
+//! Get the allocator used by the calling thread, NULL for the heap
+LinearAllocator_t* linearAllocatorGet(void);
+
+//! Allocate memory from an allocator, or from the calling thread's allocator if pAllocator is NULL
+void* linearAllocatorAlloc(LinearAllocator_t* pAllocator, size_t size);
+
+//! Resize memory from an allocator, or from the calling thread's allocator if pAllocator is NULL
+void* linearAllocatorRealloc(LinearAllocator_t* pAllocator, void* ptr, size_t oldSize, size_t newSize);
+
+//! Release memory to an allocator, or to the calling thread's allocator if pAllocator is NULL
+void linearAllocatorFree(LinearAllocator_t* pAllocator, void* ptr);
+
+//! Set up an arena over a buffer
+LinearAllocator_t* linearArenaInit(LinearArena_t* pArena, void* pBuffer, size_t size);
+
+//! Get the current position of an arena, for a later linearArenaRelease()
+size_t linearArenaMark(const LinearArena_t* pArena);
+
+//! Release everything allocated from an arena since a mark
+void linearArenaRelease(LinearArena_t* pArena, size_t mark);
+
+//! Release everything allocated from an arena
+void linearArenaReset(LinearArena_t* pArena);
+
+//! Set up a pool of fixed size blocks over a buffer, a rows x cols matrix needs sizeof(Matrix_t) + rows*cols*sizeof(double)
+LinearAllocator_t* linearPoolInit(LinearPool_t* pPool, void* pBuffer, size_t size, size_t blockSize);
+
+// C++ compilers: don't mangle us
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LINEARALLOCATOR_H
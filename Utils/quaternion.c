@@ -334,6 +334,60 @@ float quaternionLength(const float quat[NQUATERNION])
 }
 
 
+/*!
+ * Spherically interpolate between two quaternions, rotating at constant
+ * angular rate along the shortest path from p to q.
+ * \param p is the quaternion at t = 0.
+ * \param q is the quaternion at t = 1.
+ * \param t is the fraction of the way from p to q.
+ * \param r receives the interpolated quaternion, which is normalized.
+ *        r can share memory with p or q.
+ * \return a pointer to r.
+ */
+float* quaternionSlerp(const float p[NQUATERNION], const float q[NQUATERNION], float t, float r[NQUATERNION])
+{
+    float cosHalf = p[Q0]*q[Q0] + p[Q1]*q[Q1] + p[Q2]*q[Q2] + p[Q3]*q[Q3];
+    float sign = 1.0f, wp, wq, length;
+    int i;
+
+    // q and -q are the same rotation, take whichever is closer to p
+    if(cosHalf < 0.0f)
+    {
+        cosHalf = -cosHalf;
+        sign = -1.0f;
+    }
+
+    // Nearly the same rotation, where slerp is numerically poor and linear is just as good
+    if(cosHalf > 0.9995f)
+    {
+        wp = 1.0f - t;
+        wq = t;
+    }
+    else
+    {
+        float angle = acosf(cosHalf);
+        float sinAngle = sinf(angle);
+
+        wp = sinf((1.0f - t)*angle)/sinAngle;
+        wq = sinf(t*angle)/sinAngle;
+    }
+
+    wq *= sign;
+    for(i = 0; i < NQUATERNION; i++)
+        r[i] = wp*p[i] + wq*q[i];
+
+    // Clean up any drift in the length
+    length = quaternionLength(r);
+    if(length > 0.0f)
+    {
+        for(i = 0; i < NQUATERNION; i++)
+            r[i] /= length;
+    }
+
+    return r;
+}
+
+
 /*!
  * Multiply two quaternions together such that r = p*q. Quaternions are stored
  * in the form [w,x,y,z].
@@ -429,7 +483,7 @@ float* quaternionToRotVec( const float quat[NQUATERNION],  float rotVec[NVECTOR3
 float* rotVecToQuaternion( const float rotVec[NVECTOR3], float quat[NQUATERNION] )
 {
     // get the magnitude of the rotation vector
-    float magRot = vector3Lengthf(rotVec);
+    float magRot = sqrtf(rotVec[0]*rotVec[0] + rotVec[1]*rotVec[1] + rotVec[2]*rotVec[2]);
 
     if( magRot > 0.0f )
     {
@@ -452,6 +506,9 @@ float* rotVecToQuaternion( const float rotVec[NVECTOR3], float quat[NQUATERNION]
 }
 
 
+// The float profile leaves out the quaternion test, which needs linearalgebra.c, and everything in double precision
+#ifndef ORION_PROFILE_FLOAT
+
 /*!
  * Test quaternion operations
  * \return TRUE if test passed
@@ -1119,3 +1176,4 @@ BOOL testQuaterniond(void)
         return FALSE;
 }
 
+#endif // ORION_PROFILE_FLOAT
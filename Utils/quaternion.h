@@ -78,6 +78,9 @@ void quaternionApplyReverseRotation(const float quat[NQUATERNION], const float i
 //! Compute the length of a quaternion which should be 1.0
 float quaternionLength(const float quat[NQUATERNION]);
 
+//! Spherically interpolate between two quaternions
+float* quaternionSlerp(const float p[NQUATERNION], const float q[NQUATERNION], float t, float r[NQUATERNION]);
+
 //! Multiply two quaternions together
 float* quaternionMultiply( const float p[NQUATERNION], const float q[NQUATERNION], float r[NQUATERNION]);
 
@@ -93,6 +96,9 @@ float* quaternionToRotVec( const float quat[NQUATERNION],  float rotVec[NVECTOR3
 //! Convert a rotation vector to a quaternion
 float* rotVecToQuaternion( const float rotVec[NVECTOR3], float quat[NQUATERNION] );
 
+// The float profile leaves out the quaternion test, which needs linearalgebra.c, and everything in double precision
+#ifndef ORION_PROFILE_FLOAT
+
 //! Test quaternion operations
 BOOL testQuaternion(void);
 
@@ -174,6 +180,8 @@ double* rotVecToQuaterniond( const double rotVec[NVECTOR3], double quat[NQUATERN
 //! Test quaternion operations
 BOOL testQuaterniond(void);
 
+#endif // ORION_PROFILE_FLOAT
+
 // C++ compilers: don't mangle us
 #ifdef __cplusplus
 }
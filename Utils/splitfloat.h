@@ -0,0 +1,237 @@
+#ifndef SPLITFLOAT_H
+#define SPLITFLOAT_H
+
+/*!
+ * \file
+ * Double-float arithmetic for processors that only have a single precision
+ * FPU. A splitf_t carries a number as the unevaluated sum of a high float and
+ * a low float no bigger than half an ulp of the high one, which gives about 44
+ * bits of precision from float operations alone. That's enough to hold an ECEF
+ * coordinate to a few micrometers, where a plain float only resolves half a
+ * meter.
+ *
+ * The error free transforms here rely on every float operation being rounded
+ * to float, so they must not be built with -ffast-math or anything else that
+ * lets the compiler reassociate float arithmetic, or on x87 FPUs that keep
+ * intermediates in extended precision. Contracting multiplies and adds into
+ * fused operations is harmless. Products use fmaf(), which is a single
+ * instruction on the Cortex-M4F and M7.
+ */
+
+#include "Types.h"
+#include <math.h>
+
+// C++ compilers: don't mangle us
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! A number held as the sum of two floats, hi + lo, with |lo| <= ulp(hi)/2
+typedef struct
+{
+    float hi;
+    float lo;
+
+}splitf_t;
+
+/*!
+ * Make a split float from the sum of two floats, without losing anything
+ * \param a is one of the floats.
+ * \param b is the other.
+ * \return a + b exactly.
+ */
+static __inline splitf_t splitfTwoSum(float a, float b)
+{
+    splitf_t r;
+    float bb;
+
+    r.hi = a + b;
+    bb = r.hi - a;
+    r.lo = (a - (r.hi - bb)) + (b - bb);
+    return r;
+}
+
+/*!
+ * Make a split float from the sum of two floats, the first of which must be no
+ * smaller in magnitude than the second
+ * \param a is the larger float.
+ * \param b is the smaller float.
+ * \return a + b exactly.
+ */
+static __inline splitf_t splitfQuickTwoSum(float a, float b)
+{
+    splitf_t r;
+
+    r.hi = a + b;
+    r.lo = b - (r.hi - a);
+    return r;
+}
+
+/*!
+ * Make a split float from the product of two floats, without losing anything
+ * \param a is one of the floats.
+ * \param b is the other.
+ * \return a * b exactly.
+ */
+static __inline splitf_t splitfTwoProd(float a, float b)
+{
+    splitf_t r;
+
+    r.hi = a * b;
+    r.lo = fmaf(a, b, -r.hi);
+    return r;
+}
+
+/*!
+ * Make a split float from a float
+ * \param a is the float.
+ * \return a as a split float.
+ */
+static __inline splitf_t splitfFromFloat(float a)
+{
+    splitf_t r = {a, 0.0f};
+    return r;
+}
+
+/*!
+ * Make a split float from a 32 bit integer, which a float alone would round
+ * to 24 bits
+ * \param a is the integer.
+ * \return a exactly.
+ */
+static __inline splitf_t splitfFromInt32(int32_t a)
+{
+    // The top 24 bits and the bottom 8 bits each fit in a float
+    int32_t low = a & 0xFF;
+
+    return splitfQuickTwoSum((float)(a - low), (float)low);
+}
+
+/*!
+ * Round a split float to a float
+ * \param a is the split float.
+ * \return a rounded to a float.
+ */
+static __inline float splitfToFloat(splitf_t a)
+{
+    return a.hi + a.lo;
+}
+
+/*!
+ * Negate a split float
+ * \param a is the split float.
+ * \return -a.
+ */
+static __inline splitf_t splitfNeg(splitf_t a)
+{
+    a.hi = -a.hi;
+    a.lo = -a.lo;
+    return a;
+}
+
+/*!
+ * Add a float to a split float
+ * \param a is the split float.
+ * \param b is the float.
+ * \return a + b.
+ */
+static __inline splitf_t splitfAddf(splitf_t a, float b)
+{
+    splitf_t s = splitfTwoSum(a.hi, b);
+
+    return splitfQuickTwoSum(s.hi, s.lo + a.lo);
+}
+
+/*!
+ * Add two split floats
+ * \param a is one of the split floats.
+ * \param b is the other.
+ * \return a + b.
+ */
+static __inline splitf_t splitfAdd(splitf_t a, splitf_t b)
+{
+    splitf_t s = splitfTwoSum(a.hi, b.hi);
+    splitf_t t = splitfTwoSum(a.lo, b.lo);
+
+    // Adding the low parts separately keeps the result accurate when the high parts cancel
+    s = splitfQuickTwoSum(s.hi, s.lo + t.hi);
+    return splitfQuickTwoSum(s.hi, s.lo + t.lo);
+}
+
+/*!
+ * Subtract one split float from another
+ * \param a is the split float to subtract from.
+ * \param b is the split float to subtract.
+ * \return a - b.
+ */
+static __inline splitf_t splitfSub(splitf_t a, splitf_t b)
+{
+    return splitfAdd(a, splitfNeg(b));
+}
+
+/*!
+ * Multiply a split float by a float
+ * \param a is the split float.
+ * \param b is the float.
+ * \return a * b.
+ */
+static __inline splitf_t splitfMulf(splitf_t a, float b)
+{
+    splitf_t p = splitfTwoProd(a.hi, b);
+
+    return splitfQuickTwoSum(p.hi, p.lo + a.lo*b);
+}
+
+/*!
+ * Multiply two split floats
+ * \param a is one of the split floats.
+ * \param b is the other.
+ * \return a * b.
+ */
+static __inline splitf_t splitfMul(splitf_t a, splitf_t b)
+{
+    splitf_t p = splitfTwoProd(a.hi, b.hi);
+
+    return splitfQuickTwoSum(p.hi, p.lo + (a.hi*b.lo + a.lo*b.hi));
+}
+
+/*!
+ * Divide one split float by another
+ * \param a is the numerator.
+ * \param b is the denominator, which must not be zero.
+ * \return a / b.
+ */
+static __inline splitf_t splitfDiv(splitf_t a, splitf_t b)
+{
+    // First guess from the high parts, then correct it by the remainder
+    float q = a.hi / b.hi;
+    splitf_t r = splitfSub(a, splitfMulf(b, q));
+
+    return splitfQuickTwoSum(q, r.hi / b.hi);
+}
+
+/*!
+ * Square root of a split float
+ * \param a is the split float.
+ * \return the square root of a, or zero if a is not positive.
+ */
+static __inline splitf_t splitfSqrt(splitf_t a)
+{
+    float x;
+    splitf_t r;
+
+    if(a.hi <= 0.0f)
+        return splitfFromFloat(0.0f);
+
+    // One Newton step from the float square root doubles the precision
+    x = sqrtf(a.hi);
+    r = splitfSub(a, splitfTwoProd(x, x));
+    return splitfQuickTwoSum(x, r.hi / (2.0f*x));
+}
+
+// C++ compilers: don't mangle us
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SPLITFLOAT_H
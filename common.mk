@@ -14,10 +14,31 @@ else ifeq ($(TARGET), tegra)
 	PREFIX=aarch64-unknown-linux-gnu-
 else ifeq ($(TARGET), arm64)
 	PREFIX=aarch64-linux-gnu-
+else ifeq ($(TARGET), cortex-m4)
+	PREFIX=arm-none-eabi-
+	CFLAGS+=-mcpu=cortex-m4 -mthumb -mfpu=fpv4-sp-d16 -mfloat-abi=hard -ffunction-sections -fdata-sections
+	PROFILE?=float
+else ifeq ($(TARGET), cortex-m7)
+	PREFIX=arm-none-eabi-
+	CFLAGS+=-mcpu=cortex-m7 -mthumb -mfpu=fpv5-sp-d16 -mfloat-abi=hard -ffunction-sections -fdata-sections
+	PROFILE?=float
+endif
+
+# Numeric profile: double for everything, or float for processors without a
+# double precision FPU, which only builds the packet, DCM and geodesy code
+PROFILE ?= double
+
+ifeq ($(PROFILE), double)
+	OUT_DIR = $(TARGET)
+else ifeq ($(PROFILE), float)
+	OUT_DIR = $(TARGET)-float
+	CFLAGS+=-DORION_PROFILE_FLOAT
+else
+$(error Unknown PROFILE $(PROFILE), use double or float)
 endif
 
 CC?=$(PREFIX)gcc
 AR?=$(PREFIX)ar
-OBJ_DIR = $(TARGET)/obj
+OBJ_DIR = $(OUT_DIR)/obj
 
 $(shell mkdir -p $(OBJ_DIR))